@@ -1947,6 +1947,8 @@ returnself(matchsolvable)
   static const int POOL_FLAG_ADDFILEPROVIDESFILTERED = POOL_FLAG_ADDFILEPROVIDESFILTERED;
   static const int POOL_FLAG_NOWHATPROVIDESAUX = POOL_FLAG_NOWHATPROVIDESAUX;
   static const int POOL_FLAG_WHATPROVIDESWITHDISABLED = POOL_FLAG_WHATPROVIDESWITHDISABLED;
+  static const int POOL_FLAG_WHATPROVIDESEVRINDEX = POOL_FLAG_WHATPROVIDESEVRINDEX;
+  static const int POOL_FLAG_STRINGHASHES = POOL_FLAG_STRINGHASHES;
   static const int DISTTYPE_RPM = DISTTYPE_RPM;
   static const int DISTTYPE_DEB = DISTTYPE_DEB;
   static const int DISTTYPE_ARCH = DISTTYPE_ARCH;
@@ -2269,6 +2271,12 @@ returnself(matchsolvable)
   void createwhatprovides() {
     pool_createwhatprovides($self);
   }
+  void freeze() {
+    pool_freeze($self);
+  }
+  void unfreeze() {
+    pool_unfreeze($self);
+  }
 
   %newobject id2solvable;
   XSolvable *id2solvable(Id id) {
@@ -2544,6 +2552,8 @@ returnself(matchsolvable)
   static const int REPO_USE_ROOTDIR = REPO_USE_ROOTDIR;
   static const int REPO_NO_LOCATION = REPO_NO_LOCATION;
   static const int SOLV_ADD_NO_STUBS = SOLV_ADD_NO_STUBS;       /* repo_solv */
+  static const int SOLV_ADD_MMAP = SOLV_ADD_MMAP;               /* repo_solv */
+  static const int SOLV_ADD_DELTAS = SOLV_ADD_DELTAS;           /* repo_solv */
 #ifdef ENABLE_SUSEREPO
   static const int SUSETAGS_RECORD_SHARES = SUSETAGS_RECORD_SHARES;     /* repo_susetags */
 #endif
@@ -3891,6 +3901,10 @@ returnself(matchsolvable)
   static const int SOLVER_FLAG_ONLY_NAMESPACE_RECOMMENDED = SOLVER_FLAG_ONLY_NAMESPACE_RECOMMENDED;
   static const int SOLVER_FLAG_STRICT_REPO_PRIORITY = SOLVER_FLAG_STRICT_REPO_PRIORITY;
   static const int SOLVER_FLAG_FOCUS_NEW = SOLVER_FLAG_FOCUS_NEW;
+  static const int SOLVER_FLAG_WATCH_VECTORS = SOLVER_FLAG_WATCH_VECTORS;
+  static const int SOLVER_FLAG_RESTARTS = SOLVER_FLAG_RESTARTS;
+  static const int SOLVER_FLAG_INCREMENTAL = SOLVER_FLAG_INCREMENTAL;
+  static const int SOLVER_FLAG_PARALLEL_PKGRULES = SOLVER_FLAG_PARALLEL_PKGRULES;
 
   static const int SOLVER_REASON_UNRELATED = SOLVER_REASON_UNRELATED;
   static const int SOLVER_REASON_UNIT_RULE = SOLVER_REASON_UNIT_RULE;
@@ -18,6 +18,7 @@
 #include "evr.h"
 #include "repo.h"
 #include "repo_solv.h"
+#include "repo_write.h"
 #include "solver.h"
 #include "solverdebug.h"
 #include "chksum.h"
@@ -103,6 +104,10 @@ static struct resultflags2str {
   { TESTCASE_RESULT_ORDER,		"order" },
   { TESTCASE_RESULT_ORDEREDGES,		"orderedges" },
   { TESTCASE_RESULT_PROOF,		"proof" },
+  { TESTCASE_RESULT_WHATPROVIDES,	"whatprovides" },
+  { TESTCASE_RESULT_ATTRIBUTES,		"attributes" },
+  { TESTCASE_RESULT_PAGECACHE,		"pagecache" },
+  { TESTCASE_RESULT_MEMSTATS,		"memstats" },
   { 0, 0 }
 };
 
@@ -140,6 +145,10 @@ static struct solverflags2str {
   { SOLVER_FLAG_ONLY_NAMESPACE_RECOMMENDED, "onlynamespacerecommended", 0 },
   { SOLVER_FLAG_STRICT_REPO_PRIORITY,       "strictrepopriority", 0 },
   { SOLVER_FLAG_FOCUS_NEW,                  "focusnew", 0 },
+  { SOLVER_FLAG_WATCH_VECTORS,              "watchvectors", 0 },
+  { SOLVER_FLAG_RESTARTS,                   "restarts", 0 },
+  { SOLVER_FLAG_INCREMENTAL,                "incremental", 0 },
+  { SOLVER_FLAG_PARALLEL_PKGRULES,          "parallelpkgrules", 0 },
   { 0, 0, 0 }
 };
 
@@ -160,6 +169,8 @@ static struct poolflags2str {
   { POOL_FLAG_ADDFILEPROVIDESFILTERED,      "addfileprovidesfiltered", 0 },
   { POOL_FLAG_NOWHATPROVIDESAUX,            "nowhatprovidesaux", 0 },
   { POOL_FLAG_WHATPROVIDESWITHDISABLED,     "whatprovideswithdisabled", 0 },
+  { POOL_FLAG_WHATPROVIDESEVRINDEX,         "whatprovidesevrindex", 0 },
+  { POOL_FLAG_STRINGHASHES,                 "stringhashes", 0 },
   { 0, 0, 0 }
 };
 
@@ -211,6 +222,9 @@ static const char *features[] = {
 #endif
 #if ENABLE_TESTCASE_HELIXREPO
   "testcase_helixrepo",
+#endif
+#ifdef ENABLE_ZSTD_PAGES
+  "zstd_pages",
 #endif
   0
 };
@@ -1017,6 +1031,12 @@ testcase_getsolverflags(Solver *solv)
       if (v == solverflags2str[i].def)
 	continue;
       str = pool_tmpappend(pool, str, v ? " " : " !", solverflags2str[i].str);
+      if (v > 1)
+	{
+	  char buf[20];
+	  sprintf(buf, "=%d", v);
+	  str = pool_tmpappend(pool, str, buf, 0);
+	}
     }
   return str ? str + 1 : "";
 }
@@ -1039,13 +1059,20 @@ testcase_setsolverflags(Solver *solv, const char *str)
       if (!*p)
 	break;
       s = p;
-      while (*p && *p != ' ' && *p != '\t' && *p != ',')
+      while (*p && *p != ' ' && *p != '\t' && *p != ',' && *p != '=')
 	p++;
       for (i = 0; solverflags2str[i].str; i++)
 	if (!strncmp(solverflags2str[i].str, s, p - s) && solverflags2str[i].str[p - s] == 0)
 	  break;
       if (!solverflags2str[i].str)
 	return pool_error(solv->pool, 0, "setsolverflags: unknown flag '%.*s'", (int)(p - s), s);
+      if (*p == '=')
+	{
+	  /* flag with a value, e.g. the number of threads */
+	  v = atoi(++p);
+	  while (*p && *p != ' ' && *p != '\t' && *p != ',')
+	    p++;
+	}
       if (solver_set_flag(solv, solverflags2str[i].flag, v) == -1)
         return pool_error(solv->pool, 0, "setsolverflags: unsupported flag '%s'", solverflags2str[i].str);
     }
@@ -1280,6 +1307,140 @@ dump_genid(Pool *pool, Strqueue *sq, Id id, int cnt)
   return cnt;
 }
 
+/* check that the lookup function finds the string of the dataiterator */
+static int
+check_str_lookup(Pool *pool, Id p, Id keyname, const char *str)
+{
+  const char *s = solvable_lookup_str(pool->solvables + p, keyname);
+  return s && !strcmp(s, str);
+}
+
+/* check that the lookup functions find the num value of the dataiterator */
+static int
+check_num_lookup(Pool *pool, Id p, Id keyname, unsigned long long num)
+{
+  Dataiterator di;
+  int ok;
+
+  if (solvable_lookup_num(pool->solvables + p, keyname, ~num) != num)
+    return 0;
+  dataiterator_init(&di, pool, 0, p, keyname, 0, 0);
+  ok = dataiterator_step(&di) && SOLV_KV_NUM64(&di.kv) == num;
+  dataiterator_free(&di);
+  return ok;
+}
+
+/* dump all attributes of the solvables and the repository meta data */
+static void
+dump_attributes(Pool *pool, Strqueue *sq)
+{
+  Dataiterator di;
+  Repo *repo;
+  Id p;
+  int i, j;
+  const char *s, *v;
+  char buf[64];
+
+  FOR_REPOS(i, repo)
+    {
+      for (j = 0; j < 2; j++)
+	{
+	  dataiterator_init(&di, pool, repo, j ? SOLVID_META : 0, 0, 0, SEARCH_SUB);
+	  while (dataiterator_step(&di))
+	    {
+	      p = di.solvid;
+	      s = p > 0 ? testcase_solvid2str(pool, p) : pool_tmpjoin(pool, "meta@", testcase_repoid2str(pool, repo->repoid), 0);
+	      s = pool_tmpjoin(pool, "attr ", s, di.nparents ? " sub " : " ");
+	      s = pool_tmpappend(pool, s, pool_id2str(pool, di.key->name), " ");
+	      switch (di.key->type)
+		{
+		case REPOKEY_TYPE_ID:
+		case REPOKEY_TYPE_IDARRAY:
+		  v = di.data && di.data->localpool ? repodata_stringify(pool, di.data, di.key, &di.kv, 0) : testcase_dep2str(pool, di.kv.id);
+		  break;
+		case REPOKEY_TYPE_NUM:
+		  sprintf(buf, "%llu", SOLV_KV_NUM64(&di.kv));
+		  if (p > 0 && !di.nparents && !check_num_lookup(pool, p, di.key->name, SOLV_KV_NUM64(&di.kv)))
+		    strcat(buf, " <lookup mismatch>");
+		  v = buf;
+		  break;
+		case REPOKEY_TYPE_VOID:
+		  v = "";
+		  break;
+		case REPOKEY_TYPE_FIXARRAY:
+		case REPOKEY_TYPE_FLEXARRAY:
+		  v = "<array>";
+		  break;
+		case REPOKEY_TYPE_STR:
+		  v = di.kv.str;
+		  if (p > 0 && !di.nparents && !check_str_lookup(pool, p, di.key->name, v))
+		    v = pool_tmpjoin(pool, v, " <lookup mismatch>", 0);
+		  break;
+		default:
+		  v = repodata_stringify(pool, di.data, di.key, &di.kv, SEARCH_FILES | SEARCH_CHECKSUMS);
+		  if (!v)
+		    {
+		      sprintf(buf, "<%s>", pool_id2str(pool, di.key->type));
+		      v = buf;
+		    }
+		  break;
+		}
+	      strqueue_push(sq, pool_tmpappend(pool, s, v, 0));
+	    }
+	  dataiterator_free(&di);
+	}
+    }
+}
+
+/* walk over all attributes twice and dump the page cache statistics.
+ * The pages loaded by the read-ahead threads depend on the timing, so
+ * they are not part of the result */
+static void
+dump_pagecache(Pool *pool, Strqueue *sq)
+{
+  Pool_pagecachestats stats;
+  Dataiterator di;
+  char buf[64];
+  int i;
+
+  pool_reset_pagecache_stats(pool);
+  for (i = 0; i < 2; i++)
+    {
+      dataiterator_init(&di, pool, 0, 0, 0, 0, SEARCH_SUB);
+      while (dataiterator_step(&di))
+	;
+      dataiterator_free(&di);
+    }
+
+  pool_get_pagecache_stats(pool, &stats);
+  sprintf(buf, "pagecache hits %llu", stats.hits);
+  strqueue_push(sq, buf);
+  sprintf(buf, "pagecache misses %llu", stats.misses);
+  strqueue_push(sq, buf);
+  sprintf(buf, "pagecache evictions %llu", stats.evictions);
+  strqueue_push(sq, buf);
+  sprintf(buf, "pagecache used %llu", (unsigned long long)stats.used);
+  strqueue_push(sq, buf);
+}
+
+/* dump the memory used by the pool. The memory of the repos
+ * contains pointers, so it depends on the platform and is not
+ * part of the result */
+static void
+dump_memstats(Pool *pool, Strqueue *sq)
+{
+  Pool_memstats stats;
+  char buf[64];
+
+  pool_memstats(pool, &stats);
+  sprintf(buf, "memstats stringspace %llu", (unsigned long long)stats.stringspace);
+  strqueue_push(sq, buf);
+  sprintf(buf, "memstats rels %llu", (unsigned long long)stats.rels);
+  strqueue_push(sq, buf);
+  sprintf(buf, "memstats whatprovides %llu", (unsigned long long)stats.whatprovides);
+  strqueue_push(sq, buf);
+}
+
 char *
 testcase_solverresult(Solver *solv, int resultflags)
 {
@@ -1625,6 +1786,28 @@ testcase_solverresult(Solver *solv, int resultflags)
 	}
       queue_free(&q);
     }
+  if ((resultflags & TESTCASE_RESULT_WHATPROVIDES) != 0 && pool->whatprovides_rel)
+    {
+      /* dump the providers of all relations that were looked up */
+      Id rid, *pp;
+      for (rid = 1; rid < pool->nrels; rid++)
+	{
+	  if (!pool->whatprovides_rel[rid])
+	    continue;
+	  s = pool_tmpjoin(pool, "whatprovides ", testcase_dep2str(pool, MAKERELDEP(rid)), 0);
+	  pp = pool->whatprovidesdata + pool->whatprovides_rel[rid];
+	  if (!*pp)
+	    strqueue_push(&sq, s);
+	  for (; *pp; pp++)
+	    strqueue_push(&sq, pool_tmpjoin(pool, s, " ", testcase_solvid2str(pool, *pp)));
+	}
+    }
+  if ((resultflags & TESTCASE_RESULT_ATTRIBUTES) != 0)
+    dump_attributes(pool, &sq);
+  if ((resultflags & TESTCASE_RESULT_PAGECACHE) != 0)
+    dump_pagecache(pool, &sq);
+  if ((resultflags & TESTCASE_RESULT_MEMSTATS) != 0)
+    dump_memstats(pool, &sq);
   if ((resultflags & TESTCASE_RESULT_GENID) != 0)
     {
       for (i = 0 ; i < solv->job.count; i += 2)
@@ -2145,6 +2328,281 @@ str2resultflags(Pool *pool, char *s)	/* modifies the string! */
   return resultflags;
 }
 
+struct reloadopts {
+  int writerflags;
+  int pagecodec;
+  int nthreads;
+  int ndelta;			/* write the last ndelta solvables as delta */
+  const char *deltabase;	/* base cookie of the delta */
+  Queue deltaremoved;		/* solvables removed by the delta */
+};
+
+/* write the solvables from start to end, either as base with cookie
+ * "base" or as delta with cookie "delta" */
+static int
+reload_write_part(Repo *repo, FILE *fp, struct reloadopts *ro, Id start, Id end, int delta)
+{
+  Repowriter *writer;
+  int r;
+
+  writer = repowriter_create(repo);
+  repowriter_set_flags(writer, ro->writerflags);
+  if (ro->pagecodec && !repowriter_set_pagecodec(writer, ro->pagecodec))
+    {
+      repowriter_free(writer);
+      return -1;
+    }
+  if (ro->nthreads)
+    repowriter_set_nthreads(writer, ro->nthreads);
+  if (ro->ndelta)
+    {
+      repowriter_set_solvablerange(writer, start, end);
+      repowriter_set_userdata(writer, delta ? "delta" : "base", delta ? 5 : 4);
+      if (delta)
+	{
+	  /* only the removed solvables of this repo */
+	  Queue removed;
+	  int i;
+	  queue_init(&removed);
+	  for (i = 0; i < ro->deltaremoved.count; i++)
+	    if (repo->pool->solvables[ro->deltaremoved.elements[i]].repo == repo)
+	      queue_push(&removed, ro->deltaremoved.elements[i]);
+	  repowriter_set_deltabase(writer, ro->deltabase, strlen(ro->deltabase), &removed);
+	  queue_free(&removed);
+	}
+    }
+  r = repowriter_write(writer, fp);
+  repowriter_free(writer);
+  return r;
+}
+
+/* write the repo into a temporary solv file. The last ndelta
+ * solvables are written as delta that is appended to the base */
+static FILE *
+reload_write(Repo *repo, struct reloadopts *ro)
+{
+  Pool *pool = repo->pool;
+  Solvable *s;
+  FILE *fp;
+  Id p, split = repo->end;
+  int n = 0;
+
+  if (ro->ndelta)
+    {
+      for (p = repo->end - 1, s = pool->solvables + p; p >= repo->start; p--, s--)
+	if (s->repo == repo && ++n == ro->ndelta)
+	  break;
+      split = p;
+    }
+  if ((fp = tmpfile()) == 0)
+    return 0;
+  if (reload_write_part(repo, fp, ro, repo->start, split, 0)
+      || (ro->ndelta && reload_write_part(repo, fp, ro, split, repo->end, 1))
+      || fflush(fp) || fseek(fp, 0, SEEK_SET))
+    {
+      fclose(fp);
+      return 0;
+    }
+  return fp;
+}
+
+static int
+reload_extend_keyfilter(Repo *repo, Repokey *key, void *kfdata)
+{
+  return key->name == *(Id *)kfdata ? repo_write_stdkeyfilter(repo, key, 0) : KEY_STORAGE_DROPPED;
+}
+
+/* write key keyname of the reloaded repo into an extension and add
+ * it with REPO_EXTEND_SOLVABLES */
+static int
+reload_extend(Repo *repo, Id keyname)
+{
+  Repowriter *writer;
+  FILE *fp;
+  int r;
+
+  if ((fp = tmpfile()) == 0)
+    return -1;
+  repo_internalize(repo);
+  writer = repowriter_create(repo);
+  repowriter_set_keyfilter(writer, reload_extend_keyfilter, &keyname);
+  r = repowriter_write(writer, fp);
+  repowriter_free(writer);
+  if (!r && (fflush(fp) || fseek(fp, 0, SEEK_SET)))
+    r = -1;
+  if (!r)
+    r = repo_add_solv(repo, fp, REPO_EXTEND_SOLVABLES);
+  fclose(fp);
+  return r;
+}
+
+static unsigned char *
+reload_slurp(FILE *fp, size_t *lenp)
+{
+  unsigned char *buf = 0;
+  size_t len = 0, l;
+
+  for (;;)
+    {
+      buf = solv_realloc(buf, len + 4096);
+      if ((l = fread(buf + len, 1, 4096, fp)) == 0)
+	break;
+      len += l;
+    }
+  *lenp = len;
+  return buf;
+}
+
+/* replace the first occurrence of a byte string in a written solv
+ * file with one of the same length, used to create broken files.
+ * patch is a comma separated list of from:to pairs */
+static int
+reload_patch(FILE *fp, const char *patch)
+{
+  unsigned char *buf;
+  const char *to, *end;
+  size_t len, off, plen;
+  int r = 0;
+
+  buf = reload_slurp(fp, &len);
+  for (; *patch && !r; patch = *end ? end + 1 : end)
+    {
+      end = patch + strcspn(patch, ",");
+      to = memchr(patch, ':', end - patch);
+      if (!to || (plen = to - patch) == 0 || (size_t)(end - to - 1) != plen)
+	{
+	  r = -1;
+	  break;
+	}
+      to++;
+      for (off = 0; off + plen <= len; off++)
+	if (!memcmp(buf + off, patch, plen))
+	  break;
+      if (off + plen > len)
+	r = -1;
+      else
+	memcpy(buf + off, to, plen);
+    }
+  if (!r && (fseek(fp, 0, SEEK_SET) != 0 || fwrite(buf, len, 1, fp) != 1 || fflush(fp) != 0 || fseek(fp, 0, SEEK_SET) != 0))
+    r = -1;
+  solv_free(buf);
+  return r;
+}
+
+/* write the repos as solv files and read them back. This is used
+ * to test the solv file writer and the different ways of
+ * loading the solv file. With batch set, all files are read with
+ * repo_add_solv_batch() */
+static int
+testcase_reload(Pool *pool, Repo **repos, int nrepos, char **opts, int nopts)
+{
+  Repo *repo;
+  FILE **fps;
+  int i, r, flags = 0, nodeltas = 0, batch = 0;
+  const char *patch = 0;
+  Id extend = 0;
+  struct reloadopts ro;
+  Queue columns;
+  Id p;
+
+  memset(&ro, 0, sizeof(ro));
+  ro.pagecodec = REPOWRITER_PAGECODEC_DEFAULT;
+  ro.deltabase = "base";
+  queue_init(&ro.deltaremoved);
+  queue_init(&columns);
+  for (i = 0; i < nopts; i++)
+    {
+      if (!strcmp(opts[i], "mmap"))
+	flags |= SOLV_ADD_MMAP;
+      else if (!strcmp(opts[i], "pagecodec=lz"))
+	ro.pagecodec = REPOWRITER_PAGECODEC_DEFAULT;
+      else if (!strcmp(opts[i], "pagecodec=zstd"))
+	ro.pagecodec = REPOWRITER_PAGECODEC_ZSTD;
+      else if (!strcmp(opts[i], "pagecodecdict"))
+	ro.writerflags |= REPOWRITER_PAGECODEC_DICT;
+      else if (!strncmp(opts[i], "pagethreads=", 12))
+	ro.nthreads = atoi(opts[i] + 12);
+      else if (!strncmp(opts[i], "patch=", 6))
+	patch = opts[i] + 6;
+      else if (!strncmp(opts[i], "extend=", 7))
+	extend = pool_str2id(pool, opts[i] + 7, 1);
+      else if (!strncmp(opts[i], "column=", 7))
+	queue_push(&columns, pool_str2id(pool, opts[i] + 7, 1));
+      else if (!strncmp(opts[i], "delta=", 6))
+	{
+	  ro.ndelta = atoi(opts[i] + 6);
+	  flags |= SOLV_ADD_DELTAS;
+	}
+      else if (!strncmp(opts[i], "deltabase=", 10))
+	ro.deltabase = opts[i] + 10;
+      else if (!strncmp(opts[i], "deltaremove=", 12))
+	{
+	  if (!pool->whatprovides)
+	    pool_createwhatprovides(pool);
+	  if ((p = testcase_str2solvid(pool, opts[i] + 12)) != 0)
+	    queue_push(&ro.deltaremoved, p);
+	  else
+	    pool_error(pool, 0, "testcase_read: unknown solvable '%s'", opts[i] + 12);
+	}
+      else if (!strcmp(opts[i], "nodeltas"))
+	nodeltas = 1;
+      else if (!strncmp(opts[i], "batch=", 6))
+	batch = atoi(opts[i] + 6);
+      else
+	{
+	  queue_free(&columns);
+	  queue_free(&ro.deltaremoved);
+	  return pool_error(pool, -1, "testcase_read: unknown reload option '%s'", opts[i]);
+	}
+    }
+  if (nodeltas)
+    flags &= ~SOLV_ADD_DELTAS;
+  fps = solv_calloc(nrepos, sizeof(FILE *));
+  for (i = 0, r = 0; i < nrepos && !r; i++)
+    {
+      repo = repos[i];
+      repo_internalize(repo);
+      if (columns.count)
+	{
+	  Repodata *data;
+	  int rdid, j;
+	  FOR_REPODATAS(repo, rdid, data)
+	    for (j = 0; j < columns.count; j++)
+	      repodata_create_column(data, columns.elements[j]);
+	}
+      if ((fps[i] = reload_write(repo, &ro)) == 0)
+	r = pool_error(pool, -1, "testcase_read: could not write repo '%s'", repo->name);
+      else if (patch && reload_patch(fps[i], patch))
+	r = pool_error(pool, -1, "testcase_read: could not patch repo '%s'", repo->name);
+    }
+  queue_free(&columns);
+  queue_free(&ro.deltaremoved);
+  if (!r)
+    {
+      for (i = 0; i < nrepos; i++)
+	repo_empty(repos[i], 1);
+      if (batch)
+	{
+	  if (repo_add_solv_batch(repos, fps, nrepos, flags, batch))
+	    r = pool_error(pool, -1, "testcase_read: could not reload the repos");
+	}
+      else
+	{
+	  for (i = 0; i < nrepos && !r; i++)
+	    if (repo_add_solv(repos[i], fps[i], flags))
+	      r = pool_error(pool, -1, "testcase_read: could not reload repo '%s'", repos[i]->name);
+	}
+      for (i = 0; i < nrepos && !r && extend; i++)
+	if (reload_extend(repos[i], extend))
+	  r = pool_error(pool, -1, "testcase_read: could not extend repo '%s'", repos[i]->name);
+    }
+  for (i = 0; i < nrepos; i++)
+    if (fps[i])
+      fclose(fps[i]);
+  solv_free(fps);
+  return r;
+}
+
 Solver *
 testcase_read(Pool *pool, FILE *fp, const char *testcase, Queue *job, char **resultp, int *resultflagsp)
 {
@@ -2164,6 +2622,10 @@ testcase_read(Pool *pool, FILE *fp, const char *testcase, Queue *job, char **res
   Queue autoinstq;
   int oldjobsize = job ? job->count : 0;
 
+  /* a continuation that goes on with a reused incremental solver does
+   * not need to recreate the whatprovides, this keeps the pool generation */
+  if (fp && resultflagsp && (*resultflagsp & TESTCASE_RESULT_REUSE_SOLVER) != 0 && pool->whatprovides && !pool->considered)
+    prepared = 1;
   if (resultp)
     *resultp = 0;
   if (resultflagsp)
@@ -2307,6 +2769,69 @@ testcase_read(Pool *pool, FILE *fp, const char *testcase, Queue *job, char **res
 		}
 	    }
 	}
+      else if (!strcmp(pieces[0], "reload") && npieces >= 2)
+	{
+	  Repo **repos = 0;
+	  int nrepos = 0;
+	  char *rp, *rpe;
+	  if (pool->considered || solv || (job && job->count != oldjobsize))
+	    {
+	      pool_error(pool, 0, "testcase_read: cannot reload repos after packages were disabled or jobs were created");
+	      continue;
+	    }
+	  /* a comma separated list of repos */
+	  for (rp = pieces[1]; rp; rp = rpe)
+	    {
+	      if ((rpe = strchr(rp, ',')) != 0)
+		*rpe++ = 0;
+	      repos = solv_extend(repos, nrepos, 1, sizeof(Repo *), 7);
+	      if ((repos[nrepos] = testcase_str2repo(pool, rp)) == 0)
+		{
+		  pool_error(pool, 0, "testcase_read: unknown repo '%s'", rp);
+		  break;
+		}
+	      nrepos++;
+	    }
+	  if (!rp)
+	    {
+	      prepared = 0;
+	      testcase_reload(pool, repos, nrepos, pieces + 2, npieces - 2);
+	    }
+	  solv_free(repos);
+	}
+      else if (!strcmp(pieces[0], "compact"))
+	{
+	  /* free the given repos, then drop the unused ids */
+	  int i;
+	  if (pool->considered || solv || (job && job->count != oldjobsize))
+	    {
+	      pool_error(pool, 0, "testcase_read: cannot compact the pool after packages were disabled or jobs were created");
+	      continue;
+	    }
+	  if (prepared <= 0)
+	    {
+	      pool_addfileprovides(pool);
+	      pool_createwhatprovides(pool);
+	      prepared = 1;
+	    }
+	  for (i = 1; i < npieces; i++)
+	    {
+	      Repo *repo = testcase_str2repo(pool, pieces[i]);
+	      if (repo)
+		repo_free(repo, 1);
+	      else
+		pool_error(pool, 0, "testcase_read: unknown repo '%s'", pieces[i]);
+	    }
+	  if (!pool->whatprovides)
+	    pool_createwhatprovides(pool);
+	  if (pool_compact(pool, 0, 0, 0))
+	    pool_error(pool, 0, "testcase_read: could not compact the pool");
+	}
+      else if (!strcmp(pieces[0], "pagecache") && npieces >= 2)
+	{
+	  pool_set_pagecache_growth(pool, (size_t)strtoull(pieces[1], 0, 10));
+	  pool_set_pagecache_readahead(pool, npieces > 2 ? atoi(pieces[2]) : 0);
+	}
       else if (!strcmp(pieces[0], "system") && npieces >= 3)
 	{
 	  int i;
@@ -24,8 +24,13 @@
 #define TESTCASE_RESULT_ORDER		(1 << 12)
 #define TESTCASE_RESULT_ORDEREDGES	(1 << 13)
 #define TESTCASE_RESULT_PROOF		(1 << 14)
+#define TESTCASE_RESULT_WHATPROVIDES	(1 << 15)
+#define TESTCASE_RESULT_ATTRIBUTES	(1 << 16)
+#define TESTCASE_RESULT_PAGECACHE	(1 << 17)
+#define TESTCASE_RESULT_MEMSTATS	(1 << 18)
 
-/* reuse solver hack, testsolv use only */
+/* reuse solver hack, testsolv use only. Passed in to testcase_read
+ * if the continuation goes on with a reused incremental solver */
 #define TESTCASE_RESULT_REUSE_SOLVER	(1 << 31)
 
 extern Id testcase_str2dep(Pool *pool, const char *s);
@@ -0,0 +1,125 @@
+/*
+ * Copyright (c) 2025, SUSE LLC
+ *
+ * This program is licensed under the BSD license, read LICENSE.BSD
+ * for further information
+ */
+
+/*
+ * arena.c
+ *
+ * simple bump allocator for short lived data. Memory is handed out
+ * from big blocks and given back all at once, either to a mark or
+ * completely. Released blocks are kept for reuse until arena_free()
+ * is called.
+ */
+
+#include <stdlib.h>
+#include <string.h>
+
+#include "arena.h"
+#include "util.h"
+
+#define ARENA_BLOCKSIZE		(64 * 1024)
+#define ARENA_ALIGN		(sizeof(void *) > sizeof(double) ? sizeof(void *) : sizeof(double))
+
+struct s_Arenablock {
+  struct s_Arenablock *prev;
+  size_t size;			/* usable size */
+  size_t offset;		/* bytes used in all older blocks */
+};
+
+#define ARENABLOCK_HDRSIZE ((sizeof(struct s_Arenablock) + ARENA_ALIGN - 1) & ~(ARENA_ALIGN - 1))
+#define ARENABLOCK_DATA(b) ((unsigned char *)(b) + ARENABLOCK_HDRSIZE)
+
+void
+arena_init(Arena *a)
+{
+  memset(a, 0, sizeof(*a));
+}
+
+void
+arena_free(Arena *a)
+{
+  struct s_Arenablock *b;
+  arena_reset(a);
+  while ((b = a->spare) != 0)
+    {
+      a->spare = b->prev;
+      solv_free(b);
+    }
+}
+
+static void
+arena_newblock(Arena *a, size_t len)
+{
+  struct s_Arenablock *b, **bp;
+  size_t offset = a->block ? a->block->offset + a->used : 0;
+
+  /* first try to reuse a released block */
+  for (bp = &a->spare; (b = *bp) != 0; bp = &b->prev)
+    if (b->size >= len)
+      break;
+  if (b)
+    *bp = b->prev;
+  else
+    {
+      size_t size = len > ARENA_BLOCKSIZE ? len : ARENA_BLOCKSIZE;
+      b = solv_malloc(ARENABLOCK_HDRSIZE + size);
+      b->size = size;
+    }
+  b->offset = offset;
+  b->prev = a->block;
+  a->block = b;
+  a->used = 0;
+}
+
+void *
+arena_alloc(Arena *a, size_t len)
+{
+  void *r;
+  len = (len + ARENA_ALIGN - 1) & ~(ARENA_ALIGN - 1);
+  if (!len)
+    len = ARENA_ALIGN;
+  if (!a->block || a->block->size - a->used < len)
+    arena_newblock(a, len);
+  r = ARENABLOCK_DATA(a->block) + a->used;
+  a->used += len;
+  if (a->block->offset + a->used > a->maxused)
+    a->maxused = a->block->offset + a->used;
+  return r;
+}
+
+void *
+arena_calloc(Arena *a, size_t num, size_t len)
+{
+  void *r;
+  if (len && (num * len) / len != num)
+    solv_oom(num, len);
+  r = arena_alloc(a, num * len);
+  memset(r, 0, num * len);
+  return r;
+}
+
+/* give back everything that was allocated after the mark was taken */
+void
+arena_release(Arena *a, Arenamark mark)
+{
+  struct s_Arenablock *b;
+  while ((b = a->block) != mark.block)
+    {
+      a->block = b->prev;
+      b->prev = a->spare;
+      a->spare = b;
+    }
+  a->used = mark.block ? mark.used : 0;
+}
+
+void
+arena_reset(Arena *a)
+{
+  Arenamark mark;
+  mark.block = 0;
+  mark.used = 0;
+  arena_release(a, mark);
+}
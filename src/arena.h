@@ -0,0 +1,79 @@
+/*
+ * Copyright (c) 2025, SUSE LLC
+ *
+ * This program is licensed under the BSD license, read LICENSE.BSD
+ * for further information
+ */
+
+/*
+ * arena.h
+ *
+ * simple bump allocator for short lived data
+ */
+
+#ifndef LIBSOLV_ARENA_H
+#define LIBSOLV_ARENA_H
+
+#include <stddef.h>
+
+#include "pooltypes.h"
+#include "queue.h"
+#include "bitmap.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+struct s_Arenablock;
+
+typedef struct s_Arena {
+  struct s_Arenablock *block;	/* current block, links to the older blocks */
+  struct s_Arenablock *spare;	/* released blocks kept for reuse */
+  size_t used;			/* bytes used in the current block */
+  size_t maxused;		/* statistic: high water mark */
+} Arena;
+
+/* an allocation position, see arena_release() */
+typedef struct s_Arenamark {
+  struct s_Arenablock *block;
+  size_t used;
+} Arenamark;
+
+extern void arena_init(Arena *a);
+extern void arena_free(Arena *a);
+extern void *arena_alloc(Arena *a, size_t len);
+extern void *arena_calloc(Arena *a, size_t num, size_t len);
+extern void arena_release(Arena *a, Arenamark mark);
+extern void arena_reset(Arena *a);
+
+static inline Arenamark
+arena_mark(Arena *a)
+{
+  Arenamark mark;
+  mark.block = a->block;
+  mark.used = a->used;
+  return mark;
+}
+
+/* queue with arena backing store. It switches to heap memory if
+ * it needs more than size elements. queue_free() must still be
+ * called. */
+static inline void
+arena_queue_init(Arena *a, Queue *q, int size)
+{
+  queue_init_buffer(q, (Id *)arena_alloc(a, (size ? size : 1) * sizeof(Id)), size);
+}
+
+/* map with arena backing store, must not be freed with map_free() */
+static inline void
+arena_map_init(Arena *a, Map *m, int n)
+{
+  m->size = (n + 7) >> 3;
+  m->map = (unsigned char *)arena_calloc(a, m->size, 1);
+}
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* LIBSOLV_ARENA_H */
@@ -59,52 +59,267 @@ map_grow(Map *m, int n)
     }
 }
 
+/*
+ * the map operations work on whole words. On x86 the SSE2/AVX2
+ * versions are used if the cpu supports them.
+ */
+
+#if defined(__GNUC__) && (defined(__x86_64__) || defined(__i386__)) && (__GNUC__ >= 5 || defined(__clang__))
+#define MAP_X86_SIMD
+#include <immintrin.h>
+#endif
+
+#define MAPOP_AND	0
+#define MAPOP_OR	1
+#define MAPOP_ANDNOT	2
+#define MAPOP_INVERT	3
+
+typedef unsigned long long mapword_t;
+
+static inline void
+mapop_words(unsigned char *t, const unsigned char *s, size_t n, int op)
+{
+  size_t i = 0;
+  mapword_t a, b = 0;
+
+  for (; i + sizeof(mapword_t) <= n; i += sizeof(mapword_t))
+    {
+      memcpy(&a, t + i, sizeof(a));
+      if (op != MAPOP_INVERT)
+        memcpy(&b, s + i, sizeof(b));
+      if (op == MAPOP_AND)
+	a &= b;
+      else if (op == MAPOP_OR)
+	a |= b;
+      else if (op == MAPOP_ANDNOT)
+	a &= ~b;
+      else
+	a = ~a;
+      memcpy(t + i, &a, sizeof(a));
+    }
+  for (; i < n; i++)
+    {
+      if (op == MAPOP_AND)
+	t[i] &= s[i];
+      else if (op == MAPOP_OR)
+	t[i] |= s[i];
+      else if (op == MAPOP_ANDNOT)
+	t[i] &= ~s[i];
+      else
+	t[i] ^= 0xff;
+    }
+}
+
+#ifdef MAP_X86_SIMD
+
+#ifdef __SSE2__
+static inline void
+mapop_sse2(unsigned char *t, const unsigned char *s, size_t n, int op)
+{
+  size_t i = 0;
+  __m128i a, b = _mm_set1_epi32(-1);
+
+  for (; i + 16 <= n; i += 16)
+    {
+      a = _mm_loadu_si128((const __m128i *)(t + i));
+      if (op != MAPOP_INVERT)
+	b = _mm_loadu_si128((const __m128i *)(s + i));
+      if (op == MAPOP_AND)
+	a = _mm_and_si128(a, b);
+      else if (op == MAPOP_OR)
+	a = _mm_or_si128(a, b);
+      else if (op == MAPOP_ANDNOT)
+	a = _mm_andnot_si128(b, a);
+      else
+	a = _mm_xor_si128(a, b);
+      _mm_storeu_si128((__m128i *)(t + i), a);
+    }
+  mapop_words(t + i, op == MAPOP_INVERT ? s : s + i, n - i, op);
+}
+#endif
+
+__attribute__((target("avx2"))) static void
+mapop_avx2(unsigned char *t, const unsigned char *s, size_t n, int op)
+{
+  size_t i = 0;
+  __m256i a, b = _mm256_set1_epi32(-1);
+
+  for (; i + 32 <= n; i += 32)
+    {
+      a = _mm256_loadu_si256((const __m256i *)(t + i));
+      if (op != MAPOP_INVERT)
+	b = _mm256_loadu_si256((const __m256i *)(s + i));
+      if (op == MAPOP_AND)
+	a = _mm256_and_si256(a, b);
+      else if (op == MAPOP_OR)
+	a = _mm256_or_si256(a, b);
+      else if (op == MAPOP_ANDNOT)
+	a = _mm256_andnot_si256(b, a);
+      else
+	a = _mm256_xor_si256(a, b);
+      _mm256_storeu_si256((__m256i *)(t + i), a);
+    }
+  mapop_words(t + i, op == MAPOP_INVERT ? s : s + i, n - i, op);
+}
+
+#endif
+
+/* do the operation on the first n bytes. s is not used for MAPOP_INVERT */
+static void
+mapop(unsigned char *t, const unsigned char *s, size_t n, int op)
+{
+#ifdef MAP_X86_SIMD
+  if (n >= 64 && __builtin_cpu_supports("avx2"))
+    {
+      mapop_avx2(t, s, n, op);
+      return;
+    }
+#ifdef __SSE2__
+  mapop_sse2(t, s, n, op);
+  return;
+#endif
+#endif
+  mapop_words(t, s, n, op);
+}
+
 /* bitwise-ands maps t and s, stores the result in t. */
 void
 map_and(Map *t, const Map *s)
 {
-  unsigned char *ti, *si, *end;
-  ti = t->map;
-  si = s->map;
-  end = ti + (t->size < s->size ? t->size : s->size);
-  while (ti < end)
-    *ti++ &= *si++;
+  mapop(t->map, s->map, t->size < s->size ? t->size : s->size, MAPOP_AND);
 }
 
 /* bitwise-ors maps t and s, stores the result in t. */
 void
 map_or(Map *t, const Map *s)
 {
-  unsigned char *ti, *si, *end;
   if (t->size < s->size)
     map_grow(t, s->size << 3);
-  ti = t->map;
-  si = s->map;
-  end = ti + (t->size < s->size ? t->size : s->size);
-  while (ti < end)
-    *ti++ |= *si++;
+  mapop(t->map, s->map, t->size < s->size ? t->size : s->size, MAPOP_OR);
 }
 
 /* remove all set bits in s from t. */
 void
 map_subtract(Map *t, const Map *s)
 {
-  unsigned char *ti, *si, *end;
-  ti = t->map;
-  si = s->map;
-  end = ti + (t->size < s->size ? t->size : s->size);
-  while (ti < end)
-    *ti++ &= ~*si++;
+  mapop(t->map, s->map, t->size < s->size ? t->size : s->size, MAPOP_ANDNOT);
 }
 
 void
 map_invertall(Map *m)
 {
-  unsigned char *ti, *end;
-  ti = m->map;
-  end = ti + m->size;
-  while (ti < end)
-    *ti++ ^= 0xff;
+  mapop(m->map, 0, m->size, MAPOP_INVERT);
+}
+
+/* t = a & ~b. t may be the same map as a, but not as b. */
+void
+map_and_not_into(Map *t, const Map *a, const Map *b)
+{
+  if (t != a)
+    {
+      if (t->size != a->size)
+	{
+	  t->map = solv_realloc(t->map, a->size);
+	  t->size = a->size;
+	}
+      if (a->size)
+        memcpy(t->map, a->map, a->size);
+    }
+  mapop(t->map, b->map, t->size < b->size ? t->size : b->size, MAPOP_ANDNOT);
+}
+
+#if defined(__GNUC__)
+
+static inline int
+popcount_words(const unsigned char *m, size_t n)
+{
+  size_t i = 0;
+  mapword_t w;
+  int cnt = 0;
+  for (; i + sizeof(mapword_t) <= n; i += sizeof(mapword_t))
+    {
+      memcpy(&w, m + i, sizeof(w));
+      cnt += __builtin_popcountll(w);
+    }
+  for (; i < n; i++)
+    cnt += __builtin_popcount(m[i]);
+  return cnt;
+}
+
+#ifdef MAP_X86_SIMD
+__attribute__((target("popcnt"))) static int
+popcount_popcnt(const unsigned char *m, size_t n)
+{
+  return popcount_words(m, n);
+}
+#endif
+
+#else
+
+static int
+popcount_words(const unsigned char *m, size_t n)
+{
+  size_t i;
+  int cnt = 0;
+  for (i = 0; i < n; i++)
+    {
+      unsigned char c = m[i];
+      for (; c; c &= c - 1)
+	cnt++;
+    }
+  return cnt;
+}
+
+#endif
+
+/* return the number of set bits */
+int
+map_popcount(const Map *m)
+{
+#ifdef MAP_X86_SIMD
+  if (__builtin_cpu_supports("popcnt"))
+    return popcount_popcnt(m->map, m->size);
+#endif
+  return popcount_words(m->map, m->size);
+}
+
+/* return the first set bit that is >= n, or -1 if there is none */
+int
+map_next(const Map *m, int n)
+{
+  const unsigned char *p, *end;
+  mapword_t w;
+  unsigned char c;
+
+  if (n < 0)
+    n = 0;
+  if ((n >> 3) >= m->size)
+    return -1;
+  p = m->map + (n >> 3);
+  end = m->map + m->size;
+  /* rest of the first byte */
+  c = *p & (0xff << (n & 7));
+  if (c)
+    goto found;
+  /* skip zero words */
+  for (p++; p + sizeof(mapword_t) <= end; p += sizeof(mapword_t))
+    {
+      memcpy(&w, p, sizeof(w));
+      if (w)
+	break;
+    }
+  for (; p < end; p++)
+    if ((c = *p) != 0)
+      goto found;
+  return -1;
+found:
+#if defined(__GNUC__)
+  return (int)(p - m->map) * 8 + __builtin_ctz(c);
+#else
+  for (n = 0; !(c & (1 << n)); n++)
+    ;
+  return (int)(p - m->map) * 8 + n;
+#endif
 }
 
 /* EOF */
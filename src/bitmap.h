@@ -44,6 +44,9 @@ extern void map_and(Map *t, const Map *s);
 extern void map_or(Map *t, const Map *s);
 extern void map_subtract(Map *t, const Map *s);
 extern void map_invertall(Map *m);
+extern void map_and_not_into(Map *t, const Map *a, const Map *b);
+extern int map_popcount(const Map *m);
+extern int map_next(const Map *m, int n);
 
 static inline void map_empty(Map *m)
 {
@@ -932,10 +932,8 @@ solver_createcleandepsmap(Solver *solv, Map *cleandepsmap, int unneeded)
 	  if (unneeded)
 	    break;
 	  /* supplements pass */
-	  for (ip = installed->start; ip < installed->end; ip++)
+	  for (ip = map_next(&installedm, installed->start); ip >= 0 && ip < installed->end; ip = map_next(&installedm, ip + 1))
 	    {
-	      if (!MAPTST(&installedm, ip))
-		continue;
 	      s = pool->solvables + ip;
 	      if (!s->supplements)
 		continue;
@@ -1094,10 +1092,8 @@ solver_createcleandepsmap(Solver *solv, Map *cleandepsmap, int unneeded)
       if (!iq.count)
 	{
 	  /* supplements pass */
-	  for (ip = installed->start; ip < installed->end; ip++)
+	  for (ip = map_next(&installedm, installed->start); ip >= 0 && ip < installed->end; ip = map_next(&installedm, ip + 1))
 	    {
-	      if (!MAPTST(&installedm, ip))
-		continue;
 	      if (MAPTST(&userinstalled, ip - installed->start))
 	        continue;
 	      s = pool->solvables + ip;
@@ -1363,7 +1359,7 @@ solver_check_cleandeps_mistakes(Solver *solv)
 	{
 	  /* feature rule is not true, thus we cleandeps erased the package */
 	  /* check if the package is recommended/supplemented. if yes, we made a mistake. */
-	  if (!MAPTST(&solv->recommendsmap, i) && !solver_is_supplementing(solv, pool->solvables + i))
+	  if (!SPARSEMAPTST(&solv->recommendsmap, i) && !solver_is_supplementing(solv, pool->solvables + i))
 	    continue;	/* feature rule is not true */
 	  POOL_DEBUG(SOLV_DEBUG_SOLVER, "cleandeps recommends mistake: ");
 	  solver_printruleclass(solv, SOLV_DEBUG_SOLVER, fr);
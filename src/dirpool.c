@@ -96,10 +96,41 @@ dirpool_make_dirtraverse(Dirpool *dp)
   dp->dirtraverse = dirtraverse;
 }
 
+/* append a new directory entry, the caller must make sure that
+ * there is no entry for (parent, comp) yet */
+Id
+dirpool_new_dir(Dirpool *dp, Id parent, Id comp)
+{
+  Id did;
+
+  if (!dp->dirtraverse)
+    dirpool_make_dirtraverse(dp);
+  /* find last parent */
+  for (did = dp->ndirs - 1; did > 0; did--)
+    if (dp->dirs[did] <= 0)
+      break;
+  if (dp->dirs[did] != -parent)
+    {
+      /* make room for parent entry */
+      dp->dirs = solv_extend(dp->dirs, dp->ndirs, 1, sizeof(Id), DIR_BLOCK);
+      dp->dirtraverse = solv_extend(dp->dirtraverse, dp->ndirs, 1, sizeof(Id), DIR_BLOCK);
+      /* new parent block, link in */
+      dp->dirs[dp->ndirs] = -parent;
+      dp->dirtraverse[dp->ndirs] = dp->dirtraverse[parent];
+      dp->dirtraverse[parent] = ++dp->ndirs;
+    }
+  /* make room for new entry */
+  dp->dirs = solv_extend(dp->dirs, dp->ndirs, 1, sizeof(Id), DIR_BLOCK);
+  dp->dirtraverse = solv_extend(dp->dirtraverse, dp->ndirs, 1, sizeof(Id), DIR_BLOCK);
+  dp->dirs[dp->ndirs] = comp;
+  dp->dirtraverse[dp->ndirs] = 0;
+  return dp->ndirs++;
+}
+
 Id
 dirpool_add_dir(Dirpool *dp, Id parent, Id comp, int create)
 {
-  Id did, d, ds;
+  Id d, ds;
 
   if (!dp->ndirs)
     {
@@ -135,24 +166,5 @@ dirpool_add_dir(Dirpool *dp, Id parent, Id comp, int create)
     }
   if (!create)
     return 0;
-  /* a new one, find last parent */
-  for (did = dp->ndirs - 1; did > 0; did--)
-    if (dp->dirs[did] <= 0)
-      break;
-  if (dp->dirs[did] != -parent)
-    {
-      /* make room for parent entry */
-      dp->dirs = solv_extend(dp->dirs, dp->ndirs, 1, sizeof(Id), DIR_BLOCK);
-      dp->dirtraverse = solv_extend(dp->dirtraverse, dp->ndirs, 1, sizeof(Id), DIR_BLOCK);
-      /* new parent block, link in */
-      dp->dirs[dp->ndirs] = -parent;
-      dp->dirtraverse[dp->ndirs] = dp->dirtraverse[parent];
-      dp->dirtraverse[parent] = ++dp->ndirs;
-    }
-  /* make room for new entry */
-  dp->dirs = solv_extend(dp->dirs, dp->ndirs, 1, sizeof(Id), DIR_BLOCK);
-  dp->dirtraverse = solv_extend(dp->dirtraverse, dp->ndirs, 1, sizeof(Id), DIR_BLOCK);
-  dp->dirs[dp->ndirs] = comp;
-  dp->dirtraverse[dp->ndirs] = 0;
-  return dp->ndirs++;
+  return dirpool_new_dir(dp, parent, comp);
 }
@@ -26,6 +26,9 @@ void dirpool_free(Dirpool *dp);
 
 void dirpool_make_dirtraverse(Dirpool *dp);
 Id dirpool_add_dir(Dirpool *dp, Id parent, Id comp, int create);
+#ifdef LIBSOLV_INTERNAL
+Id dirpool_new_dir(Dirpool *dp, Id parent, Id comp);
+#endif
 
 /* return the parent directory of child did */
 static inline Id dirpool_parent(Dirpool *dp, Id did)
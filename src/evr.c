@@ -16,6 +16,9 @@
 #include <string.h>
 #include "evr.h"
 #include "pool.h"
+#include "repo.h"
+#include "util.h"
+#include "bitmap.h"
 
 #ifdef ENABLE_CONDA
 #include "conda.h"
@@ -481,6 +484,13 @@ pool_evrcmp(const Pool *pool, Id evr1id, Id evr2id, int mode)
   const char *evr1, *evr2;
   if (evr1id == evr2id)
     return 0;
+  if ((unsigned int)evr1id < pool->evrcachen && (unsigned int)evr2id < pool->evrcachen && mode <= EVRCMP_MATCH_RELEASE)
+    {
+      unsigned int r1 = pool->evrcache[evr1id], r2 = pool->evrcache[evr2id];
+      /* match_release is the same as compare if both have a release */
+      if (r1 && r2 && (mode == EVRCMP_COMPARE || (r1 & r2 & 1) != 0))
+	return (r1 >> 1) == (r2 >> 1) ? 0 : (r1 >> 1) < (r2 >> 1) ? -1 : 1;
+    }
   evr1 = pool_id2str(pool, evr1id);
   evr2 = pool_id2str(pool, evr2id);
   return pool_evrcmp_str(pool, evr1, evr2, mode);
@@ -543,3 +553,97 @@ pool_evrmatch(const Pool *pool, Id evrid, const char *epoch, const char *version
   return 0;
 }
 
+/*
+ * evr cache
+ *
+ * assign a rank to all evrs used by solvables and dependencies,
+ * so that pool_evrcmp() can compare them without parsing the
+ * strings. The lowest bit is set if the evr has a release.
+ */
+
+static int
+evrcache_sortcmp(const void *ap, const void *bp, void *dp)
+{
+  const Pool *pool = dp;
+  Id a = *(const Id *)ap, b = *(const Id *)bp;
+  int r = pool_evrcmp_str(pool, pool_id2str(pool, a), pool_id2str(pool, b), EVRCMP_COMPARE);
+  return r ? r : a - b;
+}
+
+/* returns -1 for evrs we do not rank, otherwise if the evr has a release */
+static int
+evrcache_classify(const Pool *pool, const char *evr)
+{
+  const char *s, *rel = 0;
+  for (s = evr; *s >= '0' && *s <= '9'; s++)
+    ;
+  if (s != evr && *s == ':')
+    evr = s + 1;
+  if (!*evr || *evr == '-')
+    return -1;		/* empty version */
+  for (s = evr; *s; s++)
+    {
+      if (*s == '-')
+	{
+	  if (rel)
+	    return -1;	/* multiple dashes */
+	  rel = s;
+	}
+      else if (*s == ':' && (!rel || !pool->havedistepoch))
+	return -1;
+    }
+  return rel && rel[1] ? 1 : 0;
+}
+
+void
+pool_createevrcache(Pool *pool)
+{
+  int nstrings = pool->ss.nstrings;
+  Solvable *s;
+  Reldep *rd;
+  Id p, *ids;
+  Map m;
+  int i, n, rank;
+
+  if (pool->evrcache && pool->evrcachen == (Offset)nstrings)
+    return;		/* still up to date */
+  pool_freeevrcache(pool);
+  if (pool->disttype != DISTTYPE_RPM && pool->disttype != DISTTYPE_DEB && pool->disttype != DISTTYPE_ARCH)
+    return;		/* no plain evr ordering */
+  if (pool->promoteepoch)
+    return;		/* epoch promotion is not symmetric */
+  map_init(&m, nstrings);
+  FOR_POOL_SOLVABLES(p)
+    {
+      s = pool->solvables + p;
+      if (!ISRELDEP(s->evr) && s->evr > 1)
+	MAPSET(&m, s->evr);
+    }
+  for (i = 1, rd = pool->rels + i; i < pool->nrels; i++, rd++)
+    if (rd->flags > 0 && rd->flags < 8 && !ISRELDEP(rd->evr) && rd->evr > 1)
+      MAPSET(&m, rd->evr);
+  ids = solv_malloc2(nstrings, sizeof(Id));
+  for (i = 2, n = 0; i < nstrings; i++)
+    if (MAPTST(&m, i) && evrcache_classify(pool, pool_id2str(pool, i)) >= 0)
+      ids[n++] = i;
+  map_free(&m);
+  solv_sort(ids, n, sizeof(Id), evrcache_sortcmp, pool);
+  pool->evrcache = solv_calloc(nstrings, sizeof(unsigned int));
+  for (i = 0, rank = 0; i < n; i++)
+    {
+      const char *evr = pool_id2str(pool, ids[i]);
+      if (!i || pool_evrcmp_str(pool, pool_id2str(pool, ids[i - 1]), evr, EVRCMP_COMPARE) != 0)
+	rank++;
+      pool->evrcache[ids[i]] = rank << 1 | evrcache_classify(pool, evr);
+    }
+  solv_free(ids);
+  pool->evrcachen = nstrings;
+  POOL_DEBUG(SOLV_DEBUG_STATS, "evr cache: %d evrs, %d ranks\n", n, rank);
+}
+
+void
+pool_freeevrcache(Pool *pool)
+{
+  pool->evrcache = solv_free(pool->evrcache);
+  pool->evrcachen = 0;
+}
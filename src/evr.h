@@ -30,6 +30,9 @@ extern int pool_evrcmp_str(const Pool *pool, const char *evr1, const char *evr2,
 extern int pool_evrcmp(const Pool *pool, Id evr1id, Id evr2id, int mode);
 extern int pool_evrmatch(const Pool *pool, Id evrid, const char *epoch, const char *version, const char *release);
 
+extern void pool_createevrcache(Pool *pool);
+extern void pool_freeevrcache(Pool *pool);
+
 #ifdef __cplusplus
 }
 #endif
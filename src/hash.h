@@ -13,6 +13,7 @@
 #ifndef LIBSOLV_HASH_H
 #define LIBSOLV_HASH_H
 
+#include <string.h>
 #include "pooltypes.h"
 
 #ifdef __cplusplus
@@ -62,6 +63,81 @@ strhash_cont(const char *str, Hashval r)
 }
 
 
+/* stronger hash for strings of known length, works on 8 bytes
+ * at a time and is based on the 64x64->128 bit multiply-and-fold
+ * of the wyhash family. Only used for hashes that are kept in memory,
+ * the result may differ between architectures.
+ */
+#define MEMHASH_P0 0xa0761d6478bd642fULL
+#define MEMHASH_P1 0xe7037ed1a0b428dbULL
+
+static inline unsigned long long
+memhash_mum(unsigned long long a, unsigned long long b)
+{
+#ifdef __SIZEOF_INT128__
+  __uint128_t r = (__uint128_t)a * b;
+  return (unsigned long long)r ^ (unsigned long long)(r >> 64);
+#else
+  unsigned long long ha = a >> 32, hb = b >> 32, la = (unsigned int)a, lb = (unsigned int)b;
+  unsigned long long rh = ha * hb, rm0 = ha * lb, rm1 = hb * la, rl = la * lb, t = rl + (rm0 << 32), c = t < rl;
+  unsigned long long lo = t + (rm1 << 32);
+  c += lo < t;
+  return lo ^ (rh + (rm0 >> 32) + (rm1 >> 32) + c);
+#endif
+}
+
+static inline unsigned long long
+memhash_r64(const unsigned char *p)
+{
+  unsigned long long v;
+  memcpy(&v, p, 8);
+  return v;
+}
+
+static inline unsigned long long
+memhash_r32(const unsigned char *p)
+{
+  unsigned int v;
+  memcpy(&v, p, 4);
+  return v;
+}
+
+static inline Hashval
+memhash(const char *str, unsigned int len)
+{
+  const unsigned char *p = (const unsigned char *)str;
+  unsigned long long seed = MEMHASH_P0 ^ len, a, b;
+  unsigned int i = len;
+
+  if (len <= 16)
+    {
+      if (len >= 4)
+	{
+	  unsigned int o = (len >> 3) << 2;
+	  a = memhash_r32(p) << 32 | memhash_r32(p + o);
+	  b = memhash_r32(p + len - 4) << 32 | memhash_r32(p + len - 4 - o);
+	}
+      else if (len)
+	{
+	  a = (unsigned long long)p[0] << 16 | (unsigned long long)p[len >> 1] << 8 | p[len - 1];
+	  b = 0;
+	}
+      else
+	a = b = 0;
+    }
+  else
+    {
+      for (; i > 16; i -= 16, p += 16)
+	seed = memhash_mum(memhash_r64(p) ^ MEMHASH_P1, memhash_r64(p + 8) ^ seed);
+      a = memhash_r64(p + i - 16);
+      b = memhash_r64(p + i - 8);
+    }
+  a = memhash_mum(a ^ MEMHASH_P1, b ^ seed);
+  a = memhash_mum(a ^ MEMHASH_P0, len ^ MEMHASH_P1);
+  return (Hashval)(a ^ a >> 32);
+}
+
+
 /* hash for rel
  * rel -> hash
  */
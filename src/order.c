@@ -19,6 +19,7 @@
 
 #include "transaction.h"
 #include "bitmap.h"
+#include "arena.h"
 #include "pool.h"
 #include "repo.h"
 #include "util.h"
@@ -115,6 +116,8 @@ struct orderdata {
   Queue cyclesdata;
   int ncycles;
   Queue edgedataq;
+
+  Arena arena;			/* scratch memory, freed after ordering */
 };
 
 static void
@@ -271,13 +274,14 @@ addsolvableedges(struct orderdata *od, Solvable *s)
   Solvable *s2;
   Queue depq, ignoreinst;
   int provbyinst;
+  Arenamark mark = arena_mark(&od->arena);
 
 #if 0
   printf("addsolvableedges %s\n", pool_solvable2str(pool, s));
 #endif
   p = s - pool->solvables;
-  queue_init(&depq);
-  queue_init(&ignoreinst);
+  arena_queue_init(&od->arena, &depq, 32);
+  arena_queue_init(&od->arena, &ignoreinst, 32);
   if (s->requires)
     {
       Id req, *reqp;
@@ -582,6 +586,7 @@ addsolvableedges(struct orderdata *od, Solvable *s)
     }
   queue_free(&ignoreinst);
   queue_free(&depq);
+  arena_release(&od->arena, mark);
 }
 
 static inline int
@@ -918,6 +923,7 @@ transaction_order(Transaction *trans, int flags)
   od.trans = trans;
   od.ntes = numte;
   od.tes = solv_calloc(numte, sizeof(*od.tes));
+  arena_init(&od.arena);
   od.edgedata = solv_extend(0, 0, 1, sizeof(Id), EDGEDATA_BLOCK);
   od.edgedata[0] = 0;
   od.nedgedata = 1;
@@ -954,7 +960,7 @@ transaction_order(Transaction *trans, int flags)
 
   now = solv_timems(0);
   /* kill all cycles */
-  queue_init(&todo);
+  arena_queue_init(&od.arena, &todo, numte);
   for (i = numte - 1; i > 0; i--)
     queue_push(&todo, i);
 
@@ -1037,7 +1043,7 @@ transaction_order(Transaction *trans, int flags)
   if (od.cycles.count)
     {
       now = solv_timems(0);
-      incycle = solv_calloc(numte, 1);
+      incycle = arena_calloc(&od.arena, numte, 1);
       /* now go through all broken cycles and create cycle edges to help
 	 the ordering */
       for (i = od.cycles.count - 4; i >= 0; i -= 4)
@@ -1113,8 +1119,8 @@ transaction_order(Transaction *trans, int flags)
     for (j = te->edges; od.invedgedata[j]; j++)
       od.tes[od.invedgedata[j]].mark++;
 
-  queue_init(&samerepoq);
-  queue_init(&uninstq);
+  arena_queue_init(&od.arena, &samerepoq, numte);
+  arena_queue_init(&od.arena, &uninstq, numte);
   queue_empty(&todo);
   for (i = 1, te = od.tes + i; i < numte; i++, te++)
     if (te->mark == 0)
@@ -1133,7 +1139,7 @@ transaction_order(Transaction *trans, int flags)
   lastrepo = 0;
   lastmedia = 0;
   lastte = 0;
-  temedianr = solv_calloc(numte, sizeof(Id));
+  temedianr = arena_calloc(&od.arena, numte, sizeof(Id));
   for (i = 1; i < numte; i++)
     {
       Solvable *s = pool->solvables + od.tes[i].p;
@@ -1222,12 +1228,11 @@ printf("free %s [%d]\n", pool_solvid2str(pool, te2->p), temedianr[od.invedgedata
 	    }
 	}
     }
-  solv_free(temedianr);
-  solv_free(incycle);
   queue_free(&todo);
   queue_free(&samerepoq);
   queue_free(&uninstq);
   queue_free(&obsq);
+  arena_free(&od.arena);
   for (i = 1, te = od.tes + i; i < numte; i++, te++)
     assert(te->mark == 0);
 
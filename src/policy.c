@@ -228,7 +228,7 @@ solver_prune_to_highest_prio_per_name(Solver *solv, Queue *plist)
 #define CPLXDEPHASH_TST(elements, p) (elements[(p) & 255] && (elements[(p) & 255] & (1 << ((p) >> 8 & 31))))
 
 static void
-check_complex_dep(Solver *solv, Id dep, Map *m, Queue **cqp)
+check_complex_dep(Solver *solv, Id dep, Sparsemap *m, Queue **cqp)
 {
   Pool *pool = solv->pool;
   Queue q;
@@ -273,7 +273,7 @@ check_complex_dep(Solver *solv, Id dep, Map *m, Queue **cqp)
 	{
 	  /* all negative literals installed, add positive literals to map */
 	  for (; (p = q.elements[i]) != 0; i++)
-	    MAPSET(m, p);
+	    SPARSEMAPSET(m, p);
 	}
       else
 	{
@@ -315,7 +315,7 @@ check_complex_dep(Solver *solv, Id dep, Map *m, Queue **cqp)
 }
 
 static void
-recheck_complex_deps(Solver *solv, Id p, Map *m, Queue **cqp)
+recheck_complex_deps(Solver *solv, Id p, Sparsemap *m, Queue **cqp)
 {
   Queue *cq = *cqp;
   Id pp;
@@ -358,8 +358,8 @@ policy_update_recommendsmap(Solver *solv)
 
   if (solv->recommends_index < 0)
     {
-      MAPZERO(&solv->recommendsmap);
-      MAPZERO(&solv->suggestsmap);
+      sparsemap_empty(&solv->recommendsmap);
+      sparsemap_empty(&solv->suggestsmap);
 #ifdef ENABLE_COMPLEX_DEPS
       if (solv->recommendscplxq)
 	{
@@ -400,7 +400,7 @@ policy_update_recommendsmap(Solver *solv)
 		}
 #endif
 	      FOR_PROVIDES(p, pp, rec)
-	        MAPSET(&solv->recommendsmap, p);
+	        SPARSEMAPSET(&solv->recommendsmap, p);
 	    }
 	}
       if (s->suggests)
@@ -416,7 +416,7 @@ policy_update_recommendsmap(Solver *solv)
 		}
 #endif
 	      FOR_PROVIDES(p, pp, sug)
-	        MAPSET(&solv->suggestsmap, p);
+	        SPARSEMAPSET(&solv->suggestsmap, p);
 	    }
 	}
     }
@@ -439,7 +439,7 @@ prefer_suggested(Solver *solv, Queue *plist)
       Id p = plist->elements[i];
       Solvable *s = pool->solvables + p;
       if ((pool->installed && s->repo == pool->installed) ||
-          MAPTST(&solv->suggestsmap, p) ||
+          SPARSEMAPTST(&solv->suggestsmap, p) ||
           solver_is_enhancing(solv, s))
 	continue;	/* good package */
       /* bring to back */
@@ -511,7 +511,7 @@ prune_to_recommended(Solver *solv, Queue *plist)
 	    plist->elements[j++] = p;
 	  continue;
 	}
-      if (!MAPTST(&solv->recommendsmap, p))
+      if (!SPARSEMAPTST(&solv->recommendsmap, p))
 	if (!solver_is_supplementing(solv, s))
 	  continue;
       if (!j && ninst)
@@ -546,7 +546,7 @@ prune_to_recommended(Solver *solv, Queue *plist)
 	    plist->elements[j++] = p;
 	  continue;
 	}
-      if (!MAPTST(&solv->suggestsmap, p))
+      if (!SPARSEMAPTST(&solv->suggestsmap, p))
         if (!solver_is_enhancing(solv, s))
 	  continue;
       if (!j && ninst)
@@ -17,15 +17,20 @@
 #include <stdarg.h>
 #include <unistd.h>
 #include <string.h>
+#ifdef ENABLE_PTHREADS
+#include <pthread.h>
+#endif
 
 #include "pool.h"
 #include "poolvendor.h"
 #include "repo.h"
 #include "poolid.h"
+#include "pool_private.h"
 #include "poolarch.h"
 #include "util.h"
 #include "bitmap.h"
 #include "evr.h"
+#include "repopage.h"
 
 #define SOLVABLE_BLOCK	255
 
@@ -54,6 +59,7 @@ pool_create(void)
   queue_init(&pool->vendormap);
   queue_init(&pool->pooljobs);
   queue_init(&pool->lazywhatprovidesq);
+  pool->pagecache = solv_calloc(1, sizeof(Repopagecache));
 
 #if defined(DEBIAN)
   pool->disttype = DISTTYPE_DEB;
@@ -97,13 +103,17 @@ pool_free(Pool *pool)
 {
   int i;
 
+  pool_end_concurrent(pool);
+  pool_unfreeze(pool);
   pool_freewhatprovides(pool);
   pool_freeidhashes(pool);
+  pool_freeevrcache(pool);
   pool_freeallrepos(pool, 1);
   solv_free(pool->id2arch);
   solv_free(pool->id2color);
   solv_free(pool->solvables);
   stringpool_free(&pool->ss);
+  solv_free(pool->sshashes);
   solv_free(pool->rels);
   pool_setvendorclasses(pool, 0);
   queue_free(&pool->vendormap);
@@ -118,6 +128,7 @@ pool_free(Pool *pool)
   solv_free(pool->errstr);
   solv_free(pool->rootdir);
   solv_free(pool->nonstd_ids);
+  solv_free(pool->pagecache);
   solv_free(pool);
 }
 
@@ -163,6 +174,7 @@ pool_setdisttype(Pool *pool, int disttype)
     }
   pool->disttype = disttype;
   pool->solvables[SYSTEMSOLVABLE].arch = pool->noarchid;
+  pool_freeevrcache(pool);
   return olddisttype;
 #else
   return pool->disttype == disttype ? disttype : -1;
@@ -198,6 +210,10 @@ pool_get_flag(Pool *pool, int flag)
       return pool->nowhatprovidesaux;
     case POOL_FLAG_WHATPROVIDESWITHDISABLED:
       return pool->whatprovideswithdisabled;
+    case POOL_FLAG_WHATPROVIDESEVRINDEX:
+      return pool->whatprovidesevrindex;
+    case POOL_FLAG_STRINGHASHES:
+      return pool->sshashes ? 1 : 0;
     default:
       break;
     }
@@ -208,10 +224,13 @@ int
 pool_set_flag(Pool *pool, int flag, int value)
 {
   int old = pool_get_flag(pool, flag);
+  if (old != value)
+    pool->generation++;
   switch (flag)
     {
     case POOL_FLAG_PROMOTEEPOCH:
       pool->promoteepoch = value;
+      pool_freeevrcache(pool);
       break;
     case POOL_FLAG_FORBIDSELFCONFLICTS:
       pool->forbidselfconflicts = value;
@@ -233,6 +252,7 @@ pool_set_flag(Pool *pool, int flag, int value)
       break;
     case POOL_FLAG_HAVEDISTEPOCH:
       pool->havedistepoch = value;
+      pool_freeevrcache(pool);
       break;
     case POOL_FLAG_NOOBSOLETESMULTIVERSION:
       pool->noobsoletesmultiversion = value;
@@ -246,6 +266,20 @@ pool_set_flag(Pool *pool, int flag, int value)
     case POOL_FLAG_WHATPROVIDESWITHDISABLED:
       pool->whatprovideswithdisabled = value;
       break;
+    case POOL_FLAG_WHATPROVIDESEVRINDEX:
+      pool->whatprovidesevrindex = value;
+      if (!value)
+	{
+	  /* lookups use the index if it exists, so drop it */
+	  pool->whatprovidesevr = solv_free(pool->whatprovidesevr);
+	  pool->whatprovidesevrdata = solv_free(pool->whatprovidesevrdata);
+	  pool->whatprovidesevroff = 0;
+	  pool->whatprovidesevrdataoff = 0;
+	}
+      break;
+    case POOL_FLAG_STRINGHASHES:
+      stringpool_storehashes(&pool->ss, &pool->sshashes, value);
+      break;
     default:
       break;
     }
@@ -322,49 +356,354 @@ pool_debug(Pool *pool, int type, const char *format, ...)
   pool->debugcallback(pool, pool->debugcallbackdata, type, buf);
 }
 
+/*
+ * frozen pool support
+ *
+ * a frozen pool must not be modified, but it can be used by multiple
+ * threads at the same time. Each thread gets its own tmp space, error
+ * string and lookup position, providers that are not yet known are
+ * added with the frozen lock held.
+ */
+
+struct s_Pool_threadctx {
+  struct s_Pool_threadctx *next;
+  struct s_Pool_tmpspace tmpspace;
+  char *errstr;
+  int errstra;
+  Datapos pos;
+};
+
+struct s_Pool_frozen {
+#ifdef ENABLE_PTHREADS
+  pthread_mutex_t lock;
+  pthread_key_t ctxkey;
+#endif
+  struct s_Pool_threadctx *ctxs;	/* the contexts of all threads */
+  void **retired;			/* replaced data that may still be in use */
+  int nretired;
+};
+
+#ifdef ENABLE_PTHREADS
+static struct s_Pool_threadctx *
+pool_threadctx(Pool *pool)
+{
+  struct s_Pool_frozen *frozen = pool->frozen;
+  struct s_Pool_threadctx *ctx;
+
+  if ((ctx = pthread_getspecific(frozen->ctxkey)) != 0)
+    return ctx;
+  ctx = solv_calloc(1, sizeof(*ctx));
+  pthread_setspecific(frozen->ctxkey, ctx);
+  pthread_mutex_lock(&frozen->lock);
+  ctx->next = frozen->ctxs;
+  frozen->ctxs = ctx;
+  pthread_mutex_unlock(&frozen->lock);
+  return ctx;
+}
+#endif
+
+static inline struct s_Pool_tmpspace *
+pool_tmpspace(Pool *pool)
+{
+#ifdef ENABLE_PTHREADS
+  if (pool->frozen)
+    return &pool_threadctx(pool)->tmpspace;
+#endif
+  return &pool->tmpspace;
+}
+
 int
 pool_error(Pool *pool, int ret, const char *format, ...)
 {
   va_list args;
   int l;
+  char **errstrp;
+  int *errstrap;
 
   if (!pool)
     return ret;
+  errstrp = &pool->errstr;
+  errstrap = &pool->errstra;
+#ifdef ENABLE_PTHREADS
+  if (pool->frozen)
+    {
+      struct s_Pool_threadctx *ctx = pool_threadctx(pool);
+      errstrp = &ctx->errstr;
+      errstrap = &ctx->errstra;
+    }
+#endif
   va_start(args, format);
-  if (!pool->errstr)
+  if (!*errstrp)
     {
-      pool->errstra = 1024;
-      pool->errstr = solv_malloc(pool->errstra);
+      *errstrap = 1024;
+      *errstrp = solv_malloc(*errstrap);
     }
   if (!*format)
     {
-      *pool->errstr = 0;
+      **errstrp = 0;
       l = 0;
     }
   else
-    l = vsnprintf(pool->errstr, pool->errstra, format, args);
+    l = vsnprintf(*errstrp, *errstrap, format, args);
   va_end(args);
-  if (l >= 0 && l + 1 > pool->errstra)
+  if (l >= 0 && l + 1 > *errstrap)
     {
-      pool->errstra = l + 256;
-      pool->errstr = solv_realloc(pool->errstr, pool->errstra);
+      *errstrap = l + 256;
+      *errstrp = solv_realloc(*errstrp, *errstrap);
       va_start(args, format);
-      l = vsnprintf(pool->errstr, pool->errstra, format, args);
+      l = vsnprintf(*errstrp, *errstrap, format, args);
       va_end(args);
     }
   if (l < 0)
-    strcpy(pool->errstr, "unknown error");
+    strcpy(*errstrp, "unknown error");
   if (pool->debugmask & SOLV_ERROR)
-    pool_debug(pool, SOLV_ERROR, "%s\n", pool->errstr);
+    pool_debug(pool, SOLV_ERROR, "%s\n", *errstrp);
   return ret;
 }
 
 char *
 pool_errstr(Pool *pool)
 {
+#ifdef ENABLE_PTHREADS
+  if (pool->frozen)
+    {
+      struct s_Pool_threadctx *ctx = pool_threadctx(pool);
+      return ctx->errstr ? ctx->errstr : "no error";
+    }
+#endif
   return pool->errstr ? pool->errstr : "no error";
 }
 
+static void
+pool_freeze_pushdeps(Solvable *s, Offset deps, Queue *q)
+{
+  Id dep, *dp;
+
+  if (!deps)
+    return;
+  for (dp = s->repo->idarraydata + deps; (dep = *dp) != 0; dp++)
+    if (!ISRELDEP(dep))
+      queue_push(q, dep);
+}
+
+/*
+ * make the pool usable by multiple threads. Everything that would
+ * be created on demand is created now. The pool must not be changed
+ * until pool_unfreeze() is called, new ids cannot be created.
+ */
+void
+pool_freeze(Pool *pool)
+{
+  struct s_Pool_frozen *frozen;
+  Repo *repo;
+  Repodata *data;
+  Solvable *s;
+  Queue q;
+  int i, rdid;
+  Id p;
+#ifdef ENABLE_PTHREADS
+  pthread_mutexattr_t attr;
+#endif
+
+  if (pool->frozen)
+    return;
+  FOR_REPOS(i, repo)
+    {
+      repo_internalize(repo);
+      FOR_REPODATAS(repo, rdid, data)
+	repodata_load(data);
+      repo_disable_paging(repo);
+    }
+  if (!pool->whatprovides)
+    pool_createwhatprovides(pool);
+  pool_createidhashes(pool);
+  pool_createevrcache(pool);
+
+  /* look up the providers of all dependencies */
+  queue_init(&q);
+  FOR_POOL_SOLVABLES(p)
+    {
+      s = pool->solvables + p;
+      queue_push(&q, s->name);
+      pool_freeze_pushdeps(s, s->requires, &q);
+      pool_freeze_pushdeps(s, s->conflicts, &q);
+      pool_freeze_pushdeps(s, s->obsoletes, &q);
+      pool_freeze_pushdeps(s, s->recommends, &q);
+      pool_freeze_pushdeps(s, s->suggests, &q);
+      pool_freeze_pushdeps(s, s->supplements, &q);
+      pool_freeze_pushdeps(s, s->enhances, &q);
+    }
+  for (i = 1; i < pool->nrels; i++)
+    queue_push(&q, MAKERELDEP(i));
+  pool_addrelproviders_parallel(pool, &q, 0);
+  queue_free(&q);
+
+  /* the architecture colors are also computed on demand */
+  for (i = 0; i < pool->lastarch; i++)
+    pool_arch2color(pool, i);
+
+  frozen = solv_calloc(1, sizeof(*frozen));
+#ifdef ENABLE_PTHREADS
+  pthread_mutexattr_init(&attr);
+  pthread_mutexattr_settype(&attr, PTHREAD_MUTEX_RECURSIVE);
+  pthread_mutex_init(&frozen->lock, &attr);
+  pthread_mutexattr_destroy(&attr);
+  pthread_key_create(&frozen->ctxkey, 0);
+#endif
+  pool->frozen = frozen;
+  pool->pagecache->frozen = 1;
+}
+
+void
+pool_unfreeze(Pool *pool)
+{
+  struct s_Pool_frozen *frozen = pool->frozen;
+  struct s_Pool_threadctx *ctx;
+  int i;
+
+  if (!frozen)
+    return;
+  pool->frozen = 0;
+  pool->pagecache->frozen = 0;
+  while ((ctx = frozen->ctxs) != 0)
+    {
+      frozen->ctxs = ctx->next;
+      for (i = 0; i < POOL_TMPSPACEBUF; i++)
+	solv_free(ctx->tmpspace.buf[i]);
+      solv_free(ctx->errstr);
+      solv_free(ctx);
+    }
+  for (i = 0; i < frozen->nretired; i++)
+    solv_free(frozen->retired[i]);
+  solv_free(frozen->retired);
+#ifdef ENABLE_PTHREADS
+  pthread_key_delete(frozen->ctxkey);
+  pthread_mutex_destroy(&frozen->lock);
+#endif
+  solv_free(frozen);
+}
+
+void
+pool_frozen_lock(Pool *pool)
+{
+#ifdef ENABLE_PTHREADS
+  if (pool->frozen)
+    pthread_mutex_lock(&pool->frozen->lock);
+#endif
+}
+
+void
+pool_frozen_unlock(Pool *pool)
+{
+#ifdef ENABLE_PTHREADS
+  if (pool->frozen)
+    pthread_mutex_unlock(&pool->frozen->lock);
+#endif
+}
+
+Datapos *
+pool_frozen_pos(Pool *pool)
+{
+#ifdef ENABLE_PTHREADS
+  if (pool->frozen)
+    return &pool_threadctx(pool)->pos;
+#endif
+  return &pool->pos;
+}
+
+/* free replaced data when the pool is unfrozen. needs the frozen lock. */
+void
+pool_frozen_retire(Pool *pool, void *old)
+{
+  struct s_Pool_frozen *frozen = pool->frozen;
+  frozen->retired = solv_extend(frozen->retired, frozen->nretired, 1, sizeof(void *), 15);
+  frozen->retired[frozen->nretired++] = old;
+}
+
+/* let the page stores grow beyond their REPOPAGE_MINSLOTS fixed pages
+ * while all cached pages of the pool use less than growth bytes.
+ * This is not a limit: a store never shrinks and never evicts pages
+ * of other stores, the pages are only freed with the repodata.
+ * Zero means that the stores do not grow. */
+void
+pool_set_pagecache_growth(Pool *pool, size_t growth)
+{
+  pool->pagecache->growth = growth;
+}
+
+/* load and decompress up to npages pages in a background thread
+ * when a sequential scan is detected. Zero turns it off. */
+void
+pool_set_pagecache_readahead(Pool *pool, int npages)
+{
+  pool->pagecache->asyncpages = npages > 0 ? npages : 0;
+}
+
+void
+pool_get_pagecache_stats(Pool *pool, Pool_pagecachestats *stats)
+{
+  Repopagecache *cache = pool->pagecache;
+  memset(stats, 0, sizeof(*stats));
+  stats->hits = cache->hits;
+  stats->misses = cache->misses;
+  stats->evictions = cache->evictions;
+  stats->readaheads = cache->readaheads;
+  stats->decompressed = cache->decompressed;
+  stats->prefetched = cache->prefetched;
+  stats->used = cache->used;
+  stats->growth = cache->growth;
+}
+
+void
+pool_reset_pagecache_stats(Pool *pool)
+{
+  Repopagecache *cache = pool->pagecache;
+  cache->hits = cache->misses = cache->evictions = 0;
+  cache->readaheads = cache->decompressed = cache->prefetched = 0;
+}
+
+void
+pool_memstats(Pool *pool, Pool_memstats *stats)
+{
+  Stringpool *ss = &pool->ss;
+  size_t nstrings = ss->nstrings, nrels = pool->nrels;
+  int i, nsolvables = pool->nsolvables;
+  Repo *repo;
+
+  memset(stats, 0, sizeof(*stats));
+  stats->stringspace = stringpool_memused(ss);
+  if (pool->sshashes)
+    stats->stringspace += nstrings * sizeof(Hashval);
+  stats->rels = nrels * sizeof(Reldep);
+  if (pool->relhashtbl)
+    stats->rels += ((size_t)pool->relhashmask + 1) * sizeof(Id);
+  if (pool->whatprovides)
+    stats->whatprovides += nstrings * sizeof(Offset);
+  if (pool->whatprovides_rel)
+    stats->whatprovides += nrels * sizeof(Offset);
+  if (pool->whatprovidesdata)
+    stats->whatprovides += ((size_t)pool->whatprovidesdataoff + pool->whatprovidesdataleft) * sizeof(Id);
+  if (pool->whatprovidesaux)
+    stats->whatprovides += nstrings * sizeof(Offset);
+  if (pool->whatprovidesauxdata)
+    stats->whatprovides += (size_t)pool->whatprovidesauxdataoff * sizeof(Id);
+  if (pool->whatprovidesevr)
+    stats->whatprovides += (size_t)pool->whatprovidesevroff * sizeof(Offset);
+  if (pool->whatprovidesevrdata)
+    stats->whatprovides += (size_t)pool->whatprovidesevrdataoff * sizeof(Id);
+  if (pool->evrcache)
+    stats->whatprovides += (size_t)pool->evrcachen * sizeof(unsigned int);
+  stats->total = stats->stringspace + stats->rels + stats->whatprovides;
+  FOR_REPOS(i, repo)
+    {
+      nsolvables -= repo->nsolvables;
+      repo_memstats(repo, stats);
+    }
+  /* free solvables and the system solvable */
+  stats->solvables += nsolvables * sizeof(Solvable);
+  stats->total += nsolvables * sizeof(Solvable);
+}
+
 void
 pool_setdebuglevel(Pool *pool, int level)
 {
@@ -422,7 +761,7 @@ pool_search(Pool *pool, Id p, Id key, const char *match, int flags, int (*callba
 void
 pool_clear_pos(Pool *pool)
 {
-  memset(&pool->pos, 0, sizeof(pool->pos));
+  memset(pool_datapos(pool), 0, sizeof(Datapos));
 }
 
 void
@@ -468,16 +807,17 @@ pool_id2langid(Pool *pool, Id id, const char *lang, int create)
 char *
 pool_alloctmpspace(Pool *pool, int len)
 {
-  int n = pool->tmpspace.n;
+  struct s_Pool_tmpspace *tmpspace = pool_tmpspace(pool);
+  int n = tmpspace->n;
   if (!len)
     return 0;
-  if (len > pool->tmpspace.len[n])
+  if (len > tmpspace->len[n])
     {
-      pool->tmpspace.buf[n] = solv_realloc(pool->tmpspace.buf[n], len + 32);
-      pool->tmpspace.len[n] = len + 32;
+      tmpspace->buf[n] = solv_realloc(tmpspace->buf[n], len + 32);
+      tmpspace->len[n] = len + 32;
     }
-  pool->tmpspace.n = (n + 1) % POOL_TMPSPACEBUF;
-  return pool->tmpspace.buf[n];
+  tmpspace->n = (n + 1) % POOL_TMPSPACEBUF;
+  return tmpspace->buf[n];
 }
 
 static char *
@@ -485,22 +825,23 @@ pool_alloctmpspace_free(Pool *pool, const char *space, int len)
 {
   if (space)
     {
+      struct s_Pool_tmpspace *tmpspace = pool_tmpspace(pool);
       int n, oldn;
-      n = oldn = pool->tmpspace.n;
+      n = oldn = tmpspace->n;
       for (;;)
 	{
 	  if (!n--)
 	    n = POOL_TMPSPACEBUF - 1;
 	  if (n == oldn)
 	    break;
-	  if (pool->tmpspace.buf[n] != space)
+	  if (tmpspace->buf[n] != space)
 	    continue;
-	  if (len > pool->tmpspace.len[n])
+	  if (len > tmpspace->len[n])
 	    {
-	      pool->tmpspace.buf[n] = solv_realloc(pool->tmpspace.buf[n], len + 32);
-	      pool->tmpspace.len[n] = len + 32;
+	      tmpspace->buf[n] = solv_realloc(tmpspace->buf[n], len + 32);
+	      tmpspace->len[n] = len + 32;
 	    }
-          return pool->tmpspace.buf[n];
+          return tmpspace->buf[n];
 	}
     }
   return 0;
@@ -509,12 +850,13 @@ pool_alloctmpspace_free(Pool *pool, const char *space, int len)
 void
 pool_freetmpspace(Pool *pool, const char *space)
 {
-  int n = pool->tmpspace.n;
+  struct s_Pool_tmpspace *tmpspace = pool_tmpspace(pool);
+  int n = tmpspace->n;
   if (!space)
     return;
   n = (n + (POOL_TMPSPACEBUF - 1)) % POOL_TMPSPACEBUF;
-  if (pool->tmpspace.buf[n] == space)
-    pool->tmpspace.n = n;
+  if (tmpspace->buf[n] == space)
+    tmpspace->n = n;
 }
 
 char *
@@ -594,8 +936,12 @@ pool_bin2hex(Pool *pool, const unsigned char *buf, int len)
 const char *
 pool_lookup_str(Pool *pool, Id entry, Id keyname)
 {
-  if (entry == SOLVID_POS && pool->pos.repo)
-    return repo_lookup_str(pool->pos.repo, pool->pos.repodataid ? entry : pool->pos.solvid, keyname);
+  if (entry == SOLVID_POS)
+    {
+      Datapos *pos = pool_datapos(pool);
+      if (pos->repo)
+	return repo_lookup_str(pos->repo, pos->repodataid ? entry : pos->solvid, keyname);
+    }
   if (entry <= 0)
     return 0;
   return solvable_lookup_str(pool->solvables + entry, keyname);
@@ -604,8 +950,12 @@ pool_lookup_str(Pool *pool, Id entry, Id keyname)
 Id
 pool_lookup_id(Pool *pool, Id entry, Id keyname)
 {
-  if (entry == SOLVID_POS && pool->pos.repo)
-    return repo_lookup_id(pool->pos.repo, pool->pos.repodataid ? entry : pool->pos.solvid, keyname);
+  if (entry == SOLVID_POS)
+    {
+      Datapos *pos = pool_datapos(pool);
+      if (pos->repo)
+	return repo_lookup_id(pos->repo, pos->repodataid ? entry : pos->solvid, keyname);
+    }
   if (entry <= 0)
     return 0;
   return solvable_lookup_id(pool->solvables + entry, keyname);
@@ -614,8 +964,12 @@ pool_lookup_id(Pool *pool, Id entry, Id keyname)
 unsigned long long
 pool_lookup_num(Pool *pool, Id entry, Id keyname, unsigned long long notfound)
 {
-  if (entry == SOLVID_POS && pool->pos.repo)
-    return repo_lookup_num(pool->pos.repo, pool->pos.repodataid ? entry : pool->pos.solvid, keyname, notfound);
+  if (entry == SOLVID_POS)
+    {
+      Datapos *pos = pool_datapos(pool);
+      if (pos->repo)
+	return repo_lookup_num(pos->repo, pos->repodataid ? entry : pos->solvid, keyname, notfound);
+    }
   if (entry <= 0)
     return notfound;
   return solvable_lookup_num(pool->solvables + entry, keyname, notfound);
@@ -624,8 +978,12 @@ pool_lookup_num(Pool *pool, Id entry, Id keyname, unsigned long long notfound)
 int
 pool_lookup_void(Pool *pool, Id entry, Id keyname)
 {
-  if (entry == SOLVID_POS && pool->pos.repo)
-    return repo_lookup_void(pool->pos.repo, pool->pos.repodataid ? entry : pool->pos.solvid, keyname);
+  if (entry == SOLVID_POS)
+    {
+      Datapos *pos = pool_datapos(pool);
+      if (pos->repo)
+	return repo_lookup_void(pos->repo, pos->repodataid ? entry : pos->solvid, keyname);
+    }
   if (entry <= 0)
     return 0;
   return solvable_lookup_void(pool->solvables + entry, keyname);
@@ -634,8 +992,12 @@ pool_lookup_void(Pool *pool, Id entry, Id keyname)
 const unsigned char *
 pool_lookup_bin_checksum(Pool *pool, Id entry, Id keyname, Id *typep)
 {
-  if (entry == SOLVID_POS && pool->pos.repo)
-    return repo_lookup_bin_checksum(pool->pos.repo, pool->pos.repodataid ? entry : pool->pos.solvid, keyname, typep);
+  if (entry == SOLVID_POS)
+    {
+      Datapos *pos = pool_datapos(pool);
+      if (pos->repo)
+	return repo_lookup_bin_checksum(pos->repo, pos->repodataid ? entry : pos->solvid, keyname, typep);
+    }
   if (entry <= 0)
     return 0;
   return solvable_lookup_bin_checksum(pool->solvables + entry, keyname, typep);
@@ -644,8 +1006,12 @@ pool_lookup_bin_checksum(Pool *pool, Id entry, Id keyname, Id *typep)
 const char *
 pool_lookup_checksum(Pool *pool, Id entry, Id keyname, Id *typep)
 {
-  if (entry == SOLVID_POS && pool->pos.repo)
-    return repo_lookup_checksum(pool->pos.repo, pool->pos.repodataid ? entry : pool->pos.solvid, keyname, typep);
+  if (entry == SOLVID_POS)
+    {
+      Datapos *pos = pool_datapos(pool);
+      if (pos->repo)
+	return repo_lookup_checksum(pos->repo, pos->repodataid ? entry : pos->solvid, keyname, typep);
+    }
   if (entry <= 0)
     return 0;
   return solvable_lookup_checksum(pool->solvables + entry, keyname, typep);
@@ -654,8 +1020,12 @@ pool_lookup_checksum(Pool *pool, Id entry, Id keyname, Id *typep)
 int
 pool_lookup_idarray(Pool *pool, Id entry, Id keyname, Queue *q)
 {
-  if (entry == SOLVID_POS && pool->pos.repo)
-    return repo_lookup_idarray(pool->pos.repo, pool->pos.repodataid ? entry : pool->pos.solvid, keyname, q);
+  if (entry == SOLVID_POS)
+    {
+      Datapos *pos = pool_datapos(pool);
+      if (pos->repo)
+	return repo_lookup_idarray(pos->repo, pos->repodataid ? entry : pos->solvid, keyname, q);
+    }
   if (entry <= 0)
     return 0;
   return solvable_lookup_idarray(pool->solvables + entry, keyname, q);
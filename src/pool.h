@@ -59,6 +59,9 @@ struct s_Pool_tmpspace {
   int   n;
 };
 
+struct s_Pool_frozen;
+struct s_Pool_concurrent;
+
 #endif
 
 struct s_Pool {
@@ -119,7 +122,7 @@ struct s_Pool {
   int (*loadcallback)(Pool *, Repodata *, void *);
   void *loadcallbackdata;
 
-  /* search position */
+  /* search position (threads of a frozen pool use their own) */
   Datapos pos;
 
   Queue pooljobs;		/* fixed jobs, like USERINSTALLED/MULTIVERSION */
@@ -167,6 +170,18 @@ struct s_Pool {
   int nonstd_nids;
 
   int whatprovideswithdisabled;
+  int whatprovidesevrindex;	/* create the evr sorted provider index */
+  Offset *whatprovidesevr;	/* name -> offset into whatprovidesevrdata */
+  Offset whatprovidesevroff;	/* length of whatprovidesevr */
+  Id *whatprovidesevrdata;
+  Offset whatprovidesevrdataoff;	/* length of whatprovidesevrdata */
+  unsigned int *evrcache;	/* evr Id -> rank << 1 | has release */
+  Offset evrcachen;
+  unsigned int generation;	/* bumped when the package rules of a solver may become stale */
+  struct s_Pool_frozen *frozen;	/* set by pool_freeze() */
+  struct s_Pool_concurrent *concurrent;	/* set by pool_begin_concurrent() */
+  struct s_Repopagecache *pagecache;	/* shared by the page stores of all repodata */
+  Hashval *sshashes;		/* stored memhash() values of the strings in ss, see POOL_FLAG_STRINGHASHES */
 #endif
 };
 
@@ -207,6 +222,8 @@ struct s_Pool {
 #define POOL_FLAG_IMPLICITOBSOLETEUSESCOLORS		10
 #define POOL_FLAG_NOWHATPROVIDESAUX			11
 #define POOL_FLAG_WHATPROVIDESWITHDISABLED		12
+#define POOL_FLAG_WHATPROVIDESEVRINDEX			13
+#define POOL_FLAG_STRINGHASHES				14
 
 /* ----------------------------------------------- */
 
@@ -272,6 +289,46 @@ extern void pool_set_installed(Pool *pool, Repo *repo);
 extern int  pool_error(Pool *pool, int ret, const char *format, ...) __attribute__((format(printf, 3, 4)));
 extern char *pool_errstr(Pool *pool);
 
+extern void pool_freeze(Pool *pool);
+extern void pool_unfreeze(Pool *pool);
+
+extern void pool_begin_concurrent(Pool *pool);
+extern void pool_end_concurrent(Pool *pool);
+
+extern int pool_compact(Pool *pool, Queue *keep, void (*remapcb)(Pool *pool, void *remapdata, Id *strmap, Id *relmap), void *remapdata);
+
+/* statistics of the page cache used for paged repository data */
+typedef struct s_Pool_pagecachestats {
+  unsigned long long hits;		/* requested pages that were already loaded */
+  unsigned long long misses;		/* requested pages that had to be loaded */
+  unsigned long long evictions;		/* pages dropped to make room for other pages */
+  unsigned long long readaheads;	/* pages that got a read-ahead hint */
+  unsigned long long decompressed;	/* bytes produced by page decompression */
+  unsigned long long prefetched;	/* pages loaded by the read-ahead thread */
+  size_t used;				/* bytes used by the cached pages */
+  size_t growth;			/* see pool_set_pagecache_growth() */
+} Pool_pagecachestats;
+
+extern void pool_set_pagecache_growth(Pool *pool, size_t growth);
+extern void pool_set_pagecache_readahead(Pool *pool, int npages);
+extern void pool_get_pagecache_stats(Pool *pool, Pool_pagecachestats *stats);
+extern void pool_reset_pagecache_stats(Pool *pool);
+
+/* memory used by the pool, all sizes are in bytes */
+typedef struct s_Pool_memstats {
+  size_t stringspace;		/* strings and their hashes, including local pools */
+  size_t rels;			/* relations and their hash */
+  size_t whatprovides;		/* whatprovides index and evr cache */
+  size_t solvables;		/* solvables and their dependency arrays */
+  size_t incore;		/* internalized repository data and directories */
+  size_t attr;			/* repository data not yet internalized */
+  size_t pages;			/* loaded pages and page tables of paged data */
+  size_t schemata;		/* keys and schemata of the repository data */
+  size_t total;			/* sum of the above */
+} Pool_memstats;
+
+extern void pool_memstats(Pool *pool, Pool_memstats *stats);
+
 extern void pool_set_rootdir(Pool *pool, const char *rootdir);
 extern const char *pool_get_rootdir(Pool *pool);
 extern char *pool_prepend_rootdir(Pool *pool, const char *dir);
@@ -332,6 +389,7 @@ extern Id pool_ids2whatprovides(Pool *pool, Id *ids, int count);
 extern Id pool_searchlazywhatprovidesq(Pool *pool, Id d);
 
 extern Id pool_addrelproviders(Pool *pool, Id d);
+extern void pool_addrelproviders_parallel(Pool *pool, Queue *q, int nthreads);
 
 static inline Id pool_whatprovides(Pool *pool, Id d)
 {
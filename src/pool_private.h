@@ -0,0 +1,29 @@
+/*
+ * Copyright (c) 2007, Novell Inc.
+ *
+ * This program is licensed under the BSD license, read LICENSE.BSD
+ * for further information
+ */
+
+/*
+ * pool_private.h
+ *
+ */
+
+#ifndef LIBSOLV_POOL_PRIVATE_H
+#define LIBSOLV_POOL_PRIVATE_H
+
+/* frozen pool support, see pool.c */
+extern void pool_frozen_lock(Pool *pool);
+extern void pool_frozen_unlock(Pool *pool);
+extern void pool_frozen_retire(Pool *pool, void *old);
+extern Datapos *pool_frozen_pos(Pool *pool);
+
+/* the lookup position of the calling thread */
+static inline Datapos *
+pool_datapos(Pool *pool)
+{
+  return pool->frozen ? pool_frozen_pos(pool) : &pool->pos;
+}
+
+#endif /* LIBSOLV_POOL_PRIVATE_H */
@@ -105,6 +105,7 @@ pool_setarchpolicy(Pool *pool, const char *arch)
   Id *id2arch;
   Id id, lastarch;
 
+  pool->generation++;
   pool->id2arch = solv_free(pool->id2arch);
   pool->id2color = solv_free(pool->id2color);
   if (!arch)
@@ -0,0 +1,424 @@
+/*
+ * Copyright (c) 2025, SUSE LLC
+ *
+ * This program is licensed under the BSD license, read LICENSE.BSD
+ * for further information
+ */
+
+/*
+ * poolconcurrent.c
+ *
+ * concurrent creation of string and relation ids. Between
+ * pool_begin_concurrent() and pool_end_concurrent() the functions
+ * pool_str2id(), pool_strn2id() and pool_rel2id() may be called from
+ * multiple threads at the same time.
+ *
+ * Ids that existed before are found with the normal pool hashes, which
+ * do not change in this mode. New ids are entered into hash tables that
+ * are split into shards, every shard has its own lock. Lookups do not
+ * lock at all, only the creation of a new id locks the shard and then
+ * appends to the pool arrays with the append lock. Arrays that need to
+ * grow are copied instead of reallocated, the old copies are freed in
+ * pool_end_concurrent() as other threads may still read them.
+ */
+
+#include <stdlib.h>
+#include <string.h>
+#ifdef ENABLE_PTHREADS
+#include <pthread.h>
+#endif
+
+#include "pool.h"
+#include "poolid.h"
+#include "poolid_private.h"
+#include "util.h"
+
+#define CONCURRENT_SHARDS	64	/* must be a power of two */
+#define CONCURRENT_SHARDBITS	6
+
+#if defined(__GNUC__)
+#define CONCURRENT_LOAD(p)	__atomic_load_n(&(p), __ATOMIC_ACQUIRE)
+#define CONCURRENT_PUBLISH(p, v)	__atomic_store_n(&(p), (v), __ATOMIC_RELEASE)
+#else
+#define CONCURRENT_LOAD(p)	(p)
+#define CONCURRENT_PUBLISH(p, v)	((p) = (v))
+#endif
+
+#ifdef ENABLE_PTHREADS
+#define CONCURRENT_LOCK(l)	pthread_mutex_lock(&(l))
+#define CONCURRENT_UNLOCK(l)	pthread_mutex_unlock(&(l))
+#else
+#define CONCURRENT_LOCK(l)
+#define CONCURRENT_UNLOCK(l)
+#endif
+
+struct s_Pool_concurrent_shard {
+#ifdef ENABLE_PTHREADS
+  pthread_mutex_t lock;
+#endif
+  Id *table;			/* table[0] is the hash mask, the slots follow */
+  int count;
+};
+
+struct s_Pool_concurrent {
+#ifdef ENABLE_PTHREADS
+  pthread_mutex_t lock;		/* serializes appending to the pool arrays */
+#endif
+  struct s_Pool_concurrent_shard strshards[CONCURRENT_SHARDS];
+  struct s_Pool_concurrent_shard relshards[CONCURRENT_SHARDS];
+  int nstringsalloc;		/* allocated sizes of the pool arrays */
+  Offset sstringsalloc;
+  int nrelsalloc;
+  void **retired;		/* replaced arrays that may still be in use */
+  int nretired;
+};
+
+static inline struct s_Pool_concurrent_shard *
+concurrent_shard(struct s_Pool_concurrent_shard *shards, Hashval hv)
+{
+  return shards + ((hv * 0x9e3779b1U) >> (32 - CONCURRENT_SHARDBITS));
+}
+
+/* needs the append lock */
+static void
+concurrent_retire(struct s_Pool_concurrent *conc, void *old)
+{
+  if (!old)
+    return;
+  conc->retired = solv_extend(conc->retired, conc->nretired, 1, sizeof(void *), 63);
+  conc->retired[conc->nretired++] = old;
+}
+
+/* copy an array into a bigger one, needs the append lock */
+static void *
+concurrent_grow(struct s_Pool_concurrent *conc, void *old, size_t oldsize, size_t newsize)
+{
+  void *new = solv_malloc(newsize);
+  if (oldsize)
+    memcpy(new, old, oldsize);
+  concurrent_retire(conc, old);
+  return new;
+}
+
+static inline Hashval
+concurrent_strhash(Pool *pool, const char *str, unsigned int len)
+{
+  return CONCURRENT_LOAD(pool->sshashes) ? memhash(str, len) : strnhash(str, len);
+}
+
+static inline int
+concurrent_strmatch(Pool *pool, Id id, const char *str, unsigned int len, Hashval hv)
+{
+  Stringpool *ss = &pool->ss;
+  const char *s;
+  Hashval *hashes = CONCURRENT_LOAD(pool->sshashes);
+  if (hashes && hashes[id] != hv)
+    return 0;
+  s = CONCURRENT_LOAD(ss->stringspace) + CONCURRENT_LOAD(ss->strings)[id];
+  /* do not read past the terminator, the space behind may get written */
+  return !strncmp(s, str, len) && strlen(s) == len;
+}
+
+static inline int
+concurrent_relmatch(Pool *pool, Id id, Id name, Id evr, int flags)
+{
+  Reldep *rd = CONCURRENT_LOAD(pool->rels) + id;
+  return rd->name == name && rd->evr == evr && rd->flags == flags;
+}
+
+/* find a string in a pool hash or shard table. The pool hash does
+ * not change in concurrent mode. */
+static Id
+concurrent_findstr(Pool *pool, Id *table, Hashval mask, const char *str, unsigned int len, Hashval hv)
+{
+  Hashval h, hh;
+  Id id;
+
+  if (!table)
+    return 0;
+  h = hv & mask;
+  hh = HASHCHAIN_START;
+  while ((id = CONCURRENT_LOAD(table[h])) != 0)
+    {
+      if (concurrent_strmatch(pool, id, str, len, hv))
+	return id;
+      h = HASHCHAIN_NEXT(h, hh, mask);
+    }
+  return 0;
+}
+
+static Id
+concurrent_findrel(Pool *pool, Id *table, Hashval mask, Id name, Id evr, int flags, Hashval hv)
+{
+  Hashval h, hh;
+  Id id;
+
+  if (!table)
+    return 0;
+  h = hv & mask;
+  hh = HASHCHAIN_START;
+  while ((id = CONCURRENT_LOAD(table[h])) != 0)
+    {
+      if (concurrent_relmatch(pool, id, name, evr, flags))
+	return id;
+      h = HASHCHAIN_NEXT(h, hh, mask);
+    }
+  return 0;
+}
+
+static inline Id
+concurrent_findstr_shard(Pool *pool, struct s_Pool_concurrent_shard *shard, const char *str, unsigned int len, Hashval hv)
+{
+  Id *table = CONCURRENT_LOAD(shard->table);
+  return table ? concurrent_findstr(pool, table + 1, (Hashval)table[0], str, len, hv) : 0;
+}
+
+static inline Id
+concurrent_findrel_shard(Pool *pool, struct s_Pool_concurrent_shard *shard, Id name, Id evr, int flags, Hashval hv)
+{
+  Id *table = CONCURRENT_LOAD(shard->table);
+  return table ? concurrent_findrel(pool, table + 1, (Hashval)table[0], name, evr, flags, hv) : 0;
+}
+
+static Hashval
+concurrent_idhash(Pool *pool, Id id, int isrel)
+{
+  Stringpool *ss = &pool->ss;
+  const char *str;
+  if (isrel)
+    {
+      Reldep *rd = pool->rels + id;
+      return relhash(rd->name, rd->evr, rd->flags);
+    }
+  if (pool->sshashes)
+    return pool->sshashes[id];
+  str = ss->stringspace + ss->strings[id];
+  return strnhash(str, strlen(str));
+}
+
+/* add a new id to a shard table, needs the shard lock */
+static void
+concurrent_insert(Pool *pool, struct s_Pool_concurrent_shard *shard, Id id, Hashval hv, int isrel)
+{
+  struct s_Pool_concurrent *conc = pool->concurrent;
+  Id *table = shard->table, *newtable;
+  Hashval h, hh, mask, newmask;
+  int i;
+
+  mask = table ? (Hashval)table[0] : 0;
+  if ((Hashval)(shard->count + 1) * 2 >= mask)
+    {
+      /* grow the table, readers may still use the old one */
+      newmask = mkmask(shard->count + 256);
+      newtable = solv_calloc(newmask + 2, sizeof(Id));
+      newtable[0] = (Id)newmask;
+      for (i = 1; table && i <= (int)mask + 1; i++)
+	{
+	  if (!table[i])
+	    continue;
+	  h = concurrent_idhash(pool, table[i], isrel) & newmask;
+	  hh = HASHCHAIN_START;
+	  while (newtable[h + 1])
+	    h = HASHCHAIN_NEXT(h, hh, newmask);
+	  newtable[h + 1] = table[i];
+	}
+      CONCURRENT_PUBLISH(shard->table, newtable);
+      CONCURRENT_LOCK(conc->lock);
+      concurrent_retire(conc, table);
+      CONCURRENT_UNLOCK(conc->lock);
+      table = newtable;
+      mask = newmask;
+    }
+  h = hv & mask;
+  hh = HASHCHAIN_START;
+  while (table[h + 1])
+    h = HASHCHAIN_NEXT(h, hh, mask);
+  CONCURRENT_PUBLISH(table[h + 1], id);
+  shard->count++;
+}
+
+/* append a new string to the pool, needs the shard lock */
+static Id
+concurrent_addstr(Pool *pool, const char *str, unsigned int len, Hashval hv)
+{
+  struct s_Pool_concurrent *conc = pool->concurrent;
+  Stringpool *ss = &pool->ss;
+  Id id;
+
+  CONCURRENT_LOCK(conc->lock);
+  id = ss->nstrings;
+  if (id >= conc->nstringsalloc)
+    {
+      int n = id + id / 2 + 4096;
+      if (pool->sshashes)
+	CONCURRENT_PUBLISH(pool->sshashes, concurrent_grow(conc, pool->sshashes, id * sizeof(Hashval), n * sizeof(Hashval)));
+      CONCURRENT_PUBLISH(ss->strings, concurrent_grow(conc, ss->strings, id * sizeof(Offset), n * sizeof(Offset)));
+      conc->nstringsalloc = n;
+    }
+  if (ss->sstrings + len + 1 > conc->sstringsalloc)
+    {
+      Offset n = ss->sstrings + ss->sstrings / 2 + len + 65536;
+      CONCURRENT_PUBLISH(ss->stringspace, concurrent_grow(conc, ss->stringspace, ss->sstrings, n));
+      conc->sstringsalloc = n;
+    }
+  memcpy(ss->stringspace + ss->sstrings, str, len);
+  ss->stringspace[ss->sstrings + len] = 0;
+  ss->strings[id] = ss->sstrings;
+  if (pool->sshashes)
+    pool->sshashes[id] = hv;
+  ss->sstrings += len + 1;
+  CONCURRENT_PUBLISH(ss->nstrings, id + 1);
+  CONCURRENT_UNLOCK(conc->lock);
+  return id;
+}
+
+/* append a new relation to the pool, needs the shard lock */
+static Id
+concurrent_addrel(Pool *pool, Id name, Id evr, int flags)
+{
+  struct s_Pool_concurrent *conc = pool->concurrent;
+  Reldep *rd;
+  Id id;
+
+  CONCURRENT_LOCK(conc->lock);
+  id = pool->nrels;
+  if (id >= conc->nrelsalloc)
+    {
+      int n = id + id / 2 + 4096;
+      CONCURRENT_PUBLISH(pool->rels, concurrent_grow(conc, pool->rels, id * sizeof(Reldep), n * sizeof(Reldep)));
+      conc->nrelsalloc = n;
+    }
+  rd = pool->rels + id;
+  rd->name = name;
+  rd->evr = evr;
+  rd->flags = flags;
+  CONCURRENT_PUBLISH(pool->nrels, id + 1);
+  CONCURRENT_UNLOCK(conc->lock);
+  return id;
+}
+
+Id
+pool_concurrent_strn2id(Pool *pool, const char *str, unsigned int len, int create)
+{
+  struct s_Pool_concurrent_shard *shard;
+  Stringpool *ss = &pool->ss;
+  Hashval hv;
+  Id id;
+
+  if (!str)
+    return STRID_NULL;
+  if (!len)
+    return STRID_EMPTY;
+  hv = concurrent_strhash(pool, str, len);
+  id = concurrent_findstr(pool, ss->stringhashtbl, ss->stringhashmask, str, len, hv);
+  if (id)
+    return id;
+  shard = concurrent_shard(pool->concurrent->strshards, hv);
+  id = concurrent_findstr_shard(pool, shard, str, len, hv);
+  if (id || !create)
+    return id;
+  CONCURRENT_LOCK(shard->lock);
+  id = concurrent_findstr_shard(pool, shard, str, len, hv);	/* check again with the lock */
+  if (!id)
+    {
+      id = concurrent_addstr(pool, str, len, hv);
+      concurrent_insert(pool, shard, id, hv, 0);
+    }
+  CONCURRENT_UNLOCK(shard->lock);
+  return id;
+}
+
+Id
+pool_concurrent_rel2id(Pool *pool, Id name, Id evr, int flags, int create)
+{
+  struct s_Pool_concurrent_shard *shard;
+  Hashval hv;
+  Id id;
+
+  hv = relhash(name, evr, flags);
+  id = concurrent_findrel(pool, pool->relhashtbl, pool->relhashmask, name, evr, flags, hv);
+  if (id)
+    return MAKERELDEP(id);
+  shard = concurrent_shard(pool->concurrent->relshards, hv);
+  id = concurrent_findrel_shard(pool, shard, name, evr, flags, hv);
+  if (id || !create)
+    return id ? MAKERELDEP(id) : ID_NULL;
+  CONCURRENT_LOCK(shard->lock);
+  id = concurrent_findrel_shard(pool, shard, name, evr, flags, hv);
+  if (!id)
+    {
+      id = concurrent_addrel(pool, name, evr, flags);
+      concurrent_insert(pool, shard, id, hv, 1);
+    }
+  CONCURRENT_UNLOCK(shard->lock);
+  return MAKERELDEP(id);
+}
+
+/*
+ * allow the creation of ids from multiple threads. The whatprovides
+ * index is freed as it cannot grow concurrently. Other changes of the
+ * pool are still not allowed from multiple threads.
+ */
+void
+pool_begin_concurrent(Pool *pool)
+{
+  struct s_Pool_concurrent *conc;
+#ifdef ENABLE_PTHREADS
+  int i;
+#endif
+
+  if (pool->concurrent || pool->frozen)
+    return;
+  if (pool->whatprovides)
+    pool_freewhatprovides(pool);
+  pool_createidhashes(pool);
+  conc = solv_calloc(1, sizeof(*conc));
+#ifdef ENABLE_PTHREADS
+  pthread_mutex_init(&conc->lock, 0);
+  for (i = 0; i < CONCURRENT_SHARDS; i++)
+    {
+      pthread_mutex_init(&conc->strshards[i].lock, 0);
+      pthread_mutex_init(&conc->relshards[i].lock, 0);
+    }
+#endif
+  conc->nstringsalloc = pool->ss.nstrings;
+  conc->sstringsalloc = pool->ss.sstrings;
+  conc->nrelsalloc = pool->nrels;
+  pool->concurrent = conc;
+}
+
+/* back to single threaded id creation. All other threads must have
+ * stopped using the pool functions. */
+void
+pool_end_concurrent(Pool *pool)
+{
+  struct s_Pool_concurrent *conc = pool->concurrent;
+  int i;
+
+  if (!conc)
+    return;
+  pool->concurrent = 0;
+  for (i = 0; i < CONCURRENT_SHARDS; i++)
+    {
+      solv_free(conc->strshards[i].table);
+      solv_free(conc->relshards[i].table);
+#ifdef ENABLE_PTHREADS
+      pthread_mutex_destroy(&conc->strshards[i].lock);
+      pthread_mutex_destroy(&conc->relshards[i].lock);
+#endif
+    }
+#ifdef ENABLE_PTHREADS
+  pthread_mutex_destroy(&conc->lock);
+#endif
+  for (i = 0; i < conc->nretired; i++)
+    solv_free(conc->retired[i]);
+  solv_free(conc->retired);
+  solv_free(conc);
+  /* the pool hashes do not know the new ids. Recreate them after
+   * shrinking, a lookup that needs to create the hash may move the
+   * stringspace and thus the string that is looked up */
+  pool_freeidhashes(pool);
+  pool_shrink_strings(pool);
+  pool_shrink_rels(pool);
+  pool_createidhashes(pool);
+}
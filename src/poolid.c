@@ -18,6 +18,9 @@
 #include "pool.h"
 #include "poolid.h"
 #include "poolid_private.h"
+#include "repo.h"
+#include "solver.h"
+#include "evr.h"
 #include "util.h"
 
 #define REL_BLOCK		1023	/* hashtable for relations */
@@ -50,8 +53,16 @@ grow_whatprovides_rel(Pool *pool, Id id)
 Id
 pool_str2id(Pool *pool, const char *str, int create)
 {
-  int oldnstrings = pool->ss.nstrings;
-  Id id = stringpool_str2id(&pool->ss, str, create);
+  int oldnstrings;
+  Id id;
+  if (pool->concurrent)
+    return pool_concurrent_strn2id(pool, str, str ? strlen(str) : 0, create);
+  oldnstrings = pool->ss.nstrings;
+  if (pool->frozen)
+    create = 0;		/* no new ids in frozen pools */
+  if (!str)
+    return STRID_NULL;
+  id = stringpool_strn2id_stored(&pool->ss, pool->sshashes ? &pool->sshashes : 0, str, strlen(str), create);
   if (create && pool->whatprovides && oldnstrings != pool->ss.nstrings)
     grow_whatprovides(pool, id);
   return id;
@@ -60,8 +71,14 @@ pool_str2id(Pool *pool, const char *str, int create)
 Id
 pool_strn2id(Pool *pool, const char *str, unsigned int len, int create)
 {
-  int oldnstrings = pool->ss.nstrings;
-  Id id = stringpool_strn2id(&pool->ss, str, len, create);
+  int oldnstrings;
+  Id id;
+  if (pool->concurrent)
+    return pool_concurrent_strn2id(pool, str, len, create);
+  oldnstrings = pool->ss.nstrings;
+  if (pool->frozen)
+    create = 0;		/* no new ids in frozen pools */
+  id = stringpool_strn2id_stored(&pool->ss, pool->sshashes ? &pool->sshashes : 0, str, len, create);
   if (create && pool->whatprovides && oldnstrings != pool->ss.nstrings)
     grow_whatprovides(pool, id);
   return id;
@@ -114,6 +131,8 @@ pool_rel2id(Pool *pool, Id name, Id evr, int flags, int create)
   Hashtable hashtbl;
   Reldep *ran;
 
+  if (pool->concurrent)
+    return pool_concurrent_rel2id(pool, name, evr, flags, create);
 
   /* extend hashtable if needed */
   hashmask = pool->relhashmask;
@@ -137,7 +156,7 @@ pool_rel2id(Pool *pool, Id name, Id evr, int flags, int create)
   if (id)
     return MAKERELDEP(id);
 
-  if (!create)
+  if (!create || pool->frozen)
     return ID_NULL;
 
   id = pool->nrels++;
@@ -376,7 +395,7 @@ pool_shrink_strings(Pool *pool)
   /* free excessive big hashes */
   if (pool->ss.stringhashmask && pool->ss.stringhashmask > mkmask(pool->ss.nstrings + 8192))
     stringpool_freehash(&pool->ss);
-  stringpool_shrink(&pool->ss);
+  stringpool_shrink_stored(&pool->ss, &pool->sshashes);
 }
 
 void
@@ -396,4 +415,211 @@ pool_freeidhashes(Pool *pool)
   pool_free_rels_hash(pool);
 }
 
+/* create the hashes so that id lookups do not modify the pool */
+void
+pool_createidhashes(Pool *pool)
+{
+  stringpool_createhash(&pool->ss, pool->sshashes);
+  if ((Hashval)pool->nrels * 2 >= pool->relhashmask)
+    pool_resize_rels_hash(pool, REL_BLOCK);
+}
+
+/*
+ * drop all string and rel ids that are no longer used by the
+ * solvables, the repositories, the pool jobs or the arch setup and
+ * renumber the remaining ones. The order of the ids is kept, the
+ * predefined ids do not change. The ids in the keep queue are also
+ * kept and get rewritten. Applications that hold other ids can remap
+ * them in the callback: strmap maps the old string ids to the new
+ * ids, relmap maps the old rel numbers (GETRELID) to the new rel ids.
+ * Dropped ids map to zero.
+ * All other objects using ids (solvers, transactions, dataiterators)
+ * must be freed before calling this.
+ * Returns an error and does nothing if the pool is frozen or if the
+ * vertical data of a repodata may contain ids.
+ */
+int
+pool_compact(Pool *pool, Queue *keep, void (*remapcb)(Pool *pool, void *remapdata, Id *strmap, Id *relmap), void *remapdata)
+{
+  int nstrings = pool->ss.nstrings;
+  int nrels = pool->nrels;
+  Id *strmap, *relmap, *id2arch;
+  unsigned char *id2color;
+  Id lastarch, id, how;
+  Queue oneof;
+  Repo *repo;
+  Repodata *data;
+  Solvable *s;
+  Reldep *rd;
+  int i, j, n, rdid, remap, hadwhatprovides;
+
+  if (pool->frozen)
+    return pool_error(pool, -1, "pool is frozen");
+  FOR_REPOS(i, repo)
+    repo_internalize(repo);
+  /* the vertical data is not rewritten */
+  FOR_REPOS(i, repo)
+    FOR_REPODATAS(repo, rdid, data)
+      if (repodata_has_vertical_ids(data))
+	return pool_error(pool, -1, "repo %s stores ids in vertical storage", repo->name ? repo->name : "");
+
+  strmap = solv_calloc(nstrings, sizeof(Id));
+  relmap = solv_calloc(nrels > 1 ? nrels : 1, sizeof(Id));
+  for (i = 0; i < ID_NUM_INTERNAL && i < nstrings; i++)
+    strmap[i] = 1;
+  if (pool->id2arch)
+    for (i = 0; i <= pool->lastarch && i < nstrings; i++)
+      if (pool->id2arch[i])
+	strmap[i] = 1;
+
+  /* the ONE_OF pool jobs point into whatprovidesdata */
+  queue_init(&oneof);
+  for (i = 0; i < pool->pooljobs.count; i += 2)
+    if ((pool->pooljobs.elements[i] & SOLVER_SELECTMASK) == SOLVER_SOLVABLE_ONE_OF && pool->whatprovidesdata)
+      {
+	Id *pp = pool->whatprovidesdata + pool->pooljobs.elements[i + 1];
+	queue_push(&oneof, i);
+	while (*pp)
+	  queue_push(&oneof, *pp++);
+	queue_push(&oneof, 0);
+      }
+
+  /* first pass marks the used ids, second pass rewrites them */
+  for (remap = 0; remap < 2; remap++)
+    {
+      if (keep)
+	for (i = 0; i < keep->count; i++)
+	  keep->elements[i] = pool_compact_id(pool, strmap, relmap, keep->elements[i], remap);
+      for (i = 0; i < pool->pooljobs.count; i += 2)
+	{
+	  how = pool->pooljobs.elements[i] & SOLVER_SELECTMASK;
+	  if (how == SOLVER_SOLVABLE_NAME || how == SOLVER_SOLVABLE_PROVIDES)
+	    pool->pooljobs.elements[i + 1] = pool_compact_id(pool, strmap, relmap, pool->pooljobs.elements[i + 1], remap);
+	}
+      for (i = 2, s = pool->solvables + i; i < pool->nsolvables; i++, s++)
+	{
+	  if (!s->repo)
+	    continue;
+	  s->name = pool_compact_id(pool, strmap, relmap, s->name, remap);
+	  s->arch = pool_compact_id(pool, strmap, relmap, s->arch, remap);
+	  s->evr = pool_compact_id(pool, strmap, relmap, s->evr, remap);
+	  s->vendor = pool_compact_id(pool, strmap, relmap, s->vendor, remap);
+	}
+      FOR_REPOS(i, repo)
+	{
+	  for (j = 1; j < repo->idarraysize; j++)
+	    repo->idarraydata[j] = pool_compact_id(pool, strmap, relmap, repo->idarraydata[j], remap);
+	  FOR_REPODATAS(repo, rdid, data)
+	    repodata_compact_ids(data, strmap, relmap, remap);
+	}
+      if (remap)
+	break;
+
+      /* mark the parts of used rels, they always have lower ids */
+      for (i = nrels - 1; i > 0; i--)
+	if (relmap[i])
+	  {
+	    rd = pool->rels + i;
+	    pool_compact_id(pool, strmap, relmap, rd->name, 0);
+	    pool_compact_id(pool, strmap, relmap, rd->evr, 0);
+	  }
+      /* create the new numbering */
+      for (i = n = 0; i < nstrings; i++)
+	strmap[i] = strmap[i] ? n++ : 0;
+      j = n;
+      for (i = 1, n = 1; i < nrels; i++)
+	relmap[i] = relmap[i] ? MAKERELDEP(n++) : 0;
+      if (j == nstrings && n == nrels)
+	break;		/* nothing to drop */
+    }
+  if (remap)
+    {
+      /* rewrite the rels, in place as the new rel is never behind the old one */
+      for (i = 1; i < nrels; i++)
+	if (relmap[i])
+	  {
+	    Reldep *nrd = pool->rels + GETRELID(relmap[i]);
+	    rd = pool->rels + i;
+	    nrd->name = pool_compact_id(pool, strmap, relmap, rd->name, 1);
+	    nrd->evr = pool_compact_id(pool, strmap, relmap, rd->evr, 1);
+	    nrd->flags = rd->flags;
+	  }
+      for (i = nrels - 1; i > 0 && !relmap[i]; i--)
+	;
+      pool->nrels = i ? GETRELID(relmap[i]) + 1 : 1;
+      pool_free_rels_hash(pool);
+      pool_shrink_rels(pool);
+
+      /* the arch tables are indexed by the string id */
+      lastarch = 0;
+      for (i = pool->lastarch < nstrings - 1 ? pool->lastarch : nstrings - 1; i > 0; i--)
+	if (strmap[i])
+	  {
+	    lastarch = strmap[i];
+	    break;
+	  }
+      if (pool->id2arch)
+	{
+	  id2arch = solv_calloc(lastarch + 1, sizeof(Id));
+	  id2color = pool->id2color ? solv_calloc(lastarch + 1, 1) : 0;
+	  for (i = 1; i <= pool->lastarch && i < nstrings; i++)
+	    if (strmap[i])
+	      {
+		id2arch[strmap[i]] = pool->id2arch[i];
+		if (id2color)
+		  id2color[strmap[i]] = pool->id2color[i];
+	      }
+	  solv_free(pool->id2arch);
+	  solv_free(pool->id2color);
+	  pool->id2arch = id2arch;
+	  pool->id2color = id2color;
+	  pool->lastarch = lastarch;
+	}
+      stringpool_compact(&pool->ss, strmap, &pool->sshashes);
+      pool_createidhashes(pool);
+
+      /* the non-standard file dependencies are needed when the
+       * whatprovides get created. The new numbering keeps the order,
+       * so the ids stay sorted */
+      for (i = j = 0; i < pool->nonstd_nids; i++)
+	if (pool->nonstd_ids[i] < nstrings && strmap[pool->nonstd_ids[i]])
+	  pool->nonstd_ids[j++] = strmap[pool->nonstd_ids[i]];
+      pool->nonstd_nids = j;
+
+      /* drop the caches that are indexed by id */
+      pool_freeevrcache(pool);
+      pool->languagecache = solv_free(pool->languagecache);
+      pool->languagecacheother = 0;
+      queue_empty(&pool->vendormap);
+      pool_clear_pos(pool);
+      FOR_REPOS(i, repo)
+	{
+	  repo->lastidhash = solv_free(repo->lastidhash);
+	  repo->lastidhash_mask = 0;
+	  repo->lastidhash_idarraysize = 0;
+	  repo->lastmarkerpos = 0;
+	}
+      hadwhatprovides = pool->whatprovides ? 1 : 0;
+      pool_freewhatprovides(pool);
+      if (hadwhatprovides)
+	{
+	  pool_createwhatprovides(pool);
+	  /* re-add the ONE_OF pool jobs */
+	  for (i = 0; i < oneof.count; i = j + 1)
+	    {
+	      for (j = i + 1; oneof.elements[j]; j++)
+		;
+	      id = pool_ids2whatprovides(pool, oneof.elements + i + 1, j - i - 1);
+	      pool->pooljobs.elements[oneof.elements[i] + 1] = id;
+	    }
+	}
+    }
+  queue_free(&oneof);
+  if (remapcb)
+    remapcb(pool, remapdata, strmap, relmap);
+  solv_free(strmap);
+  solv_free(relmap);
+  return 0;
+}
+
 /* EOF */
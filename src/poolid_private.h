@@ -16,4 +16,29 @@
 /* the size of all buffers is incremented in blocks */
 #define WHATPROVIDES_BLOCK	1023
 
+/* id creation in concurrent mode, see poolconcurrent.c */
+extern Id pool_concurrent_strn2id(Pool *pool, const char *str, unsigned int len, int create);
+extern Id pool_concurrent_rel2id(Pool *pool, Id name, Id evr, int flags, int create);
+
+/* pool_compact() helper: if remap is not set mark the id as used,
+ * otherwise return the new id */
+static inline Id
+pool_compact_id(Pool *pool, Id *strmap, Id *relmap, Id id, int remap)
+{
+  if (ISRELDEP(id))
+    {
+      Id rid = GETRELID(id);
+      if (rid <= 0 || rid >= pool->nrels)
+	return id;
+      if (!remap)
+	relmap[rid] = 1;
+      return remap ? relmap[rid] : id;
+    }
+  if (id <= 0 || id >= pool->ss.nstrings)
+    return id;
+  if (!remap)
+    strmap[id] = 1;
+  return remap ? strmap[id] : id;
+}
+
 #endif /* LIBSOLV_POOLID_PRIVATE_H */
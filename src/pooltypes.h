@@ -28,11 +28,13 @@ extern "C" {
 #define SOLV_VERSION_7 7
 #define SOLV_VERSION_8 8
 #define SOLV_VERSION_9 9
+#define SOLV_VERSION_10 10
 
 #define SOLV_FLAG_PREFIX_POOL	4
 #define SOLV_FLAG_SIZE_BYTES	8
 #define SOLV_FLAG_USERDATA	16
 #define SOLV_FLAG_IDARRAYBLOCK	32
+#define SOLV_FLAG_DELTA		128
 
 struct s_Stringpool;
 typedef struct s_Stringpool Stringpool;
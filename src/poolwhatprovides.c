@@ -20,6 +20,7 @@
 
 #include "pool.h"
 #include "poolid_private.h"
+#include "pool_private.h"
 #include "repo.h"
 #include "util.h"
 #include "evr.h"
@@ -27,6 +28,8 @@
 #include "conda.h"
 #endif
 
+static void pool_createwhatprovidesevr(Pool *pool);
+
 static int
 pool_shrink_whatprovides_sortcmp(const void *ap, const void *bp, void *dp)
 {
@@ -335,6 +338,9 @@ pool_createwhatprovides(Pool *pool)
     }
   if (pool->lazywhatprovidesq.count)
     POOL_DEBUG(SOLV_DEBUG_STATS, "lazywhatprovidesq size: %d entries\n", pool->lazywhatprovidesq.count / 2);
+  if (pool->whatprovidesevrindex)
+    pool_createwhatprovidesevr(pool);
+  pool_createevrcache(pool);
 
   POOL_DEBUG(SOLV_DEBUG_STATS, "createwhatprovides took %d ms\n", solv_timems(now));
 }
@@ -356,6 +362,11 @@ pool_freewhatprovides(Pool *pool)
   pool->whatprovidesauxdata = solv_free(pool->whatprovidesauxdata);
   pool->whatprovidesauxoff = 0;
   pool->whatprovidesauxdataoff = 0;
+  pool->whatprovidesevr = solv_free(pool->whatprovidesevr);
+  pool->whatprovidesevrdata = solv_free(pool->whatprovidesevrdata);
+  pool->whatprovidesevroff = 0;
+  pool->whatprovidesevrdataoff = 0;
+  pool->generation++;
 }
 
 
@@ -370,6 +381,46 @@ pool_freewhatprovides(Pool *pool)
  *
  */
 
+/* make sure other threads see the data before they see the offset */
+#if defined(__GNUC__)
+#define FROZEN_RELEASE_FENCE()	__atomic_thread_fence(__ATOMIC_RELEASE)
+#define FROZEN_PUBLISH(p, v)	__atomic_store_n(&(p), (v), __ATOMIC_RELEASE)
+#else
+#define FROZEN_RELEASE_FENCE()
+#define FROZEN_PUBLISH(p, v)	((p) = (v))
+#endif
+
+/*
+ * frozen pool version of pool_ids2whatprovides. Other threads may
+ * still read the old data, so it is copied instead of reallocated.
+ */
+static Id
+pool_ids2whatprovides_frozen(Pool *pool, Id *ids, int count)
+{
+  Offset off;
+  Id *data;
+  int extra;
+
+  pool_frozen_lock(pool);
+  if (pool->whatprovidesdataleft < count + 1)
+    {
+      extra = pool->whatprovidesdataoff / 2 + count + 4096;
+      data = solv_malloc2(pool->whatprovidesdataoff + extra, sizeof(Id));
+      memcpy(data, pool->whatprovidesdata, pool->whatprovidesdataoff * sizeof(Id));
+      pool_frozen_retire(pool, pool->whatprovidesdata);
+      FROZEN_PUBLISH(pool->whatprovidesdata, data);
+      pool->whatprovidesdataleft = extra;
+    }
+  off = pool->whatprovidesdataoff;
+  memcpy(pool->whatprovidesdata + off, ids, count * sizeof(Id));
+  pool->whatprovidesdata[off + count] = 0;
+  pool->whatprovidesdataoff += count + 1;
+  pool->whatprovidesdataleft -= count + 1;
+  FROZEN_RELEASE_FENCE();
+  pool_frozen_unlock(pool);
+  return (Id)off;
+}
+
 Id
 pool_ids2whatprovides(Pool *pool, Id *ids, int count)
 {
@@ -379,6 +430,8 @@ pool_ids2whatprovides(Pool *pool, Id *ids, int count)
     return 1;
   if (count == 1 && *ids == SYSTEMSOLVABLE)
     return 2;
+  if (pool->frozen)
+    return pool_ids2whatprovides_frozen(pool, ids, count);
 
   /* extend whatprovidesdata if needed, +1 for 0-termination */
   if (pool->whatprovidesdataleft < count + 1)
@@ -639,6 +692,328 @@ pool_match_flags_evr(Pool *pool, int pflags, Id pevr, int flags, int evr)
   return 0;
 }
 
+/*
+ * evr index
+ *
+ * for names with many providers, the "name = evr" provides are
+ * sorted by evr when the whatprovides data is created. The providers
+ * of a versioned dependency can then be found with a binary search
+ * instead of comparing every provider. Providers with other provides
+ * of the name are kept in a separate list and checked one by one.
+ *
+ * data layout:
+ *   whatprovides offset, nsorted, nother, nsorted * (evr, pos), nother * pos
+ * where pos is the index into the whatprovides list of the name.
+ */
+
+#define EVRINDEX_MINPROVIDERS	8
+
+static int
+evrindex_sortcmp(const void *ap, const void *bp, void *dp)
+{
+  Pool *pool = dp;
+  const Id *a = ap, *b = bp;
+  int r;
+  if (a[0] != b[0] && (r = pool_evrcmp(pool, a[0], b[0], EVRCMP_COMPARE)) != 0)
+    return r;
+  return a[1] - b[1];
+}
+
+static int
+evrindex_poscmp(const void *ap, const void *bp, void *dp)
+{
+  return *(const Id *)ap - *(const Id *)bp;
+}
+
+/* can the provide be put into the sorted part of the index? */
+static inline int
+evrindex_sortable(Pool *pool, Reldep *prd)
+{
+  const char *s, *rel;
+  if (prd->flags != REL_EQ || ISRELDEP(prd->evr))
+    return 0;
+  if (EVRCMP_DEPCMP != EVRCMP_MATCH_RELEASE)
+    return 1;
+  /* the evr must have a release, "= 1.0" provides match every release */
+  for (s = pool_id2str(pool, prd->evr), rel = 0; *s; s++)
+    if (*s == '-')
+      rel = s;
+  return rel && rel[1] ? 1 : 0;
+}
+
+static void
+pool_createwhatprovidesevr(Pool *pool)
+{
+  int num = pool->ss.nstrings;
+  Id name, p, pid, id, *pp, *pidp;
+  Offset off;
+  Queue sorted, other, data;
+  int i, n;
+
+  if (pool->disttype != DISTTYPE_RPM && pool->disttype != DISTTYPE_DEB)
+    return;
+  if (pool->promoteepoch || pool->havedistepoch)
+    return;		/* evr comparison is not a simple order */
+  queue_init(&sorted);
+  queue_init(&other);
+  queue_init(&data);
+  queue_push(&data, 0);	/* offset 0 means no index */
+  pool->whatprovidesevr = solv_calloc(num, sizeof(Offset));
+  pool->whatprovidesevroff = num;
+  for (name = 2; name < num; name++)
+    {
+      off = pool->whatprovides[name];
+      if (off < 2)
+	continue;
+      pp = pool->whatprovidesdata + off;
+      for (i = 0; pp[i]; i++)
+	;
+      if (i < EVRINDEX_MINPROVIDERS)
+	continue;
+      queue_empty(&sorted);
+      queue_empty(&other);
+      for (i = 0; (p = pp[i]) != 0; i++)
+	{
+	  Solvable *s = pool->solvables + p;
+	  n = sorted.count;
+	  if (!s->provides || s->arch == ARCH_SRC || s->arch == ARCH_NOSRC)
+	    {
+	      queue_push(&other, i);
+	      continue;
+	    }
+	  for (pidp = s->repo->idarraydata + s->provides; (pid = *pidp) != 0; pidp++)
+	    {
+	      Reldep *prd;
+	      for (id = pid; ISRELDEP(id); id = GETRELDEP(pool, id)->name)
+		;
+	      if (id != name)
+		continue;
+	      if (!ISRELDEP(pid))
+		break;		/* unversioned provides */
+	      prd = GETRELDEP(pool, pid);
+	      if (prd->name != name || !evrindex_sortable(pool, prd))
+		break;
+	      queue_push2(&sorted, prd->evr, i);
+	    }
+	  if (pid || sorted.count == n)
+	    {
+	      queue_truncate(&sorted, n);
+	      queue_push(&other, i);
+	    }
+	}
+      if (!sorted.count)
+	continue;
+      solv_sort(sorted.elements, sorted.count / 2, 2 * sizeof(Id), evrindex_sortcmp, pool);
+      pool->whatprovidesevr[name] = data.count;
+      queue_push(&data, off);
+      queue_push2(&data, sorted.count / 2, other.count);
+      queue_insertn(&data, data.count, sorted.count, sorted.elements);
+      queue_insertn(&data, data.count, other.count, other.elements);
+    }
+  pool->whatprovidesevrdata = solv_memdup2(data.elements, data.count, sizeof(Id));
+  pool->whatprovidesevrdataoff = data.count;
+  POOL_DEBUG(SOLV_DEBUG_STATS, "whatprovidesevr memory used: %d K\n", data.count / (int)(1024/sizeof(Id)));
+  queue_free(&data);
+  queue_free(&sorted);
+  queue_free(&other);
+}
+
+static inline int
+evrindex_cmp(Pool *pool, Id pevr, Id evr)
+{
+  int r;
+  if (pevr == evr)
+    return 0;
+  r = pool_evrcmp(pool, pevr, evr, EVRCMP_DEPCMP);
+  return r == 2 || r == -2 ? 0 : r;	/* missing release in dep, same version */
+}
+
+/* check a provider that is not in the sorted part of the index */
+static int
+evrindex_matchother(Pool *pool, Solvable *s, Id d)
+{
+  Reldep *rd = pool->rels + d, *prd;
+  Id pid, *pidp;
+
+  if (!s->provides || s->arch == ARCH_SRC || s->arch == ARCH_NOSRC)
+    return pool_match_nevr_rel(pool, s, MAKERELDEP(d));
+  for (pidp = s->repo->idarraydata + s->provides; (pid = *pidp) != 0; pidp++)
+    {
+      if (!ISRELDEP(pid))
+	{
+	  if (pid == rd->name && pool->disttype != DISTTYPE_DEB)
+	    return 1;
+	  continue;
+	}
+      prd = GETRELDEP(pool, pid);
+      if (prd->name == rd->name && pool_match_flags_evr(pool, prd->flags, prd->evr, rd->flags, rd->evr))
+	return 1;
+    }
+  return 0;
+}
+
+/*
+ * add the providers of versioned dependency d using the evr index.
+ * returns 0 if there is no usable index for the name.
+ */
+static int
+pool_addrelproviders_evrindex(Pool *pool, Id d, Id *pp, Queue *plist)
+{
+  Reldep *rd = pool->rels + d;
+  Id name = rd->name, evr = rd->evr, flags = rd->flags;
+  Id *idx, *ep;
+  int nsorted, nother, lo, hi, mid, eqstart, eqend, i;
+  Queue q;
+
+  if (ISRELDEP(name) || ISRELDEP(evr) || (Offset)name >= pool->whatprovidesevroff || !pool->whatprovidesevr[name])
+    return 0;
+  idx = pool->whatprovidesevrdata + pool->whatprovidesevr[name];
+  if ((Offset)idx[0] != pool->whatprovides[name])
+    return 0;		/* the providers were changed */
+  nsorted = idx[1];
+  nother = idx[2];
+  ep = idx + 3;
+  /* find the entries that compare equal to evr */
+  for (lo = 0, hi = nsorted; lo < hi; )
+    {
+      mid = (lo + hi) / 2;
+      if (evrindex_cmp(pool, ep[2 * mid], evr) < 0)
+	lo = mid + 1;
+      else
+	hi = mid;
+    }
+  eqstart = lo;
+  for (hi = nsorted; lo < hi; )
+    {
+      mid = (lo + hi) / 2;
+      if (evrindex_cmp(pool, ep[2 * mid], evr) <= 0)
+	lo = mid + 1;
+      else
+	hi = mid;
+    }
+  eqend = lo;
+  queue_init(&q);
+  for (i = 0; i < nsorted; i++)
+    if ((flags & (i < eqstart ? REL_LT : i < eqend ? REL_EQ : REL_GT)) != 0)
+      queue_push(&q, ep[2 * i + 1]);
+  for (ep += 2 * nsorted, i = 0; i < nother; i++)
+    if (evrindex_matchother(pool, pool->solvables + pp[ep[i]], d))
+      queue_push(&q, ep[i]);
+  /* keep the order of the whatprovides list */
+  if (q.count > 1)
+    solv_sort(q.elements, q.count, sizeof(Id), evrindex_poscmp, 0);
+  for (i = 0; i < q.count; i++)
+    if (!i || q.elements[i] != q.elements[i - 1])
+      queue_push(plist, pp[q.elements[i]]);
+  queue_free(&q);
+  return 1;
+}
+
+/*
+ * add the providers of a simple version comparison relation to plist.
+ * this only reads the pool if the providers of the name are already
+ * known, so it may be called from multiple threads.
+ */
+static void
+pool_addrelproviders_versioned(Pool *pool, Id d, Queue *plist)
+{
+  Reldep *rd = pool->rels + d;
+  Reldep *prd;
+  Id name = rd->name, evr = rd->evr, flags = rd->flags;
+  Id pid, *pidp;
+  Id p, *pp;
+  Id *ppaux = 0;
+  int eqmagic = 0;
+
+#if 0
+  POOL_DEBUG(SOLV_DEBUG_STATS, "addrelproviders: what provides %s?\n", pool_dep2str(pool, name));
+#endif
+  pp = pool_whatprovides_ptr(pool, name);
+  if (pool->whatprovidesevr && pool_addrelproviders_evrindex(pool, d, pp, plist))
+    pp = pool->whatprovidesdata + 1;	/* done, skip the scan */
+  if (!ISRELDEP(name) && (Offset)name < pool->whatprovidesauxoff)
+    ppaux = pool->whatprovidesaux[name] ? pool->whatprovidesauxdata + pool->whatprovidesaux[name] : 0;
+  while (ISRELDEP(name))
+    {
+      rd = GETRELDEP(pool, name);
+      name = rd->name;
+    }
+  while ((p = *pp++) != 0)
+    {
+      Solvable *s = pool->solvables + p;
+      if (ppaux)
+	{
+	  pid = *ppaux++;	/* the id that provided the name, 1 if there are multiple providers */
+	  if (pid && pid != 1)
+	    {
+#if 0
+	      POOL_DEBUG(SOLV_DEBUG_STATS, "addrelproviders: aux hit %d %s\n", p, pool_dep2str(pool, pid));
+#endif
+	      if (!ISRELDEP(pid))
+		{
+		  if (pid != name)
+		    continue;		/* wrong provides name (should not happen) */
+		  if (pool->disttype == DISTTYPE_DEB)
+		    continue;		/* unversioned provides can never match versioned deps */
+		}
+	      else
+		{
+		  prd = GETRELDEP(pool, pid);
+		  if (prd->name != name)
+		    continue;		/* wrong provides name */
+		  if (!eqmagic)
+		    eqmagic = rpmeqmagic_init(pool, flags, evr);
+		  if (eqmagic > 0 && prd->flags == REL_EQ && !ISRELDEP(prd->evr) &&
+		      rpmeqmagic_cantmatch(pool, prd->flags, prd->evr, eqmagic))
+		    continue;
+		  /* right package, both deps are rels. check flags/evr */
+		  if (!pool_match_flags_evr(pool, prd->flags, prd->evr, flags, evr))
+		    continue;
+		}
+	      queue_push(plist, p);
+	      continue;
+	    }
+	}
+      if (!s->provides || s->arch == ARCH_SRC || s->arch == ARCH_NOSRC)
+	{
+	  /* no provides or src rpm - check nevr */
+	  if (pool_match_nevr_rel(pool, s, MAKERELDEP(d)))
+	    queue_push(plist, p);
+	  continue;
+	}
+      /* solvable p provides name in some rels */
+      if (!eqmagic)
+	eqmagic = rpmeqmagic_init(pool, flags, evr);
+      pidp = s->repo->idarraydata + s->provides;
+      while ((pid = *pidp++) != 0)
+	{
+	  if (!ISRELDEP(pid))
+	    {
+	      if (pid != name)
+		continue;		/* wrong provides name */
+	      if (pool->disttype == DISTTYPE_DEB)
+		continue;		/* unversioned provides can never match versioned deps */
+	      break;
+	    }
+	  prd = GETRELDEP(pool, pid);
+	  if (prd->name != name)
+	    continue;		/* wrong provides name */
+	  /* right package, both deps are rels. check flags/evr */
+	  if (eqmagic > 0 && prd->flags == REL_EQ && !ISRELDEP(prd->evr) &&
+	      rpmeqmagic_cantmatch(pool, prd->flags, prd->evr, eqmagic))
+	    continue;
+	  if (pool_match_flags_evr(pool, prd->flags, prd->evr, flags, evr))
+	    break;	/* matches */
+	}
+      if (!pid)
+	continue;	/* none of the providers matched */
+      queue_push(plist, p);
+    }
+  /* make our system solvable provide all unknown rpmlib() stuff */
+  if (plist->count == 0 && !strncmp(pool_id2str(pool, name), "rpmlib(", 7))
+    queue_push(plist, SYSTEMSOLVABLE);
+}
+
 /*
  * addrelproviders
  *
@@ -649,11 +1024,10 @@ pool_match_flags_evr(Pool *pool, int pflags, Id pevr, int flags, int evr)
  * E.g. if you ask for "whatrequires A" and package X contains
  * "Requires: A & B", you'll get "X" as an answer.
  */
-Id
-pool_addrelproviders(Pool *pool, Id d)
+static Id
+addrelproviders(Pool *pool, Id d)
 {
   Reldep *rd;
-  Reldep *prd;
   Queue plist;
   Id buf[16];
   Id name, evr, flags;
@@ -879,94 +1253,8 @@ pool_addrelproviders(Pool *pool, Id d)
     }
   else if (flags)
     {
-      Id *ppaux = 0;
-      int eqmagic = 0;
       /* simple version comparison relation */
-#if 0
-      POOL_DEBUG(SOLV_DEBUG_STATS, "addrelproviders: what provides %s?\n", pool_dep2str(pool, name));
-#endif
-      pp = pool_whatprovides_ptr(pool, name);
-      if (!ISRELDEP(name) && (Offset)name < pool->whatprovidesauxoff)
-	ppaux = pool->whatprovidesaux[name] ? pool->whatprovidesauxdata + pool->whatprovidesaux[name] : 0;
-      while (ISRELDEP(name))
-	{
-          rd = GETRELDEP(pool, name);
-	  name = rd->name;
-	}
-      while ((p = *pp++) != 0)
-	{
-	  Solvable *s = pool->solvables + p;
-	  if (ppaux)
-	    {
-	      pid = *ppaux++;	/* the id that provided the name, 1 if there are multiple providers */
-	      if (pid && pid != 1)
-		{
-#if 0
-	          POOL_DEBUG(SOLV_DEBUG_STATS, "addrelproviders: aux hit %d %s\n", p, pool_dep2str(pool, pid));
-#endif
-		  if (!ISRELDEP(pid))
-		    {
-		      if (pid != name)
-			continue;		/* wrong provides name (should not happen) */
-		      if (pool->disttype == DISTTYPE_DEB)
-			continue;		/* unversioned provides can never match versioned deps */
-		    }
-		  else
-		    {
-		      prd = GETRELDEP(pool, pid);
-		      if (prd->name != name)
-			continue;		/* wrong provides name */
-		      if (!eqmagic)
-			eqmagic = rpmeqmagic_init(pool, flags, evr);
-		      if (eqmagic > 0 && prd->flags == REL_EQ && !ISRELDEP(prd->evr) &&
-			  rpmeqmagic_cantmatch(pool, prd->flags, prd->evr, eqmagic))
-			continue;
-		      /* right package, both deps are rels. check flags/evr */
-		      if (!pool_match_flags_evr(pool, prd->flags, prd->evr, flags, evr))
-			continue;
-		    }
-		  queue_push(&plist, p);
-		  continue;
-		}
-	    }
-	  if (!s->provides || s->arch == ARCH_SRC || s->arch == ARCH_NOSRC)
-	    {
-	      /* no provides or src rpm - check nevr */
-	      if (pool_match_nevr_rel(pool, s, MAKERELDEP(d)))
-	        queue_push(&plist, p);
-	      continue;
-	    }
-	  /* solvable p provides name in some rels */
-	  if (!eqmagic)
-	    eqmagic = rpmeqmagic_init(pool, flags, evr);
-	  pidp = s->repo->idarraydata + s->provides;
-	  while ((pid = *pidp++) != 0)
-	    {
-	      if (!ISRELDEP(pid))
-		{
-		  if (pid != name)
-		    continue;		/* wrong provides name */
-		  if (pool->disttype == DISTTYPE_DEB)
-		    continue;		/* unversioned provides can never match versioned deps */
-		  break;
-		}
-	      prd = GETRELDEP(pool, pid);
-	      if (prd->name != name)
-		continue;		/* wrong provides name */
-	      /* right package, both deps are rels. check flags/evr */
-	      if (eqmagic > 0 && prd->flags == REL_EQ && !ISRELDEP(prd->evr) &&
-	          rpmeqmagic_cantmatch(pool, prd->flags, prd->evr, eqmagic))
-		continue;
-	      if (pool_match_flags_evr(pool, prd->flags, prd->evr, flags, evr))
-		break;	/* matches */
-	    }
-	  if (!pid)
-	    continue;	/* none of the providers matched */
-	  queue_push(&plist, p);
-	}
-      /* make our system solvable provide all unknown rpmlib() stuff */
-      if (plist.count == 0 && !strncmp(pool_id2str(pool, name), "rpmlib(", 7))
-	queue_push(&plist, SYSTEMSOLVABLE);
+      pool_addrelproviders_versioned(pool, d, &plist);
     }
   /* add providers to whatprovides */
 #if 0
@@ -978,6 +1266,127 @@ pool_addrelproviders(Pool *pool, Id d)
   return pool->whatprovides_rel[d];
 }
 
+Id
+pool_addrelproviders(Pool *pool, Id d)
+{
+  Id r;
+
+  if (!pool->frozen)
+    return addrelproviders(pool, d);
+  /* frozen pool: serialize the additions, somebody else may have
+   * added the providers in the meantime */
+  pool_frozen_lock(pool);
+  r = ISRELDEP(d) ? pool->whatprovides_rel[GETRELID(d)] : pool->whatprovides[d];
+  if (!r)
+    r = addrelproviders(pool, d);
+  pool_frozen_unlock(pool);
+  return r;
+}
+
+#define RELPROVIDERS_CHUNK 64
+
+struct relproviders_data {
+  Pool *pool;
+  Id *deps;
+  int ndeps;
+  Queue *results;
+};
+
+static void
+relproviders_task(void *vp, int task)
+{
+  struct relproviders_data *rpd = vp;
+  Queue *q = rpd->results + task;
+  Queue plist;
+  int i, end = (task + 1) * RELPROVIDERS_CHUNK;
+
+  queue_init(&plist);
+  for (i = task * RELPROVIDERS_CHUNK; i < end && i < rpd->ndeps; i++)
+    {
+      queue_empty(&plist);
+      pool_addrelproviders_versioned(rpd->pool, GETRELID(rpd->deps[i]), &plist);
+      queue_push(q, plist.count);
+      queue_insertn(q, q->count, plist.count, plist.elements);
+    }
+  queue_free(&plist);
+}
+
+/*
+ * make sure that the providers of the deps in q are known. The simple
+ * version comparison relations are matched in parallel using up to
+ * nthreads threads (0: one per cpu), everything else is looked up in
+ * the calling thread. The results of the tasks are added to the
+ * whatprovides data in task order, i.e. in the order the deps first
+ * appear in q. Thus the layout does not depend on the number of
+ * threads. Note that q is modified.
+ */
+void
+pool_addrelproviders_parallel(Pool *pool, Queue *q, int nthreads)
+{
+  struct relproviders_data rpd;
+  Queue restq;
+  Map seen;
+  int i, j, k, ntasks;
+  Id dep, *dp;
+  Reldep *rd;
+
+  if (!pool->whatprovides)
+    return;
+  queue_init(&restq);
+  map_init(&seen, pool->nrels);
+  /* plain ids first, the relations need the providers of the name */
+  for (i = j = 0; i < q->count; i++)
+    {
+      dep = q->elements[i];
+      if (!ISRELDEP(dep))
+	{
+	  if (!pool->whatprovides[dep])
+	    pool_addstdproviders(pool, dep);
+	  continue;
+	}
+      if (pool->whatprovides_rel[GETRELID(dep)] || MAPTST(&seen, GETRELID(dep)))
+	continue;
+      MAPSET(&seen, GETRELID(dep));
+      rd = GETRELDEP(pool, dep);
+      if (!rd->flags || rd->flags >= 8 || ISRELDEP(rd->name) || !pool->whatprovides[rd->name])
+	{
+	  queue_push(&restq, dep);
+	  continue;
+	}
+      q->elements[j++] = dep;
+    }
+  queue_truncate(q, j);
+  map_free(&seen);
+  if (q->count)
+    {
+      rpd.pool = pool;
+      rpd.deps = q->elements;
+      rpd.ndeps = q->count;
+      ntasks = (q->count + RELPROVIDERS_CHUNK - 1) / RELPROVIDERS_CHUNK;
+      rpd.results = solv_calloc(ntasks, sizeof(Queue));
+      for (i = 0; i < ntasks; i++)
+	queue_init(rpd.results + i);
+      solv_parallel(ntasks, nthreads, relproviders_task, &rpd);
+
+      /* now commit the results */
+      for (i = 0; i < ntasks; i++)
+	{
+	  dp = rpd.results[i].elements;
+	  for (j = i * RELPROVIDERS_CHUNK, k = 0; j < q->count && k < RELPROVIDERS_CHUNK; j++, k++)
+	    {
+	      int cnt = *dp++;
+	      pool->whatprovides_rel[GETRELID(q->elements[j])] = pool_ids2whatprovides(pool, dp, cnt);
+	      dp += cnt;
+	    }
+	  queue_free(rpd.results + i);
+	}
+      solv_free(rpd.results);
+    }
+  for (i = 0; i < restq.count; i++)
+    pool_whatprovides(pool, restq.elements[i]);
+  queue_free(&restq);
+}
+
 void
 pool_flush_namespaceproviders(Pool *pool, Id ns, Id evr)
 {
@@ -1007,6 +1416,7 @@ pool_set_whatprovides(Pool *pool, Id id, Id providers)
   Reldep *rd;
   Map m;
 
+  pool->generation++;
   /* set new entry */
   if (ISRELDEP(id))
     {
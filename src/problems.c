@@ -242,7 +242,7 @@ solver_autouninstall(Solver *solv, int start)
   int lastfeature = 0, lastupdate = 0;
   Id v;
   Id extraflags = -1;
-  Map *m = 0;
+  Sparsemap *m = 0;
 
   if (!solv->allowuninstall && !solv->allowuninstall_all)
     {
@@ -259,7 +259,7 @@ solver_autouninstall(Solver *solv, int start)
 	{
 	  Rule *r;
 	  Id p = solv->installed->start + (v - solv->updaterules);
-	  if (m && !MAPTST(m, v - solv->updaterules))
+	  if (m && !SPARSEMAPTST(m, v - solv->updaterules))
 	    continue;
 #ifdef SUSE
 	  if (suse_isptf(pool, pool->solvables + p))
@@ -381,6 +381,7 @@ refine_suggestion(Solver *solv, Id *problem, Id sug, Queue *refined, int essenti
   Id v;
   Queue disabled;
   int disabledcnt;
+  Arenamark mark;
 
   IF_POOLDEBUG (SOLV_DEBUG_SOLUTIONS)
     {
@@ -421,7 +422,8 @@ refine_suggestion(Solver *solv, Id *problem, Id sug, Queue *refined, int essenti
   enableweakrules(solv);
 
   /* disabled contains all of the rules we disabled in the refinement process */
-  queue_init(&disabled);
+  mark = arena_mark(&solv->arena);
+  arena_queue_init(&solv->arena, &disabled, 32);
   for (;;)
     {
       int nother, nfeature, nupdate, pass;
@@ -537,6 +539,7 @@ refine_suggestion(Solver *solv, Id *problem, Id sug, Queue *refined, int essenti
   for (i = 0; i < disabled.count; i++)
     solver_enableproblem(solv, disabled.elements[i]);
   queue_free(&disabled);
+  arena_release(&solv->arena, mark);
 
   /* reset policy rules */
   for (i = 0; problem[i]; i++)
@@ -798,9 +801,10 @@ create_solutions(Solver *solv, int probnr, int solidx)
   unsigned int now;
   int oldmistakes = solv->cleandeps_mistakes ? solv->cleandeps_mistakes->count : 0;
   Id extraflags = -1;
+  Arenamark mark = arena_mark(&solv->arena);
 
   now = solv_timems(0);
-  queue_init(&redoq);
+  arena_queue_init(&solv->arena, &redoq, 3 * solv->decisionq.count);
   /* save decisionq, decisionq_why, decisionmap, and decisioncnt */
   for (i = 0; i < solv->decisionq.count; i++)
     {
@@ -823,7 +827,7 @@ create_solutions(Solver *solv, int probnr, int solidx)
   memset(&solv->decisionq_reason, 0, sizeof(solv->decisionq_reason));
 
   /* extract problem from queue */
-  queue_init(&problem);
+  arena_queue_init(&solv->arena, &problem, 16);
   for (i = solidx + 1; i < solv->solutions.count; i++)
     {
       Id v = solv->solutions.elements[i];
@@ -847,7 +851,7 @@ create_solutions(Solver *solv, int probnr, int solidx)
   /* refine each solution element */
   nsol = 0;
   essentialok = 0;
-  queue_init(&solution);
+  arena_queue_init(&solv->arena, &solution, 16);
   for (i = 0; i < problem.count; i++)
     {
       int solstart = solv->solutions.count;
@@ -909,6 +913,7 @@ create_solutions(Solver *solv, int probnr, int solidx)
       solv->decisionmap[p > 0 ? p : -p] = redoq.elements[i + 2];
     }
   queue_free(&redoq);
+  arena_release(&solv->arena, mark);
 
   /* restore decision reasons */
   queue_free(&solv->decisionq_reason);
@@ -1283,10 +1288,11 @@ solver_findproblemrule(Solver *solv, Id problem)
   Id reqr, conr, sysr, jobr, blkr, srpr;
   Id idx = solv->problems.elements[2 * problem - 2];
   Map rseen;
+  Arenamark mark = arena_mark(&solv->arena);
   reqr = conr = sysr = jobr = blkr = srpr = 0;
-  map_init(&rseen, solv->learntrules ? solv->nrules - solv->learntrules : 0);
+  arena_map_init(&solv->arena, &rseen, solv->learntrules ? solv->nrules - solv->learntrules : 0);
   findproblemrule_internal(solv, idx, &reqr, &conr, &sysr, &jobr, &blkr, &srpr, &rseen);
-  map_free(&rseen);
+  arena_release(&solv->arena, mark);
   /* check if the request is about a not-installed package requiring a installed
    * package conflicting with the non-installed package. In that case return the conflict */
   if (reqr && conr && solv->installed && solv->rules[reqr].p < 0 && solv->rules[conr].p < 0 && solv->rules[conr].w2 < 0)
@@ -1357,10 +1363,11 @@ void
 solver_findallproblemrules(Solver *solv, Id problem, Queue *rules)
 {
   Map rseen;
+  Arenamark mark = arena_mark(&solv->arena);
   queue_empty(rules);
-  map_init(&rseen, solv->learntrules ? solv->nrules - solv->learntrules : 0);
+  arena_map_init(&solv->arena, &rseen, solv->learntrules ? solv->nrules - solv->learntrules : 0);
   findallproblemrules_internal(solv, solv->problems.elements[2 * problem - 2], rules, &rseen);
-  map_free(&rseen);
+  arena_release(&solv->arena, mark);
 }
 
 const char *
@@ -24,6 +24,7 @@
 #include "repo.h"
 #include "pool.h"
 #include "poolid_private.h"
+#include "pool_private.h"
 #include "util.h"
 #include "chksum.h"
 
@@ -70,6 +71,7 @@ repo_freedata(Repo *repo)
   solv_free(repo->idarraydata);
   solv_free(repo->rpmdbid);
   solv_free(repo->lastidhash);
+  solv_free(repo->solvcookie);
   solv_free((char *)repo->name);
   solv_free(repo);
 }
@@ -111,6 +113,8 @@ repo_empty(Repo *repo, int reuseids)
   solv_free(repo->repodata);
   repo->repodata = 0;
   repo->nrepodata = 0;
+  repo->solvcookie = solv_free(repo->solvcookie);
+  repo->solvcookielen = 0;
 }
 
 /*
@@ -935,8 +939,8 @@ repo_lookup_repodata(Repo *repo, Id entry, Id keyname)
 
   if (entry == SOLVID_POS)
     {
-      Pool *pool = repo->pool;
-      return pool->pos.repo == repo && pool->pos.repodataid ? pool->pos.repo->repodata + pool->pos.repodataid : 0;
+      Datapos *pos = pool_datapos(repo->pool);
+      return pos->repo == repo && pos->repodataid ? pos->repo->repodata + pos->repodataid : 0;
     }
   for (rdid = repo->nrepodata - 1, data = repo->repodata + rdid; rdid > 0; rdid--, data--)
     {
@@ -960,8 +964,8 @@ repo_lookup_repodata_opt(Repo *repo, Id entry, Id keyname)
 
   if (entry == SOLVID_POS)
     {
-      Pool *pool = repo->pool;
-      return pool->pos.repo == repo && pool->pos.repodataid ? pool->pos.repo->repodata + pool->pos.repodataid : 0;
+      Datapos *pos = pool_datapos(repo->pool);
+      return pos->repo == repo && pos->repodataid ? pos->repo->repodata + pos->repodataid : 0;
     }
   for (rdid = repo->nrepodata - 1, data = repo->repodata + rdid; rdid > 0; rdid--, data--)
     {
@@ -1644,3 +1648,22 @@ repo_disable_paging(Repo *repo)
     repodata_disable_paging(data);
 }
 
+/* add the memory used by the repo and its repodata to the stats */
+void
+repo_memstats(Repo *repo, Pool_memstats *stats)
+{
+  size_t size;
+  int i;
+  Repodata *data;
+
+  size = repo->nsolvables * sizeof(Solvable) + repo->idarraysize * sizeof(Id);
+  if (repo->rpmdbid)
+    size += (repo->end - repo->start) * sizeof(Id);
+  if (repo->lastidhash)
+    size += ((size_t)repo->lastidhash_mask + 1) * sizeof(Id);
+  stats->solvables += size;
+  stats->total += size;
+  FOR_REPODATAS(repo, i, data)
+    repodata_memstats(data, stats);
+}
+
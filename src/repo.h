@@ -55,6 +55,9 @@ struct s_Repo {
   int lastidhash_idarraysize;
   int lastmarker;
   Offset lastmarkerpos;
+
+  unsigned char *solvcookie;	/* userdata of the last loaded solv file */
+  int solvcookielen;
 #endif /* LIBSOLV_INTERNAL */
 };
 
@@ -205,6 +208,7 @@ void repo_unset(Repo *repo, Id p, Id keyname);
 
 void repo_internalize(Repo *repo);
 void repo_disable_paging(Repo *repo);
+void repo_memstats(Repo *repo, Pool_memstats *stats);
 Id *repo_create_keyskip(Repo *repo, Id entry, Id **oldkeyskip);
 
 
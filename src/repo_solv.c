@@ -240,6 +240,46 @@ read_idarray_block(Repodata *data, Id *block, int size)
     data->error = pool_error(data->repo->pool, SOLV_ERROR_EOF, "idarray size overrun in block decompression");
 }
 
+/*******************************************************************************
+ * functions for mmap()ed solv files
+ */
+
+/*
+ * return a pointer to the next len bytes of the file in the mapping
+ * and skip over them in the stream
+ */
+static unsigned char *
+mapped_data(Repodata *data, size_t len)
+{
+  Repopagestore *store = &data->store;
+  long pos;
+
+  if (!store->mapping || data->error || (pos = ftell(data->fp)) < 0)
+    return 0;
+  if ((size_t)pos > store->mappingsize || store->mappingsize - pos < len)
+    return 0;
+  if (fseek(data->fp, (long)len, SEEK_CUR) != 0)
+    return 0;
+  return store->mapping + pos;
+}
+
+/*
+ * the data_read functions rely on a zero byte after the data to stop
+ * on corrupt input. We can only parse the incore data directly from
+ * the mapping if the zero filled rest of the last memory page provides
+ * such a guard.
+ */
+static int
+mapping_has_zero_tail(Repodata *data)
+{
+  size_t pgsz = (size_t)sysconf(_SC_PAGESIZE);
+  size_t tail;
+  if (!data->store.mapping || (long)pgsz <= 0)
+    return 0;
+  tail = pgsz - data->store.mappingsize % pgsz;
+  return tail != pgsz && tail >= 128;
+}
+
 /*******************************************************************************
  * functions to extract data from memory
  */
@@ -533,12 +573,50 @@ incore_add_u8(Repodata *data, unsigned int x)
  * our main function
  */
 
+/* userdata and delta header of a solv file */
+struct solvheader {
+  unsigned char *userdata;
+  unsigned int userdatalen;
+  Id *removed;			/* positions of the solvables removed by a delta */
+  unsigned int nremoved;
+};
+
+/* a solv file that was loaded in advance into a private pool */
+struct solvstage {
+  FILE *fp;
+  long start;			/* file offset of the solv file */
+  int flags;
+  Pool *pool;			/* private pool, zero if not staged */
+  Repo *repo;
+  int nparts;			/* number of loaded solv files, i.e. applied deltas + 1 */
+  Hashval *strhashes;		/* hashes of the new strings, indexed by id - ID_NUM_INTERNAL + 1 */
+  int memhashes;		/* use memhash() instead of strhash() */
+};
+
+/* make room for new ids/rels in the whatprovide arrays */
+static void
+extend_whatprovides(Pool *pool, int oldnstrings, int oldnrels)
+{
+  if (pool->whatprovides && oldnstrings != pool->ss.nstrings)
+    {
+      int newlen = (pool->ss.nstrings + WHATPROVIDES_BLOCK) & ~WHATPROVIDES_BLOCK;
+      pool->whatprovides = solv_realloc2(pool->whatprovides, newlen, sizeof(Offset));
+      memset(pool->whatprovides + oldnstrings, 0, (newlen - oldnstrings) * sizeof(Offset));
+    }
+  if (pool->whatprovides_rel && oldnrels != pool->nrels)
+    {
+      int newlen = (pool->nrels + WHATPROVIDES_BLOCK) & ~WHATPROVIDES_BLOCK;
+      pool->whatprovides_rel = solv_realloc2(pool->whatprovides_rel, newlen, sizeof(Offset));
+      memset(pool->whatprovides_rel + oldnrels, 0, (newlen - oldnrels) * sizeof(Offset));
+    }
+}
+
 /*
  * read repo from .solv file and add it to pool
  */
 
-int
-repo_add_solv(Repo *repo, FILE *fp, int flags)
+static int
+repo_add_solv_one(Repo *repo, FILE *fp, int flags, struct solvheader *sh)
 {
   Pool *pool = repo->pool;
   int i, l;
@@ -567,6 +645,7 @@ repo_add_solv(Repo *repo, FILE *fp, int flags)
   int have_incoredata;
   int maxsize, allsize;
   unsigned char *buf, *bufend, *dp, *dps;
+  int mapped;
   Id stack[3 * 5];
   int keydepth;
   int needchunk;	/* need a new chunk of data */
@@ -605,6 +684,7 @@ repo_add_solv(Repo *repo, FILE *fp, int flags)
   data.repo = repo;
   data.fp = fp;
   repopagestore_init(&data.store);
+  data.store.cache = pool->pagecache;
 
   if (read_u32(&data) != ('S' << 24 | 'O' << 16 | 'L' << 8 | 'V'))
      return pool_error(pool, SOLV_ERROR_NOT_SOLV, "not a SOLV file");
@@ -613,6 +693,7 @@ repo_add_solv(Repo *repo, FILE *fp, int flags)
     {
       case SOLV_VERSION_8:
       case SOLV_VERSION_9:
+      case SOLV_VERSION_10:
 	break;
       default:
         return pool_error(pool, SOLV_ERROR_UNSUPPORTED, "unsupported SOLV version");
@@ -643,24 +724,65 @@ repo_add_solv(Repo *repo, FILE *fp, int flags)
     return pool_error(pool, SOLV_ERROR_CORRUPT, "relations are forbidden in a local pool");
   if ((flags & REPO_EXTEND_SOLVABLES) && numsolv)
     {
-      /* make sure that we exactly replace the stub repodata */
-      if (extendend - extendstart != numsolv)
-	return pool_error(pool, SOLV_ERROR_CORRUPT, "sub-repository solvable number does not match main repository (%d - %d)", extendend - extendstart, numsolv);
-      for (i = 0; i < numsolv; i++)
-	if (pool->solvables[extendstart + i].repo != repo)
-	  return pool_error(pool, SOLV_ERROR_CORRUPT, "main repository contains holes, cannot extend");
+      /* make sure that we exactly replace the stub repodata. The main
+       * repository may contain holes, e.g. after a delta removed some
+       * solvables. They are skipped like the writer skipped them. */
+      for (i = extendstart, l = 0; i < extendend; i++)
+	if (pool->solvables[i].repo == repo)
+	  l++;
+      if (l != numsolv)
+	return pool_error(pool, SOLV_ERROR_CORRUPT, "sub-repository solvable number does not match main repository (%d - %d)", l, numsolv);
     }
 
-  /*******  Part 0: skip optional userdata ******************************/
+  /*******  Part 0: optional userdata and delta header ****************/
 
   if (solvflags & SOLV_FLAG_USERDATA)
     {
       unsigned int userdatalen = read_u32(&data);
       if (userdatalen >= 65536)
         return pool_error(pool, SOLV_ERROR_CORRUPT, "illegal userdata length");
-      while (userdatalen--)
-	if (getc(data.fp) == EOF)
+      sh->userdata = solv_malloc(userdatalen + 1);
+      sh->userdatalen = userdatalen;
+      if (userdatalen && fread(sh->userdata, userdatalen, 1, data.fp) != 1)
+	return pool_error(pool, SOLV_ERROR_EOF, "unexpected EOF");
+    }
+
+  if (solvflags & SOLV_FLAG_DELTA)
+    {
+      unsigned int basecookielen, nremoved, pos;
+      unsigned char *basecookie;
+      if ((flags & REPO_EXTEND_SOLVABLES) != 0)
+	return pool_error(pool, SOLV_ERROR_UNSUPPORTED, "cannot extend solvables with a delta");
+      basecookielen = read_u32(&data);
+      if (basecookielen >= 65536)
+        return pool_error(pool, SOLV_ERROR_CORRUPT, "illegal delta base cookie length");
+      basecookie = solv_malloc(basecookielen + 1);
+      if (basecookielen && fread(basecookie, basecookielen, 1, data.fp) != 1)
+	{
+	  solv_free(basecookie);
 	  return pool_error(pool, SOLV_ERROR_EOF, "unexpected EOF");
+	}
+      /* a delta without base cookie could be applied to anything */
+      if (!basecookielen || basecookielen != repo->solvcookielen || memcmp(basecookie, repo->solvcookie, basecookielen) != 0)
+	{
+	  solv_free(basecookie);
+	  return pool_error(pool, SOLV_ERROR_CORRUPT, "delta does not match the repository");
+	}
+      solv_free(basecookie);
+      nremoved = read_u32(&data);
+      if (nremoved > (unsigned int)repo->nsolvables)
+	return pool_error(pool, SOLV_ERROR_CORRUPT, "delta removes too many solvables");
+      sh->removed = solv_calloc(nremoved + 1, sizeof(Id));
+      for (i = 0; i < (int)nremoved; i++)
+	{
+	  pos = read_u32(&data);
+	  if (pos >= (unsigned int)repo->nsolvables || (i && pos <= (unsigned int)sh->removed[i - 1]))
+	    return pool_error(pool, SOLV_ERROR_CORRUPT, "bad removed solvable in delta");
+	  sh->removed[i] = pos;
+	}
+      sh->nremoved = nremoved;
+      if (data.error)
+	return data.error;
     }
 
   /*******  Part 1: string IDs  *****************************************/
@@ -705,10 +827,16 @@ repo_add_solv(Repo *repo, FILE *fp, int flags)
    * read string data and append to old string space
    */
 
+  if ((flags & SOLV_ADD_MMAP) != 0)
+    repopagestore_mmap(&data.store, fp);
+
   strsp = spool->stringspace + spool->sstrings;	/* append new entries */
   if ((solvflags & SOLV_FLAG_PREFIX_POOL) == 0)
     {
-      if (sizeid && fread(strsp, sizeid, 1, fp) != 1)
+      unsigned char *mp = sizeid ? mapped_data(&data, sizeid) : 0;
+      if (mp)
+	memcpy(strsp, mp, sizeid);
+      else if (sizeid && fread(strsp, sizeid, 1, fp) != 1)
 	{
 	  repodata_freedata(&data);
 	  return pool_error(pool, SOLV_ERROR_EOF, "read error while reading strings");
@@ -787,7 +915,7 @@ repo_add_solv(Repo *repo, FILE *fp, int flags)
       /* alloc id map for name and rel Ids. this maps ids in the solv file
        * to the ids in our pool */
       idmap = solv_calloc(numid + numrel, sizeof(Id));
-      if (!stringpool_integrate(spool, numid, sizeid, idmap))
+      if (!stringpool_integrate(spool, numid, sizeid, idmap, 0, &pool->sshashes))
 	{
 	  solv_free(idmap);
 	  repodata_freedata(&data);
@@ -853,20 +981,7 @@ repo_add_solv(Repo *repo, FILE *fp, int flags)
 
   /* if we added ids/rels, make room in our whatprovide arrays */
   if (!(flags & REPO_LOCALPOOL))
-    {
-      if (pool->whatprovides && oldnstrings != pool->ss.nstrings)
-	{
-	  int newlen = (pool->ss.nstrings + WHATPROVIDES_BLOCK) & ~WHATPROVIDES_BLOCK;
-	  pool->whatprovides = solv_realloc2(pool->whatprovides, newlen, sizeof(Offset));
-	  memset(pool->whatprovides + oldnstrings, 0, (newlen - oldnstrings) * sizeof(Offset));
-	}
-      if (pool->whatprovides_rel && oldnrels != pool->nrels)
-	{
-	  int newlen = (pool->nrels + WHATPROVIDES_BLOCK) & ~WHATPROVIDES_BLOCK;
-	  pool->whatprovides_rel = solv_realloc2(pool->whatprovides_rel, newlen, sizeof(Offset));
-	  memset(pool->whatprovides_rel + oldnrels, 0, (newlen - oldnrels) * sizeof(Offset));
-	}
-    }
+    extend_whatprovides(pool, oldnstrings, oldnrels);
 
   /*******  Part 3: Dirs  ***********************************************/
   if (numdir)
@@ -926,13 +1041,15 @@ repo_add_solv(Repo *repo, FILE *fp, int flags)
       key->size = read_id(&data, type == REPOKEY_TYPE_CONSTANTID ? numid + numrel : 0);
       key->storage = read_id(&data, 0);
       /* old versions used SOLVABLE for main solvable data */
-      if (key->storage != KEY_STORAGE_INCORE && key->storage != KEY_STORAGE_VERTICAL_OFFSET && key->storage != KEY_STORAGE_SOLVABLE && key->storage != KEY_STORAGE_IDARRAYBLOCK)
+      if (key->storage != KEY_STORAGE_INCORE && key->storage != KEY_STORAGE_VERTICAL_OFFSET && key->storage != KEY_STORAGE_SOLVABLE && key->storage != KEY_STORAGE_IDARRAYBLOCK && key->storage != KEY_STORAGE_COLUMN)
 	data.error = pool_error(pool, SOLV_ERROR_UNSUPPORTED, "unsupported storage type %d", key->storage);
       /* change KEY_STORAGE_SOLVABLE to KEY_STORAGE_INCORE */
       if (key->storage == KEY_STORAGE_SOLVABLE)
 	key->storage = KEY_STORAGE_INCORE;
       if (key->storage == KEY_STORAGE_IDARRAYBLOCK && type != REPOKEY_TYPE_IDARRAY)
 	data.error = pool_error(pool, SOLV_ERROR_UNSUPPORTED, "typr %d does not support idarrayblock storage\n", type);
+      if (key->storage == KEY_STORAGE_COLUMN && type != REPOKEY_TYPE_NUM)
+	data.error = pool_error(pool, SOLV_ERROR_UNSUPPORTED, "type %d does not support column storage\n", type);
       if (id >= SOLVABLE_NAME && id <= RPM_RPMDBID)
 	{
 	  /* we will put those directly into the storable */
@@ -1022,7 +1139,13 @@ repo_add_solv(Repo *repo, FILE *fp, int flags)
   if (maxsize > allsize)
     maxsize = allsize;
 
-  buf = solv_calloc(maxsize + DATA_READ_CHUNK + 4, 1);	/* 4 extra bytes to detect overflows */
+  /* parse straight from the mapping if possible */
+  buf = 0;
+  mapped = 0;
+  if (allsize && mapping_has_zero_tail(&data) && (buf = mapped_data(&data, allsize)) != 0)
+    mapped = 1;
+  else
+    buf = solv_calloc(maxsize + DATA_READ_CHUNK + 4, 1);	/* 4 extra bytes to detect overflows */
   bufend = buf;
   dp = buf;
 
@@ -1031,7 +1154,13 @@ repo_add_solv(Repo *repo, FILE *fp, int flags)
     l = DATA_READ_CHUNK;
   if (l > allsize)
     l = allsize;
-  if (!l || fread(buf, l, 1, data.fp) != 1)
+  if (mapped)
+    {
+      bufend = buf + allsize;	/* everything is already there */
+      allsize = 0;
+      dp = data_read_id_max(dp, &id, 0, numschemata, &data);
+    }
+  else if (!l || fread(buf, l, 1, data.fp) != 1)
     {
       if (!data.error)
         data.error = pool_error(pool, SOLV_ERROR_EOF, "unexpected EOF");
@@ -1071,7 +1200,7 @@ repo_add_solv(Repo *repo, FILE *fp, int flags)
               data.error = pool_error(pool, SOLV_ERROR_EOF, "buffer overrun");
 	      break;
 	    }
-	  if (left < maxsize)
+	  if (left < maxsize && !mapped)
 	    {
 	      if (left)
 		memmove(buf, dp, left);
@@ -1095,6 +1224,12 @@ repo_add_solv(Repo *repo, FILE *fp, int flags)
 	  needchunk = 0;
 	}
 
+      if (mapped && dp > bufend)
+	{
+	  /* there is no chunk buffer that catches overruns */
+	  data.error = pool_error(pool, SOLV_ERROR_EOF, "buffer overrun");
+	  break;
+	}
       key = *keyp++;
 #if 0
 printf("key %d at %d\n", key, (int)(keyp - 1 - schemadata));
@@ -1107,7 +1242,8 @@ printf("key %d at %d\n", key, (int)(keyp - 1 - schemadata));
 	    {
 	      if (s && keydepth == 3)
 		{
-		  s++;	/* next solvable */
+		  while ((++s)->repo != repo)
+		    ;	/* next solvable, skip holes */
 	          if (have_incoredata)
 		    data.incoreoffset[(s - pool->solvables) - data.start] = data.incoredatalen;
 		}
@@ -1203,6 +1339,12 @@ printf("=> %s %s %p\n", pool_id2str(pool, keys[key].name), pool_id2str(pool, key
 		  break;
 		}
 	      ido = idarraydatap - repo->idarraydata;
+	      if (mapped && data_skip(dp, REPOKEY_TYPE_IDARRAY) - dp > maxsize)
+		{
+		  /* we reserved maxsize extra ids, make sure we do not write past them */
+		  data.error = pool_error(pool, SOLV_ERROR_OVERFLOW, "idarray overflow");
+		  break;
+		}
 	      if (keys[key].type == REPOKEY_TYPE_IDARRAY)
 		dp = data_read_idarray(dp, &idarraydatap, idmap, numid + numrel, &data);
 	      else
@@ -1270,12 +1412,22 @@ printf("=> %s %s %p\n", pool_id2str(pool, keys[key].name), pool_id2str(pool, key
 		  break;
 		}
 	      if ((flags & REPO_EXTEND_SOLVABLES) != 0)
-		s = pool_id2solvable(pool, extendstart);
+		{
+		  data.start = extendstart;
+		  data.end = extendend;
+		  for (s = pool_id2solvable(pool, extendstart); s->repo != repo; s++)
+		    ;	/* skip holes */
+		}
 	      else
-		s = pool_id2solvable(pool, repo_add_solvable_block(repo, numsolv));
-	      data.start = s - pool->solvables;
-	      data.end = data.start + numsolv;
-	      repodata_extend_block(&data, data.start, numsolv);
+		{
+		  s = pool_id2solvable(pool, repo_add_solvable_block(repo, numsolv));
+		  data.start = s - pool->solvables;
+		  data.end = data.start + numsolv;
+		}
+	      repodata_extend_block(&data, data.start, data.end - data.start);
+	      for (i = 1; i < numkeys; i++)
+		if (keys[i].storage == KEY_STORAGE_COLUMN)
+		  repodata_resize_column(repodata_new_column(&data, i), data.start, data.end);
 	      for (i = 1; i < numkeys; i++)
 		{
 		  id = keys[i].name;
@@ -1321,10 +1473,32 @@ printf("=> %s %s %p\n", pool_id2str(pool, keys[key].name), pool_id2str(pool, key
 	      repo->rpmdbid[(s - pool->solvables) - repo->start] = id;
 	      break;
 	    }
+	  if (keys[key].storage == KEY_STORAGE_COLUMN)
+	    {
+	      dps = dp;
+	      dp = data_skip(dp, REPOKEY_TYPE_NUM);
+	      if (mapped && dp > bufend)
+		break;	/* caught at the top of the loop */
+	      incore_add_blob(&data, dps, dp - dps);
+	      if (s && keydepth == 3)
+		{
+		  /* also put the value into the column */
+		  Repodata_column *col = data.columns;
+		  unsigned int high, low;
+		  while (col->key != key)
+		    col++;
+		  data_read_num64(dps, &low, &high);
+		  col->values[(s - pool->solvables) - col->start] = (unsigned long long)high << 32 | low;
+		  MAPSET(&col->present, (s - pool->solvables) - col->start);
+		}
+	      break;
+	    }
 	  /* FALLTHROUGH */
 	default:
 	  dps = dp;
 	  dp = data_skip(dp, keys[key].type);
+	  if (mapped && dp > bufend)
+	    break;	/* caught at the top of the loop */
 	  if (keys[key].storage == KEY_STORAGE_INCORE)
 	    incore_add_blob(&data, dps, dp - dps);
 	  break;
@@ -1341,7 +1515,8 @@ printf("=> %s %s %p\n", pool_id2str(pool, keys[key].name), pool_id2str(pool, key
       else if (idarray_block_offset != idarray_block_end)
 	data.error = pool_error(pool, SOLV_ERROR_EOF, "unconsumed idarray block entries");
     }
-  solv_free(buf);
+  if (!mapped)
+    solv_free(buf);
 
   if (data.error)
     {
@@ -1367,7 +1542,7 @@ printf("=> %s %s %p\n", pool_id2str(pool, keys[key].name), pool_id2str(pool, key
     {
       if (keys[i].type == REPOKEY_TYPE_REL_IDARRAY)
         keys[i].type = REPOKEY_TYPE_IDARRAY;
-      if (keys[i].storage == KEY_STORAGE_IDARRAYBLOCK)
+      if (keys[i].storage == KEY_STORAGE_IDARRAYBLOCK || keys[i].storage == KEY_STORAGE_COLUMN)
         keys[i].storage = KEY_STORAGE_INCORE;
       if (keys[i].name >= SOLVABLE_NAME && keys[i].name <= RPM_RPMDBID)
         keys[i].storage = KEY_STORAGE_SOLVABLE;
@@ -1394,13 +1569,21 @@ printf("=> %s %s %p\n", pool_id2str(pool, keys[key].name), pool_id2str(pool, key
       if (!data.error)
 	{
 	  data.error = repopagestore_read_or_setup_pages(&data.store, data.fp, pagesize, fileoffset);
+	  /* a mapped store does not read the pages, skip them so that we
+	   * can look for appended deltas */
+	  if (!data.error && data.store.mapping && (flags & SOLV_ADD_DELTAS) != 0)
+	    data.error = repopagestore_skip_pages(&data.store, data.fp);
 	  if (data.error == SOLV_ERROR_EOF)
 	    pool_error(pool, data.error, "repopagestore setup: unexpected EOF");
+	  else if (data.error == SOLV_ERROR_UNSUPPORTED)
+	    pool_error(pool, data.error, "unsupported page compression");
 	  else if (data.error)
 	    pool_error(pool, data.error, "repopagestore setup failed");
 	}
     }
   data.fp = 0; /* no longer needed */
+  if (!data.store.num_pages)
+    repopagestore_munmap(&data.store);	/* only the page store uses the mapping */
 
   if (data.error)
     {
@@ -1458,6 +1641,351 @@ printf("=> %s %s %p\n", pool_id2str(pool, keys[key].name), pool_id2str(pool, key
   return 0;
 }
 
+/* check if a delta file follows in the stream */
+static int
+have_appended_delta(FILE *fp)
+{
+  unsigned char d[4 * 9];
+  long pos;
+  int c, r = 0;
+
+  if ((c = getc(fp)) == EOF)
+    return 0;
+  ungetc(c, fp);
+  if ((pos = ftell(fp)) < 0)
+    return 0;
+  if (fread(d, sizeof(d), 1, fp) == 1)
+    r = d[0] == 'S' && d[1] == 'O' && d[2] == 'L' && d[3] == 'V' && (d[35] & SOLV_FLAG_DELTA) != 0;
+  if (fseek(fp, pos, SEEK_SET) != 0)
+    return 0;
+  return r;
+}
+
+/* remove the solvables of a delta. The solvables of the delta are
+ * added after the old ones, so the positions are not affected. The
+ * ids are not reused, so that the other solvables keep their ids.
+ * An extension of the repository skips the holes. */
+static void
+remove_delta_solvables(Repo *repo, Id *removed, int nremoved)
+{
+  Solvable *s;
+  Id p;
+  int i = 0, n = 0;
+
+  pool_freewhatprovides(repo->pool);
+  FOR_REPO_SOLVABLES(repo, p, s)
+    {
+      if (n == nremoved)
+	break;
+      if (i++ == removed[n])
+	{
+	  repo_free_solvable(repo, p, 0);
+	  n++;
+	}
+    }
+}
+
+/* add a solv file and the appended deltas. The number of loaded
+ * solv files is returned in npartsp */
+static int
+repo_add_solv_parts(Repo *repo, FILE *fp, int flags, int *npartsp)
+{
+  struct solvheader sh;
+  int ret;
+
+  for (;;)
+    {
+      memset(&sh, 0, sizeof(sh));
+      ret = repo_add_solv_one(repo, fp, flags, &sh);
+      if (!ret && npartsp)
+	(*npartsp)++;
+      if (!ret && (flags & (REPO_USE_LOADING | REPO_EXTEND_SOLVABLES)) == 0)
+	{
+	  if (sh.nremoved)
+	    remove_delta_solvables(repo, sh.removed, sh.nremoved);
+	  /* the userdata is the cookie of the new repository state */
+	  solv_free(repo->solvcookie);
+	  repo->solvcookie = sh.userdata;
+	  repo->solvcookielen = sh.userdatalen;
+	  sh.userdata = 0;
+	}
+      solv_free(sh.userdata);
+      solv_free(sh.removed);
+      if (ret || (flags & (REPO_USE_LOADING | REPO_EXTEND_SOLVABLES)) != 0 || (flags & SOLV_ADD_DELTAS) == 0 || !have_appended_delta(fp))
+	return ret;
+    }
+}
+
+/*
+ * read repo from .solv file and add it to pool. Delta files that are
+ * appended to the stream get applied, too, if SOLV_ADD_DELTAS is set.
+ */
+
+int
+repo_add_solv(Repo *repo, FILE *fp, int flags)
+{
+  return repo_add_solv_parts(repo, fp, flags, 0);
+}
+
+/*
+ * batch loading support: every file is loaded in parallel into a
+ * private pool, the ids are thus local to the file. The private pools
+ * are then merged one after the other into the pool of the repo, this
+ * maps the strings and rels and rewrites the ids of the solvables and
+ * the repodata. The result does not depend on the number of threads
+ * and is the same as if the files were added with repo_add_solv().
+ */
+
+static void
+stage_solv_task(void *vdata, int taskno)
+{
+  struct solvstage *stage = (struct solvstage *)vdata + taskno;
+  FILE *fp = stage->fp;
+  unsigned char d[4 * 9];
+  Pool *pool;
+  Repo *repo;
+  Stringpool *ss;
+  const char *sp;
+  int i, n;
+
+  if ((stage->start = ftell(fp)) < 0)
+    return;
+  /* a delta needs the state of the repo it gets applied to */
+  if (fread(d, sizeof(d), 1, fp) != 1 || (d[35] & SOLV_FLAG_DELTA) != 0)
+    {
+      fseek(fp, stage->start, SEEK_SET);
+      return;
+    }
+  if (fseek(fp, stage->start, SEEK_SET) != 0)
+    return;
+  pool = pool_create();
+  pool_setdebugmask(pool, 0);	/* errors get reported by the serial load */
+  repo = repo_create(pool, "");
+  if (repo_add_solv_parts(repo, fp, stage->flags, &stage->nparts) != 0)
+    {
+      pool_free(pool);
+      fseek(fp, stage->start, SEEK_SET);
+      return;
+    }
+  repo_internalize(repo);
+  /* also calculate the hashes that the pool of the repo needs */
+  ss = &pool->ss;
+  n = ss->nstrings - ID_NUM_INTERNAL;
+  stage->strhashes = solv_malloc2(n > 0 ? n + 1 : 1, sizeof(Hashval));
+  stage->strhashes[0] = 0;
+  for (i = 1; i <= n; i++)
+    {
+      sp = ss->stringspace + ss->strings[ID_NUM_INTERNAL - 1 + i];
+      stage->strhashes[i] = stage->memhashes ? memhash(sp, strlen(sp)) : strhash(sp);
+    }
+  stage->pool = pool;
+  stage->repo = repo;
+}
+
+/* move the staged solvables and repodata into the repo */
+static int
+merge_stage(Repo *repo, struct solvstage *stage)
+{
+  Pool *pool = repo->pool;
+  Pool *spool = stage->pool;
+  Repo *srepo = stage->repo;
+  Stringpool *ss = &spool->ss;
+  int oldnstrings = pool->ss.nstrings;
+  int oldnrels = pool->nrels;
+  Id *strmap, *relmap, p, idoff = 0;
+  Solvable *s, *ssolv;
+  Repodata *data, *sdata;
+  Reldep *rd;
+  int i, n, rdid, soff = 0;
+
+  /* the strings, the new ones follow the predefined ids */
+  strmap = solv_calloc(ss->nstrings, sizeof(Id));
+  for (i = 0; i < ID_NUM_INTERNAL; i++)
+    strmap[i] = i;
+  n = ss->nstrings - ID_NUM_INTERNAL;
+  if (n > 0)
+    {
+      Offset sizeid = ss->sstrings - ss->strings[ID_NUM_INTERNAL];
+      char *strsp;
+      stringpool_reserve(&pool->ss, n + 1, sizeid + 1);
+      strsp = pool->ss.stringspace + pool->ss.sstrings;
+      memcpy(strsp, ss->stringspace + ss->strings[ID_NUM_INTERNAL], sizeid);
+      strsp[sizeid] = 0;
+      if (!stringpool_integrate(&pool->ss, n + 1, sizeid, strmap + ID_NUM_INTERNAL - 1, !stage->memhashes == !pool->sshashes ? stage->strhashes : 0, &pool->sshashes))
+	{
+	  solv_free(strmap);
+	  return pool_error(pool, SOLV_ERROR_OVERFLOW, "not enough strings");
+	}
+    }
+
+  /* the rels, their parts always have lower ids */
+  relmap = solv_calloc(spool->nrels > 1 ? spool->nrels : 1, sizeof(Id));
+  if (spool->nrels > 1)
+    {
+      pool_resize_rels_hash(pool, spool->nrels - 1);
+      for (i = 1, rd = spool->rels + 1; i < spool->nrels; i++, rd++)
+	relmap[i] = pool_rel2id(pool, pool_compact_id(spool, strmap, relmap, rd->name, 1), pool_compact_id(spool, strmap, relmap, rd->evr, 1), rd->flags, 1);
+      pool_shrink_rels(pool);
+    }
+  extend_whatprovides(pool, oldnstrings, oldnrels);
+
+  /* the dependencies */
+  if (srepo->idarraysize > 1)
+    {
+      n = srepo->idarraysize - 1;
+      repo_reserve_ids(repo, 0, n);
+      idoff = repo->idarraysize - 1;
+      for (i = 1; i <= n; i++)
+	repo->idarraydata[repo->idarraysize++] = pool_compact_id(spool, strmap, relmap, srepo->idarraydata[i], 1);
+      repo->lastoff = 0;
+    }
+
+  /* the solvables. The private pool starts after the system solvable,
+   * the holes left by the deltas get freed like the deltas did */
+  n = spool->nsolvables - (SYSTEMSOLVABLE + 1);
+  if (n > 0)
+    {
+      p = repo_add_solvable_block(repo, n);
+      soff = p - (SYSTEMSOLVABLE + 1);
+      if (srepo->rpmdbid && !repo->rpmdbid)
+	repo->rpmdbid = repo_sidedata_create(repo, sizeof(Id));
+      for (i = SYSTEMSOLVABLE + 1, ssolv = spool->solvables + i; i < spool->nsolvables; i++, ssolv++)
+	{
+	  if (ssolv->repo != srepo)
+	    continue;
+	  s = pool->solvables + i + soff;
+	  s->name = pool_compact_id(spool, strmap, relmap, ssolv->name, 1);
+	  s->arch = pool_compact_id(spool, strmap, relmap, ssolv->arch, 1);
+	  s->evr = pool_compact_id(spool, strmap, relmap, ssolv->evr, 1);
+	  s->vendor = pool_compact_id(spool, strmap, relmap, ssolv->vendor, 1);
+	  s->provides = ssolv->provides ? ssolv->provides + idoff : 0;
+	  s->obsoletes = ssolv->obsoletes ? ssolv->obsoletes + idoff : 0;
+	  s->conflicts = ssolv->conflicts ? ssolv->conflicts + idoff : 0;
+	  s->requires = ssolv->requires ? ssolv->requires + idoff : 0;
+	  s->recommends = ssolv->recommends ? ssolv->recommends + idoff : 0;
+	  s->suggests = ssolv->suggests ? ssolv->suggests + idoff : 0;
+	  s->supplements = ssolv->supplements ? ssolv->supplements + idoff : 0;
+	  s->enhances = ssolv->enhances ? ssolv->enhances + idoff : 0;
+	  if (srepo->rpmdbid)
+	    repo->rpmdbid[i + soff - repo->start] = srepo->rpmdbid[i - srepo->start];
+	}
+      if (srepo->nsolvables != n)
+	{
+	  pool_freewhatprovides(pool);
+	  for (i = SYSTEMSOLVABLE + 1, ssolv = spool->solvables + i; i < spool->nsolvables; i++, ssolv++)
+	    if (ssolv->repo != srepo)
+	      repo_free_solvable(repo, i + soff, 0);
+	}
+    }
+
+  /* the repodata, the ids in the incore data get rewritten */
+  for (rdid = 1, sdata = srepo->repodata + rdid; rdid < srepo->nrepodata; rdid++, sdata++)
+    {
+      repodata_compact_ids(sdata, strmap, relmap, 1);
+      if (!repo->nrepodata)
+	{
+	  repo->nrepodata = 1;
+	  repo->repodata = solv_calloc(2, sizeof(*data));
+	}
+      else
+	repo->repodata = solv_realloc2(repo->repodata, repo->nrepodata + 1, sizeof(*data));
+      data = repo->repodata + repo->nrepodata;
+      *data = *sdata;
+      data->repodataid = repo->nrepodata++;
+      data->repo = repo;
+      repopagestore_set_cache(&data->store, pool->pagecache);
+      if (data->end > data->start)
+	{
+	  data->start += soff;
+	  data->end += soff;
+	  for (i = 0; i < data->ncolumns; i++)
+	    {
+	      data->columns[i].start += soff;
+	      data->columns[i].end += soff;
+	    }
+	}
+    }
+  srepo->nrepodata = 0;		/* now owned by the repo */
+
+  solv_free(repo->solvcookie);
+  repo->solvcookie = srepo->solvcookie;
+  repo->solvcookielen = srepo->solvcookielen;
+  srepo->solvcookie = 0;
+  solv_free(strmap);
+  solv_free(relmap);
+  return 0;
+}
+
+static int
+add_stage(Repo *repo, struct solvstage *stage)
+{
+  /* the delta positions count the solvables of the repo, so the
+   * private load only matches an empty repo */
+  if (stage->pool && stage->nparts > 1 && repo->nsolvables)
+    {
+      pool_free(stage->pool);
+      stage->pool = 0;
+    }
+  if (stage->pool)
+    return merge_stage(repo, stage);
+  if (stage->start >= 0 && fseek(stage->fp, stage->start, SEEK_SET) != 0)
+    return pool_error(repo->pool, SOLV_ERROR_EOF, "could not rewind the solv file");
+  return repo_add_solv_parts(repo, stage->fp, stage->flags, 0);
+}
+
+/*
+ * add multiple solv files to their repos. Returns the error of the
+ * first failing file, the remaining files are not loaded in that case.
+ * The file pointers must all be different, the repos may repeat.
+ * nthreads: 0: use no threads, 1: one thread per cpu, otherwise the
+ * number of threads.
+ */
+int
+repo_add_solv_batch(Repo **repos, FILE **fps, int nfiles, int flags, int nthreads)
+{
+  struct solvstage *stages;
+  Pool *pool;
+  int i, ret = 0;
+
+  if (nfiles <= 0)
+    return 0;
+  pool = repos[0]->pool;
+  stages = solv_calloc(nfiles, sizeof(*stages));
+  for (i = 0; i < nfiles; i++)
+    {
+      stages[i].fp = fps[i];
+      stages[i].start = -1;
+      stages[i].flags = flags;
+      stages[i].memhashes = pool->sshashes ? 1 : 0;
+    }
+  /* loads that use the state of the repo or the pool are not staged.
+   * Neither are loads without a second thread, the merge would only
+   * add to the time */
+  if (nthreads == 1)
+    nthreads = solv_ncpus();
+  if (nthreads > 1 && nfiles > 1 && (flags & ~(SOLV_ADD_NO_STUBS | SOLV_ADD_MMAP | SOLV_ADD_DELTAS | REPO_NO_INTERNALIZE)) == 0 && !pool->frozen && !pool->concurrent)
+    solv_parallel(nfiles, nthreads, stage_solv_task, stages);
+  for (i = 0; i < nfiles; i++)
+    {
+      if (!ret)
+	ret = add_stage(repos[i], stages + i);
+      if (stages[i].pool)
+	pool_free(stages[i].pool);
+      solv_free(stages[i].strhashes);
+    }
+  solv_free(stages);
+  return ret;
+}
+
+/* return the cookie of the repository state, i.e. the userdata of
+ * the last loaded solv file */
+const unsigned char *
+repo_solv_cookie(Repo *repo, int *lenp)
+{
+  *lenp = repo->solvcookielen;
+  return repo->solvcookie;
+}
+
 int
 solv_read_userdata(FILE *fp, unsigned char **datap, int *lenp)
 {
@@ -1473,6 +2001,7 @@ solv_read_userdata(FILE *fp, unsigned char **datap, int *lenp)
     {
     case SOLV_VERSION_8:
     case SOLV_VERSION_9:
+    case SOLV_VERSION_10:
       break;
     default:
       return SOLV_ERROR_UNSUPPORTED;
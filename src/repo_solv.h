@@ -23,9 +23,13 @@ extern "C" {
 #endif
 
 extern int repo_add_solv(Repo *repo, FILE *fp, int flags);
+extern int repo_add_solv_batch(Repo **repos, FILE **fps, int nfiles, int flags, int nthreads);
 extern int solv_read_userdata(FILE *fp, unsigned char **datap, int *lenp);
+extern const unsigned char *repo_solv_cookie(Repo *repo, int *lenp);
 
 #define SOLV_ADD_NO_STUBS	(1 << 8)
+#define SOLV_ADD_MMAP		(1 << 9)
+#define SOLV_ADD_DELTAS		(1 << 10)
 
 #ifdef __cplusplus
 }
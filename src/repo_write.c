@@ -1006,23 +1006,172 @@ traverse_dirs(Dirpool *dp, Id *dirmap, Id n, Id dir, Id *used)
   return n;
 }
 
+/*
+ * vertical data pages
+ *
+ * the pages are collected in batches, the pages of a batch are
+ * compressed in parallel and then written in order
+ */
+
+#define PAGEWRITER_DICTSIZE	(64 * 1024)
+#define PAGEWRITER_BATCH	16	/* pages per task in a batch */
+
+struct pagewriter {
+  Repodata *target;
+  int codecid;
+  int train;			/* collect all data to train a dictionary */
+  int nthreads;			/* see solv_parallel() */
+  int ntasks;
+  Repopagecodec **codecs;	/* one for each task */
+  unsigned char *data;		/* collected data */
+  unsigned int len;
+  unsigned int maxlen;		/* size of a batch */
+  unsigned char *cpages;	/* compressed pages of a batch */
+  unsigned int *clens;
+  unsigned char *todo;		/* the batch that gets compressed */
+  unsigned int todolen;
+};
+
 static void
-write_compressed_page(Repodata *data, unsigned char *page, int len)
+pagewriter_compress_task(void *vp, int task)
 {
-  int clen;
-  unsigned char cpage[REPOPAGE_BLOBSIZE];
+  struct pagewriter *pw = vp;
+  unsigned int npages = (pw->todolen + REPOPAGE_BLOBSIZE - 1) / REPOPAGE_BLOBSIZE;
+  unsigned int i = npages * task / pw->ntasks;
+  unsigned int end = npages * (task + 1) / pw->ntasks;
 
-  clen = repopagestore_compress_page(page, len, cpage, len - 1);
-  if (!clen)
+  for (; i < end; i++)
     {
-      write_u32(data, len * 2);
-      write_blob(data, page, len);
+      unsigned int off = i * REPOPAGE_BLOBSIZE;
+      unsigned int l = pw->todolen - off > REPOPAGE_BLOBSIZE ? REPOPAGE_BLOBSIZE : pw->todolen - off;
+      pw->clens[i] = repopagecodec_compress(pw->codecs[task], pw->todo + off, l, pw->cpages + off, l - 1);
     }
+}
+
+/* compress and write the pages of a batch */
+static void
+pagewriter_write_pages(struct pagewriter *pw, unsigned char *pages, unsigned int len)
+{
+  unsigned int i, npages = (len + REPOPAGE_BLOBSIZE - 1) / REPOPAGE_BLOBSIZE;
+
+  pw->todo = pages;
+  pw->todolen = len;
+  if (pw->ntasks > 1 && npages > 1)
+    solv_parallel(pw->ntasks, pw->nthreads, pagewriter_compress_task, pw);
   else
     {
-      write_u32(data, clen * 2 + 1);
-      write_blob(data, cpage, clen);
+      int ntasks = pw->ntasks;
+      pw->ntasks = 1;
+      pagewriter_compress_task(pw, 0);
+      pw->ntasks = ntasks;
+    }
+  for (i = 0; i < npages; i++)
+    {
+      unsigned int off = i * REPOPAGE_BLOBSIZE;
+      unsigned int l = len - off > REPOPAGE_BLOBSIZE ? REPOPAGE_BLOBSIZE : len - off;
+      if (!pw->clens[i])
+	{
+	  write_u32(pw->target, l * 2);
+	  write_blob(pw->target, pages + off, l);
+	}
+      else
+	{
+	  write_u32(pw->target, pw->clens[i] * 2 + 1);
+	  write_blob(pw->target, pw->cpages + off, pw->clens[i]);
+	}
+    }
+}
+
+static void
+pagewriter_write_header(struct pagewriter *pw, unsigned char *dict, unsigned int dictlen)
+{
+  int i;
+  if (pw->codecid == REPOPAGE_CODEC_LZ)
+    {
+      write_u32(pw->target, REPOPAGE_BLOBSIZE);
+      return;
     }
+  for (i = 0; i < pw->ntasks; i++)
+    pw->codecs[i] = repopagecodec_create(pw->codecid, dict, dictlen);
+  write_u32(pw->target, REPOPAGE_BLOBSIZE | pw->codecid << 24);
+  write_u32(pw->target, dictlen);
+  write_blob(pw->target, dict, dictlen);
+}
+
+static void
+pagewriter_init(struct pagewriter *pw, Repodata *target, int codecid, int train, int nthreads)
+{
+  memset(pw, 0, sizeof(*pw));
+  pw->target = target;
+  pw->codecid = codecid;
+  pw->train = codecid != REPOPAGE_CODEC_LZ && train;
+  pw->ntasks = 1;
+  if (nthreads)
+    {
+      /* same semantics as the solver's parallel flag: 1 means one thread per cpu */
+      pw->nthreads = nthreads > 1 ? nthreads : 0;
+      pw->ntasks = nthreads > 1 ? nthreads : solv_ncpus();
+    }
+  pw->codecs = solv_calloc(pw->ntasks, sizeof(Repopagecodec *));
+  pw->maxlen = (pw->ntasks > 1 ? pw->ntasks * PAGEWRITER_BATCH : 1) * REPOPAGE_BLOBSIZE;
+  pw->cpages = solv_malloc(pw->maxlen);
+  pw->clens = solv_calloc(pw->maxlen / REPOPAGE_BLOBSIZE, sizeof(unsigned int));
+  if (!pw->train)
+    {
+      pw->data = solv_malloc(pw->maxlen);
+      pagewriter_write_header(pw, 0, 0);
+    }
+}
+
+static void
+pagewriter_add(struct pagewriter *pw, unsigned char *dp, unsigned int l)
+{
+  if (pw->train)
+    {
+      pw->data = solv_extend(pw->data, pw->len, l, 1, REPOPAGE_BLOBSIZE - 1);
+      memcpy(pw->data + pw->len, dp, l);
+      pw->len += l;
+      return;
+    }
+  while (l)
+    {
+      unsigned int ll = pw->maxlen - pw->len;
+      if (l < ll)
+	ll = l;
+      memcpy(pw->data + pw->len, dp, ll);
+      dp += ll;
+      pw->len += ll;
+      l -= ll;
+      if (pw->len == pw->maxlen)
+	{
+	  pagewriter_write_pages(pw, pw->data, pw->len);
+	  pw->len = 0;
+	}
+    }
+}
+
+static void
+pagewriter_finish(struct pagewriter *pw)
+{
+  int i;
+  if (pw->train)
+    {
+      unsigned char *dict = solv_malloc(PAGEWRITER_DICTSIZE);
+      unsigned int dictlen = repopagecodec_train(pw->codecid, pw->data, pw->len, dict, PAGEWRITER_DICTSIZE);
+      unsigned int off;
+      pagewriter_write_header(pw, dict, dictlen);
+      solv_free(dict);
+      for (off = 0; off < pw->len; off += pw->maxlen)
+	pagewriter_write_pages(pw, pw->data + off, pw->len - off > pw->maxlen ? pw->maxlen : pw->len - off);
+    }
+  else if (pw->len)
+    pagewriter_write_pages(pw, pw->data, pw->len);
+  for (i = 0; i < pw->ntasks; i++)
+    repopagecodec_free(pw->codecs[i]);
+  solv_free(pw->codecs);
+  solv_free(pw->data);
+  solv_free(pw->cpages);
+  solv_free(pw->clens);
 }
 
 static Id verticals[] = {
@@ -1070,29 +1219,6 @@ repo_write_stdkeyfilter(Repo *repo, Repokey *key, void *kfdata)
   return KEY_STORAGE_INCORE;
 }
 
-static int
-write_compressed_extdata(Repodata *target, struct extdata *xd, unsigned char *vpage, int lpage)
-{
-  unsigned char *dp = xd->buf;
-  int l = xd->len;
-  while (l)
-    {
-      int ll = REPOPAGE_BLOBSIZE - lpage;
-      if (l < ll)
-	ll = l;
-      memcpy(vpage + lpage, dp, ll);
-      dp += ll;
-      lpage += ll;
-      l -= ll;
-      if (lpage == REPOPAGE_BLOBSIZE)
-	{
-	  write_compressed_page(target, vpage, lpage);
-	  lpage = 0;
-	}
-    }
-  return lpage;
-}
-
 
 static Id *
 create_keyskip(Repo *repo, Id entry, unsigned char *repodataused, Id **oldkeyskip)
@@ -1161,6 +1287,8 @@ Repowriter *
 repowriter_free(Repowriter *writer)
 {
   solv_free(writer->userdata);
+  solv_free(writer->deltabase);
+  solv_free(writer->deltaremoved);
   return solv_free(writer);
 }
 
@@ -1170,6 +1298,29 @@ repowriter_set_flags(Repowriter *writer, int flags)
   writer->flags = flags;
 }
 
+/* compress the vertical data pages with multiple threads.
+ * 0: use no threads, 1: one thread per cpu, otherwise the number
+ * of threads. The written data does not depend on this setting. */
+void
+repowriter_set_nthreads(Repowriter *writer, int nthreads)
+{
+  writer->nthreads = nthreads > 0 ? nthreads : 0;
+}
+
+/* select the compression of the vertical data pages. Returns 0 if
+ * the codec is not available, the builtin one is used in that case. */
+int
+repowriter_set_pagecodec(Repowriter *writer, int codec)
+{
+  if (!repopagecodec_available(codec))
+    {
+      writer->pagecodec = REPOWRITER_PAGECODEC_DEFAULT;
+      return 0;
+    }
+  writer->pagecodec = codec;
+  return 1;
+}
+
 void
 repowriter_set_keyfilter(Repowriter *writer, int (*keyfilter)(Repo *repo, Repokey *key, void *kfdata), void *kfdata)
 {
@@ -1208,6 +1359,59 @@ repowriter_set_userdata(Repowriter *writer, const void *data, int len)
   writer->userdatalen = len;
 }
 
+/* write a delta file that applies to the repo state identified
+ * by basecookie, i.e. the userdata of the last loaded solv file.
+ * The solvables in removed get deleted when the delta is applied,
+ * the written solvables get added. Use repowriter_set_solvablerange
+ * to select the added solvables and repowriter_set_userdata to set
+ * the cookie of the new state. */
+void
+repowriter_set_deltabase(Repowriter *writer, const void *basecookie, int basecookielen, Queue *removed)
+{
+  writer->delta = 1;
+  writer->deltabase = solv_free(writer->deltabase);
+  writer->deltabaselen = 0;
+  writer->deltaremoved = solv_free(writer->deltaremoved);
+  writer->ndeltaremoved = 0;
+  if (basecookielen > 0)
+    {
+      writer->deltabase = solv_memdup(basecookie, basecookielen);
+      writer->deltabaselen = basecookielen;
+    }
+  if (removed && removed->count)
+    {
+      writer->deltaremoved = solv_memdup2(removed->elements, removed->count, sizeof(Id));
+      writer->ndeltaremoved = removed->count;
+    }
+}
+
+/* convert the removed solvables of a delta to their position in
+ * the repo, i.e. the number of repo solvables with a smaller id */
+static Id *
+delta_removed_positions(Repo *repo, Id *removed, int nremoved, int *npositionsp)
+{
+  Pool *pool = repo->pool;
+  Solvable *s;
+  Id p, *positions;
+  int i, n;
+  Map m;
+
+  map_init(&m, pool->nsolvables);
+  for (i = 0; i < nremoved; i++)
+    MAPSET(&m, removed[i]);
+  positions = solv_calloc(nremoved, sizeof(Id));
+  n = i = 0;
+  FOR_REPO_SOLVABLES(repo, p, s)
+    {
+      if (MAPTST(&m, p))
+	positions[n++] = i;
+      i++;
+    }
+  map_free(&m);
+  *npositionsp = n;
+  return positions;
+}
+
 /*
  * the code works the following way:
  *
@@ -1250,6 +1454,7 @@ repowriter_write(Repowriter *writer, FILE *fp)
   int solvablestart, solvableend;
   Id *solvschemata;
   int anysolvableused = 0;
+  int have_columns;
   int nsolvables;
 
   struct cbdata cbdata;
@@ -1275,6 +1480,14 @@ repowriter_write(Repowriter *writer, FILE *fp)
   /* sanity checks */
   if (writer->userdatalen < 0 || writer->userdatalen >= 65536)
     return pool_error(pool, -1, "illegal userdata length: %d", writer->userdatalen);
+  if (writer->deltabaselen < 0 || writer->deltabaselen >= 65536)
+    return pool_error(pool, -1, "illegal delta base cookie length: %d", writer->deltabaselen);
+  for (i = 0; i < writer->ndeltaremoved; i++)
+    {
+      Id p = writer->deltaremoved[i];
+      if (p <= 0 || p >= pool->nsolvables || pool->solvables[p].repo != repo)
+        return pool_error(pool, -1, "removed solvable %d is not part of the repo", p);
+    }
 
   memset(&cbdata, 0, sizeof(cbdata));
   cbdata.pool = pool;
@@ -1396,7 +1609,13 @@ repowriter_write(Repowriter *writer, FILE *fp)
 	    {
 	      /* a new key. ask keyfilter if we want it before creating it */
 	      Repokey keyd = *key;
-	      keyd.storage = KEY_STORAGE_INCORE;
+	      Id storage = KEY_STORAGE_INCORE;
+	      int k;
+	      if (keyd.type == REPOKEY_TYPE_NUM)
+		for (k = 0; k < data->ncolumns; k++)
+		  if (data->columns[k].key == j)
+		    storage = KEY_STORAGE_COLUMN;	/* keep the column */
+	      keyd.storage = storage;
 	      if (keyd.type == REPOKEY_TYPE_CONSTANTID)
 		keyd.size = repodata_globalize_id(data, key->size, 1);
 	      else if (keyd.type != REPOKEY_TYPE_CONSTANT)
@@ -1409,8 +1628,10 @@ repowriter_write(Repowriter *writer, FILE *fp)
 		      keymap[n] = 0;
 		      continue;
 		    }
-		  if (keyd.storage != KEY_STORAGE_VERTICAL_OFFSET)
-		    keyd.storage = KEY_STORAGE_INCORE;		/* do not mess with us */
+		  if (keyd.storage == KEY_STORAGE_COLUMN && keyd.type == REPOKEY_TYPE_NUM)
+		    ;		/* num keys may also be stored as column */
+		  else if (keyd.storage != KEY_STORAGE_VERTICAL_OFFSET)
+		    keyd.storage = storage;		/* do not mess with us */
 		}
 	      if (data->state != REPODATA_STUB)
 	        id = repodata_key2id(&target, &keyd, 1);
@@ -2013,10 +2234,18 @@ for (i = 1; i < target.nkeys; i++)
     solv_flags |= SOLV_FLAG_USERDATA;
   if (cbdata.extdata[target.nkeys].len)
     solv_flags |= SOLV_FLAG_IDARRAYBLOCK;
+  if (writer->delta)
+    solv_flags |= SOLV_FLAG_DELTA;
+  for (i = 1; i < target.nkeys; i++)
+    if (target.keys[i].storage == KEY_STORAGE_COLUMN)
+      break;
+  have_columns = i < target.nkeys;
 
   /* write file header */
   write_u32(&target, 'S' << 24 | 'O' << 16 | 'L' << 8 | 'V');
-  if ((solv_flags & (SOLV_FLAG_USERDATA | SOLV_FLAG_IDARRAYBLOCK)) != 0)
+  if ((solv_flags & SOLV_FLAG_DELTA) != 0 || writer->pagecodec != REPOPAGE_CODEC_LZ || have_columns)
+    write_u32(&target, SOLV_VERSION_10);
+  else if ((solv_flags & (SOLV_FLAG_USERDATA | SOLV_FLAG_IDARRAYBLOCK)) != 0)
     write_u32(&target, SOLV_VERSION_9);
   else
     write_u32(&target, SOLV_VERSION_8);
@@ -2037,6 +2266,21 @@ for (i = 1; i < target.nkeys; i++)
       write_blob(&target, writer->userdata, writer->userdatalen);
     }
 
+  /* write delta header */
+  if ((solv_flags & SOLV_FLAG_DELTA) != 0)
+    {
+      Id *positions = 0;
+      int npositions = 0;
+      write_u32(&target, writer->deltabaselen);
+      write_blob(&target, writer->deltabase, writer->deltabaselen);
+      if (writer->ndeltaremoved)
+        positions = delta_removed_positions(repo, writer->deltaremoved, writer->ndeltaremoved, &npositions);
+      write_u32(&target, npositions);
+      for (i = 0; i < npositions; i++)
+	write_u32(&target, positions[i]);
+      solv_free(positions);
+    }
+
   if (nstrings)
     {
       /*
@@ -2168,15 +2412,14 @@ for (i = 1; i < target.nkeys; i++)
   if (i < target.nkeys)
     {
       /* have vertical data, write it in pages */
-      unsigned char vpage[REPOPAGE_BLOBSIZE];
-      int lpage = 0;
+      struct pagewriter pw;
 
-      write_u32(&target, REPOPAGE_BLOBSIZE);
+      pagewriter_init(&pw, &target, writer->pagecodec, (writer->flags & REPOWRITER_PAGECODEC_DICT) != 0, writer->nthreads);
       if (!cbdata.filelistmode)
 	{
 	  for (i = 1; i < target.nkeys; i++)
 	    if (cbdata.extdata[i].len)
-	      lpage = write_compressed_extdata(&target, cbdata.extdata + i, vpage, lpage);
+	      pagewriter_add(&pw, cbdata.extdata[i].buf, cbdata.extdata[i].len);
 	}
       else
 	{
@@ -2207,15 +2450,14 @@ for (i = 1; i < target.nkeys; i++)
 		}
 	      if (xd->len > 1024 * 1024)
 		{
-		  lpage = write_compressed_extdata(&target, xd, vpage, lpage);
+		  pagewriter_add(&pw, xd->buf, xd->len);
 		  xd->len = 0;
 		}
 	    }
 	  if (xd->len)
-	    lpage = write_compressed_extdata(&target, xd, vpage, lpage);
+	    pagewriter_add(&pw, xd->buf, xd->len);
 	}
-      if (lpage)
-	write_compressed_page(&target, vpage, lpage);
+      pagewriter_finish(&pw);
     }
 
   for (i = 1; i < target.nkeys; i++)
@@ -34,13 +34,25 @@ typedef struct s_Repowriter {
   Queue *keyq;
   void *userdata;
   int userdatalen;
+  int pagecodec;
+  int nthreads;
+  int delta;
+  void *deltabase;
+  int deltabaselen;
+  Id *deltaremoved;
+  int ndeltaremoved;
 } Repowriter;
 
 /* repowriter flags */
 #define REPOWRITER_NO_STORAGE_SOLVABLE	(1 << 0)
 #define REPOWRITER_KEEP_TYPE_DELETED	(1 << 1)
+#define REPOWRITER_PAGECODEC_DICT	(1 << 3)
 #define REPOWRITER_LEGACY		(1 << 30)
 
+/* page codecs for repowriter_set_pagecodec(), these are not flag bits */
+#define REPOWRITER_PAGECODEC_DEFAULT	0
+#define REPOWRITER_PAGECODEC_ZSTD	1
+
 Repowriter *repowriter_create(Repo *repo);
 Repowriter *repowriter_free(Repowriter *writer);
 void repowriter_set_flags(Repowriter *writer, int flags);
@@ -49,6 +61,9 @@ void repowriter_set_keyqueue(Repowriter *writer, Queue *keyq);
 void repowriter_set_repodatarange(Repowriter *writer, int repodatastart, int repodataend);
 void repowriter_set_solvablerange(Repowriter *writer, int solvablestart, int solvableend);
 void repowriter_set_userdata(Repowriter *writer, const void *data, int len);
+int repowriter_set_pagecodec(Repowriter *writer, int codec);
+void repowriter_set_nthreads(Repowriter *writer, int nthreads);
+void repowriter_set_deltabase(Repowriter *writer, const void *basecookie, int basecookielen, Queue *removed);
 int repowriter_write(Repowriter *writer, FILE *fp);
 
 /* convenience functions */
@@ -27,6 +27,7 @@
 #include "repo.h"
 #include "pool.h"
 #include "poolid_private.h"
+#include "pool_private.h"
 #include "util.h"
 #include "hash.h"
 #include "chksum.h"
@@ -41,6 +42,10 @@
 #define REPODATA_BLOCK 255
 
 static unsigned char *data_skip_key(Repodata *data, unsigned char *dp, Repokey *key);
+static void repodata_fill_column(Repodata *data, Repodata_column *col);
+static void repodata_free_columns(Repodata *data);
+static void repodata_free_keyindex(Repodata *data);
+static void repodata_free_dirhash(Repodata *data);
 
 void
 repodata_initdata(Repodata *data, Repo *repo, int localpool)
@@ -59,6 +64,7 @@ repodata_initdata(Repodata *data, Repo *repo, int localpool)
   data->nschemata = 1;
   data->schemadatalen = 1;
   repopagestore_init(&data->store);
+  data->store.cache = repo->pool->pagecache;
 }
 
 void
@@ -98,6 +104,10 @@ repodata_freedata(Repodata *data)
   solv_free(data->attrnum64data);
 
   solv_free(data->dircache);
+  repodata_free_dirhash(data);
+
+  repodata_free_columns(data);
+  repodata_free_keyindex(data);
 
   repodata_free_filelistfilter(data);
 }
@@ -267,6 +277,107 @@ struct dircache {
 };
 #endif
 
+/* dirpool_add_dir() walks all blocks of the parent to find a
+ * component, which is slow for directories with many children.
+ * So big dirpools get a hash that maps (parent, comp) to the dir.
+ * It stores the parent of each dir, so a hit does not need to walk
+ * back to the block start. Dirs added to the dirpool by other means
+ * are picked up on the next lookup. */
+
+#define DIRHASH_MIN 256		/* create the hash for dirpools of this size */
+
+struct dirhash {
+  Id *tbl;			/* (dir, parent) pairs */
+  Hashval mask;
+  int ndirs;			/* dirs already hashed */
+};
+
+static inline Hashval
+dirhash(Id parent, Id comp)
+{
+  return (Hashval)parent * 0x9e3779b1U ^ (Hashval)comp * 0x85ebca6bU;
+}
+
+static void
+dirhash_sync(struct dirhash *dh, Dirpool *dp)
+{
+  Id *tbl = dh->tbl;
+  Hashval h, hh, mask = dh->mask;
+  Id i, parent;
+
+  i = dh->ndirs ? dh->ndirs : 1;
+  parent = i < dp->ndirs ? dirpool_parent(dp, i) : 0;
+  for (; i < dp->ndirs; i++)
+    {
+      if (dp->dirs[i] <= 0)
+	{
+	  parent = -dp->dirs[i];
+	  continue;
+	}
+      h = dirhash(parent, dp->dirs[i]) & mask;
+      hh = HASHCHAIN_START;
+      while (tbl[2 * h])
+	h = HASHCHAIN_NEXT(h, hh, mask);
+      tbl[2 * h] = i;
+      tbl[2 * h + 1] = parent;
+    }
+  dh->ndirs = dp->ndirs;
+}
+
+static Id
+repodata_add_dir(Repodata *data, Id parent, Id comp, int create)
+{
+  Dirpool *dp = &data->dirpool;
+  struct dirhash *dh = data->dirhash;
+  Hashval h, hh;
+  Id d, *tbl;
+
+  if (!dh && dp->ndirs < DIRHASH_MIN)
+    return dirpool_add_dir(dp, parent, comp, create);
+  if (comp <= 0)
+    return 0;
+  if (parent == 0 && comp == 1)
+    return 1;
+  if (!dh)
+    dh = data->dirhash = solv_calloc(1, sizeof(*dh));
+  /* we add at most two entries */
+  if ((Hashval)(dp->ndirs + 2) * 2 > dh->mask)
+    {
+      solv_free(dh->tbl);
+      dh->mask = mkmask(dp->ndirs + DIRHASH_MIN);
+      dh->tbl = solv_calloc(2 * ((size_t)dh->mask + 1), sizeof(Id));
+      dh->ndirs = 0;
+    }
+  if (dh->ndirs != dp->ndirs)
+    dirhash_sync(dh, dp);
+  tbl = dh->tbl;
+  h = dirhash(parent, comp) & dh->mask;
+  hh = HASHCHAIN_START;
+  while ((d = tbl[2 * h]) != 0)
+    {
+      if (tbl[2 * h + 1] == parent && dp->dirs[d] == comp)
+	return d;
+      h = HASHCHAIN_NEXT(h, hh, dh->mask);
+    }
+  if (!create)
+    return 0;
+  d = dirpool_new_dir(dp, parent, comp);
+  tbl[2 * h] = d;
+  tbl[2 * h + 1] = parent;
+  dh->ndirs = dp->ndirs;
+  return d;
+}
+
+static void
+repodata_free_dirhash(Repodata *data)
+{
+  if (data->dirhash)
+    {
+      solv_free(data->dirhash->tbl);
+      data->dirhash = solv_free(data->dirhash);
+    }
+}
+
 Id
 repodata_str2dir(Repodata *data, const char *dir, int create)
 {
@@ -317,7 +428,7 @@ repodata_str2dir(Repodata *data, const char *dir, int create)
 	id = pool_strn2id(data->repo->pool, dir, dire - dir, create);
       if (!id)
 	return 0;
-      parent = dirpool_add_dir(&data->dirpool, parent, id, create);
+      parent = repodata_add_dir(data, parent, id, create);
       if (!parent)
 	return 0;
 #ifdef DIRCACHE_SIZE
@@ -346,6 +457,7 @@ void
 repodata_free_dircache(Repodata *data)
 {
   data->dircache = solv_free(data->dircache);
+  repodata_free_dirhash(data);
 }
 
 const char *
@@ -495,7 +607,9 @@ get_vertical_data(Repodata *data, Repokey *key, Id off, Id len)
   off += data->verticaloffset[key - data->keys];
   /* fprintf(stderr, "key %d page %d\n", key->name, off / REPOPAGE_BLOBSIZE); */
   dp = repopagestore_load_page_range(&data->store, off / REPOPAGE_BLOBSIZE, (off + len - 1) / REPOPAGE_BLOBSIZE);
-  data->storestate++;
+  /* the pages of a frozen pool do not move */
+  if (!data->repo->pool->frozen)
+    data->storestate++;
   if (dp)
     dp += off % REPOPAGE_BLOBSIZE;
   return dp;
@@ -580,15 +694,15 @@ solvid2data(Repodata *data, Id solvid, Id *schemap)
     dp += 1;	/* offset of "meta" solvable */
   else if (solvid == SOLVID_POS)
     {
-      Pool *pool = data->repo->pool;
-      if (data->repo != pool->pos.repo)
+      Datapos *pos = pool_datapos(data->repo->pool);
+      if (data->repo != pos->repo)
 	return 0;
-      if (data != data->repo->repodata + pool->pos.repodataid)
+      if (data != data->repo->repodata + pos->repodataid)
 	return 0;
-      dp += pool->pos.dp;
-      if (pool->pos.dp != 1)
+      dp += pos->dp;
+      if (pos->dp != 1)
         {
-          *schemap = pool->pos.schema;
+          *schemap = pos->schema;
           return dp;
 	}
     }
@@ -601,6 +715,107 @@ solvid2data(Repodata *data, Id solvid, Id *schemap)
   return data_read_id(dp, schemap);
 }
 
+/* return the column of key keyid if it has a value for solvid */
+static inline Repodata_column *
+repodata_find_column(Repodata *data, Id keyid, Id solvid)
+{
+  Repodata_column *col;
+  int i;
+
+  if (solvid < data->start || solvid >= data->end)
+    return 0;
+  for (i = 0, col = data->columns; i < data->ncolumns; i++, col++)
+    if (col->key == keyid)
+      return solvid < col->end && solvid >= col->start && MAPTST(&col->present, solvid - col->start) ? col : 0;
+  return 0;
+}
+
+/* return the start of the data of key keyid of a solvable */
+static unsigned char *
+solvid2keydata(Repodata *data, Id solvid, Id keyid)
+{
+  unsigned char *dp;
+  Id schema, *keyp, *kp;
+
+  dp = solvid2data(data, solvid, &schema);
+  if (!dp)
+    return 0;
+  keyp = data->schemadata + data->schemata[schema];
+  for (kp = keyp; *kp; kp++)
+    if (*kp == keyid)
+      break;
+  if (!*kp)
+    return 0;
+  return forward_to_key(data, keyid, keyp, dp);
+}
+
+/************************************************************************
+ * key index
+ *
+ * Looking up the data of a key needs to skip over the data of all
+ * other keys of the solvable. For keys that are looked up often we
+ * build an index that maps the solvable to the data offset. To keep
+ * the memory usage bounded, an index is only created after a number
+ * of lookups and the indexes may not use more than half of the size
+ * of the incore data.
+ */
+
+#define REPODATA_KEYINDEX_LOOKUPS	64
+
+static inline Repodata_keyindex *
+repodata_find_keyindex(Repodata *data, Id keyname)
+{
+  Repodata_keyindex *ki;
+  int i;
+  for (i = 0, ki = data->keyindex; i < data->nkeyindex; i++, ki++)
+    if (data->keys[ki->key].name == keyname)
+      return ki;
+  return 0;
+}
+
+static void
+repodata_add_keyindex(Repodata *data, Id keyid)
+{
+  Repodata_keyindex *ki;
+  unsigned long long size;
+  unsigned char *dp;
+  Id p, k;
+  int i;
+
+  data->keylookups[keyid & (sizeof(data->keylookups) - 1)] = 0;
+  if (data->end <= data->start)
+    return;
+  /* the index is by keyname, so the name must be unique */
+  for (k = 1; k < data->nkeys; k++)
+    if (k != keyid && data->keys[k].name == data->keys[keyid].name)
+      return;
+  size = (unsigned long long)(data->end - data->start) * sizeof(Id);
+  for (i = 0, ki = data->keyindex; i < data->nkeyindex; i++, ki++)
+    size += (unsigned long long)(ki->end - ki->start) * sizeof(Id);
+  if (size > data->incoredatalen / 2)
+    return;
+  data->keyindex = solv_extend(data->keyindex, data->nkeyindex, 1, sizeof(Repodata_keyindex), 7);
+  ki = data->keyindex + data->nkeyindex++;
+  ki->key = keyid;
+  ki->start = data->start;
+  ki->end = data->end;
+  ki->offsets = solv_calloc(data->end - data->start, sizeof(Id));
+  for (p = data->start; p < data->end; p++)
+    if ((dp = solvid2keydata(data, p, keyid)) != 0)
+      ki->offsets[p - data->start] = dp - data->incoredata;
+}
+
+static void
+repodata_free_keyindex(Repodata *data)
+{
+  int i;
+  for (i = 0; i < data->nkeyindex; i++)
+    solv_free(data->keyindex[i].offsets);
+  data->keyindex = solv_free(data->keyindex);
+  data->nkeyindex = 0;
+  memset(data->keylookups, 0, sizeof(data->keylookups));
+}
+
 /************************************************************************
  * data lookup
  */
@@ -614,6 +829,18 @@ find_key_data(Repodata *data, Id solvid, Id keyname, Repokey **keypp)
 
   if (!maybe_load_repodata(data, keyname))
     return 0;
+  if (data->nkeyindex && solvid > 0)
+    {
+      Repodata_keyindex *ki = repodata_find_keyindex(data, keyname);
+      if (ki && solvid >= ki->start && solvid < ki->end)
+	{
+	  if (solvid >= data->end || !ki->offsets[solvid - ki->start])
+	    return 0;
+	  *keypp = key = data->keys + ki->key;
+	  dp = data->incoredata + ki->offsets[solvid - ki->start];
+	  return get_data(data, key, &dp, 0);
+	}
+    }
   dp = solvid2data(data, solvid, &schema);
   if (!dp)
     return 0;
@@ -633,6 +860,8 @@ find_key_data(Repodata *data, Id solvid, Id keyname, Repokey **keypp)
   dp = forward_to_key(data, *kp, keyp, dp);
   if (!dp)
     return 0;
+  if (solvid > 0 && !data->repo->pool->frozen && ++data->keylookups[*kp & (sizeof(data->keylookups) - 1)] >= REPODATA_KEYINDEX_LOOKUPS)
+    repodata_add_keyindex(data, *kp);
   return get_data(data, key, &dp, 0);
 }
 
@@ -745,7 +974,16 @@ repodata_lookup_num(Repodata *data, Id solvid, Id keyname, unsigned long long no
   unsigned char *dp;
   Repokey *key;
   unsigned int high, low;
+  int i;
 
+  for (i = 0; i < data->ncolumns; i++)
+    if (data->keys[data->columns[i].key].name == keyname)
+      {
+	Repodata_column *col = repodata_find_column(data, data->columns[i].key, solvid);
+	if (col)
+	  return col->values[solvid - col->start];
+	break;
+      }
   dp = find_key_data(data, solvid, keyname, &key);
   if (!dp)
     return notfound;
@@ -991,7 +1229,7 @@ repodata_translate_dir_slow(Repodata *data, Repodata *fromdata, Id dir, int crea
       if (!(compid = repodata_translate_id(data, fromdata, compid, create)))
 	return 0;
     }
-  if (!(compid = dirpool_add_dir(&data->dirpool, parent, compid, create)))
+  if (!(compid = repodata_add_dir(data, parent, compid, create)))
     return 0;
   if (cache)
     {
@@ -1326,10 +1564,11 @@ repodata_setpos_kv(Repodata *data, KeyValue *kv)
     pool_clear_pos(pool);
   else
     {
-      pool->pos.repo = data->repo;
-      pool->pos.repodataid = data - data->repo->repodata;
-      pool->pos.dp = (unsigned char *)kv->str - data->incoredata;
-      pool->pos.schema = kv->id;
+      Datapos *pos = pool_datapos(pool);
+      pos->repo = data->repo;
+      pos->repodataid = data - data->repo->repodata;
+      pos->dp = (unsigned char *)kv->str - data->incoredata;
+      pos->schema = kv->id;
     }
 }
 
@@ -1694,6 +1933,27 @@ dataiterator_find_keyname(Dataiterator *di, Id keyname)
   return dp;
 }
 
+/* if the key keyname of the solvable is stored in a column, put
+ * the value into di->kv so that we do not need to fetch it */
+static int
+dataiterator_find_column(Dataiterator *di, Id keyname)
+{
+  Repodata_column *col;
+  unsigned long long x;
+  Id *keyp;
+
+  for (keyp = di->keyp; *keyp; keyp++)
+    if (di->data->keys[*keyp].name == keyname)
+      break;
+  if (!*keyp || !(col = repodata_find_column(di->data, *keyp, di->solvid)))
+    return 0;
+  x = col->values[di->solvid - col->start];
+  di->keyp = keyp;
+  di->kv.num = (unsigned int)x;
+  di->kv.num2 = (unsigned int)(x >> 32);
+  return 1;
+}
+
 int
 dataiterator_step(Dataiterator *di)
 {
@@ -1761,12 +2021,14 @@ dataiterator_step(Dataiterator *di)
 	  if (!di->dp)
 	    goto di_nextrepodata;
 	  if (di->solvid == SOLVID_POS)
-	    di->solvid = di->pool->pos.solvid;
+	    di->solvid = pool_datapos(di->pool)->solvid;
 	  /* reset key iterator */
 	  di->keyp = di->data->schemadata + di->data->schemata[schema];
 	  /* FALLTHROUGH */
 
 	case di_enterschema: di_enterschema:
+	  if (di->keyname && di->data->ncolumns && !di->kv.parent && di->solvid > 0 && dataiterator_find_column(di, di->keyname))
+	    goto di_entercolumn;
 	  if (di->keyname)
 	    di->dp = dataiterator_find_keyname(di, di->keyname);
 	  if (!di->dp || !*di->keyp)
@@ -1819,6 +2081,19 @@ dataiterator_step(Dataiterator *di)
 	  di->state = di->kv.eof ? di_nextkey : di_nextattr;
 	  break;
 
+	di_entercolumn:
+	  /* the value was taken from the column, there is nothing to fetch */
+	  di->key = di->data->keys + *di->keyp;
+	  di->ddp = 0;
+	  if (di->keyskip && (di->key->name >= di->keyskip[0] || di->keyskip[3 + di->key->name] != di->keyskip[1] + di->data->repodataid))
+	    goto di_nextkey;
+	  if (di->nkeynames && di->nparents - di->rootlevel < di->nkeynames)
+	    goto di_nextkey;
+	  di->kv.entry = 0;
+	  di->kv.eof = 1;
+	  di->state = di_nextkey;
+	  break;
+
 	case di_nextkey: di_nextkey:
 	  if (!di->keyname && *++di->keyp)
 	    goto di_enterkey;
@@ -2004,31 +2279,35 @@ dataiterator_entersub(Dataiterator *di)
 void
 dataiterator_setpos(Dataiterator *di)
 {
+  Datapos *pos;
   if (di->kv.eof == 2)
     {
       pool_clear_pos(di->pool);
       return;
     }
-  di->pool->pos.solvid = di->solvid;
-  di->pool->pos.repo = di->repo;
-  di->pool->pos.repodataid = di->data - di->repo->repodata;
-  di->pool->pos.schema = di->kv.id;
-  di->pool->pos.dp = (unsigned char *)di->kv.str - di->data->incoredata;
+  pos = pool_datapos(di->pool);
+  pos->solvid = di->solvid;
+  pos->repo = di->repo;
+  pos->repodataid = di->data - di->repo->repodata;
+  pos->schema = di->kv.id;
+  pos->dp = (unsigned char *)di->kv.str - di->data->incoredata;
 }
 
 void
 dataiterator_setpos_parent(Dataiterator *di)
 {
+  Datapos *pos;
   if (!di->kv.parent || di->kv.parent->eof == 2)
     {
       pool_clear_pos(di->pool);
       return;
     }
-  di->pool->pos.solvid = di->solvid;
-  di->pool->pos.repo = di->repo;
-  di->pool->pos.repodataid = di->data - di->repo->repodata;
-  di->pool->pos.schema = di->kv.parent->id;
-  di->pool->pos.dp = (unsigned char *)di->kv.parent->str - di->data->incoredata;
+  pos = pool_datapos(di->pool);
+  pos->solvid = di->solvid;
+  pos->repo = di->repo;
+  pos->repodataid = di->data - di->repo->repodata;
+  pos->schema = di->kv.parent->id;
+  pos->dp = (unsigned char *)di->kv.parent->str - di->data->incoredata;
 }
 
 /* clones just the position, not the search keys/matcher */
@@ -2165,17 +2444,18 @@ dataiterator_jump_to_solvid(Dataiterator *di, Id solvid)
   di->keyname = di->keynames[0];
   if (solvid == SOLVID_POS)
     {
-      di->repo = di->pool->pos.repo;
+      Datapos *pos = pool_datapos(di->pool);
+      di->repo = pos->repo;
       if (!di->repo)
 	{
 	  di->state = di_bye;
 	  return;
 	}
       di->repoid = 0;
-      if (!di->pool->pos.repodataid && di->pool->pos.solvid == SOLVID_META) {
+      if (!pos->repodataid && pos->solvid == SOLVID_META) {
 	solvid = SOLVID_META;		/* META pos hack */
       } else {
-        di->data = di->repo->repodata + di->pool->pos.repodataid;
+        di->data = di->repo->repodata + pos->repodataid;
         di->repodataid = 0;
       }
     }
@@ -3505,6 +3785,7 @@ repodata_internalize(Repodata *data)
   Id solvkeyid;
   Id *keylink;
   int haveoldkl;
+  int i;
 
   if (!data->attrs && !data->xattrs)
     return;
@@ -3760,12 +4041,281 @@ entrydone:
   data->attrdatalen = 0;
   data->attriddatalen = 0;
   data->attrnum64datalen = 0;
+
+  /* the incore data changed, drop the key indexes and refill the columns */
+  repodata_free_keyindex(data);
+  for (i = 0; i < data->ncolumns; i++)
+    repodata_fill_column(data, data->columns + i);
 #if 0
   printf("repodata_internalize %d done\n", data->repodataid);
   printf("  incore data: %d K\n", data->incoredatalen / 1024);
 #endif
 }
 
+/************************************************************************
+ * columns
+ *
+ * A column is a dense copy of the values of a num key, indexed by
+ * the solvable id. The values are still stored in the incore data,
+ * the column just speeds up lookups as we do not need to skip over
+ * the other keys of the solvable.
+ */
+
+Repodata_column *
+repodata_new_column(Repodata *data, Id keyid)
+{
+  Repodata_column *col;
+  int i;
+
+  for (i = 0; i < data->ncolumns; i++)
+    if (data->columns[i].key == keyid)
+      return data->columns + i;
+  data->columns = solv_extend(data->columns, data->ncolumns, 1, sizeof(Repodata_column), 7);
+  col = data->columns + data->ncolumns++;
+  memset(col, 0, sizeof(*col));
+  col->key = keyid;
+  col->start = col->end = data->start;
+  map_init(&col->present, 0);
+  return col;
+}
+
+void
+repodata_resize_column(Repodata_column *col, Id start, Id end)
+{
+  if (end < start)
+    end = start;
+  col->values = solv_free(col->values);
+  map_free(&col->present);
+  col->start = start;
+  col->end = end;
+  col->values = solv_calloc(end - start, sizeof(unsigned long long));
+  map_init(&col->present, end - start);
+}
+
+static void
+repodata_fill_column(Repodata *data, Repodata_column *col)
+{
+  Id p;
+  unsigned char *dp;
+  unsigned int high, low;
+
+  repodata_resize_column(col, data->start, data->end);
+  for (p = data->start; p < data->end; p++)
+    {
+      dp = solvid2keydata(data, p, col->key);
+      if (!dp)
+	continue;
+      data_read_num64(dp, &low, &high);
+      col->values[p - col->start] = (unsigned long long)high << 32 | low;
+      MAPSET(&col->present, p - col->start);
+    }
+}
+
+static void
+repodata_free_columns(Repodata *data)
+{
+  int i;
+  for (i = 0; i < data->ncolumns; i++)
+    {
+      solv_free(data->columns[i].values);
+      map_free(&data->columns[i].present);
+    }
+  data->columns = solv_free(data->columns);
+  data->ncolumns = 0;
+}
+
+int
+repodata_create_column(Repodata *data, Id keyname)
+{
+  Repokey key;
+  Id keyid;
+
+  if (!maybe_load_repodata(data, 0))
+    return 0;
+  key.name = keyname;
+  key.type = REPOKEY_TYPE_NUM;
+  key.size = 0;
+  key.storage = KEY_STORAGE_INCORE;
+  keyid = repodata_key2id(data, &key, 0);
+  if (!keyid || data->keys[keyid].storage != KEY_STORAGE_INCORE)
+    return 0;
+  repodata_fill_column(data, repodata_new_column(data, keyid));
+  return 1;
+}
+
+/************************************************************************
+ * id compaction
+ *
+ * pool_compact() support: mark (remap not set) or rewrite all the pool
+ * ids used in the keys, the incore data and the dirpool. The incore
+ * data needs to get encoded again as the size of the ids changes.
+ * The vertical data is not rewritten, pool_compact() refuses to work if
+ * it may contain pool ids, see repodata_has_vertical_ids().
+ */
+
+static unsigned char *compact_key(Repodata *data, unsigned char *dp, Repokey *key, struct extdata *xd, Id *strmap, Id *relmap, int remap);
+
+static unsigned char *
+compact_schema(Repodata *data, unsigned char *dp, Id schema, struct extdata *xd, Id *strmap, Id *relmap, int remap)
+{
+  Id *keyp = data->schemadata + data->schemata[schema];
+  for (; *keyp; keyp++)
+    dp = compact_key(data, dp, data->keys + *keyp, xd, strmap, relmap, remap);
+  return dp;
+}
+
+static unsigned char *
+compact_key(Repodata *data, unsigned char *dp, Repokey *key, struct extdata *xd, Id *strmap, Id *relmap, int remap)
+{
+  Pool *pool = data->repo->pool;
+  unsigned char *odp = dp;
+  Id id, nentries, schema;
+  int eof;
+
+  if (key->storage == KEY_STORAGE_INCORE)
+    {
+      switch (key->type)
+	{
+	case REPOKEY_TYPE_ID:
+	  if (data->localpool)
+	    break;
+	  dp = data_read_id(dp, &id);
+	  id = pool_compact_id(pool, strmap, relmap, id, remap);
+	  if (xd)
+	    data_addid(xd, id);
+	  return dp;
+	case REPOKEY_TYPE_IDARRAY:
+	case REPOKEY_TYPE_REL_IDARRAY:
+	  if (data->localpool)
+	    break;
+	  do
+	    {
+	      dp = data_read_ideof(dp, &id, &eof);
+	      id = pool_compact_id(pool, strmap, relmap, id, remap);
+	      if (xd)
+		data_addideof(xd, id, eof);
+	    }
+	  while (!eof);
+	  return dp;
+	case REPOKEY_TYPE_FIXARRAY:
+	  dp = data_read_id(dp, &nentries);
+	  if (xd)
+	    data_addid(xd, nentries);
+	  if (!nentries)
+	    return dp;
+	  dp = data_read_id(dp, &schema);
+	  if (xd)
+	    data_addid(xd, schema);
+	  while (nentries--)
+	    dp = compact_schema(data, dp, schema, xd, strmap, relmap, remap);
+	  return dp;
+	case REPOKEY_TYPE_FLEXARRAY:
+	  dp = data_read_id(dp, &nentries);
+	  if (xd)
+	    data_addid(xd, nentries);
+	  while (nentries--)
+	    {
+	      dp = data_read_id(dp, &schema);
+	      if (xd)
+		data_addid(xd, schema);
+	      dp = compact_schema(data, dp, schema, xd, strmap, relmap, remap);
+	    }
+	  return dp;
+	default:
+	  break;
+	}
+    }
+  dp = data_skip_key(data, dp, key);
+  if (xd && dp != odp)
+    data_addblob(xd, odp, dp - odp);
+  return dp;
+}
+
+/* check if a vertical key may contain pool ids. The solv reader does
+ * not allow this, but it can happen with repodata created in memory */
+int
+repodata_has_vertical_ids(Repodata *data)
+{
+  Repokey *key;
+  int i;
+
+  if (data->localpool)
+    return 0;
+  for (i = 1, key = data->keys + 1; i < data->nkeys; i++, key++)
+    if (key->storage == KEY_STORAGE_VERTICAL_OFFSET && (key->type == REPOKEY_TYPE_ID || key->type == REPOKEY_TYPE_IDARRAY || key->type == REPOKEY_TYPE_REL_IDARRAY))
+      return 1;
+  return 0;
+}
+
+void
+repodata_compact_ids(Repodata *data, Id *strmap, Id *relmap, int remap)
+{
+  Pool *pool = data->repo->pool;
+  struct extdata newincore, *xd = 0;
+  Repokey *key;
+  Id *keyp, schema;
+  unsigned char *dp;
+  int i;
+
+  for (i = 1, key = data->keys + 1; i < data->nkeys; i++, key++)
+    {
+      key->name = pool_compact_id(pool, strmap, relmap, key->name, remap);
+      if (key->type == REPOKEY_TYPE_CONSTANTID && !data->localpool)
+	key->size = pool_compact_id(pool, strmap, relmap, key->size, remap);
+    }
+  if (!data->localpool)
+    for (i = 1; i < data->dirpool.ndirs; i++)
+      if (data->dirpool.dirs[i] > 0)
+	data->dirpool.dirs[i] = pool_compact_id(pool, strmap, relmap, data->dirpool.dirs[i], remap);
+  if (remap)
+    {
+      repodata_free_dirhash(data);	/* the components changed */
+      memset(data->keybits, 0, sizeof(data->keybits));
+      for (i = 1, key = data->keys + 1; i < data->nkeys; i++, key++)
+	data->keybits[(key->name >> 3) & (sizeof(data->keybits) - 1)] |= 1 << (key->name & 7);
+    }
+  if (!data->incoredata || data->incoredatalen <= 1)
+    return;
+
+  if (remap)
+    {
+      memset(&newincore, 0, sizeof(newincore));
+      data_addid(&newincore, 0);	/* start data at offset 1 */
+      xd = &newincore;
+    }
+  /* the meta data */
+  dp = data_read_id(data->incoredata + 1, &schema);
+  if (xd)
+    data_addid(xd, schema);
+  keyp = data->schemadata + data->schemata[schema];
+  for (i = 0; keyp[i]; i++)
+    {
+      if (xd && data->mainschemaoffsets && schema == data->mainschema)
+	data->mainschemaoffsets[i] = xd->len;
+      dp = compact_key(data, dp, data->keys + keyp[i], xd, strmap, relmap, remap);
+    }
+  /* the solvables */
+  for (i = 0; i < data->end - data->start; i++)
+    {
+      if (!data->incoreoffset[i])
+	continue;
+      dp = data_read_id(data->incoredata + data->incoreoffset[i], &schema);
+      if (xd)
+	{
+	  data->incoreoffset[i] = xd->len;
+	  data_addid(xd, schema);
+	}
+      compact_schema(data, dp, schema, xd, strmap, relmap, remap);
+    }
+  if (!xd)
+    return;
+  solv_free(data->incoredata);
+  data->incoredata = newincore.buf;
+  data->incoredatalen = newincore.len;
+  data->incoredatafree = 0;
+  repodata_free_keyindex(data);
+}
+
 void
 repodata_disable_paging(Repodata *data)
 {
@@ -3913,3 +4463,130 @@ repodata_memused(Repodata *data)
   return data->incoredatalen + data->vincorelen;
 }
 
+static size_t
+attrs_memused(Id **attrs, int nattrs)
+{
+  size_t size = (size_t)nattrs * sizeof(Id *);
+  Id *ap;
+  int i;
+  for (i = 0; i < nattrs; i++)
+    if ((ap = attrs[i]) != 0)
+      {
+	while (*ap)
+	  ap += 2;
+	size += (ap - attrs[i] + 1) * sizeof(Id);
+      }
+  return size;
+}
+
+/* add the memory used by the repodata to the stats */
+void
+repodata_memstats(Repodata *data, Pool_memstats *stats)
+{
+  Repopagestore *store = &data->store;
+  size_t n = data->end - data->start;
+  size_t ss = 0, incore = 0, attr = 0, pages = 0, schemata = 0;
+  int i;
+
+  if (data->localpool)
+    ss += stringpool_memused(&data->spool);
+
+  incore += data->incoredatalen + data->incoredatafree + data->vincorelen;
+  if (data->incoreoffset)
+    incore += n * sizeof(Id);
+  if (data->verticaloffset)
+    incore += data->nkeys * sizeof(Id);
+  if (data->mainschemaoffsets)
+    for (i = 0; data->schemadata[data->schemata[data->mainschema] + i]; i++)
+      incore += sizeof(Id);
+  incore += data->dirpool.ndirs * sizeof(Id);
+  if (data->dirpool.dirtraverse)
+    incore += data->dirpool.ndirs * sizeof(Id);
+  if (data->dirhash)
+    incore += sizeof(struct dirhash) + 2 * ((size_t)data->dirhash->mask + 1) * sizeof(Id);
+  for (i = 0; i < data->ncolumns; i++)
+    incore += sizeof(Repodata_column) + (size_t)(data->columns[i].end - data->columns[i].start) * sizeof(unsigned long long) + data->columns[i].present.size;
+  for (i = 0; i < data->nkeyindex; i++)
+    incore += sizeof(Repodata_keyindex) + (size_t)(data->keyindex[i].end - data->keyindex[i].start) * sizeof(Id);
+
+  if (data->attrs)
+    attr += attrs_memused(data->attrs, n);
+  if (data->xattrs)
+    attr += attrs_memused(data->xattrs, data->nxattrs);
+  attr += data->attrdatalen + data->attriddatalen * sizeof(Id) + data->attrnum64datalen * sizeof(unsigned long long);
+#ifdef DIRCACHE_SIZE
+  if (data->dircache)
+    attr += sizeof(struct dircache);
+#endif
+
+  if (store->blob_store)
+    pages += (size_t)(store->file_pages || store->mapping ? store->nmapped : store->num_pages) * REPOPAGE_BLOBSIZE;
+  if (store->mapped_at)
+    pages += store->num_pages * sizeof(unsigned int);
+  if (store->file_pages)
+    pages += store->num_pages * sizeof(Attrblobpage);
+  if (store->mapped)
+    pages += store->nmapped * sizeof(unsigned int);
+  if (store->lastuse)
+    pages += store->nmapped * sizeof(unsigned int);
+
+  schemata += data->nkeys * sizeof(Repokey);
+  schemata += (data->nschemata + data->schemadatalen) * sizeof(Id);
+  if (data->schematahash)
+    schemata += 256 * sizeof(Id);
+
+  stats->stringspace += ss;
+  stats->incore += incore;
+  stats->attr += attr;
+  stats->pages += pages;
+  stats->schemata += schemata;
+  stats->total += ss + incore + attr + pages + schemata;
+}
+
+static void
+memused_schema(Repodata *data, unsigned char *dp, Id schema, size_t *keysizes)
+{
+  Id *keyp, len;
+  unsigned char *ndp;
+
+  for (keyp = data->schemadata + data->schemata[schema]; *keyp; keyp++, dp = ndp)
+    {
+      ndp = data_skip_key(data, dp, data->keys + *keyp);
+      if (data->keys[*keyp].name == REPOSITORY_SOLVABLES)
+	continue;	/* counted with the solvables */
+      keysizes[*keyp] += ndp - dp;
+      if (data->keys[*keyp].storage == KEY_STORAGE_VERTICAL_OFFSET)
+	{
+	  data_read_id(data_skip(dp, REPOKEY_TYPE_ID), &len);
+	  keysizes[*keyp] += len;
+	}
+    }
+}
+
+/* size of the internalized data of every key, including vertical
+ * data that is not paged in. Arrays include the data of their sub
+ * keys. keysizes must have data->nkeys elements. */
+void
+repodata_memused_keys(Repodata *data, size_t *keysizes)
+{
+  Repodata_column *col;
+  unsigned char *dp;
+  Id schema;
+  int i;
+
+  memset(keysizes, 0, data->nkeys * sizeof(size_t));
+  for (i = 0, col = data->columns; i < data->ncolumns; i++, col++)
+    keysizes[col->key] += (size_t)(col->end - col->start) * sizeof(unsigned long long) + col->present.size;
+  if (!data->incoredata || data->incoredatalen <= 1)
+    return;
+  dp = data_read_id(data->incoredata + 1, &schema);
+  memused_schema(data, dp, schema, keysizes);
+  for (i = 0; i < data->end - data->start; i++)
+    {
+      if (!data->incoreoffset[i])
+	continue;
+      dp = data_read_id(data->incoredata + data->incoreoffset[i], &schema);
+      memused_schema(data, dp, schema, keysizes);
+    }
+}
+
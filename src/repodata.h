@@ -48,9 +48,28 @@ typedef struct s_Repokey {
 #define KEY_STORAGE_INCORE              2
 #define KEY_STORAGE_VERTICAL_OFFSET     3
 #define KEY_STORAGE_IDARRAYBLOCK	4
+#define KEY_STORAGE_COLUMN		5
 
 #ifdef LIBSOLV_INTERNAL
 struct dircache;
+struct dirhash;
+
+/* dense copy of the solvable values of a num key */
+typedef struct s_Repodata_column {
+  Id key;			/* key id of the column */
+  Id start;			/* first solvable of the column */
+  Id end;			/* last solvable + 1 */
+  unsigned long long *values;	/* values, end - start elements */
+  Map present;			/* solvable has a value */
+} Repodata_column;
+
+/* offset of the data of a key, indexed by solvable */
+typedef struct s_Repodata_keyindex {
+  Id key;			/* key id of the index */
+  Id start;			/* first solvable of the index */
+  Id end;			/* last solvable + 1 */
+  Id *offsets;			/* offset into incoredata, 0: key not set */
+} Repodata_keyindex;
 #endif
 
 /* repodata states */
@@ -137,6 +156,15 @@ struct s_Repodata {
 
   /* directory cache to speed up repodata_str2dir */
   struct dircache *dircache;
+  /* (parent, comp) -> dir hash for big dirpools */
+  struct dirhash *dirhash;
+
+  Repodata_column *columns;	/* columnar num keys */
+  int ncolumns;			/* number of columns */
+
+  Repodata_keyindex *keyindex;	/* offset indexes for often used keys */
+  int nkeyindex;		/* number of indexes */
+  unsigned char keylookups[64];	/* lookup counters, hashed by key id */
 #endif
 
 };
@@ -311,6 +339,22 @@ Repodata *repodata_create_stubs(Repodata *data);
  */
 void repodata_disable_paging(Repodata *data);
 
+/*
+ * keep the solvable values of a num key in a dense array for
+ * fast lookups. The key is written with column storage.
+ */
+int repodata_create_column(Repodata *data, Id keyname);
+#ifdef LIBSOLV_INTERNAL
+Repodata_column *repodata_new_column(Repodata *data, Id keyid);
+void repodata_resize_column(Repodata_column *col, Id start, Id end);
+#endif
+
+#ifdef LIBSOLV_INTERNAL
+/* mark or rewrite the pool ids used in the data, see pool_compact() */
+void repodata_compact_ids(Repodata *data, Id *strmap, Id *relmap, int remap);
+int repodata_has_vertical_ids(Repodata *data);
+#endif
+
 /* helper functions */
 Id repodata_globalize_id(Repodata *data, Id id, int create);
 Id repodata_localize_id(Repodata *data, Id id, int create);
@@ -330,6 +374,8 @@ void repodata_search_uninternalized(Repodata *data, Id solvid, Id keyname, int f
 
 /* stats */
 unsigned int repodata_memused(Repodata *data);
+void repodata_memstats(Repodata *data, Pool_memstats *stats);
+void repodata_memused_keys(Repodata *data, size_t *keysizes);
 
 static inline Id
 repodata_translate_dir(Repodata *data, Repodata *fromdata, Id dir, int create, Id *cache)
@@ -18,7 +18,7 @@
  * pages automatically get dropped.
  */
 
-#define _XOPEN_SOURCE 500
+#define _XOPEN_SOURCE 600
 
 #include <sys/types.h>
 #include <stdint.h>
@@ -34,6 +34,18 @@
   #include <windows.h>
   #include <fileapi.h>
   #include <io.h>
+#else
+  #include <sys/mman.h>
+  #include <sys/stat.h>
+#endif
+
+#ifdef ENABLE_ZSTD_PAGES
+#include <zstd.h>
+#include <zdict.h>
+#endif
+
+#ifdef ENABLE_PTHREADS
+#include <pthread.h>
 #endif
 
 #include "repo.h"
@@ -606,33 +618,470 @@ void repopagestore_init(Repopagestore *store)
   store->pagefd = -1;
 }
 
+#if defined(ENABLE_PTHREADS) && !defined(_WIN32)
+static void readahead_free(struct s_Repopagereadahead *ra);
+#endif
+
 void repopagestore_free(Repopagestore *store)
 {
+#if defined(ENABLE_PTHREADS) && !defined(_WIN32)
+  if (store->ra)
+    readahead_free(store->ra);
+#endif
+  store->ra = 0;
+  if (store->cache)
+    store->cache->used -= (size_t)store->nmapped * REPOPAGE_BLOBSIZE;
+  store->nmapped = 0;
   store->blob_store = solv_free(store->blob_store);
   store->file_pages = solv_free(store->file_pages);
   store->mapped_at = solv_free(store->mapped_at);
   store->mapped = solv_free(store->mapped);
+  store->lastuse = solv_free(store->lastuse);
   if (store->pagefd != -1)
     close(store->pagefd);
   store->pagefd = -1;
+  repopagestore_munmap(store);
+  store->codec = repopagecodec_free(store->codec);
+}
+
+/* move the store to another page cache, e.g. when the repodata
+ * moves to a different pool */
+void
+repopagestore_set_cache(Repopagestore *store, Repopagecache *cache)
+{
+  size_t used = (size_t)store->nmapped * REPOPAGE_BLOBSIZE;
+  if (store->cache)
+    store->cache->used -= used;
+  store->cache = cache;
+  if (cache)
+    cache->used += used;
+}
+
+/* find the page headers in the mapping up to page pend. We do this
+ * on demand so that the setup does not need to touch all pages. */
+static int
+locate_mapped_pages(Repopagestore *store, unsigned int pend)
+{
+  unsigned int i = store->nfile_pages;
+  size_t off = 0, left;
+  unsigned char *dp;
+
+  if (pend >= store->num_pages)
+    return 0;
+  if (i)
+    off = store->file_pages[i - 1].page_offset + (store->file_pages[i - 1].page_size >> 1);
+  left = store->mappingsize - store->file_offset;
+  for (; i <= pend; i++)
+    {
+      Attrblobpage *p = store->file_pages + i;
+      unsigned int in_len;
+      if (left - off < 4)
+	return 0;
+      dp = store->mapping + store->file_offset + off;
+      in_len = (unsigned int)dp[0] << 24 | dp[1] << 16 | dp[2] << 8 | dp[3];
+      off += 4;
+      if (left - off < in_len >> 1 || (in_len >> 1) > REPOPAGE_BLOBSIZE)
+	return 0;
+      p->page_offset = off;
+      p->page_size = in_len;
+      off += in_len >> 1;
+    }
+  store->nfile_pages = i;
+  return 1;
 }
 
 
 /**********************************************************************/
 
-unsigned char *
-repopagestore_load_page_range(Repopagestore *store, unsigned int pstart, unsigned int pend)
+#define REPOPAGE_MINSLOTS	4
+#define REPOPAGE_READAHEAD	8
+
+/* grow the number of page slots to nmapped */
+static void
+grow_slots(Repopagestore *store, unsigned int nmapped)
+{
+  unsigned int i, oldcan = store->nmapped;
+  store->mapped = solv_realloc2(store->mapped, nmapped, sizeof(store->mapped[0]));
+  store->lastuse = solv_realloc2(store->lastuse, nmapped, sizeof(store->lastuse[0]));
+  for (i = oldcan; i < nmapped; i++)
+    {
+      store->mapped[i] = -1;
+      store->lastuse[i] = 0;
+    }
+  store->blob_store = solv_realloc2(store->blob_store, nmapped, REPOPAGE_BLOBSIZE);
+  store->nmapped = nmapped;
+  if (store->cache)
+    store->cache->used += (size_t)(nmapped - oldcan) * REPOPAGE_BLOBSIZE;
+#ifdef DEBUG_PAGING
+  fprintf(stderr, "PAGE: can map %d pages\n", store->nmapped);
+#endif
+}
+
+/* return how many slots the store may add without exceeding the
+ * growth allowance of the cache. We double the number of slots at most. */
+static unsigned int
+growth_slots(Repopagestore *store)
+{
+  Repopagecache *cache = store->cache;
+  size_t room;
+  unsigned int add = store->nmapped;
+
+  if (!cache || !cache->growth || cache->used >= cache->growth)
+    return 0;
+  room = (cache->growth - cache->used) / REPOPAGE_BLOBSIZE;
+  if (add > room)
+    add = room;
+  if (add > store->num_pages - store->nmapped)
+    add = store->num_pages - store->nmapped;
+  return add;
+}
+
+/* mark the slots starting at slot as recently used */
+static void
+touch_slots(Repopagestore *store, unsigned int slot, unsigned int n)
+{
+  if (!++store->usecounter)
+    {
+      /* wrapped around, start over */
+      memset(store->lastuse, 0, store->nmapped * sizeof(store->lastuse[0]));
+      store->usecounter = 1;
+    }
+  while (n--)
+    store->lastuse[slot++] = store->usecounter;
+}
+
+/* the mapped pages pstart..pend were requested again */
+static inline void
+cache_hit(Repopagestore *store, unsigned int pstart, unsigned int pend)
+{
+  /* no bookkeeping in a frozen pool, we may be used by multiple
+   * threads in that case */
+  if (!store->file_pages || (store->cache && store->cache->frozen))
+    return;
+  touch_slots(store, store->mapped_at[pstart] / REPOPAGE_BLOBSIZE, pend - pstart + 1);
+  store->lastpage = pend;
+  if (store->cache)
+    store->cache->hits += pend - pstart + 1;
+}
+
+/* find n consecutive slots that were not used for the longest time.
+ * Returns the first slot, stampp is set to the most recent use of
+ * the slots (zero if all of them are free). */
+static unsigned int
+lru_slots(Repopagestore *store, unsigned int n, unsigned int *stampp)
+{
+  unsigned int i, j, stamp, best = 0, beststamp = -1;
+
+  for (i = 0; i + n <= store->nmapped; i++)
+    {
+      for (stamp = 0, j = i; j < i + n; j++)
+	if (store->mapped[j] != -1 && store->lastuse[j] > stamp)
+	  stamp = store->lastuse[j];
+      if (stamp < beststamp)
+	{
+	  best = i;
+	  beststamp = stamp;
+	  if (!stamp)
+	    break;
+	}
+    }
+  *stampp = beststamp;
+  return best;
+}
+
+/* tell the system that we will soon need the pages starting at pstart */
+static void
+readahead_pages(Repopagestore *store, unsigned int pstart)
+{
+#ifndef _WIN32
+  unsigned int pend = pstart + REPOPAGE_READAHEAD - 1;
+  Attrblobpage *ps, *pe;
+  size_t off, len;
+
+  if (pstart < store->readahead)
+    pstart = store->readahead;
+  if (pend >= store->num_pages)
+    pend = store->num_pages - 1;
+  if (pstart > pend || !store->file_pages)
+    return;
+  if (store->mapping && pend >= store->nfile_pages && !locate_mapped_pages(store, pend))
+    return;
+  ps = store->file_pages + pstart;
+  pe = store->file_pages + pend;
+  off = store->file_offset + ps->page_offset;
+  len = pe->page_offset + (pe->page_size >> 1) - ps->page_offset;
+  if (store->mapping)
+    {
+#ifdef POSIX_MADV_WILLNEED
+      long pgsz = sysconf(_SC_PAGESIZE);
+      if (pgsz > 0)
+	{
+	  len += off % pgsz;
+	  off -= off % pgsz;
+	  posix_madvise(store->mapping + off, len, POSIX_MADV_WILLNEED);
+	}
+#endif
+    }
+  else
+    {
+#ifdef POSIX_FADV_WILLNEED
+      posix_fadvise(store->pagefd, (off_t)off, (off_t)len, POSIX_FADV_WILLNEED);
+#endif
+    }
+  store->readahead = pend + 1;
+  if (store->cache)
+    store->cache->readaheads += pend - pstart + 1;
+#endif
+}
+
+/* read page pnum into dest, codec is used for decompression and buf
+ * for the compressed data. Returns the number of decompressed bytes
+ * (zero for an uncompressed page) or -1 on error. */
+static int
+read_page(Repopagestore *store, Repopagecodec *codec, unsigned int pnum, unsigned char *dest, unsigned char *buf)
+{
+  Attrblobpage *p = store->file_pages + pnum;
+  unsigned int in_len = p->page_size;
+  unsigned int compressed = in_len & 1;
+  unsigned char *src = compressed ? buf : dest;
+  unsigned int out_len;
+
+  in_len >>= 1;
+  if (store->mapping)
+    {
+      /* decompress straight from the mapping */
+      if (compressed)
+	src = store->mapping + store->file_offset + p->page_offset;
+      else
+	memcpy(dest, store->mapping + store->file_offset + p->page_offset, in_len);
+    }
+  else
+    {
+#ifndef _WIN32
+      if (pread(store->pagefd, src, in_len, store->file_offset + p->page_offset) != in_len)
+	{
+	  perror("mapping pread");
+	  return -1;
+	}
+#else
+      DWORD read_len;
+      OVERLAPPED ovlp = {0};
+      ovlp.Offset = store->file_offset + p->page_offset;
+      if (!ReadFile((HANDLE) _get_osfhandle(store->pagefd), src, in_len, &read_len, &ovlp) || read_len != in_len)
+	{
+	  perror("mapping ReadFile");
+	  return -1;
+	}
+#endif
+    }
+  if (!compressed)
+    return 0;
+  out_len = repopagecodec_decompress(codec, src, in_len, dest, REPOPAGE_BLOBSIZE);
+  if (out_len != REPOPAGE_BLOBSIZE && pnum < store->num_pages - 1)
+    {
+#ifdef DEBUG_PAGING
+      fprintf(stderr, "can't decompress\n");
+#endif
+      return -1;
+    }
+#ifdef DEBUG_PAGING
+  fprintf(stderr, " (expand %d to %d)", in_len, out_len);
+#endif
+  return out_len;
+}
+
+#if defined(ENABLE_PTHREADS) && !defined(_WIN32)
+
+/* asynchronous read-ahead: a thread loads and decompresses the pages
+ * following a sequential scan into its own buffers, page n goes into
+ * buffer n % nbufs. The thread only uses a copy of the file related
+ * store data as the store itself may get moved around. */
+
+#define RA_EMPTY	0
+#define RA_LOADING	1
+#define RA_READY	2
+
+struct s_Repopagereadahead {
+  pthread_t thread;
+  pthread_mutex_t lock;
+  pthread_cond_t work;		/* new pages to load or quit */
+  pthread_cond_t done;		/* a page got loaded */
+  Repopagestore file;		/* pagefd, mapping and file_pages of the store */
+  Repopagecodec *codec;		/* our own decompression context */
+  unsigned int nbufs;
+  unsigned char *bufs;
+  unsigned int *page;		/* page in the buffer */
+  int *len;			/* result of read_page() */
+  unsigned char *state;
+  unsigned int next;		/* pages next..end-1 need to be loaded */
+  unsigned int end;
+  int quit;
+};
+
+static Repopagecodec *repopagecodec_dup(Repopagecodec *codec);
+
+static void *
+readahead_thread(void *vp)
 {
+  struct s_Repopagereadahead *ra = vp;
+  unsigned char buf[REPOPAGE_BLOBSIZE];
+  unsigned int pnum, b;
+  int r;
+
+  pthread_mutex_lock(&ra->lock);
+  for (;;)
+    {
+      while (!ra->quit && ra->next >= ra->end)
+	pthread_cond_wait(&ra->work, &ra->lock);
+      if (ra->quit)
+	break;
+      pnum = ra->next++;
+      b = pnum % ra->nbufs;
+      if (ra->page[b] == pnum && ra->state[b] != RA_EMPTY)
+	continue;
+      ra->page[b] = pnum;
+      ra->state[b] = RA_LOADING;
+      pthread_mutex_unlock(&ra->lock);
+      r = read_page(&ra->file, ra->codec, pnum, ra->bufs + b * REPOPAGE_BLOBSIZE, buf);
+      pthread_mutex_lock(&ra->lock);
+      ra->len[b] = r;
+      ra->state[b] = r >= 0 ? RA_READY : RA_EMPTY;
+      pthread_cond_broadcast(&ra->done);
+    }
+  pthread_mutex_unlock(&ra->lock);
+  return 0;
+}
+
+static void
+readahead_free(struct s_Repopagereadahead *ra)
+{
+  pthread_mutex_lock(&ra->lock);
+  ra->quit = 1;
+  pthread_cond_signal(&ra->work);
+  pthread_mutex_unlock(&ra->lock);
+  pthread_join(ra->thread, 0);
+  pthread_cond_destroy(&ra->done);
+  pthread_cond_destroy(&ra->work);
+  pthread_mutex_destroy(&ra->lock);
+  repopagecodec_free(ra->codec);
+  solv_free(ra->bufs);
+  solv_free(ra->page);
+  solv_free(ra->len);
+  solv_free(ra->state);
+  solv_free(ra);
+}
+
+static struct s_Repopagereadahead *
+readahead_create(Repopagestore *store, unsigned int nbufs)
+{
+  struct s_Repopagereadahead *ra = solv_calloc(1, sizeof(*ra));
+  unsigned int i;
+
+  ra->file.pagefd = store->pagefd;
+  ra->file.file_offset = store->file_offset;
+  ra->file.num_pages = store->num_pages;
+  ra->file.file_pages = store->file_pages;
+  ra->file.mapping = store->mapping;
+  ra->file.mappingsize = store->mappingsize;
+  ra->codec = store->codec ? repopagecodec_dup(store->codec) : 0;
+  ra->nbufs = nbufs;
+  ra->bufs = solv_malloc2(nbufs, REPOPAGE_BLOBSIZE);
+  ra->page = solv_malloc2(nbufs, sizeof(unsigned int));
+  for (i = 0; i < nbufs; i++)
+    ra->page[i] = -1;
+  ra->len = solv_calloc(nbufs, sizeof(int));
+  ra->state = solv_calloc(nbufs, 1);
+  pthread_mutex_init(&ra->lock, 0);
+  pthread_cond_init(&ra->work, 0);
+  pthread_cond_init(&ra->done, 0);
+  if (pthread_create(&ra->thread, 0, readahead_thread, ra))
+    {
+      pthread_cond_destroy(&ra->done);
+      pthread_cond_destroy(&ra->work);
+      pthread_mutex_destroy(&ra->lock);
+      repopagecodec_free(ra->codec);
+      solv_free(ra->bufs);
+      solv_free(ra->page);
+      solv_free(ra->len);
+      solv_free(ra->state);
+      return solv_free(ra);
+    }
+  return ra;
+}
+
+/* let the read-ahead thread load the pages starting at pstart */
+static void
+readahead_request(Repopagestore *store, unsigned int pstart)
+{
+  struct s_Repopagereadahead *ra = store->ra;
+  unsigned int pend;
+
+  if (!store->file_pages)
+    return;
+  if (!ra && (ra = store->ra = readahead_create(store, store->cache->asyncpages)) == 0)
+    return;
+  pend = pstart + ra->nbufs;
+  if (pend > store->num_pages)
+    pend = store->num_pages;
+  if (pstart >= pend)
+    return;
+  /* the thread must not touch the page headers of the mapping */
+  if (store->mapping && pend > store->nfile_pages && !locate_mapped_pages(store, pend - 1))
+    return;
+  pthread_mutex_lock(&ra->lock);
+  if (ra->next < pstart || ra->next > pend)
+    ra->next = pstart;
+  ra->end = pend;
+  pthread_cond_signal(&ra->work);
+  pthread_mutex_unlock(&ra->lock);
+}
+
+/* copy page pnum from the read-ahead buffers, waits if the page is
+ * currently loaded. Returns -1 if the page is not available. */
+static int
+readahead_fetch(struct s_Repopagereadahead *ra, unsigned int pnum, unsigned char *dest)
+{
+  unsigned int b = pnum % ra->nbufs;
+  int r = -1;
+
+  pthread_mutex_lock(&ra->lock);
+  if (ra->page[b] == pnum)
+    {
+      while (ra->state[b] == RA_LOADING)
+	pthread_cond_wait(&ra->done, &ra->lock);
+      if (ra->state[b] == RA_READY)
+	{
+	  memcpy(dest, ra->bufs + b * REPOPAGE_BLOBSIZE, REPOPAGE_BLOBSIZE);
+	  r = ra->len[b];
+	}
+    }
+  pthread_mutex_unlock(&ra->lock);
+  return r;
+}
+
+#endif
+
 /* Make sure all pages from PSTART to PEND (inclusive) are loaded,
-   and are consecutive.  Return a pointer to the mapping of PSTART.  */
+   and are consecutive.  Return a pointer to the mapping of PSTART.
+   If DIRECT is set, a single uncompressed page of a mapped file is
+   returned without loading it into a slot. */
+static unsigned char *
+load_page_range(Repopagestore *store, unsigned int pstart, unsigned int pend, int direct)
+{
   unsigned char buf[REPOPAGE_BLOBSIZE];
-  unsigned int i, best, pnum;
+  unsigned int i, best, pnum, stamp;
+  unsigned int n = pend - pstart + 1;
+  Repopagecache *cache = store->cache;
+  int sequential;
 
   if (pstart == pend)
     {
       /* Quick check in case the requested page is already mapped */
       if (store->mapped_at[pstart] != -1)
-	return store->blob_store + store->mapped_at[pstart];
+	{
+	  cache_hit(store, pstart, pend);
+	  return store->blob_store + store->mapped_at[pstart];
+	}
     }
   else
     {
@@ -644,10 +1093,33 @@ repopagestore_load_page_range(Repopagestore *store, unsigned int pstart, unsigne
 		   != store->mapped_at[pnum-1] + REPOPAGE_BLOBSIZE))
 	  break;
       if (pnum > pend)
-	return store->blob_store + store->mapped_at[pstart];
+	{
+	  cache_hit(store, pstart, pend);
+	  return store->blob_store + store->mapped_at[pstart];
+	}
     }
 
-  if (store->pagefd == -1 || !store->file_pages)
+  /* a scan that moves forward page by page gets a read-ahead hint */
+  sequential = pstart >= store->lastpage && pstart <= store->lastpage + 1;
+  store->lastpage = pend;
+
+  if (store->mapping)
+    {
+      Attrblobpage *p;
+      if (pend >= store->nfile_pages && !locate_mapped_pages(store, pend))
+	return 0;
+      /* uncompressed pages can be used directly */
+      p = store->file_pages + pstart;
+      if (direct && pstart == pend && !(p->page_size & 1) && ((p->page_size >> 1) == REPOPAGE_BLOBSIZE || pstart == store->num_pages - 1))
+	{
+	  if (sequential)
+	    readahead_pages(store, pend + 1);
+	  if (cache)
+	    cache->hits++;
+	  return store->mapping + store->file_offset + p->page_offset;
+	}
+    }
+  else if (store->pagefd == -1 || !store->file_pages)
     return 0;	/* no backing file */
 
 #ifdef DEBUG_PAGING
@@ -655,27 +1127,22 @@ repopagestore_load_page_range(Repopagestore *store, unsigned int pstart, unsigne
 #endif
 
   /* Ensure that we can map the numbers of pages we need at all.  */
-  if (pend - pstart + 1 > store->nmapped)
-    {
-      unsigned int oldcan = store->nmapped;
-      store->nmapped = pend - pstart + 1;
-      if (store->nmapped < 4)
-        store->nmapped = 4;
-      store->mapped = solv_realloc2(store->mapped, store->nmapped, sizeof(store->mapped[0]));
-      for (i = oldcan; i < store->nmapped; i++)
-	store->mapped[i] = -1;
-      store->blob_store = solv_realloc2(store->blob_store, store->nmapped, REPOPAGE_BLOBSIZE);
-#ifdef DEBUG_PAGING
-      fprintf(stderr, "PAGE: can map %d pages\n", store->nmapped);
-#endif
-    }
+  if (n > store->nmapped)
+    grow_slots(store, n < REPOPAGE_MINSLOTS ? REPOPAGE_MINSLOTS : n);
 
   if (store->mapped_at[pstart] != -1)
     {
       /* assume forward search */
       best = store->mapped_at[pstart] / REPOPAGE_BLOBSIZE;
       if (best + (pend - pstart) >= store->nmapped)
-	best = 0;
+	{
+	  /* wrap around unless we may add more slots */
+	  unsigned int add = growth_slots(store);
+	  if (add >= best + n - store->nmapped)
+	    grow_slots(store, store->nmapped + add);
+	  else
+	    best = 0;
+	}
     }
   else if (store->mapped_at[pend] != -1)
     {
@@ -687,8 +1154,18 @@ repopagestore_load_page_range(Repopagestore *store, unsigned int pstart, unsigne
     }
   else
     {
-      /* choose some "random" location to avoid thrashing */
-      best = (pstart + store->rr_counter++) % (store->nmapped - pend + pstart);
+      /* use the least recently used slots. If they are still in use
+       * and the growth allowance permits it, add new slots instead */
+      best = lru_slots(store, n, &stamp);
+      if (stamp)
+	{
+	  unsigned int add = growth_slots(store);
+	  if (add >= n)
+	    {
+	      best = store->nmapped;
+	      grow_slots(store, store->nmapped + add);
+	    }
+	}
     }
 
   /* So we want to map our pages from [best] to [best+pend-pstart].
@@ -709,6 +1186,8 @@ repopagestore_load_page_range(Repopagestore *store, unsigned int pstart, unsigne
 #endif
 	  store->mapped[i] = -1;
 	  store->mapped_at[oldpnum] = -1;
+	  if (cache)
+	    cache->evictions++;
 	}
       /* check if we can copy the correct content (before it gets evicted) */
       pnum_mapped_at = store->mapped_at[pnum];
@@ -741,54 +1220,42 @@ repopagestore_load_page_range(Repopagestore *store, unsigned int pstart, unsigne
 	      memcpy(dest, store->blob_store + pnum_mapped_at, REPOPAGE_BLOBSIZE);
 	      store->mapped[pnum_mapped_at / REPOPAGE_BLOBSIZE] = -1;
 	    }
+	  if (cache)
+	    cache->hits++;
 	}
       else
         {
-	  Attrblobpage *p = store->file_pages + pnum;
-	  unsigned int in_len = p->page_size;
-	  unsigned int compressed = in_len & 1;
-	  in_len >>= 1;
+	  int r = -1;
 #ifdef DEBUG_PAGING
 	  fprintf(stderr, "PAGEIN: %d to %d", pnum, i);
 #endif
-#ifndef _WIN32
-          if (pread(store->pagefd, compressed ? buf : dest, in_len, store->file_offset + p->page_offset) != in_len)
-	    {
-	      perror("mapping pread");
-	      return 0;
-	    }
-#else
-	  DWORD read_len;
-	  OVERLAPPED ovlp = {0};
-	  ovlp.Offset = store->file_offset + p->page_offset;
-	  if (!ReadFile((HANDLE) _get_osfhandle(store->pagefd), compressed ? buf : dest, in_len, &read_len, &ovlp) || read_len != in_len)
-	  {
-	  	perror("mapping ReadFile");
-	  	return 0;
-	  }
+#if defined(ENABLE_PTHREADS) && !defined(_WIN32)
+	  if (store->ra && (r = readahead_fetch(store->ra, pnum, dest)) >= 0 && cache)
+	    cache->prefetched++;
 #endif
-	  if (compressed)
-	    {
-	      unsigned int out_len;
-	      out_len = unchecked_decompress_buf(buf, in_len, dest, REPOPAGE_BLOBSIZE);
-	      if (out_len != REPOPAGE_BLOBSIZE && pnum < store->num_pages - 1)
-	        {
-#ifdef DEBUG_PAGING
-	          fprintf(stderr, "can't decompress\n");
-#endif
-		  return 0;
-		}
-#ifdef DEBUG_PAGING
-	      fprintf(stderr, " (expand %d to %d)", in_len, out_len);
-#endif
-	    }
+	  if (r < 0 && (r = read_page(store, store->codec, pnum, dest, buf)) < 0)
+	    return 0;
 #ifdef DEBUG_PAGING
 	  fprintf(stderr, "\n");
 #endif
+	  if (cache)
+	    {
+	      cache->decompressed += r;
+	      cache->misses++;
+	    }
 	}
       store->mapped_at[pnum] = i * REPOPAGE_BLOBSIZE;
       store->mapped[i] = pnum;
     }
+  touch_slots(store, best, n);
+  if (sequential)
+    {
+      readahead_pages(store, pend + 1);
+#if defined(ENABLE_PTHREADS) && !defined(_WIN32)
+      if (cache && cache->asyncpages)
+	readahead_request(store, pend + 1);
+#endif
+    }
   return store->blob_store + best * REPOPAGE_BLOBSIZE;
 }
 
@@ -808,6 +1275,151 @@ repopagestore_decompress_page(const unsigned char *cpage, unsigned int len, unsi
 }
 
 
+/**********************************************************************/
+
+#define REPOPAGE_ZSTD_LEVEL		9
+#define REPOPAGE_DICT_SAMPLESIZE	4096
+
+struct s_Repopagecodec {
+  int codec;
+#ifdef ENABLE_ZSTD_PAGES
+  ZSTD_CCtx *cctx;
+  ZSTD_DCtx *dctx;
+  ZSTD_CDict *cdict;
+  ZSTD_DDict *ddict;
+#endif
+  unsigned char *dict;
+  unsigned int dictlen;
+};
+
+int
+repopagecodec_available(int codec)
+{
+  if (codec == REPOPAGE_CODEC_LZ)
+    return 1;
+#ifdef ENABLE_ZSTD_PAGES
+  if (codec == REPOPAGE_CODEC_ZSTD)
+    return 1;
+#endif
+  return 0;
+}
+
+Repopagecodec *
+repopagecodec_create(int codec, const unsigned char *dict, unsigned int dictlen)
+{
+  Repopagecodec *c;
+  if (!repopagecodec_available(codec))
+    return 0;
+  c = solv_calloc(1, sizeof(*c));
+  c->codec = codec;
+  if (dictlen)
+    {
+      c->dict = solv_memdup(dict, dictlen);
+      c->dictlen = dictlen;
+    }
+  return c;
+}
+
+#if defined(ENABLE_PTHREADS) && !defined(_WIN32)
+/* a codec with the same settings but its own contexts */
+static Repopagecodec *
+repopagecodec_dup(Repopagecodec *c)
+{
+  return repopagecodec_create(c->codec, c->dict, c->dictlen);
+}
+#endif
+
+Repopagecodec *
+repopagecodec_free(Repopagecodec *c)
+{
+  if (!c)
+    return 0;
+#ifdef ENABLE_ZSTD_PAGES
+  if (c->cctx)
+    ZSTD_freeCCtx(c->cctx);
+  if (c->dctx)
+    ZSTD_freeDCtx(c->dctx);
+  if (c->cdict)
+    ZSTD_freeCDict(c->cdict);
+  if (c->ddict)
+    ZSTD_freeDDict(c->ddict);
+#endif
+  solv_free(c->dict);
+  solv_free(c);
+  return 0;
+}
+
+/* returns 0 if the page does not fit into max bytes */
+unsigned int
+repopagecodec_compress(Repopagecodec *c, const unsigned char *page, unsigned int len, unsigned char *cpage, unsigned int max)
+{
+  if (!c || c->codec == REPOPAGE_CODEC_LZ)
+    return compress_buf(page, len, cpage, max);
+#ifdef ENABLE_ZSTD_PAGES
+  if (c->codec == REPOPAGE_CODEC_ZSTD)
+    {
+      size_t r;
+      if (!c->cctx && (c->cctx = ZSTD_createCCtx()) == 0)
+	return 0;
+      if (c->dictlen && !c->cdict && (c->cdict = ZSTD_createCDict(c->dict, c->dictlen, REPOPAGE_ZSTD_LEVEL)) == 0)
+	return 0;
+      if (c->cdict)
+	r = ZSTD_compress_usingCDict(c->cctx, cpage, max, page, len, c->cdict);
+      else
+	r = ZSTD_compressCCtx(c->cctx, cpage, max, page, len, REPOPAGE_ZSTD_LEVEL);
+      return ZSTD_isError(r) ? 0 : (unsigned int)r;
+    }
+#endif
+  return 0;
+}
+
+/* returns 0 if the data is corrupt */
+unsigned int
+repopagecodec_decompress(Repopagecodec *c, const unsigned char *cpage, unsigned int len, unsigned char *page, unsigned int max)
+{
+  if (!c || c->codec == REPOPAGE_CODEC_LZ)
+    return unchecked_decompress_buf(cpage, len, page, max);
+#ifdef ENABLE_ZSTD_PAGES
+  if (c->codec == REPOPAGE_CODEC_ZSTD)
+    {
+      size_t r;
+      if (!c->dctx && (c->dctx = ZSTD_createDCtx()) == 0)
+	return 0;
+      if (c->dictlen && !c->ddict && (c->ddict = ZSTD_createDDict(c->dict, c->dictlen)) == 0)
+	return 0;
+      if (c->ddict)
+	r = ZSTD_decompress_usingDDict(c->dctx, page, max, cpage, len, c->ddict);
+      else
+	r = ZSTD_decompressDCtx(c->dctx, page, max, cpage, len);
+      return ZSTD_isError(r) ? 0 : (unsigned int)r;
+    }
+#endif
+  return 0;
+}
+
+/* the pages are cut into small samples, as the dictionary mostly
+ * helps with the start of a page */
+unsigned int
+repopagecodec_train(int codec, const unsigned char *data, unsigned int len, unsigned char *dict, unsigned int dictmax)
+{
+#ifdef ENABLE_ZSTD_PAGES
+  if (codec == REPOPAGE_CODEC_ZSTD && len >= 16 * REPOPAGE_DICT_SAMPLESIZE)
+    {
+      unsigned int i, nsamples = (len + REPOPAGE_DICT_SAMPLESIZE - 1) / REPOPAGE_DICT_SAMPLESIZE;
+      size_t *samplesizes = solv_calloc(nsamples, sizeof(size_t));
+      size_t r;
+      for (i = 0; i < nsamples; i++)
+	samplesizes[i] = i < nsamples - 1 ? REPOPAGE_DICT_SAMPLESIZE : len - i * REPOPAGE_DICT_SAMPLESIZE;
+      r = ZDICT_trainFromBuffer(dict, dictmax, data, samplesizes, nsamples);
+      solv_free(samplesizes);
+      return ZDICT_isError(r) ? 0 : (unsigned int)r;
+    }
+#endif
+  return 0;
+}
+
+
+#define SOLV_ERROR_UNSUPPORTED	2
 #define SOLV_ERROR_EOF		3
 #define SOLV_ERROR_CORRUPT	6
 
@@ -838,12 +1450,48 @@ repopagestore_read_or_setup_pages(Repopagestore *store, FILE *fp, unsigned int p
   unsigned int can_seek;
   unsigned int cur_page_ofs;
   unsigned char buf[REPOPAGE_BLOBSIZE];
+  int codec = pagesz >> 24;
 
+  pagesz &= 0xffffff;
   if (pagesz != REPOPAGE_BLOBSIZE)
     {
       /* We could handle this by slurping in everything.  */
       return SOLV_ERROR_CORRUPT;
     }
+  if (codec != REPOPAGE_CODEC_LZ)
+    {
+      unsigned int dictlen;
+      unsigned char *dict = 0;
+      if (!repopagecodec_available(codec))
+	return SOLV_ERROR_UNSUPPORTED;
+      dictlen = read_u32(fp);
+      if (dictlen > REPOPAGE_MAXDICTSIZE)
+	return SOLV_ERROR_CORRUPT;
+      if (dictlen)
+	{
+	  dict = solv_malloc(dictlen);
+	  if (fread(dict, dictlen, 1, fp) != 1)
+	    {
+	      solv_free(dict);
+	      return SOLV_ERROR_EOF;
+	    }
+	}
+      store->codec = repopagecodec_create(codec, dict, dictlen);
+      solv_free(dict);
+    }
+  npages = (blobsz + REPOPAGE_BLOBSIZE - 1) / REPOPAGE_BLOBSIZE;
+  if (store->mapping && (store->file_offset = ftell(fp)) >= 0 && (size_t)store->file_offset <= store->mappingsize)
+    {
+      /* the pages are located on demand, see locate_mapped_pages() */
+      store->num_pages = npages;
+      store->mapped_at = solv_malloc2(npages, sizeof(*store->mapped_at));
+      for (i = 0; i < npages; i++)
+	store->mapped_at[i] = -1;
+      store->file_pages = solv_malloc2(npages, sizeof(*store->file_pages));
+      store->nfile_pages = 0;
+      return 0;
+    }
+  repopagestore_munmap(store);
   can_seek = 1;
   if ((store->file_offset = ftell(fp)) < 0)
     can_seek = 0;
@@ -858,7 +1506,6 @@ repopagestore_read_or_setup_pages(Repopagestore *store, FILE *fp, unsigned int p
 #ifdef DEBUG_PAGING
   fprintf(stderr, "can %sseek\n", can_seek ? "" : "NOT ");
 #endif
-  npages = (blobsz + REPOPAGE_BLOBSIZE - 1) / REPOPAGE_BLOBSIZE;
 
   store->num_pages = npages;
   store->mapped_at = solv_malloc2(npages, sizeof(*store->mapped_at));
@@ -910,7 +1557,7 @@ repopagestore_read_or_setup_pages(Repopagestore *store, FILE *fp, unsigned int p
 	    }
 	  if (compressed)
 	    {
-	      out_len = unchecked_decompress_buf(buf, in_len, dest, REPOPAGE_BLOBSIZE);
+	      out_len = repopagecodec_decompress(store->codec, buf, in_len, dest, REPOPAGE_BLOBSIZE);
 	      if (out_len != REPOPAGE_BLOBSIZE && i < npages - 1)
 	        {
 		  return SOLV_ERROR_CORRUPT;
@@ -921,15 +1568,88 @@ repopagestore_read_or_setup_pages(Repopagestore *store, FILE *fp, unsigned int p
   return 0;
 }
 
+unsigned char *
+repopagestore_load_page_range(Repopagestore *store, unsigned int pstart, unsigned int pend)
+{
+  return load_page_range(store, pstart, pend, 1);
+}
+
+/* position fp after the pages of a mapped store, the setup does not
+ * read over them */
+int
+repopagestore_skip_pages(Repopagestore *store, FILE *fp)
+{
+  Attrblobpage *p;
+
+  if (!store->mapping || !store->num_pages || !store->file_pages)
+    return 0;
+  if (!locate_mapped_pages(store, store->num_pages - 1))
+    return SOLV_ERROR_EOF;
+  p = store->file_pages + store->num_pages - 1;
+  if (fseek(fp, (long)(store->file_offset + p->page_offset + (p->page_size >> 1)), SEEK_SET) != 0)
+    return SOLV_ERROR_EOF;
+  return 0;
+}
+
 void
 repopagestore_disable_paging(Repopagestore *store)
 {
+  /* load into the slots so that mapped_at is set for all pages,
+   * a frozen pool relies on that */
   if (store->num_pages)
-    repopagestore_load_page_range(store, 0, store->num_pages - 1);
+    load_page_range(store, 0, store->num_pages - 1, 0);
+#if defined(ENABLE_PTHREADS) && !defined(_WIN32)
+  /* everything is loaded, no need for read-ahead */
+  if (store->ra)
+    readahead_free(store->ra);
+  store->ra = 0;
+#endif
+}
+
+int
+repopagestore_mmap(Repopagestore *store, FILE *fp)
+{
+#ifndef _WIN32
+  struct stat stb;
+  void *m;
+  int fd = fileno(fp);
+
+  if (fd < 0 || fstat(fd, &stb) != 0 || !S_ISREG(stb.st_mode) || stb.st_size <= 0)
+    return 0;
+  if ((off_t)(size_t)stb.st_size != stb.st_size)
+    return 0;
+  m = mmap(0, (size_t)stb.st_size, PROT_READ, MAP_PRIVATE, fd, 0);
+  if (m == MAP_FAILED)
+    return 0;
+  store->mapping = m;
+  store->mappingsize = (size_t)stb.st_size;
+  return 1;
+#else
+  return 0;
+#endif
+}
+
+void
+repopagestore_munmap(Repopagestore *store)
+{
+#ifndef _WIN32
+  if (store->mapping)
+    munmap(store->mapping, store->mappingsize);
+#endif
+  store->mapping = 0;
+  store->mappingsize = 0;
 }
 
 #ifdef STANDALONE
 
+/* build with
+ *   cc -DSTANDALONE -DLIBSOLV_INTERNAL repopage.c -lsolv
+ * use -b to compare the codecs on the data from stdin or -s to
+ * compare them on the paged data of a solv file */
+
+#include "pool.h"
+#include "repo_solv.h"
+
 static void
 transfer_file(FILE * from, FILE * to, int compress)
 {
@@ -984,107 +1704,118 @@ transfer_file(FILE * from, FILE * to, int compress)
     }
 }
 
-/* Just for benchmarking purposes.  */
-static void
-dumb_memcpy(void *dest, const void *src, unsigned int len)
-{
-  char *d = dest;
-  const char *s = src;
-  while (len--)
-    *d++ = *s++;
-}
-
+/* compress the data in pages with the codec and report the ratio and
+ * the compression and decompression speed */
 static void
-benchmark(FILE * from)
+benchmark_codec(const char *name, Repopagecodec *codec, unsigned char *data, unsigned int len)
 {
-  unsigned char inb[BLOCK_SIZE];
-  unsigned char outb[BLOCK_SIZE];
-  unsigned int in_len = fread(inb, 1, BLOCK_SIZE, from);
-  unsigned int out_len;
-  if (!in_len)
-    {
-      perror("can't read from input");
-      exit(1);
-    }
-
-  unsigned int calib_loop;
-  unsigned int per_loop;
-  unsigned int i, j;
+  unsigned int npages = (len + REPOPAGE_BLOBSIZE - 1) / REPOPAGE_BLOBSIZE;
+  unsigned char *cdata = solv_malloc2(npages, REPOPAGE_BLOBSIZE);
+  unsigned int *clens = solv_calloc(npages, sizeof(unsigned int));
+  unsigned char outb[REPOPAGE_BLOBSIZE];
+  unsigned long long clen = 0;
+  unsigned int i, loops;
   clock_t start, end;
   float seconds;
 
-#if 0
-  calib_loop = 1;
-  per_loop = 0;
   start = clock();
-  while ((clock() - start) < CLOCKS_PER_SEC / 4)
+  for (i = 0; i < npages; i++)
     {
-      calib_loop *= 2;
-      for (i = 0; i < calib_loop; i++)
-	dumb_memcpy(outb, inb, in_len);
-      per_loop += calib_loop;
+      unsigned int l = len - i * REPOPAGE_BLOBSIZE;
+      if (l > REPOPAGE_BLOBSIZE)
+	l = REPOPAGE_BLOBSIZE;
+      clens[i] = repopagecodec_compress(codec, data + i * REPOPAGE_BLOBSIZE, l, cdata + i * REPOPAGE_BLOBSIZE, l - 1);
+      clen += clens[i] ? clens[i] : l;
     }
-
-  fprintf(stderr, "memcpy:\nCalibrated to %d iterations per loop\n",
-	   per_loop);
-
-  start = clock();
-  for (i = 0; i < 10; i++)
-    for (j = 0; j < per_loop; j++)
-      dumb_memcpy(outb, inb, in_len);
   end = clock();
   seconds = (end - start) / (float) CLOCKS_PER_SEC;
-  fprintf(stderr, "%.2f seconds == %.2f MB/s\n", seconds,
-	   ((long long) in_len * per_loop * 10) / (1024 * 1024 * seconds));
-#endif
+  fprintf(stderr, "%s: %u pages, %u -> %llu bytes (%.1f%%)\n", name, npages, len, clen, len ? clen * 100.0 / len : 0);
+  fprintf(stderr, "  compression: %.2f MB/s\n", len / (1024 * 1024 * (seconds > 0 ? seconds : 1e-6)));
 
-  calib_loop = 1;
-  per_loop = 0;
   start = clock();
-  while ((clock() - start) < CLOCKS_PER_SEC / 4)
-    {
-      calib_loop *= 2;
-      for (i = 0; i < calib_loop; i++)
-	compress_buf(inb, in_len, outb, sizeof(outb));
-      per_loop += calib_loop;
-    }
-
-  fprintf(stderr, "compression:\nCalibrated to %d iterations per loop\n",
-	   per_loop);
-
-  start = clock();
-  for (i = 0; i < 10; i++)
-    for (j = 0; j < per_loop; j++)
-      compress_buf(inb, in_len, outb, sizeof(outb));
+  for (loops = 0; loops == 0 || (clock() - start) < CLOCKS_PER_SEC / 4; loops++)
+    for (i = 0; i < npages; i++)
+      if (clens[i])
+	repopagecodec_decompress(codec, cdata + i * REPOPAGE_BLOBSIZE, clens[i], outb, REPOPAGE_BLOBSIZE);
   end = clock();
   seconds = (end - start) / (float) CLOCKS_PER_SEC;
-  fprintf(stderr, "%.2f seconds == %.2f MB/s\n", seconds,
-	   ((long long) in_len * per_loop * 10) / (1024 * 1024 * seconds));
+  fprintf(stderr, "  decompression: %.2f MB/s\n", ((long long) len * loops) / (1024 * 1024 * seconds));
+  solv_free(cdata);
+  solv_free(clens);
+}
 
-  out_len = compress_buf(inb, in_len, outb, sizeof(outb));
+static void
+benchmark(unsigned char *data, unsigned int len)
+{
+  Repopagecodec *codec;
+  unsigned char *dict;
+  unsigned int dictlen;
 
-  calib_loop = 1;
-  per_loop = 0;
-  start = clock();
-  while ((clock() - start) < CLOCKS_PER_SEC / 4)
+  benchmark_codec("lz", 0, data, len);
+  if (!repopagecodec_available(REPOPAGE_CODEC_ZSTD))
+    return;
+  codec = repopagecodec_create(REPOPAGE_CODEC_ZSTD, 0, 0);
+  benchmark_codec("zstd", codec, data, len);
+  repopagecodec_free(codec);
+  dict = solv_malloc(64 * 1024);
+  dictlen = repopagecodec_train(REPOPAGE_CODEC_ZSTD, data, len, dict, 64 * 1024);
+  if (dictlen)
     {
-      calib_loop *= 2;
-      for (i = 0; i < calib_loop; i++)
-	unchecked_decompress_buf(outb, out_len, inb, sizeof(inb));
-      per_loop += calib_loop;
+      codec = repopagecodec_create(REPOPAGE_CODEC_ZSTD, dict, dictlen);
+      fprintf(stderr, "dictionary: %u bytes\n", dictlen);
+      benchmark_codec("zstd+dict", codec, data, len);
+      repopagecodec_free(codec);
     }
+  solv_free(dict);
+}
 
-  fprintf(stderr, "decompression:\nCalibrated to %d iterations per loop\n",
-	   per_loop);
+static void
+benchmark_file(FILE *from)
+{
+  unsigned char *data = 0;
+  unsigned int len = 0, l;
+  for (;;)
+    {
+      data = solv_extend_realloc(data, len + BLOCK_SIZE, 1, BLOCK_SIZE);
+      if ((l = fread(data + len, 1, BLOCK_SIZE, from)) == 0)
+	break;
+      len += l;
+    }
+  if (!len)
+    {
+      perror("can't read from input");
+      exit(1);
+    }
+  benchmark(data, len);
+  solv_free(data);
+}
 
-  start = clock();
-  for (i = 0; i < 10; i++)
-    for (j = 0; j < per_loop; j++)
-      unchecked_decompress_buf(outb, out_len, inb, sizeof(inb));
-  end = clock();
-  seconds = (end - start) / (float) CLOCKS_PER_SEC;
-  fprintf(stderr, "%.2f seconds == %.2f MB/s\n", seconds,
-	   ((long long) in_len * per_loop * 10) / (1024 * 1024 * seconds));
+/* benchmark with the paged data of a solv file */
+static void
+benchmark_solv(const char *filename)
+{
+  Pool *pool = pool_create();
+  Repo *repo = repo_create(pool, filename);
+  Repodata *data;
+  FILE *fp;
+  int rdid;
+
+  if ((fp = fopen(filename, "r")) == 0)
+    {
+      perror(filename);
+      exit(1);
+    }
+  if (repo_add_solv(repo, fp, 0))
+    {
+      fprintf(stderr, "%s: %s\n", filename, pool_errstr(pool));
+      exit(1);
+    }
+  fclose(fp);
+  repo_disable_paging(repo);
+  FOR_REPODATAS(repo, rdid, data)
+    if (data->store.num_pages && data->store.blob_store)
+      benchmark(data->store.blob_store, data->lastverticaloffset);
+  pool_free(pool);
 }
 
 int
@@ -1094,7 +1825,9 @@ main(int argc, char *argv[])
   if (argc > 1 && !strcmp(argv[1], "-d"))
     compress = 0;
   if (argc > 1 && !strcmp(argv[1], "-b"))
-    benchmark(stdin);
+    benchmark_file(stdin);
+  else if (argc > 2 && !strcmp(argv[1], "-s"))
+    benchmark_solv(argv[2]);
   else
     transfer_file(stdin, stdout, compress);
   return 0;
@@ -11,6 +11,16 @@
 #define REPOPAGE_BLOBBITS 15
 #define REPOPAGE_BLOBSIZE (1 << REPOPAGE_BLOBBITS)
 
+/* page compression codecs. A codec other than the builtin one is
+ * stored in the upper byte of the page size in the solv file,
+ * followed by the dictionary length and the dictionary. */
+#define REPOPAGE_CODEC_LZ	0	/* builtin lz compressor */
+#define REPOPAGE_CODEC_ZSTD	1
+
+#define REPOPAGE_MAXDICTSIZE	(1024 * 1024)
+
+typedef struct s_Repopagecodec Repopagecodec;
+
 typedef struct s_Attrblobpage
 {
   /* page_size == 0 means the page is not backed by some file storage.
@@ -20,6 +30,20 @@ typedef struct s_Attrblobpage
   unsigned int page_size;
 } Attrblobpage;
 
+/* page cache accounting, shared by all page stores of a pool */
+typedef struct s_Repopagecache {
+  size_t growth;		/* stores may grow while used is below this, 0: fixed slots */
+  size_t used;			/* bytes used by the cached pages */
+  unsigned long long hits;	/* requested pages that were already loaded */
+  unsigned long long misses;	/* requested pages that had to be loaded */
+  unsigned long long evictions;
+  unsigned long long readaheads;	/* pages that got a read-ahead hint */
+  unsigned long long decompressed;	/* bytes produced by page decompression */
+  unsigned long long prefetched;	/* pages taken from the read-ahead thread */
+  unsigned int asyncpages;	/* pages loaded ahead by a thread, 0: off */
+  int frozen;			/* the pool is frozen, don't touch the stats */
+} Repopagecache;
+
 typedef struct s_Repopagestore {
   int pagefd;		/* file descriptor we're paging from */
   long file_offset;	/* pages in file start here */
@@ -38,7 +62,18 @@ typedef struct s_Repopagestore {
    otherwise it contains the page number (of the mapped page).  */
   unsigned int *mapped;
   unsigned int nmapped;
-  unsigned int rr_counter;
+  unsigned int *lastuse;	/* lru stamp of the mapped pages */
+  unsigned int usecounter;
+  unsigned int lastpage;	/* last page of the previous request */
+  unsigned int readahead;	/* pages below this one got a read-ahead hint */
+
+  unsigned char *mapping;	/* mmap()ed solv file, used instead of pagefd */
+  size_t mappingsize;
+  unsigned int nfile_pages;	/* number of file_pages already located in the mapping */
+
+  Repopagecodec *codec;		/* zero for the builtin compressor */
+  Repopagecache *cache;		/* zero if the store does not belong to a pool */
+  struct s_Repopagereadahead *ra;	/* asynchronous read-ahead thread */
 } Repopagestore;
 
 #ifdef __cplusplus
@@ -47,6 +82,7 @@ extern "C" {
 
 void repopagestore_init(Repopagestore *store);
 void repopagestore_free(Repopagestore *store);
+void repopagestore_set_cache(Repopagestore *store, Repopagecache *cache);
 
 /* load pages pstart..pend into consecutive memory, return address */
 unsigned char *repopagestore_load_page_range(Repopagestore *store, unsigned int pstart, unsigned int pend);
@@ -56,11 +92,25 @@ unsigned int repopagestore_compress_page(unsigned char *page, unsigned int len,
 /* uncompress a page, return uncompressed len */
 unsigned int repopagestore_decompress_page(const unsigned char *cpage, unsigned int len, unsigned char *page, unsigned int max);
 
+/* page codecs. A zero codec pointer means the builtin compressor */
+int repopagecodec_available(int codec);
+Repopagecodec *repopagecodec_create(int codec, const unsigned char *dict, unsigned int dictlen);
+Repopagecodec *repopagecodec_free(Repopagecodec *codec);
+unsigned int repopagecodec_compress(Repopagecodec *codec, const unsigned char *page, unsigned int len, unsigned char *cpage, unsigned int max);
+unsigned int repopagecodec_decompress(Repopagecodec *codec, const unsigned char *cpage, unsigned int len, unsigned char *page, unsigned int max);
+/* train a dictionary from uncompressed pages, return dictionary len */
+unsigned int repopagecodec_train(int codec, const unsigned char *data, unsigned int len, unsigned char *dict, unsigned int dictmax);
+
 /* setup page data for repodata_load_page_range */
 int repopagestore_read_or_setup_pages(Repopagestore *store, FILE *fp, unsigned int pagesz, unsigned int blobsz);
+int repopagestore_skip_pages(Repopagestore *store, FILE *fp);
 
 void repopagestore_disable_paging(Repopagestore *store);
 
+/* mmap the file behind fp, returns 0 if the file cannot be mapped */
+int repopagestore_mmap(Repopagestore *store, FILE *fp);
+void repopagestore_munmap(Repopagestore *store);
+
 #ifdef __cplusplus
 }
 #endif
@@ -386,15 +386,60 @@ makemultiversionconflict(Solver *solv, Id n, Id con)
   return n;
 }
 
+/* markers in the pkgrulebuf for the start/end of recommends rules */
+#define PKGRULEBUF_RECOMMENDS		1
+#define PKGRULEBUF_RECOMMENDS_END	2
+
 static inline void
 addpkgrule(Solver *solv, Id p, Id p2, Id d, int type, Id dep)
 {
-  if (!solv->ruleinfoq)
+  if (solv->pkgrulebuf)
+    {
+      queue_push2(solv->pkgrulebuf, p, p2);
+      queue_push(solv->pkgrulebuf, d);
+    }
+  else if (!solv->ruleinfoq)
     solver_addrule(solv, p, p2, d);
   else
     addpkgruleinfo(solv, p, p2, d, type, dep);
 }
 
+/* like addpkgrule, but store the rule in buf if set */
+static inline void
+addpkgrule_buf(Solver *solv, Queue *buf, Id p, Id p2, Id d, int type, Id dep)
+{
+  if (buf)
+    {
+      queue_push2(buf, p, p2);
+      queue_push(buf, d);
+    }
+  else
+    addpkgrule(solv, p, p2, d, type, dep);
+}
+
+static void
+addrecommendsrules(Solver *solv, int start)
+{
+  int i;
+  if (!solv->recommendsruleq)
+    {
+      solv->recommendsruleq = solv_calloc(1, sizeof(Queue));
+      queue_init(solv->recommendsruleq);
+    }
+  for (i = start; i < solv->nrules; i++)
+    queue_push(solv->recommendsruleq, i);
+  solv->lastpkgrule = 0;
+}
+
+/* true if the providers of dep can be looked up without changing the pool */
+static inline int
+providers_known(Pool *pool, Id dep)
+{
+  if (ISRELDEP(dep))
+    return pool->whatprovides_rel[GETRELID(dep)] != 0;
+  return pool->whatprovides[dep] != 0;
+}
+
 #ifdef ENABLE_LINKED_PKGS
 
 static int
@@ -707,6 +752,221 @@ add_conda_constrains_rule(Solver *solv, Id n, Id dep, int dontfix)
 }
 #endif
 
+static inline int
+pkgrules_dontfix(Solver *solv, Solvable *s)
+{
+  Repo *installed = solv->installed;
+  if (installed			/* Installed system available */
+      && s->repo == installed	/* solvable is installed */
+      && !solv->fixmap_all	/* NOT repair errors in dependency graph */
+      && !(solv->fixmap.size && SPARSEMAPTST(&solv->fixmap, (s - solv->pool->solvables) - installed->start)))
+    return 1;
+  return 0;
+}
+
+/*
+ * state of a batched pkg rule creation, see solver_addpkgrulesforsolvables()
+ */
+struct pkgrules_batch {
+  Queue visitq;		/* triplets: solvable, start of its rules in opq, deferred index + 1 */
+  Queue opq;		/* buffered rules, (p, p2, d) triplets */
+  Queue deferq;		/* solvables with deferred conflicts/obsoletes rules */
+  Id *visitpos;		/* position in visitq + 1 */
+};
+
+/* can the conflicts/obsoletes rules of s be created later? */
+static int
+pkgrules_candefer(Pool *pool, Solvable *s)
+{
+#ifdef ENABLE_COMPLEX_DEPS
+  Id con, *conp;
+#endif
+
+  if (!s->conflicts)
+    return 1;
+  if (!strncmp("patch:", pool_id2str(pool, s->name), 6))
+    return 0;		/* patch conflicts may create new whatprovides entries */
+#ifdef ENABLE_COMPLEX_DEPS
+  conp = s->repo->idarraydata + s->conflicts;
+  while ((con = *conp++) != 0)
+    if (pool_is_complex_dep(pool, con))
+      return 0;		/* those may push new solvables on the work queue */
+#endif
+  return 1;
+}
+
+/*
+ * add the conflicts and obsoletes rules of solvable n
+ *
+ * if buf is set the rules are not added but stored in buf, the
+ * providers must already be known in that case (returns 0 otherwise).
+ * visitpos is used if the solvables in m were visited in a batch,
+ * it contains the position of the solvable in the visit order.
+ */
+static int
+addpkgrules_conflicts(Solver *solv, Id n, int dontfix, Map *m, Queue *workq, Id *visitpos, Queue *buf)
+{
+  Pool *pool = solv->pool;
+  Repo *installed = solv->installed;
+  Solvable *s = pool->solvables + n;
+  Id con, *conp;
+  Id obs, *obsp;
+  Id p, pp;
+
+  /*-----------------------------------------
+   * check conflicts of s
+   */
+
+  if (s->conflicts)
+    {
+      int ispatch = 0;
+
+      /* we treat conflicts in patches a bit differen:
+       * - nevr matching
+       * - multiversion handling
+       * XXX: we should really handle this different, looking
+       * at the name is a bad hack
+       */
+      if (!strncmp("patch:", pool_id2str(pool, s->name), 6))
+	ispatch = 1;
+      conp = s->repo->idarraydata + s->conflicts;
+      /* foreach conflicts of 's' */
+      while ((con = *conp++) != 0)
+	{
+#ifdef ENABLE_COMPLEX_DEPS
+	  if (!ispatch && pool_is_complex_dep(pool, con))
+	    {
+	      /* we have AND/COND deps, normalize */
+	      add_complex_deprules(solv, n, con, SOLVER_RULE_PKG_CONFLICTS, dontfix, workq, m);
+	      continue;
+	    }
+#endif
+	  if (buf && !providers_known(pool, con))
+	    return 0;	/* let the caller do it */
+	  /* foreach providers of a conflict of 's' */
+	  FOR_PROVIDES(p, pp, con)
+	    {
+	      if (ispatch && !pool_match_nevr(pool, pool->solvables + p, con))
+		continue;
+	      /* dontfix: dont care about conflicts with already installed packs */
+	      if (dontfix && pool->solvables[p].repo == installed)
+		continue;
+	      if (p == n)		/* p == n: self conflict */
+		{
+		  if (!pool->forbidselfconflicts || is_otherproviders_dep(pool, con))
+		    continue;
+		  addpkgrule_buf(solv, buf, -n, 0, 0, SOLVER_RULE_PKG_SELF_CONFLICT, con);
+		  continue;
+		}
+	      if (ispatch && solv->multiversion.size && MAPTST(&solv->multiversion, p) && ISRELDEP(con))
+		{
+		  /* our patch conflicts with a multiversion package */
+		  Id d = makemultiversionconflict(solv, p, con);
+		  if (d)
+		    {
+		      addpkgrule_buf(solv, buf, -n, 0, d, SOLVER_RULE_PKG_CONFLICTS, con);
+		      continue;
+		    }
+		}
+	      if (p == SYSTEMSOLVABLE)
+		p = 0;
+              /* rule: -n|-p: either solvable _or_ provider of conflict */
+	      addpkgrule_buf(solv, buf, -n, -p, 0, SOLVER_RULE_PKG_CONFLICTS, con);
+	    }
+	}
+    }
+
+  /*-----------------------------------------
+   * check obsoletes and implicit obsoletes of a package
+   * if ignoreinstalledsobsoletes is not set, we're also checking
+   * obsoletes of installed packages (like newer rpm versions)
+   */
+  if ((!installed || s->repo != installed) || !pool->noinstalledobsoletes)
+    {
+      int multi = solv->multiversion.size && MAPTST(&solv->multiversion, n);
+      int isinstalled = (installed && s->repo == installed);
+      if (s->obsoletes && (!multi || solv->keepexplicitobsoletes))
+	{
+	  obsp = s->repo->idarraydata + s->obsoletes;
+	  /* foreach obsoletes */
+	  while ((obs = *obsp++) != 0)
+	    {
+	      if (buf && !providers_known(pool, obs))
+		return 0;	/* let the caller do it */
+	      /* foreach provider of an obsoletes of 's' */
+	      FOR_PROVIDES(p, pp, obs)
+		{
+		  Solvable *ps = pool->solvables + p;
+		  if (p == n)
+		    continue;
+		  if (isinstalled && dontfix && ps->repo == installed)
+		    continue;	/* don't repair installed/installed problems */
+		  if (!pool->obsoleteusesprovides /* obsoletes are matched names, not provides */
+		      && !pool_match_nevr(pool, ps, obs))
+		    continue;
+		  if (pool->obsoleteusescolors && !pool_colormatch(pool, s, ps))
+		    continue;
+		  if (p == SYSTEMSOLVABLE)
+		    p = 0;
+		  if (!isinstalled)
+		    addpkgrule_buf(solv, buf, -n, -p, 0, SOLVER_RULE_PKG_OBSOLETES, obs);
+		  else
+		    addpkgrule_buf(solv, buf, -n, -p, 0, SOLVER_RULE_PKG_INSTALLED_OBSOLETES, obs);
+		}
+	    }
+	}
+      /* check implicit obsoletes
+       * for installed packages we only need to check installed/installed problems (and
+       * only when dontfix is not set), as the others are picked up when looking at the
+       * uninstalled package.
+       */
+      if (!isinstalled || !dontfix)
+	{
+	  if (buf && !providers_known(pool, s->name))
+	    return 0;	/* let the caller do it */
+	  FOR_PROVIDES(p, pp, s->name)
+	    {
+	      Solvable *ps = pool->solvables + p;
+	      if (p == n)
+		continue;
+	      if (isinstalled && ps->repo != installed)
+		continue;
+	      /* we still obsolete packages with same nevra, like rpm does */
+	      /* (actually, rpm mixes those packages. yuck...) */
+	      if (multi && (s->name != ps->name || s->evr != ps->evr || s->arch != ps->arch))
+		{
+		  if (isinstalled || ps->repo != installed)
+		    continue;
+		  /* also check the installed package for multi-ness */
+		  if (MAPTST(&solv->multiversion, p))
+		    continue;
+		}
+	      if (!pool->implicitobsoleteusesprovides && s->name != ps->name)
+		continue;
+	      if (pool->implicitobsoleteusescolors && !pool_colormatch(pool, s, ps))
+		continue;
+	      if (p == SYSTEMSOLVABLE)
+		p = 0;
+	      if (s->name == ps->name)
+		{
+		  /* optimization: do not add the same-name conflict rule if it was
+		   * already added when we looked at the other package.
+		   * (this assumes pool_colormatch is symmetric) */
+		  if (p && m && ps->repo != installed && MAPTST(m, p) &&
+		      (!visitpos || !visitpos[p] || visitpos[p] < visitpos[n]) &&
+		      (ps->arch != ARCH_SRC && ps->arch != ARCH_NOSRC) &&
+		      !(solv->multiversion.size && MAPTST(&solv->multiversion, p)))
+		    continue;
+		  addpkgrule_buf(solv, buf, -n, -p, 0, SOLVER_RULE_PKG_SAME_NAME, 0);
+		}
+	      else
+		addpkgrule_buf(solv, buf, -n, -p, 0, SOLVER_RULE_PKG_IMPLICIT_OBSOLETES, s->name);
+	    }
+	}
+    }
+  return 1;
+}
+
 /*-------------------------------------------------------------------
  *
  * add dependency rules for solvable
@@ -727,8 +987,8 @@ add_conda_constrains_rule(Solver *solv, Id n, Id dep, int dontfix)
  *
  */
 
-void
-solver_addpkgrulesforsolvable(Solver *solv, Solvable *s, Map *m)
+static void
+addpkgrulesforsolvable(Solver *solv, Solvable *s, Map *m, struct pkgrules_batch *pb)
 {
   Pool *pool = solv->pool;
   Repo *installed = solv->installed;
@@ -741,8 +1001,6 @@ solver_addpkgrulesforsolvable(Solver *solv, Solvable *s, Map *m)
   int i;
   int dontfix;		/* ignore dependency errors for installed solvables */
   Id req, *reqp;
-  Id con, *conp;
-  Id obs, *obsp;
   Id rec, *recp;
   Id sug, *sugp;
   Id p, pp;		/* whatprovides loops */
@@ -768,18 +1026,17 @@ solver_addpkgrulesforsolvable(Solver *solv, Solvable *s, Map *m)
 	  if (MAPTST(m, n))		/* continue if already visited */
 	    continue;
 	  MAPSET(m, n);			/* mark as visited */
+	  if (pb)
+	    {
+	      queue_push2(&pb->visitq, n, pb->opq.count);
+	      queue_push(&pb->visitq, 0);
+	      pb->visitpos[n] = pb->visitq.count / 3;
+	    }
 	}
 
       s = pool->solvables + n;
 
-      dontfix = 0;
-      if (installed			/* Installed system available */
-	  && s->repo == installed	/* solvable is installed */
-	  && !solv->fixmap_all		/* NOT repair errors in dependency graph */
-	  && !(solv->fixmap.size && MAPTST(&solv->fixmap, n - installed->start)))
-        {
-	  dontfix = 1;			/* dont care about broken deps */
-        }
+      dontfix = pkgrules_dontfix(solv, s);	/* dont care about broken deps */
 
       if (!dontfix)
 	{
@@ -898,6 +1155,11 @@ solver_addpkgrulesforsolvable(Solver *solv, Solvable *s, Map *m)
 	{
 	  int start = solv->nrules;
 	  solv->lastpkgrule = 0;
+	  if (solv->pkgrulebuf)
+	    {
+	      queue_push2(solv->pkgrulebuf, 0, 0);
+	      queue_push(solv->pkgrulebuf, PKGRULEBUF_RECOMMENDS);
+	    }
 	  reqp = s->repo->idarraydata + s->recommends;
 	  while ((req = *reqp++) != 0)            /* go through all recommends */
 	    {
@@ -923,17 +1185,13 @@ solver_addpkgrulesforsolvable(Solver *solv, Solvable *s, Map *m)
 		  if (!MAPTST(m, *dp))
 		    queue_push(&workq, *dp);
 	    }
-	  if (!solv->ruleinfoq && start < solv->nrules)
+	  if (solv->pkgrulebuf)
 	    {
-	      if (!solv->recommendsruleq)
-		{
-		  solv->recommendsruleq = solv_calloc(1, sizeof(Queue));
-		  queue_init(solv->recommendsruleq);
-		}
-	      for (i = start; i < solv->nrules; i++)
-		queue_push(solv->recommendsruleq, i);
-	      solv->lastpkgrule = 0;
+	      queue_push2(solv->pkgrulebuf, 0, 0);
+	      queue_push(solv->pkgrulebuf, PKGRULEBUF_RECOMMENDS_END);
 	    }
+	  else if (!solv->ruleinfoq && start < solv->nrules)
+	    addrecommendsrules(solv, start);
 	}
 
 #ifdef ENABLE_CONDA
@@ -949,150 +1207,14 @@ solver_addpkgrulesforsolvable(Solver *solv, Solvable *s, Map *m)
       if (s->arch == ARCH_SRC || s->arch == ARCH_NOSRC)
 	continue;
 
-      /*-----------------------------------------
-       * check conflicts of s
-       */
-
-      if (s->conflicts)
+      /* check conflicts and obsoletes of s, maybe later in parallel */
+      if (pb && pkgrules_candefer(pool, s))
 	{
-	  int ispatch = 0;
-
-	  /* we treat conflicts in patches a bit differen:
-	   * - nevr matching
-	   * - multiversion handling
-	   * XXX: we should really handle this different, looking
-	   * at the name is a bad hack
-	   */
-	  if (!strncmp("patch:", pool_id2str(pool, s->name), 6))
-	    ispatch = 1;
-	  conp = s->repo->idarraydata + s->conflicts;
-	  /* foreach conflicts of 's' */
-	  while ((con = *conp++) != 0)
-	    {
-#ifdef ENABLE_COMPLEX_DEPS
-	      if (!ispatch && pool_is_complex_dep(pool, con))
-		{
-		  /* we have AND/COND deps, normalize */
-		  add_complex_deprules(solv, n, con, SOLVER_RULE_PKG_CONFLICTS, dontfix, &workq, m);
-		  continue;
-		}
-#endif
-	      /* foreach providers of a conflict of 's' */
-	      FOR_PROVIDES(p, pp, con)
-		{
-		  if (ispatch && !pool_match_nevr(pool, pool->solvables + p, con))
-		    continue;
-		  /* dontfix: dont care about conflicts with already installed packs */
-		  if (dontfix && pool->solvables[p].repo == installed)
-		    continue;
-		  if (p == n)		/* p == n: self conflict */
-		    {
-		      if (!pool->forbidselfconflicts || is_otherproviders_dep(pool, con))
-			continue;
-		      addpkgrule(solv, -n, 0, 0, SOLVER_RULE_PKG_SELF_CONFLICT, con);
-		      continue;
-		    }
-		  if (ispatch && solv->multiversion.size && MAPTST(&solv->multiversion, p) && ISRELDEP(con))
-		    {
-		      /* our patch conflicts with a multiversion package */
-		      Id d = makemultiversionconflict(solv, p, con);
-		      if (d)
-			{
-			  addpkgrule(solv, -n, 0, d, SOLVER_RULE_PKG_CONFLICTS, con);
-			  continue;
-			}
-		    }
-		  if (p == SYSTEMSOLVABLE)
-		    p = 0;
-                  /* rule: -n|-p: either solvable _or_ provider of conflict */
-		  addpkgrule(solv, -n, -p, 0, SOLVER_RULE_PKG_CONFLICTS, con);
-		}
-	    }
-	}
-
-      /*-----------------------------------------
-       * check obsoletes and implicit obsoletes of a package
-       * if ignoreinstalledsobsoletes is not set, we're also checking
-       * obsoletes of installed packages (like newer rpm versions)
-       */
-      if ((!installed || s->repo != installed) || !pool->noinstalledobsoletes)
-	{
-	  int multi = solv->multiversion.size && MAPTST(&solv->multiversion, n);
-	  int isinstalled = (installed && s->repo == installed);
-	  if (s->obsoletes && (!multi || solv->keepexplicitobsoletes))
-	    {
-	      obsp = s->repo->idarraydata + s->obsoletes;
-	      /* foreach obsoletes */
-	      while ((obs = *obsp++) != 0)
-		{
-		  /* foreach provider of an obsoletes of 's' */
-		  FOR_PROVIDES(p, pp, obs)
-		    {
-		      Solvable *ps = pool->solvables + p;
-		      if (p == n)
-			continue;
-		      if (isinstalled && dontfix && ps->repo == installed)
-			continue;	/* don't repair installed/installed problems */
-		      if (!pool->obsoleteusesprovides /* obsoletes are matched names, not provides */
-			  && !pool_match_nevr(pool, ps, obs))
-			continue;
-		      if (pool->obsoleteusescolors && !pool_colormatch(pool, s, ps))
-			continue;
-		      if (p == SYSTEMSOLVABLE)
-			p = 0;
-		      if (!isinstalled)
-			addpkgrule(solv, -n, -p, 0, SOLVER_RULE_PKG_OBSOLETES, obs);
-		      else
-			addpkgrule(solv, -n, -p, 0, SOLVER_RULE_PKG_INSTALLED_OBSOLETES, obs);
-		    }
-		}
-	    }
-	  /* check implicit obsoletes
-           * for installed packages we only need to check installed/installed problems (and
-           * only when dontfix is not set), as the others are picked up when looking at the
-           * uninstalled package.
-           */
-	  if (!isinstalled || !dontfix)
-	    {
-	      FOR_PROVIDES(p, pp, s->name)
-		{
-		  Solvable *ps = pool->solvables + p;
-		  if (p == n)
-		    continue;
-		  if (isinstalled && ps->repo != installed)
-		    continue;
-		  /* we still obsolete packages with same nevra, like rpm does */
-		  /* (actually, rpm mixes those packages. yuck...) */
-		  if (multi && (s->name != ps->name || s->evr != ps->evr || s->arch != ps->arch))
-		    {
-		      if (isinstalled || ps->repo != installed)
-		        continue;
-		      /* also check the installed package for multi-ness */
-		      if (MAPTST(&solv->multiversion, p))
-		        continue;
-		    }
-		  if (!pool->implicitobsoleteusesprovides && s->name != ps->name)
-		    continue;
-		  if (pool->implicitobsoleteusescolors && !pool_colormatch(pool, s, ps))
-		    continue;
-		  if (p == SYSTEMSOLVABLE)
-		    p = 0;
-		  if (s->name == ps->name)
-		    {
-		      /* optimization: do not add the same-name conflict rule if it was
-		       * already added when we looked at the other package.
-		       * (this assumes pool_colormatch is symmetric) */
-		      if (p && m && ps->repo != installed && MAPTST(m, p) &&
-			  (ps->arch != ARCH_SRC && ps->arch != ARCH_NOSRC) &&
-			  !(solv->multiversion.size && MAPTST(&solv->multiversion, p)))
-			continue;
-		      addpkgrule(solv, -n, -p, 0, SOLVER_RULE_PKG_SAME_NAME, 0);
-		    }
-		  else
-		    addpkgrule(solv, -n, -p, 0, SOLVER_RULE_PKG_IMPLICIT_OBSOLETES, s->name);
-		}
-	    }
+	  queue_push(&pb->deferq, n);
+	  pb->visitq.elements[pb->visitq.count - 1] = pb->deferq.count;
 	}
+      else
+	addpkgrules_conflicts(solv, n, dontfix, m, &workq, 0, 0);
 
       if (m && pool->implicitobsoleteusescolors && pool_arch2score(pool, s->arch) > 1)
 	{
@@ -1152,6 +1274,205 @@ solver_addpkgrulesforsolvable(Solver *solv, Solvable *s, Map *m)
   queue_free(&workq);
 }
 
+void
+solver_addpkgrulesforsolvable(Solver *solv, Solvable *s, Map *m)
+{
+  addpkgrulesforsolvable(solv, s, m, 0);
+}
+
+#define PKGRULES_CHUNK 256
+
+struct pkgrules_parallel {
+  Solver *solv;
+  Map *m;
+  struct pkgrules_batch *pb;
+  Queue *bufs;		/* rules created by the tasks */
+  Id *deferstart;	/* start of the rules of a deferred solvable, -1: not done */
+  Id *deferend;
+};
+
+static void
+pkgrules_task(void *vp, int task)
+{
+  struct pkgrules_parallel *ppar = vp;
+  Solver *solv = ppar->solv;
+  struct pkgrules_batch *pb = ppar->pb;
+  Queue *buf = ppar->bufs + task;
+  int i, end = (task + 1) * PKGRULES_CHUNK;
+  Id n;
+
+  if (end > pb->deferq.count)
+    end = pb->deferq.count;
+  for (i = task * PKGRULES_CHUNK; i < end; i++)
+    {
+      n = pb->deferq.elements[i];
+      ppar->deferstart[i] = buf->count;
+      if (!addpkgrules_conflicts(solv, n, pkgrules_dontfix(solv, solv->pool->solvables + n), ppar->m, 0, pb->visitpos, buf))
+	{
+	  queue_truncate(buf, ppar->deferstart[i]);
+	  ppar->deferstart[i] = -1;
+	}
+      ppar->deferend[i] = buf->count;
+    }
+}
+
+/* add the buffered rules */
+static void
+replaypkgrules(Solver *solv, Id *op, int cnt, int *recstartp)
+{
+  for (; cnt > 0; op += 3, cnt -= 3)
+    {
+      if (op[0])
+	solver_addrule(solv, op[0], op[1], op[2]);
+      else if (op[2] == PKGRULEBUF_RECOMMENDS)
+	{
+	  *recstartp = solv->nrules;
+	  solv->lastpkgrule = 0;
+	}
+      else if (op[2] == PKGRULEBUF_RECOMMENDS_END && *recstartp < solv->nrules)
+	addrecommendsrules(solv, *recstartp);
+    }
+}
+
+static void
+pkgrules_pushdeps(Pool *pool, Solvable *s, Offset deps, Queue *q)
+{
+  Id dep, *dp;
+
+  if (!deps)
+    return;
+  dp = s->repo->idarraydata + deps;
+  while ((dep = *dp++) != 0)
+    {
+      if (dep == SOLVABLE_PREREQMARKER)
+	continue;
+#ifdef ENABLE_COMPLEX_DEPS
+      if (pool_is_complex_dep(pool, dep))
+	continue;
+#endif
+      queue_push(q, dep);
+    }
+}
+
+/*-------------------------------------------------------------------
+ *
+ * add dependency rules for all solvables in roots
+ *
+ * this is the same as calling solver_addpkgrulesforsolvable() for
+ * every root. If parallel pkg rule creation is enabled, the graph
+ * is still walked in the calling thread, but the rules are buffered.
+ * The providers of the dependencies and the conflicts/obsoletes rules
+ * are then computed with multiple threads, and the rules are added
+ * in the same order as in the serial case.
+ */
+
+void
+solver_addpkgrulesforsolvables(Solver *solv, Queue *roots, Map *m)
+{
+  Pool *pool = solv->pool;
+  struct pkgrules_batch pb;
+  struct pkgrules_parallel ppar;
+  Queue depq;
+  int i, j, end, ntasks, nthreads;
+  int recstart = 0;
+  Id n, lastpkgrule, *vp;
+  Solvable *s;
+
+  if (!solv->parallel_pkgrules || !m || solv->ruleinfoq || !pool->whatprovides)
+    {
+      for (i = 0; i < roots->count; i++)
+	addpkgrulesforsolvable(solv, pool->solvables + roots->elements[i], m, 0);
+      return;
+    }
+  nthreads = solv->parallel_pkgrules > 1 ? solv->parallel_pkgrules : 0;
+
+  /* look up the providers of the dependencies of the roots */
+  queue_init(&depq);
+  for (i = 0; i < roots->count; i++)
+    {
+      n = roots->elements[i];
+      if (MAPTST(m, n))
+	continue;
+      s = pool->solvables + n;
+      pkgrules_pushdeps(pool, s, s->requires, &depq);
+      if (s->arch == ARCH_SRC || s->arch == ARCH_NOSRC)
+	continue;
+      pkgrules_pushdeps(pool, s, s->conflicts, &depq);
+      pkgrules_pushdeps(pool, s, s->obsoletes, &depq);
+    }
+  pool_addrelproviders_parallel(pool, &depq, nthreads);
+
+  /* walk the graph, buffer the rules */
+  queue_init(&pb.visitq);
+  queue_init(&pb.opq);
+  queue_init(&pb.deferq);
+  pb.visitpos = solv_calloc(pool->nsolvables, sizeof(Id));
+  lastpkgrule = solv->lastpkgrule;
+  solv->pkgrulebuf = &pb.opq;
+  for (i = 0; i < roots->count; i++)
+    addpkgrulesforsolvable(solv, pool->solvables + roots->elements[i], m, &pb);
+  solv->pkgrulebuf = 0;
+  solv->lastpkgrule = lastpkgrule;
+
+  /* create the deferred conflicts/obsoletes rules */
+  memset(&ppar, 0, sizeof(ppar));
+  if (pb.deferq.count)
+    {
+      /* the colors are computed lazily, so do it now */
+      if (pool->obsoleteusescolors || pool->implicitobsoleteusescolors)
+	for (i = 2; i < pool->nsolvables; i++)
+	  if (pool->solvables[i].repo)
+	    pool_arch2color(pool, pool->solvables[i].arch);
+      queue_empty(&depq);
+      for (i = 0; i < pb.deferq.count; i++)
+	{
+	  s = pool->solvables + pb.deferq.elements[i];
+	  pkgrules_pushdeps(pool, s, s->conflicts, &depq);
+	  pkgrules_pushdeps(pool, s, s->obsoletes, &depq);
+	  queue_push(&depq, s->name);
+	}
+      pool_addrelproviders_parallel(pool, &depq, nthreads);
+      ntasks = (pb.deferq.count + PKGRULES_CHUNK - 1) / PKGRULES_CHUNK;
+      ppar.solv = solv;
+      ppar.m = m;
+      ppar.pb = &pb;
+      ppar.bufs = solv_calloc(ntasks, sizeof(Queue));
+      for (i = 0; i < ntasks; i++)
+	queue_init(ppar.bufs + i);
+      ppar.deferstart = solv_calloc(pb.deferq.count, sizeof(Id));
+      ppar.deferend = solv_calloc(pb.deferq.count, sizeof(Id));
+      solv_parallel(ntasks, nthreads, pkgrules_task, &ppar);
+    }
+  else
+    ntasks = 0;
+  queue_free(&depq);
+
+  /* now add all rules in the serial order */
+  vp = pb.visitq.elements;
+  for (i = 0; i < pb.visitq.count; i += 3)
+    {
+      end = i + 3 < pb.visitq.count ? vp[i + 4] : pb.opq.count;
+      replaypkgrules(solv, pb.opq.elements + vp[i + 1], end - vp[i + 1], &recstart);
+      if (!vp[i + 2])
+	continue;
+      j = vp[i + 2] - 1;
+      if (ppar.deferstart[j] >= 0)
+	replaypkgrules(solv, ppar.bufs[j / PKGRULES_CHUNK].elements + ppar.deferstart[j], ppar.deferend[j] - ppar.deferstart[j], &recstart);
+      else
+	addpkgrules_conflicts(solv, vp[i], pkgrules_dontfix(solv, pool->solvables + vp[i]), m, 0, pb.visitpos, 0);
+    }
+
+  for (i = 0; i < ntasks; i++)
+    queue_free(ppar.bufs + i);
+  solv_free(ppar.bufs);
+  solv_free(ppar.deferstart);
+  solv_free(ppar.deferend);
+  solv_free(pb.visitpos);
+  queue_free(&pb.visitq);
+  queue_free(&pb.opq);
+  queue_free(&pb.deferq);
+}
+
 #ifdef ENABLE_LINKED_PKGS
 void
 solver_addpkgrulesforlinked(Solver *solv, Map *m)
@@ -1458,7 +1779,7 @@ solver_addupdaterule(Solver *solv, Solvable *s)
 #endif
       p = 0;
       queue_push(&solv->orphaned, s - pool->solvables);		/* an orphaned package */
-      if (solv->keep_orphans && !(solv->droporphanedmap_all || (solv->droporphanedmap.size && MAPTST(&solv->droporphanedmap, s - pool->solvables - solv->installed->start))))
+      if (solv->keep_orphans && !(solv->droporphanedmap_all || (solv->droporphanedmap.size && SPARSEMAPTST(&solv->droporphanedmap, s - pool->solvables - solv->installed->start))))
 	p = s - pool->solvables;	/* keep this orphaned package installed */
       solver_addrule(solv, p, 0, 0);
       return;
@@ -1503,7 +1824,7 @@ solver_addupdaterule(Solver *solv, Solvable *s)
 	      /* this is a multiversion orphan */
 	      queue_push(&solv->orphaned, p);
 	      set_specialupdaters(solv, s, d);
-	      if (solv->keep_orphans && !(solv->droporphanedmap_all || (solv->droporphanedmap.size && MAPTST(&solv->droporphanedmap, p - solv->installed->start))))
+	      if (solv->keep_orphans && !(solv->droporphanedmap_all || (solv->droporphanedmap.size && SPARSEMAPTST(&solv->droporphanedmap, p - solv->installed->start))))
 		{
 		  /* we need to keep the orphan */
 		  queue_free(&qs);
@@ -1551,7 +1872,7 @@ disableupdaterule(Solver *solv, Id p)
 {
   Rule *r;
 
-  MAPSET(&solv->noupdate, p - solv->installed->start);
+  SPARSEMAPSET(&solv->noupdate, p - solv->installed->start);
   r = solv->rules + solv->updaterules + (p - solv->installed->start);
   if (r->p && r->d >= 0)
     solver_disablerule(solv, r);
@@ -1574,7 +1895,7 @@ reenableupdaterule(Solver *solv, Id p)
   Pool *pool = solv->pool;
   Rule *r;
 
-  MAPCLR(&solv->noupdate, p - solv->installed->start);
+  SPARSEMAPCLR(&solv->noupdate, p - solv->installed->start);
   r = solv->rules + solv->updaterules + (p - solv->installed->start);
   if (r->p)
     {
@@ -2709,7 +3030,7 @@ solver_disablepolicyrules(Solver *solv)
 	if (MAPTST(&solv->cleandepsmap, i - solv->installed->start))
 	  queue_push2(&allq, DISABLE_UPDATE, i);
     }
-  MAPZERO(&solv->noupdate);
+  sparsemap_empty(&solv->noupdate);
   for (i = 0; i < allq.count; i += 2)
     {
       Id type = allq.elements[i], arg = allq.elements[i + 1];
@@ -3450,6 +3771,7 @@ solver_addchoicerules(Solver *solv)
   unsigned int now;
   int isinstalled;
   int dodowngradecheck = solv->allowdowngrade;
+  Arenamark mark;
 
   solv->choicerules = solv->nrules;
   if (!pool->installed)
@@ -3460,12 +3782,13 @@ solver_addchoicerules(Solver *solv)
   now = solv_timems(0);
   if ((solv->dupinvolvedmap_all || solv->dupinvolvedmap.size) && solv->dup_allowdowngrade)
     dodowngradecheck = 1;
-  queue_init(&q);
-  queue_init(&qi);
-  queue_init(&qcheck);
-  queue_init(&infoq);
-  map_init(&m, pool->nsolvables);
-  map_init(&mneg, pool->nsolvables);
+  mark = arena_mark(&solv->arena);
+  arena_queue_init(&solv->arena, &q, 64);
+  arena_queue_init(&solv->arena, &qi, 64);
+  arena_queue_init(&solv->arena, &qcheck, 64);
+  arena_queue_init(&solv->arena, &infoq, 64);
+  arena_map_init(&solv->arena, &m, pool->nsolvables);
+  arena_map_init(&solv->arena, &mneg, pool->nsolvables);
   /* set up negative assertion map from infarch and dup rules */
   for (rid = solv->infarchrules, r = solv->rules + rid; rid < solv->infarchrules_end; rid++, r++)
     if (r->p < 0 && !r->w2 && (r->d == 0 || r->d == -1))
@@ -3650,8 +3973,7 @@ solver_addchoicerules(Solver *solv)
   queue_free(&qi);
   queue_free(&qcheck);
   queue_free(&infoq);
-  map_free(&m);
-  map_free(&mneg);
+  arena_release(&solv->arena, mark);
   solv->choicerules_end = solv->nrules;
   POOL_DEBUG(SOLV_DEBUG_STATS, "choice rule creation took %d ms\n", solv_timems(now));
 }
@@ -3948,7 +4270,7 @@ solver_addbestrules(Solver *solv, int havebestinstalljobs, int haslockjob)
 		    }
 		}
 	    }
-	  if (solv->allowuninstall || solv->allowuninstall_all || (solv->allowuninstallmap.size && MAPTST(&solv->allowuninstallmap, p - installed->start)))
+	  if (solv->allowuninstall || solv->allowuninstall_all || (solv->allowuninstallmap.size && SPARSEMAPTST(&solv->allowuninstallmap, p - installed->start)))
 	    {
 	      /* package is flagged both for allowuninstall and best, add negative rules */
 	      int rid;
@@ -4289,7 +4611,7 @@ solver_breakorphans(Solver *solv)
       Id p = solv->orphaned.elements[i];
       if (pool->solvables[p].repo != installed)
 	continue;
-      if (solv->droporphanedmap.size && MAPTST(&solv->droporphanedmap, p - installed->start))
+      if (solv->droporphanedmap.size && SPARSEMAPTST(&solv->droporphanedmap, p - installed->start))
 	continue;
       MAPSET(&m, p - installed->start);
     }
@@ -117,6 +117,7 @@ extern void solver_shrinkrules(struct s_Solver *solv, int nrules);
 
 /* pkg rules */
 extern void solver_addpkgrulesforsolvable(struct s_Solver *solv, Solvable *s, Map *m);
+extern void solver_addpkgrulesforsolvables(struct s_Solver *solv, Queue *roots, Map *m);
 extern void solver_addpkgrulesforweak(struct s_Solver *solv, Map *m);
 extern void solver_addpkgrulesforlinked(struct s_Solver *solv, Map *m);
 extern void solver_addpkgrulesforupdaters(struct s_Solver *solv, Solvable *s, Map *m, int allow_all);
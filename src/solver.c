@@ -30,6 +30,25 @@
 
 #define RULES_BLOCK 63
 
+/* restart mode tuning */
+#define RESTART_LUBY_UNIT	100	/* conflicts per luby sequence unit */
+#define REDUCE_FIRST		2000	/* conflicts before the first learnt rule reduction */
+#define REDUCE_INC		300	/* increment of the reduction interval */
+
+/* solver phases for the statistics */
+#define PHASE_ASSERTIONS	0
+#define PHASE_JOBS		1
+#define PHASE_INSTALLED		2
+#define PHASE_DEPENDENCIES	3
+#define PHASE_CLEANDEPS		4
+#define PHASE_WEAK		5
+#define PHASE_ORPHANED		6
+#define PHASE_MINIMIZE		7
+
+static const char *phase2str[SOLVER_STATS_NPHASES] = {
+  "assertions", "jobs", "installed", "dependencies", "cleandeps", "weak", "orphaned", "minimize"
+};
+
 
 /************************************************************************/
 
@@ -51,6 +70,8 @@ enabledisablelearntrules(Solver *solv)
   POOL_DEBUG(SOLV_DEBUG_SOLUTIONS, "enabledisablelearntrules called\n");
   for (i = solv->learntrules, r = solv->rules + i; i < solv->nrules; i++, r++)
     {
+      if (solv->learnt_lbd.count && !solv->learnt_lbd.elements[i - solv->learntrules])
+	continue;	/* deleted learnt rule, stays disabled */
       whyp = solv->learnt_pool.elements + solv->learnt_why.elements[i - solv->learntrules];
       while ((why = *whyp++) != 0)
 	{
@@ -348,6 +369,23 @@ makeruledecisions(Solver *solv, int disablerules)
  * initial setup for all watches
  */
 
+/* learnt rules deleted by reduce_learntrules() do not get watches */
+#define ISDELETEDLEARNT(solv, r) ((r) - (solv)->rules >= (solv)->learntrules && (solv)->learnt_lbd.count && !(solv)->learnt_lbd.elements[(r) - (solv)->rules - (solv)->learntrules])
+
+static void
+freewatchvecs(Solver *solv)
+{
+  int i, nwatchvecs;
+
+  if (!solv->watchvecs)
+    return;
+  nwatchvecs = 2 * solv->nwatchvecsolvables;
+  for (i = 0; i < nwatchvecs; i++)
+    queue_free(solv->watchvecs + i);
+  solv->watchvecs = solv_free(solv->watchvecs);
+  solv->nwatchvecsolvables = 0;
+}
+
 static void
 makewatches(Solver *solv)
 {
@@ -355,13 +393,37 @@ makewatches(Solver *solv)
   int i;
   int nsolvables = solv->pool->nsolvables;
 
-  solv_free(solv->watches);
+  solv->watches = solv_free(solv->watches);
+  freewatchvecs(solv);
+  if (solv->watchvectors)
+    {
+      /* contiguous watch vectors with (rule, blocker) pairs. The
+       * newest entry is at the end, so that walking the vector
+       * backwards visits the rules in the same order as the linked
+       * lists below */
+      Queue *watchvecs;
+      solv->watchvecs = solv_calloc(2 * nsolvables, sizeof(Queue));
+      solv->nwatchvecsolvables = nsolvables;
+      watchvecs = solv->watchvecs + nsolvables;
+      for (i = 1, r = solv->rules + solv->nrules - 1; i < solv->nrules; i++, r--)
+	{
+	  if (!r->w2)		/* assertions do not need watches */
+	    continue;
+	  if (ISDELETEDLEARNT(solv, r))
+	    continue;
+	  queue_push2(watchvecs + r->w1, r - solv->rules, r->w2);
+	  queue_push2(watchvecs + r->w2, r - solv->rules, r->w1);
+	}
+      return;
+    }
   /* lower half for removals, upper half for installs */
   solv->watches = solv_calloc(2 * nsolvables, sizeof(Id));
   for (i = 1, r = solv->rules + solv->nrules - 1; i < solv->nrules; i++, r--)
     {
       if (!r->w2)		/* assertions do not need watches */
 	continue;
+      if (ISDELETEDLEARNT(solv, r))
+	continue;
 
       /* see addwatches_rule(solv, r) */
       r->n1 = solv->watches[nsolvables + r->w1];
@@ -373,6 +435,156 @@ makewatches(Solver *solv)
 }
 
 
+/*-------------------------------------------------------------------
+ * incremental mode: keep the watches of the pkg rules
+ *
+ * savepkgwatches links the pkg rules into watch lists of their own and
+ * stores a copy of the linked rules. makewatches_pkgsaved then only
+ * needs to append the other rules, the resulting lists are identical
+ * to the ones makewatches creates. With watch vectors the vectors of
+ * the pkg rules are saved instead, the other rules are put in front
+ * of them.
+ */
+
+static void
+freepkgwatches(Solver *solv)
+{
+  int i;
+
+  solv->pkgrules_saved = solv_free(solv->pkgrules_saved);
+  solv->pkgwatches = solv_free(solv->pkgwatches);
+  solv->pkgwatchtails = solv_free(solv->pkgwatchtails);
+  if (solv->pkgwatchvecs)
+    {
+      for (i = 0; i < 2 * solv->npkgwatchvecsolvables; i++)
+	queue_free(solv->pkgwatchvecs + i);
+      solv->pkgwatchvecs = solv_free(solv->pkgwatchvecs);
+      solv->npkgwatchvecsolvables = 0;
+    }
+}
+
+static void
+savepkgwatchvecs(Solver *solv)
+{
+  int nsolvables = solv->pool->nsolvables;
+  Queue *watchvecs;
+  Rule *r;
+  int i;
+
+  solv->pkgwatchvecs = solv_calloc(2 * nsolvables, sizeof(Queue));
+  solv->npkgwatchvecsolvables = nsolvables;
+  watchvecs = solv->pkgwatchvecs + nsolvables;
+  for (i = solv->pkgrules_end - 1, r = solv->rules + i; i > 0; i--, r--)
+    {
+      if (!r->w2)		/* assertions do not need watches */
+	continue;
+      queue_push2(watchvecs + r->w1, i, r->w2);
+      queue_push2(watchvecs + r->w2, i, r->w1);
+    }
+  solv->pkgrules_saved = solv_memdup2(solv->rules + 1, solv->pkgrules_end - 1, sizeof(Rule));
+}
+
+static void
+savepkgwatches(Solver *solv)
+{
+  int nsolvables = solv->pool->nsolvables;
+  Id *watches, *tails;
+  Rule *r;
+  int i;
+
+  freepkgwatches(solv);
+  if (solv->pkgrules_end <= 1)
+    return;
+  if (solv->watchvectors)
+    {
+      savepkgwatchvecs(solv);
+      return;
+    }
+  watches = solv_calloc(2 * nsolvables, sizeof(Id));
+  tails = solv_calloc(2 * nsolvables, sizeof(Id));
+  for (i = solv->pkgrules_end - 1, r = solv->rules + i; i > 0; i--, r--)
+    {
+      if (!r->w2)		/* assertions do not need watches */
+	continue;
+      if (!tails[nsolvables + r->w1])
+	tails[nsolvables + r->w1] = i;
+      r->n1 = watches[nsolvables + r->w1];
+      watches[nsolvables + r->w1] = i;
+      if (!tails[nsolvables + r->w2])
+	tails[nsolvables + r->w2] = i;
+      r->n2 = watches[nsolvables + r->w2];
+      watches[nsolvables + r->w2] = i;
+    }
+  solv->pkgwatches = watches;
+  solv->pkgwatchtails = tails;
+  solv->pkgrules_saved = solv_memdup2(solv->rules + 1, solv->pkgrules_end - 1, sizeof(Rule));
+}
+
+static inline void
+appendwatch(Solver *solv, Id *tails, Id lit, Id rid)
+{
+  int nsolvables = solv->pool->nsolvables;
+  Id t = tails[nsolvables + lit];
+
+  if (!t)
+    solv->watches[nsolvables + lit] = rid;
+  else if (solv->rules[t].w1 == lit)
+    solv->rules[t].n1 = rid;
+  else
+    solv->rules[t].n2 = rid;
+  tails[nsolvables + lit] = rid;
+}
+
+/* like makewatches, but start with the saved watches of the pkg rules.
+ * The pkg rules must be restored from pkgrules_saved. */
+static void
+makewatches_pkgsaved(Solver *solv)
+{
+  Rule *r;
+  int i;
+  int nsolvables = solv->pool->nsolvables;
+  Id *tails;
+
+  solv->watches = solv_free(solv->watches);
+  freewatchvecs(solv);
+  if (solv->pkgwatchvecs)
+    {
+      /* the vectors have the newest rule first, so the other rules
+       * go in front of the pkg rules */
+      Queue *watchvecs, *pkgwatchvecs = solv->pkgwatchvecs;
+      solv->watchvecs = solv_calloc(2 * nsolvables, sizeof(Queue));
+      solv->nwatchvecsolvables = nsolvables;
+      watchvecs = solv->watchvecs + nsolvables;
+      for (i = solv->nrules - 1, r = solv->rules + i; i >= solv->pkgrules_end; i--, r--)
+	{
+	  if (!r->w2)		/* assertions do not need watches */
+	    continue;
+	  if (ISDELETEDLEARNT(solv, r))
+	    continue;
+	  queue_push2(watchvecs + r->w1, i, r->w2);
+	  queue_push2(watchvecs + r->w2, i, r->w1);
+	}
+      for (i = 0; i < 2 * nsolvables; i++)
+	if (pkgwatchvecs[i].count)
+	  queue_insertn(solv->watchvecs + i, solv->watchvecs[i].count, pkgwatchvecs[i].count, pkgwatchvecs[i].elements);
+      return;
+    }
+  solv->watches = solv_memdup2(solv->pkgwatches, 2 * nsolvables, sizeof(Id));
+  tails = solv_memdup2(solv->pkgwatchtails, 2 * nsolvables, sizeof(Id));
+  for (i = solv->pkgrules_end, r = solv->rules + i; i < solv->nrules; i++, r++)
+    {
+      if (!r->w2)		/* assertions do not need watches */
+	continue;
+      if (ISDELETEDLEARNT(solv, r))
+	continue;
+      r->n1 = r->n2 = 0;
+      appendwatch(solv, tails, r->w1, i);
+      appendwatch(solv, tails, r->w2, i);
+    }
+  solv_free(tails);
+}
+
+
 /*-------------------------------------------------------------------
  *
  * add watches (for a new learned rule)
@@ -386,6 +598,12 @@ addwatches_rule(Solver *solv, Rule *r)
 {
   int nsolvables = solv->pool->nsolvables;
 
+  if (solv->watchvecs)
+    {
+      queue_push2(solv->watchvecs + nsolvables + r->w1, r - solv->rules, r->w2);
+      queue_push2(solv->watchvecs + nsolvables + r->w2, r - solv->rules, r->w1);
+      return;
+    }
   r->n1 = solv->watches[nsolvables + r->w1];
   solv->watches[nsolvables + r->w1] = r - solv->rules;
 
@@ -420,6 +638,8 @@ addwatches_rule(Solver *solv, Rule *r)
  *          rule = conflict found in this rule
  */
 
+static Rule *propagate_watchvecs(Solver *solv, int level);
+
 static Rule *
 propagate(Solver *solv, int level)
 {
@@ -429,7 +649,11 @@ propagate(Solver *solv, int level)
   Id p, pkg, other_watch;
   Id *dp;
   Id *decisionmap = solv->decisionmap;
-  Id *watches = solv->watches + pool->nsolvables;   /* place ptr in middle */
+  Id *watches;
+
+  if (solv->watchvecs)
+    return propagate_watchvecs(solv, level);
+  watches = solv->watches + pool->nsolvables;   /* place ptr in middle */
 
   POOL_DEBUG(SOLV_DEBUG_PROPAGATE, "----- propagate level %d -----\n", level);
 
@@ -441,6 +665,7 @@ propagate(Solver *solv, int level)
        * negate because our watches trigger if literal goes FALSE
        */
       pkg = -solv->decisionq.elements[solv->propagate_index++];
+      solv->stats_propagations++;
 	
       IF_POOLDEBUG (SOLV_DEBUG_PROPAGATE)
         {
@@ -452,6 +677,7 @@ propagate(Solver *solv, int level)
       for (rp = watches + pkg; *rp; rp = next_rp)
 	{
 	  r = solv->rules + *rp;
+	  solv->stats_watchvisits++;
 	  if (r->d < 0)
 	    {
 	      /* rule is disabled, goto next */
@@ -599,6 +825,180 @@ propagate(Solver *solv, int level)
 }
 
 
+/*-------------------------------------------------------------------
+ *
+ * propagate_watchvecs
+ *
+ * same as propagate(), but uses the watch vectors instead of the
+ * linked lists in the rules. Each watch entry caches a "blocker"
+ * literal of the rule, so that we do not need to look at the rule
+ * at all if the blocker is already true.
+ */
+
+static Rule *
+propagate_watchvecs(Solver *solv, int level)
+{
+  Pool *pool = solv->pool;
+  Rule *r, *conflict = 0;
+  Id p, pkg, other_watch, blocker, rid;
+  Id *dp;
+  Id *decisionmap = solv->decisionmap;
+  Queue *watchvecs = solv->watchvecs + pool->nsolvables;   /* place ptr in middle */
+  Queue *wq;
+  Id *wstart, *wend, *wp, *wkeep;
+
+  POOL_DEBUG(SOLV_DEBUG_PROPAGATE, "----- propagate level %d -----\n", level);
+
+  /* foreach non-propagated decision */
+  while (solv->propagate_index < solv->decisionq.count)
+    {
+      /*
+       * 'pkg' was just decided
+       * negate because our watches trigger if literal goes FALSE
+       */
+      pkg = -solv->decisionq.elements[solv->propagate_index++];
+      solv->stats_propagations++;
+
+      IF_POOLDEBUG (SOLV_DEBUG_PROPAGATE)
+        {
+	  POOL_DEBUG(SOLV_DEBUG_PROPAGATE, "propagate decision %d:", -pkg);
+	  solver_printruleelement(solv, SOLV_DEBUG_PROPAGATE, 0, -pkg);
+        }
+
+      /* foreach rule where 'pkg' is now FALSE. We walk the vector
+       * backwards and compact the kept entries towards its end.
+       * Moved watches never go to the vector of 'pkg' as 'pkg' is FALSE,
+       * so the vector does not get reallocated while we walk it. */
+      wq = watchvecs + pkg;
+      wstart = wq->elements;
+      wend = wkeep = wp = wstart + wq->count;
+      while (wp > wstart)
+	{
+	  wp -= 2;
+	  rid = wp[0];
+	  blocker = wp[1];
+	  if (DECISIONMAP_TRUE(blocker))
+	    {
+	      /* rule is fulfilled, no need to look at it */
+	      wkeep -= 2;
+	      wkeep[0] = rid;
+	      wkeep[1] = blocker;
+	      continue;
+	    }
+	  r = solv->rules + rid;
+	  solv->stats_watchvisits++;
+	  if (r->d < 0)
+	    {
+	      /* rule is disabled, goto next */
+	      wkeep -= 2;
+	      wkeep[0] = rid;
+	      wkeep[1] = blocker;
+	      continue;
+	    }
+
+	  IF_POOLDEBUG (SOLV_DEBUG_WATCHES)
+	    {
+	      POOL_DEBUG(SOLV_DEBUG_WATCHES, "  watch triggered ");
+	      solver_printrule(solv, SOLV_DEBUG_WATCHES, r);
+	    }
+
+	  /* find the other watch */
+	  other_watch = pkg == r->w1 ? r->w2 : r->w1;
+	  if (DECISIONMAP_TRUE(other_watch))
+	    {
+	      wkeep -= 2;
+	      wkeep[0] = rid;
+	      wkeep[1] = other_watch;
+	      continue;
+	    }
+
+          if (r->d)
+	    {
+	      /* Not a binary clause, try to move our watch.
+	       * See propagate() for the details */
+	      if (r->p && r->p != other_watch && !DECISIONMAP_FALSE(r->p))
+		p = r->p;
+	      else
+		{
+		  for (dp = pool->whatprovidesdata + r->d; (p = *dp++) != 0;)
+		    if (p != other_watch && !DECISIONMAP_FALSE(p))
+		      break;
+		}
+	      if (p)
+		{
+		  IF_POOLDEBUG (SOLV_DEBUG_WATCHES)
+		    {
+		      if (p > 0)
+			POOL_DEBUG(SOLV_DEBUG_WATCHES, "    -> move w%d to %s\n", (pkg == r->w1 ? 1 : 2), pool_solvid2str(pool, p));
+		      else
+			POOL_DEBUG(SOLV_DEBUG_WATCHES, "    -> move w%d to !%s\n", (pkg == r->w1 ? 1 : 2), pool_solvid2str(pool, -p));
+		    }
+		  if (pkg == r->w1)
+		    r->w1 = p;
+		  else
+		    r->w2 = p;
+		  queue_push2(watchvecs + p, rid, other_watch);
+		  continue;	/* entry is dropped from this vector */
+		}
+	      /* search failed, thus all unwatched literals are FALSE */
+	    }
+
+	  /* keep the entry in any case */
+	  wkeep -= 2;
+	  wkeep[0] = rid;
+	  wkeep[1] = other_watch;
+
+	  /*
+	   * unit clause found, set literal other_watch to TRUE
+	   */
+	  if (DECISIONMAP_FALSE(other_watch))	   /* check if literal is FALSE */
+	    {
+	      conflict = r;		   /* eek, a conflict! */
+	      break;
+	    }
+
+	  IF_POOLDEBUG (SOLV_DEBUG_PROPAGATE)
+	    {
+	      POOL_DEBUG(SOLV_DEBUG_PROPAGATE, "  unit ");
+	      solver_printrule(solv, SOLV_DEBUG_PROPAGATE, r);
+	    }
+
+	  if (other_watch > 0)
+            decisionmap[other_watch] = level;    /* install! */
+	  else
+	    decisionmap[-other_watch] = -level;  /* remove! */
+
+	  queue_push(&solv->decisionq, other_watch);
+	  queue_push(&solv->decisionq_why, rid);
+
+	  IF_POOLDEBUG (SOLV_DEBUG_PROPAGATE)
+	    {
+	      if (other_watch > 0)
+		POOL_DEBUG(SOLV_DEBUG_PROPAGATE, "    -> decided to install %s\n", pool_solvid2str(pool, other_watch));
+	      else
+		POOL_DEBUG(SOLV_DEBUG_PROPAGATE, "    -> decided to conflict %s\n", pool_solvid2str(pool, -other_watch));
+	    }
+	} /* foreach rule involving 'pkg' */
+
+      /* close the gap between the unprocessed and the kept entries */
+      if (wkeep != wp)
+	{
+	  if (wend != wkeep)
+	    memmove(wp, wkeep, (wend - wkeep) * sizeof(Id));
+	  wq->left += wkeep - wp;
+	  wq->count -= wkeep - wp;
+	}
+      if (conflict)
+	return conflict;
+
+    } /* while we have non-decided decisions */
+
+  POOL_DEBUG(SOLV_DEBUG_PROPAGATE, "----- propagate end -----\n");
+
+  return 0;	/* all is well */
+}
+
+
 /********************************************************************/
 /* Analysis */
 
@@ -673,7 +1073,6 @@ analyze(Solver *solv, int level, Rule *c, Rule **lrp)
   Pool *pool = solv->pool;
   Queue q;
   Rule *r;
-  Id q_buf[8];
   int rlevel = 1;
   Map seen;		/* global? */
   Id p = 0, pp, v, vv, why;
@@ -681,11 +1080,12 @@ analyze(Solver *solv, int level, Rule *c, Rule **lrp)
   int num = 0, l1num = 0;
   int learnt_why = solv->learnt_pool.count;
   Id *decisionmap = solv->decisionmap;
+  Arenamark mark = arena_mark(&solv->arena);
 
-  queue_init_buffer(&q, q_buf, sizeof(q_buf)/sizeof(*q_buf));
+  arena_queue_init(&solv->arena, &q, 64);
 
   POOL_DEBUG(SOLV_DEBUG_ANALYZE, "ANALYZE at %d ----------------------\n", level);
-  map_init(&seen, pool->nsolvables);
+  arena_map_init(&solv->arena, &seen, pool->nsolvables);
   idx = solv->decisionq.count;
   for (;;)
     {
@@ -753,7 +1153,6 @@ l1retry:
 	goto l1retry;
       c = solv->rules + why;
     }
-  map_free(&seen);
   assert(p != 0);
   assert(rlevel > 0 && rlevel < level);
   IF_POOLDEBUG (SOLV_DEBUG_ANALYZE)
@@ -767,6 +1166,27 @@ l1retry:
   queue_push(&solv->learnt_pool, 0);
   solv->stats_learned++;
 
+  if (solv->restarts)
+    {
+      /* calculate the glue (number of different decision levels) of
+       * the new rule before we revert the decisions */
+      Map levels;
+      int lbd = 1;	/* the conflict level */
+      arena_map_init(&solv->arena, &levels, level + 1);
+      for (i = 0; i < q.count; i++)
+	{
+	  l = solv->decisionmap[q.elements[i] > 0 ? q.elements[i] : -q.elements[i]];
+	  if (l < 0)
+	    l = -l;
+	  if (!MAPTST(&levels, l))
+	    {
+	      MAPSET(&levels, l);
+	      lbd++;
+	    }
+	}
+      queue_push(&solv->learnt_lbd, lbd);
+    }
+
   POOL_DEBUG(SOLV_DEBUG_ANALYZE, "reverting decisions (level %d -> %d)\n", level, rlevel);
   level = rlevel;
   revert(solv, level);
@@ -782,6 +1202,7 @@ l1retry:
       queue_free(&q);
       r = solver_addrule(solv, p, 0, d);
     }
+  arena_release(&solv->arena, mark);
   assert(solv->learnt_why.count == (r - solv->rules) - solv->learntrules);
   queue_push(&solv->learnt_why, learnt_why);
   if (r->w2)
@@ -965,6 +1386,7 @@ analyze_unsolvable(Solver *solv, Rule *cr, int disablerules)
   int oldproblemcount;
   int oldlearntpoolcount;
   int record_proof = 1;
+  Arenamark mark = arena_mark(&solv->arena);
 
   POOL_DEBUG(SOLV_DEBUG_UNSOLVABLE, "ANALYZE UNSOLVABLE ----------------------\n");
   solv->stats_unsolvable++;
@@ -977,9 +1399,9 @@ analyze_unsolvable(Solver *solv, Rule *cr, int disablerules)
   queue_push(&solv->problems, 0);
 
   r = cr;
-  map_init(&involved, pool->nsolvables);
-  map_init(&rseen, solv->learntrules ? solv->nrules - solv->learntrules : 0);
-  queue_init(&weakq);
+  arena_map_init(&solv->arena, &involved, pool->nsolvables);
+  arena_map_init(&solv->arena, &rseen, solv->learntrules ? solv->nrules - solv->learntrules : 0);
+  arena_queue_init(&solv->arena, &weakq, 16);
   if (record_proof)
     queue_push(&solv->learnt_pool, r - solv->rules);
   analyze_unsolvable_rule(solv, r, &weakq, &rseen);
@@ -1015,8 +1437,6 @@ analyze_unsolvable(Solver *solv, Rule *cr, int disablerules)
 	  MAPSET(&involved, vv);
 	}
     }
-  map_free(&involved);
-  map_free(&rseen);
   queue_push(&solv->problems, 0);	/* mark end of this problem */
 
   if (weakq.count)
@@ -1027,10 +1447,12 @@ analyze_unsolvable(Solver *solv, Rule *cr, int disablerules)
       /* disable some weak rules */
       disable_weakrules(solv, &weakq);
       queue_free(&weakq);
+      arena_release(&solv->arena, mark);
       solver_reset(solv);
       return 0;
     }
   queue_free(&weakq);
+  arena_release(&solv->arena, mark);
 
   if (solv->allowuninstall || solv->allowuninstall_all || solv->allowuninstallmap.size)
     if (solver_autouninstall(solv, oldproblemcount) != 0)
@@ -1061,6 +1483,121 @@ analyze_unsolvable(Solver *solv, Rule *cr, int disablerules)
 }
 
 
+/*-------------------------------------------------------------------
+ *
+ * restart support
+ *
+ * In restart mode we periodically revert all decisions but the
+ * level 1 ones. The decisions are remembered in the savedphasemap
+ * so that selectandinstall() can redo them (phase saving). The
+ * restart intervals follow the luby sequence, and from time to
+ * time the learnt rules with a high glue get deleted.
+ */
+
+/* luby sequence 1 1 2 1 1 2 4 1 1 2 1 1 2 4 8 ... */
+static int
+luby(int x)
+{
+  int size, seq;
+  for (size = 1, seq = 0; size < x + 1; seq++)
+    size = 2 * size + 1;
+  while (size - 1 != x)
+    {
+      size = (size - 1) >> 1;
+      seq--;
+      x = x % size;
+    }
+  return 1 << seq;
+}
+
+static int
+reduce_learntrules_sortcmp(const void *ap, const void *bp, void *dp)
+{
+  const Id *a = ap, *b = bp;
+  if (a[0] != b[0])
+    return b[0] - a[0];		/* highest glue first */
+  return a[1] - b[1];		/* then the oldest rules */
+}
+
+/*
+ * delete half of the learnt rules with a glue > 2. Rules that are
+ * the reason of a current decision are kept. Deleted rules stay
+ * in the rule area (they may be part of a proof), but are disabled
+ * forever and do not get watches.
+ */
+static void
+reduce_learntrules(Solver *solv)
+{
+  Pool *pool = solv->pool;
+  Queue q;
+  Map reasons;
+  Rule *r;
+  int i, n;
+  Id why;
+  Arenamark mark = arena_mark(&solv->arena);
+
+  queue_init(&q);
+  arena_map_init(&solv->arena, &reasons, solv->nrules - solv->learntrules);
+  for (i = 0; i < solv->decisionq_why.count; i++)
+    {
+      why = solv->decisionq_why.elements[i];
+      if (why >= solv->learntrules)
+	MAPSET(&reasons, why - solv->learntrules);
+    }
+  for (i = solv->learntrules, r = solv->rules + i; i < solv->nrules; i++, r++)
+    {
+      if (solv->learnt_lbd.elements[i - solv->learntrules] <= 2)
+	continue;	/* glue rule or already deleted */
+      if (r->d < 0 || !r->w2 || MAPTST(&reasons, i - solv->learntrules))
+	continue;
+      queue_push2(&q, solv->learnt_lbd.elements[i - solv->learntrules], i);
+    }
+  arena_release(&solv->arena, mark);
+  solv_sort(q.elements, q.count / 2, 2 * sizeof(Id), reduce_learntrules_sortcmp, solv);
+  n = q.count / 4;
+  for (i = 0; i < n; i++)
+    {
+      r = solv->rules + q.elements[2 * i + 1];
+      solv->learnt_lbd.elements[q.elements[2 * i + 1] - solv->learntrules] = 0;
+      solver_disablerule(solv, r);
+    }
+  queue_free(&q);
+  solv->stats_deletedlearnt += n;
+  POOL_DEBUG(SOLV_DEBUG_STATS, "deleted %d of %d learnt rules\n", n, solv->nrules - solv->learntrules);
+  if (n)
+    makewatches(solv);	/* get rid of the watches of the deleted rules */
+  solv->reduce_interval += REDUCE_INC;
+  solv->reduce_conflicts = solv->stats_conflicts + solv->reduce_interval;
+}
+
+static int
+restart(Solver *solv)
+{
+  Pool *pool = solv->pool;
+  int i;
+  Id v;
+
+  for (i = solv->decisionq.count - 1; i >= 0; i--)
+    {
+      v = solv->decisionq.elements[i];
+      if (solv->decisionmap[v > 0 ? v : -v] == (v > 0 ? 1 : -1))
+	break;		/* reached level 1 */
+      if (v > 0)
+	MAPSET(&solv->savedphasemap, v);
+      else
+	MAPCLR(&solv->savedphasemap, -v);
+    }
+  POOL_DEBUG(SOLV_DEBUG_SOLVER, "restarting after %d conflicts\n", solv->restart_conflicts);
+  revert(solv, 1);
+  solv->stats_restarts++;
+  solv->restart_conflicts = 0;
+  solv->restart_luby++;
+  if (solv->stats_conflicts >= solv->reduce_conflicts)
+    reduce_learntrules(solv);
+  return 1;
+}
+
+
 /*-------------------------------------------------------------------
  *
  * setpropagatelearn
@@ -1093,6 +1630,7 @@ setpropagatelearn(Solver *solv, int level, Id decision, int disablerules, Id rul
       queue_push(&solv->decisionq, decision);
       queue_push(&solv->decisionq_why, -ruleid);	/* <= 0 -> free decision */
       queue_push(&solv->decisionq_reason, reason);
+      solv->stats_phasedecisions[solv->stats_phase]++;
     }
   assert(ruleid >= 0 && level > 0);
   for (;;)
@@ -1104,6 +1642,15 @@ setpropagatelearn(Solver *solv, int level, Id decision, int disablerules, Id rul
 	return analyze_unsolvable(solv, r, disablerules);
       POOL_DEBUG(SOLV_DEBUG_ANALYZE, "conflict with rule #%d\n", (int)(r - solv->rules));
       level = analyze(solv, level, r, &lr);
+      solv->stats_conflicts++;
+      solv->stats_phaseconflicts[solv->stats_phase]++;
+      if (solv->restarts && level > 1 && ++solv->restart_conflicts >= RESTART_LUBY_UNIT * luby(solv->restart_luby))
+	{
+	  /* forget the assertion of the learnt rule, it will get
+	   * unit again when we redo the decisions */
+	  level = restart(solv);
+	  continue;
+	}
       /* the new rule is unit by design */
       decision = lr->p;
       solv->decisionmap[decision > 0 ? decision : -decision] = decision > 0 ? level : -level;
@@ -1136,19 +1683,19 @@ queue_prunezeros(Queue *q)
 }
 
 static int
-replaces_installed_package(Pool *pool, Id p, Map *noupdate)
+replaces_installed_package(Pool *pool, Id p, Sparsemap *noupdate)
 {
   Repo *installed = pool->installed;
   Solvable *s = pool->solvables + p, *s2;
   Id p2, pp2;
   Id obs, *obsp;
 
-  if (s->repo == installed && !(noupdate && MAPTST(noupdate, p - installed->start)))
+  if (s->repo == installed && !(noupdate && SPARSEMAPTST(noupdate, p - installed->start)))
     return 1;
   FOR_PROVIDES(p2, pp2, s->name)
     {
       s2 = pool->solvables + p2;
-      if (s2->name != s->name || s2->repo != installed || (noupdate && MAPTST(noupdate, p2 - installed->start)))
+      if (s2->name != s->name || s2->repo != installed || (noupdate && SPARSEMAPTST(noupdate, p2 - installed->start)))
 	continue;
       if (pool->implicitobsoleteusescolors && !pool_colormatch(pool, s, s2))
 	continue;
@@ -1162,7 +1709,7 @@ replaces_installed_package(Pool *pool, Id p, Map *noupdate)
       FOR_PROVIDES(p2, pp2, obs)
 	{
 	  s2 = pool->solvables + p2;
-	  if (s2->repo != installed || (noupdate && MAPTST(noupdate, p2 - installed->start)))
+	  if (s2->repo != installed || (noupdate && SPARSEMAPTST(noupdate, p2 - installed->start)))
 	    continue;
 	  if (!pool->obsoleteusesprovides && !pool_match_nevr(pool, s2, obs))
 	    continue;
@@ -1203,7 +1750,7 @@ reorder_dq_for_future_installed(Solver *solv, int level, Queue *dq)
   /* reorder so that "future-supplemented" packages come first */
   FOR_REPO_SOLVABLES(solv->installed, p, s)
     {
-      if (MAPTST(&solv->noupdate, p - solv->installed->start))
+      if (SPARSEMAPTST(&solv->noupdate, p - solv->installed->start))
 	continue;
       if (solv->decisionmap[p] == 0)
 	{
@@ -1219,7 +1766,7 @@ reorder_dq_for_future_installed(Solver *solv, int level, Queue *dq)
   for (i = 0; i < dqcount; i++)
     {
       p = dq->elements[i];
-      if (!(pool->solvables[p].repo == solv->installed || MAPTST(&solv->suggestsmap, p) || solver_is_enhancing(solv, pool->solvables + p)))
+      if (!(pool->solvables[p].repo == solv->installed || SPARSEMAPTST(&solv->suggestsmap, p) || solver_is_enhancing(solv, pool->solvables + p)))
         {
 	  queue_push(dq, p);
 	  dq->elements[i] = 0;
@@ -1229,7 +1776,7 @@ reorder_dq_for_future_installed(Solver *solv, int level, Queue *dq)
   for (i = 0; i < dqcount; i++)
     {
       p = dq->elements[i];
-      if (p && !(pool->solvables[p].repo == solv->installed || MAPTST(&solv->recommendsmap, p) || solver_is_supplementing(solv, pool->solvables + p)))
+      if (p && !(pool->solvables[p].repo == solv->installed || SPARSEMAPTST(&solv->recommendsmap, p) || solver_is_supplementing(solv, pool->solvables + p)))
         {
 	  queue_push(dq, p);
 	  dq->elements[i] = 0;
@@ -1379,6 +1926,20 @@ selectandinstall(Solver *solv, int level, Queue *dq, int disablerules, Id ruleid
   /* check if the candidates are all connected via yumobs rules */
   if (dq->count > 1 && solv->yumobsrules_end > solv->yumobsrules)
     prune_yumobs(solv, dq, ruleid);
+  /* phase saving: redo the decision we made before the last restart */
+  if (dq->count > 1 && solv->savedphasemap.size)
+    {
+      int i;
+      for (i = 0; i < dq->count; i++)
+	if (MAPTST(&solv->savedphasemap, dq->elements[i]))
+	  break;
+      if (i > 0 && i < dq->count)
+	{
+	  p = dq->elements[i];
+	  memmove(dq->elements + 1, dq->elements, i * sizeof(Id));
+	  dq->elements[0] = p;
+	}
+    }
   /* if we have multiple candidates we open a branch */
   if (dq->count > 1)
     createbranch(solv, level, dq, 0, ruleid);
@@ -1434,12 +1995,15 @@ solver_create(Pool *pool)
   queue_init(&solv->weakruleq);
   queue_init(&solv->ruleassertions);
   queue_init(&solv->addedmap_deduceq);
+  queue_init(&solv->pkgrules_key);
+  queue_init(&solv->learnt_lbd);
 
   queue_push(&solv->learnt_pool, 0);	/* so that 0 does not describe a proof */
+  arena_init(&solv->arena);
 
-  map_init(&solv->recommendsmap, pool->nsolvables);
-  map_init(&solv->suggestsmap, pool->nsolvables);
-  map_init(&solv->noupdate, solv->installed ? solv->installed->end - solv->installed->start : 0);
+  sparsemap_init(&solv->recommendsmap, pool->nsolvables);
+  sparsemap_init(&solv->suggestsmap, pool->nsolvables);
+  sparsemap_init(&solv->noupdate, solv->installed ? solv->installed->end - solv->installed->start : 0);
   solv->recommends_index = 0;
 
   solv->decisionmap = (Id *)solv_calloc(pool->nsolvables, sizeof(Id));
@@ -1476,6 +2040,16 @@ map_zerosize(Map *m)
     }
 }
 
+static inline void
+sparsemap_zerosize(Sparsemap *m)
+{
+  if (m->size)
+    {
+      sparsemap_free(m);
+      sparsemap_init(m, 0);
+    }
+}
+
 void
 solver_free(Solver *solv)
 {
@@ -1493,6 +2067,8 @@ solver_free(Solver *solv)
   queue_free(&solv->weakruleq);
   queue_free(&solv->ruleassertions);
   queue_free(&solv->addedmap_deduceq);
+  queue_free(&solv->pkgrules_key);
+  queue_free(&solv->learnt_lbd);
   queuep_free(&solv->cleandeps_updatepkgs);
   queuep_free(&solv->cleandeps_mistakes);
   queuep_free(&solv->update_targets);
@@ -1502,27 +2078,29 @@ solver_free(Solver *solv)
   queuep_free(&solv->brokenorphanrules);
   queuep_free(&solv->recommendsruleq);
 
-  map_free(&solv->recommendsmap);
-  map_free(&solv->suggestsmap);
-  map_free(&solv->noupdate);
+  sparsemap_free(&solv->recommendsmap);
+  sparsemap_free(&solv->suggestsmap);
+  sparsemap_free(&solv->noupdate);
   map_free(&solv->weakrulemap);
   map_free(&solv->multiversion);
 
   map_free(&solv->updatemap);
   map_free(&solv->bestupdatemap);
-  map_free(&solv->fixmap);
+  sparsemap_free(&solv->fixmap);
   map_free(&solv->dupmap);
   map_free(&solv->dupinvolvedmap);
-  map_free(&solv->droporphanedmap);
+  sparsemap_free(&solv->droporphanedmap);
   map_free(&solv->cleandepsmap);
-  map_free(&solv->allowuninstallmap);
-  map_free(&solv->excludefromweakmap);
-
+  sparsemap_free(&solv->allowuninstallmap);
+  sparsemap_free(&solv->excludefromweakmap);
+  map_free(&solv->savedphasemap);
+  arena_free(&solv->arena);
 
   solv_free(solv->favormap);
   solv_free(solv->decisionmap);
   solv_free(solv->rules);
   solv_free(solv->watches);
+  freewatchvecs(solv);
   solv_free(solv->obsoletes);
   solv_free(solv->obsoletes_data);
   solv_free(solv->specialupdaters);
@@ -1531,6 +2109,7 @@ solver_free(Solver *solv)
   solv_free(solv->yumobsrules_info);
   solv_free(solv->recommendsrules_info);
   solv_free(solv->instbuddy);
+  freepkgwatches(solv);
   solv_free(solv);
 }
 
@@ -1597,6 +2176,14 @@ solver_get_flag(Solver *solv, int flag)
     return solv->only_namespace_recommended;
   case SOLVER_FLAG_STRICT_REPO_PRIORITY:
     return solv->strict_repo_priority;
+  case SOLVER_FLAG_WATCH_VECTORS:
+    return solv->watchvectors;
+  case SOLVER_FLAG_RESTARTS:
+    return solv->restarts;
+  case SOLVER_FLAG_INCREMENTAL:
+    return solv->incremental;
+  case SOLVER_FLAG_PARALLEL_PKGRULES:
+    return solv->parallel_pkgrules;
   default:
     break;
   }
@@ -1696,12 +2283,53 @@ solver_set_flag(Solver *solv, int flag, int value)
   case SOLVER_FLAG_STRICT_REPO_PRIORITY:
     solv->strict_repo_priority = value;
     break;
+  case SOLVER_FLAG_WATCH_VECTORS:
+    solv->watchvectors = value;
+    break;
+  case SOLVER_FLAG_RESTARTS:
+    solv->restarts = value;
+    break;
+  case SOLVER_FLAG_INCREMENTAL:
+    solv->incremental = value;
+    break;
+  case SOLVER_FLAG_PARALLEL_PKGRULES:
+    solv->parallel_pkgrules = value;
+    break;
   default:
     break;
   }
   return old;
 }
 
+int
+solver_get_stat(Solver *solv, int stat)
+{
+  switch (stat)
+  {
+  case SOLVER_STAT_LEARNED:
+    return solv->stats_learned;
+  case SOLVER_STAT_UNSOLVABLE:
+    return solv->stats_unsolvable;
+  case SOLVER_STAT_PROPAGATIONS:
+    return solv->stats_propagations;
+  case SOLVER_STAT_WATCHVISITS:
+    return solv->stats_watchvisits;
+  case SOLVER_STAT_CONFLICTS:
+    return solv->stats_conflicts;
+  case SOLVER_STAT_RESTARTS:
+    return solv->stats_restarts;
+  case SOLVER_STAT_DELETEDLEARNT:
+    return solv->stats_deletedlearnt;
+  case SOLVER_STAT_ALLOCATIONS:
+    return solv->stats_allocations;
+  case SOLVER_STAT_ARENASIZE:
+    return (int)solv->arena.maxused;
+  default:
+    break;
+  }
+  return -1;
+}
+
 static int
 resolve_jobrules(Solver *solv, int level, int disablerules, Queue *dq)
 {
@@ -1890,7 +2518,7 @@ resolve_installed(Solver *solv, int level, int disablerules, Queue *dq)
 	  /* check if we should update this package to the latest version
 	   * noupdate is set for erase jobs, in that case we want to deinstall
 	   * the installed package and not replace it with a newer version */
-	  if (!MAPTST(&solv->noupdate, i - installed->start) && (solv->decisionmap[i] < 0 || solv->updatemap_all || (solv->updatemap.size && MAPTST(&solv->updatemap, i - installed->start))))
+	  if (!SPARSEMAPTST(&solv->noupdate, i - installed->start) && (solv->decisionmap[i] < 0 || solv->updatemap_all || (solv->updatemap.size && MAPTST(&solv->updatemap, i - installed->start))))
 	    {
 	      if (pass == 1)
 		{
@@ -2279,7 +2907,7 @@ add_complex_recommends(Solver *solv, Id rec, Queue *dq, Map *dqmap)
 	    }
 	  else
 	    {
-	      if (solv->process_orphans && solv->installed && pool->solvables[p].repo == solv->installed && (solv->droporphanedmap_all || (solv->droporphanedmap.size && MAPTST(&solv->droporphanedmap, p - solv->installed->start))))
+	      if (solv->process_orphans && solv->installed && pool->solvables[p].repo == solv->installed && (solv->droporphanedmap_all || (solv->droporphanedmap.size && SPARSEMAPTST(&solv->droporphanedmap, p - solv->installed->start))))
 		continue;
 	    }
 	  queue_push(dq, p);
@@ -2314,7 +2942,7 @@ add_complex_recommends(Solver *solv, Id rec, Queue *dq, Map *dqmap)
 }
 
 static void
-do_complex_recommendations(Solver *solv, Id rec, Map *m, int noselected)
+do_complex_recommendations(Solver *solv, Id rec, Sparsemap *m, int noselected)
 {
   Pool *pool = solv->pool;
   Queue dq;
@@ -2346,10 +2974,10 @@ do_complex_recommendations(Solver *solv, Id rec, Map *m, int noselected)
 	    {
 	      if (noselected)
 		break;
-	      MAPSET(m, p);
+	      SPARSEMAPSET(m, p);
 	      for (i++; (p = dq.elements[i]) != 0; i++)
 		if (p > 0 && solv->decisionmap[p] > 0)
-		  MAPSET(m, p);
+		  SPARSEMAPSET(m, p);
 	      p = 1;
 	      break;
 	    }
@@ -2358,7 +2986,7 @@ do_complex_recommendations(Solver *solv, Id rec, Map *m, int noselected)
 	{
 	  for (i = blk; (p = dq.elements[i]) != 0; i++)
 	    if (p > 0)
-	      MAPSET(m, p);
+	      SPARSEMAPSET(m, p);
 	}
       while (dq.elements[i])
 	i++;
@@ -2389,7 +3017,7 @@ prune_exclude_from_weak(Solver *solv, Queue *plist)
   for (i = j = 0; i < plist->count; i++)
     {
       Id p = plist->elements[i];
-      if (!MAPTST(&solv->excludefromweakmap, p))
+      if (!SPARSEMAPTST(&solv->excludefromweakmap, p))
         plist->elements[j++] = p;
     }
   if (i != j)
@@ -2404,6 +3032,7 @@ resolve_weak(Solver *solv, int level, int disablerules, Queue *dq, Queue *dqs, i
   int olevel;
   Solvable *s;
   Map dqmap;
+  Arenamark mark;
   int decisioncount;
   Id p;
 
@@ -2448,7 +3077,7 @@ resolve_weak(Solver *solv, int level, int disablerules, Queue *dq, Queue *dqs, i
 			}
 		      else if (solv->decisionmap[p] == 0)
 			{
-			  if (solv->process_orphans && solv->installed && pool->solvables[p].repo == solv->installed && (solv->droporphanedmap_all || (solv->droporphanedmap.size && MAPTST(&solv->droporphanedmap, p - solv->installed->start))))
+			  if (solv->process_orphans && solv->installed && pool->solvables[p].repo == solv->installed && (solv->droporphanedmap_all || (solv->droporphanedmap.size && SPARSEMAPTST(&solv->droporphanedmap, p - solv->installed->start))))
 			    continue;
 			  queue_pushunique(dq, p);
 			}
@@ -2465,11 +3094,11 @@ resolve_weak(Solver *solv, int level, int disablerules, Queue *dq, Queue *dqs, i
 	    continue;
 	  if (!solver_is_supplementing(solv, s))
 	    continue;
-	  if (solv->process_orphans && solv->installed && s->repo == solv->installed && (solv->droporphanedmap_all || (solv->droporphanedmap.size && MAPTST(&solv->droporphanedmap, i - solv->installed->start))))
+	  if (solv->process_orphans && solv->installed && s->repo == solv->installed && (solv->droporphanedmap_all || (solv->droporphanedmap.size && SPARSEMAPTST(&solv->droporphanedmap, i - solv->installed->start))))
 	    continue;
 	  if (solv->havedisfavored && solv->favormap[i] < 0)
 	    continue;	/* disfavored supplements, do not install */
-	  if (solv->excludefromweakmap.size && MAPTST(&solv->excludefromweakmap, i))
+	  if (solv->excludefromweakmap.size && SPARSEMAPTST(&solv->excludefromweakmap, i))
 	    continue;   /* excluded for weak deps, do not install */
 	  queue_push(dqs, i);
 	}
@@ -2489,8 +3118,9 @@ resolve_weak(Solver *solv, int level, int disablerules, Queue *dq, Queue *dqs, i
     {
       Map obsmap;
       Id obs, *obsp, po, ppo;
+      Arenamark mark = arena_mark(&solv->arena);
 
-      map_init(&obsmap, pool->nsolvables);
+      arena_map_init(&solv->arena, &obsmap, pool->nsolvables);
       for (p = solv->installed->start; p < solv->installed->end; p++)
 	{
 	  s = pool->solvables + p;
@@ -2521,7 +3151,7 @@ resolve_weak(Solver *solv, int level, int disablerules, Queue *dq, Queue *dqs, i
 	if (!MAPTST(&obsmap, dq->elements[i]))
 	  dq->elements[j++] = dq->elements[i];
       dq->count = j;
-      map_free(&obsmap);
+      arena_release(&solv->arena, mark);
     }
 
   /* filter out all already supplemented packages if requested */
@@ -2607,7 +3237,8 @@ resolve_weak(Solver *solv, int level, int disablerules, Queue *dq, Queue *dqs, i
   policy_filter_unwanted(solv, dq, POLICY_MODE_RECOMMEND);
 
   /* create map of result */
-  map_init(&dqmap, pool->nsolvables);
+  mark = arena_mark(&solv->arena);
+  arena_map_init(&solv->arena, &dqmap, pool->nsolvables);
   for (i = 0; i < dq->count; i++)
     MAPSET(&dqmap, dq->elements[i]);
 
@@ -2637,7 +3268,7 @@ resolve_weak(Solver *solv, int level, int disablerules, Queue *dq, Queue *dqs, i
     }
   if (i < dqs->count || solv->decisionq.count < decisioncount)
     {
-      map_free(&dqmap);
+      arena_release(&solv->arena, mark);
       return level;
     }
 
@@ -2691,7 +3322,7 @@ resolve_weak(Solver *solv, int level, int disablerules, Queue *dq, Queue *dqs, i
       if (rec)
 	break;	/* had a problem above, quit loop */
     }
-  map_free(&dqmap);
+  arena_release(&solv->arena, mark);
   return level;
 }
 
@@ -2743,7 +3374,7 @@ resolve_orphaned(Solver *solv, int level, int disablerules, Queue *dq, int *reru
 	continue;	/* already decided */
       if (solv->droporphanedmap_all)
 	continue;
-      if (solv->droporphanedmap.size && MAPTST(&solv->droporphanedmap, p - solv->installed->start))
+      if (solv->droporphanedmap.size && SPARSEMAPTST(&solv->droporphanedmap, p - solv->installed->start))
 	continue;
       POOL_DEBUG(SOLV_DEBUG_SOLVER, "keeping orphaned %s\n", pool_solvid2str(pool, p));
       olevel = level;
@@ -2830,6 +3461,16 @@ solver_check_unneeded_choicerules(Solver *solv)
   return havedisabled;
 }
 
+/* switch to a new solver phase for the statistics */
+static inline void
+stats_setphase(Solver *solv, int phase)
+{
+  unsigned int now = solv_timems(0);
+  solv->stats_phasetime[solv->stats_phase] += now - solv->stats_phasestart;
+  solv->stats_phasestart = now;
+  solv->stats_phase = phase;
+}
+
 /*-------------------------------------------------------------------
  *
  * solver_run_sat
@@ -2868,6 +3509,8 @@ solver_run_sat(Solver *solv, int disablerules, int doweak)
   queue_init(&dqs);
   solv->installedpos = 0;
   solv->do_extra_reordering = 0;
+  solv->stats_phase = PHASE_ASSERTIONS;
+  solv->stats_phasestart = solv_timems(0);
 
   /*
    * here's the main loop:
@@ -2891,6 +3534,7 @@ solver_run_sat(Solver *solv, int disablerules, int doweak)
 	{
 	  if (level < 0)
 	    break;
+	  stats_setphase(solv, PHASE_ASSERTIONS);
 	  level = makeruledecisions(solv, disablerules);
 	  if (level < 0)
 	    break;
@@ -2910,6 +3554,7 @@ solver_run_sat(Solver *solv, int disablerules, int doweak)
 	{
 	  if (solv->installed && solv->installed->nsolvables && !solv->installed->disabled)
 	    solv->do_extra_reordering = 1;
+	  stats_setphase(solv, PHASE_JOBS);
 	  olevel = level;
 	  level = resolve_jobrules(solv, level, disablerules, &dq);
 	  solv->do_extra_reordering = 0;
@@ -2921,6 +3566,7 @@ solver_run_sat(Solver *solv, int disablerules, int doweak)
       /* resolve job dependencies in the focus_new/best case */
       if (level < systemlevel && (solv->focus_new || solv->focus_best) && !solv->focus_installed && solv->installed && solv->installed->nsolvables && !solv->installed->disabled)
 	{
+	  stats_setphase(solv, PHASE_DEPENDENCIES);
 	  solv->do_extra_reordering = 1;
 	  olevel = level;
 	  level = resolve_dependencies(solv, level, disablerules, &dq);
@@ -2935,6 +3581,7 @@ solver_run_sat(Solver *solv, int disablerules, int doweak)
        */
       if (level < systemlevel && solv->installed && solv->installed->nsolvables && !solv->installed->disabled)
 	{
+	  stats_setphase(solv, PHASE_INSTALLED);
 	  olevel = level;
 	  level = resolve_installed(solv, level, disablerules, &dq);
 	  if (level < olevel)
@@ -2945,6 +3592,7 @@ solver_run_sat(Solver *solv, int disablerules, int doweak)
      /* resolve jobs in focus_installed case */
      if (level < systemlevel && solv->focus_installed)
 	{
+	  stats_setphase(solv, PHASE_JOBS);
 	  olevel = level;
 	  level = resolve_jobrules(solv, level, disablerules, &dq);
 	  if (level < olevel)
@@ -2956,6 +3604,7 @@ solver_run_sat(Solver *solv, int disablerules, int doweak)
         systemlevel = level;
 
       /* resolve all dependencies */
+      stats_setphase(solv, PHASE_DEPENDENCIES);
       olevel = level;
       level = resolve_dependencies(solv, level, disablerules, &dq);
       if (level < olevel)
@@ -2965,6 +3614,7 @@ solver_run_sat(Solver *solv, int disablerules, int doweak)
       if (solv->cleandepsmap.size && solv->installed)
 	{
 	  int rerun = 0;
+	  stats_setphase(solv, PHASE_CLEANDEPS);
 	  level = resolve_cleandeps(solv, level, disablerules, &rerun);
 	  if (rerun)
 	    continue;
@@ -2975,6 +3625,7 @@ solver_run_sat(Solver *solv, int disablerules, int doweak)
       if (doweak)
 	{
 	  int rerun = 0;
+	  stats_setphase(solv, PHASE_WEAK);
 	  level = resolve_weak(solv, level, disablerules, &dq, &dqs, &rerun);
 	  if (rerun)
 	    continue;
@@ -2983,12 +3634,14 @@ solver_run_sat(Solver *solv, int disablerules, int doweak)
       if (solv->installed && (solv->orphaned.count || solv->brokenorphanrules))
 	{
 	  int rerun = 0;
+	  stats_setphase(solv, PHASE_ORPHANED);
 	  level = resolve_orphaned(solv, level, disablerules, &dq, &rerun);
 	  if (rerun)
 	    continue;
 	}
 
      /* one final pass to make sure we decided all installed packages */
+      stats_setphase(solv, PHASE_MINIMIZE);
       if (solv->installed)
 	{
 	  for (p = solv->installed->start; p < solv->installed->end; p++)
@@ -3080,7 +3733,7 @@ solver_run_sat(Solver *solv, int disablerules, int doweak)
 		    }
 		  if (solv->havedisfavored && solv->favormap[p] < 0)
 		    continue;
-		  if (lastsi < 0 && (MAPTST(&solv->recommendsmap, p) || solver_is_supplementing(solv, pool->solvables + p)))
+		  if (lastsi < 0 && (SPARSEMAPTST(&solv->recommendsmap, p) || solver_is_supplementing(solv, pool->solvables + p)))
 		    lastsi = i;
 		}
 	      if (lastsi >= 0)
@@ -3096,7 +3749,7 @@ solver_run_sat(Solver *solv, int disablerules, int doweak)
 		        continue;	/* current selection is more favored */
 		      if (replaces_installed_package(pool, p, &solv->noupdate))
 		        continue;	/* current selection replaces an installed package */
-		      if (!(MAPTST(&solv->recommendsmap, p) || solver_is_supplementing(solv, pool->solvables + p)))
+		      if (!(SPARSEMAPTST(&solv->recommendsmap, p) || solver_is_supplementing(solv, pool->solvables + p)))
 			{
 			  lasti = lastsi;
 			  lastiend = endi;
@@ -3118,7 +3771,16 @@ solver_run_sat(Solver *solv, int disablerules, int doweak)
     }
   assert(level == -1 || level + 1 == solv->decisionq_reason.count);
 
+  stats_setphase(solv, PHASE_ASSERTIONS);	/* account the time of the last phase */
   POOL_DEBUG(SOLV_DEBUG_STATS, "solver statistics: %d learned rules, %d unsolvable, %d minimization steps\n", solv->stats_learned, solv->stats_unsolvable, minimizationsteps);
+  if (solv->restarts)
+    POOL_DEBUG(SOLV_DEBUG_STATS, "restart statistics: %d conflicts, %d restarts, %d deleted learnt rules\n", solv->stats_conflicts, solv->stats_restarts, solv->stats_deletedlearnt);
+  IF_POOLDEBUG (SOLV_DEBUG_STATS)
+    {
+      for (i = 0; i < SOLVER_STATS_NPHASES; i++)
+	if (solv->stats_phasedecisions[i] || solv->stats_phaseconflicts[i] || solv->stats_phasetime[i])
+	  POOL_DEBUG(SOLV_DEBUG_STATS, "  phase %-12s: %d decisions, %d conflicts, %u ms\n", phase2str[i], solv->stats_phasedecisions[i], solv->stats_phaseconflicts[i], solv->stats_phasetime[i]);
+    }
 
   POOL_DEBUG(SOLV_DEBUG_STATS, "done solving.\n\n");
   queue_free(&dq);
@@ -3537,6 +4199,61 @@ deduceq2addedmap(Solver *solv, Map *addedmap)
     }
 }
 
+/* the pkg rules depend on the pool and on some solver settings. Collect
+ * all of them so that we can check if the rules can be reused. */
+static void
+pkgrules_makekey(Solver *solv, Queue *q)
+{
+  Pool *pool = solv->pool;
+  Repo *installed = solv->installed;
+  Id p;
+
+  queue_empty(q);
+  queue_push2(q, (Id)pool->generation, pool->nsolvables);
+  queue_push2(q, solv->fixmap_all, solv->keepexplicitobsoletes);
+  queue_push2(q, solv->strongrecommends, solv->noupdateprovide);
+  queue_push(q, solv->needupdateprovide);
+  if (installed && solv->fixmap.size)
+    for (p = installed->start; p < installed->end; p++)
+      if (SPARSEMAPTST(&solv->fixmap, p - installed->start))
+	queue_push(q, p);
+  queue_push(q, 0);
+  if (solv->multiversion.size)
+    for (p = 2; p < pool->nsolvables; p++)
+      if (MAPTST(&solv->multiversion, p))
+	queue_push(q, p);
+  queue_push(q, 0);
+  if (pool->considered)
+    for (p = 2; p < pool->nsolvables; p++)
+      if (!MAPTST(pool->considered, p))
+	queue_push(q, p);
+}
+
+static int
+pkgrules_uptodate(Solver *solv)
+{
+  Queue q;
+  int r;
+
+  queue_init(&q);
+  pkgrules_makekey(solv, &q);
+  r = q.count == solv->pkgrules_key.count && !memcmp(q.elements, solv->pkgrules_key.elements, q.count * sizeof(Id));
+  queue_free(&q);
+  return r;
+}
+
+static void
+freepkgrules(Solver *solv)
+{
+  solver_shrinkrules(solv, 1);
+  solv->pkgrules_end = 0;
+  queue_empty(&solv->addedmap_deduceq);
+  queue_empty(&solv->pkgrules_key);
+  queuep_free(&solv->recommendsruleq);
+  solv->instbuddy = solv_free(solv->instbuddy);
+  freepkgwatches(solv);
+}
+
 #ifdef ENABLE_COMPLEX_DEPS
 static int
 add_complex_jobrules(Solver *solv, Id dep, int flags, int jobidx, int weak)
@@ -3584,7 +4301,7 @@ for (i = 0; i < job->count; i += 2)
     if ((how & SOLVER_JOBMASK) != SOLVER_EXCLUDEFROMWEAK)
 	continue;
     if (!solv->excludefromweakmap.size)
-	map_grow(&solv->excludefromweakmap, pool->nsolvables);
+	sparsemap_grow(&solv->excludefromweakmap, pool->nsolvables);
     what = job->elements[i + 1];
     select = how & SOLVER_SELECTMASK;
     if (select == SOLVER_SOLVABLE_REPO)
@@ -3594,11 +4311,11 @@ for (i = 0; i < job->count; i += 2)
 	    {
 	      Solvable *s;
 	      FOR_REPO_SOLVABLES(repo, p, s)
-		MAPSET(&solv->excludefromweakmap, p);
+		SPARSEMAPSET(&solv->excludefromweakmap, p);
 	    }
 	}
       FOR_JOB_SELECT(p, pp, select, what)
-	MAPSET(&solv->excludefromweakmap, p);
+	SPARSEMAPSET(&solv->excludefromweakmap, p);
     }
 }
 
@@ -3669,9 +4386,17 @@ solver_solve(Solver *solv, Queue *job)
   int haslockjob = 0;
   int hasblacklistjob = 0;
   int hasexcludefromweakjob = 0;
+  unsigned long nallocs = solv_allocstats();
 
   solve_start = solv_timems(0);
 
+  /* reset the phase statistics. they cover all solver_run_sat calls of
+   * this solver_solve, including the reruns for the problem solutions */
+  memset(solv->stats_phasedecisions, 0, sizeof(solv->stats_phasedecisions));
+  memset(solv->stats_phaseconflicts, 0, sizeof(solv->stats_phaseconflicts));
+  memset(solv->stats_phasetime, 0, sizeof(solv->stats_phasetime));
+  solv->stats_phase = PHASE_ASSERTIONS;
+
   /* log solver options */
   POOL_DEBUG(SOLV_DEBUG_STATS, "solver started\n");
   POOL_DEBUG(SOLV_DEBUG_STATS, "dosplitprovides=%d, noupdateprovide=%d, noinfarchcheck=%d\n", solv->dosplitprovides, solv->noupdateprovide, solv->noinfarchcheck);
@@ -3705,28 +4430,29 @@ solver_solve(Solver *solv, Queue *job)
   solv->recommendsrules_info = solv_free(solv->recommendsrules_info);
   solv->choicerules_info = solv_free(solv->choicerules_info);
   if (solv->noupdate.size)
-    map_empty(&solv->noupdate);
+    sparsemap_empty(&solv->noupdate);
   map_zerosize(&solv->multiversion);
   solv->updatemap_all = 0;
   map_zerosize(&solv->updatemap);
   solv->bestupdatemap_all = 0;
   map_zerosize(&solv->bestupdatemap);
   solv->fixmap_all = 0;
-  map_zerosize(&solv->fixmap);
+  sparsemap_zerosize(&solv->fixmap);
   solv->dupinvolvedmap_all = 0;
   map_zerosize(&solv->dupmap);
   map_zerosize(&solv->dupinvolvedmap);
   solv->process_orphans = 0;
   solv->droporphanedmap_all = 0;
-  map_zerosize(&solv->droporphanedmap);
+  sparsemap_zerosize(&solv->droporphanedmap);
   solv->allowuninstall_all = 0;
-  map_zerosize(&solv->allowuninstallmap);
-  map_zerosize(&solv->excludefromweakmap);
+  sparsemap_zerosize(&solv->allowuninstallmap);
+  sparsemap_zerosize(&solv->excludefromweakmap);
   map_zerosize(&solv->cleandepsmap);
   map_zerosize(&solv->weakrulemap);
   solv->favormap = solv_free(solv->favormap);
   queue_empty(&solv->weakruleq);
   solv->watches = solv_free(solv->watches);
+  freewatchvecs(solv);
   queue_empty(&solv->ruletojob);
   if (solv->decisionq.count)
     memset(solv->decisionmap, 0, pool->nsolvables * sizeof(Id));
@@ -3741,10 +4467,23 @@ solver_solve(Solver *solv, Queue *job)
   queue_empty(&solv->solutions);
   queue_empty(&solv->orphaned);
   solv->stats_learned = solv->stats_unsolvable = 0;
+  solv->stats_propagations = solv->stats_watchvisits = 0;
+  solv->stats_conflicts = solv->stats_restarts = solv->stats_deletedlearnt = 0;
+  arena_reset(&solv->arena);
+  solv->arena.maxused = 0;
+  queue_empty(&solv->learnt_lbd);
+  solv->restart_conflicts = solv->restart_luby = 0;
+  solv->reduce_interval = solv->reduce_conflicts = REDUCE_FIRST;
+  if (!solv->restarts)
+    map_zerosize(&solv->savedphasemap);
+  else if (solv->savedphasemap.size)
+    map_empty(&solv->savedphasemap);
+  else
+    map_init(&solv->savedphasemap, pool->nsolvables);
   if (solv->recommends_index)
     {
-      map_empty(&solv->recommendsmap);
-      map_empty(&solv->suggestsmap);
+      sparsemap_empty(&solv->recommendsmap);
+      sparsemap_empty(&solv->suggestsmap);
       queuep_free(&solv->recommendscplxq);
       queuep_free(&solv->suggestscplxq);
       solv->recommends_index = 0;
@@ -3773,14 +4512,6 @@ solver_solve(Solver *solv, Queue *job)
    * so called: pkg rules
    *
    */
-  initialnrules = solv->pkgrules_end ? solv->pkgrules_end : 1;
-  if (initialnrules > 1)
-    deduceq2addedmap(solv, &addedmap);		/* also enables all pkg rules */
-  if (solv->nrules != initialnrules)
-    solver_shrinkrules(solv, initialnrules);	/* shrink to just pkg rules */
-  solv->lastpkgrule = 0;
-  solv->pkgrules_end = 0;
-
   if (installed)
     {
       /* check for update/verify jobs as they need to be known early */
@@ -3801,8 +4532,8 @@ solver_solve(Solver *solv, Queue *job)
 		  if (s->repo != installed)
 		    continue;
 		  if (!solv->fixmap.size)
-		    map_grow(&solv->fixmap, installed->end - installed->start);
-		  MAPSET(&solv->fixmap, p - installed->start);
+		    sparsemap_grow(&solv->fixmap, installed->end - installed->start);
+		  SPARSEMAPSET(&solv->fixmap, p - installed->start);
 		}
 	      break;
 	    case SOLVER_UPDATE:
@@ -3879,8 +4610,8 @@ solver_solve(Solver *solv, Queue *job)
 		  if (s->repo != installed)
 		    continue;
 		  if (!solv->droporphanedmap.size)
-		    map_grow(&solv->droporphanedmap, installed->end - installed->start);
-		  MAPSET(&solv->droporphanedmap, p - installed->start);
+		    sparsemap_grow(&solv->droporphanedmap, installed->end - installed->start);
+		  SPARSEMAPSET(&solv->droporphanedmap, p - installed->start);
 		}
 	      break;
 	    case SOLVER_ALLOWUNINSTALL:
@@ -3892,8 +4623,8 @@ solver_solve(Solver *solv, Queue *job)
 		  if (s->repo != installed)
 		    continue;
 		  if (!solv->allowuninstallmap.size)
-		    map_grow(&solv->allowuninstallmap, installed->end - installed->start);
-		  MAPSET(&solv->allowuninstallmap, p - installed->start);
+		    sparsemap_grow(&solv->allowuninstallmap, installed->end - installed->start);
+		  SPARSEMAPSET(&solv->allowuninstallmap, p - installed->start);
 		}
 	      break;
 	    default:
@@ -3903,14 +4634,51 @@ solver_solve(Solver *solv, Queue *job)
 
       if (solv->update_targets)
 	transform_update_targets(solv);
+    }
+
+  /* incremental mode: check if the pkg rules of the last run are still valid */
+  if (solv->incremental && solv->pkgrules_end && !pkgrules_uptodate(solv))
+    {
+      POOL_DEBUG(SOLV_DEBUG_STATS, "pkg rules are stale, recreating them\n");
+      freepkgrules(solv);
+    }
+  initialnrules = solv->pkgrules_end ? solv->pkgrules_end : 1;
+  if (initialnrules > 1)
+    deduceq2addedmap(solv, &addedmap);		/* also enables all pkg rules */
+  if (solv->nrules != initialnrules)
+    solver_shrinkrules(solv, initialnrules);	/* shrink to just pkg rules */
+  if (initialnrules > 1 && solv->pkgrules_saved)
+    memcpy(solv->rules + 1, solv->pkgrules_saved, (initialnrules - 1) * sizeof(Rule));	/* restore pkg watches */
+  solv->lastpkgrule = 0;
+  solv->pkgrules_end = 0;
 
+  if (installed)
+    {
       oldnrules = solv->nrules;
+      queue_empty(&q);
       FOR_REPO_SOLVABLES(installed, p, s)
-	solver_addpkgrulesforsolvable(solv, s, &addedmap);
+	queue_push(&q, p);
+      solver_addpkgrulesforsolvables(solv, &q, &addedmap);
       POOL_DEBUG(SOLV_DEBUG_STATS, "added %d pkg rules for installed solvables\n", solv->nrules - oldnrules);
       oldnrules = solv->nrules;
-      FOR_REPO_SOLVABLES(installed, p, s)
-	solver_addpkgrulesforupdaters(solv, s, &addedmap, 1);
+      if (solv->parallel_pkgrules)
+	{
+	  /* same as solver_addpkgrulesforupdaters, but in one batch */
+	  Queue qs;
+	  queue_init(&qs);
+	  queue_empty(&q);
+	  FOR_REPO_SOLVABLES(installed, p, s)
+	    {
+	      queue_push(&q, p);
+	      policy_findupdatepackages(solv, s, &qs, 1);
+	      queue_insertn(&q, q.count, qs.count, qs.elements);
+	    }
+	  queue_free(&qs);
+	  solver_addpkgrulesforsolvables(solv, &q, &addedmap);
+	}
+      else
+	FOR_REPO_SOLVABLES(installed, p, s)
+	  solver_addpkgrulesforupdaters(solv, s, &addedmap, 1);
       POOL_DEBUG(SOLV_DEBUG_STATS, "added %d pkg rules for updaters of installed solvables\n", solv->nrules - oldnrules);
     }
 
@@ -3920,6 +4688,7 @@ solver_solve(Solver *solv, Queue *job)
    */
 
   oldnrules = solv->nrules;
+  queue_empty(&q);
   for (i = 0; i < job->count; i += 2)
     {
       how = job->elements[i];
@@ -3932,7 +4701,7 @@ solver_solve(Solver *solv, Queue *job)
 	  FOR_JOB_SELECT(p, pp, select, what)
 	    {
 	      MAPSET(&installcandidatemap, p);
-	      solver_addpkgrulesforsolvable(solv, pool->solvables + p, &addedmap);
+	      queue_push(&q, p);
 	    }
 	  break;
 	case SOLVER_DISTUPGRADE:
@@ -3944,21 +4713,29 @@ solver_solve(Solver *solv, Queue *job)
 	  break;
 	}
     }
+  solver_addpkgrulesforsolvables(solv, &q, &addedmap);
   POOL_DEBUG(SOLV_DEBUG_STATS, "added %d pkg rules for packages involved in a job\n", solv->nrules - oldnrules);
 
 
   /*
    * add rules for suggests, enhances
+   * in incremental mode we can skip this if no new solvables were
+   * added, as the last run already did it for the same set
    */
-  oldnrules = solv->nrules;
-  solver_addpkgrulesforweak(solv, &addedmap);
-  POOL_DEBUG(SOLV_DEBUG_STATS, "added %d pkg rules because of weak dependencies\n", solv->nrules - oldnrules);
+  if (solv->incremental && initialnrules > 1 && solv->nrules == initialnrules)
+    POOL_DEBUG(SOLV_DEBUG_STATS, "reusing %d pkg rules\n", initialnrules - 1);
+  else
+    {
+      oldnrules = solv->nrules;
+      solver_addpkgrulesforweak(solv, &addedmap);
+      POOL_DEBUG(SOLV_DEBUG_STATS, "added %d pkg rules because of weak dependencies\n", solv->nrules - oldnrules);
 
 #ifdef ENABLE_LINKED_PKGS
-  oldnrules = solv->nrules;
-  solver_addpkgrulesforlinked(solv, &addedmap);
-  POOL_DEBUG(SOLV_DEBUG_STATS, "added %d pkg rules because of linked packages\n", solv->nrules - oldnrules);
+      oldnrules = solv->nrules;
+      solver_addpkgrulesforlinked(solv, &addedmap);
+      POOL_DEBUG(SOLV_DEBUG_STATS, "added %d pkg rules because of linked packages\n", solv->nrules - oldnrules);
 #endif
+    }
 
   /*
    * first pass done, we now have all the pkg rules we need.
@@ -3989,6 +4766,16 @@ solver_solve(Solver *solv, Queue *job)
   if (solv->nrules > initialnrules)
     addedmap2deduceq(solv, &addedmap);		/* so that we can recreate the addedmap */
 
+  /* incremental mode: remember what the pkg rules depend on and their watches */
+  if (solv->incremental)
+    pkgrules_makekey(solv, &solv->pkgrules_key);
+  else
+    queue_empty(&solv->pkgrules_key);
+  if (!solv->incremental)
+    freepkgwatches(solv);
+  else if (solv->nrules > initialnrules || !solv->pkgrules_saved || !solv->watchvectors != !solv->pkgwatchvecs)
+    savepkgwatches(solv);
+
   POOL_DEBUG(SOLV_DEBUG_STATS, "pkg rule memory used: %d K\n", solv->nrules * (int)sizeof(Rule) / 1024);
   POOL_DEBUG(SOLV_DEBUG_STATS, "pkg rule creation took %d ms\n", solv_timems(now));
 
@@ -4423,7 +5210,10 @@ solver_solve(Solver *solv, Queue *job)
   solv->learntrules = solv->nrules;
 
   /* create watches chains */
-  makewatches(solv);
+  if (solv->pkgrules_saved)
+    makewatches_pkgsaved(solv);
+  else
+    makewatches(solv);
 
   /* create assertion index. it is only used to speed up
    * makeruledecsions() a bit */
@@ -4454,6 +5244,11 @@ solver_solve(Solver *solv, Queue *job)
   solver_prepare_solutions(solv);
 
   POOL_DEBUG(SOLV_DEBUG_STATS, "final solver statistics: %d problems, %d learned rules, %d unsolvable\n", solv->problems.count / 2, solv->stats_learned, solv->stats_unsolvable);
+  POOL_DEBUG(SOLV_DEBUG_STATS, "propagation statistics: %d propagations, %d watch visits (%s)\n", solv->stats_propagations, solv->stats_watchvisits, solv->watchvecs ? "watch vectors" : "watch lists");
+  solv->stats_allocations = (int)(solv_allocstats() - nallocs);
+#ifdef ENABLE_ALLOCSTATS
+  POOL_DEBUG(SOLV_DEBUG_STATS, "memory statistics: %d allocations, %d K scratch memory\n", solv->stats_allocations, (int)(solv->arena.maxused / 1024));
+#endif
   POOL_DEBUG(SOLV_DEBUG_STATS, "solver_solve took %d ms\n", solv_timems(solve_start));
 
   /* return number of problems */
@@ -4565,14 +5360,14 @@ void solver_get_recommendations(Solver *solv, Queue *recommendationsq, Queue *su
       queue_empty(recommendationsq);
       /* create map of all recommened packages */
       solv->recommends_index = -1;
-      MAPZERO(&solv->recommendsmap);
+      sparsemap_empty(&solv->recommendsmap);
 
       /* put all packages the solver already chose in the map */
       for (i = 1; i < solv->decisionq.count; i++)
         if ((p = solv->decisionq.elements[i]) > 0 && solv->decisionq_why.elements[i] == 0)
 	  {
 	    if (solv->decisionq_reason.elements[solv->decisionmap[p]] == SOLVER_REASON_WEAKDEP)
-	      MAPSET(&solv->recommendsmap, p);
+	      SPARSEMAPSET(&solv->recommendsmap, p);
 	  }
 
       for (i = 0; i < solv->decisionq.count; i++)
@@ -4602,12 +5397,12 @@ void solver_get_recommendations(Solver *solv, Queue *recommendationsq, Queue *su
 			{
 			  FOR_PROVIDES(p, pp, rec)
 			    if (solv->decisionmap[p] > 0)
-			      MAPSET(&solv->recommendsmap, p);
+			      SPARSEMAPSET(&solv->recommendsmap, p);
 			}
 		      continue;	/* p != 0: already fulfilled */
 		    }
 		  FOR_PROVIDES(p, pp, rec)
-		    MAPSET(&solv->recommendsmap, p);
+		    SPARSEMAPSET(&solv->recommendsmap, p);
 		}
 	    }
 	}
@@ -4620,7 +5415,7 @@ void solver_get_recommendations(Solver *solv, Queue *recommendationsq, Queue *su
           if (MAPTST(&obsmap, i))
 	    continue;
 	  s = pool->solvables + i;
-	  if (!MAPTST(&solv->recommendsmap, i))
+	  if (!SPARSEMAPTST(&solv->recommendsmap, i))
 	    {
 	      if (!s->supplements)
 		continue;
@@ -4646,7 +5441,7 @@ void solver_get_recommendations(Solver *solv, Queue *recommendationsq, Queue *su
       queue_empty(suggestionsq);
       /* create map of all suggests that are still open */
       solv->recommends_index = -1;
-      MAPZERO(&solv->suggestsmap);
+      sparsemap_empty(&solv->suggestsmap);
       for (i = 0; i < solv->decisionq.count; i++)
 	{
 	  p = solv->decisionq.elements[i];
@@ -4674,12 +5469,12 @@ void solver_get_recommendations(Solver *solv, Queue *recommendationsq, Queue *su
 			{
 			  FOR_PROVIDES(p, pp, sug)
 			    if (solv->decisionmap[p] > 0)
-			      MAPSET(&solv->suggestsmap, p);
+			      SPARSEMAPSET(&solv->suggestsmap, p);
 			}
 		      continue;	/* already fulfilled */
 		    }
 		  FOR_PROVIDES(p, pp, sug)
-		    MAPSET(&solv->suggestsmap, p);
+		    SPARSEMAPSET(&solv->suggestsmap, p);
 		}
 	    }
 	}
@@ -4692,7 +5487,7 @@ void solver_get_recommendations(Solver *solv, Queue *recommendationsq, Queue *su
           if (MAPTST(&obsmap, i))
 	    continue;
 	  s = pool->solvables + i;
-	  if (!MAPTST(&solv->suggestsmap, i))
+	  if (!SPARSEMAPTST(&solv->suggestsmap, i))
 	    {
 	      if (!s->enhances)
 		continue;
@@ -26,6 +26,13 @@
 extern "C" {
 #endif
 
+#ifdef LIBSOLV_INTERNAL
+#include "arena.h"
+#include "sparsemap.h"
+
+#define SOLVER_STATS_NPHASES	8
+#endif
+
 struct s_Solver {
   Pool *pool;				/* back pointer to pool */
   Queue job;				/* copy of the job we're solving */
@@ -92,7 +99,7 @@ struct s_Solver {
 
   Id learntrules;			/* learnt rules, (end == nrules) */
 
-  Map noupdate;				/* don't try to update these
+  Sparsemap noupdate;			/* don't try to update these
                                            installed solvables */
   Map multiversion;			/* ignore obsoletes for these (multiinstall) */
 
@@ -102,7 +109,7 @@ struct s_Solver {
   Map bestupdatemap;			/* create best rule for those packages */
   int bestupdatemap_all;		/* bring all packages to the newest version */
 
-  Map fixmap;				/* fix these packages */
+  Sparsemap fixmap;			/* fix these packages */
   int fixmap_all;			/* fix all packages */
 
   Queue weakruleq;			/* index into 'rules' for weak ones */
@@ -113,6 +120,9 @@ struct s_Solver {
 					 * middle-solvable : decision to conflict, offset point to linked-list of rules
 					 * middle+solvable : decision to install: offset point to linked-list of rules
 					 */
+  Queue *watchvecs;			/* alternative to watches: per literal vectors of (rule, blocker) pairs,
+					 * also addressed from the middle */
+  int nwatchvecsolvables;		/* number of solvables watchvecs was created for */
 
   Queue ruletojob;                      /* index into job queue: jobs for which a rule exits */
 
@@ -140,9 +150,29 @@ struct s_Solver {
 
   int stats_learned;			/* statistic */
   int stats_unsolvable;			/* statistic */
-
-  Map recommendsmap;			/* recommended packages from decisionmap */
-  Map suggestsmap;			/* suggested packages from decisionmap */
+  int stats_propagations;		/* statistic: number of propagated decisions */
+  int stats_watchvisits;		/* statistic: number of rules looked at in propagate */
+  int stats_conflicts;			/* statistic: number of analyzed conflicts */
+  int stats_restarts;			/* statistic: number of restarts */
+  int stats_deletedlearnt;		/* statistic: number of deleted learnt rules */
+  int stats_phase;			/* statistic: current solver phase */
+  unsigned int stats_phasestart;	/* statistic: start time of the current phase */
+  int stats_phasedecisions[SOLVER_STATS_NPHASES];
+  int stats_phaseconflicts[SOLVER_STATS_NPHASES];
+  unsigned int stats_phasetime[SOLVER_STATS_NPHASES];
+  int stats_allocations;		/* statistic: heap allocations in the last solver_solve() */
+
+  Arena arena;				/* scratch memory for transient queues and maps */
+
+  Queue learnt_lbd;			/* glue of each learnt rule in restart mode, 0: rule was deleted */
+  Map savedphasemap;			/* phase saving: packages that were installed when reverted */
+  int restart_conflicts;		/* conflicts since the last restart */
+  int restart_luby;			/* index into the luby sequence */
+  int reduce_conflicts;			/* conflict count for the next learnt rule reduction */
+  int reduce_interval;			/* conflicts between learnt rule reductions */
+
+  Sparsemap recommendsmap;		/* recommended packages from decisionmap */
+  Sparsemap suggestsmap;		/* suggested packages from decisionmap */
   int recommends_index;			/* recommendsmap/suggestsmap is created up to this level */
   Queue *recommendscplxq;
   Queue *suggestscplxq;
@@ -180,6 +210,10 @@ struct s_Solver {
   int install_also_updates;		/* true: do not prune install job rules to installed packages */
   int only_namespace_recommended;	/* true: only install packages recommended by namespace */
   int strict_repo_priority;			/* true: only use packages from highest precedence/priority */
+  int watchvectors;			/* true: use watch vectors instead of linked watch lists */
+  int restarts;				/* true: do restarts, phase saving and learnt rule reduction */
+  int incremental;			/* true: keep pkg rules and their watches for the next solver_solve() */
+  int parallel_pkgrules;		/* number of threads used for pkg rule creation, 1: one per cpu */
 
   int process_orphans;			/* true: do special orphan processing */
   Map dupmap;				/* dup to those packages */
@@ -190,12 +224,13 @@ struct s_Solver {
   int dup_allowarchchange;		/* dup mode: allow to change architecture of installed solvables */
   int dup_allowvendorchange;		/* dup mode: allow to change vendor of installed solvables */
 
-  Map droporphanedmap;			/* packages to drop in dup mode */
+  Sparsemap droporphanedmap;		/* packages to drop in dup mode */
   int droporphanedmap_all;
 
   Map cleandepsmap;			/* try to drop these packages as of cleandeps erases */
 
   Queue *ruleinfoq;			/* tmp space for solver_ruleinfo() */
+  Queue *pkgrulebuf;			/* tmp space for parallel pkg rule creation */
 
   Queue *cleandeps_updatepkgs;		/* packages we update in cleandeps mode */
   Queue *cleandeps_mistakes;		/* mistakes we made */
@@ -205,15 +240,21 @@ struct s_Solver {
   Queue *installsuppdepq;		/* deps from the install namespace provides hack */
 
   Queue addedmap_deduceq;		/* deduce addedmap from pkg rules */
+  Queue pkgrules_key;			/* pool generation and solver settings the pkg rules were created for */
+  Rule *pkgrules_saved;			/* incremental: pkg rules linked into the pkg watches */
+  Id *pkgwatches;			/* incremental: watch list heads of the pkg rules */
+  Id *pkgwatchtails;			/* incremental: watch list tails of the pkg rules */
+  Queue *pkgwatchvecs;			/* incremental: watch vectors of the pkg rules */
+  int npkgwatchvecsolvables;		/* incremental: size of pkgwatchvecs */
   Id *instbuddy;			/* buddies of installed packages */
   int keep_orphans;			/* how to treat orphans */
   int break_orphans;			/* how to treat orphans */
   Queue *brokenorphanrules;		/* broken rules of orphaned packages */
 
-  Map allowuninstallmap;		/* ok to uninstall those */
+  Sparsemap allowuninstallmap;		/* ok to uninstall those */
   int allowuninstall_all;
 
-  Map excludefromweakmap;		/* remove them from candidates for supplements and recommends */
+  Sparsemap excludefromweakmap;		/* remove them from candidates for supplements and recommends */
 
   Id *favormap;				/* favor job index, > 0: favored, < 0: disfavored */
   int havedisfavored;			/* do we have disfavored packages? */
@@ -339,6 +380,21 @@ typedef struct s_Solver Solver;
 #define SOLVER_FLAG_ONLY_NAMESPACE_RECOMMENDED	27
 #define SOLVER_FLAG_STRICT_REPO_PRIORITY	28
 #define SOLVER_FLAG_FOCUS_NEW			29
+#define SOLVER_FLAG_WATCH_VECTORS		30
+#define SOLVER_FLAG_RESTARTS			31
+#define SOLVER_FLAG_INCREMENTAL			32
+#define SOLVER_FLAG_PARALLEL_PKGRULES		33
+
+/* solver_get_stat */
+#define SOLVER_STAT_LEARNED			1
+#define SOLVER_STAT_UNSOLVABLE			2
+#define SOLVER_STAT_PROPAGATIONS		3
+#define SOLVER_STAT_WATCHVISITS			4
+#define SOLVER_STAT_CONFLICTS			5
+#define SOLVER_STAT_RESTARTS			6
+#define SOLVER_STAT_DELETEDLEARNT		7
+#define SOLVER_STAT_ALLOCATIONS			8
+#define SOLVER_STAT_ARENASIZE			9
 
 #define GET_USERINSTALLED_NAMES			(1 << 0)	/* package names instead of ids */
 #define GET_USERINSTALLED_INVERTED		(1 << 1)	/* autoinstalled */
@@ -364,6 +420,7 @@ extern int  solver_solve(Solver *solv, Queue *job);
 extern Transaction *solver_create_transaction(Solver *solv);
 extern int solver_set_flag(Solver *solv, int flag, int value);
 extern int solver_get_flag(Solver *solv, int flag);
+extern int solver_get_stat(Solver *solv, int stat);
 
 extern int  solver_get_decisionlevel(Solver *solv, Id p);
 extern void solver_get_decisionqueue(Solver *solv, Queue *decisionq);
@@ -0,0 +1,76 @@
+/*
+ * Copyright (c) 2025, SUSE LLC
+ *
+ * This program is licensed under the BSD license, read LICENSE.BSD
+ * for further information
+ */
+
+/*
+ * sparsemap.c
+ *
+ * bitmap with lazily allocated pages for the big solver maps that
+ * usually have only a few bits set
+ */
+
+#include <stdlib.h>
+#include <string.h>
+
+#include "sparsemap.h"
+#include "util.h"
+
+#define SPARSEMAP_NPAGES(size) (((size) + SPARSEMAP_PAGESIZE - 1) >> SPARSEMAP_PAGESHIFT)
+
+void
+sparsemap_init(Sparsemap *m, int n)
+{
+  m->size = (n + 7) >> 3;
+  m->pages = m->size ? solv_calloc(SPARSEMAP_NPAGES(m->size), sizeof(unsigned char *)) : 0;
+}
+
+void
+sparsemap_grow(Sparsemap *m, int n)
+{
+  int onpages, npages;
+  n = (n + 7) >> 3;
+  if (m->size >= n)
+    return;
+  onpages = SPARSEMAP_NPAGES(m->size);
+  npages = SPARSEMAP_NPAGES(n);
+  if (npages > onpages)
+    {
+      m->pages = solv_realloc2(m->pages, npages, sizeof(unsigned char *));
+      memset(m->pages + onpages, 0, (npages - onpages) * sizeof(unsigned char *));
+    }
+  m->size = n;
+}
+
+void
+sparsemap_free(Sparsemap *m)
+{
+  int i, npages = SPARSEMAP_NPAGES(m->size);
+  for (i = 0; i < npages; i++)
+    solv_free(m->pages[i]);
+  m->pages = solv_free(m->pages);
+  m->size = 0;
+}
+
+/* clear all bits. Only the allocated pages need to be touched. */
+void
+sparsemap_empty(Sparsemap *m)
+{
+  int i, npages = SPARSEMAP_NPAGES(m->size);
+  for (i = 0; i < npages; i++)
+    if (m->pages[i])
+      memset(m->pages[i], 0, SPARSEMAP_PAGESIZE);
+}
+
+/* allocate the page that contains bit n */
+unsigned char *
+sparsemap_allocpage(Sparsemap *m, int n)
+{
+  unsigned char **pagep = &SPARSEMAP_PAGE(m, n);
+  if (!*pagep)
+    *pagep = solv_calloc(SPARSEMAP_PAGESIZE, 1);
+  return *pagep;
+}
+
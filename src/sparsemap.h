@@ -0,0 +1,56 @@
+/*
+ * Copyright (c) 2025, SUSE LLC
+ *
+ * This program is licensed under the BSD license, read LICENSE.BSD
+ * for further information
+ */
+
+/*
+ * sparsemap.h
+ *
+ * bitmap that only allocates the pages that contain set bits
+ */
+
+#ifndef LIBSOLV_SPARSEMAP_H
+#define LIBSOLV_SPARSEMAP_H
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/* a map that only allocates the pages that contain set bits */
+typedef struct s_Sparsemap {
+  unsigned char **pages;	/* SPARSEMAP_PAGESIZE bytes each, 0 if not allocated */
+  int size;			/* size in bytes like in the Map */
+} Sparsemap;
+
+#define SPARSEMAP_PAGESHIFT	9
+#define SPARSEMAP_PAGESIZE	(1 << SPARSEMAP_PAGESHIFT)	/* 4096 bits */
+
+#define SPARSEMAP_PAGE(m, n) ((m)->pages[(n) >> (SPARSEMAP_PAGESHIFT + 3)])
+#define SPARSEMAP_BYTE(n) (((n) >> 3) & (SPARSEMAP_PAGESIZE - 1))
+
+/* set bit */
+#define SPARSEMAPSET(m, n) (sparsemap_page(m, n)[SPARSEMAP_BYTE(n)] |= 1 << ((n) & 7))
+/* clear bit */
+#define SPARSEMAPCLR(m, n) (SPARSEMAP_PAGE(m, n) ? (SPARSEMAP_PAGE(m, n)[SPARSEMAP_BYTE(n)] &= ~(1 << ((n) & 7))) : 0)
+/* test bit */
+#define SPARSEMAPTST(m, n) (SPARSEMAP_PAGE(m, n) ? (SPARSEMAP_PAGE(m, n)[SPARSEMAP_BYTE(n)] & (1 << ((n) & 7))) : 0)
+
+extern void sparsemap_init(Sparsemap *m, int n);
+extern void sparsemap_grow(Sparsemap *m, int n);
+extern void sparsemap_free(Sparsemap *m);
+extern void sparsemap_empty(Sparsemap *m);
+extern unsigned char *sparsemap_allocpage(Sparsemap *m, int n);
+
+static inline unsigned char *sparsemap_page(Sparsemap *m, int n)
+{
+  unsigned char *page = SPARSEMAP_PAGE(m, n);
+  return page ? page : sparsemap_allocpage(m, n);
+}
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* LIBSOLV_SPARSEMAP_H */
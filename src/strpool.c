@@ -72,8 +72,10 @@ stringpool_clone(Stringpool *ss, Stringpool *from)
   ss->sstrings = from->sstrings;
 }
 
+/* stored is the memhash() side table of the strings, see
+ * stringpool_storehashes() */
 static void
-stringpool_resize_hash(Stringpool *ss, int numnew)
+stringpool_resize_hash(Stringpool *ss, const Hashval *stored, int numnew)
 {
   Hashval h, hh, hashmask;
   Hashtable hashtbl;
@@ -93,7 +95,10 @@ stringpool_resize_hash(Stringpool *ss, int numnew)
   /* rehash all strings into new hashtable */
   for (i = 1; i < ss->nstrings; i++)
     {
-      h = strhash(ss->stringspace + ss->strings[i]) & hashmask;
+      if (stored)
+	h = stored[i] & hashmask;
+      else
+        h = strhash(ss->stringspace + ss->strings[i]) & hashmask;
       hh = HASHCHAIN_START;
       while (hashtbl[h] != 0)
 	h = HASHCHAIN_NEXT(h, hh, hashmask);
@@ -101,12 +106,69 @@ stringpool_resize_hash(Stringpool *ss, int numnew)
     }
 }
 
+/*
+ * switch to stored hashes: the memhash() value of every string is kept
+ * in the side table *storedp, so that the hash table can be rebuilt
+ * without looking at the strings and lookups only compare strings with
+ * a matching hash. The side table is not part of the Stringpool struct,
+ * the functions that add strings must be called with it.
+ */
+void
+stringpool_storehashes(Stringpool *ss, Hashval **storedp, int on)
+{
+  Hashval *stored = *storedp;
+  int i;
+
+  if (!on == !stored)
+    return;
+  if (on)
+    {
+      stored = solv_extend_resize(0, ss->nstrings, sizeof(Hashval), STRING_BLOCK);
+      stored[0] = 0;
+      for (i = 1; i < ss->nstrings; i++)
+	{
+	  const char *str = ss->stringspace + ss->strings[i];
+	  stored[i] = memhash(str, strlen(str));
+	}
+    }
+  else
+    stored = solv_free(stored);
+  *storedp = stored;
+  /* the hash values changed, so we need a new hash table */
+  if (ss->stringhashtbl)
+    {
+      stringpool_freehash(ss);
+      stringpool_resize_hash(ss, stored, STRING_BLOCK);
+    }
+}
+
+/* make sure that the hash exists, so that lookups do not change the pool */
+void
+stringpool_createhash(Stringpool *ss, const Hashval *stored)
+{
+  if ((Hashval)ss->nstrings * 2 >= ss->stringhashmask)
+    {
+      if (!ss->stringhashmask)
+	stringpool_reserve(ss, 1, 1);
+      stringpool_resize_hash(ss, stored, STRING_BLOCK);
+    }
+}
+
 Id
 stringpool_strn2id(Stringpool *ss, const char *str, unsigned int len, int create)
 {
-  Hashval h, hh, hashmask;
+  return stringpool_strn2id_stored(ss, 0, str, len, create);
+}
+
+/* like stringpool_strn2id, but also maintains the stored hashes if
+ * storedp points to a side table */
+Id
+stringpool_strn2id_stored(Stringpool *ss, Hashval **storedp, const char *str, unsigned int len, int create)
+{
+  Hashval h, hh, hashmask, hv = 0;
   Id id;
   Hashtable hashtbl;
+  Hashval *stored = storedp ? *storedp : 0;
 
   if (!str)
     return STRID_NULL;
@@ -124,20 +186,36 @@ stringpool_strn2id(Stringpool *ss, const char *str, unsigned int len, int create
        * indication instead */
       if (!hashmask)
 	stringpool_reserve(ss, 1, len + 1);
-      stringpool_resize_hash(ss, STRING_BLOCK);
+      stringpool_resize_hash(ss, stored, STRING_BLOCK);
       hashmask = ss->stringhashmask;
     }
   hashtbl = ss->stringhashtbl;
 
-  /* compute hash and check for match */
-  h = strnhash(str, len) & hashmask;
-  hh = HASHCHAIN_START;
-  while ((id = hashtbl[h]) != 0)
+  if (stored)
     {
-      if(!memcmp(ss->stringspace + ss->strings[id], str, len)
-         && ss->stringspace[ss->strings[id] + len] == 0)
-	break;
-      h = HASHCHAIN_NEXT(h, hh, hashmask);
+      hv = memhash(str, len);
+      h = hv & hashmask;
+      hh = HASHCHAIN_START;
+      while ((id = hashtbl[h]) != 0)
+	{
+	  if (stored[id] == hv && !memcmp(ss->stringspace + ss->strings[id], str, len)
+	     && ss->stringspace[ss->strings[id] + len] == 0)
+	    break;
+	  h = HASHCHAIN_NEXT(h, hh, hashmask);
+	}
+    }
+  else
+    {
+      /* compute hash and check for match */
+      h = strnhash(str, len) & hashmask;
+      hh = HASHCHAIN_START;
+      while ((id = hashtbl[h]) != 0)
+	{
+	  if(!memcmp(ss->stringspace + ss->strings[id], str, len)
+	     && ss->stringspace[ss->strings[id] + len] == 0)
+	    break;
+	  h = HASHCHAIN_NEXT(h, hh, hashmask);
+	}
     }
   if (id || !create)    /* exit here if string found */
     return id;
@@ -148,6 +226,11 @@ stringpool_strn2id(Stringpool *ss, const char *str, unsigned int len, int create
 
   ss->strings = solv_extend(ss->strings, id, 1, sizeof(Offset), STRING_BLOCK);
   ss->strings[id] = ss->sstrings;	/* we will append to the end */
+  if (stored)
+    {
+      *storedp = stored = solv_extend(stored, id, 1, sizeof(Hashval), STRING_BLOCK);
+      stored[id] = hv;
+    }
 
   /* append string to stringspace */
   ss->stringspace = solv_extend(ss->stringspace, ss->sstrings, len + 1, 1, STRINGSPACE_BLOCK);
@@ -167,6 +250,42 @@ stringpool_str2id(Stringpool *ss, const char *str, int create)
   return stringpool_strn2id(ss, str, (unsigned int)strlen(str), create);
 }
 
+/*
+ * drop unused strings. strmap maps the old ids to the new ids, zero
+ * means that the string is no longer used. The new ids must be
+ * consecutive and in the same order as the old ones. The stored
+ * hashes in *storedp are compacted, too.
+ */
+void
+stringpool_compact(Stringpool *ss, Id *strmap, Hashval **storedp)
+{
+  Hashval *stored = storedp ? *storedp : 0;
+  char *stringspace;
+  Offset sstrings = 0;
+  int i, l, n = 0;
+
+  stringspace = solv_extend_resize(0, ss->sstrings, 1, STRINGSPACE_BLOCK);
+  for (i = 0; i < ss->nstrings; i++)
+    {
+      const char *str = ss->stringspace + ss->strings[i];
+      if (i && !strmap[i])
+	continue;
+      l = strlen(str) + 1;
+      memcpy(stringspace + sstrings, str, l);
+      ss->strings[n] = sstrings;
+      if (stored)
+	stored[n] = stored[i];
+      sstrings += l;
+      n++;
+    }
+  solv_free(ss->stringspace);
+  ss->stringspace = stringspace;
+  ss->sstrings = sstrings;
+  ss->nstrings = n;
+  stringpool_freehash(ss);
+  stringpool_shrink_stored(ss, storedp);
+}
+
 void
 stringpool_shrink(Stringpool *ss)
 {
@@ -174,6 +293,15 @@ stringpool_shrink(Stringpool *ss)
   ss->strings = solv_extend_resize(ss->strings, ss->nstrings, sizeof(Offset), STRING_BLOCK);
 }
 
+/* like stringpool_shrink, but also shrinks the stored hashes */
+void
+stringpool_shrink_stored(Stringpool *ss, Hashval **storedp)
+{
+  stringpool_shrink(ss);
+  if (storedp && *storedp)
+    *storedp = solv_extend_resize(*storedp, ss->nstrings, sizeof(Hashval), STRING_BLOCK);
+}
+
 void
 stringpool_reserve(Stringpool *ss, int numid, Offset sizeid)
 {
@@ -181,19 +309,39 @@ stringpool_reserve(Stringpool *ss, int numid, Offset sizeid)
   ss->strings = solv_extend_resize(ss->strings, ss->nstrings + numid, sizeof(Offset), STRING_BLOCK);
 }
 
+/* how far we look ahead when prefetching hash slots */
+#define HASH_PREFETCH	8
+
+/*
+ * merge numid new strings (that got appended to the stringspace) into the
+ * pool. If hashes is not zero, it contains the hash values of the
+ * strings, indexed by the new ids. They must have been calculated with
+ * the hash function of the pool, i.e. memhash() if the pool keeps the
+ * hashes in the side table *storedp and strhash() otherwise.
+ *
+ * The strings of a solv file are sorted in runs (by their use count,
+ * then by name). Strings within a strictly increasing run are unique,
+ * so a new string only needs to be compared with the strings that were
+ * in the pool before the run started. A file that is not sorted this
+ * way just starts more runs.
+ */
 int
-stringpool_integrate(Stringpool *ss, int numid, Offset sizeid, Id *idmap)
+stringpool_integrate(Stringpool *ss, int numid, Offset sizeid, Id *idmap, const Hashval *hashes, Hashval **storedp)
 {
+  Hashval *stored = storedp ? *storedp : 0;
   int oldnstrings = ss->nstrings;
   Offset oldsstrings = ss->sstrings;
   Offset *str;
-  Id id;
+  Id id, runstart;
   int i, l;
   char *strsp, *sp;
-  Hashval hashmask, h, hh;
+  const char *prev = 0;
+  Hashval hashmask, h, hh, hv;
   Hashtable hashtbl;
 
-  stringpool_resize_hash(ss, numid);
+  if (stored)
+    *storedp = stored = solv_extend_resize(stored, ss->nstrings + numid, sizeof(Hashval), STRING_BLOCK);
+  stringpool_resize_hash(ss, stored, numid);
   hashtbl = ss->stringhashtbl;
   hashmask = ss->stringhashmask;
 
@@ -204,6 +352,7 @@ stringpool_integrate(Stringpool *ss, int numid, Offset sizeid, Id *idmap)
    */
   str = ss->strings;
   sp = strsp = ss->stringspace + ss->sstrings;
+  runstart = oldnstrings;
   for (i = 1; i < numid; i++)
     {
       if (sp >= strsp + sizeid)
@@ -211,44 +360,72 @@ stringpool_integrate(Stringpool *ss, int numid, Offset sizeid, Id *idmap)
 	  ss->nstrings = oldnstrings;
 	  ss->sstrings = oldsstrings;
 	  stringpool_freehash(ss);
-	  stringpool_shrink(ss);	/* vacuum */
+	  stringpool_shrink_stored(ss, storedp);	/* vacuum */
 	  return 0;
 	}
+      /* a new run starts if the strings are not increasing. prev points
+       * to the pool copy, the old place may have been overwritten */
+      if (prev && strcmp(prev, sp) >= 0)
+	runstart = ss->nstrings;
       if (!*sp)				/* shortcut for empty strings */
 	{
 	  idmap[i] = STRID_EMPTY;
+	  prev = "";
 	  sp++;
 	  continue;
 	}
 
+      /* length == offset to next string */
+      l = strlen(sp) + 1;
+
       /* find hash slot */
-      h = strhash(sp) & hashmask;
+      if (hashes)
+	{
+	  hv = hashes[i];
+#if defined(__GNUC__)
+	  if (i + HASH_PREFETCH < numid)
+	    __builtin_prefetch(hashtbl + (hashes[i + HASH_PREFETCH] & hashmask));
+#endif
+	}
+      else
+	hv = stored ? memhash(sp, l - 1) : strhash(sp);
+      h = hv & hashmask;
       hh = HASHCHAIN_START;
       for (;;)
 	{
 	  id = hashtbl[h];
 	  if (!id)
 	    break;
-	  if (!strcmp(ss->stringspace + ss->strings[id], sp))
+	  if (id < runstart && (!stored || stored[id] == hv) && !strcmp(ss->stringspace + ss->strings[id], sp))
 	    break;			/* already in pool */
 	  h = HASHCHAIN_NEXT(h, hh, hashmask);
 	}
 
-      /* length == offset to next string */
-      l = strlen(sp) + 1;
       if (!id)				/* end of hash chain -> new string */
 	{
 	  id = ss->nstrings++;
 	  hashtbl[h] = id;
+	  if (stored)
+	    stored[id] = hv;
 	  str[id] = ss->sstrings;	/* save offset */
 	  if (sp != ss->stringspace + ss->sstrings)
 	    memmove(ss->stringspace + ss->sstrings, sp, l);
 	  ss->sstrings += l;
 	}
       idmap[i] = id;			/* repo relative -> pool relative */
+      prev = ss->stringspace + ss->strings[id];
       sp += l;				/* next string */
     }
-  stringpool_shrink(ss);		/* vacuum */
+  stringpool_shrink_stored(ss, storedp);	/* vacuum */
   return 1;
 }
 
+/* memory used by the strings, their offsets and the hash table */
+size_t
+stringpool_memused(Stringpool *ss)
+{
+  size_t size = ss->sstrings + (size_t)ss->nstrings * sizeof(Offset);
+  if (ss->stringhashtbl)
+    size += ((size_t)ss->stringhashmask + 1) * sizeof(Id);
+  return size;
+}
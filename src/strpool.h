@@ -38,9 +38,20 @@ Id stringpool_str2id(Stringpool *ss, const char *str, int create);
 Id stringpool_strn2id(Stringpool *ss, const char *str, unsigned int len, int create);
 
 void stringpool_shrink(Stringpool *ss);
+size_t stringpool_memused(Stringpool *ss);
 
 void stringpool_reserve(Stringpool *ss, int numid, Offset sizeid);
-int stringpool_integrate(Stringpool *ss, int numid, Offset sizeid, Id *idmap);
+
+#ifdef LIBSOLV_INTERNAL
+/* the stored memhash() values of a string pool live in a side table
+ * outside of the Stringpool struct, which is part of the public ABI */
+void stringpool_storehashes(Stringpool *ss, Hashval **storedp, int on);
+void stringpool_createhash(Stringpool *ss, const Hashval *stored);
+Id stringpool_strn2id_stored(Stringpool *ss, Hashval **storedp, const char *str, unsigned int len, int create);
+void stringpool_shrink_stored(Stringpool *ss, Hashval **storedp);
+void stringpool_compact(Stringpool *ss, Id *strmap, Hashval **storedp);
+int stringpool_integrate(Stringpool *ss, int numid, Offset sizeid, Id *idmap, const Hashval *hashes, Hashval **storedp);
+#endif
 
 
 static inline const char *
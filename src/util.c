@@ -18,9 +18,35 @@
 #else
   #include <sys/time.h>
 #endif
+#ifdef ENABLE_PTHREADS
+  #include <pthread.h>
+#endif
 
 #include "util.h"
 
+#ifdef ENABLE_ALLOCSTATS
+static unsigned long solv_nallocs;	/* number of malloc/calloc/realloc calls */
+# ifdef ENABLE_PTHREADS
+#  define ALLOCSTATS_COUNT() __atomic_fetch_add(&solv_nallocs, 1, __ATOMIC_RELAXED)
+# else
+#  define ALLOCSTATS_COUNT() (solv_nallocs++)
+# endif
+#else
+# define ALLOCSTATS_COUNT()
+#endif
+
+/* return the number of allocations done so far. Always zero if
+ * libsolv was not built with ENABLE_ALLOCSTATS. */
+unsigned long
+solv_allocstats(void)
+{
+#ifdef ENABLE_ALLOCSTATS
+  return solv_nallocs;
+#else
+  return 0;
+#endif
+}
+
 void
 solv_oom(size_t num, size_t len)
 {
@@ -36,6 +62,7 @@ void *
 solv_malloc(size_t len)
 {
   void *r = malloc(len ? len : 1);
+  ALLOCSTATS_COUNT();
   if (!r)
     solv_oom(0, len);
   return r;
@@ -56,6 +83,7 @@ solv_realloc(void *old, size_t len)
     old = malloc(len ? len : 1);
   else
     old = realloc(old, len ? len : 1);
+  ALLOCSTATS_COUNT();
   if (!old)
     solv_oom(0, len);
   return old;
@@ -77,6 +105,7 @@ solv_calloc(size_t num, size_t len)
     r = malloc(1);
   else
     r = calloc(num, len);
+  ALLOCSTATS_COUNT();
   if (!r)
     solv_oom(num, len);
   return r;
@@ -154,6 +183,90 @@ solv_setcloexec(int fd, int state)
   #endif
 }
 
+int
+solv_ncpus(void)
+{
+#if defined(ENABLE_PTHREADS) && defined(_SC_NPROCESSORS_ONLN)
+  long n = sysconf(_SC_NPROCESSORS_ONLN);
+  return n > 1 ? (int)n : 1;
+#else
+  return 1;
+#endif
+}
+
+/* run task(data, i) for all i < ntasks using up to nthreads threads
+ * (nthreads <= 0: one thread per cpu). The calling thread also works
+ * on the tasks, everything is done in the calling thread if we were
+ * built without thread support. The tasks must not depend on each
+ * other, they are handed out in ascending order. */
+
+#ifdef ENABLE_PTHREADS
+
+struct s_parallel {
+  pthread_mutex_t lock;
+  int next;
+  int ntasks;
+  void (*task)(void *, int);
+  void *data;
+};
+
+static void *
+parallel_worker(void *vp)
+{
+  struct s_parallel *par = vp;
+  int i;
+  for (;;)
+    {
+      pthread_mutex_lock(&par->lock);
+      i = par->next < par->ntasks ? par->next++ : -1;
+      pthread_mutex_unlock(&par->lock);
+      if (i < 0)
+	break;
+      par->task(par->data, i);
+    }
+  return 0;
+}
+
+#endif
+
+void
+solv_parallel(int ntasks, int nthreads, void (*task)(void *, int), void *data)
+{
+#ifdef ENABLE_PTHREADS
+  struct s_parallel par;
+  pthread_t *threads;
+  int nstarted;
+#endif
+  int i;
+
+#ifdef ENABLE_PTHREADS
+  if (nthreads <= 0)
+    nthreads = solv_ncpus();
+  if (nthreads > ntasks)
+    nthreads = ntasks;
+  if (nthreads > 1)
+    {
+      pthread_mutex_init(&par.lock, 0);
+      par.next = 0;
+      par.ntasks = ntasks;
+      par.task = task;
+      par.data = data;
+      threads = solv_calloc(nthreads - 1, sizeof(pthread_t));
+      for (nstarted = 0; nstarted < nthreads - 1; nstarted++)
+	if (pthread_create(threads + nstarted, 0, parallel_worker, &par))
+	  break;
+      parallel_worker(&par);
+      for (i = 0; i < nstarted; i++)
+	pthread_join(threads[i], 0);
+      solv_free(threads);
+      pthread_mutex_destroy(&par.lock);
+      return;
+    }
+#endif
+  for (i = 0; i < ntasks; i++)
+    task(data, i);
+}
+
 /* bsd's qsort_r has different arguments, so we define our
    own version in case we need to do some clever mapping
 
@@ -35,6 +35,8 @@ extern char *solv_strdup(const char *);
 extern void solv_oom(size_t, size_t);
 extern unsigned int solv_timems(unsigned int subtract);
 extern int solv_setcloexec(int fd, int state);
+extern int solv_ncpus(void);
+extern void solv_parallel(int ntasks, int nthreads, void (*task)(void *data, int taskno), void *data);
 extern void solv_sort(void *base, size_t nmemb, size_t size, int (*compar)(const void *, const void *, void *), void *compard);
 extern char *solv_dupjoin(const char *str1, const char *str2, const char *str3);
 extern char *solv_dupappend(const char *str1, const char *str2, const char *str3);
@@ -114,6 +116,11 @@ static inline void *solv_memdup2(const void *buf, size_t num, size_t len)
   return newbuf;
 }
 
+#ifdef LIBSOLV_INTERNAL
+/* number of allocations, only counted with ENABLE_ALLOCSTATS */
+extern unsigned long solv_allocstats(void);
+#endif
+
 #ifdef __cplusplus
 }
 #endif
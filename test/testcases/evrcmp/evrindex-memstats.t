@@ -0,0 +1,44 @@
+# the evr index and its data are counted in the whatprovides memory
+repo system 0 empty
+repo available 0 testtags <inline>
+#>=Pkg: A 1.0 1 noarch
+#>=Pkg: A 1.1 1 noarch
+#>=Pkg: A 1.2 1 noarch
+#>=Pkg: A 1.3 1 noarch
+#>=Pkg: A 1.3 2 noarch
+#>=Pkg: A 1.4 1 noarch
+#>=Pkg: A 1.5 1 noarch
+#>=Pkg: A 1.6 1 noarch
+#>=Pkg: A 2.0 1 noarch
+#>=Pkg: A 1:0.1 1 noarch
+#>=Pkg: B 3.0 1 noarch
+#>=Prv: A = 1.3
+#>=Pkg: R 1 1 noarch
+#>=Req: A >= 1.2
+#>=Req: A < 1.5
+system i686 rpm system
+job install name R
+result transaction,problems,memstats <inline>
+#>install A-1.4-1.noarch@available
+#>install R-1-1.noarch@available
+#>memstats rels 192
+#>memstats stringspace 37604
+#>memstats whatprovides 3948
+nextjob
+poolflags whatprovidesevrindex
+job install name R
+result transaction,problems,memstats <inline>
+#>install A-1.4-1.noarch@available
+#>install R-1-1.noarch@available
+#>memstats rels 192
+#>memstats stringspace 37604
+#>memstats whatprovides 4956
+nextjob
+poolflags !whatprovidesevrindex
+job install name R
+result transaction,problems,memstats <inline>
+#>install A-1.4-1.noarch@available
+#>install R-1-1.noarch@available
+#>memstats rels 192
+#>memstats stringspace 37604
+#>memstats whatprovides 3948
@@ -0,0 +1,38 @@
+repo system 0 testtags <inline>
+#>=Pkg: X 1 1 x86_64
+#>=Pkg: K 1 1 x86_64
+repo available 0 testtags <inline>
+#>=Pkg: A 1 1 x86_64
+#>=Req: X
+#>=Pkg: B 1 1 x86_64
+#>=Req: C
+#>=Pkg: C 1 1 x86_64
+#>=Con: A
+#>=Pkg: K 2 1 x86_64
+system x86_64 rpm system
+solverflags incremental watchvectors
+job install name A
+result transaction,problems <inline>
+#>install A-1-1.x86_64@available
+nextjob reusesolver
+job install name B
+result transaction,problems <inline>
+#>install B-1-1.x86_64@available
+#>install C-1-1.x86_64@available
+nextjob reusesolver
+job install name A
+job install name B
+result transaction,problems <inline>
+#>problem c37c46d4 info package B-1-1.x86_64 requires C, but none of the providers can be installed
+#>problem c37c46d4 solution 23f73f5b deljob install name A
+#>problem c37c46d4 solution f229cf9d deljob install name B
+nextjob reusesolver
+job multiversion name K
+job install pkg K-2-1.x86_64@available
+result transaction,problems <inline>
+#>install K-2-1.x86_64@available
+nextjob reusesolver
+job install name B
+result transaction,problems <inline>
+#>install B-1-1.x86_64@available
+#>install C-1-1.x86_64@available
@@ -0,0 +1,3067 @@
+rule pkg 0002b1a1835311374161699b534837fd  p106-1-1.x86_64@system
+rule pkg 0002b1a1835311374161699b534837fd  p106-2-1.x86_64@available
+rule pkg 0002b1a1835311374161699b534837fd -p105-1-1.x86_64@system
+rule pkg 000dcc123e6fdf1c4fbced75a2671264 -p142-2-1.x86_64@available
+rule pkg 000dcc123e6fdf1c4fbced75a2671264 -p145-1-1.x86_64@system
+rule pkg 003091309f0c559aeef21d0d83a869f5  p132-2-1.x86_64@available
+rule pkg 003091309f0c559aeef21d0d83a869f5 -p125-2-1.x86_64@available
+rule pkg 004d409eda032671eb90d2789c5b2b72  p121-2-1.x86_64@available
+rule pkg 004d409eda032671eb90d2789c5b2b72 -p114-2-1.x86_64@available
+rule pkg 0100de992351f51393d5c14c7ad047f8 -p114-2-1.x86_64@available
+rule pkg 0100de992351f51393d5c14c7ad047f8 -p117-1-1.x86_64@system
+rule pkg 01c327efe55bd07f6fb6ffdf3bc688c9  p56-2-1.x86_64@available
+rule pkg 01c327efe55bd07f6fb6ffdf3bc688c9 -p55-2-1.x86_64@available
+rule pkg 01c5deeba410588389a5e3df5c4a24d5 -p126-2-1.x86_64@available
+rule pkg 01c5deeba410588389a5e3df5c4a24d5 -p129-1-1.x86_64@system
+rule pkg 01c685d272817667ac342c31ab7a8613  p30-2-1.x86_64@available
+rule pkg 01c685d272817667ac342c31ab7a8613 -p23-2-1.x86_64@available
+rule pkg 01db423dfbdfb0f297d345c353e7c665 -old105-1-1.x86_64@available
+rule pkg 01db423dfbdfb0f297d345c353e7c665 -p105-2-1.x86_64@available
+rule pkg 01eb88bb14ad808bcd21ac1fe7061332 -p37-1-1.x86_64@system
+rule pkg 01eb88bb14ad808bcd21ac1fe7061332 -p37-2-1.x86_64@available
+rule pkg 01fdf3e7d5f870c307853c9c47437b99 -p140-1-1.x86_64@system
+rule pkg 01fdf3e7d5f870c307853c9c47437b99 -p140-2-1.x86_64@available
+rule pkg 025485b74ccc039022f334bc6b24dbab  p82-2-1.x86_64@available
+rule pkg 025485b74ccc039022f334bc6b24dbab -p75-2-1.x86_64@available
+rule pkg 02b10b94a0bcaca4a4eb8155d2c7ed9b  p23-2-1.x86_64@available
+rule pkg 02b10b94a0bcaca4a4eb8155d2c7ed9b -p22-2-1.x86_64@available
+rule pkg 02ca51afdf67fe7cbaa99e981a9d880b -old100-1-1.x86_64@available
+rule pkg 02ca51afdf67fe7cbaa99e981a9d880b -p100-2-1.x86_64@available
+rule pkg 02fea489a1751a4d1142adaacb43f9b0  p41-2-1.x86_64@available
+rule pkg 02fea489a1751a4d1142adaacb43f9b0 -p40-2-1.x86_64@available
+rule pkg 032b9599acc09113bc2f8d370219d631 -p103-1-1.x86_64@system
+rule pkg 032b9599acc09113bc2f8d370219d631 -p103-2-1.x86_64@available
+rule pkg 03ee1ead1104d3339d87b39283873ac1  p78-1-1.x86_64@system
+rule pkg 03ee1ead1104d3339d87b39283873ac1  p78-2-1.x86_64@available
+rule pkg 03ee1ead1104d3339d87b39283873ac1 -p77-1-1.x86_64@system
+rule pkg 03f93e6000bae173a1bf0523de37ca00 -p24-2-1.x86_64@available
+rule pkg 03f93e6000bae173a1bf0523de37ca00 -p27-1-1.x86_64@system
+rule pkg 041f00cf22ce0c7856735d0325002e70 -p23-2-1.x86_64@available
+rule pkg 041f00cf22ce0c7856735d0325002e70 -p26-1-1.x86_64@system
+rule pkg 046c90e95f009a501b14fd69b524a5d9  p8-2-1.x86_64@available
+rule pkg 046c90e95f009a501b14fd69b524a5d9 -p1-2-1.x86_64@available
+rule pkg 0494777ef681f81589e91260bbdf166e  p71-1-1.x86_64@system
+rule pkg 0494777ef681f81589e91260bbdf166e  p71-2-1.x86_64@available
+rule pkg 0494777ef681f81589e91260bbdf166e -p70-1-1.x86_64@system
+rule pkg 049ad1a62f997cd244a573d4bac65af7  p134-2-1.x86_64@available
+rule pkg 049ad1a62f997cd244a573d4bac65af7 -p133-2-1.x86_64@available
+rule pkg 04c50338c2125394b17b7ce9cfc9dc88 -p99-1-1.x86_64@system
+rule pkg 04c50338c2125394b17b7ce9cfc9dc88 -p99-2-1.x86_64@available
+rule pkg 04d295962e2bbfd8959e779c729f644a -p108-2-1.x86_64@available
+rule pkg 04d295962e2bbfd8959e779c729f644a -p111-1-1.x86_64@system
+rule pkg 04ec2cbe68b8e82c7044b673cdc6972d  p93-2-1.x86_64@available
+rule pkg 04ec2cbe68b8e82c7044b673cdc6972d -p86-2-1.x86_64@available
+rule pkg 05191a00343fb415abb4428024c08c5d -p68-1-1.x86_64@system
+rule pkg 05191a00343fb415abb4428024c08c5d -p68-2-1.x86_64@available
+rule pkg 05249664183b0f9e32559341bb3afa5f -p83-1-1.x86_64@system
+rule pkg 05249664183b0f9e32559341bb3afa5f -p83-2-1.x86_64@available
+rule pkg 0532f003ec1084ce9468772f5712ea30 -old115-1-1.x86_64@available
+rule pkg 0532f003ec1084ce9468772f5712ea30 -p115-2-1.x86_64@available
+rule pkg 053f690f9fd135c03ace40c9627d0cd3  p37-1-1.x86_64@system
+rule pkg 053f690f9fd135c03ace40c9627d0cd3  p37-2-1.x86_64@available
+rule pkg 053f690f9fd135c03ace40c9627d0cd3 -p36-1-1.x86_64@system
+rule pkg 058c285327ea643be7394c1a7a0648b9 -p134-2-1.x86_64@available
+rule pkg 058c285327ea643be7394c1a7a0648b9 -p137-1-1.x86_64@system
+rule pkg 061d31f1a3a712f1d02b4d84fa06a453  p59-1-1.x86_64@system
+rule pkg 061d31f1a3a712f1d02b4d84fa06a453  p59-2-1.x86_64@available
+rule pkg 061d31f1a3a712f1d02b4d84fa06a453 -p58-1-1.x86_64@system
+rule pkg 06a69a7c8815c22abf0ab675fabc14c2  p148-2-1.x86_64@available
+rule pkg 06a69a7c8815c22abf0ab675fabc14c2 -p141-2-1.x86_64@available
+rule pkg 076b9ce5bb29ba4cee6e69ad0be219be  p122-2-1.x86_64@available
+rule pkg 076b9ce5bb29ba4cee6e69ad0be219be -p121-2-1.x86_64@available
+rule pkg 077ec3d97940824d12d6d14ec2a305e2  p26-2-1.x86_64@available
+rule pkg 077ec3d97940824d12d6d14ec2a305e2 -p19-2-1.x86_64@available
+rule pkg 07a8cfebb8170dce55da3cf94c903429  p98-1-1.x86_64@system
+rule pkg 07a8cfebb8170dce55da3cf94c903429  p98-2-1.x86_64@available
+rule pkg 07a8cfebb8170dce55da3cf94c903429 -p97-1-1.x86_64@system
+rule pkg 07bcdb4e72467a7eaec87d777dad0ffe -p17-1-1.x86_64@system
+rule pkg 07bcdb4e72467a7eaec87d777dad0ffe -p17-2-1.x86_64@available
+rule pkg 07dce06e13cf9c25b134c4c87826b88c  p49-1-1.x86_64@system
+rule pkg 07dce06e13cf9c25b134c4c87826b88c  p49-2-1.x86_64@available
+rule pkg 07dce06e13cf9c25b134c4c87826b88c -p48-1-1.x86_64@system
+rule pkg 08813630c9007bde0aff1bf4819b1dde -p146-2-1.x86_64@available
+rule pkg 08813630c9007bde0aff1bf4819b1dde -p149-1-1.x86_64@system
+rule pkg 09184a9239b50e071792411c6b9eaefb -old75-1-1.x86_64@available
+rule pkg 09184a9239b50e071792411c6b9eaefb -p75-2-1.x86_64@available
+rule pkg 0a3f62dc714afd31f7a7fb8dbf23cd9b  p99-2-1.x86_64@available
+rule pkg 0a3f62dc714afd31f7a7fb8dbf23cd9b -p92-2-1.x86_64@available
+rule pkg 0a468bc9d3a54c6474b236da2718e4f2  p55-2-1.x86_64@available
+rule pkg 0a468bc9d3a54c6474b236da2718e4f2 -p54-2-1.x86_64@available
+rule pkg 0bab5a69f545475e74009e6ed34b409c  p113-2-1.x86_64@available
+rule pkg 0bab5a69f545475e74009e6ed34b409c -p112-2-1.x86_64@available
+rule pkg 0bbaf55f9a6b9f7a5ca6d80be45f5963  p83-2-1.x86_64@available
+rule pkg 0bbaf55f9a6b9f7a5ca6d80be45f5963 -p82-2-1.x86_64@available
+rule pkg 0c12c7ff516a42a6918d9aad16136d3d  p7-1-1.x86_64@system
+rule pkg 0c12c7ff516a42a6918d9aad16136d3d  p7-2-1.x86_64@available
+rule pkg 0c12c7ff516a42a6918d9aad16136d3d -p6-1-1.x86_64@system
+rule pkg 0c1a5b4f936b83758505ae351cd68922  p149-1-1.x86_64@system
+rule pkg 0c1a5b4f936b83758505ae351cd68922  p149-2-1.x86_64@available
+rule pkg 0c1a5b4f936b83758505ae351cd68922 -p148-1-1.x86_64@system
+rule pkg 0c51cba0301013d16a2971a409422e3e -p6-2-1.x86_64@available
+rule pkg 0c51cba0301013d16a2971a409422e3e -p9-1-1.x86_64@system
+rule pkg 0d1b55d6be32b63862324543f47d8731 -p47-2-1.x86_64@available
+rule pkg 0d1b55d6be32b63862324543f47d8731 -p50-1-1.x86_64@system
+rule pkg 0de6378395b2c452abc0a2f2ce77ef6e -p45-2-1.x86_64@available
+rule pkg 0de6378395b2c452abc0a2f2ce77ef6e -p48-1-1.x86_64@system
+rule pkg 0e0552d67b9f4edef22c7e2537fc0e29  p124-2-1.x86_64@available
+rule pkg 0e0552d67b9f4edef22c7e2537fc0e29 -p123-2-1.x86_64@available
+rule pkg 0e3d7f0ef2c3ee1b47d08fbf0312d268  p77-2-1.x86_64@available
+rule pkg 0e3d7f0ef2c3ee1b47d08fbf0312d268 -p76-2-1.x86_64@available
+rule pkg 0eabe6d4bb400a7d448b930603b25c26  p144-1-1.x86_64@system
+rule pkg 0eabe6d4bb400a7d448b930603b25c26  p144-2-1.x86_64@available
+rule pkg 0eabe6d4bb400a7d448b930603b25c26 -p143-1-1.x86_64@system
+rule pkg 0eafed0bbfcb383f785c9b3957d858f2  p103-1-1.x86_64@system
+rule pkg 0eafed0bbfcb383f785c9b3957d858f2  p103-2-1.x86_64@available
+rule pkg 0eafed0bbfcb383f785c9b3957d858f2 -p102-1-1.x86_64@system
+rule pkg 0ed36fc61e286f3a56d3c0f34fcfe484  p0-2-1.x86_64@available
+rule pkg 0ed36fc61e286f3a56d3c0f34fcfe484 -p143-2-1.x86_64@available
+rule pkg 0f155713dca6a4acfdb18b38bce6e9ee -p65-2-1.x86_64@available
+rule pkg 0f155713dca6a4acfdb18b38bce6e9ee -p68-1-1.x86_64@system
+rule pkg 0fac52497545a4a04129547743d3eca1  p105-2-1.x86_64@available
+rule pkg 0fac52497545a4a04129547743d3eca1 -p104-2-1.x86_64@available
+rule pkg 0fead6a7baf4d1774fd0aeaff5845ddf -p101-1-1.x86_64@system
+rule pkg 0fead6a7baf4d1774fd0aeaff5845ddf -p101-2-1.x86_64@available
+rule pkg 100ee3e8178dd82c3f645296e884bca7 -p88-1-1.x86_64@system
+rule pkg 100ee3e8178dd82c3f645296e884bca7 -p88-2-1.x86_64@available
+rule pkg 101d8e5fff68fbef2af3a375a8b4cba9 -p58-1-1.x86_64@system
+rule pkg 101d8e5fff68fbef2af3a375a8b4cba9 -p58-2-1.x86_64@available
+rule pkg 1088581e47cc1d613235db36a0903a37  p89-2-1.x86_64@available
+rule pkg 1088581e47cc1d613235db36a0903a37 -p88-2-1.x86_64@available
+rule pkg 10b2808f34069b0cdbdc8b8ed100cad8  p41-2-1.x86_64@available
+rule pkg 10b2808f34069b0cdbdc8b8ed100cad8 -p34-2-1.x86_64@available
+rule pkg 111249a6b6427c7ce7f8dace358c13fb -p42-2-1.x86_64@available
+rule pkg 111249a6b6427c7ce7f8dace358c13fb -p45-1-1.x86_64@system
+rule pkg 11d810ee33e15587834352273743106b -p123-1-1.x86_64@system
+rule pkg 11d810ee33e15587834352273743106b -p123-2-1.x86_64@available
+rule pkg 11dfbdb6b852cb15b4e8dad1bc60dbd0 -p81-1-1.x86_64@system
+rule pkg 11dfbdb6b852cb15b4e8dad1bc60dbd0 -p81-2-1.x86_64@available
+rule pkg 11e4268acb105983a1dc53f390add2dc -p46-1-1.x86_64@system
+rule pkg 11e4268acb105983a1dc53f390add2dc -p46-2-1.x86_64@available
+rule pkg 12543f5c14aad70c7790894f94c764c2 -p17-2-1.x86_64@available
+rule pkg 12543f5c14aad70c7790894f94c764c2 -p20-1-1.x86_64@system
+rule pkg 12591190c6206ca49429695c992fa40b -old70-1-1.x86_64@available
+rule pkg 12591190c6206ca49429695c992fa40b -p70-2-1.x86_64@available
+rule pkg 12d140117ac4653df5093349e3ce2f60  p104-1-1.x86_64@system
+rule pkg 12d140117ac4653df5093349e3ce2f60  p104-2-1.x86_64@available
+rule pkg 12d140117ac4653df5093349e3ce2f60 -p103-1-1.x86_64@system
+rule pkg 12dda18b00eacdea74f6efb6d8daf5ca  p20-2-1.x86_64@available
+rule pkg 12dda18b00eacdea74f6efb6d8daf5ca -p13-2-1.x86_64@available
+rule pkg 12e1cc940e0c6a48228e54f56b498201  p13-2-1.x86_64@available
+rule pkg 12e1cc940e0c6a48228e54f56b498201 -p12-2-1.x86_64@available
+rule pkg 1397cb1198fbc6ab94ac61c3a26cb501 -p71-1-1.x86_64@system
+rule pkg 1397cb1198fbc6ab94ac61c3a26cb501 -p71-2-1.x86_64@available
+rule pkg 13cbee3e53d32e20de3b087936949deb  p73-1-1.x86_64@system
+rule pkg 13cbee3e53d32e20de3b087936949deb  p73-2-1.x86_64@available
+rule pkg 13cbee3e53d32e20de3b087936949deb -p72-1-1.x86_64@system
+rule pkg 14c578ef2db59b00a4df460588004847  p92-1-1.x86_64@system
+rule pkg 14c578ef2db59b00a4df460588004847  p92-2-1.x86_64@available
+rule pkg 14c578ef2db59b00a4df460588004847 -p91-1-1.x86_64@system
+rule pkg 150da423b0c8b5ed3aff53ca1e6152ad  p96-2-1.x86_64@available
+rule pkg 150da423b0c8b5ed3aff53ca1e6152ad -p89-2-1.x86_64@available
+rule pkg 150e0a9c4bd1e596f1d9e5050911e421  p112-2-1.x86_64@available
+rule pkg 150e0a9c4bd1e596f1d9e5050911e421 -p105-2-1.x86_64@available
+rule pkg 1529c5c3af84460011f5020d7c397d41  p47-2-1.x86_64@available
+rule pkg 1529c5c3af84460011f5020d7c397d41 -p40-2-1.x86_64@available
+rule pkg 15b9caf8458d5ae16ebada4494a0392e -p33-1-1.x86_64@system
+rule pkg 15b9caf8458d5ae16ebada4494a0392e -p33-2-1.x86_64@available
+rule pkg 15ebde09c52fb67cbd2e0db5ace9c681 -p10-1-1.x86_64@system
+rule pkg 15ebde09c52fb67cbd2e0db5ace9c681 -p7-2-1.x86_64@available
+rule pkg 16ae04a568847a716a12aef8fd517dbf -p50-2-1.x86_64@available
+rule pkg 16ae04a568847a716a12aef8fd517dbf -p53-1-1.x86_64@system
+rule pkg 171c3e328bb67099e86b86d0845b491f  p110-1-1.x86_64@system
+rule pkg 171c3e328bb67099e86b86d0845b491f  p110-2-1.x86_64@available
+rule pkg 171c3e328bb67099e86b86d0845b491f -p109-1-1.x86_64@system
+rule pkg 173a116791feb68409be51addd8a045a -p32-1-1.x86_64@system
+rule pkg 173a116791feb68409be51addd8a045a -p32-2-1.x86_64@available
+rule pkg 17da2d5723e6e4d1617f59196ed0c337  p135-2-1.x86_64@available
+rule pkg 17da2d5723e6e4d1617f59196ed0c337 -p128-2-1.x86_64@available
+rule pkg 17dade0418c08924a20a994cdaf30995  p0-2-1.x86_64@available
+rule pkg 17dade0418c08924a20a994cdaf30995 -p149-2-1.x86_64@available
+rule pkg 1840a393eaf32341576b435a5920b574  p81-2-1.x86_64@available
+rule pkg 1840a393eaf32341576b435a5920b574 -p80-2-1.x86_64@available
+rule pkg 1859eaad1ac1f5684d5e5233c2082675  p11-2-1.x86_64@available
+rule pkg 1859eaad1ac1f5684d5e5233c2082675 -p10-2-1.x86_64@available
+rule pkg 18ac7f622bd038686860118853833494 -p107-2-1.x86_64@available
+rule pkg 18ac7f622bd038686860118853833494 -p110-1-1.x86_64@system
+rule pkg 18bb84388d7b4353dff934360d600d9f -p126-1-1.x86_64@system
+rule pkg 18bb84388d7b4353dff934360d600d9f -p126-2-1.x86_64@available
+rule pkg 18df9ae98dcea546802477c3d26eae25 -p122-1-1.x86_64@system
+rule pkg 18df9ae98dcea546802477c3d26eae25 -p122-2-1.x86_64@available
+rule pkg 18e9279a3add3c9d950b3a7cf92d9f94 -p133-1-1.x86_64@system
+rule pkg 18e9279a3add3c9d950b3a7cf92d9f94 -p133-2-1.x86_64@available
+rule pkg 18f6e3395d57a1a9fa371487bc93063b  p62-1-1.x86_64@system
+rule pkg 18f6e3395d57a1a9fa371487bc93063b  p62-2-1.x86_64@available
+rule pkg 18f6e3395d57a1a9fa371487bc93063b -p61-1-1.x86_64@system
+rule pkg 1915b5f7a16a07f464cf100c1de0d24c  p103-2-1.x86_64@available
+rule pkg 1915b5f7a16a07f464cf100c1de0d24c -p102-2-1.x86_64@available
+rule pkg 19455fe6024d61c0ccfb1ee462a6e7a8  p35-2-1.x86_64@available
+rule pkg 19455fe6024d61c0ccfb1ee462a6e7a8 -p34-2-1.x86_64@available
+rule pkg 197b960261685fd7fe4a513e48b1b0ec  p49-2-1.x86_64@available
+rule pkg 197b960261685fd7fe4a513e48b1b0ec -p42-2-1.x86_64@available
+rule pkg 19c4b19426da4fb056eb60b920e2afec  p57-1-1.x86_64@system
+rule pkg 19c4b19426da4fb056eb60b920e2afec  p57-2-1.x86_64@available
+rule pkg 19c4b19426da4fb056eb60b920e2afec -p56-1-1.x86_64@system
+rule pkg 1a2b037f6270595c8e31852f91240589  p32-1-1.x86_64@system
+rule pkg 1a2b037f6270595c8e31852f91240589  p32-2-1.x86_64@available
+rule pkg 1a2b037f6270595c8e31852f91240589 -p31-1-1.x86_64@system
+rule pkg 1a2cacd12b5dcbbd4461fae150e405cb  p52-2-1.x86_64@available
+rule pkg 1a2cacd12b5dcbbd4461fae150e405cb -p45-2-1.x86_64@available
+rule pkg 1aff4a82fac32c79dda9c5db25de4f86  p96-2-1.x86_64@available
+rule pkg 1aff4a82fac32c79dda9c5db25de4f86 -p95-2-1.x86_64@available
+rule pkg 1b1edd12fd450730b62128cdd0bf0fe2  p111-1-1.x86_64@system
+rule pkg 1b1edd12fd450730b62128cdd0bf0fe2  p111-2-1.x86_64@available
+rule pkg 1b1edd12fd450730b62128cdd0bf0fe2 -p110-1-1.x86_64@system
+rule pkg 1b79c79b35a45b16e1b593902fa8641d  p12-2-1.x86_64@available
+rule pkg 1b79c79b35a45b16e1b593902fa8641d -p5-2-1.x86_64@available
+rule pkg 1bd4453316c77580d17c00ca0b2ad5ec -p41-2-1.x86_64@available
+rule pkg 1bd4453316c77580d17c00ca0b2ad5ec -p44-1-1.x86_64@system
+rule pkg 1c7bbacdba435a10fc00afff2a36b740 -p48-1-1.x86_64@system
+rule pkg 1c7bbacdba435a10fc00afff2a36b740 -p48-2-1.x86_64@available
+rule pkg 1c807779bd595383f27b806acc02279a  p25-1-1.x86_64@system
+rule pkg 1c807779bd595383f27b806acc02279a  p25-2-1.x86_64@available
+rule pkg 1c807779bd595383f27b806acc02279a -p24-1-1.x86_64@system
+rule pkg 1cd1ddbb5d7ae6028eeee49ccdb0c291 -p15-1-1.x86_64@system
+rule pkg 1cd1ddbb5d7ae6028eeee49ccdb0c291 -p15-2-1.x86_64@available
+rule pkg 1ceb993af394dee4b87150e0f63e011f  p130-2-1.x86_64@available
+rule pkg 1ceb993af394dee4b87150e0f63e011f -p123-2-1.x86_64@available
+rule pkg 1cffc6d2c894c1f711bc33951a642b49 -p141-1-1.x86_64@system
+rule pkg 1cffc6d2c894c1f711bc33951a642b49 -p141-2-1.x86_64@available
+rule pkg 1d9ee575523218e79721edf0c9484845 -p16-1-1.x86_64@system
+rule pkg 1d9ee575523218e79721edf0c9484845 -p16-2-1.x86_64@available
+rule pkg 1db3dbbf8ae3f02a8a5bc7f8a22f9345  p14-2-1.x86_64@available
+rule pkg 1db3dbbf8ae3f02a8a5bc7f8a22f9345 -p13-2-1.x86_64@available
+rule pkg 1dcd8a49e48549dd5f8a24e24b194cf1  p22-2-1.x86_64@available
+rule pkg 1dcd8a49e48549dd5f8a24e24b194cf1 -p15-2-1.x86_64@available
+rule pkg 1ecb6600698987004f4345f940fca3d0  p118-1-1.x86_64@system
+rule pkg 1ecb6600698987004f4345f940fca3d0  p118-2-1.x86_64@available
+rule pkg 1ecb6600698987004f4345f940fca3d0 -p117-1-1.x86_64@system
+rule pkg 1ece5d9b4b790559674bdcef373c082b -p36-1-1.x86_64@system
+rule pkg 1ece5d9b4b790559674bdcef373c082b -p36-2-1.x86_64@available
+rule pkg 1ee3a525369e4648b77faa0d6684e626  p57-2-1.x86_64@available
+rule pkg 1ee3a525369e4648b77faa0d6684e626 -p50-2-1.x86_64@available
+rule pkg 1eee62400ad4464f76b470e0a5990fb3  p47-2-1.x86_64@available
+rule pkg 1eee62400ad4464f76b470e0a5990fb3 -p46-2-1.x86_64@available
+rule pkg 1f5ffe644566ac9ddbb616254263dd73  p27-2-1.x86_64@available
+rule pkg 1f5ffe644566ac9ddbb616254263dd73 -p20-2-1.x86_64@available
+rule pkg 1f68a9380095ab651874d6e274281a02  p22-1-1.x86_64@system
+rule pkg 1f68a9380095ab651874d6e274281a02  p22-2-1.x86_64@available
+rule pkg 1f68a9380095ab651874d6e274281a02 -p21-1-1.x86_64@system
+rule pkg 1fc9ebdaafb067d04df8010e65ab42fc  p34-2-1.x86_64@available
+rule pkg 1fc9ebdaafb067d04df8010e65ab42fc -p27-2-1.x86_64@available
+rule pkg 1ffe2108c18b970c71ae727d4a73b7eb  p115-2-1.x86_64@available
+rule pkg 1ffe2108c18b970c71ae727d4a73b7eb -p108-2-1.x86_64@available
+rule pkg 202fa883ae85818527824fd5829f74f2 -p78-2-1.x86_64@available
+rule pkg 202fa883ae85818527824fd5829f74f2 -p81-1-1.x86_64@system
+rule pkg 20365a2885eb1e0cc3980a811f7968d4  p95-2-1.x86_64@available
+rule pkg 20365a2885eb1e0cc3980a811f7968d4 -p88-2-1.x86_64@available
+rule pkg 20700c5ee8fded740eca58b3d6772a1a  p75-2-1.x86_64@available
+rule pkg 20700c5ee8fded740eca58b3d6772a1a -p68-2-1.x86_64@available
+rule pkg 2127ef7d76c72de865fc8888c89bdfaa  p64-2-1.x86_64@available
+rule pkg 2127ef7d76c72de865fc8888c89bdfaa -p63-2-1.x86_64@available
+rule pkg 214f722131bb8799ed92d9a753396edd -p85-1-1.x86_64@system
+rule pkg 214f722131bb8799ed92d9a753396edd -p85-2-1.x86_64@available
+rule pkg 221e63039075e4a017fa919e0ca9a45f -old65-1-1.x86_64@available
+rule pkg 221e63039075e4a017fa919e0ca9a45f -p65-2-1.x86_64@available
+rule pkg 2235067f4cd134e5a6290af28dbf8aa1  p130-1-1.x86_64@system
+rule pkg 2235067f4cd134e5a6290af28dbf8aa1  p130-2-1.x86_64@available
+rule pkg 2235067f4cd134e5a6290af28dbf8aa1 -p129-1-1.x86_64@system
+rule pkg 22edbe30b7b8a877ae0e87af9b09a3c5 -p147-1-1.x86_64@system
+rule pkg 22edbe30b7b8a877ae0e87af9b09a3c5 -p147-2-1.x86_64@available
+rule pkg 23dfcf556179e09c063c1ddc9ae861cf -p118-1-1.x86_64@system
+rule pkg 23dfcf556179e09c063c1ddc9ae861cf -p118-2-1.x86_64@available
+rule pkg 243617414b896ce0cecc0ffcf3c3639a -p131-1-1.x86_64@system
+rule pkg 243617414b896ce0cecc0ffcf3c3639a -p131-2-1.x86_64@available
+rule pkg 24b1f02e8ba675993d5dd0f2e16361b4 -p143-2-1.x86_64@available
+rule pkg 24b1f02e8ba675993d5dd0f2e16361b4 -p146-1-1.x86_64@system
+rule pkg 24cb7152e5d3057c0c6de1e568af8064  p69-2-1.x86_64@available
+rule pkg 24cb7152e5d3057c0c6de1e568af8064 -p68-2-1.x86_64@available
+rule pkg 250a26fd36340349e8e38139ae34a406  p46-1-1.x86_64@system
+rule pkg 250a26fd36340349e8e38139ae34a406  p46-2-1.x86_64@available
+rule pkg 250a26fd36340349e8e38139ae34a406 -p45-1-1.x86_64@system
+rule pkg 253410ec62a48167d9b9e1533a14de0a -p61-1-1.x86_64@system
+rule pkg 253410ec62a48167d9b9e1533a14de0a -p61-2-1.x86_64@available
+rule pkg 255703f48a233e8225b2eff94ec14f45 -p77-2-1.x86_64@available
+rule pkg 255703f48a233e8225b2eff94ec14f45 -p80-1-1.x86_64@system
+rule pkg 2565328f4486ed5cb79ed0c61203eede -p87-1-1.x86_64@system
+rule pkg 2565328f4486ed5cb79ed0c61203eede -p87-2-1.x86_64@available
+rule pkg 257614066ad19dcac615fb1884b53516  p128-2-1.x86_64@available
+rule pkg 257614066ad19dcac615fb1884b53516 -p127-2-1.x86_64@available
+rule pkg 257e13d43f1fbc673305c33d422f417b  p31-2-1.x86_64@available
+rule pkg 257e13d43f1fbc673305c33d422f417b -p24-2-1.x86_64@available
+rule pkg 261b0e895ee0d8469a675354f999aee3 -p19-1-1.x86_64@system
+rule pkg 261b0e895ee0d8469a675354f999aee3 -p19-2-1.x86_64@available
+rule pkg 263c1858a4535e78ed00dec8afcb078f  p36-1-1.x86_64@system
+rule pkg 263c1858a4535e78ed00dec8afcb078f  p36-2-1.x86_64@available
+rule pkg 263c1858a4535e78ed00dec8afcb078f -p35-1-1.x86_64@system
+rule pkg 2781128c8f5f60d2f708d955cbfa61b9 -p58-2-1.x86_64@available
+rule pkg 2781128c8f5f60d2f708d955cbfa61b9 -p61-1-1.x86_64@system
+rule pkg 280d81840145f76ca47a97b558d23ac1  p5-2-1.x86_64@available
+rule pkg 280d81840145f76ca47a97b558d23ac1 -p4-2-1.x86_64@available
+rule pkg 2830dd0bcae600b7aa6cea8b6035c415 -p136-2-1.x86_64@available
+rule pkg 2830dd0bcae600b7aa6cea8b6035c415 -p139-1-1.x86_64@system
+rule pkg 28b53d851da38d823f10714fe9f72e3b  p128-1-1.x86_64@system
+rule pkg 28b53d851da38d823f10714fe9f72e3b  p128-2-1.x86_64@available
+rule pkg 28b53d851da38d823f10714fe9f72e3b -p127-1-1.x86_64@system
+rule pkg 2a121cafb366eec14440b47ee1f1efaa  p7-2-1.x86_64@available
+rule pkg 2a121cafb366eec14440b47ee1f1efaa -p6-2-1.x86_64@available
+rule pkg 2a640d023b2f00c51caf15764d6430d8  p18-2-1.x86_64@available
+rule pkg 2a640d023b2f00c51caf15764d6430d8 -p17-2-1.x86_64@available
+rule pkg 2aa857371795284ec0ed478650891964  p141-1-1.x86_64@system
+rule pkg 2aa857371795284ec0ed478650891964  p141-2-1.x86_64@available
+rule pkg 2aa857371795284ec0ed478650891964 -p140-1-1.x86_64@system
+rule pkg 2ae5d13d39d364d7e13c6c7174027dd1  p139-2-1.x86_64@available
+rule pkg 2ae5d13d39d364d7e13c6c7174027dd1 -p132-2-1.x86_64@available
+rule pkg 2afc05b5ae2d772169cbee0aa8285f87 -p20-2-1.x86_64@available
+rule pkg 2afc05b5ae2d772169cbee0aa8285f87 -p23-1-1.x86_64@system
+rule pkg 2b182e9522e22e9a3e7b3d737ca9602c -p18-1-1.x86_64@system
+rule pkg 2b182e9522e22e9a3e7b3d737ca9602c -p18-2-1.x86_64@available
+rule pkg 2b379ddba26a5bde28da266c909be829  p3-2-1.x86_64@available
+rule pkg 2b379ddba26a5bde28da266c909be829 -p146-2-1.x86_64@available
+rule pkg 2be8251f18afeaac3dc9be4f1daad5cf  p121-1-1.x86_64@system
+rule pkg 2be8251f18afeaac3dc9be4f1daad5cf  p121-2-1.x86_64@available
+rule pkg 2be8251f18afeaac3dc9be4f1daad5cf -p120-1-1.x86_64@system
+rule pkg 2c5a73319e162d2df5489a34bbd727d5  p101-2-1.x86_64@available
+rule pkg 2c5a73319e162d2df5489a34bbd727d5 -p94-2-1.x86_64@available
+rule pkg 2ca19c54a407f23a31d0f501e2d06cb2 -old145-1-1.x86_64@available
+rule pkg 2ca19c54a407f23a31d0f501e2d06cb2 -p145-2-1.x86_64@available
+rule pkg 2cbbe426aa04b66e5cd7957368565893  p106-2-1.x86_64@available
+rule pkg 2cbbe426aa04b66e5cd7957368565893 -p99-2-1.x86_64@available
+rule pkg 2cd3be42ec4bc8de1eed45c24750ea6b  p94-1-1.x86_64@system
+rule pkg 2cd3be42ec4bc8de1eed45c24750ea6b  p94-2-1.x86_64@available
+rule pkg 2cd3be42ec4bc8de1eed45c24750ea6b -p93-1-1.x86_64@system
+rule pkg 2ce6b938bf2264194ede48e06a40631e  p48-2-1.x86_64@available
+rule pkg 2ce6b938bf2264194ede48e06a40631e -p47-2-1.x86_64@available
+rule pkg 2d1adc1e7997c735b268de56268a897d  p3-1-1.x86_64@system
+rule pkg 2d1adc1e7997c735b268de56268a897d  p3-2-1.x86_64@available
+rule pkg 2d1adc1e7997c735b268de56268a897d -p2-1-1.x86_64@system
+rule pkg 2d284501846726e4ce21ce6108cda276  p52-1-1.x86_64@system
+rule pkg 2d284501846726e4ce21ce6108cda276  p52-2-1.x86_64@available
+rule pkg 2d284501846726e4ce21ce6108cda276 -p51-1-1.x86_64@system
+rule pkg 2e1515960e178e62e417acf878ad1b43 -p0-1-1.x86_64@system
+rule pkg 2e1515960e178e62e417acf878ad1b43 -p147-2-1.x86_64@available
+rule pkg 2eedd5b0fe8dd8991dacc9b3c843b081  p84-1-1.x86_64@system
+rule pkg 2eedd5b0fe8dd8991dacc9b3c843b081  p84-2-1.x86_64@available
+rule pkg 2eedd5b0fe8dd8991dacc9b3c843b081 -p83-1-1.x86_64@system
+rule pkg 2f0cd74dde43cfb772d61ac27cf2bc50 -p0-2-1.x86_64@available
+rule pkg 2f0cd74dde43cfb772d61ac27cf2bc50 -p3-1-1.x86_64@system
+rule pkg 2f498cffe87129d33c70436f6ef24ec1 -p130-1-1.x86_64@system
+rule pkg 2f498cffe87129d33c70436f6ef24ec1 -p130-2-1.x86_64@available
+rule pkg 2fb341cea90c3421614a1d6efa2c0cb9  p44-2-1.x86_64@available
+rule pkg 2fb341cea90c3421614a1d6efa2c0cb9 -p43-2-1.x86_64@available
+rule pkg 308bfd868ce34c9570c7fc343d6e9823 -p138-1-1.x86_64@system
+rule pkg 308bfd868ce34c9570c7fc343d6e9823 -p138-2-1.x86_64@available
+rule pkg 30900788b7392a278973566ecafa2283  p76-1-1.x86_64@system
+rule pkg 30900788b7392a278973566ecafa2283  p76-2-1.x86_64@available
+rule pkg 30900788b7392a278973566ecafa2283 -p75-1-1.x86_64@system
+rule pkg 30e124ff82a36cf6854a28bca026cc19  p83-1-1.x86_64@system
+rule pkg 30e124ff82a36cf6854a28bca026cc19  p83-2-1.x86_64@available
+rule pkg 30e124ff82a36cf6854a28bca026cc19 -p82-1-1.x86_64@system
+rule pkg 30e8250b4bccec249747700cc0f9de74  p117-2-1.x86_64@available
+rule pkg 30e8250b4bccec249747700cc0f9de74 -p116-2-1.x86_64@available
+rule pkg 3266f0e2f5d7322f6b01ae9341e21c58 -p2-2-1.x86_64@available
+rule pkg 3266f0e2f5d7322f6b01ae9341e21c58 -p5-1-1.x86_64@system
+rule pkg 3271390bf9dfd635f92de2caae3ec5dc -p40-1-1.x86_64@system
+rule pkg 3271390bf9dfd635f92de2caae3ec5dc -p40-2-1.x86_64@available
+rule pkg 32ed68372cb24089033d09eb1c1fb922 -p31-1-1.x86_64@system
+rule pkg 32ed68372cb24089033d09eb1c1fb922 -p31-2-1.x86_64@available
+rule pkg 32f71344adb87bed0845bf4b542525b3  p133-1-1.x86_64@system
+rule pkg 32f71344adb87bed0845bf4b542525b3  p133-2-1.x86_64@available
+rule pkg 32f71344adb87bed0845bf4b542525b3 -p132-1-1.x86_64@system
+rule pkg 332a388ec12bd5ce801004368ce6a0e1  p137-1-1.x86_64@system
+rule pkg 332a388ec12bd5ce801004368ce6a0e1  p137-2-1.x86_64@available
+rule pkg 332a388ec12bd5ce801004368ce6a0e1 -p136-1-1.x86_64@system
+rule pkg 338b546e6fd4e96c03267bf5ea50826e -p79-2-1.x86_64@available
+rule pkg 338b546e6fd4e96c03267bf5ea50826e -p82-1-1.x86_64@system
+rule pkg 34222e1a11222aea689e0adf0741a4b9  p23-2-1.x86_64@available
+rule pkg 34222e1a11222aea689e0adf0741a4b9 -p16-2-1.x86_64@available
+rule pkg 347574a00c1812dce3d65f53488958f0 -p72-2-1.x86_64@available
+rule pkg 347574a00c1812dce3d65f53488958f0 -p75-1-1.x86_64@system
+rule pkg 3478bca6f846a312a0f8143e07a45b60 -p120-2-1.x86_64@available
+rule pkg 3478bca6f846a312a0f8143e07a45b60 -p123-1-1.x86_64@system
+rule pkg 34e91717d12838c5a078eb8fb7286b81  p26-1-1.x86_64@system
+rule pkg 34e91717d12838c5a078eb8fb7286b81  p26-2-1.x86_64@available
+rule pkg 34e91717d12838c5a078eb8fb7286b81 -p25-1-1.x86_64@system
+rule pkg 34f90ccf12b8cec47dbb8bab5162d106  p108-2-1.x86_64@available
+rule pkg 34f90ccf12b8cec47dbb8bab5162d106 -p107-2-1.x86_64@available
+rule pkg 352a227ba9a1d0abab8f12c7afb24a6f -p43-2-1.x86_64@available
+rule pkg 352a227ba9a1d0abab8f12c7afb24a6f -p46-1-1.x86_64@system
+rule pkg 353952ae613ad8532b5068ab48aadc7b  p82-2-1.x86_64@available
+rule pkg 353952ae613ad8532b5068ab48aadc7b -p81-2-1.x86_64@available
+rule pkg 35a141eb5ff504d1562351db016e2e0a -p87-2-1.x86_64@available
+rule pkg 35a141eb5ff504d1562351db016e2e0a -p90-1-1.x86_64@system
+rule pkg 35dc230f4f72106f80005533fbe465a1 -p88-2-1.x86_64@available
+rule pkg 35dc230f4f72106f80005533fbe465a1 -p91-1-1.x86_64@system
+rule pkg 362c6d0c26f3a49c2ba96fc347141d06  p99-1-1.x86_64@system
+rule pkg 362c6d0c26f3a49c2ba96fc347141d06  p99-2-1.x86_64@available
+rule pkg 362c6d0c26f3a49c2ba96fc347141d06 -p98-1-1.x86_64@system
+rule pkg 36f7f10979429c9332a63461b67cc27e -p63-1-1.x86_64@system
+rule pkg 36f7f10979429c9332a63461b67cc27e -p63-2-1.x86_64@available
+rule pkg 375d063e6042801efc5508f9d509076b  p138-1-1.x86_64@system
+rule pkg 375d063e6042801efc5508f9d509076b  p138-2-1.x86_64@available
+rule pkg 375d063e6042801efc5508f9d509076b -p137-1-1.x86_64@system
+rule pkg 377b4c242cbe44d72c09849bf712cab9 -p56-2-1.x86_64@available
+rule pkg 377b4c242cbe44d72c09849bf712cab9 -p59-1-1.x86_64@system
+rule pkg 37c68a90cf9562e974fd2f63d13801f0 -old20-1-1.x86_64@available
+rule pkg 37c68a90cf9562e974fd2f63d13801f0 -p20-2-1.x86_64@available
+rule pkg 37d27c24fb2fb1c527104af8cba178d6 -p124-1-1.x86_64@system
+rule pkg 37d27c24fb2fb1c527104af8cba178d6 -p124-2-1.x86_64@available
+rule pkg 3825aa57e98e6b757396bd8705c7e956 -p86-2-1.x86_64@available
+rule pkg 3825aa57e98e6b757396bd8705c7e956 -p89-1-1.x86_64@system
+rule pkg 387212f6f1916c7821daf0995ad4cdde  p114-1-1.x86_64@system
+rule pkg 387212f6f1916c7821daf0995ad4cdde  p114-2-1.x86_64@available
+rule pkg 387212f6f1916c7821daf0995ad4cdde -p113-1-1.x86_64@system
+rule pkg 389bfc3e0d9bbc042d44b60f0560da96 -p98-1-1.x86_64@system
+rule pkg 389bfc3e0d9bbc042d44b60f0560da96 -p98-2-1.x86_64@available
+rule pkg 38c679d2fdc27676ee18c883e7698454  p56-2-1.x86_64@available
+rule pkg 38c679d2fdc27676ee18c883e7698454 -p49-2-1.x86_64@available
+rule pkg 38e479959228d48f64924717c657bbf9  p135-1-1.x86_64@system
+rule pkg 38e479959228d48f64924717c657bbf9  p135-2-1.x86_64@available
+rule pkg 38e479959228d48f64924717c657bbf9 -p134-1-1.x86_64@system
+rule pkg 3987db94c588d50b54389556adac9e0b -p80-1-1.x86_64@system
+rule pkg 3987db94c588d50b54389556adac9e0b -p80-2-1.x86_64@available
+rule pkg 3989a5663e522bc8d7e1eb8d84e3421f  p28-2-1.x86_64@available
+rule pkg 3989a5663e522bc8d7e1eb8d84e3421f -p27-2-1.x86_64@available
+rule pkg 3a0683cff3dec3468e8850c1cd8aec39 -p108-1-1.x86_64@system
+rule pkg 3a0683cff3dec3468e8850c1cd8aec39 -p108-2-1.x86_64@available
+rule pkg 3a235bc34e586e323654bd5f1173a9cf  p86-1-1.x86_64@system
+rule pkg 3a235bc34e586e323654bd5f1173a9cf  p86-2-1.x86_64@available
+rule pkg 3a235bc34e586e323654bd5f1173a9cf -p85-1-1.x86_64@system
+rule pkg 3a2e7bddd164df5e8e53dfd012313ca4  p15-2-1.x86_64@available
+rule pkg 3a2e7bddd164df5e8e53dfd012313ca4 -p14-2-1.x86_64@available
+rule pkg 3a31327f29ccb3a1a77ddd8b87b9183f -p56-1-1.x86_64@system
+rule pkg 3a31327f29ccb3a1a77ddd8b87b9183f -p56-2-1.x86_64@available
+rule pkg 3a33c16b29521c28c096f8b908bcce75 -p106-1-1.x86_64@system
+rule pkg 3a33c16b29521c28c096f8b908bcce75 -p106-2-1.x86_64@available
+rule pkg 3b2c0138af7d6d5fbea948e94e198d38  p141-2-1.x86_64@available
+rule pkg 3b2c0138af7d6d5fbea948e94e198d38 -p140-2-1.x86_64@available
+rule pkg 3b4dcf253a410f22305226f4a7edc234  p50-2-1.x86_64@available
+rule pkg 3b4dcf253a410f22305226f4a7edc234 -p49-2-1.x86_64@available
+rule pkg 3b7ce4bc04019f68a45e3cfc341c9a94  p127-2-1.x86_64@available
+rule pkg 3b7ce4bc04019f68a45e3cfc341c9a94 -p126-2-1.x86_64@available
+rule pkg 3bc1e53b8bdc51d0237f0087483f15f7  p73-2-1.x86_64@available
+rule pkg 3bc1e53b8bdc51d0237f0087483f15f7 -p72-2-1.x86_64@available
+rule pkg 3be3b90cc98ca872afcb30c78f39b73a -p66-1-1.x86_64@system
+rule pkg 3be3b90cc98ca872afcb30c78f39b73a -p66-2-1.x86_64@available
+rule pkg 3c17c7e5a15d519810f52249b974c680  p9-1-1.x86_64@system
+rule pkg 3c17c7e5a15d519810f52249b974c680  p9-2-1.x86_64@available
+rule pkg 3c17c7e5a15d519810f52249b974c680 -p8-1-1.x86_64@system
+rule pkg 3c20e4fbd27bfdbce4256134d4693683 -p114-1-1.x86_64@system
+rule pkg 3c20e4fbd27bfdbce4256134d4693683 -p114-2-1.x86_64@available
+rule pkg 3c4735ecaec5ad38797fdc74c1510079  p23-1-1.x86_64@system
+rule pkg 3c4735ecaec5ad38797fdc74c1510079  p23-2-1.x86_64@available
+rule pkg 3c4735ecaec5ad38797fdc74c1510079 -p22-1-1.x86_64@system
+rule pkg 3c6a85b95337f75082f855efcdf89dec  p123-1-1.x86_64@system
+rule pkg 3c6a85b95337f75082f855efcdf89dec  p123-2-1.x86_64@available
+rule pkg 3c6a85b95337f75082f855efcdf89dec -p122-1-1.x86_64@system
+rule pkg 3c8867266cc2328588b05a7ddf4cd931 -p54-2-1.x86_64@available
+rule pkg 3c8867266cc2328588b05a7ddf4cd931 -p57-1-1.x86_64@system
+rule pkg 3cdab5bd1ba5fb78a24a8d61162d1ab0 -p44-1-1.x86_64@system
+rule pkg 3cdab5bd1ba5fb78a24a8d61162d1ab0 -p44-2-1.x86_64@available
+rule pkg 3d17ee256f5b789a501abda405ed5eae  p28-1-1.x86_64@system
+rule pkg 3d17ee256f5b789a501abda405ed5eae  p28-2-1.x86_64@available
+rule pkg 3d17ee256f5b789a501abda405ed5eae -p27-1-1.x86_64@system
+rule pkg 3d1fd3dea75ead4efe04644b8bb27594  p112-1-1.x86_64@system
+rule pkg 3d1fd3dea75ead4efe04644b8bb27594  p112-2-1.x86_64@available
+rule pkg 3d1fd3dea75ead4efe04644b8bb27594 -p111-1-1.x86_64@system
+rule pkg 3d2e8525bc6491a9e521c39343cb2a43  p62-2-1.x86_64@available
+rule pkg 3d2e8525bc6491a9e521c39343cb2a43 -p55-2-1.x86_64@available
+rule pkg 3d6bafad0f87a57edd398cce45451f11 -p9-1-1.x86_64@system
+rule pkg 3d6bafad0f87a57edd398cce45451f11 -p9-2-1.x86_64@available
+rule pkg 3daee481215f4be0825b4c658494cacc  p129-2-1.x86_64@available
+rule pkg 3daee481215f4be0825b4c658494cacc -p128-2-1.x86_64@available
+rule pkg 3e07c098b88e7b880df57638753aa5c3  p101-1-1.x86_64@system
+rule pkg 3e07c098b88e7b880df57638753aa5c3  p101-2-1.x86_64@available
+rule pkg 3e07c098b88e7b880df57638753aa5c3 -p100-1-1.x86_64@system
+rule pkg 3e0af7e476deee89c816daf2bd601d55 -p119-2-1.x86_64@available
+rule pkg 3e0af7e476deee89c816daf2bd601d55 -p122-1-1.x86_64@system
+rule pkg 3e1048b7f820855dbe3281fed0d233a3  p120-2-1.x86_64@available
+rule pkg 3e1048b7f820855dbe3281fed0d233a3 -p113-2-1.x86_64@available
+rule pkg 3ea139235e6d1b1891806154e00a76f9 -p50-1-1.x86_64@system
+rule pkg 3ea139235e6d1b1891806154e00a76f9 -p50-2-1.x86_64@available
+rule pkg 3f1064301da536ca67c9ad67e75b46bf  p80-1-1.x86_64@system
+rule pkg 3f1064301da536ca67c9ad67e75b46bf  p80-2-1.x86_64@available
+rule pkg 3f1064301da536ca67c9ad67e75b46bf -p79-1-1.x86_64@system
+rule pkg 3f198e69bbe694ca171654a5315e156e -p106-2-1.x86_64@available
+rule pkg 3f198e69bbe694ca171654a5315e156e -p109-1-1.x86_64@system
+rule pkg 3f77cc54f2517e6a46ffa80d268cfbf8 -p83-2-1.x86_64@available
+rule pkg 3f77cc54f2517e6a46ffa80d268cfbf8 -p86-1-1.x86_64@system
+rule pkg 3fa3f879203cfc714ab633fa9222a45b -p61-2-1.x86_64@available
+rule pkg 3fa3f879203cfc714ab633fa9222a45b -p64-1-1.x86_64@system
+rule pkg 3fb6fd86b71d259ba05f271eb3093f04  p39-2-1.x86_64@available
+rule pkg 3fb6fd86b71d259ba05f271eb3093f04 -p32-2-1.x86_64@available
+rule pkg 3febcc0ad808ac9758e4adc1c33da7f9  p96-1-1.x86_64@system
+rule pkg 3febcc0ad808ac9758e4adc1c33da7f9  p96-2-1.x86_64@available
+rule pkg 3febcc0ad808ac9758e4adc1c33da7f9 -p95-1-1.x86_64@system
+rule pkg 4098a56c553668baf121f7b44254b48b  p127-1-1.x86_64@system
+rule pkg 4098a56c553668baf121f7b44254b48b  p127-2-1.x86_64@available
+rule pkg 4098a56c553668baf121f7b44254b48b -p126-1-1.x86_64@system
+rule pkg 40ad86ff9bf5d5870b23a1d179aa2e09 -p35-2-1.x86_64@available
+rule pkg 40ad86ff9bf5d5870b23a1d179aa2e09 -p38-1-1.x86_64@system
+rule pkg 411ec10108bef642be688b0e4ade01d1  p34-1-1.x86_64@system
+rule pkg 411ec10108bef642be688b0e4ade01d1  p34-2-1.x86_64@available
+rule pkg 411ec10108bef642be688b0e4ade01d1 -p33-1-1.x86_64@system
+rule pkg 41c3a14548c0c3484955c7da94c7b1c7  p57-2-1.x86_64@available
+rule pkg 41c3a14548c0c3484955c7da94c7b1c7 -p56-2-1.x86_64@available
+rule pkg 4208f032b71bd98c84bceb73ee381367  p97-2-1.x86_64@available
+rule pkg 4208f032b71bd98c84bceb73ee381367 -p96-2-1.x86_64@available
+rule pkg 424111c454c4c5044883b124e8b68533 -p149-2-1.x86_64@available
+rule pkg 424111c454c4c5044883b124e8b68533 -p2-1-1.x86_64@system
+rule pkg 4295d635b10625f39c11738b86268208  p60-1-1.x86_64@system
+rule pkg 4295d635b10625f39c11738b86268208  p60-2-1.x86_64@available
+rule pkg 4295d635b10625f39c11738b86268208 -p59-1-1.x86_64@system
+rule pkg 4297249a0134748d512c55086001929f  p42-2-1.x86_64@available
+rule pkg 4297249a0134748d512c55086001929f -p35-2-1.x86_64@available
+rule pkg 43483f84638b15579af3cc8975c384fb  p98-2-1.x86_64@available
+rule pkg 43483f84638b15579af3cc8975c384fb -p91-2-1.x86_64@available
+rule pkg 4376ffd4e3ae2a9e6533a9b24efd8584  p17-2-1.x86_64@available
+rule pkg 4376ffd4e3ae2a9e6533a9b24efd8584 -p16-2-1.x86_64@available
+rule pkg 43cd2c7e2ba9ac05a35935821ca20677  p6-1-1.x86_64@system
+rule pkg 43cd2c7e2ba9ac05a35935821ca20677  p6-2-1.x86_64@available
+rule pkg 43cd2c7e2ba9ac05a35935821ca20677 -p5-1-1.x86_64@system
+rule pkg 43d3fecdfb603023a490c9bd5d4a4069 -p57-1-1.x86_64@system
+rule pkg 43d3fecdfb603023a490c9bd5d4a4069 -p57-2-1.x86_64@available
+rule pkg 43f5b66ab8e51820ad53119de06ea034  p94-2-1.x86_64@available
+rule pkg 43f5b66ab8e51820ad53119de06ea034 -p87-2-1.x86_64@available
+rule pkg 44131c061aa8a6e2e06bc53896fab545 -old50-1-1.x86_64@available
+rule pkg 44131c061aa8a6e2e06bc53896fab545 -p50-2-1.x86_64@available
+rule pkg 442e8c208de5234fecd986c7510326c0  p14-1-1.x86_64@system
+rule pkg 442e8c208de5234fecd986c7510326c0  p14-2-1.x86_64@available
+rule pkg 442e8c208de5234fecd986c7510326c0 -p13-1-1.x86_64@system
+rule pkg 4504bf3c4147ac586bad83e42814923a  p102-2-1.x86_64@available
+rule pkg 4504bf3c4147ac586bad83e42814923a -p101-2-1.x86_64@available
+rule pkg 45bf670b7d4c8b35923b52a64d0469fc -p78-1-1.x86_64@system
+rule pkg 45bf670b7d4c8b35923b52a64d0469fc -p78-2-1.x86_64@available
+rule pkg 461002143ac64ff66d7ea86cf4a3975f  p128-2-1.x86_64@available
+rule pkg 461002143ac64ff66d7ea86cf4a3975f -p121-2-1.x86_64@available
+rule pkg 465410b269125f29eaa76b145ccbee05 -p141-2-1.x86_64@available
+rule pkg 465410b269125f29eaa76b145ccbee05 -p144-1-1.x86_64@system
+rule pkg 46f7cf5306fbf8191da8d9370cbe74b4 -p51-1-1.x86_64@system
+rule pkg 46f7cf5306fbf8191da8d9370cbe74b4 -p51-2-1.x86_64@available
+rule pkg 473c41c678bdcd88052cc76457406fcf  p111-2-1.x86_64@available
+rule pkg 473c41c678bdcd88052cc76457406fcf -p104-2-1.x86_64@available
+rule pkg 47bb1fd0265da454ccdbdaa210315b9a -p29-2-1.x86_64@available
+rule pkg 47bb1fd0265da454ccdbdaa210315b9a -p32-1-1.x86_64@system
+rule pkg 47f9b54c64d0c7f00e9c0302bfbecd82  p12-1-1.x86_64@system
+rule pkg 47f9b54c64d0c7f00e9c0302bfbecd82  p12-2-1.x86_64@available
+rule pkg 47f9b54c64d0c7f00e9c0302bfbecd82 -p11-1-1.x86_64@system
+rule pkg 485e8975e63e960a15f78de8dad97a0d  p54-2-1.x86_64@available
+rule pkg 485e8975e63e960a15f78de8dad97a0d -p47-2-1.x86_64@available
+rule pkg 487b75672eec9fef216f42b7d20e2826  p123-2-1.x86_64@available
+rule pkg 487b75672eec9fef216f42b7d20e2826 -p122-2-1.x86_64@available
+rule pkg 48b44c463fe2f325dd55dfa2320cbe98 -p57-2-1.x86_64@available
+rule pkg 48b44c463fe2f325dd55dfa2320cbe98 -p60-1-1.x86_64@system
+rule pkg 48c4cb0a8fe5f36545059daacc50edd9  p8-2-1.x86_64@available
+rule pkg 48c4cb0a8fe5f36545059daacc50edd9 -p7-2-1.x86_64@available
+rule pkg 49642baa329e3b2eb38d46b7b3d8bbe5  p65-1-1.x86_64@system
+rule pkg 49642baa329e3b2eb38d46b7b3d8bbe5  p65-2-1.x86_64@available
+rule pkg 49642baa329e3b2eb38d46b7b3d8bbe5 -p64-1-1.x86_64@system
+rule pkg 4985577db91f863a3cb697b51f71a083  p63-1-1.x86_64@system
+rule pkg 4985577db91f863a3cb697b51f71a083  p63-2-1.x86_64@available
+rule pkg 4985577db91f863a3cb697b51f71a083 -p62-1-1.x86_64@system
+rule pkg 4a41ecda5df27665c18ddaebfa7945e3 -p97-1-1.x86_64@system
+rule pkg 4a41ecda5df27665c18ddaebfa7945e3 -p97-2-1.x86_64@available
+rule pkg 4a95e2c5964f3f7a4dcdc948a6971101  p135-2-1.x86_64@available
+rule pkg 4a95e2c5964f3f7a4dcdc948a6971101 -p134-2-1.x86_64@available
+rule pkg 4b5f83eec0531ffd8e67a868a5ca54d4 -p74-2-1.x86_64@available
+rule pkg 4b5f83eec0531ffd8e67a868a5ca54d4 -p77-1-1.x86_64@system
+rule pkg 4b873c26346dc156fdd0a03c1817691a  p85-2-1.x86_64@available
+rule pkg 4b873c26346dc156fdd0a03c1817691a -p84-2-1.x86_64@available
+rule pkg 4bb13bb81c01cf55e427b72d68157c6d  p138-2-1.x86_64@available
+rule pkg 4bb13bb81c01cf55e427b72d68157c6d -p131-2-1.x86_64@available
+rule pkg 4c37487bb4014a9d2cdbb86b7232841f -p22-1-1.x86_64@system
+rule pkg 4c37487bb4014a9d2cdbb86b7232841f -p22-2-1.x86_64@available
+rule pkg 4cc3a8d78c8042f66a0aa802ba79e846  p123-2-1.x86_64@available
+rule pkg 4cc3a8d78c8042f66a0aa802ba79e846 -p116-2-1.x86_64@available
+rule pkg 4defe7ba6aa35198bb97d3e301691b45  p9-2-1.x86_64@available
+rule pkg 4defe7ba6aa35198bb97d3e301691b45 -p8-2-1.x86_64@available
+rule pkg 4e7d67bcb627b11137b39f604c4da6b4 -p113-1-1.x86_64@system
+rule pkg 4e7d67bcb627b11137b39f604c4da6b4 -p113-2-1.x86_64@available
+rule pkg 4e93671485bc0cc28cbb120affd8df75 -old140-1-1.x86_64@available
+rule pkg 4e93671485bc0cc28cbb120affd8df75 -p140-2-1.x86_64@available
+rule pkg 4ed8ddcb9e8fb1a9a0bc3440bcd7f516 -p79-1-1.x86_64@system
+rule pkg 4ed8ddcb9e8fb1a9a0bc3440bcd7f516 -p79-2-1.x86_64@available
+rule pkg 4f3087480aa615e1430d2a20d1f5836c  p45-2-1.x86_64@available
+rule pkg 4f3087480aa615e1430d2a20d1f5836c -p44-2-1.x86_64@available
+rule pkg 4f8000918c87f79db2fb5d46d4f29a08  p44-1-1.x86_64@system
+rule pkg 4f8000918c87f79db2fb5d46d4f29a08  p44-2-1.x86_64@available
+rule pkg 4f8000918c87f79db2fb5d46d4f29a08 -p43-1-1.x86_64@system
+rule pkg 4f8b6cb23e8266046a192ea09cd3ae9d -p54-1-1.x86_64@system
+rule pkg 4f8b6cb23e8266046a192ea09cd3ae9d -p54-2-1.x86_64@available
+rule pkg 4fa35f155a5e43e22d3053865b19f900  p50-2-1.x86_64@available
+rule pkg 4fa35f155a5e43e22d3053865b19f900 -p43-2-1.x86_64@available
+rule pkg 4ff346fb73b58a80d2777564f2982ea9 -p41-1-1.x86_64@system
+rule pkg 4ff346fb73b58a80d2777564f2982ea9 -p41-2-1.x86_64@available
+rule pkg 503c1cc8620e4e8aea75752541969e9e -p14-1-1.x86_64@system
+rule pkg 503c1cc8620e4e8aea75752541969e9e -p14-2-1.x86_64@available
+rule pkg 50b59dd29b5ba797e8f9e77d559dadd2 -p136-1-1.x86_64@system
+rule pkg 50b59dd29b5ba797e8f9e77d559dadd2 -p136-2-1.x86_64@available
+rule pkg 51ac691a7e63b695f30c80fe38d77985  p126-1-1.x86_64@system
+rule pkg 51ac691a7e63b695f30c80fe38d77985  p126-2-1.x86_64@available
+rule pkg 51ac691a7e63b695f30c80fe38d77985 -p125-1-1.x86_64@system
+rule pkg 52aa8cea06b8281076cf40d041720157 -p13-1-1.x86_64@system
+rule pkg 52aa8cea06b8281076cf40d041720157 -p13-2-1.x86_64@available
+rule pkg 532634ebc8814eca0f02726eef9a9d08  p136-2-1.x86_64@available
+rule pkg 532634ebc8814eca0f02726eef9a9d08 -p129-2-1.x86_64@available
+rule pkg 5329d732dbbf40f0d92e9c195124ddeb  p44-2-1.x86_64@available
+rule pkg 5329d732dbbf40f0d92e9c195124ddeb -p37-2-1.x86_64@available
+rule pkg 5341eb26469276a20446377148c27c5b -p25-1-1.x86_64@system
+rule pkg 5341eb26469276a20446377148c27c5b -p25-2-1.x86_64@available
+rule pkg 5382c773e7d769d6c02632682c709f7b -p62-2-1.x86_64@available
+rule pkg 5382c773e7d769d6c02632682c709f7b -p65-1-1.x86_64@system
+rule pkg 53a39e322fccbb2ae1ee718de6a02182 -old85-1-1.x86_64@available
+rule pkg 53a39e322fccbb2ae1ee718de6a02182 -p85-2-1.x86_64@available
+rule pkg 53afbc29b20c98d79b3ca39261143e11 -p130-2-1.x86_64@available
+rule pkg 53afbc29b20c98d79b3ca39261143e11 -p133-1-1.x86_64@system
+rule pkg 541f2b07263427206398e238837a7434  p54-2-1.x86_64@available
+rule pkg 541f2b07263427206398e238837a7434 -p53-2-1.x86_64@available
+rule pkg 5438f79b2265ea3790bdc18972602aa6  p139-2-1.x86_64@available
+rule pkg 5438f79b2265ea3790bdc18972602aa6 -p138-2-1.x86_64@available
+rule pkg 54702cb29c7a8b3e46f6d41504566df9 -p115-2-1.x86_64@available
+rule pkg 54702cb29c7a8b3e46f6d41504566df9 -p118-1-1.x86_64@system
+rule pkg 547d58ec896f3ff1bf331a680ebf1594  p81-2-1.x86_64@available
+rule pkg 547d58ec896f3ff1bf331a680ebf1594 -p74-2-1.x86_64@available
+rule pkg 56051a44c01b80dfa29c93a669baae7f  p20-1-1.x86_64@system
+rule pkg 56051a44c01b80dfa29c93a669baae7f  p20-2-1.x86_64@available
+rule pkg 56051a44c01b80dfa29c93a669baae7f -p19-1-1.x86_64@system
+rule pkg 564d361bb62ffe2640fa4ce12950ad83  p90-1-1.x86_64@system
+rule pkg 564d361bb62ffe2640fa4ce12950ad83  p90-2-1.x86_64@available
+rule pkg 564d361bb62ffe2640fa4ce12950ad83 -p89-1-1.x86_64@system
+rule pkg 56d9d7999d9befcd33fe14ee00ed02de -p53-2-1.x86_64@available
+rule pkg 56d9d7999d9befcd33fe14ee00ed02de -p56-1-1.x86_64@system
+rule pkg 571170e7f3f165cdb1e197c642fe8f41  p13-2-1.x86_64@available
+rule pkg 571170e7f3f165cdb1e197c642fe8f41 -p6-2-1.x86_64@available
+rule pkg 571f7b5a0bab738b6bb4dac76cacee49 -p67-1-1.x86_64@system
+rule pkg 571f7b5a0bab738b6bb4dac76cacee49 -p67-2-1.x86_64@available
+rule pkg 57a43b3a9749560e2e666a36369adf6e  p104-2-1.x86_64@available
+rule pkg 57a43b3a9749560e2e666a36369adf6e -p103-2-1.x86_64@available
+rule pkg 57e3a47256e52a72ed8e1006c7c434df  p58-1-1.x86_64@system
+rule pkg 57e3a47256e52a72ed8e1006c7c434df  p58-2-1.x86_64@available
+rule pkg 57e3a47256e52a72ed8e1006c7c434df -p57-1-1.x86_64@system
+rule pkg 587c0b5072af0338960d09acd91849fe  p83-2-1.x86_64@available
+rule pkg 587c0b5072af0338960d09acd91849fe -p76-2-1.x86_64@available
+rule pkg 58c603d5c685baee1ba233c9a1d2116c -p39-2-1.x86_64@available
+rule pkg 58c603d5c685baee1ba233c9a1d2116c -p42-1-1.x86_64@system
+rule pkg 598995af76b3d04f0007c0bcca23504f  p122-2-1.x86_64@available
+rule pkg 598995af76b3d04f0007c0bcca23504f -p115-2-1.x86_64@available
+rule pkg 599a5b32c1af7bfbd1a96df23f8cd5fd  p86-2-1.x86_64@available
+rule pkg 599a5b32c1af7bfbd1a96df23f8cd5fd -p79-2-1.x86_64@available
+rule pkg 59dbd2c540cb81c60b49c53786345fe9  p38-2-1.x86_64@available
+rule pkg 59dbd2c540cb81c60b49c53786345fe9 -p31-2-1.x86_64@available
+rule pkg 59f9bd11d197b310eb7e170238037ad2  p43-2-1.x86_64@available
+rule pkg 59f9bd11d197b310eb7e170238037ad2 -p36-2-1.x86_64@available
+rule pkg 5a7a2e4902447e2ac4e56138ba9a6494  p125-2-1.x86_64@available
+rule pkg 5a7a2e4902447e2ac4e56138ba9a6494 -p118-2-1.x86_64@available
+rule pkg 5a7ea7d64c60071315bc1512c582a4b8  p143-2-1.x86_64@available
+rule pkg 5a7ea7d64c60071315bc1512c582a4b8 -p142-2-1.x86_64@available
+rule pkg 5b1f4d3454949baafef72485a2bef6ab  p145-2-1.x86_64@available
+rule pkg 5b1f4d3454949baafef72485a2bef6ab -p144-2-1.x86_64@available
+rule pkg 5bb903de9747b71ce9aedbeb259df8c6 -p68-2-1.x86_64@available
+rule pkg 5bb903de9747b71ce9aedbeb259df8c6 -p71-1-1.x86_64@system
+rule pkg 5c0f2f54554bdecc0e34d030f1f9b596 -p69-2-1.x86_64@available
+rule pkg 5c0f2f54554bdecc0e34d030f1f9b596 -p72-1-1.x86_64@system
+rule pkg 5c6ca98c1f9f44a9c71c453f9397b7ba  p149-2-1.x86_64@available
+rule pkg 5c6ca98c1f9f44a9c71c453f9397b7ba -p142-2-1.x86_64@available
+rule pkg 5ca0862a327b08bc139153d3f51ffa5f  p106-2-1.x86_64@available
+rule pkg 5ca0862a327b08bc139153d3f51ffa5f -p105-2-1.x86_64@available
+rule pkg 5ccb81d818ac3faea255a7f20cecbd35  p59-2-1.x86_64@available
+rule pkg 5ccb81d818ac3faea255a7f20cecbd35 -p58-2-1.x86_64@available
+rule pkg 5d5542ff30726ea72500a3135db928ed  p34-2-1.x86_64@available
+rule pkg 5d5542ff30726ea72500a3135db928ed -p33-2-1.x86_64@available
+rule pkg 5e285e2546bd393bb40ce745394e5d61  p35-1-1.x86_64@system
+rule pkg 5e285e2546bd393bb40ce745394e5d61  p35-2-1.x86_64@available
+rule pkg 5e285e2546bd393bb40ce745394e5d61 -p34-1-1.x86_64@system
+rule pkg 5e4866fe9cda329b8b349e1113471319  p76-2-1.x86_64@available
+rule pkg 5e4866fe9cda329b8b349e1113471319 -p69-2-1.x86_64@available
+rule pkg 5f878b962832d5ad9025a5340b05d421  p109-2-1.x86_64@available
+rule pkg 5f878b962832d5ad9025a5340b05d421 -p102-2-1.x86_64@available
+rule pkg 5fc479cb30f8b79dc1f49247d18a17b1  p77-2-1.x86_64@available
+rule pkg 5fc479cb30f8b79dc1f49247d18a17b1 -p70-2-1.x86_64@available
+rule pkg 604147f689a995dee9a2dfc6864e9c83 -p59-1-1.x86_64@system
+rule pkg 604147f689a995dee9a2dfc6864e9c83 -p59-2-1.x86_64@available
+rule pkg 60a158875e870b0a0bef2712714d3acc -p4-1-1.x86_64@system
+rule pkg 60a158875e870b0a0bef2712714d3acc -p4-2-1.x86_64@available
+rule pkg 60fa8e418cada3ef2bba0d7b9678ba1c -p127-2-1.x86_64@available
+rule pkg 60fa8e418cada3ef2bba0d7b9678ba1c -p130-1-1.x86_64@system
+rule pkg 614d783fcb54b812bb6c357284a83ec7 -p104-1-1.x86_64@system
+rule pkg 614d783fcb54b812bb6c357284a83ec7 -p104-2-1.x86_64@available
+rule pkg 615d2a8ef4e74df66dd11d93bb832139  p108-1-1.x86_64@system
+rule pkg 615d2a8ef4e74df66dd11d93bb832139  p108-2-1.x86_64@available
+rule pkg 615d2a8ef4e74df66dd11d93bb832139 -p107-1-1.x86_64@system
+rule pkg 61c73400340fc310666ea3870fcc8b74 -p85-2-1.x86_64@available
+rule pkg 61c73400340fc310666ea3870fcc8b74 -p88-1-1.x86_64@system
+rule pkg 6245f1cfc72c510dcbbbf64d8443debf  p37-2-1.x86_64@available
+rule pkg 6245f1cfc72c510dcbbbf64d8443debf -p36-2-1.x86_64@available
+rule pkg 62ae00c229ed77cbad50030ac65e17ab -p75-1-1.x86_64@system
+rule pkg 62ae00c229ed77cbad50030ac65e17ab -p75-2-1.x86_64@available
+rule pkg 635462b701b016cea3c9d4e5d83f58e2 -p138-2-1.x86_64@available
+rule pkg 635462b701b016cea3c9d4e5d83f58e2 -p141-1-1.x86_64@system
+rule pkg 64273dbe24b35590bbb607f111c95931  p68-1-1.x86_64@system
+rule pkg 64273dbe24b35590bbb607f111c95931  p68-2-1.x86_64@available
+rule pkg 64273dbe24b35590bbb607f111c95931 -p67-1-1.x86_64@system
+rule pkg 649a0fe4bbf2bedd55d12e8cee7c8b14  p116-2-1.x86_64@available
+rule pkg 649a0fe4bbf2bedd55d12e8cee7c8b14 -p109-2-1.x86_64@available
+rule pkg 6566292f4ee3d6eb5cbc35b94b68ceb7  p65-2-1.x86_64@available
+rule pkg 6566292f4ee3d6eb5cbc35b94b68ceb7 -p64-2-1.x86_64@available
+rule pkg 65a2f721a399bc80d9b9f00b2a72058e -p102-2-1.x86_64@available
+rule pkg 65a2f721a399bc80d9b9f00b2a72058e -p105-1-1.x86_64@system
+rule pkg 65e83d6967a5b32eb329cb57da994a7e  p103-2-1.x86_64@available
+rule pkg 65e83d6967a5b32eb329cb57da994a7e -p96-2-1.x86_64@available
+rule pkg 663c59c32e484fda8dd7ddaa32e03bc0  p67-2-1.x86_64@available
+rule pkg 663c59c32e484fda8dd7ddaa32e03bc0 -p66-2-1.x86_64@available
+rule pkg 6676af050f4c5bdfffa4090807cc3062 -p139-2-1.x86_64@available
+rule pkg 6676af050f4c5bdfffa4090807cc3062 -p142-1-1.x86_64@system
+rule pkg 66b3dd6fe66c157d6a1d50ae5400304b  p11-1-1.x86_64@system
+rule pkg 66b3dd6fe66c157d6a1d50ae5400304b  p11-2-1.x86_64@available
+rule pkg 66b3dd6fe66c157d6a1d50ae5400304b -p10-1-1.x86_64@system
+rule pkg 66c11a21fa36d2290640858c1d4f706a -old30-1-1.x86_64@available
+rule pkg 66c11a21fa36d2290640858c1d4f706a -p30-2-1.x86_64@available
+rule pkg 66f6d0d7c57db39ae21349773b75bb4b  p114-2-1.x86_64@available
+rule pkg 66f6d0d7c57db39ae21349773b75bb4b -p107-2-1.x86_64@available
+rule pkg 67ca236acfdb2a73aa0b53785fa9cce8  p63-2-1.x86_64@available
+rule pkg 67ca236acfdb2a73aa0b53785fa9cce8 -p62-2-1.x86_64@available
+rule pkg 6898da80c91339148fe87249b3353025  p136-1-1.x86_64@system
+rule pkg 6898da80c91339148fe87249b3353025  p136-2-1.x86_64@available
+rule pkg 6898da80c91339148fe87249b3353025 -p135-1-1.x86_64@system
+rule pkg 68a2d73068919740ac64a23abb202586  p105-1-1.x86_64@system
+rule pkg 68a2d73068919740ac64a23abb202586  p105-2-1.x86_64@available
+rule pkg 68a2d73068919740ac64a23abb202586 -p104-1-1.x86_64@system
+rule pkg 68cb9531234f8ff69839ce149594316e  p27-1-1.x86_64@system
+rule pkg 68cb9531234f8ff69839ce149594316e  p27-2-1.x86_64@available
+rule pkg 68cb9531234f8ff69839ce149594316e -p26-1-1.x86_64@system
+rule pkg 68da95b8b02166d5974ce2f79e9ab85c -p131-2-1.x86_64@available
+rule pkg 68da95b8b02166d5974ce2f79e9ab85c -p134-1-1.x86_64@system
+rule pkg 692269b02fca4f2fa7e5fee6339f5eda  p78-2-1.x86_64@available
+rule pkg 692269b02fca4f2fa7e5fee6339f5eda -p71-2-1.x86_64@available
+rule pkg 69ee08d4995ae5812099e26ea2900645  p47-1-1.x86_64@system
+rule pkg 69ee08d4995ae5812099e26ea2900645  p47-2-1.x86_64@available
+rule pkg 69ee08d4995ae5812099e26ea2900645 -p46-1-1.x86_64@system
+rule pkg 6aab88022a60fc380977163d9cf93a09 -p14-2-1.x86_64@available
+rule pkg 6aab88022a60fc380977163d9cf93a09 -p17-1-1.x86_64@system
+rule pkg 6adf17edd6f91ba34e6368fd8a9386f4 -p66-2-1.x86_64@available
+rule pkg 6adf17edd6f91ba34e6368fd8a9386f4 -p69-1-1.x86_64@system
+rule pkg 6b0efc9274c082d0c7afaeb65e04c9b2  p27-2-1.x86_64@available
+rule pkg 6b0efc9274c082d0c7afaeb65e04c9b2 -p26-2-1.x86_64@available
+rule pkg 6b3922a49c3c1f8524ad9253541d175c  p9-2-1.x86_64@available
+rule pkg 6b3922a49c3c1f8524ad9253541d175c -p2-2-1.x86_64@available
+rule pkg 6b96bff14fb3c423a2343a279ad380c9  p61-1-1.x86_64@system
+rule pkg 6b96bff14fb3c423a2343a279ad380c9  p61-2-1.x86_64@available
+rule pkg 6b96bff14fb3c423a2343a279ad380c9 -p60-1-1.x86_64@system
+rule pkg 6bd5fd552d5cecb72c8afb5720bbf7cc -old110-1-1.x86_64@available
+rule pkg 6bd5fd552d5cecb72c8afb5720bbf7cc -p110-2-1.x86_64@available
+rule pkg 6bfdcd80066e68ee170402b04f7fa021 -p84-2-1.x86_64@available
+rule pkg 6bfdcd80066e68ee170402b04f7fa021 -p87-1-1.x86_64@system
+rule pkg 6ce1e18cb4544a7057670c23150b258d  p110-2-1.x86_64@available
+rule pkg 6ce1e18cb4544a7057670c23150b258d -p109-2-1.x86_64@available
+rule pkg 6d035ca836974d815a3a58c95999c1b7 -old10-1-1.x86_64@available
+rule pkg 6d035ca836974d815a3a58c95999c1b7 -p10-2-1.x86_64@available
+rule pkg 6d462d1bd647296a98d427e69766cfa0  p111-2-1.x86_64@available
+rule pkg 6d462d1bd647296a98d427e69766cfa0 -p110-2-1.x86_64@available
+rule pkg 6d4e2dc5c29ba132556cad2761951a2d -p55-1-1.x86_64@system
+rule pkg 6d4e2dc5c29ba132556cad2761951a2d -p55-2-1.x86_64@available
+rule pkg 6d648af3ab08ea22eec806c53b68d01b -p76-2-1.x86_64@available
+rule pkg 6d648af3ab08ea22eec806c53b68d01b -p79-1-1.x86_64@system
+rule pkg 6e189503fd8145c0cbeb6485792bf3ff  p43-2-1.x86_64@available
+rule pkg 6e189503fd8145c0cbeb6485792bf3ff -p42-2-1.x86_64@available
+rule pkg 6ede35d7e50f8fddfebf6177cb729094 -p110-2-1.x86_64@available
+rule pkg 6ede35d7e50f8fddfebf6177cb729094 -p113-1-1.x86_64@system
+rule pkg 6ef1bbaf7677d45ddb2ae6298e4b8bfa -p49-2-1.x86_64@available
+rule pkg 6ef1bbaf7677d45ddb2ae6298e4b8bfa -p52-1-1.x86_64@system
+rule pkg 6f362713f554e24e7a4faf3d3b0b9e38 -p7-1-1.x86_64@system
+rule pkg 6f362713f554e24e7a4faf3d3b0b9e38 -p7-2-1.x86_64@available
+rule pkg 6facbe71661cf5c46b257495cbf3b237 -p1-1-1.x86_64@system
+rule pkg 6facbe71661cf5c46b257495cbf3b237 -p148-2-1.x86_64@available
+rule pkg 7055b42678893162ceeb87e73753efc5 -p90-1-1.x86_64@system
+rule pkg 7055b42678893162ceeb87e73753efc5 -p90-2-1.x86_64@available
+rule pkg 7061bf9a7b03e1014a5b34f0450ee6ee  p114-2-1.x86_64@available
+rule pkg 7061bf9a7b03e1014a5b34f0450ee6ee -p113-2-1.x86_64@available
+rule pkg 706a7484d20839213347d5e1f8818f16 -p11-2-1.x86_64@available
+rule pkg 706a7484d20839213347d5e1f8818f16 -p14-1-1.x86_64@system
+rule pkg 7108cf17ee4a52a1102cea2ee8b5257d  p116-1-1.x86_64@system
+rule pkg 7108cf17ee4a52a1102cea2ee8b5257d  p116-2-1.x86_64@available
+rule pkg 7108cf17ee4a52a1102cea2ee8b5257d -p115-1-1.x86_64@system
+rule pkg 7122d8b0d3489daa9d2b6087229b9cb4 -p125-2-1.x86_64@available
+rule pkg 7122d8b0d3489daa9d2b6087229b9cb4 -p128-1-1.x86_64@system
+rule pkg 7175978370b58a1ca13c057d58c6a13a -p94-2-1.x86_64@available
+rule pkg 7175978370b58a1ca13c057d58c6a13a -p97-1-1.x86_64@system
+rule pkg 71cb8cd4c8c195fddc547516cf4de8b0 -p11-1-1.x86_64@system
+rule pkg 71cb8cd4c8c195fddc547516cf4de8b0 -p11-2-1.x86_64@available
+rule pkg 71dd44c50c50ad7edff91a921aa8eac3  p5-1-1.x86_64@system
+rule pkg 71dd44c50c50ad7edff91a921aa8eac3  p5-2-1.x86_64@available
+rule pkg 71dd44c50c50ad7edff91a921aa8eac3 -p4-1-1.x86_64@system
+rule pkg 720f4b5206bf8e515d47c0717563cee2 -p129-2-1.x86_64@available
+rule pkg 720f4b5206bf8e515d47c0717563cee2 -p132-1-1.x86_64@system
+rule pkg 722dfe2c0958df7ab9357b678863201a  p100-2-1.x86_64@available
+rule pkg 722dfe2c0958df7ab9357b678863201a -p93-2-1.x86_64@available
+rule pkg 729116652115e811dd697a27dd17185b  p64-2-1.x86_64@available
+rule pkg 729116652115e811dd697a27dd17185b -p57-2-1.x86_64@available
+rule pkg 732faa2b3fa1d8cd5986be9b32013d11 -p96-1-1.x86_64@system
+rule pkg 732faa2b3fa1d8cd5986be9b32013d11 -p96-2-1.x86_64@available
+rule pkg 74121765a2e24863ac5a664bc8eaeea7  p45-2-1.x86_64@available
+rule pkg 74121765a2e24863ac5a664bc8eaeea7 -p38-2-1.x86_64@available
+rule pkg 74245097cac9e80405903936edb02bfc -p52-1-1.x86_64@system
+rule pkg 74245097cac9e80405903936edb02bfc -p52-2-1.x86_64@available
+rule pkg 7470d85ad46c0f90fadef2b2cc7792cb  p67-1-1.x86_64@system
+rule pkg 7470d85ad46c0f90fadef2b2cc7792cb  p67-2-1.x86_64@available
+rule pkg 7470d85ad46c0f90fadef2b2cc7792cb -p66-1-1.x86_64@system
+rule pkg 7498078640cfb2aef899f6c8f471c386 -old25-1-1.x86_64@available
+rule pkg 7498078640cfb2aef899f6c8f471c386 -p25-2-1.x86_64@available
+rule pkg 75362ecf4e4c9457b55b097e24efd52e -p137-1-1.x86_64@system
+rule pkg 75362ecf4e4c9457b55b097e24efd52e -p137-2-1.x86_64@available
+rule pkg 75620853e70a977b303ae70c8e03cc83 -old40-1-1.x86_64@available
+rule pkg 75620853e70a977b303ae70c8e03cc83 -p40-2-1.x86_64@available
+rule pkg 75662f2312b4ad93902644895c8c5ec5  p2-2-1.x86_64@available
+rule pkg 75662f2312b4ad93902644895c8c5ec5 -p1-2-1.x86_64@available
+rule pkg 75cefca669423b30b5222f80b0ba8bd6 -p117-2-1.x86_64@available
+rule pkg 75cefca669423b30b5222f80b0ba8bd6 -p120-1-1.x86_64@system
+rule pkg 763a3c4cb5ee529f342a4267505db2fe -p73-2-1.x86_64@available
+rule pkg 763a3c4cb5ee529f342a4267505db2fe -p76-1-1.x86_64@system
+rule pkg 763af1731d78e0cad761b755c9c74dc4  p95-1-1.x86_64@system
+rule pkg 763af1731d78e0cad761b755c9c74dc4  p95-2-1.x86_64@available
+rule pkg 763af1731d78e0cad761b755c9c74dc4 -p94-1-1.x86_64@system
+rule pkg 763bc3054704bf278bfa658e782880b5 -p135-2-1.x86_64@available
+rule pkg 763bc3054704bf278bfa658e782880b5 -p138-1-1.x86_64@system
+rule pkg 765eda01112fc57e381912a5dc4e87cd  p102-1-1.x86_64@system
+rule pkg 765eda01112fc57e381912a5dc4e87cd  p102-2-1.x86_64@available
+rule pkg 765eda01112fc57e381912a5dc4e87cd -p101-1-1.x86_64@system
+rule pkg 77d0ffe60c6b447a9aa475beac233828  p97-2-1.x86_64@available
+rule pkg 77d0ffe60c6b447a9aa475beac233828 -p90-2-1.x86_64@available
+rule pkg 77fa7d6d6ef18e8e97436444fc317f6c  p68-2-1.x86_64@available
+rule pkg 77fa7d6d6ef18e8e97436444fc317f6c -p61-2-1.x86_64@available
+rule pkg 77fb0b72907b4cdbf59f727b0327556b  p105-2-1.x86_64@available
+rule pkg 77fb0b72907b4cdbf59f727b0327556b -p98-2-1.x86_64@available
+rule pkg 781e993b8954680f264b592fdcf94d4b  p69-1-1.x86_64@system
+rule pkg 781e993b8954680f264b592fdcf94d4b  p69-2-1.x86_64@available
+rule pkg 781e993b8954680f264b592fdcf94d4b -p68-1-1.x86_64@system
+rule pkg 78dd40d22749927f91d600c4951d47aa -p93-2-1.x86_64@available
+rule pkg 78dd40d22749927f91d600c4951d47aa -p96-1-1.x86_64@system
+rule pkg 79093978775126945d66f5315be9e7ac  p149-2-1.x86_64@available
+rule pkg 79093978775126945d66f5315be9e7ac -p148-2-1.x86_64@available
+rule pkg 798654536083a714f738f33023bfaa19 -p121-1-1.x86_64@system
+rule pkg 798654536083a714f738f33023bfaa19 -p121-2-1.x86_64@available
+rule pkg 79cc54b28ac63c74861b1b9b01978c1c -p53-1-1.x86_64@system
+rule pkg 79cc54b28ac63c74861b1b9b01978c1c -p53-2-1.x86_64@available
+rule pkg 79f413652bb98f4acfe1460bf229bee0  p22-2-1.x86_64@available
+rule pkg 79f413652bb98f4acfe1460bf229bee0 -p21-2-1.x86_64@available
+rule pkg 7a01ce237110e42ed631e829f299a750 -p35-1-1.x86_64@system
+rule pkg 7a01ce237110e42ed631e829f299a750 -p35-2-1.x86_64@available
+rule pkg 7a26f5ad060a2e3134a97dd8a20fe94d  p117-2-1.x86_64@available
+rule pkg 7a26f5ad060a2e3134a97dd8a20fe94d -p110-2-1.x86_64@available
+rule pkg 7b23a9400186a5d1f2730efb92beb7ee -old5-1-1.x86_64@available
+rule pkg 7b23a9400186a5d1f2730efb92beb7ee -p5-2-1.x86_64@available
+rule pkg 7bac1e597ef28d60ebb5406e59b3f95e  p87-2-1.x86_64@available
+rule pkg 7bac1e597ef28d60ebb5406e59b3f95e -p86-2-1.x86_64@available
+rule pkg 7bae0ba32222c2f826f8b1476d730b1a -p48-2-1.x86_64@available
+rule pkg 7bae0ba32222c2f826f8b1476d730b1a -p51-1-1.x86_64@system
+rule pkg 7bed7efbf67593b277aa817cabb2a4fe  p81-1-1.x86_64@system
+rule pkg 7bed7efbf67593b277aa817cabb2a4fe  p81-2-1.x86_64@available
+rule pkg 7bed7efbf67593b277aa817cabb2a4fe -p80-1-1.x86_64@system
+rule pkg 7c53130d464a566c5c6ba7f46b376490  p48-1-1.x86_64@system
+rule pkg 7c53130d464a566c5c6ba7f46b376490  p48-2-1.x86_64@available
+rule pkg 7c53130d464a566c5c6ba7f46b376490 -p47-1-1.x86_64@system
+rule pkg 7c5b0f18a727293381425b09d0235e5e -p144-1-1.x86_64@system
+rule pkg 7c5b0f18a727293381425b09d0235e5e -p144-2-1.x86_64@available
+rule pkg 7d27b35b01b2b770cd21fe82a91bf17a -p111-1-1.x86_64@system
+rule pkg 7d27b35b01b2b770cd21fe82a91bf17a -p111-2-1.x86_64@available
+rule pkg 7e2ce3997a76e172354f2c65ec5c0055  p18-1-1.x86_64@system
+rule pkg 7e2ce3997a76e172354f2c65ec5c0055  p18-2-1.x86_64@available
+rule pkg 7e2ce3997a76e172354f2c65ec5c0055 -p17-1-1.x86_64@system
+rule pkg 7e720e9eb9fe8719f70f0117265210b3 -p5-1-1.x86_64@system
+rule pkg 7e720e9eb9fe8719f70f0117265210b3 -p5-2-1.x86_64@available
+rule pkg 7e73e497dd793db7eba8f5fa3a974011 -p2-1-1.x86_64@system
+rule pkg 7e73e497dd793db7eba8f5fa3a974011 -p2-2-1.x86_64@available
+rule pkg 7e7653e2fd82b12d149ef569fad4847d  p58-2-1.x86_64@available
+rule pkg 7e7653e2fd82b12d149ef569fad4847d -p51-2-1.x86_64@available
+rule pkg 7e77050be03ea72c3901d52ef7df7a9f -p1-1-1.x86_64@system
+rule pkg 7e77050be03ea72c3901d52ef7df7a9f -p1-2-1.x86_64@available
+rule pkg 7ea6bbbb1b1ac903bf69a6d83f51ba63 -p3-2-1.x86_64@available
+rule pkg 7ea6bbbb1b1ac903bf69a6d83f51ba63 -p6-1-1.x86_64@system
+rule pkg 7ecc715b8fd7f9c7721123c971fd88e8  p84-2-1.x86_64@available
+rule pkg 7ecc715b8fd7f9c7721123c971fd88e8 -p77-2-1.x86_64@available
+rule pkg 7f11058d32b60512867c28bff04adc44  p55-2-1.x86_64@available
+rule pkg 7f11058d32b60512867c28bff04adc44 -p48-2-1.x86_64@available
+rule pkg 7f7723d842ffa6dba71aba4bd485b01e -p52-2-1.x86_64@available
+rule pkg 7f7723d842ffa6dba71aba4bd485b01e -p55-1-1.x86_64@system
+rule pkg 7f78d186f7f83ba302a4ef1e89d2ad9a -p19-2-1.x86_64@available
+rule pkg 7f78d186f7f83ba302a4ef1e89d2ad9a -p22-1-1.x86_64@system
+rule pkg 7f8c59e54fb01990c2961dfd5ad0546a  p134-1-1.x86_64@system
+rule pkg 7f8c59e54fb01990c2961dfd5ad0546a  p134-2-1.x86_64@available
+rule pkg 7f8c59e54fb01990c2961dfd5ad0546a -p133-1-1.x86_64@system
+rule pkg 7fafdd60a53a6c6ea8fc48ee5fe61150  p72-2-1.x86_64@available
+rule pkg 7fafdd60a53a6c6ea8fc48ee5fe61150 -p71-2-1.x86_64@available
+rule pkg 80045602920c1aefab67b0299fc7664d  p115-2-1.x86_64@available
+rule pkg 80045602920c1aefab67b0299fc7664d -p114-2-1.x86_64@available
+rule pkg 806a32bd26f80e03f195fda23ae5351f -p128-2-1.x86_64@available
+rule pkg 806a32bd26f80e03f195fda23ae5351f -p131-1-1.x86_64@system
+rule pkg 808fe5c6dd3aa0acbf833a031b04b021  p120-1-1.x86_64@system
+rule pkg 808fe5c6dd3aa0acbf833a031b04b021  p120-2-1.x86_64@available
+rule pkg 808fe5c6dd3aa0acbf833a031b04b021 -p119-1-1.x86_64@system
+rule pkg 8098497386ee5f8ca088920ff10c60b4  p133-2-1.x86_64@available
+rule pkg 8098497386ee5f8ca088920ff10c60b4 -p132-2-1.x86_64@available
+rule pkg 80ab48ff8c005d1937787eee06285873 -p112-2-1.x86_64@available
+rule pkg 80ab48ff8c005d1937787eee06285873 -p115-1-1.x86_64@system
+rule pkg 80b2218b554805ebef70cfd8d1757526 -p118-2-1.x86_64@available
+rule pkg 80b2218b554805ebef70cfd8d1757526 -p121-1-1.x86_64@system
+rule pkg 80e97e91876db723afdb98e33622c761 -p46-2-1.x86_64@available
+rule pkg 80e97e91876db723afdb98e33622c761 -p49-1-1.x86_64@system
+rule pkg 80f4ac8725dd01de3e6dc8d6349822dd -p94-1-1.x86_64@system
+rule pkg 80f4ac8725dd01de3e6dc8d6349822dd -p94-2-1.x86_64@available
+rule pkg 810ab0084723256b8ebd22f8fdebd3eb  p91-1-1.x86_64@system
+rule pkg 810ab0084723256b8ebd22f8fdebd3eb  p91-2-1.x86_64@available
+rule pkg 810ab0084723256b8ebd22f8fdebd3eb -p90-1-1.x86_64@system
+rule pkg 81540a894440e4ec33b9cbe6bfa5c7db  p89-2-1.x86_64@available
+rule pkg 81540a894440e4ec33b9cbe6bfa5c7db -p82-2-1.x86_64@available
+rule pkg 815b61b82b6f6fef2c647e3f2c2d00a3 -p102-1-1.x86_64@system
+rule pkg 815b61b82b6f6fef2c647e3f2c2d00a3 -p99-2-1.x86_64@available
+rule pkg 818e0f2f9c599cba05b6329fb77eb66e -p39-1-1.x86_64@system
+rule pkg 818e0f2f9c599cba05b6329fb77eb66e -p39-2-1.x86_64@available
+rule pkg 82a6f6747df3dd81d13cdd6c4e83b202  p146-2-1.x86_64@available
+rule pkg 82a6f6747df3dd81d13cdd6c4e83b202 -p145-2-1.x86_64@available
+rule pkg 82b69abc170dd1444f4c857d0b5f5b24  p90-2-1.x86_64@available
+rule pkg 82b69abc170dd1444f4c857d0b5f5b24 -p83-2-1.x86_64@available
+rule pkg 82d80240e834cc0a9452b35e3501aa21  p93-1-1.x86_64@system
+rule pkg 82d80240e834cc0a9452b35e3501aa21  p93-2-1.x86_64@available
+rule pkg 82d80240e834cc0a9452b35e3501aa21 -p92-1-1.x86_64@system
+rule pkg 830be1294f3d9ea97accb23f03e35d88 -p89-2-1.x86_64@available
+rule pkg 830be1294f3d9ea97accb23f03e35d88 -p92-1-1.x86_64@system
+rule pkg 837a632719dfe46e83498925c58c4ef5 -p49-1-1.x86_64@system
+rule pkg 837a632719dfe46e83498925c58c4ef5 -p49-2-1.x86_64@available
+rule pkg 83c7920638cc7eab6b3c3406b6eeaab8  p97-1-1.x86_64@system
+rule pkg 83c7920638cc7eab6b3c3406b6eeaab8  p97-2-1.x86_64@available
+rule pkg 83c7920638cc7eab6b3c3406b6eeaab8 -p96-1-1.x86_64@system
+rule pkg 8490b8d5d2cce246855490e0d0cf40de  p74-1-1.x86_64@system
+rule pkg 8490b8d5d2cce246855490e0d0cf40de  p74-2-1.x86_64@available
+rule pkg 8490b8d5d2cce246855490e0d0cf40de -p73-1-1.x86_64@system
+rule pkg 849721944f4a4c2c27fd51434a9d64e9 -p100-1-1.x86_64@system
+rule pkg 849721944f4a4c2c27fd51434a9d64e9 -p97-2-1.x86_64@available
+rule pkg 854347d1023e4e36b845e59b9fe95273  p16-2-1.x86_64@available
+rule pkg 854347d1023e4e36b845e59b9fe95273 -p9-2-1.x86_64@available
+rule pkg 85b90e21298c47ae1b03da3f049f2db6 -p81-2-1.x86_64@available
+rule pkg 85b90e21298c47ae1b03da3f049f2db6 -p84-1-1.x86_64@system
+rule pkg 861c249631b5ee16df459869345c2636 -p70-2-1.x86_64@available
+rule pkg 861c249631b5ee16df459869345c2636 -p73-1-1.x86_64@system
+rule pkg 86706adc2229ee1fcbec5a77077217e4  p109-2-1.x86_64@available
+rule pkg 86706adc2229ee1fcbec5a77077217e4 -p108-2-1.x86_64@available
+rule pkg 869ad3fb88073ab1029117f247451d92  p148-2-1.x86_64@available
+rule pkg 869ad3fb88073ab1029117f247451d92 -p147-2-1.x86_64@available
+rule pkg 86f92fd83d9a8238b5e62eb7252760c9  p147-2-1.x86_64@available
+rule pkg 86f92fd83d9a8238b5e62eb7252760c9 -p146-2-1.x86_64@available
+rule pkg 87c988b0bee787de2452a0e36910face -p113-2-1.x86_64@available
+rule pkg 87c988b0bee787de2452a0e36910face -p116-1-1.x86_64@system
+rule pkg 87d6e042d3636b3c0dabdc57863640a7 -p40-2-1.x86_64@available
+rule pkg 87d6e042d3636b3c0dabdc57863640a7 -p43-1-1.x86_64@system
+rule pkg 87e113a276a5a8c3609a09ec3bbd9d08 -p132-2-1.x86_64@available
+rule pkg 87e113a276a5a8c3609a09ec3bbd9d08 -p135-1-1.x86_64@system
+rule pkg 884201a337b0fc4f598b0f8b36fb338b  p24-1-1.x86_64@system
+rule pkg 884201a337b0fc4f598b0f8b36fb338b  p24-2-1.x86_64@available
+rule pkg 884201a337b0fc4f598b0f8b36fb338b -p23-1-1.x86_64@system
+rule pkg 88b97ff3b960e5ce0979f234b0862c25  p145-1-1.x86_64@system
+rule pkg 88b97ff3b960e5ce0979f234b0862c25  p145-2-1.x86_64@available
+rule pkg 88b97ff3b960e5ce0979f234b0862c25 -p144-1-1.x86_64@system
+rule pkg 89654ccbbcc067d6336a8e64f0c58226 -p77-1-1.x86_64@system
+rule pkg 89654ccbbcc067d6336a8e64f0c58226 -p77-2-1.x86_64@available
+rule pkg 89e6fcdf5add483cfc4e057b20cdfc18  p36-2-1.x86_64@available
+rule pkg 89e6fcdf5add483cfc4e057b20cdfc18 -p29-2-1.x86_64@available
+rule pkg 89f01b2a3198bbf2756fd69da9abc882 -p82-2-1.x86_64@available
+rule pkg 89f01b2a3198bbf2756fd69da9abc882 -p85-1-1.x86_64@system
+rule pkg 8a09f267815d0d697eeb96ad99a1d14d -p65-1-1.x86_64@system
+rule pkg 8a09f267815d0d697eeb96ad99a1d14d -p65-2-1.x86_64@available
+rule pkg 8a36bda1c80a1a0240382bf9df6ddd05  p124-1-1.x86_64@system
+rule pkg 8a36bda1c80a1a0240382bf9df6ddd05  p124-2-1.x86_64@available
+rule pkg 8a36bda1c80a1a0240382bf9df6ddd05 -p123-1-1.x86_64@system
+rule pkg 8ac5cb5ef61e0c32f9a63a44cfb6b379 -old15-1-1.x86_64@available
+rule pkg 8ac5cb5ef61e0c32f9a63a44cfb6b379 -p15-2-1.x86_64@available
+rule pkg 8c269c40b31263f2e5e4bb2eccfc3122 -p128-1-1.x86_64@system
+rule pkg 8c269c40b31263f2e5e4bb2eccfc3122 -p128-2-1.x86_64@available
+rule pkg 8c4b1e3e248d543ef95f70115e4d78e3  p43-1-1.x86_64@system
+rule pkg 8c4b1e3e248d543ef95f70115e4d78e3  p43-2-1.x86_64@available
+rule pkg 8c4b1e3e248d543ef95f70115e4d78e3 -p42-1-1.x86_64@system
+rule pkg 8caf610acb0a50bc51d5f56e0e6da833 -p124-2-1.x86_64@available
+rule pkg 8caf610acb0a50bc51d5f56e0e6da833 -p127-1-1.x86_64@system
+rule pkg 8d25d41055aca34dd31b42f5aaf1ee37  p66-2-1.x86_64@available
+rule pkg 8d25d41055aca34dd31b42f5aaf1ee37 -p59-2-1.x86_64@available
+rule pkg 8ddcaa968d1896eb8f8c36072fd544e6  p45-1-1.x86_64@system
+rule pkg 8ddcaa968d1896eb8f8c36072fd544e6  p45-2-1.x86_64@available
+rule pkg 8ddcaa968d1896eb8f8c36072fd544e6 -p44-1-1.x86_64@system
+rule pkg 8e1a3f6821a6af1c9b3c4196e9a62aba -p148-1-1.x86_64@system
+rule pkg 8e1a3f6821a6af1c9b3c4196e9a62aba -p148-2-1.x86_64@available
+rule pkg 8e47a60294c8838cafd87207bb229ff1  p0-1-1.x86_64@system
+rule pkg 8e47a60294c8838cafd87207bb229ff1  p0-2-1.x86_64@available
+rule pkg 8e47a60294c8838cafd87207bb229ff1 -p149-1-1.x86_64@system
+rule pkg 8f2241df44c3e0fea9e7e250e7350b4e -p123-2-1.x86_64@available
+rule pkg 8f2241df44c3e0fea9e7e250e7350b4e -p126-1-1.x86_64@system
+rule pkg 901e8bb2e893e97076b58c06e691b172  p133-2-1.x86_64@available
+rule pkg 901e8bb2e893e97076b58c06e691b172 -p126-2-1.x86_64@available
+rule pkg 908b2034b057b7c21569bd0934f4eb29 -p71-2-1.x86_64@available
+rule pkg 908b2034b057b7c21569bd0934f4eb29 -p74-1-1.x86_64@system
+rule pkg 916706f10d737160477d2d6eec699701 -p44-2-1.x86_64@available
+rule pkg 916706f10d737160477d2d6eec699701 -p47-1-1.x86_64@system
+rule pkg 919639bbca59fe6146fbe3787b40ff24 -p15-2-1.x86_64@available
+rule pkg 919639bbca59fe6146fbe3787b40ff24 -p18-1-1.x86_64@system
+rule pkg 91c93ab5106052fb161f9ba50e73cbb2  p147-1-1.x86_64@system
+rule pkg 91c93ab5106052fb161f9ba50e73cbb2  p147-2-1.x86_64@available
+rule pkg 91c93ab5106052fb161f9ba50e73cbb2 -p146-1-1.x86_64@system
+rule pkg 91cff8965feb68ad23dfd0532e52229b -p24-1-1.x86_64@system
+rule pkg 91cff8965feb68ad23dfd0532e52229b -p24-2-1.x86_64@available
+rule pkg 91df4ab44fccbc9c5f91615d806db115  p53-2-1.x86_64@available
+rule pkg 91df4ab44fccbc9c5f91615d806db115 -p46-2-1.x86_64@available
+rule pkg 91f35daa11a50b202149197a052b34db  p65-2-1.x86_64@available
+rule pkg 91f35daa11a50b202149197a052b34db -p58-2-1.x86_64@available
+rule pkg 9215ad8e8517e0334c57f12fef60fa9f -p145-1-1.x86_64@system
+rule pkg 9215ad8e8517e0334c57f12fef60fa9f -p145-2-1.x86_64@available
+rule pkg 921e4b9679418336816a12f01604202c  p46-2-1.x86_64@available
+rule pkg 921e4b9679418336816a12f01604202c -p39-2-1.x86_64@available
+rule pkg 923683959b9694b438438f43c4acc6a8  p33-1-1.x86_64@system
+rule pkg 923683959b9694b438438f43c4acc6a8  p33-2-1.x86_64@available
+rule pkg 923683959b9694b438438f43c4acc6a8 -p32-1-1.x86_64@system
+rule pkg 923a04ed8abf22dad405485e63a2950e  p71-2-1.x86_64@available
+rule pkg 923a04ed8abf22dad405485e63a2950e -p64-2-1.x86_64@available
+rule pkg 92c689c4acbfc1fad14641d40e21ed1a -p149-1-1.x86_64@system
+rule pkg 92c689c4acbfc1fad14641d40e21ed1a -p149-2-1.x86_64@available
+rule pkg 92f95b4a2f1dd547f8dc7ffd2b997e71 -p145-2-1.x86_64@available
+rule pkg 92f95b4a2f1dd547f8dc7ffd2b997e71 -p148-1-1.x86_64@system
+rule pkg 93720f6e8ff371b1539bf18a884fa837 -old135-1-1.x86_64@available
+rule pkg 93720f6e8ff371b1539bf18a884fa837 -p135-2-1.x86_64@available
+rule pkg 9376e2e502c92bb8ba3762998075f565 -p12-1-1.x86_64@system
+rule pkg 9376e2e502c92bb8ba3762998075f565 -p12-2-1.x86_64@available
+rule pkg 939085e58355a6d00e12c0fafea8e93f -p116-1-1.x86_64@system
+rule pkg 939085e58355a6d00e12c0fafea8e93f -p116-2-1.x86_64@available
+rule pkg 93993ad0b9cefe775f381ef87c0da17f  p140-2-1.x86_64@available
+rule pkg 93993ad0b9cefe775f381ef87c0da17f -p139-2-1.x86_64@available
+rule pkg 939d63819e3fbb51e02b35c86a6829cb -p25-2-1.x86_64@available
+rule pkg 939d63819e3fbb51e02b35c86a6829cb -p28-1-1.x86_64@system
+rule pkg 93f02646798fdecdd5e9538a71bbabe4 -p8-1-1.x86_64@system
+rule pkg 93f02646798fdecdd5e9538a71bbabe4 -p8-2-1.x86_64@available
+rule pkg 943e2ce096f1bb5940d6a5813c28dd51  p11-2-1.x86_64@available
+rule pkg 943e2ce096f1bb5940d6a5813c28dd51 -p4-2-1.x86_64@available
+rule pkg 9477b72b71a0aec945d02fe5779c792c  p29-2-1.x86_64@available
+rule pkg 9477b72b71a0aec945d02fe5779c792c -p22-2-1.x86_64@available
+rule pkg 94ec5898fe9c7cee0fea237f8acf924a  p1-2-1.x86_64@available
+rule pkg 94ec5898fe9c7cee0fea237f8acf924a -p144-2-1.x86_64@available
+rule pkg 96de9b04f014cb222d94bb091c5d6d11 -p139-1-1.x86_64@system
+rule pkg 96de9b04f014cb222d94bb091c5d6d11 -p139-2-1.x86_64@available
+rule pkg 988b243cb6cf620687cf37f52b6631ce -p67-2-1.x86_64@available
+rule pkg 988b243cb6cf620687cf37f52b6631ce -p70-1-1.x86_64@system
+rule pkg 98d516166eeae288bf545a4b8d6031d3  p75-2-1.x86_64@available
+rule pkg 98d516166eeae288bf545a4b8d6031d3 -p74-2-1.x86_64@available
+rule pkg 9975dfa49cc1fdd67c44d2e48498ba28  p32-2-1.x86_64@available
+rule pkg 9975dfa49cc1fdd67c44d2e48498ba28 -p25-2-1.x86_64@available
+rule pkg 99c900b3e536e504bb7d6a2b2abd2a14 -p105-2-1.x86_64@available
+rule pkg 99c900b3e536e504bb7d6a2b2abd2a14 -p108-1-1.x86_64@system
+rule pkg 99e234e419657fcd6a494fa178ad6168 -p11-1-1.x86_64@system
+rule pkg 99e234e419657fcd6a494fa178ad6168 -p8-2-1.x86_64@available
+rule pkg 99e87ed484eba7817358eddc9cbeb46c  p91-2-1.x86_64@available
+rule pkg 99e87ed484eba7817358eddc9cbeb46c -p90-2-1.x86_64@available
+rule pkg 9a608cbe80af2c06a0f5e3ae3460abfb  p119-1-1.x86_64@system
+rule pkg 9a608cbe80af2c06a0f5e3ae3460abfb  p119-2-1.x86_64@available
+rule pkg 9a608cbe80af2c06a0f5e3ae3460abfb -p118-1-1.x86_64@system
+rule pkg 9af46c86147c1ca1ee0f44e3212ab8d8  p113-1-1.x86_64@system
+rule pkg 9af46c86147c1ca1ee0f44e3212ab8d8  p113-2-1.x86_64@available
+rule pkg 9af46c86147c1ca1ee0f44e3212ab8d8 -p112-1-1.x86_64@system
+rule pkg 9b795d695b832b804fd585bc2580b5b9 -p91-2-1.x86_64@available
+rule pkg 9b795d695b832b804fd585bc2580b5b9 -p94-1-1.x86_64@system
+rule pkg 9be503c11292fb0fe2eea7d610fb923e  p107-2-1.x86_64@available
+rule pkg 9be503c11292fb0fe2eea7d610fb923e -p106-2-1.x86_64@available
+rule pkg 9bf71f34dfc6141577a383532a52cacf  p53-1-1.x86_64@system
+rule pkg 9bf71f34dfc6141577a383532a52cacf  p53-2-1.x86_64@available
+rule pkg 9bf71f34dfc6141577a383532a52cacf -p52-1-1.x86_64@system
+rule pkg 9c7da0df8210c26c8eecbadfabf6c637  p10-2-1.x86_64@available
+rule pkg 9c7da0df8210c26c8eecbadfabf6c637 -p3-2-1.x86_64@available
+rule pkg 9cfe457837dac746a328ebbfca6186be -p110-1-1.x86_64@system
+rule pkg 9cfe457837dac746a328ebbfca6186be -p110-2-1.x86_64@available
+rule pkg 9d067f83cfabcb9edc6a1bd2bc997ae4  p71-2-1.x86_64@available
+rule pkg 9d067f83cfabcb9edc6a1bd2bc997ae4 -p70-2-1.x86_64@available
+rule pkg 9d4374862a0af4025b8d7a6f4434f558 -old35-1-1.x86_64@available
+rule pkg 9d4374862a0af4025b8d7a6f4434f558 -p35-2-1.x86_64@available
+rule pkg 9d5237ba6f8907a7730392543dbffed8  p91-2-1.x86_64@available
+rule pkg 9d5237ba6f8907a7730392543dbffed8 -p84-2-1.x86_64@available
+rule pkg 9e781652027a63344e6818fde8765a8a  p2-2-1.x86_64@available
+rule pkg 9e781652027a63344e6818fde8765a8a -p145-2-1.x86_64@available
+rule pkg 9e847e9f39177eb227ba87413428f918  p87-2-1.x86_64@available
+rule pkg 9e847e9f39177eb227ba87413428f918 -p80-2-1.x86_64@available
+rule pkg 9e9f0ee15d947f1e6ecd26c640d17cac -p135-1-1.x86_64@system
+rule pkg 9e9f0ee15d947f1e6ecd26c640d17cac -p135-2-1.x86_64@available
+rule pkg 9ea17d277a81d243725940f6537c8fe0 -p64-2-1.x86_64@available
+rule pkg 9ea17d277a81d243725940f6537c8fe0 -p67-1-1.x86_64@system
+rule pkg 9ea5f051742eea0357ba2bf10beef1b7  p118-2-1.x86_64@available
+rule pkg 9ea5f051742eea0357ba2bf10beef1b7 -p111-2-1.x86_64@available
+rule pkg 9ed40a41ae87ede9999a1540f1dcaff5 -p92-2-1.x86_64@available
+rule pkg 9ed40a41ae87ede9999a1540f1dcaff5 -p95-1-1.x86_64@system
+rule pkg 9ee73c39d417e84b33eede58c9f105ae  p77-1-1.x86_64@system
+rule pkg 9ee73c39d417e84b33eede58c9f105ae  p77-2-1.x86_64@available
+rule pkg 9ee73c39d417e84b33eede58c9f105ae -p76-1-1.x86_64@system
+rule pkg 9f9b7effe1059a0d5fab7840d24eb1ff  p85-2-1.x86_64@available
+rule pkg 9f9b7effe1059a0d5fab7840d24eb1ff -p78-2-1.x86_64@available
+rule pkg 9fad4a67096ecf7766f09a56c63f9c52 -p101-2-1.x86_64@available
+rule pkg 9fad4a67096ecf7766f09a56c63f9c52 -p104-1-1.x86_64@system
+rule pkg 9feb8a0b3b186c060cf6b497043850fd  p51-2-1.x86_64@available
+rule pkg 9feb8a0b3b186c060cf6b497043850fd -p44-2-1.x86_64@available
+rule pkg a04aebf218aef4ca72647763b57e3f7d -p115-1-1.x86_64@system
+rule pkg a04aebf218aef4ca72647763b57e3f7d -p115-2-1.x86_64@available
+rule pkg a05af575ecaf4c38873e391091e64e4d  p66-1-1.x86_64@system
+rule pkg a05af575ecaf4c38873e391091e64e4d  p66-2-1.x86_64@available
+rule pkg a05af575ecaf4c38873e391091e64e4d -p65-1-1.x86_64@system
+rule pkg a0b8bd962b2c627f43bb67604a337c60 -p1-2-1.x86_64@available
+rule pkg a0b8bd962b2c627f43bb67604a337c60 -p4-1-1.x86_64@system
+rule pkg a104156ab13b855d0be099f9028e290e  p126-2-1.x86_64@available
+rule pkg a104156ab13b855d0be099f9028e290e -p125-2-1.x86_64@available
+rule pkg a11cc8debb1e07751838cadfd08448dd -p37-2-1.x86_64@available
+rule pkg a11cc8debb1e07751838cadfd08448dd -p40-1-1.x86_64@system
+rule pkg a148c119842f8056eb2a491f5257b7be -p93-1-1.x86_64@system
+rule pkg a148c119842f8056eb2a491f5257b7be -p93-2-1.x86_64@available
+rule pkg a150b0ead4beae0b0b4a9a5557132553  p87-1-1.x86_64@system
+rule pkg a150b0ead4beae0b0b4a9a5557132553  p87-2-1.x86_64@available
+rule pkg a150b0ead4beae0b0b4a9a5557132553 -p86-1-1.x86_64@system
+rule pkg a1a383cc34e8609ceb650b09f03bd0fc -p6-1-1.x86_64@system
+rule pkg a1a383cc34e8609ceb650b09f03bd0fc -p6-2-1.x86_64@available
+rule pkg a1c207092578f6cac6ce933579798b98 -p105-1-1.x86_64@system
+rule pkg a1c207092578f6cac6ce933579798b98 -p105-2-1.x86_64@available
+rule pkg a203444f6b54d6a467c5e2c964364091  p59-2-1.x86_64@available
+rule pkg a203444f6b54d6a467c5e2c964364091 -p52-2-1.x86_64@available
+rule pkg a203a9c28426471c340a6afed3fcf9d9  p109-1-1.x86_64@system
+rule pkg a203a9c28426471c340a6afed3fcf9d9  p109-2-1.x86_64@available
+rule pkg a203a9c28426471c340a6afed3fcf9d9 -p108-1-1.x86_64@system
+rule pkg a2a91ae596a36bb0ef35fa6ff822479a  p16-2-1.x86_64@available
+rule pkg a2a91ae596a36bb0ef35fa6ff822479a -p15-2-1.x86_64@available
+rule pkg a2df98b9b91af157604d2040b8c1faa1  p126-2-1.x86_64@available
+rule pkg a2df98b9b91af157604d2040b8c1faa1 -p119-2-1.x86_64@available
+rule pkg a2e33f223918ecc2976fcd5c742d7aa9  p72-1-1.x86_64@system
+rule pkg a2e33f223918ecc2976fcd5c742d7aa9  p72-2-1.x86_64@available
+rule pkg a2e33f223918ecc2976fcd5c742d7aa9 -p71-1-1.x86_64@system
+rule pkg a33e919e4e5170823949cc2f77a85e95 -p69-1-1.x86_64@system
+rule pkg a33e919e4e5170823949cc2f77a85e95 -p69-2-1.x86_64@available
+rule pkg a38c08ee3af9633eb4eac1d71316df92  p74-2-1.x86_64@available
+rule pkg a38c08ee3af9633eb4eac1d71316df92 -p73-2-1.x86_64@available
+rule pkg a3a57b86d73e9453c824540bbf780561 -p86-1-1.x86_64@system
+rule pkg a3a57b86d73e9453c824540bbf780561 -p86-2-1.x86_64@available
+rule pkg a3c385d8237ee15dc84160f137f95cd5  p63-2-1.x86_64@available
+rule pkg a3c385d8237ee15dc84160f137f95cd5 -p56-2-1.x86_64@available
+rule pkg a44dbece44892e3cc7d94cba1f4d9fd8  p119-2-1.x86_64@available
+rule pkg a44dbece44892e3cc7d94cba1f4d9fd8 -p118-2-1.x86_64@available
+rule pkg a4529162b100b5b9db30205e45940baa  p3-2-1.x86_64@available
+rule pkg a4529162b100b5b9db30205e45940baa -p2-2-1.x86_64@available
+rule pkg a559dd5012e6dd35e02407790e0f78ed -p90-2-1.x86_64@available
+rule pkg a559dd5012e6dd35e02407790e0f78ed -p93-1-1.x86_64@system
+rule pkg a60349069cd4960da7fe564cbbc45f7e  p86-2-1.x86_64@available
+rule pkg a60349069cd4960da7fe564cbbc45f7e -p85-2-1.x86_64@available
+rule pkg a6578040cfdc2132ca9eb15651386a0a -p80-2-1.x86_64@available
+rule pkg a6578040cfdc2132ca9eb15651386a0a -p83-1-1.x86_64@system
+rule pkg a6949526dc6c6a92e831a8252d7efef6 -p144-2-1.x86_64@available
+rule pkg a6949526dc6c6a92e831a8252d7efef6 -p147-1-1.x86_64@system
+rule pkg a715e6916aa00c20dc0541378bb5adc4 -p73-1-1.x86_64@system
+rule pkg a715e6916aa00c20dc0541378bb5adc4 -p73-2-1.x86_64@available
+rule pkg a7b6c72009edd60473608d6b1f088f9b -p45-1-1.x86_64@system
+rule pkg a7b6c72009edd60473608d6b1f088f9b -p45-2-1.x86_64@available
+rule pkg a875931860b7f1f70a2aa2ef428ca35c  p79-2-1.x86_64@available
+rule pkg a875931860b7f1f70a2aa2ef428ca35c -p72-2-1.x86_64@available
+rule pkg a8d5559ac089963f040d97c737e8c14f  p48-2-1.x86_64@available
+rule pkg a8d5559ac089963f040d97c737e8c14f -p41-2-1.x86_64@available
+rule pkg a8d652ab4381902db9fde78492463e61  p32-2-1.x86_64@available
+rule pkg a8d652ab4381902db9fde78492463e61 -p31-2-1.x86_64@available
+rule pkg a91c0e8e70e5d7fb5fa8d5f2e9558c71 -p30-2-1.x86_64@available
+rule pkg a91c0e8e70e5d7fb5fa8d5f2e9558c71 -p33-1-1.x86_64@system
+rule pkg a9d51423082578695133ab802ed78520 -p20-1-1.x86_64@system
+rule pkg a9d51423082578695133ab802ed78520 -p20-2-1.x86_64@available
+rule pkg aa16efddcb6a7fcc164b1ae95b09111e  p79-2-1.x86_64@available
+rule pkg aa16efddcb6a7fcc164b1ae95b09111e -p78-2-1.x86_64@available
+rule pkg aa2935f92a5e854e4496df144975b6b1  p1-2-1.x86_64@available
+rule pkg aa2935f92a5e854e4496df144975b6b1 -p0-2-1.x86_64@available
+rule pkg aa5c468de4a894fc4ae2966d51114edd -p92-1-1.x86_64@system
+rule pkg aa5c468de4a894fc4ae2966d51114edd -p92-2-1.x86_64@available
+rule pkg ab37d96cddb63ad6c924086dffa4161b  p78-2-1.x86_64@available
+rule pkg ab37d96cddb63ad6c924086dffa4161b -p77-2-1.x86_64@available
+rule pkg ab4f2bcefce6f3f6c14ff69f75088329  p21-2-1.x86_64@available
+rule pkg ab4f2bcefce6f3f6c14ff69f75088329 -p14-2-1.x86_64@available
+rule pkg abbd85dd3b4160d07de5c51513021bc0  p73-2-1.x86_64@available
+rule pkg abbd85dd3b4160d07de5c51513021bc0 -p66-2-1.x86_64@available
+rule pkg abdfa5a6bdbdce0a199df7a9fe7c2dbf  p1-1-1.x86_64@system
+rule pkg abdfa5a6bdbdce0a199df7a9fe7c2dbf  p1-2-1.x86_64@available
+rule pkg abdfa5a6bdbdce0a199df7a9fe7c2dbf -p0-1-1.x86_64@system
+rule pkg ac3ad51d832c8b78a998f06862a870e4  p137-2-1.x86_64@available
+rule pkg ac3ad51d832c8b78a998f06862a870e4 -p130-2-1.x86_64@available
+rule pkg ad3876df2eb71040a701799f3e3a72b6  p125-2-1.x86_64@available
+rule pkg ad3876df2eb71040a701799f3e3a72b6 -p124-2-1.x86_64@available
+rule pkg add80368d062bf4b2415b022b7e4413e  p21-1-1.x86_64@system
+rule pkg add80368d062bf4b2415b022b7e4413e  p21-2-1.x86_64@available
+rule pkg add80368d062bf4b2415b022b7e4413e -p20-1-1.x86_64@system
+rule pkg ae72e83ce009ed82b95cebe692f07d6a  p15-1-1.x86_64@system
+rule pkg ae72e83ce009ed82b95cebe692f07d6a  p15-2-1.x86_64@available
+rule pkg ae72e83ce009ed82b95cebe692f07d6a -p14-1-1.x86_64@system
+rule pkg aef93d7abefeb80578c85689f3d66f40 -old0-1-1.x86_64@available
+rule pkg aef93d7abefeb80578c85689f3d66f40 -p0-2-1.x86_64@available
+rule pkg af0e3063565d4dc7f0b836fbbed85003  p7-2-1.x86_64@available
+rule pkg af0e3063565d4dc7f0b836fbbed85003 -p0-2-1.x86_64@available
+rule pkg af2a3dfcaca1dd867b89844afb53ae1c -p146-1-1.x86_64@system
+rule pkg af2a3dfcaca1dd867b89844afb53ae1c -p146-2-1.x86_64@available
+rule pkg af4f2fb7e95914de0c2a7930dfe434f3  p107-2-1.x86_64@available
+rule pkg af4f2fb7e95914de0c2a7930dfe434f3 -p100-2-1.x86_64@available
+rule pkg afeb408b9821610d08cb76ef5727e0dd  p136-2-1.x86_64@available
+rule pkg afeb408b9821610d08cb76ef5727e0dd -p135-2-1.x86_64@available
+rule pkg b01dbcfdc108a8b40bfa14ebe8b3e346  p4-1-1.x86_64@system
+rule pkg b01dbcfdc108a8b40bfa14ebe8b3e346  p4-2-1.x86_64@available
+rule pkg b01dbcfdc108a8b40bfa14ebe8b3e346 -p3-1-1.x86_64@system
+rule pkg b0548657a3a599c22d7c364017859336  p107-1-1.x86_64@system
+rule pkg b0548657a3a599c22d7c364017859336  p107-2-1.x86_64@available
+rule pkg b0548657a3a599c22d7c364017859336 -p106-1-1.x86_64@system
+rule pkg b0e009f6c6b0abf93ca9d5341c4eb4ea  p38-2-1.x86_64@available
+rule pkg b0e009f6c6b0abf93ca9d5341c4eb4ea -p37-2-1.x86_64@available
+rule pkg b0f993baab00cb65d4ebacdbc2bc9c00  p8-1-1.x86_64@system
+rule pkg b0f993baab00cb65d4ebacdbc2bc9c00  p8-2-1.x86_64@available
+rule pkg b0f993baab00cb65d4ebacdbc2bc9c00 -p7-1-1.x86_64@system
+rule pkg b188ce395ffcdcf07b710f67e0a4243f  p35-2-1.x86_64@available
+rule pkg b188ce395ffcdcf07b710f67e0a4243f -p28-2-1.x86_64@available
+rule pkg b194c5232634d1ec25c6b08cad963e47  p118-2-1.x86_64@available
+rule pkg b194c5232634d1ec25c6b08cad963e47 -p117-2-1.x86_64@available
+rule pkg b2c8323eb8d66448f6e8926e5a944fe1 -p134-1-1.x86_64@system
+rule pkg b2c8323eb8d66448f6e8926e5a944fe1 -p134-2-1.x86_64@available
+rule pkg b4a21d0926cd11fa2251a8f0bede5171 -p82-1-1.x86_64@system
+rule pkg b4a21d0926cd11fa2251a8f0bede5171 -p82-2-1.x86_64@available
+rule pkg b4c5c796d9993aa6c4f6b9e42042f14b -p16-2-1.x86_64@available
+rule pkg b4c5c796d9993aa6c4f6b9e42042f14b -p19-1-1.x86_64@system
+rule pkg b508aabb05fcef81734afd924385b6c9 -p13-2-1.x86_64@available
+rule pkg b508aabb05fcef81734afd924385b6c9 -p16-1-1.x86_64@system
+rule pkg b52175f163aeb772782a5402bc4e27e4 -p22-2-1.x86_64@available
+rule pkg b52175f163aeb772782a5402bc4e27e4 -p25-1-1.x86_64@system
+rule pkg b525d904211eb607858ac97743486191  p62-2-1.x86_64@available
+rule pkg b525d904211eb607858ac97743486191 -p61-2-1.x86_64@available
+rule pkg b57cc36a6bc4be2addd3fa5c937f33cf  p20-2-1.x86_64@available
+rule pkg b57cc36a6bc4be2addd3fa5c937f33cf -p19-2-1.x86_64@available
+rule pkg b5a8c326ed4f9e6baede13d7fba23b0c -p72-1-1.x86_64@system
+rule pkg b5a8c326ed4f9e6baede13d7fba23b0c -p72-2-1.x86_64@available
+rule pkg b5bbfb85d7139051a2e762670055698e  p38-1-1.x86_64@system
+rule pkg b5bbfb85d7139051a2e762670055698e  p38-2-1.x86_64@available
+rule pkg b5bbfb85d7139051a2e762670055698e -p37-1-1.x86_64@system
+rule pkg b5ff10fb304d22beedfc0bdb8de3c170  p129-2-1.x86_64@available
+rule pkg b5ff10fb304d22beedfc0bdb8de3c170 -p122-2-1.x86_64@available
+rule pkg b602e74928d154bfa88425baf159f2df  p19-2-1.x86_64@available
+rule pkg b602e74928d154bfa88425baf159f2df -p18-2-1.x86_64@available
+rule pkg b6a199fdc6f5abe043ce5d611e6e79e0  p95-2-1.x86_64@available
+rule pkg b6a199fdc6f5abe043ce5d611e6e79e0 -p94-2-1.x86_64@available
+rule pkg b6f20c65b638abd71df8eebe8e4503b8 -p109-1-1.x86_64@system
+rule pkg b6f20c65b638abd71df8eebe8e4503b8 -p109-2-1.x86_64@available
+rule pkg b79fe1f0da2b056bcbde50d12f26f3af  p146-1-1.x86_64@system
+rule pkg b79fe1f0da2b056bcbde50d12f26f3af  p146-2-1.x86_64@available
+rule pkg b79fe1f0da2b056bcbde50d12f26f3af -p145-1-1.x86_64@system
+rule pkg b7a16cce86d162a966040f1e67758b27 -old130-1-1.x86_64@available
+rule pkg b7a16cce86d162a966040f1e67758b27 -p130-2-1.x86_64@available
+rule pkg b7fd0b5777d0907cf1cb786620768648  p124-2-1.x86_64@available
+rule pkg b7fd0b5777d0907cf1cb786620768648 -p117-2-1.x86_64@available
+rule pkg b8131a529a020cd5606165f8002c25c9  p39-2-1.x86_64@available
+rule pkg b8131a529a020cd5606165f8002c25c9 -p38-2-1.x86_64@available
+rule pkg b8734babcb7362a9061d38b703e6d8d5 -p64-1-1.x86_64@system
+rule pkg b8734babcb7362a9061d38b703e6d8d5 -p64-2-1.x86_64@available
+rule pkg b92b6c7c905f75abd1932a95affe2326  p113-2-1.x86_64@available
+rule pkg b92b6c7c905f75abd1932a95affe2326 -p106-2-1.x86_64@available
+rule pkg b9744c704f6983c3852c86fddcaa5dcc  p29-2-1.x86_64@available
+rule pkg b9744c704f6983c3852c86fddcaa5dcc -p28-2-1.x86_64@available
+rule pkg b9ad5722595033ef348ae623cee121b6  p58-2-1.x86_64@available
+rule pkg b9ad5722595033ef348ae623cee121b6 -p57-2-1.x86_64@available
+rule pkg b9cb6099032f49768eb20a1bdd8eaeae -old125-1-1.x86_64@available
+rule pkg b9cb6099032f49768eb20a1bdd8eaeae -p125-2-1.x86_64@available
+rule pkg ba2995e794c9e7da324e2cd8b825a73f  p6-2-1.x86_64@available
+rule pkg ba2995e794c9e7da324e2cd8b825a73f -p5-2-1.x86_64@available
+rule pkg ba9f3d553a6cb4c2bda7972cfd0abcfd  p5-2-1.x86_64@available
+rule pkg ba9f3d553a6cb4c2bda7972cfd0abcfd -p148-2-1.x86_64@available
+rule pkg bb2aee48cf24e13979fcab82caeb83d0  p79-1-1.x86_64@system
+rule pkg bb2aee48cf24e13979fcab82caeb83d0  p79-2-1.x86_64@available
+rule pkg bb2aee48cf24e13979fcab82caeb83d0 -p78-1-1.x86_64@system
+rule pkg bb6a9e5605fb473e24b286330df29afd -p120-1-1.x86_64@system
+rule pkg bb6a9e5605fb473e24b286330df29afd -p120-2-1.x86_64@available
+rule pkg bb892bdf0ac8eaa7f9048ff1d446e881  p119-2-1.x86_64@available
+rule pkg bb892bdf0ac8eaa7f9048ff1d446e881 -p112-2-1.x86_64@available
+rule pkg bba4d8597cf259020e1a943c8dada31b -p62-1-1.x86_64@system
+rule pkg bba4d8597cf259020e1a943c8dada31b -p62-2-1.x86_64@available
+rule pkg bc8fd0b96346f80346d938b3f84e1d4f  p31-2-1.x86_64@available
+rule pkg bc8fd0b96346f80346d938b3f84e1d4f -p30-2-1.x86_64@available
+rule pkg bcee3d0f0191e73924462270dc951dfe  p88-2-1.x86_64@available
+rule pkg bcee3d0f0191e73924462270dc951dfe -p81-2-1.x86_64@available
+rule pkg bcf538f6423e8840dd51a9675249d745  p19-1-1.x86_64@system
+rule pkg bcf538f6423e8840dd51a9675249d745  p19-2-1.x86_64@available
+rule pkg bcf538f6423e8840dd51a9675249d745 -p18-1-1.x86_64@system
+rule pkg bcffafcbf91e2756ceff761306a275ea  p101-2-1.x86_64@available
+rule pkg bcffafcbf91e2756ceff761306a275ea -p100-2-1.x86_64@available
+rule pkg bd020b1b4c6e6d5ca208a43b98294b2f  p60-2-1.x86_64@available
+rule pkg bd020b1b4c6e6d5ca208a43b98294b2f -p59-2-1.x86_64@available
+rule pkg bd33d7ba64ed21f1d28aa0e3f33852f5  p143-2-1.x86_64@available
+rule pkg bd33d7ba64ed21f1d28aa0e3f33852f5 -p136-2-1.x86_64@available
+rule pkg bd96bdb03384f486fb8dfa3abafc9acd  p52-2-1.x86_64@available
+rule pkg bd96bdb03384f486fb8dfa3abafc9acd -p51-2-1.x86_64@available
+rule pkg bd996f19a326cfafb644571b071ef2d8  p116-2-1.x86_64@available
+rule pkg bd996f19a326cfafb644571b071ef2d8 -p115-2-1.x86_64@available
+rule pkg bdbe2f631e38c5c94790c30a1db1e6f2 -p60-2-1.x86_64@available
+rule pkg bdbe2f631e38c5c94790c30a1db1e6f2 -p63-1-1.x86_64@system
+rule pkg be6eacfaae7b07b2fd5ab6b3c77b2656  p74-2-1.x86_64@available
+rule pkg be6eacfaae7b07b2fd5ab6b3c77b2656 -p67-2-1.x86_64@available
+rule pkg beddf124ccd1498742178941043da9b1  p99-2-1.x86_64@available
+rule pkg beddf124ccd1498742178941043da9b1 -p98-2-1.x86_64@available
+rule pkg bf9b1f274297989a35374bc2a4a057c8  p2-1-1.x86_64@system
+rule pkg bf9b1f274297989a35374bc2a4a057c8  p2-2-1.x86_64@available
+rule pkg bf9b1f274297989a35374bc2a4a057c8 -p1-1-1.x86_64@system
+rule pkg bf9d19adcaa8bbf1f833f7fc9b68ac66 -p59-2-1.x86_64@available
+rule pkg bf9d19adcaa8bbf1f833f7fc9b68ac66 -p62-1-1.x86_64@system
+rule pkg bfefd5122ed0558b8e94c22e6cfd5da1 -p55-2-1.x86_64@available
+rule pkg bfefd5122ed0558b8e94c22e6cfd5da1 -p58-1-1.x86_64@system
+rule pkg c08c638ced1b7ce1e41e596c1b17397e  p25-2-1.x86_64@available
+rule pkg c08c638ced1b7ce1e41e596c1b17397e -p24-2-1.x86_64@available
+rule pkg c0c470792c25ab506540833c2b43da1b  p90-2-1.x86_64@available
+rule pkg c0c470792c25ab506540833c2b43da1b -p89-2-1.x86_64@available
+rule pkg c0f2693d4f1e0c47f0ea6779a7da08f0  p142-2-1.x86_64@available
+rule pkg c0f2693d4f1e0c47f0ea6779a7da08f0 -p135-2-1.x86_64@available
+rule pkg c10e9486b9a4474fcd392c0d2954a4d6  p42-2-1.x86_64@available
+rule pkg c10e9486b9a4474fcd392c0d2954a4d6 -p41-2-1.x86_64@available
+rule pkg c12864122b285a3618a517f1f23446ba -p5-2-1.x86_64@available
+rule pkg c12864122b285a3618a517f1f23446ba -p8-1-1.x86_64@system
+rule pkg c1323fb77f0b2818d66ca4730ad4aba9  p24-2-1.x86_64@available
+rule pkg c1323fb77f0b2818d66ca4730ad4aba9 -p17-2-1.x86_64@available
+rule pkg c15dca584e791edfb03c5b38f2500c36  p102-2-1.x86_64@available
+rule pkg c15dca584e791edfb03c5b38f2500c36 -p95-2-1.x86_64@available
+rule pkg c175455def321ca910a11415ba37948b -p63-2-1.x86_64@available
+rule pkg c175455def321ca910a11415ba37948b -p66-1-1.x86_64@system
+rule pkg c1a4701bdab6fb54b331e964b6e353f2  p144-2-1.x86_64@available
+rule pkg c1a4701bdab6fb54b331e964b6e353f2 -p143-2-1.x86_64@available
+rule pkg c1bd838b6233b400b6e4a8cc336f85a4 -p42-1-1.x86_64@system
+rule pkg c1bd838b6233b400b6e4a8cc336f85a4 -p42-2-1.x86_64@available
+rule pkg c25bbeab32d5f376339f5dc87ca79dc0 -p100-2-1.x86_64@available
+rule pkg c25bbeab32d5f376339f5dc87ca79dc0 -p103-1-1.x86_64@system
+rule pkg c30058c8b4b50e3190624127bd8357e7  p131-1-1.x86_64@system
+rule pkg c30058c8b4b50e3190624127bd8357e7  p131-2-1.x86_64@available
+rule pkg c30058c8b4b50e3190624127bd8357e7 -p130-1-1.x86_64@system
+rule pkg c342ed80988be2cf4f6eeba71d05422d -old120-1-1.x86_64@available
+rule pkg c342ed80988be2cf4f6eeba71d05422d -p120-2-1.x86_64@available
+rule pkg c3912ee33f2b0ee6d3b398467be17008  p70-2-1.x86_64@available
+rule pkg c3912ee33f2b0ee6d3b398467be17008 -p63-2-1.x86_64@available
+rule pkg c3ad1886bf97516ad0aacbc29efc795d  p110-2-1.x86_64@available
+rule pkg c3ad1886bf97516ad0aacbc29efc795d -p103-2-1.x86_64@available
+rule pkg c42e04e9a1131c0c2c9e2e1d20447765  p84-2-1.x86_64@available
+rule pkg c42e04e9a1131c0c2c9e2e1d20447765 -p83-2-1.x86_64@available
+rule pkg c48b95554363ab8dab45e809b0d49594 -p28-2-1.x86_64@available
+rule pkg c48b95554363ab8dab45e809b0d49594 -p31-1-1.x86_64@system
+rule pkg c54ec1ec5f2c6a608d702708ac42b3ba  p40-2-1.x86_64@available
+rule pkg c54ec1ec5f2c6a608d702708ac42b3ba -p39-2-1.x86_64@available
+rule pkg c5c7af58c130f4b49ec7b3df556d72d3  p147-2-1.x86_64@available
+rule pkg c5c7af58c130f4b49ec7b3df556d72d3 -p140-2-1.x86_64@available
+rule pkg c5d5cb8c709627b20039f4a32a8bbf3b  p36-2-1.x86_64@available
+rule pkg c5d5cb8c709627b20039f4a32a8bbf3b -p35-2-1.x86_64@available
+rule pkg c6cd03f513b94ee8bd87b21a6986c284  p39-1-1.x86_64@system
+rule pkg c6cd03f513b94ee8bd87b21a6986c284  p39-2-1.x86_64@available
+rule pkg c6cd03f513b94ee8bd87b21a6986c284 -p38-1-1.x86_64@system
+rule pkg c74f318b0de06cae2e5f2147e2d3518c  p46-2-1.x86_64@available
+rule pkg c74f318b0de06cae2e5f2147e2d3518c -p45-2-1.x86_64@available
+rule pkg c801d8dd8cd004833c054f0a5833e222 -p76-1-1.x86_64@system
+rule pkg c801d8dd8cd004833c054f0a5833e222 -p76-2-1.x86_64@available
+rule pkg c82155dff5f9109628d2a9c9371fe3c6  p98-2-1.x86_64@available
+rule pkg c82155dff5f9109628d2a9c9371fe3c6 -p97-2-1.x86_64@available
+rule pkg c87d5ec0cd8c392f372fc6674191d1d6  p80-2-1.x86_64@available
+rule pkg c87d5ec0cd8c392f372fc6674191d1d6 -p79-2-1.x86_64@available
+rule pkg c91aae698461d1c7af3e65b0a4a3b4df -p91-1-1.x86_64@system
+rule pkg c91aae698461d1c7af3e65b0a4a3b4df -p91-2-1.x86_64@available
+rule pkg c94a3f89801ba02fd87bbff8e364584d  p85-1-1.x86_64@system
+rule pkg c94a3f89801ba02fd87bbff8e364584d  p85-2-1.x86_64@available
+rule pkg c94a3f89801ba02fd87bbff8e364584d -p84-1-1.x86_64@system
+rule pkg c9f198dd73435986f3c2d35edc4116a8 -p0-1-1.x86_64@system
+rule pkg c9f198dd73435986f3c2d35edc4116a8 -p0-2-1.x86_64@available
+rule pkg ca38ec52a7bee2763604293aab269084  p88-2-1.x86_64@available
+rule pkg ca38ec52a7bee2763604293aab269084 -p87-2-1.x86_64@available
+rule pkg ca6893e9d2160a02d10a9f3c6e328afd -p51-2-1.x86_64@available
+rule pkg ca6893e9d2160a02d10a9f3c6e328afd -p54-1-1.x86_64@system
+rule pkg ca8384805f8d5b9d947ba73cc8f7bc77  p41-1-1.x86_64@system
+rule pkg ca8384805f8d5b9d947ba73cc8f7bc77  p41-2-1.x86_64@available
+rule pkg ca8384805f8d5b9d947ba73cc8f7bc77 -p40-1-1.x86_64@system
+rule pkg cb3dc4ddf609769693a669437787e834 -p10-2-1.x86_64@available
+rule pkg cb3dc4ddf609769693a669437787e834 -p13-1-1.x86_64@system
+rule pkg cc7eb5c6c0a1f9c2ea8d3070433c1637 -p109-2-1.x86_64@available
+rule pkg cc7eb5c6c0a1f9c2ea8d3070433c1637 -p112-1-1.x86_64@system
+rule pkg ccb12de7fe61f349222d02d2faa6e3c7 -p30-1-1.x86_64@system
+rule pkg ccb12de7fe61f349222d02d2faa6e3c7 -p30-2-1.x86_64@available
+rule pkg ccd4b7806e9fe4f2a747f10edf4b3e22 -p4-2-1.x86_64@available
+rule pkg ccd4b7806e9fe4f2a747f10edf4b3e22 -p7-1-1.x86_64@system
+rule pkg ce14a9036f11496ff0564ce6220c2e37  p100-2-1.x86_64@available
+rule pkg ce14a9036f11496ff0564ce6220c2e37 -p99-2-1.x86_64@available
+rule pkg ce353620fdf06a2b328d43fce7914fcf  p60-2-1.x86_64@available
+rule pkg ce353620fdf06a2b328d43fce7914fcf -p53-2-1.x86_64@available
+rule pkg cf6299a4eedf91ae8981fa6d82d5b28a  p94-2-1.x86_64@available
+rule pkg cf6299a4eedf91ae8981fa6d82d5b28a -p93-2-1.x86_64@available
+rule pkg cf73920462437e93e3436d9e69159307 -p117-1-1.x86_64@system
+rule pkg cf73920462437e93e3436d9e69159307 -p117-2-1.x86_64@available
+rule pkg cf75a183fad3d6fe6d272b04fa3b1a32  p17-2-1.x86_64@available
+rule pkg cf75a183fad3d6fe6d272b04fa3b1a32 -p10-2-1.x86_64@available
+rule pkg cff42519b5e07221d4fd31e56c93891c -p3-1-1.x86_64@system
+rule pkg cff42519b5e07221d4fd31e56c93891c -p3-2-1.x86_64@available
+rule pkg d07179a368178d1dc1c3e3e4256f9c83  p131-2-1.x86_64@available
+rule pkg d07179a368178d1dc1c3e3e4256f9c83 -p130-2-1.x86_64@available
+rule pkg d0c6820993dde8ab9e571ae2c0ba4d1d -p129-1-1.x86_64@system
+rule pkg d0c6820993dde8ab9e571ae2c0ba4d1d -p129-2-1.x86_64@available
+rule pkg d1d3a45289477835979bc4a76940a304  p50-1-1.x86_64@system
+rule pkg d1d3a45289477835979bc4a76940a304  p50-2-1.x86_64@available
+rule pkg d1d3a45289477835979bc4a76940a304 -p49-1-1.x86_64@system
+rule pkg d207e4c6c16ae5c683dbb0f7ec839341  p25-2-1.x86_64@available
+rule pkg d207e4c6c16ae5c683dbb0f7ec839341 -p18-2-1.x86_64@available
+rule pkg d210133a308abfcaed47fc6a36006d37 -p89-1-1.x86_64@system
+rule pkg d210133a308abfcaed47fc6a36006d37 -p89-2-1.x86_64@available
+rule pkg d2d6616a552a643107449a7dcfd3ac88  p89-1-1.x86_64@system
+rule pkg d2d6616a552a643107449a7dcfd3ac88  p89-2-1.x86_64@available
+rule pkg d2d6616a552a643107449a7dcfd3ac88 -p88-1-1.x86_64@system
+rule pkg d398cd48a091cec0fe91480d70fd8092 -p111-2-1.x86_64@available
+rule pkg d398cd48a091cec0fe91480d70fd8092 -p114-1-1.x86_64@system
+rule pkg d4094c4d6115bd4bc3f6a9c23fd5e8aa  p88-1-1.x86_64@system
+rule pkg d4094c4d6115bd4bc3f6a9c23fd5e8aa  p88-2-1.x86_64@available
+rule pkg d4094c4d6115bd4bc3f6a9c23fd5e8aa -p87-1-1.x86_64@system
+rule pkg d49aa8cfa15faf00e383dda08b20970f  p144-2-1.x86_64@available
+rule pkg d49aa8cfa15faf00e383dda08b20970f -p137-2-1.x86_64@available
+rule pkg d5178810a52b0224a5d4621bf2adb918 -p21-2-1.x86_64@available
+rule pkg d5178810a52b0224a5d4621bf2adb918 -p24-1-1.x86_64@system
+rule pkg d54483c09a4a012b9322394826fe39ff  p140-2-1.x86_64@available
+rule pkg d54483c09a4a012b9322394826fe39ff -p133-2-1.x86_64@available
+rule pkg d55e750b7a9d62a3f502c901b4d9f0ca -p70-1-1.x86_64@system
+rule pkg d55e750b7a9d62a3f502c901b4d9f0ca -p70-2-1.x86_64@available
+rule pkg d5abb9075199105336de66d747231f48  p145-2-1.x86_64@available
+rule pkg d5abb9075199105336de66d747231f48 -p138-2-1.x86_64@available
+rule pkg d5d4267aedb6a102869a977a58039627 -p12-2-1.x86_64@available
+rule pkg d5d4267aedb6a102869a977a58039627 -p15-1-1.x86_64@system
+rule pkg d5d8bc44f15226a666a0dcf70e3ac5e9  p28-2-1.x86_64@available
+rule pkg d5d8bc44f15226a666a0dcf70e3ac5e9 -p21-2-1.x86_64@available
+rule pkg d60282c758265f25c6220d61c934c381 -p34-1-1.x86_64@system
+rule pkg d60282c758265f25c6220d61c934c381 -p34-2-1.x86_64@available
+rule pkg d619176cb6c2146a0c6a074f7b4fb325 -old45-1-1.x86_64@available
+rule pkg d619176cb6c2146a0c6a074f7b4fb325 -p45-2-1.x86_64@available
+rule pkg d6710daea012c4d43c6eca3ced9336eb -old55-1-1.x86_64@available
+rule pkg d6710daea012c4d43c6eca3ced9336eb -p55-2-1.x86_64@available
+rule pkg d6c7316fa8d5e6b9eadba517bf01115a -p103-2-1.x86_64@available
+rule pkg d6c7316fa8d5e6b9eadba517bf01115a -p106-1-1.x86_64@system
+rule pkg d72baf6f84f4150b237462a26f874344 -p104-2-1.x86_64@available
+rule pkg d72baf6f84f4150b237462a26f874344 -p107-1-1.x86_64@system
+rule pkg d7524c0b72a1d802935e3c41036e996b  p40-1-1.x86_64@system
+rule pkg d7524c0b72a1d802935e3c41036e996b  p40-2-1.x86_64@available
+rule pkg d7524c0b72a1d802935e3c41036e996b -p39-1-1.x86_64@system
+rule pkg d7e175a752250f0b45285c278acee064  p112-2-1.x86_64@available
+rule pkg d7e175a752250f0b45285c278acee064 -p111-2-1.x86_64@available
+rule pkg d7e89133d3eccdfe07b4e496fc5c5a5f -p132-1-1.x86_64@system
+rule pkg d7e89133d3eccdfe07b4e496fc5c5a5f -p132-2-1.x86_64@available
+rule pkg d7f4d30ab86208eba9fd35bbcd7b6d7a -p10-1-1.x86_64@system
+rule pkg d7f4d30ab86208eba9fd35bbcd7b6d7a -p10-2-1.x86_64@available
+rule pkg d7fe1877243183a0eabedea0943ee850  p143-1-1.x86_64@system
+rule pkg d7fe1877243183a0eabedea0943ee850  p143-2-1.x86_64@available
+rule pkg d7fe1877243183a0eabedea0943ee850 -p142-1-1.x86_64@system
+rule pkg d88ff0ac6bbb84d14b3ffcfa2346f125 -p142-1-1.x86_64@system
+rule pkg d88ff0ac6bbb84d14b3ffcfa2346f125 -p142-2-1.x86_64@available
+rule pkg d8e454d3734436976776e74bbf79ab2f  p13-1-1.x86_64@system
+rule pkg d8e454d3734436976776e74bbf79ab2f  p13-2-1.x86_64@available
+rule pkg d8e454d3734436976776e74bbf79ab2f -p12-1-1.x86_64@system
+rule pkg d8ef3614437cc4a8e1302ecd0a31e3cf  p55-1-1.x86_64@system
+rule pkg d8ef3614437cc4a8e1302ecd0a31e3cf  p55-2-1.x86_64@available
+rule pkg d8ef3614437cc4a8e1302ecd0a31e3cf -p54-1-1.x86_64@system
+rule pkg d8fffe5beb50efb833ba319ddefd71de  p4-2-1.x86_64@available
+rule pkg d8fffe5beb50efb833ba319ddefd71de -p3-2-1.x86_64@available
+rule pkg d9c0d10118bd7f5c77d3868341df6a04  p54-1-1.x86_64@system
+rule pkg d9c0d10118bd7f5c77d3868341df6a04  p54-2-1.x86_64@available
+rule pkg d9c0d10118bd7f5c77d3868341df6a04 -p53-1-1.x86_64@system
+rule pkg da7586e5274c74e7f567419a495903b6  p140-1-1.x86_64@system
+rule pkg da7586e5274c74e7f567419a495903b6  p140-2-1.x86_64@available
+rule pkg da7586e5274c74e7f567419a495903b6 -p139-1-1.x86_64@system
+rule pkg daad1e8f584357292932c099d514265e  p15-2-1.x86_64@available
+rule pkg daad1e8f584357292932c099d514265e -p8-2-1.x86_64@available
+rule pkg daf1cce0341d7545268e580789dfa01e  p92-2-1.x86_64@available
+rule pkg daf1cce0341d7545268e580789dfa01e -p91-2-1.x86_64@available
+rule pkg db1db22ffadcb46f936fee11a0cc9764  p138-2-1.x86_64@available
+rule pkg db1db22ffadcb46f936fee11a0cc9764 -p137-2-1.x86_64@available
+rule pkg dbc2c32795a2be3b2e41076c6888e463  p139-1-1.x86_64@system
+rule pkg dbc2c32795a2be3b2e41076c6888e463  p139-2-1.x86_64@available
+rule pkg dbc2c32795a2be3b2e41076c6888e463 -p138-1-1.x86_64@system
+rule pkg dd65d3002c3184242fd4ccc479ffb4b5  p100-1-1.x86_64@system
+rule pkg dd65d3002c3184242fd4ccc479ffb4b5  p100-2-1.x86_64@available
+rule pkg dd65d3002c3184242fd4ccc479ffb4b5 -p99-1-1.x86_64@system
+rule pkg ddb21cf7819621e14a380f8ac7263a49  p122-1-1.x86_64@system
+rule pkg ddb21cf7819621e14a380f8ac7263a49  p122-2-1.x86_64@available
+rule pkg ddb21cf7819621e14a380f8ac7263a49 -p121-1-1.x86_64@system
+rule pkg de63776dad52e21a527ea9097182ac8e  p76-2-1.x86_64@available
+rule pkg de63776dad52e21a527ea9097182ac8e -p75-2-1.x86_64@available
+rule pkg de6640df1258ff59b4a7b12c918dc690 -p47-1-1.x86_64@system
+rule pkg de6640df1258ff59b4a7b12c918dc690 -p47-2-1.x86_64@available
+rule pkg de87e8604445d5ebc47992c1928faaec  p33-2-1.x86_64@available
+rule pkg de87e8604445d5ebc47992c1928faaec -p26-2-1.x86_64@available
+rule pkg de974ec837eadf8a1d8fa950d0f8f17a  p37-2-1.x86_64@available
+rule pkg de974ec837eadf8a1d8fa950d0f8f17a -p30-2-1.x86_64@available
+rule pkg dea5f515ed78bedebcc7cd481152d59a  p131-2-1.x86_64@available
+rule pkg dea5f515ed78bedebcc7cd481152d59a -p124-2-1.x86_64@available
+rule pkg deb337c8218eebd38591fcf7d44e0ac6  p67-2-1.x86_64@available
+rule pkg deb337c8218eebd38591fcf7d44e0ac6 -p60-2-1.x86_64@available
+rule pkg deeeb5c96f14f074cde96b25ee3797e2  p142-2-1.x86_64@available
+rule pkg deeeb5c96f14f074cde96b25ee3797e2 -p141-2-1.x86_64@available
+rule pkg df56498c1b20a6f5d4ea0e46ca17f39b  p61-2-1.x86_64@available
+rule pkg df56498c1b20a6f5d4ea0e46ca17f39b -p54-2-1.x86_64@available
+rule pkg e08b1dbdab795fe4f7fbc22b6604e13f  p75-1-1.x86_64@system
+rule pkg e08b1dbdab795fe4f7fbc22b6604e13f  p75-2-1.x86_64@available
+rule pkg e08b1dbdab795fe4f7fbc22b6604e13f -p74-1-1.x86_64@system
+rule pkg e1cd477c31b8a517e92cf3c00770fba8 -p29-1-1.x86_64@system
+rule pkg e1cd477c31b8a517e92cf3c00770fba8 -p29-2-1.x86_64@available
+rule pkg e1de2022440a0ff8471025c66abae005 -p36-2-1.x86_64@available
+rule pkg e1de2022440a0ff8471025c66abae005 -p39-1-1.x86_64@system
+rule pkg e1e1b4b353c0167a9c9ca4ddb122b04c  p10-2-1.x86_64@available
+rule pkg e1e1b4b353c0167a9c9ca4ddb122b04c -p9-2-1.x86_64@available
+rule pkg e203406640c9b80651d55af726844354 -p125-1-1.x86_64@system
+rule pkg e203406640c9b80651d55af726844354 -p125-2-1.x86_64@available
+rule pkg e2d817113b96f8044f89173cdf16572d -p112-1-1.x86_64@system
+rule pkg e2d817113b96f8044f89173cdf16572d -p112-2-1.x86_64@available
+rule pkg e38cb3ede8206666cdc2df26cde07336  p104-2-1.x86_64@available
+rule pkg e38cb3ede8206666cdc2df26cde07336 -p97-2-1.x86_64@available
+rule pkg e41f74e15523eb7c04ac759ffb5518a3 -p95-1-1.x86_64@system
+rule pkg e41f74e15523eb7c04ac759ffb5518a3 -p95-2-1.x86_64@available
+rule pkg e47c26ca04ddf05a634865db578c4dec  p17-1-1.x86_64@system
+rule pkg e47c26ca04ddf05a634865db578c4dec  p17-2-1.x86_64@available
+rule pkg e47c26ca04ddf05a634865db578c4dec -p16-1-1.x86_64@system
+rule pkg e5563fa49c15e576ab8742935b73611a  p14-2-1.x86_64@available
+rule pkg e5563fa49c15e576ab8742935b73611a -p7-2-1.x86_64@available
+rule pkg e565e577fe06aa5ad44c1352f7b8c20c  p29-1-1.x86_64@system
+rule pkg e565e577fe06aa5ad44c1352f7b8c20c  p29-2-1.x86_64@available
+rule pkg e565e577fe06aa5ad44c1352f7b8c20c -p28-1-1.x86_64@system
+rule pkg e5803e8f42b720d6288551bc1a7a7a09 -p127-1-1.x86_64@system
+rule pkg e5803e8f42b720d6288551bc1a7a7a09 -p127-2-1.x86_64@available
+rule pkg e598bb4af68f48627a1e75fd96256de2 -p38-2-1.x86_64@available
+rule pkg e598bb4af68f48627a1e75fd96256de2 -p41-1-1.x86_64@system
+rule pkg e6bdc8e2de67a7fc7e4c751464b4c9d6  p70-1-1.x86_64@system
+rule pkg e6bdc8e2de67a7fc7e4c751464b4c9d6  p70-2-1.x86_64@available
+rule pkg e6bdc8e2de67a7fc7e4c751464b4c9d6 -p69-1-1.x86_64@system
+rule pkg e739bd0329278d769a43a40cad8afaf5  p93-2-1.x86_64@available
+rule pkg e739bd0329278d769a43a40cad8afaf5 -p92-2-1.x86_64@available
+rule pkg e7c1d9b0dbff6901392b31f89229c229  p132-2-1.x86_64@available
+rule pkg e7c1d9b0dbff6901392b31f89229c229 -p131-2-1.x86_64@available
+rule pkg e7f3a9984a70d5ac8e6c5c98cdb5c989 -old90-1-1.x86_64@available
+rule pkg e7f3a9984a70d5ac8e6c5c98cdb5c989 -p90-2-1.x86_64@available
+rule pkg e826dc0d61de98059caa28ff8df3c9ee  p51-1-1.x86_64@system
+rule pkg e826dc0d61de98059caa28ff8df3c9ee  p51-2-1.x86_64@available
+rule pkg e826dc0d61de98059caa28ff8df3c9ee -p50-1-1.x86_64@system
+rule pkg e85c3aa1f2e5386aa3ecb0bf80a0ad52  p61-2-1.x86_64@available
+rule pkg e85c3aa1f2e5386aa3ecb0bf80a0ad52 -p60-2-1.x86_64@available
+rule pkg e8a2f49636f80ccbdaae1e405123ea17 -p133-2-1.x86_64@available
+rule pkg e8a2f49636f80ccbdaae1e405123ea17 -p136-1-1.x86_64@system
+rule pkg e8a5cb080580c962739ed187e4aa9da5 -p102-1-1.x86_64@system
+rule pkg e8a5cb080580c962739ed187e4aa9da5 -p102-2-1.x86_64@available
+rule pkg e92e5c4227351289e4fd60c0fa4eab21  p69-2-1.x86_64@available
+rule pkg e92e5c4227351289e4fd60c0fa4eab21 -p62-2-1.x86_64@available
+rule pkg e9391269e78c73a9cd847a2107f59e1d  p72-2-1.x86_64@available
+rule pkg e9391269e78c73a9cd847a2107f59e1d -p65-2-1.x86_64@available
+rule pkg e9930bf1f9b5c77d8df478f5129c1533  p120-2-1.x86_64@available
+rule pkg e9930bf1f9b5c77d8df478f5129c1533 -p119-2-1.x86_64@available
+rule pkg e9ffe5ebcad5c2c7ea7cf0273f923b49 -old80-1-1.x86_64@available
+rule pkg e9ffe5ebcad5c2c7ea7cf0273f923b49 -p80-2-1.x86_64@available
+rule pkg ea111e50a52abc68c22c891e24a5b035 -p26-2-1.x86_64@available
+rule pkg ea111e50a52abc68c22c891e24a5b035 -p29-1-1.x86_64@system
+rule pkg ea1a6df599cec71c51a43f2531f097c8  p148-1-1.x86_64@system
+rule pkg ea1a6df599cec71c51a43f2531f097c8  p148-2-1.x86_64@available
+rule pkg ea1a6df599cec71c51a43f2531f097c8 -p147-1-1.x86_64@system
+rule pkg ead817ebdd8a7ff48088afa2f13c6499  p129-1-1.x86_64@system
+rule pkg ead817ebdd8a7ff48088afa2f13c6499  p129-2-1.x86_64@available
+rule pkg ead817ebdd8a7ff48088afa2f13c6499 -p128-1-1.x86_64@system
+rule pkg eb10426beadfe74c8a647154b02b6131  p19-2-1.x86_64@available
+rule pkg eb10426beadfe74c8a647154b02b6131 -p12-2-1.x86_64@available
+rule pkg eb85f7808e3d36ef98ec3e06d4f911cf  p130-2-1.x86_64@available
+rule pkg eb85f7808e3d36ef98ec3e06d4f911cf -p129-2-1.x86_64@available
+rule pkg eba3ed2af9ade08ea936583cd816b403 -p27-2-1.x86_64@available
+rule pkg eba3ed2af9ade08ea936583cd816b403 -p30-1-1.x86_64@system
+rule pkg ebb9eebb40f8de307297bd1fd70ac5ca -p107-1-1.x86_64@system
+rule pkg ebb9eebb40f8de307297bd1fd70ac5ca -p107-2-1.x86_64@available
+rule pkg ec093d07abbbab10886403b63297faab  p70-2-1.x86_64@available
+rule pkg ec093d07abbbab10886403b63297faab -p69-2-1.x86_64@available
+rule pkg ec18b8e056ceaf79dbef79dfbb10fcbc  p92-2-1.x86_64@available
+rule pkg ec18b8e056ceaf79dbef79dfbb10fcbc -p85-2-1.x86_64@available
+rule pkg ec92b1aa5b65a51ebea4b91a133df9be  p31-1-1.x86_64@system
+rule pkg ec92b1aa5b65a51ebea4b91a133df9be  p31-2-1.x86_64@available
+rule pkg ec92b1aa5b65a51ebea4b91a133df9be -p30-1-1.x86_64@system
+rule pkg ed647c5f54df9696a95c60639f9119af  p146-2-1.x86_64@available
+rule pkg ed647c5f54df9696a95c60639f9119af -p139-2-1.x86_64@available
+rule pkg ed64b2e3320d780f7dee6b55b1c6ac80  p68-2-1.x86_64@available
+rule pkg ed64b2e3320d780f7dee6b55b1c6ac80 -p67-2-1.x86_64@available
+rule pkg edf9adb9f8aa8886ed8961c1a1848587  p80-2-1.x86_64@available
+rule pkg edf9adb9f8aa8886ed8961c1a1848587 -p73-2-1.x86_64@available
+rule pkg ee2494392cd135ce3419f40c478f818d -p12-1-1.x86_64@system
+rule pkg ee2494392cd135ce3419f40c478f818d -p9-2-1.x86_64@available
+rule pkg ee28f04743623e2b06393e574b6a9882  p6-2-1.x86_64@available
+rule pkg ee28f04743623e2b06393e574b6a9882 -p149-2-1.x86_64@available
+rule pkg ee5d1b2e12d00a5345d204bae5c62660  p108-2-1.x86_64@available
+rule pkg ee5d1b2e12d00a5345d204bae5c62660 -p101-2-1.x86_64@available
+rule pkg eeaabed0d08f9cb91d8a2016170377dd  p127-2-1.x86_64@available
+rule pkg eeaabed0d08f9cb91d8a2016170377dd -p120-2-1.x86_64@available
+rule pkg ef2f39fc5737b9ddfe56c8438ef06089  p30-2-1.x86_64@available
+rule pkg ef2f39fc5737b9ddfe56c8438ef06089 -p29-2-1.x86_64@available
+rule pkg efbc00ec4bd5544cd5c1e6f7665acd49 -p21-1-1.x86_64@system
+rule pkg efbc00ec4bd5544cd5c1e6f7665acd49 -p21-2-1.x86_64@available
+rule pkg efd82b05ddd3e68925135919b51beb8b  p117-1-1.x86_64@system
+rule pkg efd82b05ddd3e68925135919b51beb8b  p117-2-1.x86_64@available
+rule pkg efd82b05ddd3e68925135919b51beb8b -p116-1-1.x86_64@system
+rule pkg efde589df689590f5c177a4a25f13d57 -p101-1-1.x86_64@system
+rule pkg efde589df689590f5c177a4a25f13d57 -p98-2-1.x86_64@available
+rule pkg eff0d0069b2d20366447d957d1d16125  p21-2-1.x86_64@available
+rule pkg eff0d0069b2d20366447d957d1d16125 -p20-2-1.x86_64@available
+rule pkg f12458523cae338d727de74d506be73f -p18-2-1.x86_64@available
+rule pkg f12458523cae338d727de74d506be73f -p21-1-1.x86_64@system
+rule pkg f12a2a35cd8ff52d56f277baf3a81dea -p23-1-1.x86_64@system
+rule pkg f12a2a35cd8ff52d56f277baf3a81dea -p23-2-1.x86_64@available
+rule pkg f12c8d47f2962722cea394b39f2a8409  p121-2-1.x86_64@available
+rule pkg f12c8d47f2962722cea394b39f2a8409 -p120-2-1.x86_64@available
+rule pkg f1dfe3f41a6a4101d54149d555a3d03f -p137-2-1.x86_64@available
+rule pkg f1dfe3f41a6a4101d54149d555a3d03f -p140-1-1.x86_64@system
+rule pkg f1f6656dddb8645b57b9a857ec996c4e  p142-1-1.x86_64@system
+rule pkg f1f6656dddb8645b57b9a857ec996c4e  p142-2-1.x86_64@available
+rule pkg f1f6656dddb8645b57b9a857ec996c4e -p141-1-1.x86_64@system
+rule pkg f20f2f071ad77ef04a75d2e52f4ad7ee -p95-2-1.x86_64@available
+rule pkg f20f2f071ad77ef04a75d2e52f4ad7ee -p98-1-1.x86_64@system
+rule pkg f21eafe3e4f8d0016d7acd247306bcd0  p12-2-1.x86_64@available
+rule pkg f21eafe3e4f8d0016d7acd247306bcd0 -p11-2-1.x86_64@available
+rule pkg f2245ae48cbab1b73227b0857e04191a -old60-1-1.x86_64@available
+rule pkg f2245ae48cbab1b73227b0857e04191a -p60-2-1.x86_64@available
+rule pkg f245d85d16a402bf065ad5b1164fc85e  p82-1-1.x86_64@system
+rule pkg f245d85d16a402bf065ad5b1164fc85e  p82-2-1.x86_64@available
+rule pkg f245d85d16a402bf065ad5b1164fc85e -p81-1-1.x86_64@system
+rule pkg f25725d3f61da497070dddbecc9a3904  p56-1-1.x86_64@system
+rule pkg f25725d3f61da497070dddbecc9a3904  p56-2-1.x86_64@available
+rule pkg f25725d3f61da497070dddbecc9a3904 -p55-1-1.x86_64@system
+rule pkg f2764240ce329160c1c0e51d8fff532c  p51-2-1.x86_64@available
+rule pkg f2764240ce329160c1c0e51d8fff532c -p50-2-1.x86_64@available
+rule pkg f276c56de62b0513a5f364b06d57ad3d -p122-2-1.x86_64@available
+rule pkg f276c56de62b0513a5f364b06d57ad3d -p125-1-1.x86_64@system
+rule pkg f290182f9b0fcb3e629c944418feb423  p66-2-1.x86_64@available
+rule pkg f290182f9b0fcb3e629c944418feb423 -p65-2-1.x86_64@available
+rule pkg f329cc330c48c53f1c4f3448c27ad06e  p115-1-1.x86_64@system
+rule pkg f329cc330c48c53f1c4f3448c27ad06e  p115-2-1.x86_64@available
+rule pkg f329cc330c48c53f1c4f3448c27ad06e -p114-1-1.x86_64@system
+rule pkg f337bfbb196a222063ac2b2d929df01b -p32-2-1.x86_64@available
+rule pkg f337bfbb196a222063ac2b2d929df01b -p35-1-1.x86_64@system
+rule pkg f36e84d14f2a5cb8c15ea8f9a7a9ac6f  p33-2-1.x86_64@available
+rule pkg f36e84d14f2a5cb8c15ea8f9a7a9ac6f -p32-2-1.x86_64@available
+rule pkg f37489a65363fe0db06e44b9563e49f8 -p31-2-1.x86_64@available
+rule pkg f37489a65363fe0db06e44b9563e49f8 -p34-1-1.x86_64@system
+rule pkg f3966b01250208c4541a455928328328  p132-1-1.x86_64@system
+rule pkg f3966b01250208c4541a455928328328  p132-2-1.x86_64@available
+rule pkg f3966b01250208c4541a455928328328 -p131-1-1.x86_64@system
+rule pkg f3a9a5dbc629b7c20af22b9e8f3e5461 -p26-1-1.x86_64@system
+rule pkg f3a9a5dbc629b7c20af22b9e8f3e5461 -p26-2-1.x86_64@available
+rule pkg f3f9ba326c16db77b1f4bf401ac3fbef -p119-1-1.x86_64@system
+rule pkg f3f9ba326c16db77b1f4bf401ac3fbef -p119-2-1.x86_64@available
+rule pkg f47e546c8acdc8150bd22ad2d3ae08c1 -p75-2-1.x86_64@available
+rule pkg f47e546c8acdc8150bd22ad2d3ae08c1 -p78-1-1.x86_64@system
+rule pkg f48ab1142d05c24c5056bd2f70cf0969 -p38-1-1.x86_64@system
+rule pkg f48ab1142d05c24c5056bd2f70cf0969 -p38-2-1.x86_64@available
+rule pkg f4a2991cc1145f130a11f2570965fec9  p4-2-1.x86_64@available
+rule pkg f4a2991cc1145f130a11f2570965fec9 -p147-2-1.x86_64@available
+rule pkg f4a9d88b4fa608a98798af1b87c32d8a  p141-2-1.x86_64@available
+rule pkg f4a9d88b4fa608a98798af1b87c32d8a -p134-2-1.x86_64@available
+rule pkg f5196972b57af578526e9deb60845dd6 -p43-1-1.x86_64@system
+rule pkg f5196972b57af578526e9deb60845dd6 -p43-2-1.x86_64@available
+rule pkg f56e927441b9c72380aa2eb315ff7362  p42-1-1.x86_64@system
+rule pkg f56e927441b9c72380aa2eb315ff7362  p42-2-1.x86_64@available
+rule pkg f56e927441b9c72380aa2eb315ff7362 -p41-1-1.x86_64@system
+rule pkg f5c8f4439abc990a55f9d196a1a77771  p134-2-1.x86_64@available
+rule pkg f5c8f4439abc990a55f9d196a1a77771 -p127-2-1.x86_64@available
+rule pkg f653ceabb07859725b04fe7a9c8cc200 -p27-1-1.x86_64@system
+rule pkg f653ceabb07859725b04fe7a9c8cc200 -p27-2-1.x86_64@available
+rule pkg f71ce8df979ae11ce48763fac2f69961  p125-1-1.x86_64@system
+rule pkg f71ce8df979ae11ce48763fac2f69961  p125-2-1.x86_64@available
+rule pkg f71ce8df979ae11ce48763fac2f69961 -p124-1-1.x86_64@system
+rule pkg f734e1f8fe938111a0bbb2a150d88c0a -p28-1-1.x86_64@system
+rule pkg f734e1f8fe938111a0bbb2a150d88c0a -p28-2-1.x86_64@available
+rule pkg f752b70d815db768f21c28adf53b8893  p30-1-1.x86_64@system
+rule pkg f752b70d815db768f21c28adf53b8893  p30-2-1.x86_64@available
+rule pkg f752b70d815db768f21c28adf53b8893 -p29-1-1.x86_64@system
+rule pkg f7b03f98b4d4d8c4f4f93c05a0dd7d8a -p121-2-1.x86_64@available
+rule pkg f7b03f98b4d4d8c4f4f93c05a0dd7d8a -p124-1-1.x86_64@system
+rule pkg f85d38bef490bc575783007a33840aee  p16-1-1.x86_64@system
+rule pkg f85d38bef490bc575783007a33840aee  p16-2-1.x86_64@available
+rule pkg f85d38bef490bc575783007a33840aee -p15-1-1.x86_64@system
+rule pkg f8792e3dc2c55b6debb8abc931b8477e  p24-2-1.x86_64@available
+rule pkg f8792e3dc2c55b6debb8abc931b8477e -p23-2-1.x86_64@available
+rule pkg f87ec890de9c9b72f73862f1c35e0db9 -p140-2-1.x86_64@available
+rule pkg f87ec890de9c9b72f73862f1c35e0db9 -p143-1-1.x86_64@system
+rule pkg f88e9334fd15ddc70fa52d48ed8336a7 -p74-1-1.x86_64@system
+rule pkg f88e9334fd15ddc70fa52d48ed8336a7 -p74-2-1.x86_64@available
+rule pkg f9ddd628d64ffcd9fd08839985936f64 -p60-1-1.x86_64@system
+rule pkg f9ddd628d64ffcd9fd08839985936f64 -p60-2-1.x86_64@available
+rule pkg fa9d24795448119c1c8f722716abf840  p137-2-1.x86_64@available
+rule pkg fa9d24795448119c1c8f722716abf840 -p136-2-1.x86_64@available
+rule pkg faa897139c72ced71ae0f4a9d46b6543 -p116-2-1.x86_64@available
+rule pkg faa897139c72ced71ae0f4a9d46b6543 -p119-1-1.x86_64@system
+rule pkg faef08b2843dc39786da59e6d279c559 -old95-1-1.x86_64@available
+rule pkg faef08b2843dc39786da59e6d279c559 -p95-2-1.x86_64@available
+rule pkg fb3e0d017ce3b4e86b944552cfab40f9  p53-2-1.x86_64@available
+rule pkg fb3e0d017ce3b4e86b944552cfab40f9 -p52-2-1.x86_64@available
+rule pkg fc0f67dcf0facb6370e899a7f8c678df  p40-2-1.x86_64@available
+rule pkg fc0f67dcf0facb6370e899a7f8c678df -p33-2-1.x86_64@available
+rule pkg fc4e62092203d857a9f6ef9a1954a7e2 -p96-2-1.x86_64@available
+rule pkg fc4e62092203d857a9f6ef9a1954a7e2 -p99-1-1.x86_64@system
+rule pkg fc7a01a296ce9c089d14fdcec883b70e -p34-2-1.x86_64@available
+rule pkg fc7a01a296ce9c089d14fdcec883b70e -p37-1-1.x86_64@system
+rule pkg fcbd0260841a052bcd056d5bc6b859bc  p64-1-1.x86_64@system
+rule pkg fcbd0260841a052bcd056d5bc6b859bc  p64-2-1.x86_64@available
+rule pkg fcbd0260841a052bcd056d5bc6b859bc -p63-1-1.x86_64@system
+rule pkg fcecf0c00736ec4cd841ab8583c1a858  p26-2-1.x86_64@available
+rule pkg fcecf0c00736ec4cd841ab8583c1a858 -p25-2-1.x86_64@available
+rule pkg fd358af7aaaf0dbfb524885dff6d194f -p100-1-1.x86_64@system
+rule pkg fd358af7aaaf0dbfb524885dff6d194f -p100-2-1.x86_64@available
+rule pkg fdba4adec06c4ab212681ccf7cef727b -p33-2-1.x86_64@available
+rule pkg fdba4adec06c4ab212681ccf7cef727b -p36-1-1.x86_64@system
+rule pkg fe8f5849d01f5d08662afe147f1049b4  p18-2-1.x86_64@available
+rule pkg fe8f5849d01f5d08662afe147f1049b4 -p11-2-1.x86_64@available
+rule pkg fefe6381dbca4afd3ad7815dcd5db990  p10-1-1.x86_64@system
+rule pkg fefe6381dbca4afd3ad7815dcd5db990  p10-2-1.x86_64@available
+rule pkg fefe6381dbca4afd3ad7815dcd5db990 -p9-1-1.x86_64@system
+rule pkg ff40edc9df15ffc70426cb41e33c2b3c -p143-1-1.x86_64@system
+rule pkg ff40edc9df15ffc70426cb41e33c2b3c -p143-2-1.x86_64@available
+rule pkg ffb1334c2e10ca3b482ad65a831c3043 -p84-1-1.x86_64@system
+rule pkg ffb1334c2e10ca3b482ad65a831c3043 -p84-2-1.x86_64@available
+rule pkg ffdb85c9da475571c6836fbb734305e4  p49-2-1.x86_64@available
+rule pkg ffdb85c9da475571c6836fbb734305e4 -p48-2-1.x86_64@available
+rule update 062c6012979497f6c02ae3ed1e794ae5  p106-1-1.x86_64@system
+rule update 062c6012979497f6c02ae3ed1e794ae5  p106-2-1.x86_64@available
+rule update 0c434ada6998096e72b1933fe730f381  p73-1-1.x86_64@system
+rule update 0c434ada6998096e72b1933fe730f381  p73-2-1.x86_64@available
+rule update 0d7745a3a2b98b3dc62498a255c774c3  p110-1-1.x86_64@system
+rule update 0d7745a3a2b98b3dc62498a255c774c3  p110-2-1.x86_64@available
+rule update 0dbfb7fd523c6784f10aad1b94639260  p53-1-1.x86_64@system
+rule update 0dbfb7fd523c6784f10aad1b94639260  p53-2-1.x86_64@available
+rule update 0fad5b7963ca522f585dadbb62b4d008  p109-1-1.x86_64@system
+rule update 0fad5b7963ca522f585dadbb62b4d008  p109-2-1.x86_64@available
+rule update 125a29424b102ec565fe0d139867722b  p137-1-1.x86_64@system
+rule update 125a29424b102ec565fe0d139867722b  p137-2-1.x86_64@available
+rule update 127b051d86d1409c76bb337981883ae3  p100-1-1.x86_64@system
+rule update 127b051d86d1409c76bb337981883ae3  p100-2-1.x86_64@available
+rule update 13b6edab20c6ee4b4f0c5f6c905ecddb  p138-1-1.x86_64@system
+rule update 13b6edab20c6ee4b4f0c5f6c905ecddb  p138-2-1.x86_64@available
+rule update 145a1b06449b07a5add39f89ed145e26  p42-1-1.x86_64@system
+rule update 145a1b06449b07a5add39f89ed145e26  p42-2-1.x86_64@available
+rule update 1567be30ff37e75f1ab0578905f34af5  p7-1-1.x86_64@system
+rule update 1567be30ff37e75f1ab0578905f34af5  p7-2-1.x86_64@available
+rule update 1a116e985530ee73b8bdd16532796ecc  p46-1-1.x86_64@system
+rule update 1a116e985530ee73b8bdd16532796ecc  p46-2-1.x86_64@available
+rule update 1a1cb5eafa58208ac2fddb4cfe6ca637  p133-1-1.x86_64@system
+rule update 1a1cb5eafa58208ac2fddb4cfe6ca637  p133-2-1.x86_64@available
+rule update 1c66f251ac34e10f2d54d1d6f92f516d  p47-1-1.x86_64@system
+rule update 1c66f251ac34e10f2d54d1d6f92f516d  p47-2-1.x86_64@available
+rule update 1c9b85764ab823017edd3591a8c25d3d  p114-1-1.x86_64@system
+rule update 1c9b85764ab823017edd3591a8c25d3d  p114-2-1.x86_64@available
+rule update 1db2ed9e850fc116e6d09b679fd19ed2  p102-1-1.x86_64@system
+rule update 1db2ed9e850fc116e6d09b679fd19ed2  p102-2-1.x86_64@available
+rule update 204a6cc8df746303a20110b7ffff9c57  p21-1-1.x86_64@system
+rule update 204a6cc8df746303a20110b7ffff9c57  p21-2-1.x86_64@available
+rule update 2097a72350c0d14867bc6ef8d5246599  p145-1-1.x86_64@system
+rule update 2097a72350c0d14867bc6ef8d5246599  p145-2-1.x86_64@available
+rule update 20a7d030840494bd212c9564c3630a61  p75-1-1.x86_64@system
+rule update 20a7d030840494bd212c9564c3630a61  p75-2-1.x86_64@available
+rule update 28eb5ae0533d61dd9df1fe5d9dc84467  p28-1-1.x86_64@system
+rule update 28eb5ae0533d61dd9df1fe5d9dc84467  p28-2-1.x86_64@available
+rule update 2a9a0dfb4f9747a4a948aa51cae5867f  p99-1-1.x86_64@system
+rule update 2a9a0dfb4f9747a4a948aa51cae5867f  p99-2-1.x86_64@available
+rule update 2ce291647d220e0779ce9f074f146ebf  p45-1-1.x86_64@system
+rule update 2ce291647d220e0779ce9f074f146ebf  p45-2-1.x86_64@available
+rule update 2e8daffa40f8027ade08154fdba3fd97  p148-1-1.x86_64@system
+rule update 2e8daffa40f8027ade08154fdba3fd97  p148-2-1.x86_64@available
+rule update 2f14c366bfa4a37421f66412d264cc55  p89-1-1.x86_64@system
+rule update 2f14c366bfa4a37421f66412d264cc55  p89-2-1.x86_64@available
+rule update 3072596d10bd44dd3fdf019feb681bb9  p63-1-1.x86_64@system
+rule update 3072596d10bd44dd3fdf019feb681bb9  p63-2-1.x86_64@available
+rule update 3271cce3fa16278f17a6a47a3681c23b  p134-1-1.x86_64@system
+rule update 3271cce3fa16278f17a6a47a3681c23b  p134-2-1.x86_64@available
+rule update 32fd5c6b4739470b3bf05a2eb554fdd0  p61-1-1.x86_64@system
+rule update 32fd5c6b4739470b3bf05a2eb554fdd0  p61-2-1.x86_64@available
+rule update 3429f9e0e1a6cca664b17cfd06cda0f6  p43-1-1.x86_64@system
+rule update 3429f9e0e1a6cca664b17cfd06cda0f6  p43-2-1.x86_64@available
+rule update 3764ffb94eebc51f82f70199d91e5763  p77-1-1.x86_64@system
+rule update 3764ffb94eebc51f82f70199d91e5763  p77-2-1.x86_64@available
+rule update 391e19ff66f967582780909256199e4c  p67-1-1.x86_64@system
+rule update 391e19ff66f967582780909256199e4c  p67-2-1.x86_64@available
+rule update 3bf9d1e3d49e8a0433e2197e1d907922  p95-1-1.x86_64@system
+rule update 3bf9d1e3d49e8a0433e2197e1d907922  p95-2-1.x86_64@available
+rule update 4053325b776ab674e8a4e9df49213612  p128-1-1.x86_64@system
+rule update 4053325b776ab674e8a4e9df49213612  p128-2-1.x86_64@available
+rule update 413664ed4cffc708faec099a085fc659  p119-1-1.x86_64@system
+rule update 413664ed4cffc708faec099a085fc659  p119-2-1.x86_64@available
+rule update 430f253db237c15dd7bb5a6895349479  p69-1-1.x86_64@system
+rule update 430f253db237c15dd7bb5a6895349479  p69-2-1.x86_64@available
+rule update 431e367bfb9f2ca198a43cce63fa54d6  p82-1-1.x86_64@system
+rule update 431e367bfb9f2ca198a43cce63fa54d6  p82-2-1.x86_64@available
+rule update 4549cb893c5125e269521ec042bb4ff7  p72-1-1.x86_64@system
+rule update 4549cb893c5125e269521ec042bb4ff7  p72-2-1.x86_64@available
+rule update 482c634537b82ac0a3d1a38c0bd82dd3  p129-1-1.x86_64@system
+rule update 482c634537b82ac0a3d1a38c0bd82dd3  p129-2-1.x86_64@available
+rule update 494a0ea7dc3dd5eb75aa19ed6b3751ce  p31-1-1.x86_64@system
+rule update 494a0ea7dc3dd5eb75aa19ed6b3751ce  p31-2-1.x86_64@available
+rule update 499c8da972431937fdead1ef2b409a45  p86-1-1.x86_64@system
+rule update 499c8da972431937fdead1ef2b409a45  p86-2-1.x86_64@available
+rule update 49e745bbe6efe73393bc9cc22887e3c4  p92-1-1.x86_64@system
+rule update 49e745bbe6efe73393bc9cc22887e3c4  p92-2-1.x86_64@available
+rule update 4b40b2b65064da509ab605aadbaae673  p139-1-1.x86_64@system
+rule update 4b40b2b65064da509ab605aadbaae673  p139-2-1.x86_64@available
+rule update 4bdf7370fc76373fb36d62e4f31853f2  p120-1-1.x86_64@system
+rule update 4bdf7370fc76373fb36d62e4f31853f2  p120-2-1.x86_64@available
+rule update 4c273aef0bcc58e4305adecc720cb07d  p93-1-1.x86_64@system
+rule update 4c273aef0bcc58e4305adecc720cb07d  p93-2-1.x86_64@available
+rule update 4e3c1efcf552c64a431f51d10390f498  p62-1-1.x86_64@system
+rule update 4e3c1efcf552c64a431f51d10390f498  p62-2-1.x86_64@available
+rule update 5af72110f174e661d836b305b7bf0ad1  p116-1-1.x86_64@system
+rule update 5af72110f174e661d836b305b7bf0ad1  p116-2-1.x86_64@available
+rule update 5ceccaf3c796d93f426d17ddf7ff4933  p2-1-1.x86_64@system
+rule update 5ceccaf3c796d93f426d17ddf7ff4933  p2-2-1.x86_64@available
+rule update 60f5baa225cd5d598ccff7c1f5c5f61a  p122-1-1.x86_64@system
+rule update 60f5baa225cd5d598ccff7c1f5c5f61a  p122-2-1.x86_64@available
+rule update 64b77f56567e401eb4ebfc37ab52dd7d  p24-1-1.x86_64@system
+rule update 64b77f56567e401eb4ebfc37ab52dd7d  p24-2-1.x86_64@available
+rule update 64edeafe4c2ffeb3835dfa8f0ee3928f  p98-1-1.x86_64@system
+rule update 64edeafe4c2ffeb3835dfa8f0ee3928f  p98-2-1.x86_64@available
+rule update 65797bfea88e24424beffbeb2aa188ce  p50-1-1.x86_64@system
+rule update 65797bfea88e24424beffbeb2aa188ce  p50-2-1.x86_64@available
+rule update 65e02e2f9126e05909a2dd9e775fb3ec  p126-1-1.x86_64@system
+rule update 65e02e2f9126e05909a2dd9e775fb3ec  p126-2-1.x86_64@available
+rule update 6647c59092fa713a51fc8a46c688ba74  p55-1-1.x86_64@system
+rule update 6647c59092fa713a51fc8a46c688ba74  p55-2-1.x86_64@available
+rule update 666bdf3b8ec1212847c9aaa0b2dea563  p30-1-1.x86_64@system
+rule update 666bdf3b8ec1212847c9aaa0b2dea563  p30-2-1.x86_64@available
+rule update 675f2eb17ec41f49a8d3731ba01748d7  p41-1-1.x86_64@system
+rule update 675f2eb17ec41f49a8d3731ba01748d7  p41-2-1.x86_64@available
+rule update 69e49d1585dbe593cb044b45f3d13d9a  p13-1-1.x86_64@system
+rule update 69e49d1585dbe593cb044b45f3d13d9a  p13-2-1.x86_64@available
+rule update 69f94a1250e0ed9f75ad8bcf08c28bae  p10-1-1.x86_64@system
+rule update 69f94a1250e0ed9f75ad8bcf08c28bae  p10-2-1.x86_64@available
+rule update 6b65b03d23255b37b743d7e08203d83f  p11-1-1.x86_64@system
+rule update 6b65b03d23255b37b743d7e08203d83f  p11-2-1.x86_64@available
+rule update 6d577661dbc09dd544c143add29a2b40  p143-1-1.x86_64@system
+rule update 6d577661dbc09dd544c143add29a2b40  p143-2-1.x86_64@available
+rule update 6d9aff18b38e9677486a1520d0db5fca  p149-1-1.x86_64@system
+rule update 6d9aff18b38e9677486a1520d0db5fca  p149-2-1.x86_64@available
+rule update 6faefd7b3c5d19b948dccd0b4c4d660d  p117-1-1.x86_64@system
+rule update 6faefd7b3c5d19b948dccd0b4c4d660d  p117-2-1.x86_64@available
+rule update 706fac9974c0df52c4c06bd708a92426  p136-1-1.x86_64@system
+rule update 706fac9974c0df52c4c06bd708a92426  p136-2-1.x86_64@available
+rule update 70ff2a8ad6e047b5a31c1a2ffdd7daf6  p127-1-1.x86_64@system
+rule update 70ff2a8ad6e047b5a31c1a2ffdd7daf6  p127-2-1.x86_64@available
+rule update 73b116b09f49a599eef85161d37b99fe  p78-1-1.x86_64@system
+rule update 73b116b09f49a599eef85161d37b99fe  p78-2-1.x86_64@available
+rule update 74afe8751bb6c8e0e6f07a975f190ff8  p34-1-1.x86_64@system
+rule update 74afe8751bb6c8e0e6f07a975f190ff8  p34-2-1.x86_64@available
+rule update 74ca9af42e8b557ab96c52c85233ca4f  p54-1-1.x86_64@system
+rule update 74ca9af42e8b557ab96c52c85233ca4f  p54-2-1.x86_64@available
+rule update 75981607430739846d483ae35baeb575  p64-1-1.x86_64@system
+rule update 75981607430739846d483ae35baeb575  p64-2-1.x86_64@available
+rule update 7701e7d32d067bc1af774f5aa57de318  p52-1-1.x86_64@system
+rule update 7701e7d32d067bc1af774f5aa57de318  p52-2-1.x86_64@available
+rule update 77dcc82dd829b53b7243a9b197676c2d  p70-1-1.x86_64@system
+rule update 77dcc82dd829b53b7243a9b197676c2d  p70-2-1.x86_64@available
+rule update 78a2ab40129842163f9aff1a0cbb71f4  p96-1-1.x86_64@system
+rule update 78a2ab40129842163f9aff1a0cbb71f4  p96-2-1.x86_64@available
+rule update 792205a392c64ffc988a666183818d73  p3-1-1.x86_64@system
+rule update 792205a392c64ffc988a666183818d73  p3-2-1.x86_64@available
+rule update 7ce795329af1b53ab6f00bc2b2e360ad  p15-1-1.x86_64@system
+rule update 7ce795329af1b53ab6f00bc2b2e360ad  p15-2-1.x86_64@available
+rule update 7e8c19b6a485ef1c0edf6ed57cb2dbd8  p91-1-1.x86_64@system
+rule update 7e8c19b6a485ef1c0edf6ed57cb2dbd8  p91-2-1.x86_64@available
+rule update 7f7a52ba9acba39098c3933362200abb  p140-1-1.x86_64@system
+rule update 7f7a52ba9acba39098c3933362200abb  p140-2-1.x86_64@available
+rule update 8332fa45a75e61495e57f7a62cfe6a5f  p59-1-1.x86_64@system
+rule update 8332fa45a75e61495e57f7a62cfe6a5f  p59-2-1.x86_64@available
+rule update 8341061b0a96d71c8423549271718c7e  p94-1-1.x86_64@system
+rule update 8341061b0a96d71c8423549271718c7e  p94-2-1.x86_64@available
+rule update 843eca572480e68131da2f45b57ba7ff  p12-1-1.x86_64@system
+rule update 843eca572480e68131da2f45b57ba7ff  p12-2-1.x86_64@available
+rule update 85f43769d500ea0f836185c8d5828bfe  p79-1-1.x86_64@system
+rule update 85f43769d500ea0f836185c8d5828bfe  p79-2-1.x86_64@available
+rule update 86db35e651e0f08d98afe53567c40019  p37-1-1.x86_64@system
+rule update 86db35e651e0f08d98afe53567c40019  p37-2-1.x86_64@available
+rule update 86e03fab9d069c53e21c2e72a4072062  p97-1-1.x86_64@system
+rule update 86e03fab9d069c53e21c2e72a4072062  p97-2-1.x86_64@available
+rule update 86e9fe3a9ddc2b127a9db34159c0e1bb  p68-1-1.x86_64@system
+rule update 86e9fe3a9ddc2b127a9db34159c0e1bb  p68-2-1.x86_64@available
+rule update 87524a882825474419d2274a60e1eb4b  p107-1-1.x86_64@system
+rule update 87524a882825474419d2274a60e1eb4b  p107-2-1.x86_64@available
+rule update 876031f465c3834f99ef8d543e39affd  p48-1-1.x86_64@system
+rule update 876031f465c3834f99ef8d543e39affd  p48-2-1.x86_64@available
+rule update 878d5707ce9c90493102f1415492c1ae  p29-1-1.x86_64@system
+rule update 878d5707ce9c90493102f1415492c1ae  p29-2-1.x86_64@available
+rule update 88b10c228aefec0776525cb2d2b8fadb  p5-1-1.x86_64@system
+rule update 88b10c228aefec0776525cb2d2b8fadb  p5-2-1.x86_64@available
+rule update 89f9eba24ff27f1e1582188c7f758eff  p20-1-1.x86_64@system
+rule update 89f9eba24ff27f1e1582188c7f758eff  p20-2-1.x86_64@available
+rule update 8aa7e5499c7ef4ac76e6bf56a7bd6701  p112-1-1.x86_64@system
+rule update 8aa7e5499c7ef4ac76e6bf56a7bd6701  p112-2-1.x86_64@available
+rule update 8bdabafdb2f0336c9fb31a35c4e0ac25  p125-1-1.x86_64@system
+rule update 8bdabafdb2f0336c9fb31a35c4e0ac25  p125-2-1.x86_64@available
+rule update 8c906e9f9b64ca89284f28c63ef593cd  p25-1-1.x86_64@system
+rule update 8c906e9f9b64ca89284f28c63ef593cd  p25-2-1.x86_64@available
+rule update 9117a982969bd3e9f1f811a962dc2268  p14-1-1.x86_64@system
+rule update 9117a982969bd3e9f1f811a962dc2268  p14-2-1.x86_64@available
+rule update 935a44241de881efd55a865c2d1a5aed  p111-1-1.x86_64@system
+rule update 935a44241de881efd55a865c2d1a5aed  p111-2-1.x86_64@available
+rule update 93f161a29b1b3b10b0b2afb220edfa76  p33-1-1.x86_64@system
+rule update 93f161a29b1b3b10b0b2afb220edfa76  p33-2-1.x86_64@available
+rule update 97cc312691258ac2a78bb97222ed7c2a  p81-1-1.x86_64@system
+rule update 97cc312691258ac2a78bb97222ed7c2a  p81-2-1.x86_64@available
+rule update 995597e4195e3a06063cff96f6eb609c  p113-1-1.x86_64@system
+rule update 995597e4195e3a06063cff96f6eb609c  p113-2-1.x86_64@available
+rule update 9b00ed2d5b06fed2aa854cc4409cc792  p22-1-1.x86_64@system
+rule update 9b00ed2d5b06fed2aa854cc4409cc792  p22-2-1.x86_64@available
+rule update 9f4874096f9445035ec23f407a3cae16  p131-1-1.x86_64@system
+rule update 9f4874096f9445035ec23f407a3cae16  p131-2-1.x86_64@available
+rule update a0f2c29992401cb2b048e4adf8762d75  p118-1-1.x86_64@system
+rule update a0f2c29992401cb2b048e4adf8762d75  p118-2-1.x86_64@available
+rule update a112905510ac688a34438dbc3534e570  p80-1-1.x86_64@system
+rule update a112905510ac688a34438dbc3534e570  p80-2-1.x86_64@available
+rule update a6814981673670240d016d0cc6fa1e1b  p121-1-1.x86_64@system
+rule update a6814981673670240d016d0cc6fa1e1b  p121-2-1.x86_64@available
+rule update a8e583cbdd2782be4c26b1973809e414  p49-1-1.x86_64@system
+rule update a8e583cbdd2782be4c26b1973809e414  p49-2-1.x86_64@available
+rule update aad71ec8aa2c175ba9f3499d3ffa86c1  p19-1-1.x86_64@system
+rule update aad71ec8aa2c175ba9f3499d3ffa86c1  p19-2-1.x86_64@available
+rule update aafdf737c773adfd5f16d99ce0b2231a  p76-1-1.x86_64@system
+rule update aafdf737c773adfd5f16d99ce0b2231a  p76-2-1.x86_64@available
+rule update abe9060e7170f7654b6207268170d1c2  p51-1-1.x86_64@system
+rule update abe9060e7170f7654b6207268170d1c2  p51-2-1.x86_64@available
+rule update ac2bc10301808057dfee3aaa0c8b5e9b  p17-1-1.x86_64@system
+rule update ac2bc10301808057dfee3aaa0c8b5e9b  p17-2-1.x86_64@available
+rule update b355710851412a40398f94e89891738c  p130-1-1.x86_64@system
+rule update b355710851412a40398f94e89891738c  p130-2-1.x86_64@available
+rule update b4680bc2742017fa92c1b1e0b43ed3ab  p66-1-1.x86_64@system
+rule update b4680bc2742017fa92c1b1e0b43ed3ab  p66-2-1.x86_64@available
+rule update b4e2ba4316046de5cd4f20aa333dde93  p65-1-1.x86_64@system
+rule update b4e2ba4316046de5cd4f20aa333dde93  p65-2-1.x86_64@available
+rule update b91efc26b87e892d51eeeff50141225c  p115-1-1.x86_64@system
+rule update b91efc26b87e892d51eeeff50141225c  p115-2-1.x86_64@available
+rule update ba77a1c9e459b8356d6f597cb9836f92  p18-1-1.x86_64@system
+rule update ba77a1c9e459b8356d6f597cb9836f92  p18-2-1.x86_64@available
+rule update bbaf7284809a09daabbefc7a4b4e2d79  p87-1-1.x86_64@system
+rule update bbaf7284809a09daabbefc7a4b4e2d79  p87-2-1.x86_64@available
+rule update bd12177b78b39812cdb8c61d2ab0cf53  p135-1-1.x86_64@system
+rule update bd12177b78b39812cdb8c61d2ab0cf53  p135-2-1.x86_64@available
+rule update bf34a044b89ec81a2bee026bc952fa51  p9-1-1.x86_64@system
+rule update bf34a044b89ec81a2bee026bc952fa51  p9-2-1.x86_64@available
+rule update c04a240bd2c8d8a23bab916a360518d8  p8-1-1.x86_64@system
+rule update c04a240bd2c8d8a23bab916a360518d8  p8-2-1.x86_64@available
+rule update c2c6c3877c5577acd3c10bef6af0af52  p144-1-1.x86_64@system
+rule update c2c6c3877c5577acd3c10bef6af0af52  p144-2-1.x86_64@available
+rule update c338dd305251aad0da20fc0fa58f233e  p0-1-1.x86_64@system
+rule update c338dd305251aad0da20fc0fa58f233e  p0-2-1.x86_64@available
+rule update c45812f169c748bd1d50c1d9f0fbc5dc  p123-1-1.x86_64@system
+rule update c45812f169c748bd1d50c1d9f0fbc5dc  p123-2-1.x86_64@available
+rule update c46efee1bbbac47abe03e65be9b29d29  p4-1-1.x86_64@system
+rule update c46efee1bbbac47abe03e65be9b29d29  p4-2-1.x86_64@available
+rule update c67bbd306066408ccd0a88804ee2a4ec  p103-1-1.x86_64@system
+rule update c67bbd306066408ccd0a88804ee2a4ec  p103-2-1.x86_64@available
+rule update ce79bdf5241bf82e4034685a014b50bf  p6-1-1.x86_64@system
+rule update ce79bdf5241bf82e4034685a014b50bf  p6-2-1.x86_64@available
+rule update cf7123819f0200402667108adb780b58  p58-1-1.x86_64@system
+rule update cf7123819f0200402667108adb780b58  p58-2-1.x86_64@available
+rule update d2f1ecdc20f60cac7e6f6fe4b8706964  p141-1-1.x86_64@system
+rule update d2f1ecdc20f60cac7e6f6fe4b8706964  p141-2-1.x86_64@available
+rule update d3662fdebc97b009288a6dbf620c78a9  p84-1-1.x86_64@system
+rule update d3662fdebc97b009288a6dbf620c78a9  p84-2-1.x86_64@available
+rule update d4021038a5479d3867e90f4d1d649c58  p101-1-1.x86_64@system
+rule update d4021038a5479d3867e90f4d1d649c58  p101-2-1.x86_64@available
+rule update d486fca78a9dc7e42c0ab385b7e2a7ae  p132-1-1.x86_64@system
+rule update d486fca78a9dc7e42c0ab385b7e2a7ae  p132-2-1.x86_64@available
+rule update d610dd21b89822b1aa2056a2e16bebea  p39-1-1.x86_64@system
+rule update d610dd21b89822b1aa2056a2e16bebea  p39-2-1.x86_64@available
+rule update d8bb8c18ef1a65cc7f3ef96cc8b8bf44  p88-1-1.x86_64@system
+rule update d8bb8c18ef1a65cc7f3ef96cc8b8bf44  p88-2-1.x86_64@available
+rule update d9043bf4378d7b921437512776a0745a  p23-1-1.x86_64@system
+rule update d9043bf4378d7b921437512776a0745a  p23-2-1.x86_64@available
+rule update d9e39a4a70b58220ff0c34323ad7914d  p74-1-1.x86_64@system
+rule update d9e39a4a70b58220ff0c34323ad7914d  p74-2-1.x86_64@available
+rule update dc5e821eb75cdc43391356db1ab479da  p71-1-1.x86_64@system
+rule update dc5e821eb75cdc43391356db1ab479da  p71-2-1.x86_64@available
+rule update df55a552fda107aafc048a13d4c8a3dd  p26-1-1.x86_64@system
+rule update df55a552fda107aafc048a13d4c8a3dd  p26-2-1.x86_64@available
+rule update df78ec42c880ecec650a9f0ef823b811  p1-1-1.x86_64@system
+rule update df78ec42c880ecec650a9f0ef823b811  p1-2-1.x86_64@available
+rule update e0e9cc40a0f7aa4e7fa4501203f6f023  p27-1-1.x86_64@system
+rule update e0e9cc40a0f7aa4e7fa4501203f6f023  p27-2-1.x86_64@available
+rule update e374c4f696069a63155fbfa9188cbc6d  p104-1-1.x86_64@system
+rule update e374c4f696069a63155fbfa9188cbc6d  p104-2-1.x86_64@available
+rule update e6d6a0185bfdaf0ca9224dcb30b6b7c0  p108-1-1.x86_64@system
+rule update e6d6a0185bfdaf0ca9224dcb30b6b7c0  p108-2-1.x86_64@available
+rule update e90eaef074044538f565ed412f62f7fd  p105-1-1.x86_64@system
+rule update e90eaef074044538f565ed412f62f7fd  p105-2-1.x86_64@available
+rule update e9f6ca6818df74b8b6a43da4e9023509  p124-1-1.x86_64@system
+rule update e9f6ca6818df74b8b6a43da4e9023509  p124-2-1.x86_64@available
+rule update eb323993d744d53630ad28dd6892d946  p90-1-1.x86_64@system
+rule update eb323993d744d53630ad28dd6892d946  p90-2-1.x86_64@available
+rule update ed078e1ae0f273cde29dc49c013ecaa0  p60-1-1.x86_64@system
+rule update ed078e1ae0f273cde29dc49c013ecaa0  p60-2-1.x86_64@available
+rule update eef965d43117c61bd3ab4eddd98bfa28  p38-1-1.x86_64@system
+rule update eef965d43117c61bd3ab4eddd98bfa28  p38-2-1.x86_64@available
+rule update ef5852ae5b514fd12c43f0f1eb269113  p16-1-1.x86_64@system
+rule update ef5852ae5b514fd12c43f0f1eb269113  p16-2-1.x86_64@available
+rule update f25de4e765a7d32edcc5ca3c9697990c  p36-1-1.x86_64@system
+rule update f25de4e765a7d32edcc5ca3c9697990c  p36-2-1.x86_64@available
+rule update f2ec5e87c8fb3e1b7eeb02b9f0da6054  p83-1-1.x86_64@system
+rule update f2ec5e87c8fb3e1b7eeb02b9f0da6054  p83-2-1.x86_64@available
+rule update f351307c301630764783af1204869069  p44-1-1.x86_64@system
+rule update f351307c301630764783af1204869069  p44-2-1.x86_64@available
+rule update f4744e08e3b1dc852002e8b2ced45971  p35-1-1.x86_64@system
+rule update f4744e08e3b1dc852002e8b2ced45971  p35-2-1.x86_64@available
+rule update f4fd3784b59f0e888f6963a8a2e4ae8f  p40-1-1.x86_64@system
+rule update f4fd3784b59f0e888f6963a8a2e4ae8f  p40-2-1.x86_64@available
+rule update f52f1a286b5f85fe96b23560a5daad55  p32-1-1.x86_64@system
+rule update f52f1a286b5f85fe96b23560a5daad55  p32-2-1.x86_64@available
+rule update f7c2d2e9f5384012d5570e284321b537  p146-1-1.x86_64@system
+rule update f7c2d2e9f5384012d5570e284321b537  p146-2-1.x86_64@available
+rule update f9043cdf453efea19777f2ee4cc240c5  p85-1-1.x86_64@system
+rule update f9043cdf453efea19777f2ee4cc240c5  p85-2-1.x86_64@available
+rule update f9e2f7a4ffb62646b2c4047c6a694c26  p57-1-1.x86_64@system
+rule update f9e2f7a4ffb62646b2c4047c6a694c26  p57-2-1.x86_64@available
+rule update fa555fe7a4f9633e4e396f74fa2ee52f  p56-1-1.x86_64@system
+rule update fa555fe7a4f9633e4e396f74fa2ee52f  p56-2-1.x86_64@available
+rule update fd850167aa236add6bd6382054bb6db2  p147-1-1.x86_64@system
+rule update fd850167aa236add6bd6382054bb6db2  p147-2-1.x86_64@available
+rule update fea2c3dcbd5e5093a7c01c5594f3136a  p142-1-1.x86_64@system
+rule update fea2c3dcbd5e5093a7c01c5594f3136a  p142-2-1.x86_64@available
+upgrade p0-1-1.x86_64@system p0-2-1.x86_64@available
+upgrade p1-1-1.x86_64@system p1-2-1.x86_64@available
+upgrade p10-1-1.x86_64@system p10-2-1.x86_64@available
+upgrade p100-1-1.x86_64@system p100-2-1.x86_64@available
+upgrade p101-1-1.x86_64@system p101-2-1.x86_64@available
+upgrade p102-1-1.x86_64@system p102-2-1.x86_64@available
+upgrade p103-1-1.x86_64@system p103-2-1.x86_64@available
+upgrade p104-1-1.x86_64@system p104-2-1.x86_64@available
+upgrade p105-1-1.x86_64@system p105-2-1.x86_64@available
+upgrade p106-1-1.x86_64@system p106-2-1.x86_64@available
+upgrade p107-1-1.x86_64@system p107-2-1.x86_64@available
+upgrade p108-1-1.x86_64@system p108-2-1.x86_64@available
+upgrade p109-1-1.x86_64@system p109-2-1.x86_64@available
+upgrade p11-1-1.x86_64@system p11-2-1.x86_64@available
+upgrade p110-1-1.x86_64@system p110-2-1.x86_64@available
+upgrade p111-1-1.x86_64@system p111-2-1.x86_64@available
+upgrade p112-1-1.x86_64@system p112-2-1.x86_64@available
+upgrade p113-1-1.x86_64@system p113-2-1.x86_64@available
+upgrade p114-1-1.x86_64@system p114-2-1.x86_64@available
+upgrade p115-1-1.x86_64@system p115-2-1.x86_64@available
+upgrade p116-1-1.x86_64@system p116-2-1.x86_64@available
+upgrade p117-1-1.x86_64@system p117-2-1.x86_64@available
+upgrade p118-1-1.x86_64@system p118-2-1.x86_64@available
+upgrade p119-1-1.x86_64@system p119-2-1.x86_64@available
+upgrade p12-1-1.x86_64@system p12-2-1.x86_64@available
+upgrade p120-1-1.x86_64@system p120-2-1.x86_64@available
+upgrade p121-1-1.x86_64@system p121-2-1.x86_64@available
+upgrade p122-1-1.x86_64@system p122-2-1.x86_64@available
+upgrade p123-1-1.x86_64@system p123-2-1.x86_64@available
+upgrade p124-1-1.x86_64@system p124-2-1.x86_64@available
+upgrade p125-1-1.x86_64@system p125-2-1.x86_64@available
+upgrade p126-1-1.x86_64@system p126-2-1.x86_64@available
+upgrade p127-1-1.x86_64@system p127-2-1.x86_64@available
+upgrade p128-1-1.x86_64@system p128-2-1.x86_64@available
+upgrade p129-1-1.x86_64@system p129-2-1.x86_64@available
+upgrade p13-1-1.x86_64@system p13-2-1.x86_64@available
+upgrade p130-1-1.x86_64@system p130-2-1.x86_64@available
+upgrade p131-1-1.x86_64@system p131-2-1.x86_64@available
+upgrade p132-1-1.x86_64@system p132-2-1.x86_64@available
+upgrade p133-1-1.x86_64@system p133-2-1.x86_64@available
+upgrade p134-1-1.x86_64@system p134-2-1.x86_64@available
+upgrade p135-1-1.x86_64@system p135-2-1.x86_64@available
+upgrade p136-1-1.x86_64@system p136-2-1.x86_64@available
+upgrade p137-1-1.x86_64@system p137-2-1.x86_64@available
+upgrade p138-1-1.x86_64@system p138-2-1.x86_64@available
+upgrade p139-1-1.x86_64@system p139-2-1.x86_64@available
+upgrade p14-1-1.x86_64@system p14-2-1.x86_64@available
+upgrade p140-1-1.x86_64@system p140-2-1.x86_64@available
+upgrade p141-1-1.x86_64@system p141-2-1.x86_64@available
+upgrade p142-1-1.x86_64@system p142-2-1.x86_64@available
+upgrade p143-1-1.x86_64@system p143-2-1.x86_64@available
+upgrade p144-1-1.x86_64@system p144-2-1.x86_64@available
+upgrade p145-1-1.x86_64@system p145-2-1.x86_64@available
+upgrade p146-1-1.x86_64@system p146-2-1.x86_64@available
+upgrade p147-1-1.x86_64@system p147-2-1.x86_64@available
+upgrade p148-1-1.x86_64@system p148-2-1.x86_64@available
+upgrade p149-1-1.x86_64@system p149-2-1.x86_64@available
+upgrade p15-1-1.x86_64@system p15-2-1.x86_64@available
+upgrade p16-1-1.x86_64@system p16-2-1.x86_64@available
+upgrade p17-1-1.x86_64@system p17-2-1.x86_64@available
+upgrade p18-1-1.x86_64@system p18-2-1.x86_64@available
+upgrade p19-1-1.x86_64@system p19-2-1.x86_64@available
+upgrade p2-1-1.x86_64@system p2-2-1.x86_64@available
+upgrade p20-1-1.x86_64@system p20-2-1.x86_64@available
+upgrade p21-1-1.x86_64@system p21-2-1.x86_64@available
+upgrade p22-1-1.x86_64@system p22-2-1.x86_64@available
+upgrade p23-1-1.x86_64@system p23-2-1.x86_64@available
+upgrade p24-1-1.x86_64@system p24-2-1.x86_64@available
+upgrade p25-1-1.x86_64@system p25-2-1.x86_64@available
+upgrade p26-1-1.x86_64@system p26-2-1.x86_64@available
+upgrade p27-1-1.x86_64@system p27-2-1.x86_64@available
+upgrade p28-1-1.x86_64@system p28-2-1.x86_64@available
+upgrade p29-1-1.x86_64@system p29-2-1.x86_64@available
+upgrade p3-1-1.x86_64@system p3-2-1.x86_64@available
+upgrade p30-1-1.x86_64@system p30-2-1.x86_64@available
+upgrade p31-1-1.x86_64@system p31-2-1.x86_64@available
+upgrade p32-1-1.x86_64@system p32-2-1.x86_64@available
+upgrade p33-1-1.x86_64@system p33-2-1.x86_64@available
+upgrade p34-1-1.x86_64@system p34-2-1.x86_64@available
+upgrade p35-1-1.x86_64@system p35-2-1.x86_64@available
+upgrade p36-1-1.x86_64@system p36-2-1.x86_64@available
+upgrade p37-1-1.x86_64@system p37-2-1.x86_64@available
+upgrade p38-1-1.x86_64@system p38-2-1.x86_64@available
+upgrade p39-1-1.x86_64@system p39-2-1.x86_64@available
+upgrade p4-1-1.x86_64@system p4-2-1.x86_64@available
+upgrade p40-1-1.x86_64@system p40-2-1.x86_64@available
+upgrade p41-1-1.x86_64@system p41-2-1.x86_64@available
+upgrade p42-1-1.x86_64@system p42-2-1.x86_64@available
+upgrade p43-1-1.x86_64@system p43-2-1.x86_64@available
+upgrade p44-1-1.x86_64@system p44-2-1.x86_64@available
+upgrade p45-1-1.x86_64@system p45-2-1.x86_64@available
+upgrade p46-1-1.x86_64@system p46-2-1.x86_64@available
+upgrade p47-1-1.x86_64@system p47-2-1.x86_64@available
+upgrade p48-1-1.x86_64@system p48-2-1.x86_64@available
+upgrade p49-1-1.x86_64@system p49-2-1.x86_64@available
+upgrade p5-1-1.x86_64@system p5-2-1.x86_64@available
+upgrade p50-1-1.x86_64@system p50-2-1.x86_64@available
+upgrade p51-1-1.x86_64@system p51-2-1.x86_64@available
+upgrade p52-1-1.x86_64@system p52-2-1.x86_64@available
+upgrade p53-1-1.x86_64@system p53-2-1.x86_64@available
+upgrade p54-1-1.x86_64@system p54-2-1.x86_64@available
+upgrade p55-1-1.x86_64@system p55-2-1.x86_64@available
+upgrade p56-1-1.x86_64@system p56-2-1.x86_64@available
+upgrade p57-1-1.x86_64@system p57-2-1.x86_64@available
+upgrade p58-1-1.x86_64@system p58-2-1.x86_64@available
+upgrade p59-1-1.x86_64@system p59-2-1.x86_64@available
+upgrade p6-1-1.x86_64@system p6-2-1.x86_64@available
+upgrade p60-1-1.x86_64@system p60-2-1.x86_64@available
+upgrade p61-1-1.x86_64@system p61-2-1.x86_64@available
+upgrade p62-1-1.x86_64@system p62-2-1.x86_64@available
+upgrade p63-1-1.x86_64@system p63-2-1.x86_64@available
+upgrade p64-1-1.x86_64@system p64-2-1.x86_64@available
+upgrade p65-1-1.x86_64@system p65-2-1.x86_64@available
+upgrade p66-1-1.x86_64@system p66-2-1.x86_64@available
+upgrade p67-1-1.x86_64@system p67-2-1.x86_64@available
+upgrade p68-1-1.x86_64@system p68-2-1.x86_64@available
+upgrade p69-1-1.x86_64@system p69-2-1.x86_64@available
+upgrade p7-1-1.x86_64@system p7-2-1.x86_64@available
+upgrade p70-1-1.x86_64@system p70-2-1.x86_64@available
+upgrade p71-1-1.x86_64@system p71-2-1.x86_64@available
+upgrade p72-1-1.x86_64@system p72-2-1.x86_64@available
+upgrade p73-1-1.x86_64@system p73-2-1.x86_64@available
+upgrade p74-1-1.x86_64@system p74-2-1.x86_64@available
+upgrade p75-1-1.x86_64@system p75-2-1.x86_64@available
+upgrade p76-1-1.x86_64@system p76-2-1.x86_64@available
+upgrade p77-1-1.x86_64@system p77-2-1.x86_64@available
+upgrade p78-1-1.x86_64@system p78-2-1.x86_64@available
+upgrade p79-1-1.x86_64@system p79-2-1.x86_64@available
+upgrade p8-1-1.x86_64@system p8-2-1.x86_64@available
+upgrade p80-1-1.x86_64@system p80-2-1.x86_64@available
+upgrade p81-1-1.x86_64@system p81-2-1.x86_64@available
+upgrade p82-1-1.x86_64@system p82-2-1.x86_64@available
+upgrade p83-1-1.x86_64@system p83-2-1.x86_64@available
+upgrade p84-1-1.x86_64@system p84-2-1.x86_64@available
+upgrade p85-1-1.x86_64@system p85-2-1.x86_64@available
+upgrade p86-1-1.x86_64@system p86-2-1.x86_64@available
+upgrade p87-1-1.x86_64@system p87-2-1.x86_64@available
+upgrade p88-1-1.x86_64@system p88-2-1.x86_64@available
+upgrade p89-1-1.x86_64@system p89-2-1.x86_64@available
+upgrade p9-1-1.x86_64@system p9-2-1.x86_64@available
+upgrade p90-1-1.x86_64@system p90-2-1.x86_64@available
+upgrade p91-1-1.x86_64@system p91-2-1.x86_64@available
+upgrade p92-1-1.x86_64@system p92-2-1.x86_64@available
+upgrade p93-1-1.x86_64@system p93-2-1.x86_64@available
+upgrade p94-1-1.x86_64@system p94-2-1.x86_64@available
+upgrade p95-1-1.x86_64@system p95-2-1.x86_64@available
+upgrade p96-1-1.x86_64@system p96-2-1.x86_64@available
+upgrade p97-1-1.x86_64@system p97-2-1.x86_64@available
+upgrade p98-1-1.x86_64@system p98-2-1.x86_64@available
+upgrade p99-1-1.x86_64@system p99-2-1.x86_64@available
+whatprovides c0 < 1
+whatprovides c1 < 1
+whatprovides c2 < 1
+whatprovides c3 < 1
+whatprovides c4 < 1
+whatprovides c5 < 1
+whatprovides c6 < 1
+whatprovides lib0 > 1 p0-2-1.x86_64@available
+whatprovides lib0 >= 1 p0-1-1.x86_64@system
+whatprovides lib0 >= 1 p0-2-1.x86_64@available
+whatprovides lib0 >= 2 p0-2-1.x86_64@available
+whatprovides lib1 > 1 p1-2-1.x86_64@available
+whatprovides lib1 >= 1 p1-1-1.x86_64@system
+whatprovides lib1 >= 1 p1-2-1.x86_64@available
+whatprovides lib1 >= 2 p1-2-1.x86_64@available
+whatprovides lib10 > 1 p10-2-1.x86_64@available
+whatprovides lib10 >= 1 p10-1-1.x86_64@system
+whatprovides lib10 >= 1 p10-2-1.x86_64@available
+whatprovides lib10 >= 2 p10-2-1.x86_64@available
+whatprovides lib100 > 1 p100-2-1.x86_64@available
+whatprovides lib100 >= 1 p100-1-1.x86_64@system
+whatprovides lib100 >= 1 p100-2-1.x86_64@available
+whatprovides lib100 >= 2 p100-2-1.x86_64@available
+whatprovides lib101 > 1 p101-2-1.x86_64@available
+whatprovides lib101 >= 1 p101-1-1.x86_64@system
+whatprovides lib101 >= 1 p101-2-1.x86_64@available
+whatprovides lib101 >= 2 p101-2-1.x86_64@available
+whatprovides lib102 > 1 p102-2-1.x86_64@available
+whatprovides lib102 >= 1 p102-1-1.x86_64@system
+whatprovides lib102 >= 1 p102-2-1.x86_64@available
+whatprovides lib102 >= 2 p102-2-1.x86_64@available
+whatprovides lib103 > 1 p103-2-1.x86_64@available
+whatprovides lib103 >= 1 p103-1-1.x86_64@system
+whatprovides lib103 >= 1 p103-2-1.x86_64@available
+whatprovides lib103 >= 2 p103-2-1.x86_64@available
+whatprovides lib104 > 1 p104-2-1.x86_64@available
+whatprovides lib104 >= 1 p104-1-1.x86_64@system
+whatprovides lib104 >= 1 p104-2-1.x86_64@available
+whatprovides lib104 >= 2 p104-2-1.x86_64@available
+whatprovides lib105 > 1 p105-2-1.x86_64@available
+whatprovides lib105 >= 1 p105-1-1.x86_64@system
+whatprovides lib105 >= 1 p105-2-1.x86_64@available
+whatprovides lib105 >= 2 p105-2-1.x86_64@available
+whatprovides lib106 > 1 p106-2-1.x86_64@available
+whatprovides lib106 >= 1 p106-1-1.x86_64@system
+whatprovides lib106 >= 1 p106-2-1.x86_64@available
+whatprovides lib106 >= 2 p106-2-1.x86_64@available
+whatprovides lib107 > 1 p107-2-1.x86_64@available
+whatprovides lib107 >= 1 p107-1-1.x86_64@system
+whatprovides lib107 >= 1 p107-2-1.x86_64@available
+whatprovides lib107 >= 2 p107-2-1.x86_64@available
+whatprovides lib108 > 1 p108-2-1.x86_64@available
+whatprovides lib108 >= 1 p108-1-1.x86_64@system
+whatprovides lib108 >= 1 p108-2-1.x86_64@available
+whatprovides lib108 >= 2 p108-2-1.x86_64@available
+whatprovides lib109 > 1 p109-2-1.x86_64@available
+whatprovides lib109 >= 1 p109-1-1.x86_64@system
+whatprovides lib109 >= 1 p109-2-1.x86_64@available
+whatprovides lib109 >= 2 p109-2-1.x86_64@available
+whatprovides lib11 > 1 p11-2-1.x86_64@available
+whatprovides lib11 >= 1 p11-1-1.x86_64@system
+whatprovides lib11 >= 1 p11-2-1.x86_64@available
+whatprovides lib11 >= 2 p11-2-1.x86_64@available
+whatprovides lib110 > 1 p110-2-1.x86_64@available
+whatprovides lib110 >= 1 p110-1-1.x86_64@system
+whatprovides lib110 >= 1 p110-2-1.x86_64@available
+whatprovides lib110 >= 2 p110-2-1.x86_64@available
+whatprovides lib111 > 1 p111-2-1.x86_64@available
+whatprovides lib111 >= 1 p111-1-1.x86_64@system
+whatprovides lib111 >= 1 p111-2-1.x86_64@available
+whatprovides lib111 >= 2 p111-2-1.x86_64@available
+whatprovides lib112 > 1 p112-2-1.x86_64@available
+whatprovides lib112 >= 1 p112-1-1.x86_64@system
+whatprovides lib112 >= 1 p112-2-1.x86_64@available
+whatprovides lib112 >= 2 p112-2-1.x86_64@available
+whatprovides lib113 > 1 p113-2-1.x86_64@available
+whatprovides lib113 >= 1 p113-1-1.x86_64@system
+whatprovides lib113 >= 1 p113-2-1.x86_64@available
+whatprovides lib113 >= 2 p113-2-1.x86_64@available
+whatprovides lib114 > 1 p114-2-1.x86_64@available
+whatprovides lib114 >= 1 p114-1-1.x86_64@system
+whatprovides lib114 >= 1 p114-2-1.x86_64@available
+whatprovides lib114 >= 2 p114-2-1.x86_64@available
+whatprovides lib115 > 1 p115-2-1.x86_64@available
+whatprovides lib115 >= 1 p115-1-1.x86_64@system
+whatprovides lib115 >= 1 p115-2-1.x86_64@available
+whatprovides lib115 >= 2 p115-2-1.x86_64@available
+whatprovides lib116 > 1 p116-2-1.x86_64@available
+whatprovides lib116 >= 1 p116-1-1.x86_64@system
+whatprovides lib116 >= 1 p116-2-1.x86_64@available
+whatprovides lib116 >= 2 p116-2-1.x86_64@available
+whatprovides lib117 > 1 p117-2-1.x86_64@available
+whatprovides lib117 >= 1 p117-1-1.x86_64@system
+whatprovides lib117 >= 1 p117-2-1.x86_64@available
+whatprovides lib117 >= 2 p117-2-1.x86_64@available
+whatprovides lib118 > 1 p118-2-1.x86_64@available
+whatprovides lib118 >= 1 p118-1-1.x86_64@system
+whatprovides lib118 >= 1 p118-2-1.x86_64@available
+whatprovides lib118 >= 2 p118-2-1.x86_64@available
+whatprovides lib119 > 1 p119-2-1.x86_64@available
+whatprovides lib119 >= 1 p119-1-1.x86_64@system
+whatprovides lib119 >= 1 p119-2-1.x86_64@available
+whatprovides lib119 >= 2 p119-2-1.x86_64@available
+whatprovides lib12 > 1 p12-2-1.x86_64@available
+whatprovides lib12 >= 1 p12-1-1.x86_64@system
+whatprovides lib12 >= 1 p12-2-1.x86_64@available
+whatprovides lib12 >= 2 p12-2-1.x86_64@available
+whatprovides lib120 > 1 p120-2-1.x86_64@available
+whatprovides lib120 >= 1 p120-1-1.x86_64@system
+whatprovides lib120 >= 1 p120-2-1.x86_64@available
+whatprovides lib120 >= 2 p120-2-1.x86_64@available
+whatprovides lib121 > 1 p121-2-1.x86_64@available
+whatprovides lib121 >= 1 p121-1-1.x86_64@system
+whatprovides lib121 >= 1 p121-2-1.x86_64@available
+whatprovides lib121 >= 2 p121-2-1.x86_64@available
+whatprovides lib122 > 1 p122-2-1.x86_64@available
+whatprovides lib122 >= 1 p122-1-1.x86_64@system
+whatprovides lib122 >= 1 p122-2-1.x86_64@available
+whatprovides lib122 >= 2 p122-2-1.x86_64@available
+whatprovides lib123 > 1 p123-2-1.x86_64@available
+whatprovides lib123 >= 1 p123-1-1.x86_64@system
+whatprovides lib123 >= 1 p123-2-1.x86_64@available
+whatprovides lib123 >= 2 p123-2-1.x86_64@available
+whatprovides lib124 > 1 p124-2-1.x86_64@available
+whatprovides lib124 >= 1 p124-1-1.x86_64@system
+whatprovides lib124 >= 1 p124-2-1.x86_64@available
+whatprovides lib124 >= 2 p124-2-1.x86_64@available
+whatprovides lib125 > 1 p125-2-1.x86_64@available
+whatprovides lib125 >= 1 p125-1-1.x86_64@system
+whatprovides lib125 >= 1 p125-2-1.x86_64@available
+whatprovides lib125 >= 2 p125-2-1.x86_64@available
+whatprovides lib126 > 1 p126-2-1.x86_64@available
+whatprovides lib126 >= 1 p126-1-1.x86_64@system
+whatprovides lib126 >= 1 p126-2-1.x86_64@available
+whatprovides lib126 >= 2 p126-2-1.x86_64@available
+whatprovides lib127 > 1 p127-2-1.x86_64@available
+whatprovides lib127 >= 1 p127-1-1.x86_64@system
+whatprovides lib127 >= 1 p127-2-1.x86_64@available
+whatprovides lib127 >= 2 p127-2-1.x86_64@available
+whatprovides lib128 > 1 p128-2-1.x86_64@available
+whatprovides lib128 >= 1 p128-1-1.x86_64@system
+whatprovides lib128 >= 1 p128-2-1.x86_64@available
+whatprovides lib128 >= 2 p128-2-1.x86_64@available
+whatprovides lib129 > 1 p129-2-1.x86_64@available
+whatprovides lib129 >= 1 p129-1-1.x86_64@system
+whatprovides lib129 >= 1 p129-2-1.x86_64@available
+whatprovides lib129 >= 2 p129-2-1.x86_64@available
+whatprovides lib13 > 1 p13-2-1.x86_64@available
+whatprovides lib13 >= 1 p13-1-1.x86_64@system
+whatprovides lib13 >= 1 p13-2-1.x86_64@available
+whatprovides lib13 >= 2 p13-2-1.x86_64@available
+whatprovides lib130 > 1 p130-2-1.x86_64@available
+whatprovides lib130 >= 1 p130-1-1.x86_64@system
+whatprovides lib130 >= 1 p130-2-1.x86_64@available
+whatprovides lib130 >= 2 p130-2-1.x86_64@available
+whatprovides lib131 > 1 p131-2-1.x86_64@available
+whatprovides lib131 >= 1 p131-1-1.x86_64@system
+whatprovides lib131 >= 1 p131-2-1.x86_64@available
+whatprovides lib131 >= 2 p131-2-1.x86_64@available
+whatprovides lib132 > 1 p132-2-1.x86_64@available
+whatprovides lib132 >= 1 p132-1-1.x86_64@system
+whatprovides lib132 >= 1 p132-2-1.x86_64@available
+whatprovides lib132 >= 2 p132-2-1.x86_64@available
+whatprovides lib133 > 1 p133-2-1.x86_64@available
+whatprovides lib133 >= 1 p133-1-1.x86_64@system
+whatprovides lib133 >= 1 p133-2-1.x86_64@available
+whatprovides lib133 >= 2 p133-2-1.x86_64@available
+whatprovides lib134 > 1 p134-2-1.x86_64@available
+whatprovides lib134 >= 1 p134-1-1.x86_64@system
+whatprovides lib134 >= 1 p134-2-1.x86_64@available
+whatprovides lib134 >= 2 p134-2-1.x86_64@available
+whatprovides lib135 > 1 p135-2-1.x86_64@available
+whatprovides lib135 >= 1 p135-1-1.x86_64@system
+whatprovides lib135 >= 1 p135-2-1.x86_64@available
+whatprovides lib135 >= 2 p135-2-1.x86_64@available
+whatprovides lib136 > 1 p136-2-1.x86_64@available
+whatprovides lib136 >= 1 p136-1-1.x86_64@system
+whatprovides lib136 >= 1 p136-2-1.x86_64@available
+whatprovides lib136 >= 2 p136-2-1.x86_64@available
+whatprovides lib137 > 1 p137-2-1.x86_64@available
+whatprovides lib137 >= 1 p137-1-1.x86_64@system
+whatprovides lib137 >= 1 p137-2-1.x86_64@available
+whatprovides lib137 >= 2 p137-2-1.x86_64@available
+whatprovides lib138 > 1 p138-2-1.x86_64@available
+whatprovides lib138 >= 1 p138-1-1.x86_64@system
+whatprovides lib138 >= 1 p138-2-1.x86_64@available
+whatprovides lib138 >= 2 p138-2-1.x86_64@available
+whatprovides lib139 > 1 p139-2-1.x86_64@available
+whatprovides lib139 >= 1 p139-1-1.x86_64@system
+whatprovides lib139 >= 1 p139-2-1.x86_64@available
+whatprovides lib139 >= 2 p139-2-1.x86_64@available
+whatprovides lib14 > 1 p14-2-1.x86_64@available
+whatprovides lib14 >= 1 p14-1-1.x86_64@system
+whatprovides lib14 >= 1 p14-2-1.x86_64@available
+whatprovides lib14 >= 2 p14-2-1.x86_64@available
+whatprovides lib140 > 1 p140-2-1.x86_64@available
+whatprovides lib140 >= 1 p140-1-1.x86_64@system
+whatprovides lib140 >= 1 p140-2-1.x86_64@available
+whatprovides lib140 >= 2 p140-2-1.x86_64@available
+whatprovides lib141 > 1 p141-2-1.x86_64@available
+whatprovides lib141 >= 1 p141-1-1.x86_64@system
+whatprovides lib141 >= 1 p141-2-1.x86_64@available
+whatprovides lib141 >= 2 p141-2-1.x86_64@available
+whatprovides lib142 > 1 p142-2-1.x86_64@available
+whatprovides lib142 >= 1 p142-1-1.x86_64@system
+whatprovides lib142 >= 1 p142-2-1.x86_64@available
+whatprovides lib142 >= 2 p142-2-1.x86_64@available
+whatprovides lib143 > 1 p143-2-1.x86_64@available
+whatprovides lib143 >= 1 p143-1-1.x86_64@system
+whatprovides lib143 >= 1 p143-2-1.x86_64@available
+whatprovides lib143 >= 2 p143-2-1.x86_64@available
+whatprovides lib144 > 1 p144-2-1.x86_64@available
+whatprovides lib144 >= 1 p144-1-1.x86_64@system
+whatprovides lib144 >= 1 p144-2-1.x86_64@available
+whatprovides lib144 >= 2 p144-2-1.x86_64@available
+whatprovides lib145 > 1 p145-2-1.x86_64@available
+whatprovides lib145 >= 1 p145-1-1.x86_64@system
+whatprovides lib145 >= 1 p145-2-1.x86_64@available
+whatprovides lib145 >= 2 p145-2-1.x86_64@available
+whatprovides lib146 > 1 p146-2-1.x86_64@available
+whatprovides lib146 >= 1 p146-1-1.x86_64@system
+whatprovides lib146 >= 1 p146-2-1.x86_64@available
+whatprovides lib146 >= 2 p146-2-1.x86_64@available
+whatprovides lib147 > 1 p147-2-1.x86_64@available
+whatprovides lib147 >= 1 p147-1-1.x86_64@system
+whatprovides lib147 >= 1 p147-2-1.x86_64@available
+whatprovides lib147 >= 2 p147-2-1.x86_64@available
+whatprovides lib148 > 1 p148-2-1.x86_64@available
+whatprovides lib148 >= 1 p148-1-1.x86_64@system
+whatprovides lib148 >= 1 p148-2-1.x86_64@available
+whatprovides lib148 >= 2 p148-2-1.x86_64@available
+whatprovides lib149 > 1 p149-2-1.x86_64@available
+whatprovides lib149 >= 1 p149-1-1.x86_64@system
+whatprovides lib149 >= 1 p149-2-1.x86_64@available
+whatprovides lib149 >= 2 p149-2-1.x86_64@available
+whatprovides lib15 > 1 p15-2-1.x86_64@available
+whatprovides lib15 >= 1 p15-1-1.x86_64@system
+whatprovides lib15 >= 1 p15-2-1.x86_64@available
+whatprovides lib15 >= 2 p15-2-1.x86_64@available
+whatprovides lib16 > 1 p16-2-1.x86_64@available
+whatprovides lib16 >= 1 p16-1-1.x86_64@system
+whatprovides lib16 >= 1 p16-2-1.x86_64@available
+whatprovides lib16 >= 2 p16-2-1.x86_64@available
+whatprovides lib17 > 1 p17-2-1.x86_64@available
+whatprovides lib17 >= 1 p17-1-1.x86_64@system
+whatprovides lib17 >= 1 p17-2-1.x86_64@available
+whatprovides lib17 >= 2 p17-2-1.x86_64@available
+whatprovides lib18 > 1 p18-2-1.x86_64@available
+whatprovides lib18 >= 1 p18-1-1.x86_64@system
+whatprovides lib18 >= 1 p18-2-1.x86_64@available
+whatprovides lib18 >= 2 p18-2-1.x86_64@available
+whatprovides lib19 > 1 p19-2-1.x86_64@available
+whatprovides lib19 >= 1 p19-1-1.x86_64@system
+whatprovides lib19 >= 1 p19-2-1.x86_64@available
+whatprovides lib19 >= 2 p19-2-1.x86_64@available
+whatprovides lib2 > 1 p2-2-1.x86_64@available
+whatprovides lib2 >= 1 p2-1-1.x86_64@system
+whatprovides lib2 >= 1 p2-2-1.x86_64@available
+whatprovides lib2 >= 2 p2-2-1.x86_64@available
+whatprovides lib20 > 1 p20-2-1.x86_64@available
+whatprovides lib20 >= 1 p20-1-1.x86_64@system
+whatprovides lib20 >= 1 p20-2-1.x86_64@available
+whatprovides lib20 >= 2 p20-2-1.x86_64@available
+whatprovides lib21 > 1 p21-2-1.x86_64@available
+whatprovides lib21 >= 1 p21-1-1.x86_64@system
+whatprovides lib21 >= 1 p21-2-1.x86_64@available
+whatprovides lib21 >= 2 p21-2-1.x86_64@available
+whatprovides lib22 > 1 p22-2-1.x86_64@available
+whatprovides lib22 >= 1 p22-1-1.x86_64@system
+whatprovides lib22 >= 1 p22-2-1.x86_64@available
+whatprovides lib22 >= 2 p22-2-1.x86_64@available
+whatprovides lib23 > 1 p23-2-1.x86_64@available
+whatprovides lib23 >= 1 p23-1-1.x86_64@system
+whatprovides lib23 >= 1 p23-2-1.x86_64@available
+whatprovides lib23 >= 2 p23-2-1.x86_64@available
+whatprovides lib24 > 1 p24-2-1.x86_64@available
+whatprovides lib24 >= 1 p24-1-1.x86_64@system
+whatprovides lib24 >= 1 p24-2-1.x86_64@available
+whatprovides lib24 >= 2 p24-2-1.x86_64@available
+whatprovides lib25 > 1 p25-2-1.x86_64@available
+whatprovides lib25 >= 1 p25-1-1.x86_64@system
+whatprovides lib25 >= 1 p25-2-1.x86_64@available
+whatprovides lib25 >= 2 p25-2-1.x86_64@available
+whatprovides lib26 > 1 p26-2-1.x86_64@available
+whatprovides lib26 >= 1 p26-1-1.x86_64@system
+whatprovides lib26 >= 1 p26-2-1.x86_64@available
+whatprovides lib26 >= 2 p26-2-1.x86_64@available
+whatprovides lib27 > 1 p27-2-1.x86_64@available
+whatprovides lib27 >= 1 p27-1-1.x86_64@system
+whatprovides lib27 >= 1 p27-2-1.x86_64@available
+whatprovides lib27 >= 2 p27-2-1.x86_64@available
+whatprovides lib28 > 1 p28-2-1.x86_64@available
+whatprovides lib28 >= 1 p28-1-1.x86_64@system
+whatprovides lib28 >= 1 p28-2-1.x86_64@available
+whatprovides lib28 >= 2 p28-2-1.x86_64@available
+whatprovides lib29 > 1 p29-2-1.x86_64@available
+whatprovides lib29 >= 1 p29-1-1.x86_64@system
+whatprovides lib29 >= 1 p29-2-1.x86_64@available
+whatprovides lib29 >= 2 p29-2-1.x86_64@available
+whatprovides lib3 > 1 p3-2-1.x86_64@available
+whatprovides lib3 >= 1 p3-1-1.x86_64@system
+whatprovides lib3 >= 1 p3-2-1.x86_64@available
+whatprovides lib3 >= 2 p3-2-1.x86_64@available
+whatprovides lib30 > 1 p30-2-1.x86_64@available
+whatprovides lib30 >= 1 p30-1-1.x86_64@system
+whatprovides lib30 >= 1 p30-2-1.x86_64@available
+whatprovides lib30 >= 2 p30-2-1.x86_64@available
+whatprovides lib31 > 1 p31-2-1.x86_64@available
+whatprovides lib31 >= 1 p31-1-1.x86_64@system
+whatprovides lib31 >= 1 p31-2-1.x86_64@available
+whatprovides lib31 >= 2 p31-2-1.x86_64@available
+whatprovides lib32 > 1 p32-2-1.x86_64@available
+whatprovides lib32 >= 1 p32-1-1.x86_64@system
+whatprovides lib32 >= 1 p32-2-1.x86_64@available
+whatprovides lib32 >= 2 p32-2-1.x86_64@available
+whatprovides lib33 > 1 p33-2-1.x86_64@available
+whatprovides lib33 >= 1 p33-1-1.x86_64@system
+whatprovides lib33 >= 1 p33-2-1.x86_64@available
+whatprovides lib33 >= 2 p33-2-1.x86_64@available
+whatprovides lib34 > 1 p34-2-1.x86_64@available
+whatprovides lib34 >= 1 p34-1-1.x86_64@system
+whatprovides lib34 >= 1 p34-2-1.x86_64@available
+whatprovides lib34 >= 2 p34-2-1.x86_64@available
+whatprovides lib35 > 1 p35-2-1.x86_64@available
+whatprovides lib35 >= 1 p35-1-1.x86_64@system
+whatprovides lib35 >= 1 p35-2-1.x86_64@available
+whatprovides lib35 >= 2 p35-2-1.x86_64@available
+whatprovides lib36 > 1 p36-2-1.x86_64@available
+whatprovides lib36 >= 1 p36-1-1.x86_64@system
+whatprovides lib36 >= 1 p36-2-1.x86_64@available
+whatprovides lib36 >= 2 p36-2-1.x86_64@available
+whatprovides lib37 > 1 p37-2-1.x86_64@available
+whatprovides lib37 >= 1 p37-1-1.x86_64@system
+whatprovides lib37 >= 1 p37-2-1.x86_64@available
+whatprovides lib37 >= 2 p37-2-1.x86_64@available
+whatprovides lib38 > 1 p38-2-1.x86_64@available
+whatprovides lib38 >= 1 p38-1-1.x86_64@system
+whatprovides lib38 >= 1 p38-2-1.x86_64@available
+whatprovides lib38 >= 2 p38-2-1.x86_64@available
+whatprovides lib39 > 1 p39-2-1.x86_64@available
+whatprovides lib39 >= 1 p39-1-1.x86_64@system
+whatprovides lib39 >= 1 p39-2-1.x86_64@available
+whatprovides lib39 >= 2 p39-2-1.x86_64@available
+whatprovides lib4 > 1 p4-2-1.x86_64@available
+whatprovides lib4 >= 1 p4-1-1.x86_64@system
+whatprovides lib4 >= 1 p4-2-1.x86_64@available
+whatprovides lib4 >= 2 p4-2-1.x86_64@available
+whatprovides lib40 > 1 p40-2-1.x86_64@available
+whatprovides lib40 >= 1 p40-1-1.x86_64@system
+whatprovides lib40 >= 1 p40-2-1.x86_64@available
+whatprovides lib40 >= 2 p40-2-1.x86_64@available
+whatprovides lib41 > 1 p41-2-1.x86_64@available
+whatprovides lib41 >= 1 p41-1-1.x86_64@system
+whatprovides lib41 >= 1 p41-2-1.x86_64@available
+whatprovides lib41 >= 2 p41-2-1.x86_64@available
+whatprovides lib42 > 1 p42-2-1.x86_64@available
+whatprovides lib42 >= 1 p42-1-1.x86_64@system
+whatprovides lib42 >= 1 p42-2-1.x86_64@available
+whatprovides lib42 >= 2 p42-2-1.x86_64@available
+whatprovides lib43 > 1 p43-2-1.x86_64@available
+whatprovides lib43 >= 1 p43-1-1.x86_64@system
+whatprovides lib43 >= 1 p43-2-1.x86_64@available
+whatprovides lib43 >= 2 p43-2-1.x86_64@available
+whatprovides lib44 > 1 p44-2-1.x86_64@available
+whatprovides lib44 >= 1 p44-1-1.x86_64@system
+whatprovides lib44 >= 1 p44-2-1.x86_64@available
+whatprovides lib44 >= 2 p44-2-1.x86_64@available
+whatprovides lib45 > 1 p45-2-1.x86_64@available
+whatprovides lib45 >= 1 p45-1-1.x86_64@system
+whatprovides lib45 >= 1 p45-2-1.x86_64@available
+whatprovides lib45 >= 2 p45-2-1.x86_64@available
+whatprovides lib46 > 1 p46-2-1.x86_64@available
+whatprovides lib46 >= 1 p46-1-1.x86_64@system
+whatprovides lib46 >= 1 p46-2-1.x86_64@available
+whatprovides lib46 >= 2 p46-2-1.x86_64@available
+whatprovides lib47 > 1 p47-2-1.x86_64@available
+whatprovides lib47 >= 1 p47-1-1.x86_64@system
+whatprovides lib47 >= 1 p47-2-1.x86_64@available
+whatprovides lib47 >= 2 p47-2-1.x86_64@available
+whatprovides lib48 > 1 p48-2-1.x86_64@available
+whatprovides lib48 >= 1 p48-1-1.x86_64@system
+whatprovides lib48 >= 1 p48-2-1.x86_64@available
+whatprovides lib48 >= 2 p48-2-1.x86_64@available
+whatprovides lib49 > 1 p49-2-1.x86_64@available
+whatprovides lib49 >= 1 p49-1-1.x86_64@system
+whatprovides lib49 >= 1 p49-2-1.x86_64@available
+whatprovides lib49 >= 2 p49-2-1.x86_64@available
+whatprovides lib5 > 1 p5-2-1.x86_64@available
+whatprovides lib5 >= 1 p5-1-1.x86_64@system
+whatprovides lib5 >= 1 p5-2-1.x86_64@available
+whatprovides lib5 >= 2 p5-2-1.x86_64@available
+whatprovides lib50 > 1 p50-2-1.x86_64@available
+whatprovides lib50 >= 1 p50-1-1.x86_64@system
+whatprovides lib50 >= 1 p50-2-1.x86_64@available
+whatprovides lib50 >= 2 p50-2-1.x86_64@available
+whatprovides lib51 > 1 p51-2-1.x86_64@available
+whatprovides lib51 >= 1 p51-1-1.x86_64@system
+whatprovides lib51 >= 1 p51-2-1.x86_64@available
+whatprovides lib51 >= 2 p51-2-1.x86_64@available
+whatprovides lib52 > 1 p52-2-1.x86_64@available
+whatprovides lib52 >= 1 p52-1-1.x86_64@system
+whatprovides lib52 >= 1 p52-2-1.x86_64@available
+whatprovides lib52 >= 2 p52-2-1.x86_64@available
+whatprovides lib53 > 1 p53-2-1.x86_64@available
+whatprovides lib53 >= 1 p53-1-1.x86_64@system
+whatprovides lib53 >= 1 p53-2-1.x86_64@available
+whatprovides lib53 >= 2 p53-2-1.x86_64@available
+whatprovides lib54 > 1 p54-2-1.x86_64@available
+whatprovides lib54 >= 1 p54-1-1.x86_64@system
+whatprovides lib54 >= 1 p54-2-1.x86_64@available
+whatprovides lib54 >= 2 p54-2-1.x86_64@available
+whatprovides lib55 > 1 p55-2-1.x86_64@available
+whatprovides lib55 >= 1 p55-1-1.x86_64@system
+whatprovides lib55 >= 1 p55-2-1.x86_64@available
+whatprovides lib55 >= 2 p55-2-1.x86_64@available
+whatprovides lib56 > 1 p56-2-1.x86_64@available
+whatprovides lib56 >= 1 p56-1-1.x86_64@system
+whatprovides lib56 >= 1 p56-2-1.x86_64@available
+whatprovides lib56 >= 2 p56-2-1.x86_64@available
+whatprovides lib57 > 1 p57-2-1.x86_64@available
+whatprovides lib57 >= 1 p57-1-1.x86_64@system
+whatprovides lib57 >= 1 p57-2-1.x86_64@available
+whatprovides lib57 >= 2 p57-2-1.x86_64@available
+whatprovides lib58 > 1 p58-2-1.x86_64@available
+whatprovides lib58 >= 1 p58-1-1.x86_64@system
+whatprovides lib58 >= 1 p58-2-1.x86_64@available
+whatprovides lib58 >= 2 p58-2-1.x86_64@available
+whatprovides lib59 > 1 p59-2-1.x86_64@available
+whatprovides lib59 >= 1 p59-1-1.x86_64@system
+whatprovides lib59 >= 1 p59-2-1.x86_64@available
+whatprovides lib59 >= 2 p59-2-1.x86_64@available
+whatprovides lib6 > 1 p6-2-1.x86_64@available
+whatprovides lib6 >= 1 p6-1-1.x86_64@system
+whatprovides lib6 >= 1 p6-2-1.x86_64@available
+whatprovides lib6 >= 2 p6-2-1.x86_64@available
+whatprovides lib60 > 1 p60-2-1.x86_64@available
+whatprovides lib60 >= 1 p60-1-1.x86_64@system
+whatprovides lib60 >= 1 p60-2-1.x86_64@available
+whatprovides lib60 >= 2 p60-2-1.x86_64@available
+whatprovides lib61 > 1 p61-2-1.x86_64@available
+whatprovides lib61 >= 1 p61-1-1.x86_64@system
+whatprovides lib61 >= 1 p61-2-1.x86_64@available
+whatprovides lib61 >= 2 p61-2-1.x86_64@available
+whatprovides lib62 > 1 p62-2-1.x86_64@available
+whatprovides lib62 >= 1 p62-1-1.x86_64@system
+whatprovides lib62 >= 1 p62-2-1.x86_64@available
+whatprovides lib62 >= 2 p62-2-1.x86_64@available
+whatprovides lib63 > 1 p63-2-1.x86_64@available
+whatprovides lib63 >= 1 p63-1-1.x86_64@system
+whatprovides lib63 >= 1 p63-2-1.x86_64@available
+whatprovides lib63 >= 2 p63-2-1.x86_64@available
+whatprovides lib64 > 1 p64-2-1.x86_64@available
+whatprovides lib64 >= 1 p64-1-1.x86_64@system
+whatprovides lib64 >= 1 p64-2-1.x86_64@available
+whatprovides lib64 >= 2 p64-2-1.x86_64@available
+whatprovides lib65 > 1 p65-2-1.x86_64@available
+whatprovides lib65 >= 1 p65-1-1.x86_64@system
+whatprovides lib65 >= 1 p65-2-1.x86_64@available
+whatprovides lib65 >= 2 p65-2-1.x86_64@available
+whatprovides lib66 > 1 p66-2-1.x86_64@available
+whatprovides lib66 >= 1 p66-1-1.x86_64@system
+whatprovides lib66 >= 1 p66-2-1.x86_64@available
+whatprovides lib66 >= 2 p66-2-1.x86_64@available
+whatprovides lib67 > 1 p67-2-1.x86_64@available
+whatprovides lib67 >= 1 p67-1-1.x86_64@system
+whatprovides lib67 >= 1 p67-2-1.x86_64@available
+whatprovides lib67 >= 2 p67-2-1.x86_64@available
+whatprovides lib68 > 1 p68-2-1.x86_64@available
+whatprovides lib68 >= 1 p68-1-1.x86_64@system
+whatprovides lib68 >= 1 p68-2-1.x86_64@available
+whatprovides lib68 >= 2 p68-2-1.x86_64@available
+whatprovides lib69 > 1 p69-2-1.x86_64@available
+whatprovides lib69 >= 1 p69-1-1.x86_64@system
+whatprovides lib69 >= 1 p69-2-1.x86_64@available
+whatprovides lib69 >= 2 p69-2-1.x86_64@available
+whatprovides lib7 > 1 p7-2-1.x86_64@available
+whatprovides lib7 >= 1 p7-1-1.x86_64@system
+whatprovides lib7 >= 1 p7-2-1.x86_64@available
+whatprovides lib7 >= 2 p7-2-1.x86_64@available
+whatprovides lib70 > 1 p70-2-1.x86_64@available
+whatprovides lib70 >= 1 p70-1-1.x86_64@system
+whatprovides lib70 >= 1 p70-2-1.x86_64@available
+whatprovides lib70 >= 2 p70-2-1.x86_64@available
+whatprovides lib71 > 1 p71-2-1.x86_64@available
+whatprovides lib71 >= 1 p71-1-1.x86_64@system
+whatprovides lib71 >= 1 p71-2-1.x86_64@available
+whatprovides lib71 >= 2 p71-2-1.x86_64@available
+whatprovides lib72 > 1 p72-2-1.x86_64@available
+whatprovides lib72 >= 1 p72-1-1.x86_64@system
+whatprovides lib72 >= 1 p72-2-1.x86_64@available
+whatprovides lib72 >= 2 p72-2-1.x86_64@available
+whatprovides lib73 > 1 p73-2-1.x86_64@available
+whatprovides lib73 >= 1 p73-1-1.x86_64@system
+whatprovides lib73 >= 1 p73-2-1.x86_64@available
+whatprovides lib73 >= 2 p73-2-1.x86_64@available
+whatprovides lib74 > 1 p74-2-1.x86_64@available
+whatprovides lib74 >= 1 p74-1-1.x86_64@system
+whatprovides lib74 >= 1 p74-2-1.x86_64@available
+whatprovides lib74 >= 2 p74-2-1.x86_64@available
+whatprovides lib75 > 1 p75-2-1.x86_64@available
+whatprovides lib75 >= 1 p75-1-1.x86_64@system
+whatprovides lib75 >= 1 p75-2-1.x86_64@available
+whatprovides lib75 >= 2 p75-2-1.x86_64@available
+whatprovides lib76 > 1 p76-2-1.x86_64@available
+whatprovides lib76 >= 1 p76-1-1.x86_64@system
+whatprovides lib76 >= 1 p76-2-1.x86_64@available
+whatprovides lib76 >= 2 p76-2-1.x86_64@available
+whatprovides lib77 > 1 p77-2-1.x86_64@available
+whatprovides lib77 >= 1 p77-1-1.x86_64@system
+whatprovides lib77 >= 1 p77-2-1.x86_64@available
+whatprovides lib77 >= 2 p77-2-1.x86_64@available
+whatprovides lib78 > 1 p78-2-1.x86_64@available
+whatprovides lib78 >= 1 p78-1-1.x86_64@system
+whatprovides lib78 >= 1 p78-2-1.x86_64@available
+whatprovides lib78 >= 2 p78-2-1.x86_64@available
+whatprovides lib79 > 1 p79-2-1.x86_64@available
+whatprovides lib79 >= 1 p79-1-1.x86_64@system
+whatprovides lib79 >= 1 p79-2-1.x86_64@available
+whatprovides lib79 >= 2 p79-2-1.x86_64@available
+whatprovides lib8 > 1 p8-2-1.x86_64@available
+whatprovides lib8 >= 1 p8-1-1.x86_64@system
+whatprovides lib8 >= 1 p8-2-1.x86_64@available
+whatprovides lib8 >= 2 p8-2-1.x86_64@available
+whatprovides lib80 > 1 p80-2-1.x86_64@available
+whatprovides lib80 >= 1 p80-1-1.x86_64@system
+whatprovides lib80 >= 1 p80-2-1.x86_64@available
+whatprovides lib80 >= 2 p80-2-1.x86_64@available
+whatprovides lib81 > 1 p81-2-1.x86_64@available
+whatprovides lib81 >= 1 p81-1-1.x86_64@system
+whatprovides lib81 >= 1 p81-2-1.x86_64@available
+whatprovides lib81 >= 2 p81-2-1.x86_64@available
+whatprovides lib82 > 1 p82-2-1.x86_64@available
+whatprovides lib82 >= 1 p82-1-1.x86_64@system
+whatprovides lib82 >= 1 p82-2-1.x86_64@available
+whatprovides lib82 >= 2 p82-2-1.x86_64@available
+whatprovides lib83 > 1 p83-2-1.x86_64@available
+whatprovides lib83 >= 1 p83-1-1.x86_64@system
+whatprovides lib83 >= 1 p83-2-1.x86_64@available
+whatprovides lib83 >= 2 p83-2-1.x86_64@available
+whatprovides lib84 > 1 p84-2-1.x86_64@available
+whatprovides lib84 >= 1 p84-1-1.x86_64@system
+whatprovides lib84 >= 1 p84-2-1.x86_64@available
+whatprovides lib84 >= 2 p84-2-1.x86_64@available
+whatprovides lib85 > 1 p85-2-1.x86_64@available
+whatprovides lib85 >= 1 p85-1-1.x86_64@system
+whatprovides lib85 >= 1 p85-2-1.x86_64@available
+whatprovides lib85 >= 2 p85-2-1.x86_64@available
+whatprovides lib86 > 1 p86-2-1.x86_64@available
+whatprovides lib86 >= 1 p86-1-1.x86_64@system
+whatprovides lib86 >= 1 p86-2-1.x86_64@available
+whatprovides lib86 >= 2 p86-2-1.x86_64@available
+whatprovides lib87 > 1 p87-2-1.x86_64@available
+whatprovides lib87 >= 1 p87-1-1.x86_64@system
+whatprovides lib87 >= 1 p87-2-1.x86_64@available
+whatprovides lib87 >= 2 p87-2-1.x86_64@available
+whatprovides lib88 > 1 p88-2-1.x86_64@available
+whatprovides lib88 >= 1 p88-1-1.x86_64@system
+whatprovides lib88 >= 1 p88-2-1.x86_64@available
+whatprovides lib88 >= 2 p88-2-1.x86_64@available
+whatprovides lib89 > 1 p89-2-1.x86_64@available
+whatprovides lib89 >= 1 p89-1-1.x86_64@system
+whatprovides lib89 >= 1 p89-2-1.x86_64@available
+whatprovides lib89 >= 2 p89-2-1.x86_64@available
+whatprovides lib9 > 1 p9-2-1.x86_64@available
+whatprovides lib9 >= 1 p9-1-1.x86_64@system
+whatprovides lib9 >= 1 p9-2-1.x86_64@available
+whatprovides lib9 >= 2 p9-2-1.x86_64@available
+whatprovides lib90 > 1 p90-2-1.x86_64@available
+whatprovides lib90 >= 1 p90-1-1.x86_64@system
+whatprovides lib90 >= 1 p90-2-1.x86_64@available
+whatprovides lib90 >= 2 p90-2-1.x86_64@available
+whatprovides lib91 > 1 p91-2-1.x86_64@available
+whatprovides lib91 >= 1 p91-1-1.x86_64@system
+whatprovides lib91 >= 1 p91-2-1.x86_64@available
+whatprovides lib91 >= 2 p91-2-1.x86_64@available
+whatprovides lib92 > 1 p92-2-1.x86_64@available
+whatprovides lib92 >= 1 p92-1-1.x86_64@system
+whatprovides lib92 >= 1 p92-2-1.x86_64@available
+whatprovides lib92 >= 2 p92-2-1.x86_64@available
+whatprovides lib93 > 1 p93-2-1.x86_64@available
+whatprovides lib93 >= 1 p93-1-1.x86_64@system
+whatprovides lib93 >= 1 p93-2-1.x86_64@available
+whatprovides lib93 >= 2 p93-2-1.x86_64@available
+whatprovides lib94 > 1 p94-2-1.x86_64@available
+whatprovides lib94 >= 1 p94-1-1.x86_64@system
+whatprovides lib94 >= 1 p94-2-1.x86_64@available
+whatprovides lib94 >= 2 p94-2-1.x86_64@available
+whatprovides lib95 > 1 p95-2-1.x86_64@available
+whatprovides lib95 >= 1 p95-1-1.x86_64@system
+whatprovides lib95 >= 1 p95-2-1.x86_64@available
+whatprovides lib95 >= 2 p95-2-1.x86_64@available
+whatprovides lib96 > 1 p96-2-1.x86_64@available
+whatprovides lib96 >= 1 p96-1-1.x86_64@system
+whatprovides lib96 >= 1 p96-2-1.x86_64@available
+whatprovides lib96 >= 2 p96-2-1.x86_64@available
+whatprovides lib97 > 1 p97-2-1.x86_64@available
+whatprovides lib97 >= 1 p97-1-1.x86_64@system
+whatprovides lib97 >= 1 p97-2-1.x86_64@available
+whatprovides lib97 >= 2 p97-2-1.x86_64@available
+whatprovides lib98 > 1 p98-2-1.x86_64@available
+whatprovides lib98 >= 1 p98-1-1.x86_64@system
+whatprovides lib98 >= 1 p98-2-1.x86_64@available
+whatprovides lib98 >= 2 p98-2-1.x86_64@available
+whatprovides lib99 > 1 p99-2-1.x86_64@available
+whatprovides lib99 >= 1 p99-1-1.x86_64@system
+whatprovides lib99 >= 1 p99-2-1.x86_64@available
+whatprovides lib99 >= 2 p99-2-1.x86_64@available
+whatprovides old0 <= 2 old0-1-1.x86_64@available
+whatprovides old1 <= 2
+whatprovides old10 <= 2 old10-1-1.x86_64@available
+whatprovides old100 <= 2 old100-1-1.x86_64@available
+whatprovides old101 <= 2
+whatprovides old102 <= 2
+whatprovides old103 <= 2
+whatprovides old104 <= 2
+whatprovides old105 <= 2 old105-1-1.x86_64@available
+whatprovides old106 <= 2
+whatprovides old107 <= 2
+whatprovides old108 <= 2
+whatprovides old109 <= 2
+whatprovides old11 <= 2
+whatprovides old110 <= 2 old110-1-1.x86_64@available
+whatprovides old111 <= 2
+whatprovides old112 <= 2
+whatprovides old113 <= 2
+whatprovides old114 <= 2
+whatprovides old115 <= 2 old115-1-1.x86_64@available
+whatprovides old116 <= 2
+whatprovides old117 <= 2
+whatprovides old118 <= 2
+whatprovides old119 <= 2
+whatprovides old12 <= 2
+whatprovides old120 <= 2 old120-1-1.x86_64@available
+whatprovides old121 <= 2
+whatprovides old122 <= 2
+whatprovides old123 <= 2
+whatprovides old124 <= 2
+whatprovides old125 <= 2 old125-1-1.x86_64@available
+whatprovides old126 <= 2
+whatprovides old127 <= 2
+whatprovides old128 <= 2
+whatprovides old129 <= 2
+whatprovides old13 <= 2
+whatprovides old130 <= 2 old130-1-1.x86_64@available
+whatprovides old131 <= 2
+whatprovides old132 <= 2
+whatprovides old133 <= 2
+whatprovides old134 <= 2
+whatprovides old135 <= 2 old135-1-1.x86_64@available
+whatprovides old136 <= 2
+whatprovides old137 <= 2
+whatprovides old138 <= 2
+whatprovides old139 <= 2
+whatprovides old14 <= 2
+whatprovides old140 <= 2 old140-1-1.x86_64@available
+whatprovides old141 <= 2
+whatprovides old142 <= 2
+whatprovides old143 <= 2
+whatprovides old144 <= 2
+whatprovides old145 <= 2 old145-1-1.x86_64@available
+whatprovides old146 <= 2
+whatprovides old147 <= 2
+whatprovides old148 <= 2
+whatprovides old149 <= 2
+whatprovides old15 <= 2 old15-1-1.x86_64@available
+whatprovides old16 <= 2
+whatprovides old17 <= 2
+whatprovides old18 <= 2
+whatprovides old19 <= 2
+whatprovides old2 <= 2
+whatprovides old20 <= 2 old20-1-1.x86_64@available
+whatprovides old21 <= 2
+whatprovides old22 <= 2
+whatprovides old23 <= 2
+whatprovides old24 <= 2
+whatprovides old25 <= 2 old25-1-1.x86_64@available
+whatprovides old26 <= 2
+whatprovides old27 <= 2
+whatprovides old28 <= 2
+whatprovides old29 <= 2
+whatprovides old3 <= 2
+whatprovides old30 <= 2 old30-1-1.x86_64@available
+whatprovides old31 <= 2
+whatprovides old32 <= 2
+whatprovides old33 <= 2
+whatprovides old34 <= 2
+whatprovides old35 <= 2 old35-1-1.x86_64@available
+whatprovides old36 <= 2
+whatprovides old37 <= 2
+whatprovides old38 <= 2
+whatprovides old39 <= 2
+whatprovides old4 <= 2
+whatprovides old40 <= 2 old40-1-1.x86_64@available
+whatprovides old41 <= 2
+whatprovides old42 <= 2
+whatprovides old43 <= 2
+whatprovides old44 <= 2
+whatprovides old45 <= 2 old45-1-1.x86_64@available
+whatprovides old46 <= 2
+whatprovides old47 <= 2
+whatprovides old48 <= 2
+whatprovides old49 <= 2
+whatprovides old5 <= 2 old5-1-1.x86_64@available
+whatprovides old50 <= 2 old50-1-1.x86_64@available
+whatprovides old51 <= 2
+whatprovides old52 <= 2
+whatprovides old53 <= 2
+whatprovides old54 <= 2
+whatprovides old55 <= 2 old55-1-1.x86_64@available
+whatprovides old56 <= 2
+whatprovides old57 <= 2
+whatprovides old58 <= 2
+whatprovides old59 <= 2
+whatprovides old6 <= 2
+whatprovides old60 <= 2 old60-1-1.x86_64@available
+whatprovides old61 <= 2
+whatprovides old62 <= 2
+whatprovides old63 <= 2
+whatprovides old64 <= 2
+whatprovides old65 <= 2 old65-1-1.x86_64@available
+whatprovides old66 <= 2
+whatprovides old67 <= 2
+whatprovides old68 <= 2
+whatprovides old69 <= 2
+whatprovides old7 <= 2
+whatprovides old70 <= 2 old70-1-1.x86_64@available
+whatprovides old71 <= 2
+whatprovides old72 <= 2
+whatprovides old73 <= 2
+whatprovides old74 <= 2
+whatprovides old75 <= 2 old75-1-1.x86_64@available
+whatprovides old76 <= 2
+whatprovides old77 <= 2
+whatprovides old78 <= 2
+whatprovides old79 <= 2
+whatprovides old8 <= 2
+whatprovides old80 <= 2 old80-1-1.x86_64@available
+whatprovides old81 <= 2
+whatprovides old82 <= 2
+whatprovides old83 <= 2
+whatprovides old84 <= 2
+whatprovides old85 <= 2 old85-1-1.x86_64@available
+whatprovides old86 <= 2
+whatprovides old87 <= 2
+whatprovides old88 <= 2
+whatprovides old89 <= 2
+whatprovides old9 <= 2
+whatprovides old90 <= 2 old90-1-1.x86_64@available
+whatprovides old91 <= 2
+whatprovides old92 <= 2
+whatprovides old93 <= 2
+whatprovides old94 <= 2
+whatprovides old95 <= 2 old95-1-1.x86_64@available
+whatprovides old96 <= 2
+whatprovides old97 <= 2
+whatprovides old98 <= 2
+whatprovides old99 <= 2
+whatprovides p0 < 2 p0-1-1.x86_64@system
+whatprovides p1 < 2 p1-1-1.x86_64@system
+whatprovides p10 < 2 p10-1-1.x86_64@system
+whatprovides p100 < 2 p100-1-1.x86_64@system
+whatprovides p101 < 2 p101-1-1.x86_64@system
+whatprovides p102 < 2 p102-1-1.x86_64@system
+whatprovides p103 < 2 p103-1-1.x86_64@system
+whatprovides p104 < 2 p104-1-1.x86_64@system
+whatprovides p105 < 2 p105-1-1.x86_64@system
+whatprovides p106 < 2 p106-1-1.x86_64@system
+whatprovides p107 < 2 p107-1-1.x86_64@system
+whatprovides p108 < 2 p108-1-1.x86_64@system
+whatprovides p109 < 2 p109-1-1.x86_64@system
+whatprovides p11 < 2 p11-1-1.x86_64@system
+whatprovides p110 < 2 p110-1-1.x86_64@system
+whatprovides p111 < 2 p111-1-1.x86_64@system
+whatprovides p112 < 2 p112-1-1.x86_64@system
+whatprovides p113 < 2 p113-1-1.x86_64@system
+whatprovides p114 < 2 p114-1-1.x86_64@system
+whatprovides p115 < 2 p115-1-1.x86_64@system
+whatprovides p116 < 2 p116-1-1.x86_64@system
+whatprovides p117 < 2 p117-1-1.x86_64@system
+whatprovides p118 < 2 p118-1-1.x86_64@system
+whatprovides p119 < 2 p119-1-1.x86_64@system
+whatprovides p12 < 2 p12-1-1.x86_64@system
+whatprovides p120 < 2 p120-1-1.x86_64@system
+whatprovides p121 < 2 p121-1-1.x86_64@system
+whatprovides p122 < 2 p122-1-1.x86_64@system
+whatprovides p123 < 2 p123-1-1.x86_64@system
+whatprovides p124 < 2 p124-1-1.x86_64@system
+whatprovides p125 < 2 p125-1-1.x86_64@system
+whatprovides p126 < 2 p126-1-1.x86_64@system
+whatprovides p127 < 2 p127-1-1.x86_64@system
+whatprovides p128 < 2 p128-1-1.x86_64@system
+whatprovides p129 < 2 p129-1-1.x86_64@system
+whatprovides p13 < 2 p13-1-1.x86_64@system
+whatprovides p130 < 2 p130-1-1.x86_64@system
+whatprovides p131 < 2 p131-1-1.x86_64@system
+whatprovides p132 < 2 p132-1-1.x86_64@system
+whatprovides p133 < 2 p133-1-1.x86_64@system
+whatprovides p134 < 2 p134-1-1.x86_64@system
+whatprovides p135 < 2 p135-1-1.x86_64@system
+whatprovides p136 < 2 p136-1-1.x86_64@system
+whatprovides p137 < 2 p137-1-1.x86_64@system
+whatprovides p138 < 2 p138-1-1.x86_64@system
+whatprovides p139 < 2 p139-1-1.x86_64@system
+whatprovides p14 < 2 p14-1-1.x86_64@system
+whatprovides p140 < 2 p140-1-1.x86_64@system
+whatprovides p141 < 2 p141-1-1.x86_64@system
+whatprovides p142 < 2 p142-1-1.x86_64@system
+whatprovides p143 < 2 p143-1-1.x86_64@system
+whatprovides p144 < 2 p144-1-1.x86_64@system
+whatprovides p145 < 2 p145-1-1.x86_64@system
+whatprovides p146 < 2 p146-1-1.x86_64@system
+whatprovides p147 < 2 p147-1-1.x86_64@system
+whatprovides p148 < 2 p148-1-1.x86_64@system
+whatprovides p149 < 2 p149-1-1.x86_64@system
+whatprovides p15 < 2 p15-1-1.x86_64@system
+whatprovides p16 < 2 p16-1-1.x86_64@system
+whatprovides p17 < 2 p17-1-1.x86_64@system
+whatprovides p18 < 2 p18-1-1.x86_64@system
+whatprovides p19 < 2 p19-1-1.x86_64@system
+whatprovides p2 < 2 p2-1-1.x86_64@system
+whatprovides p20 < 2 p20-1-1.x86_64@system
+whatprovides p21 < 2 p21-1-1.x86_64@system
+whatprovides p22 < 2 p22-1-1.x86_64@system
+whatprovides p23 < 2 p23-1-1.x86_64@system
+whatprovides p24 < 2 p24-1-1.x86_64@system
+whatprovides p25 < 2 p25-1-1.x86_64@system
+whatprovides p26 < 2 p26-1-1.x86_64@system
+whatprovides p27 < 2 p27-1-1.x86_64@system
+whatprovides p28 < 2 p28-1-1.x86_64@system
+whatprovides p29 < 2 p29-1-1.x86_64@system
+whatprovides p3 < 2 p3-1-1.x86_64@system
+whatprovides p30 < 2 p30-1-1.x86_64@system
+whatprovides p31 < 2 p31-1-1.x86_64@system
+whatprovides p32 < 2 p32-1-1.x86_64@system
+whatprovides p33 < 2 p33-1-1.x86_64@system
+whatprovides p34 < 2 p34-1-1.x86_64@system
+whatprovides p35 < 2 p35-1-1.x86_64@system
+whatprovides p36 < 2 p36-1-1.x86_64@system
+whatprovides p37 < 2 p37-1-1.x86_64@system
+whatprovides p38 < 2 p38-1-1.x86_64@system
+whatprovides p39 < 2 p39-1-1.x86_64@system
+whatprovides p4 < 2 p4-1-1.x86_64@system
+whatprovides p40 < 2 p40-1-1.x86_64@system
+whatprovides p41 < 2 p41-1-1.x86_64@system
+whatprovides p42 < 2 p42-1-1.x86_64@system
+whatprovides p43 < 2 p43-1-1.x86_64@system
+whatprovides p44 < 2 p44-1-1.x86_64@system
+whatprovides p45 < 2 p45-1-1.x86_64@system
+whatprovides p46 < 2 p46-1-1.x86_64@system
+whatprovides p47 < 2 p47-1-1.x86_64@system
+whatprovides p48 < 2 p48-1-1.x86_64@system
+whatprovides p49 < 2 p49-1-1.x86_64@system
+whatprovides p5 < 2 p5-1-1.x86_64@system
+whatprovides p50 < 2 p50-1-1.x86_64@system
+whatprovides p51 < 2 p51-1-1.x86_64@system
+whatprovides p52 < 2 p52-1-1.x86_64@system
+whatprovides p53 < 2 p53-1-1.x86_64@system
+whatprovides p54 < 2 p54-1-1.x86_64@system
+whatprovides p55 < 2 p55-1-1.x86_64@system
+whatprovides p56 < 2 p56-1-1.x86_64@system
+whatprovides p57 < 2 p57-1-1.x86_64@system
+whatprovides p58 < 2 p58-1-1.x86_64@system
+whatprovides p59 < 2 p59-1-1.x86_64@system
+whatprovides p6 < 2 p6-1-1.x86_64@system
+whatprovides p60 < 2 p60-1-1.x86_64@system
+whatprovides p61 < 2 p61-1-1.x86_64@system
+whatprovides p62 < 2 p62-1-1.x86_64@system
+whatprovides p63 < 2 p63-1-1.x86_64@system
+whatprovides p64 < 2 p64-1-1.x86_64@system
+whatprovides p65 < 2 p65-1-1.x86_64@system
+whatprovides p66 < 2 p66-1-1.x86_64@system
+whatprovides p67 < 2 p67-1-1.x86_64@system
+whatprovides p68 < 2 p68-1-1.x86_64@system
+whatprovides p69 < 2 p69-1-1.x86_64@system
+whatprovides p7 < 2 p7-1-1.x86_64@system
+whatprovides p70 < 2 p70-1-1.x86_64@system
+whatprovides p71 < 2 p71-1-1.x86_64@system
+whatprovides p72 < 2 p72-1-1.x86_64@system
+whatprovides p73 < 2 p73-1-1.x86_64@system
+whatprovides p74 < 2 p74-1-1.x86_64@system
+whatprovides p75 < 2 p75-1-1.x86_64@system
+whatprovides p76 < 2 p76-1-1.x86_64@system
+whatprovides p77 < 2 p77-1-1.x86_64@system
+whatprovides p78 < 2 p78-1-1.x86_64@system
+whatprovides p79 < 2 p79-1-1.x86_64@system
+whatprovides p8 < 2 p8-1-1.x86_64@system
+whatprovides p80 < 2 p80-1-1.x86_64@system
+whatprovides p81 < 2 p81-1-1.x86_64@system
+whatprovides p82 < 2 p82-1-1.x86_64@system
+whatprovides p83 < 2 p83-1-1.x86_64@system
+whatprovides p84 < 2 p84-1-1.x86_64@system
+whatprovides p85 < 2 p85-1-1.x86_64@system
+whatprovides p86 < 2 p86-1-1.x86_64@system
+whatprovides p87 < 2 p87-1-1.x86_64@system
+whatprovides p88 < 2 p88-1-1.x86_64@system
+whatprovides p89 < 2 p89-1-1.x86_64@system
+whatprovides p9 < 2 p9-1-1.x86_64@system
+whatprovides p90 < 2 p90-1-1.x86_64@system
+whatprovides p91 < 2 p91-1-1.x86_64@system
+whatprovides p92 < 2 p92-1-1.x86_64@system
+whatprovides p93 < 2 p93-1-1.x86_64@system
+whatprovides p94 < 2 p94-1-1.x86_64@system
+whatprovides p95 < 2 p95-1-1.x86_64@system
+whatprovides p96 < 2 p96-1-1.x86_64@system
+whatprovides p97 < 2 p97-1-1.x86_64@system
+whatprovides p98 < 2 p98-1-1.x86_64@system
+whatprovides p99 < 2 p99-1-1.x86_64@system
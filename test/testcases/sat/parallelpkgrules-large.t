@@ -0,0 +1,1574 @@
+#
+# a larger update that creates enough dependencies and conflicts to
+# run the parallel pkg rule creation with multiple tasks. The serial
+# and the parallel run must create the same rules and providers.
+#
+repo system 0 testtags <inline>
+#>=Pkg: p0 1 1 x86_64
+#>=Prv: lib0 = 1
+#>=Req: lib1 >= 1
+#>=Con: c0 < 1
+#>=Pkg: p1 1 1 x86_64
+#>=Prv: lib1 = 1
+#>=Req: lib2 >= 1
+#>=Con: c1 < 1
+#>=Pkg: p2 1 1 x86_64
+#>=Prv: lib2 = 1
+#>=Req: lib3 >= 1
+#>=Con: c2 < 1
+#>=Pkg: p3 1 1 x86_64
+#>=Prv: lib3 = 1
+#>=Req: lib4 >= 1
+#>=Con: c3 < 1
+#>=Pkg: p4 1 1 x86_64
+#>=Prv: lib4 = 1
+#>=Req: lib5 >= 1
+#>=Con: c4 < 1
+#>=Pkg: p5 1 1 x86_64
+#>=Prv: lib5 = 1
+#>=Req: lib6 >= 1
+#>=Con: c5 < 1
+#>=Pkg: p6 1 1 x86_64
+#>=Prv: lib6 = 1
+#>=Req: lib7 >= 1
+#>=Con: c6 < 1
+#>=Pkg: p7 1 1 x86_64
+#>=Prv: lib7 = 1
+#>=Req: lib8 >= 1
+#>=Con: c0 < 1
+#>=Pkg: p8 1 1 x86_64
+#>=Prv: lib8 = 1
+#>=Req: lib9 >= 1
+#>=Con: c1 < 1
+#>=Pkg: p9 1 1 x86_64
+#>=Prv: lib9 = 1
+#>=Req: lib10 >= 1
+#>=Con: c2 < 1
+#>=Pkg: p10 1 1 x86_64
+#>=Prv: lib10 = 1
+#>=Req: lib11 >= 1
+#>=Con: c3 < 1
+#>=Pkg: p11 1 1 x86_64
+#>=Prv: lib11 = 1
+#>=Req: lib12 >= 1
+#>=Con: c4 < 1
+#>=Pkg: p12 1 1 x86_64
+#>=Prv: lib12 = 1
+#>=Req: lib13 >= 1
+#>=Con: c5 < 1
+#>=Pkg: p13 1 1 x86_64
+#>=Prv: lib13 = 1
+#>=Req: lib14 >= 1
+#>=Con: c6 < 1
+#>=Pkg: p14 1 1 x86_64
+#>=Prv: lib14 = 1
+#>=Req: lib15 >= 1
+#>=Con: c0 < 1
+#>=Pkg: p15 1 1 x86_64
+#>=Prv: lib15 = 1
+#>=Req: lib16 >= 1
+#>=Con: c1 < 1
+#>=Pkg: p16 1 1 x86_64
+#>=Prv: lib16 = 1
+#>=Req: lib17 >= 1
+#>=Con: c2 < 1
+#>=Pkg: p17 1 1 x86_64
+#>=Prv: lib17 = 1
+#>=Req: lib18 >= 1
+#>=Con: c3 < 1
+#>=Pkg: p18 1 1 x86_64
+#>=Prv: lib18 = 1
+#>=Req: lib19 >= 1
+#>=Con: c4 < 1
+#>=Pkg: p19 1 1 x86_64
+#>=Prv: lib19 = 1
+#>=Req: lib20 >= 1
+#>=Con: c5 < 1
+#>=Pkg: p20 1 1 x86_64
+#>=Prv: lib20 = 1
+#>=Req: lib21 >= 1
+#>=Con: c6 < 1
+#>=Pkg: p21 1 1 x86_64
+#>=Prv: lib21 = 1
+#>=Req: lib22 >= 1
+#>=Con: c0 < 1
+#>=Pkg: p22 1 1 x86_64
+#>=Prv: lib22 = 1
+#>=Req: lib23 >= 1
+#>=Con: c1 < 1
+#>=Pkg: p23 1 1 x86_64
+#>=Prv: lib23 = 1
+#>=Req: lib24 >= 1
+#>=Con: c2 < 1
+#>=Pkg: p24 1 1 x86_64
+#>=Prv: lib24 = 1
+#>=Req: lib25 >= 1
+#>=Con: c3 < 1
+#>=Pkg: p25 1 1 x86_64
+#>=Prv: lib25 = 1
+#>=Req: lib26 >= 1
+#>=Con: c4 < 1
+#>=Pkg: p26 1 1 x86_64
+#>=Prv: lib26 = 1
+#>=Req: lib27 >= 1
+#>=Con: c5 < 1
+#>=Pkg: p27 1 1 x86_64
+#>=Prv: lib27 = 1
+#>=Req: lib28 >= 1
+#>=Con: c6 < 1
+#>=Pkg: p28 1 1 x86_64
+#>=Prv: lib28 = 1
+#>=Req: lib29 >= 1
+#>=Con: c0 < 1
+#>=Pkg: p29 1 1 x86_64
+#>=Prv: lib29 = 1
+#>=Req: lib30 >= 1
+#>=Con: c1 < 1
+#>=Pkg: p30 1 1 x86_64
+#>=Prv: lib30 = 1
+#>=Req: lib31 >= 1
+#>=Con: c2 < 1
+#>=Pkg: p31 1 1 x86_64
+#>=Prv: lib31 = 1
+#>=Req: lib32 >= 1
+#>=Con: c3 < 1
+#>=Pkg: p32 1 1 x86_64
+#>=Prv: lib32 = 1
+#>=Req: lib33 >= 1
+#>=Con: c4 < 1
+#>=Pkg: p33 1 1 x86_64
+#>=Prv: lib33 = 1
+#>=Req: lib34 >= 1
+#>=Con: c5 < 1
+#>=Pkg: p34 1 1 x86_64
+#>=Prv: lib34 = 1
+#>=Req: lib35 >= 1
+#>=Con: c6 < 1
+#>=Pkg: p35 1 1 x86_64
+#>=Prv: lib35 = 1
+#>=Req: lib36 >= 1
+#>=Con: c0 < 1
+#>=Pkg: p36 1 1 x86_64
+#>=Prv: lib36 = 1
+#>=Req: lib37 >= 1
+#>=Con: c1 < 1
+#>=Pkg: p37 1 1 x86_64
+#>=Prv: lib37 = 1
+#>=Req: lib38 >= 1
+#>=Con: c2 < 1
+#>=Pkg: p38 1 1 x86_64
+#>=Prv: lib38 = 1
+#>=Req: lib39 >= 1
+#>=Con: c3 < 1
+#>=Pkg: p39 1 1 x86_64
+#>=Prv: lib39 = 1
+#>=Req: lib40 >= 1
+#>=Con: c4 < 1
+#>=Pkg: p40 1 1 x86_64
+#>=Prv: lib40 = 1
+#>=Req: lib41 >= 1
+#>=Con: c5 < 1
+#>=Pkg: p41 1 1 x86_64
+#>=Prv: lib41 = 1
+#>=Req: lib42 >= 1
+#>=Con: c6 < 1
+#>=Pkg: p42 1 1 x86_64
+#>=Prv: lib42 = 1
+#>=Req: lib43 >= 1
+#>=Con: c0 < 1
+#>=Pkg: p43 1 1 x86_64
+#>=Prv: lib43 = 1
+#>=Req: lib44 >= 1
+#>=Con: c1 < 1
+#>=Pkg: p44 1 1 x86_64
+#>=Prv: lib44 = 1
+#>=Req: lib45 >= 1
+#>=Con: c2 < 1
+#>=Pkg: p45 1 1 x86_64
+#>=Prv: lib45 = 1
+#>=Req: lib46 >= 1
+#>=Con: c3 < 1
+#>=Pkg: p46 1 1 x86_64
+#>=Prv: lib46 = 1
+#>=Req: lib47 >= 1
+#>=Con: c4 < 1
+#>=Pkg: p47 1 1 x86_64
+#>=Prv: lib47 = 1
+#>=Req: lib48 >= 1
+#>=Con: c5 < 1
+#>=Pkg: p48 1 1 x86_64
+#>=Prv: lib48 = 1
+#>=Req: lib49 >= 1
+#>=Con: c6 < 1
+#>=Pkg: p49 1 1 x86_64
+#>=Prv: lib49 = 1
+#>=Req: lib50 >= 1
+#>=Con: c0 < 1
+#>=Pkg: p50 1 1 x86_64
+#>=Prv: lib50 = 1
+#>=Req: lib51 >= 1
+#>=Con: c1 < 1
+#>=Pkg: p51 1 1 x86_64
+#>=Prv: lib51 = 1
+#>=Req: lib52 >= 1
+#>=Con: c2 < 1
+#>=Pkg: p52 1 1 x86_64
+#>=Prv: lib52 = 1
+#>=Req: lib53 >= 1
+#>=Con: c3 < 1
+#>=Pkg: p53 1 1 x86_64
+#>=Prv: lib53 = 1
+#>=Req: lib54 >= 1
+#>=Con: c4 < 1
+#>=Pkg: p54 1 1 x86_64
+#>=Prv: lib54 = 1
+#>=Req: lib55 >= 1
+#>=Con: c5 < 1
+#>=Pkg: p55 1 1 x86_64
+#>=Prv: lib55 = 1
+#>=Req: lib56 >= 1
+#>=Con: c6 < 1
+#>=Pkg: p56 1 1 x86_64
+#>=Prv: lib56 = 1
+#>=Req: lib57 >= 1
+#>=Con: c0 < 1
+#>=Pkg: p57 1 1 x86_64
+#>=Prv: lib57 = 1
+#>=Req: lib58 >= 1
+#>=Con: c1 < 1
+#>=Pkg: p58 1 1 x86_64
+#>=Prv: lib58 = 1
+#>=Req: lib59 >= 1
+#>=Con: c2 < 1
+#>=Pkg: p59 1 1 x86_64
+#>=Prv: lib59 = 1
+#>=Req: lib60 >= 1
+#>=Con: c3 < 1
+#>=Pkg: p60 1 1 x86_64
+#>=Prv: lib60 = 1
+#>=Req: lib61 >= 1
+#>=Con: c4 < 1
+#>=Pkg: p61 1 1 x86_64
+#>=Prv: lib61 = 1
+#>=Req: lib62 >= 1
+#>=Con: c5 < 1
+#>=Pkg: p62 1 1 x86_64
+#>=Prv: lib62 = 1
+#>=Req: lib63 >= 1
+#>=Con: c6 < 1
+#>=Pkg: p63 1 1 x86_64
+#>=Prv: lib63 = 1
+#>=Req: lib64 >= 1
+#>=Con: c0 < 1
+#>=Pkg: p64 1 1 x86_64
+#>=Prv: lib64 = 1
+#>=Req: lib65 >= 1
+#>=Con: c1 < 1
+#>=Pkg: p65 1 1 x86_64
+#>=Prv: lib65 = 1
+#>=Req: lib66 >= 1
+#>=Con: c2 < 1
+#>=Pkg: p66 1 1 x86_64
+#>=Prv: lib66 = 1
+#>=Req: lib67 >= 1
+#>=Con: c3 < 1
+#>=Pkg: p67 1 1 x86_64
+#>=Prv: lib67 = 1
+#>=Req: lib68 >= 1
+#>=Con: c4 < 1
+#>=Pkg: p68 1 1 x86_64
+#>=Prv: lib68 = 1
+#>=Req: lib69 >= 1
+#>=Con: c5 < 1
+#>=Pkg: p69 1 1 x86_64
+#>=Prv: lib69 = 1
+#>=Req: lib70 >= 1
+#>=Con: c6 < 1
+#>=Pkg: p70 1 1 x86_64
+#>=Prv: lib70 = 1
+#>=Req: lib71 >= 1
+#>=Con: c0 < 1
+#>=Pkg: p71 1 1 x86_64
+#>=Prv: lib71 = 1
+#>=Req: lib72 >= 1
+#>=Con: c1 < 1
+#>=Pkg: p72 1 1 x86_64
+#>=Prv: lib72 = 1
+#>=Req: lib73 >= 1
+#>=Con: c2 < 1
+#>=Pkg: p73 1 1 x86_64
+#>=Prv: lib73 = 1
+#>=Req: lib74 >= 1
+#>=Con: c3 < 1
+#>=Pkg: p74 1 1 x86_64
+#>=Prv: lib74 = 1
+#>=Req: lib75 >= 1
+#>=Con: c4 < 1
+#>=Pkg: p75 1 1 x86_64
+#>=Prv: lib75 = 1
+#>=Req: lib76 >= 1
+#>=Con: c5 < 1
+#>=Pkg: p76 1 1 x86_64
+#>=Prv: lib76 = 1
+#>=Req: lib77 >= 1
+#>=Con: c6 < 1
+#>=Pkg: p77 1 1 x86_64
+#>=Prv: lib77 = 1
+#>=Req: lib78 >= 1
+#>=Con: c0 < 1
+#>=Pkg: p78 1 1 x86_64
+#>=Prv: lib78 = 1
+#>=Req: lib79 >= 1
+#>=Con: c1 < 1
+#>=Pkg: p79 1 1 x86_64
+#>=Prv: lib79 = 1
+#>=Req: lib80 >= 1
+#>=Con: c2 < 1
+#>=Pkg: p80 1 1 x86_64
+#>=Prv: lib80 = 1
+#>=Req: lib81 >= 1
+#>=Con: c3 < 1
+#>=Pkg: p81 1 1 x86_64
+#>=Prv: lib81 = 1
+#>=Req: lib82 >= 1
+#>=Con: c4 < 1
+#>=Pkg: p82 1 1 x86_64
+#>=Prv: lib82 = 1
+#>=Req: lib83 >= 1
+#>=Con: c5 < 1
+#>=Pkg: p83 1 1 x86_64
+#>=Prv: lib83 = 1
+#>=Req: lib84 >= 1
+#>=Con: c6 < 1
+#>=Pkg: p84 1 1 x86_64
+#>=Prv: lib84 = 1
+#>=Req: lib85 >= 1
+#>=Con: c0 < 1
+#>=Pkg: p85 1 1 x86_64
+#>=Prv: lib85 = 1
+#>=Req: lib86 >= 1
+#>=Con: c1 < 1
+#>=Pkg: p86 1 1 x86_64
+#>=Prv: lib86 = 1
+#>=Req: lib87 >= 1
+#>=Con: c2 < 1
+#>=Pkg: p87 1 1 x86_64
+#>=Prv: lib87 = 1
+#>=Req: lib88 >= 1
+#>=Con: c3 < 1
+#>=Pkg: p88 1 1 x86_64
+#>=Prv: lib88 = 1
+#>=Req: lib89 >= 1
+#>=Con: c4 < 1
+#>=Pkg: p89 1 1 x86_64
+#>=Prv: lib89 = 1
+#>=Req: lib90 >= 1
+#>=Con: c5 < 1
+#>=Pkg: p90 1 1 x86_64
+#>=Prv: lib90 = 1
+#>=Req: lib91 >= 1
+#>=Con: c6 < 1
+#>=Pkg: p91 1 1 x86_64
+#>=Prv: lib91 = 1
+#>=Req: lib92 >= 1
+#>=Con: c0 < 1
+#>=Pkg: p92 1 1 x86_64
+#>=Prv: lib92 = 1
+#>=Req: lib93 >= 1
+#>=Con: c1 < 1
+#>=Pkg: p93 1 1 x86_64
+#>=Prv: lib93 = 1
+#>=Req: lib94 >= 1
+#>=Con: c2 < 1
+#>=Pkg: p94 1 1 x86_64
+#>=Prv: lib94 = 1
+#>=Req: lib95 >= 1
+#>=Con: c3 < 1
+#>=Pkg: p95 1 1 x86_64
+#>=Prv: lib95 = 1
+#>=Req: lib96 >= 1
+#>=Con: c4 < 1
+#>=Pkg: p96 1 1 x86_64
+#>=Prv: lib96 = 1
+#>=Req: lib97 >= 1
+#>=Con: c5 < 1
+#>=Pkg: p97 1 1 x86_64
+#>=Prv: lib97 = 1
+#>=Req: lib98 >= 1
+#>=Con: c6 < 1
+#>=Pkg: p98 1 1 x86_64
+#>=Prv: lib98 = 1
+#>=Req: lib99 >= 1
+#>=Con: c0 < 1
+#>=Pkg: p99 1 1 x86_64
+#>=Prv: lib99 = 1
+#>=Req: lib100 >= 1
+#>=Con: c1 < 1
+#>=Pkg: p100 1 1 x86_64
+#>=Prv: lib100 = 1
+#>=Req: lib101 >= 1
+#>=Con: c2 < 1
+#>=Pkg: p101 1 1 x86_64
+#>=Prv: lib101 = 1
+#>=Req: lib102 >= 1
+#>=Con: c3 < 1
+#>=Pkg: p102 1 1 x86_64
+#>=Prv: lib102 = 1
+#>=Req: lib103 >= 1
+#>=Con: c4 < 1
+#>=Pkg: p103 1 1 x86_64
+#>=Prv: lib103 = 1
+#>=Req: lib104 >= 1
+#>=Con: c5 < 1
+#>=Pkg: p104 1 1 x86_64
+#>=Prv: lib104 = 1
+#>=Req: lib105 >= 1
+#>=Con: c6 < 1
+#>=Pkg: p105 1 1 x86_64
+#>=Prv: lib105 = 1
+#>=Req: lib106 >= 1
+#>=Con: c0 < 1
+#>=Pkg: p106 1 1 x86_64
+#>=Prv: lib106 = 1
+#>=Req: lib107 >= 1
+#>=Con: c1 < 1
+#>=Pkg: p107 1 1 x86_64
+#>=Prv: lib107 = 1
+#>=Req: lib108 >= 1
+#>=Con: c2 < 1
+#>=Pkg: p108 1 1 x86_64
+#>=Prv: lib108 = 1
+#>=Req: lib109 >= 1
+#>=Con: c3 < 1
+#>=Pkg: p109 1 1 x86_64
+#>=Prv: lib109 = 1
+#>=Req: lib110 >= 1
+#>=Con: c4 < 1
+#>=Pkg: p110 1 1 x86_64
+#>=Prv: lib110 = 1
+#>=Req: lib111 >= 1
+#>=Con: c5 < 1
+#>=Pkg: p111 1 1 x86_64
+#>=Prv: lib111 = 1
+#>=Req: lib112 >= 1
+#>=Con: c6 < 1
+#>=Pkg: p112 1 1 x86_64
+#>=Prv: lib112 = 1
+#>=Req: lib113 >= 1
+#>=Con: c0 < 1
+#>=Pkg: p113 1 1 x86_64
+#>=Prv: lib113 = 1
+#>=Req: lib114 >= 1
+#>=Con: c1 < 1
+#>=Pkg: p114 1 1 x86_64
+#>=Prv: lib114 = 1
+#>=Req: lib115 >= 1
+#>=Con: c2 < 1
+#>=Pkg: p115 1 1 x86_64
+#>=Prv: lib115 = 1
+#>=Req: lib116 >= 1
+#>=Con: c3 < 1
+#>=Pkg: p116 1 1 x86_64
+#>=Prv: lib116 = 1
+#>=Req: lib117 >= 1
+#>=Con: c4 < 1
+#>=Pkg: p117 1 1 x86_64
+#>=Prv: lib117 = 1
+#>=Req: lib118 >= 1
+#>=Con: c5 < 1
+#>=Pkg: p118 1 1 x86_64
+#>=Prv: lib118 = 1
+#>=Req: lib119 >= 1
+#>=Con: c6 < 1
+#>=Pkg: p119 1 1 x86_64
+#>=Prv: lib119 = 1
+#>=Req: lib120 >= 1
+#>=Con: c0 < 1
+#>=Pkg: p120 1 1 x86_64
+#>=Prv: lib120 = 1
+#>=Req: lib121 >= 1
+#>=Con: c1 < 1
+#>=Pkg: p121 1 1 x86_64
+#>=Prv: lib121 = 1
+#>=Req: lib122 >= 1
+#>=Con: c2 < 1
+#>=Pkg: p122 1 1 x86_64
+#>=Prv: lib122 = 1
+#>=Req: lib123 >= 1
+#>=Con: c3 < 1
+#>=Pkg: p123 1 1 x86_64
+#>=Prv: lib123 = 1
+#>=Req: lib124 >= 1
+#>=Con: c4 < 1
+#>=Pkg: p124 1 1 x86_64
+#>=Prv: lib124 = 1
+#>=Req: lib125 >= 1
+#>=Con: c5 < 1
+#>=Pkg: p125 1 1 x86_64
+#>=Prv: lib125 = 1
+#>=Req: lib126 >= 1
+#>=Con: c6 < 1
+#>=Pkg: p126 1 1 x86_64
+#>=Prv: lib126 = 1
+#>=Req: lib127 >= 1
+#>=Con: c0 < 1
+#>=Pkg: p127 1 1 x86_64
+#>=Prv: lib127 = 1
+#>=Req: lib128 >= 1
+#>=Con: c1 < 1
+#>=Pkg: p128 1 1 x86_64
+#>=Prv: lib128 = 1
+#>=Req: lib129 >= 1
+#>=Con: c2 < 1
+#>=Pkg: p129 1 1 x86_64
+#>=Prv: lib129 = 1
+#>=Req: lib130 >= 1
+#>=Con: c3 < 1
+#>=Pkg: p130 1 1 x86_64
+#>=Prv: lib130 = 1
+#>=Req: lib131 >= 1
+#>=Con: c4 < 1
+#>=Pkg: p131 1 1 x86_64
+#>=Prv: lib131 = 1
+#>=Req: lib132 >= 1
+#>=Con: c5 < 1
+#>=Pkg: p132 1 1 x86_64
+#>=Prv: lib132 = 1
+#>=Req: lib133 >= 1
+#>=Con: c6 < 1
+#>=Pkg: p133 1 1 x86_64
+#>=Prv: lib133 = 1
+#>=Req: lib134 >= 1
+#>=Con: c0 < 1
+#>=Pkg: p134 1 1 x86_64
+#>=Prv: lib134 = 1
+#>=Req: lib135 >= 1
+#>=Con: c1 < 1
+#>=Pkg: p135 1 1 x86_64
+#>=Prv: lib135 = 1
+#>=Req: lib136 >= 1
+#>=Con: c2 < 1
+#>=Pkg: p136 1 1 x86_64
+#>=Prv: lib136 = 1
+#>=Req: lib137 >= 1
+#>=Con: c3 < 1
+#>=Pkg: p137 1 1 x86_64
+#>=Prv: lib137 = 1
+#>=Req: lib138 >= 1
+#>=Con: c4 < 1
+#>=Pkg: p138 1 1 x86_64
+#>=Prv: lib138 = 1
+#>=Req: lib139 >= 1
+#>=Con: c5 < 1
+#>=Pkg: p139 1 1 x86_64
+#>=Prv: lib139 = 1
+#>=Req: lib140 >= 1
+#>=Con: c6 < 1
+#>=Pkg: p140 1 1 x86_64
+#>=Prv: lib140 = 1
+#>=Req: lib141 >= 1
+#>=Con: c0 < 1
+#>=Pkg: p141 1 1 x86_64
+#>=Prv: lib141 = 1
+#>=Req: lib142 >= 1
+#>=Con: c1 < 1
+#>=Pkg: p142 1 1 x86_64
+#>=Prv: lib142 = 1
+#>=Req: lib143 >= 1
+#>=Con: c2 < 1
+#>=Pkg: p143 1 1 x86_64
+#>=Prv: lib143 = 1
+#>=Req: lib144 >= 1
+#>=Con: c3 < 1
+#>=Pkg: p144 1 1 x86_64
+#>=Prv: lib144 = 1
+#>=Req: lib145 >= 1
+#>=Con: c4 < 1
+#>=Pkg: p145 1 1 x86_64
+#>=Prv: lib145 = 1
+#>=Req: lib146 >= 1
+#>=Con: c5 < 1
+#>=Pkg: p146 1 1 x86_64
+#>=Prv: lib146 = 1
+#>=Req: lib147 >= 1
+#>=Con: c6 < 1
+#>=Pkg: p147 1 1 x86_64
+#>=Prv: lib147 = 1
+#>=Req: lib148 >= 1
+#>=Con: c0 < 1
+#>=Pkg: p148 1 1 x86_64
+#>=Prv: lib148 = 1
+#>=Req: lib149 >= 1
+#>=Con: c1 < 1
+#>=Pkg: p149 1 1 x86_64
+#>=Prv: lib149 = 1
+#>=Req: lib0 >= 1
+#>=Con: c2 < 1
+repo available 0 testtags <inline>
+#>=Pkg: p0 2 1 x86_64
+#>=Prv: lib0 = 2
+#>=Req: lib1 >= 2
+#>=Req: lib7 > 1
+#>=Con: p3 < 2
+#>=Obs: old0 <= 2
+#>=Pkg: old0 1 1 x86_64
+#>=Req: lib0 = 1
+#>=Pkg: p1 2 1 x86_64
+#>=Prv: lib1 = 2
+#>=Req: lib2 >= 2
+#>=Req: lib8 > 1
+#>=Con: p4 < 2
+#>=Obs: old1 <= 2
+#>=Pkg: p2 2 1 x86_64
+#>=Prv: lib2 = 2
+#>=Req: lib3 >= 2
+#>=Req: lib9 > 1
+#>=Con: p5 < 2
+#>=Obs: old2 <= 2
+#>=Pkg: p3 2 1 x86_64
+#>=Prv: lib3 = 2
+#>=Req: lib4 >= 2
+#>=Req: lib10 > 1
+#>=Con: p6 < 2
+#>=Obs: old3 <= 2
+#>=Pkg: p4 2 1 x86_64
+#>=Prv: lib4 = 2
+#>=Req: lib5 >= 2
+#>=Req: lib11 > 1
+#>=Con: p7 < 2
+#>=Obs: old4 <= 2
+#>=Pkg: p5 2 1 x86_64
+#>=Prv: lib5 = 2
+#>=Req: lib6 >= 2
+#>=Req: lib12 > 1
+#>=Con: p8 < 2
+#>=Obs: old5 <= 2
+#>=Pkg: old5 1 1 x86_64
+#>=Req: lib5 = 1
+#>=Pkg: p6 2 1 x86_64
+#>=Prv: lib6 = 2
+#>=Req: lib7 >= 2
+#>=Req: lib13 > 1
+#>=Con: p9 < 2
+#>=Obs: old6 <= 2
+#>=Pkg: p7 2 1 x86_64
+#>=Prv: lib7 = 2
+#>=Req: lib8 >= 2
+#>=Req: lib14 > 1
+#>=Con: p10 < 2
+#>=Obs: old7 <= 2
+#>=Pkg: p8 2 1 x86_64
+#>=Prv: lib8 = 2
+#>=Req: lib9 >= 2
+#>=Req: lib15 > 1
+#>=Con: p11 < 2
+#>=Obs: old8 <= 2
+#>=Pkg: p9 2 1 x86_64
+#>=Prv: lib9 = 2
+#>=Req: lib10 >= 2
+#>=Req: lib16 > 1
+#>=Con: p12 < 2
+#>=Obs: old9 <= 2
+#>=Pkg: p10 2 1 x86_64
+#>=Prv: lib10 = 2
+#>=Req: lib11 >= 2
+#>=Req: lib17 > 1
+#>=Con: p13 < 2
+#>=Obs: old10 <= 2
+#>=Pkg: old10 1 1 x86_64
+#>=Req: lib10 = 1
+#>=Pkg: p11 2 1 x86_64
+#>=Prv: lib11 = 2
+#>=Req: lib12 >= 2
+#>=Req: lib18 > 1
+#>=Con: p14 < 2
+#>=Obs: old11 <= 2
+#>=Pkg: p12 2 1 x86_64
+#>=Prv: lib12 = 2
+#>=Req: lib13 >= 2
+#>=Req: lib19 > 1
+#>=Con: p15 < 2
+#>=Obs: old12 <= 2
+#>=Pkg: p13 2 1 x86_64
+#>=Prv: lib13 = 2
+#>=Req: lib14 >= 2
+#>=Req: lib20 > 1
+#>=Con: p16 < 2
+#>=Obs: old13 <= 2
+#>=Pkg: p14 2 1 x86_64
+#>=Prv: lib14 = 2
+#>=Req: lib15 >= 2
+#>=Req: lib21 > 1
+#>=Con: p17 < 2
+#>=Obs: old14 <= 2
+#>=Pkg: p15 2 1 x86_64
+#>=Prv: lib15 = 2
+#>=Req: lib16 >= 2
+#>=Req: lib22 > 1
+#>=Con: p18 < 2
+#>=Obs: old15 <= 2
+#>=Pkg: old15 1 1 x86_64
+#>=Req: lib15 = 1
+#>=Pkg: p16 2 1 x86_64
+#>=Prv: lib16 = 2
+#>=Req: lib17 >= 2
+#>=Req: lib23 > 1
+#>=Con: p19 < 2
+#>=Obs: old16 <= 2
+#>=Pkg: p17 2 1 x86_64
+#>=Prv: lib17 = 2
+#>=Req: lib18 >= 2
+#>=Req: lib24 > 1
+#>=Con: p20 < 2
+#>=Obs: old17 <= 2
+#>=Pkg: p18 2 1 x86_64
+#>=Prv: lib18 = 2
+#>=Req: lib19 >= 2
+#>=Req: lib25 > 1
+#>=Con: p21 < 2
+#>=Obs: old18 <= 2
+#>=Pkg: p19 2 1 x86_64
+#>=Prv: lib19 = 2
+#>=Req: lib20 >= 2
+#>=Req: lib26 > 1
+#>=Con: p22 < 2
+#>=Obs: old19 <= 2
+#>=Pkg: p20 2 1 x86_64
+#>=Prv: lib20 = 2
+#>=Req: lib21 >= 2
+#>=Req: lib27 > 1
+#>=Con: p23 < 2
+#>=Obs: old20 <= 2
+#>=Pkg: old20 1 1 x86_64
+#>=Req: lib20 = 1
+#>=Pkg: p21 2 1 x86_64
+#>=Prv: lib21 = 2
+#>=Req: lib22 >= 2
+#>=Req: lib28 > 1
+#>=Con: p24 < 2
+#>=Obs: old21 <= 2
+#>=Pkg: p22 2 1 x86_64
+#>=Prv: lib22 = 2
+#>=Req: lib23 >= 2
+#>=Req: lib29 > 1
+#>=Con: p25 < 2
+#>=Obs: old22 <= 2
+#>=Pkg: p23 2 1 x86_64
+#>=Prv: lib23 = 2
+#>=Req: lib24 >= 2
+#>=Req: lib30 > 1
+#>=Con: p26 < 2
+#>=Obs: old23 <= 2
+#>=Pkg: p24 2 1 x86_64
+#>=Prv: lib24 = 2
+#>=Req: lib25 >= 2
+#>=Req: lib31 > 1
+#>=Con: p27 < 2
+#>=Obs: old24 <= 2
+#>=Pkg: p25 2 1 x86_64
+#>=Prv: lib25 = 2
+#>=Req: lib26 >= 2
+#>=Req: lib32 > 1
+#>=Con: p28 < 2
+#>=Obs: old25 <= 2
+#>=Pkg: old25 1 1 x86_64
+#>=Req: lib25 = 1
+#>=Pkg: p26 2 1 x86_64
+#>=Prv: lib26 = 2
+#>=Req: lib27 >= 2
+#>=Req: lib33 > 1
+#>=Con: p29 < 2
+#>=Obs: old26 <= 2
+#>=Pkg: p27 2 1 x86_64
+#>=Prv: lib27 = 2
+#>=Req: lib28 >= 2
+#>=Req: lib34 > 1
+#>=Con: p30 < 2
+#>=Obs: old27 <= 2
+#>=Pkg: p28 2 1 x86_64
+#>=Prv: lib28 = 2
+#>=Req: lib29 >= 2
+#>=Req: lib35 > 1
+#>=Con: p31 < 2
+#>=Obs: old28 <= 2
+#>=Pkg: p29 2 1 x86_64
+#>=Prv: lib29 = 2
+#>=Req: lib30 >= 2
+#>=Req: lib36 > 1
+#>=Con: p32 < 2
+#>=Obs: old29 <= 2
+#>=Pkg: p30 2 1 x86_64
+#>=Prv: lib30 = 2
+#>=Req: lib31 >= 2
+#>=Req: lib37 > 1
+#>=Con: p33 < 2
+#>=Obs: old30 <= 2
+#>=Pkg: old30 1 1 x86_64
+#>=Req: lib30 = 1
+#>=Pkg: p31 2 1 x86_64
+#>=Prv: lib31 = 2
+#>=Req: lib32 >= 2
+#>=Req: lib38 > 1
+#>=Con: p34 < 2
+#>=Obs: old31 <= 2
+#>=Pkg: p32 2 1 x86_64
+#>=Prv: lib32 = 2
+#>=Req: lib33 >= 2
+#>=Req: lib39 > 1
+#>=Con: p35 < 2
+#>=Obs: old32 <= 2
+#>=Pkg: p33 2 1 x86_64
+#>=Prv: lib33 = 2
+#>=Req: lib34 >= 2
+#>=Req: lib40 > 1
+#>=Con: p36 < 2
+#>=Obs: old33 <= 2
+#>=Pkg: p34 2 1 x86_64
+#>=Prv: lib34 = 2
+#>=Req: lib35 >= 2
+#>=Req: lib41 > 1
+#>=Con: p37 < 2
+#>=Obs: old34 <= 2
+#>=Pkg: p35 2 1 x86_64
+#>=Prv: lib35 = 2
+#>=Req: lib36 >= 2
+#>=Req: lib42 > 1
+#>=Con: p38 < 2
+#>=Obs: old35 <= 2
+#>=Pkg: old35 1 1 x86_64
+#>=Req: lib35 = 1
+#>=Pkg: p36 2 1 x86_64
+#>=Prv: lib36 = 2
+#>=Req: lib37 >= 2
+#>=Req: lib43 > 1
+#>=Con: p39 < 2
+#>=Obs: old36 <= 2
+#>=Pkg: p37 2 1 x86_64
+#>=Prv: lib37 = 2
+#>=Req: lib38 >= 2
+#>=Req: lib44 > 1
+#>=Con: p40 < 2
+#>=Obs: old37 <= 2
+#>=Pkg: p38 2 1 x86_64
+#>=Prv: lib38 = 2
+#>=Req: lib39 >= 2
+#>=Req: lib45 > 1
+#>=Con: p41 < 2
+#>=Obs: old38 <= 2
+#>=Pkg: p39 2 1 x86_64
+#>=Prv: lib39 = 2
+#>=Req: lib40 >= 2
+#>=Req: lib46 > 1
+#>=Con: p42 < 2
+#>=Obs: old39 <= 2
+#>=Pkg: p40 2 1 x86_64
+#>=Prv: lib40 = 2
+#>=Req: lib41 >= 2
+#>=Req: lib47 > 1
+#>=Con: p43 < 2
+#>=Obs: old40 <= 2
+#>=Pkg: old40 1 1 x86_64
+#>=Req: lib40 = 1
+#>=Pkg: p41 2 1 x86_64
+#>=Prv: lib41 = 2
+#>=Req: lib42 >= 2
+#>=Req: lib48 > 1
+#>=Con: p44 < 2
+#>=Obs: old41 <= 2
+#>=Pkg: p42 2 1 x86_64
+#>=Prv: lib42 = 2
+#>=Req: lib43 >= 2
+#>=Req: lib49 > 1
+#>=Con: p45 < 2
+#>=Obs: old42 <= 2
+#>=Pkg: p43 2 1 x86_64
+#>=Prv: lib43 = 2
+#>=Req: lib44 >= 2
+#>=Req: lib50 > 1
+#>=Con: p46 < 2
+#>=Obs: old43 <= 2
+#>=Pkg: p44 2 1 x86_64
+#>=Prv: lib44 = 2
+#>=Req: lib45 >= 2
+#>=Req: lib51 > 1
+#>=Con: p47 < 2
+#>=Obs: old44 <= 2
+#>=Pkg: p45 2 1 x86_64
+#>=Prv: lib45 = 2
+#>=Req: lib46 >= 2
+#>=Req: lib52 > 1
+#>=Con: p48 < 2
+#>=Obs: old45 <= 2
+#>=Pkg: old45 1 1 x86_64
+#>=Req: lib45 = 1
+#>=Pkg: p46 2 1 x86_64
+#>=Prv: lib46 = 2
+#>=Req: lib47 >= 2
+#>=Req: lib53 > 1
+#>=Con: p49 < 2
+#>=Obs: old46 <= 2
+#>=Pkg: p47 2 1 x86_64
+#>=Prv: lib47 = 2
+#>=Req: lib48 >= 2
+#>=Req: lib54 > 1
+#>=Con: p50 < 2
+#>=Obs: old47 <= 2
+#>=Pkg: p48 2 1 x86_64
+#>=Prv: lib48 = 2
+#>=Req: lib49 >= 2
+#>=Req: lib55 > 1
+#>=Con: p51 < 2
+#>=Obs: old48 <= 2
+#>=Pkg: p49 2 1 x86_64
+#>=Prv: lib49 = 2
+#>=Req: lib50 >= 2
+#>=Req: lib56 > 1
+#>=Con: p52 < 2
+#>=Obs: old49 <= 2
+#>=Pkg: p50 2 1 x86_64
+#>=Prv: lib50 = 2
+#>=Req: lib51 >= 2
+#>=Req: lib57 > 1
+#>=Con: p53 < 2
+#>=Obs: old50 <= 2
+#>=Pkg: old50 1 1 x86_64
+#>=Req: lib50 = 1
+#>=Pkg: p51 2 1 x86_64
+#>=Prv: lib51 = 2
+#>=Req: lib52 >= 2
+#>=Req: lib58 > 1
+#>=Con: p54 < 2
+#>=Obs: old51 <= 2
+#>=Pkg: p52 2 1 x86_64
+#>=Prv: lib52 = 2
+#>=Req: lib53 >= 2
+#>=Req: lib59 > 1
+#>=Con: p55 < 2
+#>=Obs: old52 <= 2
+#>=Pkg: p53 2 1 x86_64
+#>=Prv: lib53 = 2
+#>=Req: lib54 >= 2
+#>=Req: lib60 > 1
+#>=Con: p56 < 2
+#>=Obs: old53 <= 2
+#>=Pkg: p54 2 1 x86_64
+#>=Prv: lib54 = 2
+#>=Req: lib55 >= 2
+#>=Req: lib61 > 1
+#>=Con: p57 < 2
+#>=Obs: old54 <= 2
+#>=Pkg: p55 2 1 x86_64
+#>=Prv: lib55 = 2
+#>=Req: lib56 >= 2
+#>=Req: lib62 > 1
+#>=Con: p58 < 2
+#>=Obs: old55 <= 2
+#>=Pkg: old55 1 1 x86_64
+#>=Req: lib55 = 1
+#>=Pkg: p56 2 1 x86_64
+#>=Prv: lib56 = 2
+#>=Req: lib57 >= 2
+#>=Req: lib63 > 1
+#>=Con: p59 < 2
+#>=Obs: old56 <= 2
+#>=Pkg: p57 2 1 x86_64
+#>=Prv: lib57 = 2
+#>=Req: lib58 >= 2
+#>=Req: lib64 > 1
+#>=Con: p60 < 2
+#>=Obs: old57 <= 2
+#>=Pkg: p58 2 1 x86_64
+#>=Prv: lib58 = 2
+#>=Req: lib59 >= 2
+#>=Req: lib65 > 1
+#>=Con: p61 < 2
+#>=Obs: old58 <= 2
+#>=Pkg: p59 2 1 x86_64
+#>=Prv: lib59 = 2
+#>=Req: lib60 >= 2
+#>=Req: lib66 > 1
+#>=Con: p62 < 2
+#>=Obs: old59 <= 2
+#>=Pkg: p60 2 1 x86_64
+#>=Prv: lib60 = 2
+#>=Req: lib61 >= 2
+#>=Req: lib67 > 1
+#>=Con: p63 < 2
+#>=Obs: old60 <= 2
+#>=Pkg: old60 1 1 x86_64
+#>=Req: lib60 = 1
+#>=Pkg: p61 2 1 x86_64
+#>=Prv: lib61 = 2
+#>=Req: lib62 >= 2
+#>=Req: lib68 > 1
+#>=Con: p64 < 2
+#>=Obs: old61 <= 2
+#>=Pkg: p62 2 1 x86_64
+#>=Prv: lib62 = 2
+#>=Req: lib63 >= 2
+#>=Req: lib69 > 1
+#>=Con: p65 < 2
+#>=Obs: old62 <= 2
+#>=Pkg: p63 2 1 x86_64
+#>=Prv: lib63 = 2
+#>=Req: lib64 >= 2
+#>=Req: lib70 > 1
+#>=Con: p66 < 2
+#>=Obs: old63 <= 2
+#>=Pkg: p64 2 1 x86_64
+#>=Prv: lib64 = 2
+#>=Req: lib65 >= 2
+#>=Req: lib71 > 1
+#>=Con: p67 < 2
+#>=Obs: old64 <= 2
+#>=Pkg: p65 2 1 x86_64
+#>=Prv: lib65 = 2
+#>=Req: lib66 >= 2
+#>=Req: lib72 > 1
+#>=Con: p68 < 2
+#>=Obs: old65 <= 2
+#>=Pkg: old65 1 1 x86_64
+#>=Req: lib65 = 1
+#>=Pkg: p66 2 1 x86_64
+#>=Prv: lib66 = 2
+#>=Req: lib67 >= 2
+#>=Req: lib73 > 1
+#>=Con: p69 < 2
+#>=Obs: old66 <= 2
+#>=Pkg: p67 2 1 x86_64
+#>=Prv: lib67 = 2
+#>=Req: lib68 >= 2
+#>=Req: lib74 > 1
+#>=Con: p70 < 2
+#>=Obs: old67 <= 2
+#>=Pkg: p68 2 1 x86_64
+#>=Prv: lib68 = 2
+#>=Req: lib69 >= 2
+#>=Req: lib75 > 1
+#>=Con: p71 < 2
+#>=Obs: old68 <= 2
+#>=Pkg: p69 2 1 x86_64
+#>=Prv: lib69 = 2
+#>=Req: lib70 >= 2
+#>=Req: lib76 > 1
+#>=Con: p72 < 2
+#>=Obs: old69 <= 2
+#>=Pkg: p70 2 1 x86_64
+#>=Prv: lib70 = 2
+#>=Req: lib71 >= 2
+#>=Req: lib77 > 1
+#>=Con: p73 < 2
+#>=Obs: old70 <= 2
+#>=Pkg: old70 1 1 x86_64
+#>=Req: lib70 = 1
+#>=Pkg: p71 2 1 x86_64
+#>=Prv: lib71 = 2
+#>=Req: lib72 >= 2
+#>=Req: lib78 > 1
+#>=Con: p74 < 2
+#>=Obs: old71 <= 2
+#>=Pkg: p72 2 1 x86_64
+#>=Prv: lib72 = 2
+#>=Req: lib73 >= 2
+#>=Req: lib79 > 1
+#>=Con: p75 < 2
+#>=Obs: old72 <= 2
+#>=Pkg: p73 2 1 x86_64
+#>=Prv: lib73 = 2
+#>=Req: lib74 >= 2
+#>=Req: lib80 > 1
+#>=Con: p76 < 2
+#>=Obs: old73 <= 2
+#>=Pkg: p74 2 1 x86_64
+#>=Prv: lib74 = 2
+#>=Req: lib75 >= 2
+#>=Req: lib81 > 1
+#>=Con: p77 < 2
+#>=Obs: old74 <= 2
+#>=Pkg: p75 2 1 x86_64
+#>=Prv: lib75 = 2
+#>=Req: lib76 >= 2
+#>=Req: lib82 > 1
+#>=Con: p78 < 2
+#>=Obs: old75 <= 2
+#>=Pkg: old75 1 1 x86_64
+#>=Req: lib75 = 1
+#>=Pkg: p76 2 1 x86_64
+#>=Prv: lib76 = 2
+#>=Req: lib77 >= 2
+#>=Req: lib83 > 1
+#>=Con: p79 < 2
+#>=Obs: old76 <= 2
+#>=Pkg: p77 2 1 x86_64
+#>=Prv: lib77 = 2
+#>=Req: lib78 >= 2
+#>=Req: lib84 > 1
+#>=Con: p80 < 2
+#>=Obs: old77 <= 2
+#>=Pkg: p78 2 1 x86_64
+#>=Prv: lib78 = 2
+#>=Req: lib79 >= 2
+#>=Req: lib85 > 1
+#>=Con: p81 < 2
+#>=Obs: old78 <= 2
+#>=Pkg: p79 2 1 x86_64
+#>=Prv: lib79 = 2
+#>=Req: lib80 >= 2
+#>=Req: lib86 > 1
+#>=Con: p82 < 2
+#>=Obs: old79 <= 2
+#>=Pkg: p80 2 1 x86_64
+#>=Prv: lib80 = 2
+#>=Req: lib81 >= 2
+#>=Req: lib87 > 1
+#>=Con: p83 < 2
+#>=Obs: old80 <= 2
+#>=Pkg: old80 1 1 x86_64
+#>=Req: lib80 = 1
+#>=Pkg: p81 2 1 x86_64
+#>=Prv: lib81 = 2
+#>=Req: lib82 >= 2
+#>=Req: lib88 > 1
+#>=Con: p84 < 2
+#>=Obs: old81 <= 2
+#>=Pkg: p82 2 1 x86_64
+#>=Prv: lib82 = 2
+#>=Req: lib83 >= 2
+#>=Req: lib89 > 1
+#>=Con: p85 < 2
+#>=Obs: old82 <= 2
+#>=Pkg: p83 2 1 x86_64
+#>=Prv: lib83 = 2
+#>=Req: lib84 >= 2
+#>=Req: lib90 > 1
+#>=Con: p86 < 2
+#>=Obs: old83 <= 2
+#>=Pkg: p84 2 1 x86_64
+#>=Prv: lib84 = 2
+#>=Req: lib85 >= 2
+#>=Req: lib91 > 1
+#>=Con: p87 < 2
+#>=Obs: old84 <= 2
+#>=Pkg: p85 2 1 x86_64
+#>=Prv: lib85 = 2
+#>=Req: lib86 >= 2
+#>=Req: lib92 > 1
+#>=Con: p88 < 2
+#>=Obs: old85 <= 2
+#>=Pkg: old85 1 1 x86_64
+#>=Req: lib85 = 1
+#>=Pkg: p86 2 1 x86_64
+#>=Prv: lib86 = 2
+#>=Req: lib87 >= 2
+#>=Req: lib93 > 1
+#>=Con: p89 < 2
+#>=Obs: old86 <= 2
+#>=Pkg: p87 2 1 x86_64
+#>=Prv: lib87 = 2
+#>=Req: lib88 >= 2
+#>=Req: lib94 > 1
+#>=Con: p90 < 2
+#>=Obs: old87 <= 2
+#>=Pkg: p88 2 1 x86_64
+#>=Prv: lib88 = 2
+#>=Req: lib89 >= 2
+#>=Req: lib95 > 1
+#>=Con: p91 < 2
+#>=Obs: old88 <= 2
+#>=Pkg: p89 2 1 x86_64
+#>=Prv: lib89 = 2
+#>=Req: lib90 >= 2
+#>=Req: lib96 > 1
+#>=Con: p92 < 2
+#>=Obs: old89 <= 2
+#>=Pkg: p90 2 1 x86_64
+#>=Prv: lib90 = 2
+#>=Req: lib91 >= 2
+#>=Req: lib97 > 1
+#>=Con: p93 < 2
+#>=Obs: old90 <= 2
+#>=Pkg: old90 1 1 x86_64
+#>=Req: lib90 = 1
+#>=Pkg: p91 2 1 x86_64
+#>=Prv: lib91 = 2
+#>=Req: lib92 >= 2
+#>=Req: lib98 > 1
+#>=Con: p94 < 2
+#>=Obs: old91 <= 2
+#>=Pkg: p92 2 1 x86_64
+#>=Prv: lib92 = 2
+#>=Req: lib93 >= 2
+#>=Req: lib99 > 1
+#>=Con: p95 < 2
+#>=Obs: old92 <= 2
+#>=Pkg: p93 2 1 x86_64
+#>=Prv: lib93 = 2
+#>=Req: lib94 >= 2
+#>=Req: lib100 > 1
+#>=Con: p96 < 2
+#>=Obs: old93 <= 2
+#>=Pkg: p94 2 1 x86_64
+#>=Prv: lib94 = 2
+#>=Req: lib95 >= 2
+#>=Req: lib101 > 1
+#>=Con: p97 < 2
+#>=Obs: old94 <= 2
+#>=Pkg: p95 2 1 x86_64
+#>=Prv: lib95 = 2
+#>=Req: lib96 >= 2
+#>=Req: lib102 > 1
+#>=Con: p98 < 2
+#>=Obs: old95 <= 2
+#>=Pkg: old95 1 1 x86_64
+#>=Req: lib95 = 1
+#>=Pkg: p96 2 1 x86_64
+#>=Prv: lib96 = 2
+#>=Req: lib97 >= 2
+#>=Req: lib103 > 1
+#>=Con: p99 < 2
+#>=Obs: old96 <= 2
+#>=Pkg: p97 2 1 x86_64
+#>=Prv: lib97 = 2
+#>=Req: lib98 >= 2
+#>=Req: lib104 > 1
+#>=Con: p100 < 2
+#>=Obs: old97 <= 2
+#>=Pkg: p98 2 1 x86_64
+#>=Prv: lib98 = 2
+#>=Req: lib99 >= 2
+#>=Req: lib105 > 1
+#>=Con: p101 < 2
+#>=Obs: old98 <= 2
+#>=Pkg: p99 2 1 x86_64
+#>=Prv: lib99 = 2
+#>=Req: lib100 >= 2
+#>=Req: lib106 > 1
+#>=Con: p102 < 2
+#>=Obs: old99 <= 2
+#>=Pkg: p100 2 1 x86_64
+#>=Prv: lib100 = 2
+#>=Req: lib101 >= 2
+#>=Req: lib107 > 1
+#>=Con: p103 < 2
+#>=Obs: old100 <= 2
+#>=Pkg: old100 1 1 x86_64
+#>=Req: lib100 = 1
+#>=Pkg: p101 2 1 x86_64
+#>=Prv: lib101 = 2
+#>=Req: lib102 >= 2
+#>=Req: lib108 > 1
+#>=Con: p104 < 2
+#>=Obs: old101 <= 2
+#>=Pkg: p102 2 1 x86_64
+#>=Prv: lib102 = 2
+#>=Req: lib103 >= 2
+#>=Req: lib109 > 1
+#>=Con: p105 < 2
+#>=Obs: old102 <= 2
+#>=Pkg: p103 2 1 x86_64
+#>=Prv: lib103 = 2
+#>=Req: lib104 >= 2
+#>=Req: lib110 > 1
+#>=Con: p106 < 2
+#>=Obs: old103 <= 2
+#>=Pkg: p104 2 1 x86_64
+#>=Prv: lib104 = 2
+#>=Req: lib105 >= 2
+#>=Req: lib111 > 1
+#>=Con: p107 < 2
+#>=Obs: old104 <= 2
+#>=Pkg: p105 2 1 x86_64
+#>=Prv: lib105 = 2
+#>=Req: lib106 >= 2
+#>=Req: lib112 > 1
+#>=Con: p108 < 2
+#>=Obs: old105 <= 2
+#>=Pkg: old105 1 1 x86_64
+#>=Req: lib105 = 1
+#>=Pkg: p106 2 1 x86_64
+#>=Prv: lib106 = 2
+#>=Req: lib107 >= 2
+#>=Req: lib113 > 1
+#>=Con: p109 < 2
+#>=Obs: old106 <= 2
+#>=Pkg: p107 2 1 x86_64
+#>=Prv: lib107 = 2
+#>=Req: lib108 >= 2
+#>=Req: lib114 > 1
+#>=Con: p110 < 2
+#>=Obs: old107 <= 2
+#>=Pkg: p108 2 1 x86_64
+#>=Prv: lib108 = 2
+#>=Req: lib109 >= 2
+#>=Req: lib115 > 1
+#>=Con: p111 < 2
+#>=Obs: old108 <= 2
+#>=Pkg: p109 2 1 x86_64
+#>=Prv: lib109 = 2
+#>=Req: lib110 >= 2
+#>=Req: lib116 > 1
+#>=Con: p112 < 2
+#>=Obs: old109 <= 2
+#>=Pkg: p110 2 1 x86_64
+#>=Prv: lib110 = 2
+#>=Req: lib111 >= 2
+#>=Req: lib117 > 1
+#>=Con: p113 < 2
+#>=Obs: old110 <= 2
+#>=Pkg: old110 1 1 x86_64
+#>=Req: lib110 = 1
+#>=Pkg: p111 2 1 x86_64
+#>=Prv: lib111 = 2
+#>=Req: lib112 >= 2
+#>=Req: lib118 > 1
+#>=Con: p114 < 2
+#>=Obs: old111 <= 2
+#>=Pkg: p112 2 1 x86_64
+#>=Prv: lib112 = 2
+#>=Req: lib113 >= 2
+#>=Req: lib119 > 1
+#>=Con: p115 < 2
+#>=Obs: old112 <= 2
+#>=Pkg: p113 2 1 x86_64
+#>=Prv: lib113 = 2
+#>=Req: lib114 >= 2
+#>=Req: lib120 > 1
+#>=Con: p116 < 2
+#>=Obs: old113 <= 2
+#>=Pkg: p114 2 1 x86_64
+#>=Prv: lib114 = 2
+#>=Req: lib115 >= 2
+#>=Req: lib121 > 1
+#>=Con: p117 < 2
+#>=Obs: old114 <= 2
+#>=Pkg: p115 2 1 x86_64
+#>=Prv: lib115 = 2
+#>=Req: lib116 >= 2
+#>=Req: lib122 > 1
+#>=Con: p118 < 2
+#>=Obs: old115 <= 2
+#>=Pkg: old115 1 1 x86_64
+#>=Req: lib115 = 1
+#>=Pkg: p116 2 1 x86_64
+#>=Prv: lib116 = 2
+#>=Req: lib117 >= 2
+#>=Req: lib123 > 1
+#>=Con: p119 < 2
+#>=Obs: old116 <= 2
+#>=Pkg: p117 2 1 x86_64
+#>=Prv: lib117 = 2
+#>=Req: lib118 >= 2
+#>=Req: lib124 > 1
+#>=Con: p120 < 2
+#>=Obs: old117 <= 2
+#>=Pkg: p118 2 1 x86_64
+#>=Prv: lib118 = 2
+#>=Req: lib119 >= 2
+#>=Req: lib125 > 1
+#>=Con: p121 < 2
+#>=Obs: old118 <= 2
+#>=Pkg: p119 2 1 x86_64
+#>=Prv: lib119 = 2
+#>=Req: lib120 >= 2
+#>=Req: lib126 > 1
+#>=Con: p122 < 2
+#>=Obs: old119 <= 2
+#>=Pkg: p120 2 1 x86_64
+#>=Prv: lib120 = 2
+#>=Req: lib121 >= 2
+#>=Req: lib127 > 1
+#>=Con: p123 < 2
+#>=Obs: old120 <= 2
+#>=Pkg: old120 1 1 x86_64
+#>=Req: lib120 = 1
+#>=Pkg: p121 2 1 x86_64
+#>=Prv: lib121 = 2
+#>=Req: lib122 >= 2
+#>=Req: lib128 > 1
+#>=Con: p124 < 2
+#>=Obs: old121 <= 2
+#>=Pkg: p122 2 1 x86_64
+#>=Prv: lib122 = 2
+#>=Req: lib123 >= 2
+#>=Req: lib129 > 1
+#>=Con: p125 < 2
+#>=Obs: old122 <= 2
+#>=Pkg: p123 2 1 x86_64
+#>=Prv: lib123 = 2
+#>=Req: lib124 >= 2
+#>=Req: lib130 > 1
+#>=Con: p126 < 2
+#>=Obs: old123 <= 2
+#>=Pkg: p124 2 1 x86_64
+#>=Prv: lib124 = 2
+#>=Req: lib125 >= 2
+#>=Req: lib131 > 1
+#>=Con: p127 < 2
+#>=Obs: old124 <= 2
+#>=Pkg: p125 2 1 x86_64
+#>=Prv: lib125 = 2
+#>=Req: lib126 >= 2
+#>=Req: lib132 > 1
+#>=Con: p128 < 2
+#>=Obs: old125 <= 2
+#>=Pkg: old125 1 1 x86_64
+#>=Req: lib125 = 1
+#>=Pkg: p126 2 1 x86_64
+#>=Prv: lib126 = 2
+#>=Req: lib127 >= 2
+#>=Req: lib133 > 1
+#>=Con: p129 < 2
+#>=Obs: old126 <= 2
+#>=Pkg: p127 2 1 x86_64
+#>=Prv: lib127 = 2
+#>=Req: lib128 >= 2
+#>=Req: lib134 > 1
+#>=Con: p130 < 2
+#>=Obs: old127 <= 2
+#>=Pkg: p128 2 1 x86_64
+#>=Prv: lib128 = 2
+#>=Req: lib129 >= 2
+#>=Req: lib135 > 1
+#>=Con: p131 < 2
+#>=Obs: old128 <= 2
+#>=Pkg: p129 2 1 x86_64
+#>=Prv: lib129 = 2
+#>=Req: lib130 >= 2
+#>=Req: lib136 > 1
+#>=Con: p132 < 2
+#>=Obs: old129 <= 2
+#>=Pkg: p130 2 1 x86_64
+#>=Prv: lib130 = 2
+#>=Req: lib131 >= 2
+#>=Req: lib137 > 1
+#>=Con: p133 < 2
+#>=Obs: old130 <= 2
+#>=Pkg: old130 1 1 x86_64
+#>=Req: lib130 = 1
+#>=Pkg: p131 2 1 x86_64
+#>=Prv: lib131 = 2
+#>=Req: lib132 >= 2
+#>=Req: lib138 > 1
+#>=Con: p134 < 2
+#>=Obs: old131 <= 2
+#>=Pkg: p132 2 1 x86_64
+#>=Prv: lib132 = 2
+#>=Req: lib133 >= 2
+#>=Req: lib139 > 1
+#>=Con: p135 < 2
+#>=Obs: old132 <= 2
+#>=Pkg: p133 2 1 x86_64
+#>=Prv: lib133 = 2
+#>=Req: lib134 >= 2
+#>=Req: lib140 > 1
+#>=Con: p136 < 2
+#>=Obs: old133 <= 2
+#>=Pkg: p134 2 1 x86_64
+#>=Prv: lib134 = 2
+#>=Req: lib135 >= 2
+#>=Req: lib141 > 1
+#>=Con: p137 < 2
+#>=Obs: old134 <= 2
+#>=Pkg: p135 2 1 x86_64
+#>=Prv: lib135 = 2
+#>=Req: lib136 >= 2
+#>=Req: lib142 > 1
+#>=Con: p138 < 2
+#>=Obs: old135 <= 2
+#>=Pkg: old135 1 1 x86_64
+#>=Req: lib135 = 1
+#>=Pkg: p136 2 1 x86_64
+#>=Prv: lib136 = 2
+#>=Req: lib137 >= 2
+#>=Req: lib143 > 1
+#>=Con: p139 < 2
+#>=Obs: old136 <= 2
+#>=Pkg: p137 2 1 x86_64
+#>=Prv: lib137 = 2
+#>=Req: lib138 >= 2
+#>=Req: lib144 > 1
+#>=Con: p140 < 2
+#>=Obs: old137 <= 2
+#>=Pkg: p138 2 1 x86_64
+#>=Prv: lib138 = 2
+#>=Req: lib139 >= 2
+#>=Req: lib145 > 1
+#>=Con: p141 < 2
+#>=Obs: old138 <= 2
+#>=Pkg: p139 2 1 x86_64
+#>=Prv: lib139 = 2
+#>=Req: lib140 >= 2
+#>=Req: lib146 > 1
+#>=Con: p142 < 2
+#>=Obs: old139 <= 2
+#>=Pkg: p140 2 1 x86_64
+#>=Prv: lib140 = 2
+#>=Req: lib141 >= 2
+#>=Req: lib147 > 1
+#>=Con: p143 < 2
+#>=Obs: old140 <= 2
+#>=Pkg: old140 1 1 x86_64
+#>=Req: lib140 = 1
+#>=Pkg: p141 2 1 x86_64
+#>=Prv: lib141 = 2
+#>=Req: lib142 >= 2
+#>=Req: lib148 > 1
+#>=Con: p144 < 2
+#>=Obs: old141 <= 2
+#>=Pkg: p142 2 1 x86_64
+#>=Prv: lib142 = 2
+#>=Req: lib143 >= 2
+#>=Req: lib149 > 1
+#>=Con: p145 < 2
+#>=Obs: old142 <= 2
+#>=Pkg: p143 2 1 x86_64
+#>=Prv: lib143 = 2
+#>=Req: lib144 >= 2
+#>=Req: lib0 > 1
+#>=Con: p146 < 2
+#>=Obs: old143 <= 2
+#>=Pkg: p144 2 1 x86_64
+#>=Prv: lib144 = 2
+#>=Req: lib145 >= 2
+#>=Req: lib1 > 1
+#>=Con: p147 < 2
+#>=Obs: old144 <= 2
+#>=Pkg: p145 2 1 x86_64
+#>=Prv: lib145 = 2
+#>=Req: lib146 >= 2
+#>=Req: lib2 > 1
+#>=Con: p148 < 2
+#>=Obs: old145 <= 2
+#>=Pkg: old145 1 1 x86_64
+#>=Req: lib145 = 1
+#>=Pkg: p146 2 1 x86_64
+#>=Prv: lib146 = 2
+#>=Req: lib147 >= 2
+#>=Req: lib3 > 1
+#>=Con: p149 < 2
+#>=Obs: old146 <= 2
+#>=Pkg: p147 2 1 x86_64
+#>=Prv: lib147 = 2
+#>=Req: lib148 >= 2
+#>=Req: lib4 > 1
+#>=Con: p0 < 2
+#>=Obs: old147 <= 2
+#>=Pkg: p148 2 1 x86_64
+#>=Prv: lib148 = 2
+#>=Req: lib149 >= 2
+#>=Req: lib5 > 1
+#>=Con: p1 < 2
+#>=Obs: old148 <= 2
+#>=Pkg: p149 2 1 x86_64
+#>=Prv: lib149 = 2
+#>=Req: lib0 >= 2
+#>=Req: lib6 > 1
+#>=Con: p2 < 2
+#>=Obs: old149 <= 2
+system x86_64 rpm system
+job update all packages
+result transaction,problems,rules,whatprovides parallelpkgrules-large.res
+nextjob
+solverflags parallelpkgrules=4
+job update all packages
+result transaction,problems,rules,whatprovides parallelpkgrules-large.res
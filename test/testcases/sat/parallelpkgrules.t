@@ -0,0 +1,28 @@
+repo system 0 testtags <inline>
+#>=Pkg: A 1 1 x86_64
+#>=Req: B >= 1
+#>=Pkg: B 1 1 x86_64
+#>=Pkg: D 1 1 x86_64
+repo available 0 testtags <inline>
+#>=Pkg: A 2 1 x86_64
+#>=Req: B >= 2
+#>=Pkg: B 2 1 x86_64
+#>=Con: D < 2
+#>=Pkg: D 2 1 x86_64
+#>=Pkg: E 1 1 x86_64
+#>=Req: F = 1
+#>=Rec: G
+#>=Pkg: F 1 1 x86_64
+#>=Obs: D
+#>=Pkg: G 1 1 x86_64
+#>=Con: E
+system x86_64 rpm system
+solverflags parallelpkgrules strongrecommends
+job update all packages
+job install name E
+result transaction,problems <inline>
+#>erase D-1-1.x86_64@system F-1-1.x86_64@available
+#>install E-1-1.x86_64@available
+#>install F-1-1.x86_64@available
+#>upgrade A-1-1.x86_64@system A-2-1.x86_64@available
+#>upgrade B-1-1.x86_64@system B-2-1.x86_64@available
@@ -0,0 +1,264 @@
+#
+# pigeon hole problem: 8 packages want to use 7 conflicting slots.
+# Proving this needs more than REDUCE_FIRST conflicts, so the learnt
+# rules get reduced in restart mode. The weak job gets dropped.
+#
+repo system 0 testtags <inline>
+#>=Pkg: base 1 1 noarch
+repo available 0 testtags <inline>
+#>=Pkg: extra 1 1 noarch
+#>=Pkg: top 1 1 noarch
+#>=Req: p0
+#>=Req: p1
+#>=Req: p2
+#>=Req: p3
+#>=Req: p4
+#>=Req: p5
+#>=Req: p6
+#>=Req: p7
+#>=Pkg: p0 1 1 noarch
+#>=Req: hole0
+#>=Pkg: h0_0 1 1 noarch
+#>=Prv: hole0
+#>=Prv: slot0
+#>=Con: slot0
+#>=Pkg: h0_1 1 1 noarch
+#>=Prv: hole0
+#>=Prv: slot1
+#>=Con: slot1
+#>=Pkg: h0_2 1 1 noarch
+#>=Prv: hole0
+#>=Prv: slot2
+#>=Con: slot2
+#>=Pkg: h0_3 1 1 noarch
+#>=Prv: hole0
+#>=Prv: slot3
+#>=Con: slot3
+#>=Pkg: h0_4 1 1 noarch
+#>=Prv: hole0
+#>=Prv: slot4
+#>=Con: slot4
+#>=Pkg: h0_5 1 1 noarch
+#>=Prv: hole0
+#>=Prv: slot5
+#>=Con: slot5
+#>=Pkg: h0_6 1 1 noarch
+#>=Prv: hole0
+#>=Prv: slot6
+#>=Con: slot6
+#>=Pkg: p1 1 1 noarch
+#>=Req: hole1
+#>=Pkg: h1_0 1 1 noarch
+#>=Prv: hole1
+#>=Prv: slot0
+#>=Con: slot0
+#>=Pkg: h1_1 1 1 noarch
+#>=Prv: hole1
+#>=Prv: slot1
+#>=Con: slot1
+#>=Pkg: h1_2 1 1 noarch
+#>=Prv: hole1
+#>=Prv: slot2
+#>=Con: slot2
+#>=Pkg: h1_3 1 1 noarch
+#>=Prv: hole1
+#>=Prv: slot3
+#>=Con: slot3
+#>=Pkg: h1_4 1 1 noarch
+#>=Prv: hole1
+#>=Prv: slot4
+#>=Con: slot4
+#>=Pkg: h1_5 1 1 noarch
+#>=Prv: hole1
+#>=Prv: slot5
+#>=Con: slot5
+#>=Pkg: h1_6 1 1 noarch
+#>=Prv: hole1
+#>=Prv: slot6
+#>=Con: slot6
+#>=Pkg: p2 1 1 noarch
+#>=Req: hole2
+#>=Pkg: h2_0 1 1 noarch
+#>=Prv: hole2
+#>=Prv: slot0
+#>=Con: slot0
+#>=Pkg: h2_1 1 1 noarch
+#>=Prv: hole2
+#>=Prv: slot1
+#>=Con: slot1
+#>=Pkg: h2_2 1 1 noarch
+#>=Prv: hole2
+#>=Prv: slot2
+#>=Con: slot2
+#>=Pkg: h2_3 1 1 noarch
+#>=Prv: hole2
+#>=Prv: slot3
+#>=Con: slot3
+#>=Pkg: h2_4 1 1 noarch
+#>=Prv: hole2
+#>=Prv: slot4
+#>=Con: slot4
+#>=Pkg: h2_5 1 1 noarch
+#>=Prv: hole2
+#>=Prv: slot5
+#>=Con: slot5
+#>=Pkg: h2_6 1 1 noarch
+#>=Prv: hole2
+#>=Prv: slot6
+#>=Con: slot6
+#>=Pkg: p3 1 1 noarch
+#>=Req: hole3
+#>=Pkg: h3_0 1 1 noarch
+#>=Prv: hole3
+#>=Prv: slot0
+#>=Con: slot0
+#>=Pkg: h3_1 1 1 noarch
+#>=Prv: hole3
+#>=Prv: slot1
+#>=Con: slot1
+#>=Pkg: h3_2 1 1 noarch
+#>=Prv: hole3
+#>=Prv: slot2
+#>=Con: slot2
+#>=Pkg: h3_3 1 1 noarch
+#>=Prv: hole3
+#>=Prv: slot3
+#>=Con: slot3
+#>=Pkg: h3_4 1 1 noarch
+#>=Prv: hole3
+#>=Prv: slot4
+#>=Con: slot4
+#>=Pkg: h3_5 1 1 noarch
+#>=Prv: hole3
+#>=Prv: slot5
+#>=Con: slot5
+#>=Pkg: h3_6 1 1 noarch
+#>=Prv: hole3
+#>=Prv: slot6
+#>=Con: slot6
+#>=Pkg: p4 1 1 noarch
+#>=Req: hole4
+#>=Pkg: h4_0 1 1 noarch
+#>=Prv: hole4
+#>=Prv: slot0
+#>=Con: slot0
+#>=Pkg: h4_1 1 1 noarch
+#>=Prv: hole4
+#>=Prv: slot1
+#>=Con: slot1
+#>=Pkg: h4_2 1 1 noarch
+#>=Prv: hole4
+#>=Prv: slot2
+#>=Con: slot2
+#>=Pkg: h4_3 1 1 noarch
+#>=Prv: hole4
+#>=Prv: slot3
+#>=Con: slot3
+#>=Pkg: h4_4 1 1 noarch
+#>=Prv: hole4
+#>=Prv: slot4
+#>=Con: slot4
+#>=Pkg: h4_5 1 1 noarch
+#>=Prv: hole4
+#>=Prv: slot5
+#>=Con: slot5
+#>=Pkg: h4_6 1 1 noarch
+#>=Prv: hole4
+#>=Prv: slot6
+#>=Con: slot6
+#>=Pkg: p5 1 1 noarch
+#>=Req: hole5
+#>=Pkg: h5_0 1 1 noarch
+#>=Prv: hole5
+#>=Prv: slot0
+#>=Con: slot0
+#>=Pkg: h5_1 1 1 noarch
+#>=Prv: hole5
+#>=Prv: slot1
+#>=Con: slot1
+#>=Pkg: h5_2 1 1 noarch
+#>=Prv: hole5
+#>=Prv: slot2
+#>=Con: slot2
+#>=Pkg: h5_3 1 1 noarch
+#>=Prv: hole5
+#>=Prv: slot3
+#>=Con: slot3
+#>=Pkg: h5_4 1 1 noarch
+#>=Prv: hole5
+#>=Prv: slot4
+#>=Con: slot4
+#>=Pkg: h5_5 1 1 noarch
+#>=Prv: hole5
+#>=Prv: slot5
+#>=Con: slot5
+#>=Pkg: h5_6 1 1 noarch
+#>=Prv: hole5
+#>=Prv: slot6
+#>=Con: slot6
+#>=Pkg: p6 1 1 noarch
+#>=Req: hole6
+#>=Pkg: h6_0 1 1 noarch
+#>=Prv: hole6
+#>=Prv: slot0
+#>=Con: slot0
+#>=Pkg: h6_1 1 1 noarch
+#>=Prv: hole6
+#>=Prv: slot1
+#>=Con: slot1
+#>=Pkg: h6_2 1 1 noarch
+#>=Prv: hole6
+#>=Prv: slot2
+#>=Con: slot2
+#>=Pkg: h6_3 1 1 noarch
+#>=Prv: hole6
+#>=Prv: slot3
+#>=Con: slot3
+#>=Pkg: h6_4 1 1 noarch
+#>=Prv: hole6
+#>=Prv: slot4
+#>=Con: slot4
+#>=Pkg: h6_5 1 1 noarch
+#>=Prv: hole6
+#>=Prv: slot5
+#>=Con: slot5
+#>=Pkg: h6_6 1 1 noarch
+#>=Prv: hole6
+#>=Prv: slot6
+#>=Con: slot6
+#>=Pkg: p7 1 1 noarch
+#>=Req: hole7
+#>=Pkg: h7_0 1 1 noarch
+#>=Prv: hole7
+#>=Prv: slot0
+#>=Con: slot0
+#>=Pkg: h7_1 1 1 noarch
+#>=Prv: hole7
+#>=Prv: slot1
+#>=Con: slot1
+#>=Pkg: h7_2 1 1 noarch
+#>=Prv: hole7
+#>=Prv: slot2
+#>=Con: slot2
+#>=Pkg: h7_3 1 1 noarch
+#>=Prv: hole7
+#>=Prv: slot3
+#>=Con: slot3
+#>=Pkg: h7_4 1 1 noarch
+#>=Prv: hole7
+#>=Prv: slot4
+#>=Con: slot4
+#>=Pkg: h7_5 1 1 noarch
+#>=Prv: hole7
+#>=Prv: slot5
+#>=Con: slot5
+#>=Pkg: h7_6 1 1 noarch
+#>=Prv: hole7
+#>=Prv: slot6
+#>=Con: slot6
+system i686 rpm system
+solverflags restarts
+job install name top [weak]
+job install name extra
+result transaction,problems <inline>
+#>install extra-1-1.noarch@available
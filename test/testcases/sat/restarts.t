@@ -0,0 +1,207 @@
+#
+# pigeon hole problem: 7 packages want to use 6 conflicting slots.
+# Needs enough conflicts to trigger restarts in restart mode
+#
+repo system 0 testtags <inline>
+#>=Pkg: base 1 1 noarch
+repo available 0 testtags <inline>
+#>=Pkg: p0 1 1 noarch
+#>=Req: hole0
+#>=Pkg: h0_0 1 1 noarch
+#>=Prv: hole0
+#>=Prv: slot0
+#>=Con: slot0
+#>=Pkg: h0_1 1 1 noarch
+#>=Prv: hole0
+#>=Prv: slot1
+#>=Con: slot1
+#>=Pkg: h0_2 1 1 noarch
+#>=Prv: hole0
+#>=Prv: slot2
+#>=Con: slot2
+#>=Pkg: h0_3 1 1 noarch
+#>=Prv: hole0
+#>=Prv: slot3
+#>=Con: slot3
+#>=Pkg: h0_4 1 1 noarch
+#>=Prv: hole0
+#>=Prv: slot4
+#>=Con: slot4
+#>=Pkg: h0_5 1 1 noarch
+#>=Prv: hole0
+#>=Prv: slot5
+#>=Con: slot5
+#>=Pkg: p1 1 1 noarch
+#>=Req: hole1
+#>=Pkg: h1_0 1 1 noarch
+#>=Prv: hole1
+#>=Prv: slot0
+#>=Con: slot0
+#>=Pkg: h1_1 1 1 noarch
+#>=Prv: hole1
+#>=Prv: slot1
+#>=Con: slot1
+#>=Pkg: h1_2 1 1 noarch
+#>=Prv: hole1
+#>=Prv: slot2
+#>=Con: slot2
+#>=Pkg: h1_3 1 1 noarch
+#>=Prv: hole1
+#>=Prv: slot3
+#>=Con: slot3
+#>=Pkg: h1_4 1 1 noarch
+#>=Prv: hole1
+#>=Prv: slot4
+#>=Con: slot4
+#>=Pkg: h1_5 1 1 noarch
+#>=Prv: hole1
+#>=Prv: slot5
+#>=Con: slot5
+#>=Pkg: p2 1 1 noarch
+#>=Req: hole2
+#>=Pkg: h2_0 1 1 noarch
+#>=Prv: hole2
+#>=Prv: slot0
+#>=Con: slot0
+#>=Pkg: h2_1 1 1 noarch
+#>=Prv: hole2
+#>=Prv: slot1
+#>=Con: slot1
+#>=Pkg: h2_2 1 1 noarch
+#>=Prv: hole2
+#>=Prv: slot2
+#>=Con: slot2
+#>=Pkg: h2_3 1 1 noarch
+#>=Prv: hole2
+#>=Prv: slot3
+#>=Con: slot3
+#>=Pkg: h2_4 1 1 noarch
+#>=Prv: hole2
+#>=Prv: slot4
+#>=Con: slot4
+#>=Pkg: h2_5 1 1 noarch
+#>=Prv: hole2
+#>=Prv: slot5
+#>=Con: slot5
+#>=Pkg: p3 1 1 noarch
+#>=Req: hole3
+#>=Pkg: h3_0 1 1 noarch
+#>=Prv: hole3
+#>=Prv: slot0
+#>=Con: slot0
+#>=Pkg: h3_1 1 1 noarch
+#>=Prv: hole3
+#>=Prv: slot1
+#>=Con: slot1
+#>=Pkg: h3_2 1 1 noarch
+#>=Prv: hole3
+#>=Prv: slot2
+#>=Con: slot2
+#>=Pkg: h3_3 1 1 noarch
+#>=Prv: hole3
+#>=Prv: slot3
+#>=Con: slot3
+#>=Pkg: h3_4 1 1 noarch
+#>=Prv: hole3
+#>=Prv: slot4
+#>=Con: slot4
+#>=Pkg: h3_5 1 1 noarch
+#>=Prv: hole3
+#>=Prv: slot5
+#>=Con: slot5
+#>=Pkg: p4 1 1 noarch
+#>=Req: hole4
+#>=Pkg: h4_0 1 1 noarch
+#>=Prv: hole4
+#>=Prv: slot0
+#>=Con: slot0
+#>=Pkg: h4_1 1 1 noarch
+#>=Prv: hole4
+#>=Prv: slot1
+#>=Con: slot1
+#>=Pkg: h4_2 1 1 noarch
+#>=Prv: hole4
+#>=Prv: slot2
+#>=Con: slot2
+#>=Pkg: h4_3 1 1 noarch
+#>=Prv: hole4
+#>=Prv: slot3
+#>=Con: slot3
+#>=Pkg: h4_4 1 1 noarch
+#>=Prv: hole4
+#>=Prv: slot4
+#>=Con: slot4
+#>=Pkg: h4_5 1 1 noarch
+#>=Prv: hole4
+#>=Prv: slot5
+#>=Con: slot5
+#>=Pkg: p5 1 1 noarch
+#>=Req: hole5
+#>=Pkg: h5_0 1 1 noarch
+#>=Prv: hole5
+#>=Prv: slot0
+#>=Con: slot0
+#>=Pkg: h5_1 1 1 noarch
+#>=Prv: hole5
+#>=Prv: slot1
+#>=Con: slot1
+#>=Pkg: h5_2 1 1 noarch
+#>=Prv: hole5
+#>=Prv: slot2
+#>=Con: slot2
+#>=Pkg: h5_3 1 1 noarch
+#>=Prv: hole5
+#>=Prv: slot3
+#>=Con: slot3
+#>=Pkg: h5_4 1 1 noarch
+#>=Prv: hole5
+#>=Prv: slot4
+#>=Con: slot4
+#>=Pkg: h5_5 1 1 noarch
+#>=Prv: hole5
+#>=Prv: slot5
+#>=Con: slot5
+#>=Pkg: p6 1 1 noarch
+#>=Req: hole6
+#>=Pkg: h6_0 1 1 noarch
+#>=Prv: hole6
+#>=Prv: slot0
+#>=Con: slot0
+#>=Pkg: h6_1 1 1 noarch
+#>=Prv: hole6
+#>=Prv: slot1
+#>=Con: slot1
+#>=Pkg: h6_2 1 1 noarch
+#>=Prv: hole6
+#>=Prv: slot2
+#>=Con: slot2
+#>=Pkg: h6_3 1 1 noarch
+#>=Prv: hole6
+#>=Prv: slot3
+#>=Con: slot3
+#>=Pkg: h6_4 1 1 noarch
+#>=Prv: hole6
+#>=Prv: slot4
+#>=Con: slot4
+#>=Pkg: h6_5 1 1 noarch
+#>=Prv: hole6
+#>=Prv: slot5
+#>=Con: slot5
+system i686 rpm system
+solverflags restarts
+job install name p0
+job install name p1
+job install name p2
+job install name p3
+job install name p4
+job install name p5
+job install name p6
+result transaction,problems <inline>
+#>problem f23c455e info package p4-1-1.noarch requires hole4, but none of the providers can be installed
+#>problem f23c455e solution 09620421 deljob install name p4
+#>problem f23c455e solution 12a0f8a1 deljob install name p5
+#>problem f23c455e solution 352d212e deljob install name p0
+#>problem f23c455e solution 4ff164ee deljob install name p3
+#>problem f23c455e solution 8de6cf91 deljob install name p6
+#>problem f23c455e solution a4150572 deljob install name p1
+#>problem f23c455e solution a9dc6108 deljob install name p2
@@ -0,0 +1,51 @@
+attr a-1-1.noarch@r1 solvable:arch noarch
+attr a-1-1.noarch@r1 solvable:evr 1-1
+attr a-1-1.noarch@r1 solvable:name a
+attr a-1-1.noarch@r1 solvable:provides a = 1-1
+attr a-1-1.noarch@r1 solvable:provides common
+attr a-1-1.noarch@r1 solvable:requires libfoo
+attr a-1-1.noarch@r1 solvable:summary package a
+attr b-1-1.noarch@r1 solvable:arch noarch
+attr b-1-1.noarch@r1 solvable:evr 1-1
+attr b-1-1.noarch@r1 solvable:name b
+attr b-1-1.noarch@r1 solvable:provides b = 1-1
+attr b-1-1.noarch@r1 solvable:provides libfoo
+attr b-1-1.noarch@r1 solvable:summary package b
+attr c-1-1.noarch@r2 solvable:arch noarch
+attr c-1-1.noarch@r2 solvable:evr 1-1
+attr c-1-1.noarch@r2 solvable:name c
+attr c-1-1.noarch@r2 solvable:provides c = 1-1
+attr c-1-1.noarch@r2 solvable:provides common
+attr c-1-1.noarch@r2 solvable:requires libbar >= 2
+attr c-1-1.noarch@r2 solvable:summary package c
+attr d-2-1.noarch@r2 solvable:arch noarch
+attr d-2-1.noarch@r2 solvable:evr 2-1
+attr d-2-1.noarch@r2 solvable:name d
+attr d-2-1.noarch@r2 solvable:provides d = 2-1
+attr d-2-1.noarch@r2 solvable:provides libbar = 2
+attr d-2-1.noarch@r2 solvable:summary package d
+attr e-1-1.noarch@r3 solvable:arch noarch
+attr e-1-1.noarch@r3 solvable:evr 1-1
+attr e-1-1.noarch@r3 solvable:name e
+attr e-1-1.noarch@r3 solvable:provides e = 1-1
+attr e-1-1.noarch@r3 solvable:requires libbar
+attr e-1-1.noarch@r3 solvable:requires libfoo
+attr e-1-1.noarch@r3 solvable:summary package e
+attr f-1-1.noarch@r3 solvable:arch noarch
+attr f-1-1.noarch@r3 solvable:evr 1-1
+attr f-1-1.noarch@r3 solvable:name f
+attr f-1-1.noarch@r3 solvable:provides f = 1-1
+attr f-1-1.noarch@r3 solvable:summary unique string of f
+attr single-1-1.noarch@r4 solvable:arch noarch
+attr single-1-1.noarch@r4 solvable:evr 1-1
+attr single-1-1.noarch@r4 solvable:filelist /usr/share/single/4aL?J=u<Z*Yn5$j-xPZ3סc8j$X۱0<k
+attr single-1-1.noarch@r4 solvable:filelist /usr/share/single/7pm~$BC|'hW?[<4u{+A}DT,.:<~[F,C4ǩa
+attr single-1-1.noarch@r4 solvable:filelist /usr/share/single/=ν]17q1;pT<vdO~@HBlfvLq*eBbo;uI2Ƹ
+attr single-1-1.noarch@r4 solvable:filelist /usr/share/single/sA<gڽ%6*~M2d`6By""1k4)Z>;.}II@
+attr single-1-1.noarch@r4 solvable:filelist /usr/share/single/,O>ɩMN.35<s*PC%)vm2pK৥I}>"rt
+attr single-1-1.noarch@r4 solvable:filelist /usr/share/single/WB64C@&X7NtVz3o_XV<Ce8_pEֵC3S1nܳ
+attr single-1-1.noarch@r4 solvable:filelist /usr/share/single/ZR=shХ,N=u.x;(np}_گNt,e$ǵi5Dyhv
+attr single-1-1.noarch@r4 solvable:filelist /usr/share/single/4fGy?=8<`ʲP:"áRw3=TgX4bdQd_kH
+attr single-1-1.noarch@r4 solvable:filelist /usr/share/single/*7ggcNME;IwWs.mv>f+=uncm}O%(P'01˿lT
+attr single-1-1.noarch@r4 solvable:filelist /usr/share/single/z:hKYJ¡9},-LSgm}nwPnak٨Kra8!}y:[
+attr single-1-1.noarch@r4 solvable:name single
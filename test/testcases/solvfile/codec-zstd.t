@@ -0,0 +1,15 @@
+# reload a repo with zstd compressed vertical data pages
+feature zstd_pages
+repo system 0 empty
+repo available 0 testtags files.repo
+system i686 rpm system
+result attributes files.res
+nextjob
+reload available pagecodec=zstd
+result attributes files.res
+nextjob
+reload available pagecodec=zstd pagecodecdict
+result attributes files.res
+nextjob
+reload available pagecodec=zstd pagecodecdict mmap
+result attributes files.res
@@ -0,0 +1,14 @@
+# reload a repo with compressed vertical data pages
+repo system 0 empty
+repo available 0 testtags files.repo
+system i686 rpm system
+result attributes files.res
+nextjob
+reload available pagecodec=lz
+result attributes files.res
+nextjob
+reload available pagecodec=lz mmap
+result attributes files.res
+nextjob
+reload available pagethreads=4
+result attributes files.res
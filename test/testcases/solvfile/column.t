@@ -0,0 +1,34 @@
+# reload a repo with the buildtime stored as column. The attributes dump
+# checks that the num lookups find the same values as the dataiterator.
+# There is no installtime, so no column gets created for it.
+repo system 0 empty
+repo available 0 testtags <inline>
+#>=Pkg: a 1 1 noarch
+#>=Tim: 1500000000
+#>=Pkg: b 1 1 noarch
+#>=Pkg: c 1 1 noarch
+#>=Tim: 4000000000
+#>=Pkg: d 1 1 noarch
+#>=Tim: 1
+system i686 rpm system
+reload available column=solvable:buildtime column=solvable:installtime
+result attributes <inline>
+#>attr a-1-1.noarch@available solvable:arch noarch
+#>attr a-1-1.noarch@available solvable:buildtime 1500000000
+#>attr a-1-1.noarch@available solvable:evr 1-1
+#>attr a-1-1.noarch@available solvable:name a
+#>attr a-1-1.noarch@available solvable:provides a = 1-1
+#>attr b-1-1.noarch@available solvable:arch noarch
+#>attr b-1-1.noarch@available solvable:evr 1-1
+#>attr b-1-1.noarch@available solvable:name b
+#>attr b-1-1.noarch@available solvable:provides b = 1-1
+#>attr c-1-1.noarch@available solvable:arch noarch
+#>attr c-1-1.noarch@available solvable:buildtime 4000000000
+#>attr c-1-1.noarch@available solvable:evr 1-1
+#>attr c-1-1.noarch@available solvable:name c
+#>attr c-1-1.noarch@available solvable:provides c = 1-1
+#>attr d-1-1.noarch@available solvable:arch noarch
+#>attr d-1-1.noarch@available solvable:buildtime 1
+#>attr d-1-1.noarch@available solvable:evr 1-1
+#>attr d-1-1.noarch@available solvable:name d
+#>attr d-1-1.noarch@available solvable:provides d = 1-1
@@ -0,0 +1,69 @@
+# load repos with appended deltas in one batch, the private loads
+# of the batch must keep the holes left by the deltas
+repo system 0 empty
+repo available 0 testtags <inline>
+#>=Pkg: a 1 1 noarch
+#>=Sum: package a
+#>=Pkg: b 1 1 noarch
+#>=Sum: package b
+#>=Pkg: c 1 1 noarch
+#>=Sum: package c
+#>=Pkg: b 2 1 noarch
+#>=Sum: package b, new version
+#>=Pkg: d 1 1 noarch
+#>=Sum: package d
+repo other 0 testtags <inline>
+#>=Pkg: e 1 1 noarch
+#>=Sum: package e
+#>=Req: b
+#>=Pkg: f 1 1 noarch
+#>=Sum: package f
+#>=Pkg: f 2 1 noarch
+#>=Sum: package f, new version
+#>=Prv: d
+system i686 rpm system
+reload available,other delta=2 deltaremove=b-1-1.noarch@available batch=2
+result attributes <inline>
+#>attr a-1-1.noarch@available solvable:arch noarch
+#>attr a-1-1.noarch@available solvable:evr 1-1
+#>attr a-1-1.noarch@available solvable:name a
+#>attr a-1-1.noarch@available solvable:provides a = 1-1
+#>attr a-1-1.noarch@available solvable:summary package a
+#>attr b-2-1.noarch@available solvable:arch noarch
+#>attr b-2-1.noarch@available solvable:evr 2-1
+#>attr b-2-1.noarch@available solvable:name b
+#>attr b-2-1.noarch@available solvable:provides b = 2-1
+#>attr b-2-1.noarch@available solvable:summary package b, new version
+#>attr c-1-1.noarch@available solvable:arch noarch
+#>attr c-1-1.noarch@available solvable:evr 1-1
+#>attr c-1-1.noarch@available solvable:name c
+#>attr c-1-1.noarch@available solvable:provides c = 1-1
+#>attr c-1-1.noarch@available solvable:summary package c
+#>attr d-1-1.noarch@available solvable:arch noarch
+#>attr d-1-1.noarch@available solvable:evr 1-1
+#>attr d-1-1.noarch@available solvable:name d
+#>attr d-1-1.noarch@available solvable:provides d = 1-1
+#>attr d-1-1.noarch@available solvable:summary package d
+#>attr e-1-1.noarch@other solvable:arch noarch
+#>attr e-1-1.noarch@other solvable:evr 1-1
+#>attr e-1-1.noarch@other solvable:name e
+#>attr e-1-1.noarch@other solvable:provides e = 1-1
+#>attr e-1-1.noarch@other solvable:requires b
+#>attr e-1-1.noarch@other solvable:summary package e
+#>attr f-1-1.noarch@other solvable:arch noarch
+#>attr f-1-1.noarch@other solvable:evr 1-1
+#>attr f-1-1.noarch@other solvable:name f
+#>attr f-1-1.noarch@other solvable:provides f = 1-1
+#>attr f-1-1.noarch@other solvable:summary package f
+#>attr f-2-1.noarch@other solvable:arch noarch
+#>attr f-2-1.noarch@other solvable:evr 2-1
+#>attr f-2-1.noarch@other solvable:name f
+#>attr f-2-1.noarch@other solvable:provides d
+#>attr f-2-1.noarch@other solvable:provides f = 2-1
+#>attr f-2-1.noarch@other solvable:summary package f, new version
+nextjob
+reload other,available delta=1 batch=2
+job install name e
+result transaction,problems <inline>
+#>install b-2-1.noarch@available
+#>install e-1-1.noarch@other
@@ -0,0 +1,55 @@
+# a delta must not be applied if its base cookie does not match the
+# repository state or if it has no base cookie at all
+repo system 0 empty
+repo available 0 testtags <inline>
+#>=Pkg: a 1 1 noarch
+#>=Sum: package a
+#>=Pkg: b 1 1 noarch
+#>=Sum: package b
+#>=Pkg: c 1 1 noarch
+#>=Sum: package c
+#>=Pkg: b 2 1 noarch
+#>=Sum: package b, new version
+#>=Pkg: d 1 1 noarch
+#>=Sum: package d
+system i686 rpm system
+reload available delta=1 deltabase=other
+result attributes <inline>
+#>attr a-1-1.noarch@available solvable:arch noarch
+#>attr a-1-1.noarch@available solvable:evr 1-1
+#>attr a-1-1.noarch@available solvable:name a
+#>attr a-1-1.noarch@available solvable:provides a = 1-1
+#>attr a-1-1.noarch@available solvable:summary package a
+#>attr b-1-1.noarch@available solvable:arch noarch
+#>attr b-1-1.noarch@available solvable:evr 1-1
+#>attr b-1-1.noarch@available solvable:name b
+#>attr b-1-1.noarch@available solvable:provides b = 1-1
+#>attr b-1-1.noarch@available solvable:summary package b
+#>attr b-2-1.noarch@available solvable:arch noarch
+#>attr b-2-1.noarch@available solvable:evr 2-1
+#>attr b-2-1.noarch@available solvable:name b
+#>attr b-2-1.noarch@available solvable:provides b = 2-1
+#>attr b-2-1.noarch@available solvable:summary package b, new version
+#>attr c-1-1.noarch@available solvable:arch noarch
+#>attr c-1-1.noarch@available solvable:evr 1-1
+#>attr c-1-1.noarch@available solvable:name c
+#>attr c-1-1.noarch@available solvable:provides c = 1-1
+#>attr c-1-1.noarch@available solvable:summary package c
+nextjob
+reload available delta=1 deltabase=
+result attributes <inline>
+#>attr a-1-1.noarch@available solvable:arch noarch
+#>attr a-1-1.noarch@available solvable:evr 1-1
+#>attr a-1-1.noarch@available solvable:name a
+#>attr a-1-1.noarch@available solvable:provides a = 1-1
+#>attr a-1-1.noarch@available solvable:summary package a
+#>attr b-1-1.noarch@available solvable:arch noarch
+#>attr b-1-1.noarch@available solvable:evr 1-1
+#>attr b-1-1.noarch@available solvable:name b
+#>attr b-1-1.noarch@available solvable:provides b = 1-1
+#>attr b-1-1.noarch@available solvable:summary package b
+#>attr c-1-1.noarch@available solvable:arch noarch
+#>attr c-1-1.noarch@available solvable:evr 1-1
+#>attr c-1-1.noarch@available solvable:name c
+#>attr c-1-1.noarch@available solvable:provides c = 1-1
+#>attr c-1-1.noarch@available solvable:summary package c
@@ -0,0 +1,78 @@
+# write the last packages as delta that is appended to the base and
+# load both. The delta replaces b-1-1 with b-2-1 and adds d-1-1.
+repo system 0 empty
+repo available 0 testtags <inline>
+#>=Pkg: a 1 1 noarch
+#>=Sum: package a
+#>=Pkg: b 1 1 noarch
+#>=Sum: package b
+#>=Pkg: c 1 1 noarch
+#>=Sum: package c
+#>=Pkg: b 2 1 noarch
+#>=Sum: package b, new version
+#>=Pkg: d 1 1 noarch
+#>=Sum: package d
+system i686 rpm system
+reload available delta=2 deltaremove=b-1-1.noarch@available
+result attributes <inline>
+#>attr a-1-1.noarch@available solvable:arch noarch
+#>attr a-1-1.noarch@available solvable:evr 1-1
+#>attr a-1-1.noarch@available solvable:name a
+#>attr a-1-1.noarch@available solvable:provides a = 1-1
+#>attr a-1-1.noarch@available solvable:summary package a
+#>attr b-2-1.noarch@available solvable:arch noarch
+#>attr b-2-1.noarch@available solvable:evr 2-1
+#>attr b-2-1.noarch@available solvable:name b
+#>attr b-2-1.noarch@available solvable:provides b = 2-1
+#>attr b-2-1.noarch@available solvable:summary package b, new version
+#>attr c-1-1.noarch@available solvable:arch noarch
+#>attr c-1-1.noarch@available solvable:evr 1-1
+#>attr c-1-1.noarch@available solvable:name c
+#>attr c-1-1.noarch@available solvable:provides c = 1-1
+#>attr c-1-1.noarch@available solvable:summary package c
+#>attr d-1-1.noarch@available solvable:arch noarch
+#>attr d-1-1.noarch@available solvable:evr 1-1
+#>attr d-1-1.noarch@available solvable:name d
+#>attr d-1-1.noarch@available solvable:provides d = 1-1
+#>attr d-1-1.noarch@available solvable:summary package d
+nextjob
+reload available delta=1 mmap
+result attributes <inline>
+#>attr a-1-1.noarch@available solvable:arch noarch
+#>attr a-1-1.noarch@available solvable:evr 1-1
+#>attr a-1-1.noarch@available solvable:name a
+#>attr a-1-1.noarch@available solvable:provides a = 1-1
+#>attr a-1-1.noarch@available solvable:summary package a
+#>attr b-2-1.noarch@available solvable:arch noarch
+#>attr b-2-1.noarch@available solvable:evr 2-1
+#>attr b-2-1.noarch@available solvable:name b
+#>attr b-2-1.noarch@available solvable:provides b = 2-1
+#>attr b-2-1.noarch@available solvable:summary package b, new version
+#>attr c-1-1.noarch@available solvable:arch noarch
+#>attr c-1-1.noarch@available solvable:evr 1-1
+#>attr c-1-1.noarch@available solvable:name c
+#>attr c-1-1.noarch@available solvable:provides c = 1-1
+#>attr c-1-1.noarch@available solvable:summary package c
+#>attr d-1-1.noarch@available solvable:arch noarch
+#>attr d-1-1.noarch@available solvable:evr 1-1
+#>attr d-1-1.noarch@available solvable:name d
+#>attr d-1-1.noarch@available solvable:provides d = 1-1
+#>attr d-1-1.noarch@available solvable:summary package d
+nextjob
+reload available delta=1 nodeltas
+result attributes <inline>
+#>attr a-1-1.noarch@available solvable:arch noarch
+#>attr a-1-1.noarch@available solvable:evr 1-1
+#>attr a-1-1.noarch@available solvable:name a
+#>attr a-1-1.noarch@available solvable:provides a = 1-1
+#>attr a-1-1.noarch@available solvable:summary package a
+#>attr b-2-1.noarch@available solvable:arch noarch
+#>attr b-2-1.noarch@available solvable:evr 2-1
+#>attr b-2-1.noarch@available solvable:name b
+#>attr b-2-1.noarch@available solvable:provides b = 2-1
+#>attr b-2-1.noarch@available solvable:summary package b, new version
+#>attr c-1-1.noarch@available solvable:arch noarch
+#>attr c-1-1.noarch@available solvable:evr 1-1
+#>attr c-1-1.noarch@available solvable:name c
+#>attr c-1-1.noarch@available solvable:provides c = 1-1
+#>attr c-1-1.noarch@available solvable:summary package c
@@ -0,0 +1,41 @@
+# a solv file with a new string that is already in an earlier run
+# of the string block. dupcheck-a is used twice and dupcheck-b once,
+# so they are in different runs. Both are renamed to newcheck-a,
+# which is not yet in the pool. The second one must not become a
+# new pool string.
+repo system 0 empty
+repo available 0 testtags <inline>
+#>=Pkg: A 1 1 noarch
+#>=Prv: dupcheck-a
+#>=Pkg: B 1 1 noarch
+#>=Prv: dupcheck-a
+#>=Pkg: C 1 1 noarch
+#>=Prv: dupcheck-b
+#>=Pkg: X 1 1 noarch
+#>=Req: dupcheck-a
+#>=Con: A
+#>=Con: B
+repo batched 0 testtags <inline>
+#>=Pkg: D 1 1 noarch
+#>=Prv: dupbatch-a
+#>=Pkg: E 1 1 noarch
+#>=Prv: dupbatch-a
+#>=Pkg: F 1 1 noarch
+#>=Prv: dupbatch-b
+#>=Pkg: Y 1 1 noarch
+#>=Req: dupbatch-a
+#>=Con: D
+#>=Con: E
+system i686 rpm system
+reload available patch=dupcheck-a:newcheck-a,dupcheck-b:newcheck-a
+job install name X
+result transaction,problems <inline>
+#>install C-1-1.noarch@available
+#>install X-1-1.noarch@available
+nextjob
+# the same with the strings hashed by the batch loader
+reload batched batch=2 patch=dupbatch-a:newbatch-a,dupbatch-b:newbatch-a
+job install name Y
+result transaction,problems <inline>
+#>install F-1-1.noarch@batched
+#>install Y-1-1.noarch@batched
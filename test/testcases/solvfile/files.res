@@ -0,0 +1,924 @@
+attr f0-1.0-1.x86_64@available solvable:arch x86_64
+attr f0-1.0-1.x86_64@available solvable:evr 1.0-1
+attr f0-1.0-1.x86_64@available solvable:filelist /f0/alpha-beta-gamma-delta-lib-share-doc-locale-icons-plugins-alpha-beta-gamma-delta-lib-share-doc-locale-icons-plugins-alpha-beta-gamma-delta-lib-share-doc-locale10.png
+attr f0-1.0-1.x86_64@available solvable:filelist /f0/alpha-beta-gamma-delta-lib-share-doc-locale-icons-plugins-alpha-beta-gamma-delta-lib-share-doc-locale-icons-plugins-alpha-beta-gamma-delta-lib-share20.so
+attr f0-1.0-1.x86_64@available solvable:filelist /f0/alpha-beta-gamma-delta-lib-share-doc-locale-icons-plugins-alpha-beta-gamma-delta-lib-share-doc-locale-icons-plugins-alpha-beta-gamma-delta0.so
+attr f0-1.0-1.x86_64@available solvable:filelist /f0/alpha-beta-gamma-delta-lib-share-doc-locale-icons-plugins-alpha-beta-gamma-delta-lib-share-doc-locale-icons-plugins-alpha-beta-gamma-delta30.png
+attr f0-1.0-1.x86_64@available solvable:filelist /f0/beta-gamma-delta-lib-share-doc-locale-icons-plugins-alpha-beta-gamma-delta-lib-share-doc-locale-icons-plugins-alpha-beta-gamma-delta-lib-share-doc-locale-icons-plugins11.mo
+attr f0-1.0-1.x86_64@available solvable:filelist /f0/beta-gamma-delta-lib-share-doc-locale-icons-plugins-alpha-beta-gamma-delta-lib-share-doc-locale-icons-plugins-alpha-beta-gamma-delta-lib-share-doc-locale21.txt
+attr f0-1.0-1.x86_64@available solvable:filelist /f0/beta-gamma-delta-lib-share-doc-locale-icons-plugins-alpha-beta-gamma-delta-lib-share-doc-locale-icons-plugins-alpha-beta-gamma-delta-lib-share1.txt
+attr f0-1.0-1.x86_64@available solvable:filelist /f0/beta-gamma-delta-lib-share-doc-locale-icons-plugins-alpha-beta-gamma-delta-lib-share-doc-locale-icons-plugins-alpha-beta-gamma-delta-lib-share31.mo
+attr f0-1.0-1.x86_64@available solvable:filelist /f0/delta-lib-share-doc-locale-icons-plugins-alpha-beta-gamma-delta-lib-share-doc-locale-icons-plugins-alpha-beta-gamma-delta-lib-share-doc-locale-icons-plugins-alpha-beta23.mo
+attr f0-1.0-1.x86_64@available solvable:filelist /f0/delta-lib-share-doc-locale-icons-plugins-alpha-beta-gamma-delta-lib-share-doc-locale-icons-plugins-alpha-beta-gamma-delta-lib-share-doc-locale-icons-plugins3.mo
+attr f0-1.0-1.x86_64@available solvable:filelist /f0/delta-lib-share-doc-locale-icons-plugins-alpha-beta-gamma-delta-lib-share-doc-locale-icons-plugins-alpha-beta-gamma-delta-lib-share-doc-locale-icons-plugins33.txt
+attr f0-1.0-1.x86_64@available solvable:filelist /f0/delta-lib-share-doc-locale-icons-plugins-alpha-beta-gamma-delta-lib-share-doc-locale-icons-plugins-alpha-beta-gamma-delta-lib-share-doc-locale13.txt
+attr f0-1.0-1.x86_64@available solvable:filelist /f0/doc-locale-icons-plugins-alpha-beta-gamma-delta-lib-share-doc-locale-icons-plugins-alpha-beta-gamma-delta-lib-share-doc-locale-icons-plugins-alpha-beta-gamma-delta16.so
+attr f0-1.0-1.x86_64@available solvable:filelist /f0/doc-locale-icons-plugins-alpha-beta-gamma-delta-lib-share-doc-locale-icons-plugins-alpha-beta-gamma-delta-lib-share-doc-locale-icons-plugins-alpha-beta26.png
+attr f0-1.0-1.x86_64@available solvable:filelist /f0/doc-locale-icons-plugins-alpha-beta-gamma-delta-lib-share-doc-locale-icons-plugins-alpha-beta-gamma-delta-lib-share-doc-locale-icons-plugins36.so
+attr f0-1.0-1.x86_64@available solvable:filelist /f0/doc-locale-icons-plugins-alpha-beta-gamma-delta-lib-share-doc-locale-icons-plugins-alpha-beta-gamma-delta-lib-share-doc-locale-icons-plugins6.png
+attr f0-1.0-1.x86_64@available solvable:filelist /f0/gamma-delta-lib-share-doc-locale-icons-plugins-alpha-beta-gamma-delta-lib-share-doc-locale-icons-plugins-alpha-beta-gamma-delta-lib-share-doc-locale-icons-plugins22.png
+attr f0-1.0-1.x86_64@available solvable:filelist /f0/gamma-delta-lib-share-doc-locale-icons-plugins-alpha-beta-gamma-delta-lib-share-doc-locale-icons-plugins-alpha-beta-gamma-delta-lib-share-doc-locale2.png
+attr f0-1.0-1.x86_64@available solvable:filelist /f0/gamma-delta-lib-share-doc-locale-icons-plugins-alpha-beta-gamma-delta-lib-share-doc-locale-icons-plugins-alpha-beta-gamma-delta-lib-share-doc-locale32.so
+attr f0-1.0-1.x86_64@available solvable:filelist /f0/gamma-delta-lib-share-doc-locale-icons-plugins-alpha-beta-gamma-delta-lib-share-doc-locale-icons-plugins-alpha-beta-gamma-delta-lib-share12.so
+attr f0-1.0-1.x86_64@available solvable:filelist /f0/icons-plugins-alpha-beta-gamma-delta-lib-share-doc-locale-icons-plugins-alpha-beta-gamma-delta-lib-share-doc-locale-icons-plugins-alpha-beta-gamma-delta-lib-share28.so
+attr f0-1.0-1.x86_64@available solvable:filelist /f0/icons-plugins-alpha-beta-gamma-delta-lib-share-doc-locale-icons-plugins-alpha-beta-gamma-delta-lib-share-doc-locale-icons-plugins-alpha-beta-gamma-delta38.png
+attr f0-1.0-1.x86_64@available solvable:filelist /f0/icons-plugins-alpha-beta-gamma-delta-lib-share-doc-locale-icons-plugins-alpha-beta-gamma-delta-lib-share-doc-locale-icons-plugins-alpha-beta-gamma-delta8.so
+attr f0-1.0-1.x86_64@available solvable:filelist /f0/icons-plugins-alpha-beta-gamma-delta-lib-share-doc-locale-icons-plugins-alpha-beta-gamma-delta-lib-share-doc-locale-icons-plugins-alpha-beta18.png
+attr f0-1.0-1.x86_64@available solvable:filelist /f0/lib-share-doc-locale-icons-plugins-alpha-beta-gamma-delta-lib-share-doc-locale-icons-plugins-alpha-beta-gamma-delta-lib-share-doc-locale-icons-plugins-alpha-beta34.png
+attr f0-1.0-1.x86_64@available solvable:filelist /f0/lib-share-doc-locale-icons-plugins-alpha-beta-gamma-delta-lib-share-doc-locale-icons-plugins-alpha-beta-gamma-delta-lib-share-doc-locale-icons-plugins-alpha-beta4.so
+attr f0-1.0-1.x86_64@available solvable:filelist /f0/lib-share-doc-locale-icons-plugins-alpha-beta-gamma-delta-lib-share-doc-locale-icons-plugins-alpha-beta-gamma-delta-lib-share-doc-locale-icons-plugins14.png
+attr f0-1.0-1.x86_64@available solvable:filelist /f0/lib-share-doc-locale-icons-plugins-alpha-beta-gamma-delta-lib-share-doc-locale-icons-plugins-alpha-beta-gamma-delta-lib-share-doc-locale24.so
+attr f0-1.0-1.x86_64@available solvable:filelist /f0/locale-icons-plugins-alpha-beta-gamma-delta-lib-share-doc-locale-icons-plugins-alpha-beta-gamma-delta-lib-share-doc-locale-icons-plugins-alpha-beta-gamma-delta-lib-share17.txt
+attr f0-1.0-1.x86_64@available solvable:filelist /f0/locale-icons-plugins-alpha-beta-gamma-delta-lib-share-doc-locale-icons-plugins-alpha-beta-gamma-delta-lib-share-doc-locale-icons-plugins-alpha-beta-gamma-delta27.mo
+attr f0-1.0-1.x86_64@available solvable:filelist /f0/locale-icons-plugins-alpha-beta-gamma-delta-lib-share-doc-locale-icons-plugins-alpha-beta-gamma-delta-lib-share-doc-locale-icons-plugins-alpha-beta37.txt
+attr f0-1.0-1.x86_64@available solvable:filelist /f0/locale-icons-plugins-alpha-beta-gamma-delta-lib-share-doc-locale-icons-plugins-alpha-beta-gamma-delta-lib-share-doc-locale-icons-plugins-alpha-beta7.mo
+attr f0-1.0-1.x86_64@available solvable:filelist /f0/plugins-alpha-beta-gamma-delta-lib-share-doc-locale-icons-plugins-alpha-beta-gamma-delta-lib-share-doc-locale-icons-plugins-alpha-beta-gamma-delta-lib-share-doc-locale29.txt
+attr f0-1.0-1.x86_64@available solvable:filelist /f0/plugins-alpha-beta-gamma-delta-lib-share-doc-locale-icons-plugins-alpha-beta-gamma-delta-lib-share-doc-locale-icons-plugins-alpha-beta-gamma-delta-lib-share39.mo
+attr f0-1.0-1.x86_64@available solvable:filelist /f0/plugins-alpha-beta-gamma-delta-lib-share-doc-locale-icons-plugins-alpha-beta-gamma-delta-lib-share-doc-locale-icons-plugins-alpha-beta-gamma-delta-lib-share9.txt
+attr f0-1.0-1.x86_64@available solvable:filelist /f0/plugins-alpha-beta-gamma-delta-lib-share-doc-locale-icons-plugins-alpha-beta-gamma-delta-lib-share-doc-locale-icons-plugins-alpha-beta-gamma-delta19.mo
+attr f0-1.0-1.x86_64@available solvable:filelist /f0/share-doc-locale-icons-plugins-alpha-beta-gamma-delta-lib-share-doc-locale-icons-plugins-alpha-beta-gamma-delta-lib-share-doc-locale-icons-plugins-alpha-beta-gamma-delta35.mo
+attr f0-1.0-1.x86_64@available solvable:filelist /f0/share-doc-locale-icons-plugins-alpha-beta-gamma-delta-lib-share-doc-locale-icons-plugins-alpha-beta-gamma-delta-lib-share-doc-locale-icons-plugins-alpha-beta-gamma-delta5.txt
+attr f0-1.0-1.x86_64@available solvable:filelist /f0/share-doc-locale-icons-plugins-alpha-beta-gamma-delta-lib-share-doc-locale-icons-plugins-alpha-beta-gamma-delta-lib-share-doc-locale-icons-plugins-alpha-beta15.mo
+attr f0-1.0-1.x86_64@available solvable:filelist /f0/share-doc-locale-icons-plugins-alpha-beta-gamma-delta-lib-share-doc-locale-icons-plugins-alpha-beta-gamma-delta-lib-share-doc-locale-icons-plugins25.txt
+attr f0-1.0-1.x86_64@available solvable:name f0
+attr f0-1.0-1.x86_64@available solvable:summary files package 0
+attr f1-1.1-1.x86_64@available solvable:arch x86_64
+attr f1-1.1-1.x86_64@available solvable:evr 1.1-1
+attr f1-1.1-1.x86_64@available solvable:filelist /f1/alpha-beta-gamma-delta-lib-share-doc-locale-icons-plugins-alpha-beta-gamma-delta-lib-share-doc-locale-icons-plugins-alpha-beta-gamma-delta-lib-share-doc-locale40.so
+attr f1-1.1-1.x86_64@available solvable:filelist /f1/alpha-beta-gamma-delta-lib-share-doc-locale-icons-plugins-alpha-beta-gamma-delta-lib-share-doc-locale-icons-plugins-alpha-beta-gamma-delta-lib-share-doc-locale70.png
+attr f1-1.1-1.x86_64@available solvable:filelist /f1/alpha-beta-gamma-delta-lib-share-doc-locale-icons-plugins-alpha-beta-gamma-delta-lib-share-doc-locale-icons-plugins-alpha-beta-gamma-delta-lib-share50.png
+attr f1-1.1-1.x86_64@available solvable:filelist /f1/alpha-beta-gamma-delta-lib-share-doc-locale-icons-plugins-alpha-beta-gamma-delta-lib-share-doc-locale-icons-plugins-alpha-beta-gamma-delta60.so
+attr f1-1.1-1.x86_64@available solvable:filelist /f1/beta-gamma-delta-lib-share-doc-locale-icons-plugins-alpha-beta-gamma-delta-lib-share-doc-locale-icons-plugins-alpha-beta-gamma-delta-lib-share-doc-locale-icons-plugins41.txt
+attr f1-1.1-1.x86_64@available solvable:filelist /f1/beta-gamma-delta-lib-share-doc-locale-icons-plugins-alpha-beta-gamma-delta-lib-share-doc-locale-icons-plugins-alpha-beta-gamma-delta-lib-share-doc-locale-icons-plugins71.mo
+attr f1-1.1-1.x86_64@available solvable:filelist /f1/beta-gamma-delta-lib-share-doc-locale-icons-plugins-alpha-beta-gamma-delta-lib-share-doc-locale-icons-plugins-alpha-beta-gamma-delta-lib-share-doc-locale51.mo
+attr f1-1.1-1.x86_64@available solvable:filelist /f1/beta-gamma-delta-lib-share-doc-locale-icons-plugins-alpha-beta-gamma-delta-lib-share-doc-locale-icons-plugins-alpha-beta-gamma-delta-lib-share61.txt
+attr f1-1.1-1.x86_64@available solvable:filelist /f1/delta-lib-share-doc-locale-icons-plugins-alpha-beta-gamma-delta-lib-share-doc-locale-icons-plugins-alpha-beta-gamma-delta-lib-share-doc-locale-icons-plugins-alpha-beta53.txt
+attr f1-1.1-1.x86_64@available solvable:filelist /f1/delta-lib-share-doc-locale-icons-plugins-alpha-beta-gamma-delta-lib-share-doc-locale-icons-plugins-alpha-beta-gamma-delta-lib-share-doc-locale-icons-plugins63.mo
+attr f1-1.1-1.x86_64@available solvable:filelist /f1/delta-lib-share-doc-locale-icons-plugins-alpha-beta-gamma-delta-lib-share-doc-locale-icons-plugins-alpha-beta-gamma-delta-lib-share-doc-locale43.mo
+attr f1-1.1-1.x86_64@available solvable:filelist /f1/delta-lib-share-doc-locale-icons-plugins-alpha-beta-gamma-delta-lib-share-doc-locale-icons-plugins-alpha-beta-gamma-delta-lib-share-doc-locale73.txt
+attr f1-1.1-1.x86_64@available solvable:filelist /f1/doc-locale-icons-plugins-alpha-beta-gamma-delta-lib-share-doc-locale-icons-plugins-alpha-beta-gamma-delta-lib-share-doc-locale-icons-plugins-alpha-beta-gamma-delta46.png
+attr f1-1.1-1.x86_64@available solvable:filelist /f1/doc-locale-icons-plugins-alpha-beta-gamma-delta-lib-share-doc-locale-icons-plugins-alpha-beta-gamma-delta-lib-share-doc-locale-icons-plugins-alpha-beta-gamma-delta76.so
+attr f1-1.1-1.x86_64@available solvable:filelist /f1/doc-locale-icons-plugins-alpha-beta-gamma-delta-lib-share-doc-locale-icons-plugins-alpha-beta-gamma-delta-lib-share-doc-locale-icons-plugins-alpha-beta56.so
+attr f1-1.1-1.x86_64@available solvable:filelist /f1/doc-locale-icons-plugins-alpha-beta-gamma-delta-lib-share-doc-locale-icons-plugins-alpha-beta-gamma-delta-lib-share-doc-locale-icons-plugins66.png
+attr f1-1.1-1.x86_64@available solvable:filelist /f1/gamma-delta-lib-share-doc-locale-icons-plugins-alpha-beta-gamma-delta-lib-share-doc-locale-icons-plugins-alpha-beta-gamma-delta-lib-share-doc-locale-icons-plugins52.so
+attr f1-1.1-1.x86_64@available solvable:filelist /f1/gamma-delta-lib-share-doc-locale-icons-plugins-alpha-beta-gamma-delta-lib-share-doc-locale-icons-plugins-alpha-beta-gamma-delta-lib-share-doc-locale62.png
+attr f1-1.1-1.x86_64@available solvable:filelist /f1/gamma-delta-lib-share-doc-locale-icons-plugins-alpha-beta-gamma-delta-lib-share-doc-locale-icons-plugins-alpha-beta-gamma-delta-lib-share42.png
+attr f1-1.1-1.x86_64@available solvable:filelist /f1/gamma-delta-lib-share-doc-locale-icons-plugins-alpha-beta-gamma-delta-lib-share-doc-locale-icons-plugins-alpha-beta-gamma-delta-lib-share72.so
+attr f1-1.1-1.x86_64@available solvable:filelist /f1/icons-plugins-alpha-beta-gamma-delta-lib-share-doc-locale-icons-plugins-alpha-beta-gamma-delta-lib-share-doc-locale-icons-plugins-alpha-beta-gamma-delta-lib-share58.png
+attr f1-1.1-1.x86_64@available solvable:filelist /f1/icons-plugins-alpha-beta-gamma-delta-lib-share-doc-locale-icons-plugins-alpha-beta-gamma-delta-lib-share-doc-locale-icons-plugins-alpha-beta-gamma-delta68.so
+attr f1-1.1-1.x86_64@available solvable:filelist /f1/icons-plugins-alpha-beta-gamma-delta-lib-share-doc-locale-icons-plugins-alpha-beta-gamma-delta-lib-share-doc-locale-icons-plugins-alpha-beta48.so
+attr f1-1.1-1.x86_64@available solvable:filelist /f1/icons-plugins-alpha-beta-gamma-delta-lib-share-doc-locale-icons-plugins-alpha-beta-gamma-delta-lib-share-doc-locale-icons-plugins-alpha-beta78.png
+attr f1-1.1-1.x86_64@available solvable:filelist /f1/lib-share-doc-locale-icons-plugins-alpha-beta-gamma-delta-lib-share-doc-locale-icons-plugins-alpha-beta-gamma-delta-lib-share-doc-locale-icons-plugins-alpha-beta64.so
+attr f1-1.1-1.x86_64@available solvable:filelist /f1/lib-share-doc-locale-icons-plugins-alpha-beta-gamma-delta-lib-share-doc-locale-icons-plugins-alpha-beta-gamma-delta-lib-share-doc-locale-icons-plugins44.so
+attr f1-1.1-1.x86_64@available solvable:filelist /f1/lib-share-doc-locale-icons-plugins-alpha-beta-gamma-delta-lib-share-doc-locale-icons-plugins-alpha-beta-gamma-delta-lib-share-doc-locale-icons-plugins74.png
+attr f1-1.1-1.x86_64@available solvable:filelist /f1/lib-share-doc-locale-icons-plugins-alpha-beta-gamma-delta-lib-share-doc-locale-icons-plugins-alpha-beta-gamma-delta-lib-share-doc-locale54.png
+attr f1-1.1-1.x86_64@available solvable:filelist /f1/locale-icons-plugins-alpha-beta-gamma-delta-lib-share-doc-locale-icons-plugins-alpha-beta-gamma-delta-lib-share-doc-locale-icons-plugins-alpha-beta-gamma-delta-lib-share47.mo
+attr f1-1.1-1.x86_64@available solvable:filelist /f1/locale-icons-plugins-alpha-beta-gamma-delta-lib-share-doc-locale-icons-plugins-alpha-beta-gamma-delta-lib-share-doc-locale-icons-plugins-alpha-beta-gamma-delta-lib-share77.txt
+attr f1-1.1-1.x86_64@available solvable:filelist /f1/locale-icons-plugins-alpha-beta-gamma-delta-lib-share-doc-locale-icons-plugins-alpha-beta-gamma-delta-lib-share-doc-locale-icons-plugins-alpha-beta-gamma-delta57.txt
+attr f1-1.1-1.x86_64@available solvable:filelist /f1/locale-icons-plugins-alpha-beta-gamma-delta-lib-share-doc-locale-icons-plugins-alpha-beta-gamma-delta-lib-share-doc-locale-icons-plugins-alpha-beta67.mo
+attr f1-1.1-1.x86_64@available solvable:filelist /f1/plugins-alpha-beta-gamma-delta-lib-share-doc-locale-icons-plugins-alpha-beta-gamma-delta-lib-share-doc-locale-icons-plugins-alpha-beta-gamma-delta-lib-share-doc-locale59.mo
+attr f1-1.1-1.x86_64@available solvable:filelist /f1/plugins-alpha-beta-gamma-delta-lib-share-doc-locale-icons-plugins-alpha-beta-gamma-delta-lib-share-doc-locale-icons-plugins-alpha-beta-gamma-delta-lib-share69.txt
+attr f1-1.1-1.x86_64@available solvable:filelist /f1/plugins-alpha-beta-gamma-delta-lib-share-doc-locale-icons-plugins-alpha-beta-gamma-delta-lib-share-doc-locale-icons-plugins-alpha-beta-gamma-delta49.txt
+attr f1-1.1-1.x86_64@available solvable:filelist /f1/plugins-alpha-beta-gamma-delta-lib-share-doc-locale-icons-plugins-alpha-beta-gamma-delta-lib-share-doc-locale-icons-plugins-alpha-beta-gamma-delta79.mo
+attr f1-1.1-1.x86_64@available solvable:filelist /f1/share-doc-locale-icons-plugins-alpha-beta-gamma-delta-lib-share-doc-locale-icons-plugins-alpha-beta-gamma-delta-lib-share-doc-locale-icons-plugins-alpha-beta-gamma-delta65.txt
+attr f1-1.1-1.x86_64@available solvable:filelist /f1/share-doc-locale-icons-plugins-alpha-beta-gamma-delta-lib-share-doc-locale-icons-plugins-alpha-beta-gamma-delta-lib-share-doc-locale-icons-plugins-alpha-beta45.txt
+attr f1-1.1-1.x86_64@available solvable:filelist /f1/share-doc-locale-icons-plugins-alpha-beta-gamma-delta-lib-share-doc-locale-icons-plugins-alpha-beta-gamma-delta-lib-share-doc-locale-icons-plugins-alpha-beta75.mo
+attr f1-1.1-1.x86_64@available solvable:filelist /f1/share-doc-locale-icons-plugins-alpha-beta-gamma-delta-lib-share-doc-locale-icons-plugins-alpha-beta-gamma-delta-lib-share-doc-locale-icons-plugins55.mo
+attr f1-1.1-1.x86_64@available solvable:name f1
+attr f1-1.1-1.x86_64@available solvable:summary files package 1
+attr f10-1.10-1.x86_64@available solvable:arch x86_64
+attr f10-1.10-1.x86_64@available solvable:evr 1.10-1
+attr f10-1.10-1.x86_64@available solvable:filelist /f10/alpha-beta-gamma-delta-lib-share-doc-locale-icons-plugins-alpha-beta-gamma-delta-lib-share-doc-locale-icons-plugins-alpha-beta-gamma-delta-lib-share-doc-locale400.so
+attr f10-1.10-1.x86_64@available solvable:filelist /f10/alpha-beta-gamma-delta-lib-share-doc-locale-icons-plugins-alpha-beta-gamma-delta-lib-share-doc-locale-icons-plugins-alpha-beta-gamma-delta-lib-share-doc-locale430.png
+attr f10-1.10-1.x86_64@available solvable:filelist /f10/alpha-beta-gamma-delta-lib-share-doc-locale-icons-plugins-alpha-beta-gamma-delta-lib-share-doc-locale-icons-plugins-alpha-beta-gamma-delta-lib-share410.png
+attr f10-1.10-1.x86_64@available solvable:filelist /f10/alpha-beta-gamma-delta-lib-share-doc-locale-icons-plugins-alpha-beta-gamma-delta-lib-share-doc-locale-icons-plugins-alpha-beta-gamma-delta420.so
+attr f10-1.10-1.x86_64@available solvable:filelist /f10/beta-gamma-delta-lib-share-doc-locale-icons-plugins-alpha-beta-gamma-delta-lib-share-doc-locale-icons-plugins-alpha-beta-gamma-delta-lib-share-doc-locale-icons-plugins401.txt
+attr f10-1.10-1.x86_64@available solvable:filelist /f10/beta-gamma-delta-lib-share-doc-locale-icons-plugins-alpha-beta-gamma-delta-lib-share-doc-locale-icons-plugins-alpha-beta-gamma-delta-lib-share-doc-locale-icons-plugins431.mo
+attr f10-1.10-1.x86_64@available solvable:filelist /f10/beta-gamma-delta-lib-share-doc-locale-icons-plugins-alpha-beta-gamma-delta-lib-share-doc-locale-icons-plugins-alpha-beta-gamma-delta-lib-share-doc-locale411.mo
+attr f10-1.10-1.x86_64@available solvable:filelist /f10/beta-gamma-delta-lib-share-doc-locale-icons-plugins-alpha-beta-gamma-delta-lib-share-doc-locale-icons-plugins-alpha-beta-gamma-delta-lib-share421.txt
+attr f10-1.10-1.x86_64@available solvable:filelist /f10/delta-lib-share-doc-locale-icons-plugins-alpha-beta-gamma-delta-lib-share-doc-locale-icons-plugins-alpha-beta-gamma-delta-lib-share-doc-locale-icons-plugins-alpha-beta413.txt
+attr f10-1.10-1.x86_64@available solvable:filelist /f10/delta-lib-share-doc-locale-icons-plugins-alpha-beta-gamma-delta-lib-share-doc-locale-icons-plugins-alpha-beta-gamma-delta-lib-share-doc-locale-icons-plugins423.mo
+attr f10-1.10-1.x86_64@available solvable:filelist /f10/delta-lib-share-doc-locale-icons-plugins-alpha-beta-gamma-delta-lib-share-doc-locale-icons-plugins-alpha-beta-gamma-delta-lib-share-doc-locale403.mo
+attr f10-1.10-1.x86_64@available solvable:filelist /f10/delta-lib-share-doc-locale-icons-plugins-alpha-beta-gamma-delta-lib-share-doc-locale-icons-plugins-alpha-beta-gamma-delta-lib-share-doc-locale433.txt
+attr f10-1.10-1.x86_64@available solvable:filelist /f10/doc-locale-icons-plugins-alpha-beta-gamma-delta-lib-share-doc-locale-icons-plugins-alpha-beta-gamma-delta-lib-share-doc-locale-icons-plugins-alpha-beta-gamma-delta406.png
+attr f10-1.10-1.x86_64@available solvable:filelist /f10/doc-locale-icons-plugins-alpha-beta-gamma-delta-lib-share-doc-locale-icons-plugins-alpha-beta-gamma-delta-lib-share-doc-locale-icons-plugins-alpha-beta-gamma-delta436.so
+attr f10-1.10-1.x86_64@available solvable:filelist /f10/doc-locale-icons-plugins-alpha-beta-gamma-delta-lib-share-doc-locale-icons-plugins-alpha-beta-gamma-delta-lib-share-doc-locale-icons-plugins-alpha-beta416.so
+attr f10-1.10-1.x86_64@available solvable:filelist /f10/doc-locale-icons-plugins-alpha-beta-gamma-delta-lib-share-doc-locale-icons-plugins-alpha-beta-gamma-delta-lib-share-doc-locale-icons-plugins426.png
+attr f10-1.10-1.x86_64@available solvable:filelist /f10/gamma-delta-lib-share-doc-locale-icons-plugins-alpha-beta-gamma-delta-lib-share-doc-locale-icons-plugins-alpha-beta-gamma-delta-lib-share-doc-locale-icons-plugins412.so
+attr f10-1.10-1.x86_64@available solvable:filelist /f10/gamma-delta-lib-share-doc-locale-icons-plugins-alpha-beta-gamma-delta-lib-share-doc-locale-icons-plugins-alpha-beta-gamma-delta-lib-share-doc-locale422.png
+attr f10-1.10-1.x86_64@available solvable:filelist /f10/gamma-delta-lib-share-doc-locale-icons-plugins-alpha-beta-gamma-delta-lib-share-doc-locale-icons-plugins-alpha-beta-gamma-delta-lib-share402.png
+attr f10-1.10-1.x86_64@available solvable:filelist /f10/gamma-delta-lib-share-doc-locale-icons-plugins-alpha-beta-gamma-delta-lib-share-doc-locale-icons-plugins-alpha-beta-gamma-delta-lib-share432.so
+attr f10-1.10-1.x86_64@available solvable:filelist /f10/icons-plugins-alpha-beta-gamma-delta-lib-share-doc-locale-icons-plugins-alpha-beta-gamma-delta-lib-share-doc-locale-icons-plugins-alpha-beta-gamma-delta-lib-share418.png
+attr f10-1.10-1.x86_64@available solvable:filelist /f10/icons-plugins-alpha-beta-gamma-delta-lib-share-doc-locale-icons-plugins-alpha-beta-gamma-delta-lib-share-doc-locale-icons-plugins-alpha-beta-gamma-delta428.so
+attr f10-1.10-1.x86_64@available solvable:filelist /f10/icons-plugins-alpha-beta-gamma-delta-lib-share-doc-locale-icons-plugins-alpha-beta-gamma-delta-lib-share-doc-locale-icons-plugins-alpha-beta408.so
+attr f10-1.10-1.x86_64@available solvable:filelist /f10/icons-plugins-alpha-beta-gamma-delta-lib-share-doc-locale-icons-plugins-alpha-beta-gamma-delta-lib-share-doc-locale-icons-plugins-alpha-beta438.png
+attr f10-1.10-1.x86_64@available solvable:filelist /f10/lib-share-doc-locale-icons-plugins-alpha-beta-gamma-delta-lib-share-doc-locale-icons-plugins-alpha-beta-gamma-delta-lib-share-doc-locale-icons-plugins-alpha-beta424.so
+attr f10-1.10-1.x86_64@available solvable:filelist /f10/lib-share-doc-locale-icons-plugins-alpha-beta-gamma-delta-lib-share-doc-locale-icons-plugins-alpha-beta-gamma-delta-lib-share-doc-locale-icons-plugins404.so
+attr f10-1.10-1.x86_64@available solvable:filelist /f10/lib-share-doc-locale-icons-plugins-alpha-beta-gamma-delta-lib-share-doc-locale-icons-plugins-alpha-beta-gamma-delta-lib-share-doc-locale-icons-plugins434.png
+attr f10-1.10-1.x86_64@available solvable:filelist /f10/lib-share-doc-locale-icons-plugins-alpha-beta-gamma-delta-lib-share-doc-locale-icons-plugins-alpha-beta-gamma-delta-lib-share-doc-locale414.png
+attr f10-1.10-1.x86_64@available solvable:filelist /f10/locale-icons-plugins-alpha-beta-gamma-delta-lib-share-doc-locale-icons-plugins-alpha-beta-gamma-delta-lib-share-doc-locale-icons-plugins-alpha-beta-gamma-delta-lib-share407.mo
+attr f10-1.10-1.x86_64@available solvable:filelist /f10/locale-icons-plugins-alpha-beta-gamma-delta-lib-share-doc-locale-icons-plugins-alpha-beta-gamma-delta-lib-share-doc-locale-icons-plugins-alpha-beta-gamma-delta-lib-share437.txt
+attr f10-1.10-1.x86_64@available solvable:filelist /f10/locale-icons-plugins-alpha-beta-gamma-delta-lib-share-doc-locale-icons-plugins-alpha-beta-gamma-delta-lib-share-doc-locale-icons-plugins-alpha-beta-gamma-delta417.txt
+attr f10-1.10-1.x86_64@available solvable:filelist /f10/locale-icons-plugins-alpha-beta-gamma-delta-lib-share-doc-locale-icons-plugins-alpha-beta-gamma-delta-lib-share-doc-locale-icons-plugins-alpha-beta427.mo
+attr f10-1.10-1.x86_64@available solvable:filelist /f10/plugins-alpha-beta-gamma-delta-lib-share-doc-locale-icons-plugins-alpha-beta-gamma-delta-lib-share-doc-locale-icons-plugins-alpha-beta-gamma-delta-lib-share-doc-locale419.mo
+attr f10-1.10-1.x86_64@available solvable:filelist /f10/plugins-alpha-beta-gamma-delta-lib-share-doc-locale-icons-plugins-alpha-beta-gamma-delta-lib-share-doc-locale-icons-plugins-alpha-beta-gamma-delta-lib-share429.txt
+attr f10-1.10-1.x86_64@available solvable:filelist /f10/plugins-alpha-beta-gamma-delta-lib-share-doc-locale-icons-plugins-alpha-beta-gamma-delta-lib-share-doc-locale-icons-plugins-alpha-beta-gamma-delta409.txt
+attr f10-1.10-1.x86_64@available solvable:filelist /f10/plugins-alpha-beta-gamma-delta-lib-share-doc-locale-icons-plugins-alpha-beta-gamma-delta-lib-share-doc-locale-icons-plugins-alpha-beta-gamma-delta439.mo
+attr f10-1.10-1.x86_64@available solvable:filelist /f10/share-doc-locale-icons-plugins-alpha-beta-gamma-delta-lib-share-doc-locale-icons-plugins-alpha-beta-gamma-delta-lib-share-doc-locale-icons-plugins-alpha-beta-gamma-delta425.txt
+attr f10-1.10-1.x86_64@available solvable:filelist /f10/share-doc-locale-icons-plugins-alpha-beta-gamma-delta-lib-share-doc-locale-icons-plugins-alpha-beta-gamma-delta-lib-share-doc-locale-icons-plugins-alpha-beta405.txt
+attr f10-1.10-1.x86_64@available solvable:filelist /f10/share-doc-locale-icons-plugins-alpha-beta-gamma-delta-lib-share-doc-locale-icons-plugins-alpha-beta-gamma-delta-lib-share-doc-locale-icons-plugins-alpha-beta435.mo
+attr f10-1.10-1.x86_64@available solvable:filelist /f10/share-doc-locale-icons-plugins-alpha-beta-gamma-delta-lib-share-doc-locale-icons-plugins-alpha-beta-gamma-delta-lib-share-doc-locale-icons-plugins415.mo
+attr f10-1.10-1.x86_64@available solvable:name f10
+attr f10-1.10-1.x86_64@available solvable:summary files package 10
+attr f11-1.11-1.x86_64@available solvable:arch x86_64
+attr f11-1.11-1.x86_64@available solvable:evr 1.11-1
+attr f11-1.11-1.x86_64@available solvable:filelist /f11/alpha-beta-gamma-delta-lib-share-doc-locale-icons-plugins-alpha-beta-gamma-delta-lib-share-doc-locale-icons-plugins-alpha-beta-gamma-delta-lib-share-doc-locale460.so
+attr f11-1.11-1.x86_64@available solvable:filelist /f11/alpha-beta-gamma-delta-lib-share-doc-locale-icons-plugins-alpha-beta-gamma-delta-lib-share-doc-locale-icons-plugins-alpha-beta-gamma-delta-lib-share440.so
+attr f11-1.11-1.x86_64@available solvable:filelist /f11/alpha-beta-gamma-delta-lib-share-doc-locale-icons-plugins-alpha-beta-gamma-delta-lib-share-doc-locale-icons-plugins-alpha-beta-gamma-delta-lib-share470.png
+attr f11-1.11-1.x86_64@available solvable:filelist /f11/alpha-beta-gamma-delta-lib-share-doc-locale-icons-plugins-alpha-beta-gamma-delta-lib-share-doc-locale-icons-plugins-alpha-beta-gamma-delta450.png
+attr f11-1.11-1.x86_64@available solvable:filelist /f11/beta-gamma-delta-lib-share-doc-locale-icons-plugins-alpha-beta-gamma-delta-lib-share-doc-locale-icons-plugins-alpha-beta-gamma-delta-lib-share-doc-locale-icons-plugins461.txt
+attr f11-1.11-1.x86_64@available solvable:filelist /f11/beta-gamma-delta-lib-share-doc-locale-icons-plugins-alpha-beta-gamma-delta-lib-share-doc-locale-icons-plugins-alpha-beta-gamma-delta-lib-share-doc-locale441.txt
+attr f11-1.11-1.x86_64@available solvable:filelist /f11/beta-gamma-delta-lib-share-doc-locale-icons-plugins-alpha-beta-gamma-delta-lib-share-doc-locale-icons-plugins-alpha-beta-gamma-delta-lib-share-doc-locale471.mo
+attr f11-1.11-1.x86_64@available solvable:filelist /f11/beta-gamma-delta-lib-share-doc-locale-icons-plugins-alpha-beta-gamma-delta-lib-share-doc-locale-icons-plugins-alpha-beta-gamma-delta-lib-share451.mo
+attr f11-1.11-1.x86_64@available solvable:filelist /f11/delta-lib-share-doc-locale-icons-plugins-alpha-beta-gamma-delta-lib-share-doc-locale-icons-plugins-alpha-beta-gamma-delta-lib-share-doc-locale-icons-plugins-alpha-beta443.mo
+attr f11-1.11-1.x86_64@available solvable:filelist /f11/delta-lib-share-doc-locale-icons-plugins-alpha-beta-gamma-delta-lib-share-doc-locale-icons-plugins-alpha-beta-gamma-delta-lib-share-doc-locale-icons-plugins-alpha-beta473.txt
+attr f11-1.11-1.x86_64@available solvable:filelist /f11/delta-lib-share-doc-locale-icons-plugins-alpha-beta-gamma-delta-lib-share-doc-locale-icons-plugins-alpha-beta-gamma-delta-lib-share-doc-locale-icons-plugins453.txt
+attr f11-1.11-1.x86_64@available solvable:filelist /f11/delta-lib-share-doc-locale-icons-plugins-alpha-beta-gamma-delta-lib-share-doc-locale-icons-plugins-alpha-beta-gamma-delta-lib-share-doc-locale463.mo
+attr f11-1.11-1.x86_64@available solvable:filelist /f11/doc-locale-icons-plugins-alpha-beta-gamma-delta-lib-share-doc-locale-icons-plugins-alpha-beta-gamma-delta-lib-share-doc-locale-icons-plugins-alpha-beta-gamma-delta466.png
+attr f11-1.11-1.x86_64@available solvable:filelist /f11/doc-locale-icons-plugins-alpha-beta-gamma-delta-lib-share-doc-locale-icons-plugins-alpha-beta-gamma-delta-lib-share-doc-locale-icons-plugins-alpha-beta446.png
+attr f11-1.11-1.x86_64@available solvable:filelist /f11/doc-locale-icons-plugins-alpha-beta-gamma-delta-lib-share-doc-locale-icons-plugins-alpha-beta-gamma-delta-lib-share-doc-locale-icons-plugins-alpha-beta476.so
+attr f11-1.11-1.x86_64@available solvable:filelist /f11/doc-locale-icons-plugins-alpha-beta-gamma-delta-lib-share-doc-locale-icons-plugins-alpha-beta-gamma-delta-lib-share-doc-locale-icons-plugins456.so
+attr f11-1.11-1.x86_64@available solvable:filelist /f11/gamma-delta-lib-share-doc-locale-icons-plugins-alpha-beta-gamma-delta-lib-share-doc-locale-icons-plugins-alpha-beta-gamma-delta-lib-share-doc-locale-icons-plugins442.png
+attr f11-1.11-1.x86_64@available solvable:filelist /f11/gamma-delta-lib-share-doc-locale-icons-plugins-alpha-beta-gamma-delta-lib-share-doc-locale-icons-plugins-alpha-beta-gamma-delta-lib-share-doc-locale-icons-plugins472.so
+attr f11-1.11-1.x86_64@available solvable:filelist /f11/gamma-delta-lib-share-doc-locale-icons-plugins-alpha-beta-gamma-delta-lib-share-doc-locale-icons-plugins-alpha-beta-gamma-delta-lib-share-doc-locale452.so
+attr f11-1.11-1.x86_64@available solvable:filelist /f11/gamma-delta-lib-share-doc-locale-icons-plugins-alpha-beta-gamma-delta-lib-share-doc-locale-icons-plugins-alpha-beta-gamma-delta-lib-share462.png
+attr f11-1.11-1.x86_64@available solvable:filelist /f11/icons-plugins-alpha-beta-gamma-delta-lib-share-doc-locale-icons-plugins-alpha-beta-gamma-delta-lib-share-doc-locale-icons-plugins-alpha-beta-gamma-delta-lib-share448.so
+attr f11-1.11-1.x86_64@available solvable:filelist /f11/icons-plugins-alpha-beta-gamma-delta-lib-share-doc-locale-icons-plugins-alpha-beta-gamma-delta-lib-share-doc-locale-icons-plugins-alpha-beta-gamma-delta-lib-share478.png
+attr f11-1.11-1.x86_64@available solvable:filelist /f11/icons-plugins-alpha-beta-gamma-delta-lib-share-doc-locale-icons-plugins-alpha-beta-gamma-delta-lib-share-doc-locale-icons-plugins-alpha-beta-gamma-delta458.png
+attr f11-1.11-1.x86_64@available solvable:filelist /f11/icons-plugins-alpha-beta-gamma-delta-lib-share-doc-locale-icons-plugins-alpha-beta-gamma-delta-lib-share-doc-locale-icons-plugins-alpha-beta468.so
+attr f11-1.11-1.x86_64@available solvable:filelist /f11/lib-share-doc-locale-icons-plugins-alpha-beta-gamma-delta-lib-share-doc-locale-icons-plugins-alpha-beta-gamma-delta-lib-share-doc-locale-icons-plugins-alpha-beta454.png
+attr f11-1.11-1.x86_64@available solvable:filelist /f11/lib-share-doc-locale-icons-plugins-alpha-beta-gamma-delta-lib-share-doc-locale-icons-plugins-alpha-beta-gamma-delta-lib-share-doc-locale-icons-plugins464.so
+attr f11-1.11-1.x86_64@available solvable:filelist /f11/lib-share-doc-locale-icons-plugins-alpha-beta-gamma-delta-lib-share-doc-locale-icons-plugins-alpha-beta-gamma-delta-lib-share-doc-locale444.so
+attr f11-1.11-1.x86_64@available solvable:filelist /f11/lib-share-doc-locale-icons-plugins-alpha-beta-gamma-delta-lib-share-doc-locale-icons-plugins-alpha-beta-gamma-delta-lib-share-doc-locale474.png
+attr f11-1.11-1.x86_64@available solvable:filelist /f11/locale-icons-plugins-alpha-beta-gamma-delta-lib-share-doc-locale-icons-plugins-alpha-beta-gamma-delta-lib-share-doc-locale-icons-plugins-alpha-beta-gamma-delta-lib-share467.mo
+attr f11-1.11-1.x86_64@available solvable:filelist /f11/locale-icons-plugins-alpha-beta-gamma-delta-lib-share-doc-locale-icons-plugins-alpha-beta-gamma-delta-lib-share-doc-locale-icons-plugins-alpha-beta-gamma-delta447.mo
+attr f11-1.11-1.x86_64@available solvable:filelist /f11/locale-icons-plugins-alpha-beta-gamma-delta-lib-share-doc-locale-icons-plugins-alpha-beta-gamma-delta-lib-share-doc-locale-icons-plugins-alpha-beta-gamma-delta477.txt
+attr f11-1.11-1.x86_64@available solvable:filelist /f11/locale-icons-plugins-alpha-beta-gamma-delta-lib-share-doc-locale-icons-plugins-alpha-beta-gamma-delta-lib-share-doc-locale-icons-plugins-alpha-beta457.txt
+attr f11-1.11-1.x86_64@available solvable:filelist /f11/plugins-alpha-beta-gamma-delta-lib-share-doc-locale-icons-plugins-alpha-beta-gamma-delta-lib-share-doc-locale-icons-plugins-alpha-beta-gamma-delta-lib-share-doc-locale449.txt
+attr f11-1.11-1.x86_64@available solvable:filelist /f11/plugins-alpha-beta-gamma-delta-lib-share-doc-locale-icons-plugins-alpha-beta-gamma-delta-lib-share-doc-locale-icons-plugins-alpha-beta-gamma-delta-lib-share-doc-locale479.mo
+attr f11-1.11-1.x86_64@available solvable:filelist /f11/plugins-alpha-beta-gamma-delta-lib-share-doc-locale-icons-plugins-alpha-beta-gamma-delta-lib-share-doc-locale-icons-plugins-alpha-beta-gamma-delta-lib-share459.mo
+attr f11-1.11-1.x86_64@available solvable:filelist /f11/plugins-alpha-beta-gamma-delta-lib-share-doc-locale-icons-plugins-alpha-beta-gamma-delta-lib-share-doc-locale-icons-plugins-alpha-beta-gamma-delta469.txt
+attr f11-1.11-1.x86_64@available solvable:filelist /f11/share-doc-locale-icons-plugins-alpha-beta-gamma-delta-lib-share-doc-locale-icons-plugins-alpha-beta-gamma-delta-lib-share-doc-locale-icons-plugins-alpha-beta-gamma-delta455.mo
+attr f11-1.11-1.x86_64@available solvable:filelist /f11/share-doc-locale-icons-plugins-alpha-beta-gamma-delta-lib-share-doc-locale-icons-plugins-alpha-beta-gamma-delta-lib-share-doc-locale-icons-plugins-alpha-beta465.txt
+attr f11-1.11-1.x86_64@available solvable:filelist /f11/share-doc-locale-icons-plugins-alpha-beta-gamma-delta-lib-share-doc-locale-icons-plugins-alpha-beta-gamma-delta-lib-share-doc-locale-icons-plugins445.txt
+attr f11-1.11-1.x86_64@available solvable:filelist /f11/share-doc-locale-icons-plugins-alpha-beta-gamma-delta-lib-share-doc-locale-icons-plugins-alpha-beta-gamma-delta-lib-share-doc-locale-icons-plugins475.mo
+attr f11-1.11-1.x86_64@available solvable:name f11
+attr f11-1.11-1.x86_64@available solvable:summary files package 11
+attr f12-1.12-1.x86_64@available solvable:arch x86_64
+attr f12-1.12-1.x86_64@available solvable:evr 1.12-1
+attr f12-1.12-1.x86_64@available solvable:filelist /f12/alpha-beta-gamma-delta-lib-share-doc-locale-icons-plugins-alpha-beta-gamma-delta-lib-share-doc-locale-icons-plugins-alpha-beta-gamma-delta-lib-share-doc-locale490.png
+attr f12-1.12-1.x86_64@available solvable:filelist /f12/alpha-beta-gamma-delta-lib-share-doc-locale-icons-plugins-alpha-beta-gamma-delta-lib-share-doc-locale-icons-plugins-alpha-beta-gamma-delta-lib-share500.so
+attr f12-1.12-1.x86_64@available solvable:filelist /f12/alpha-beta-gamma-delta-lib-share-doc-locale-icons-plugins-alpha-beta-gamma-delta-lib-share-doc-locale-icons-plugins-alpha-beta-gamma-delta480.so
+attr f12-1.12-1.x86_64@available solvable:filelist /f12/alpha-beta-gamma-delta-lib-share-doc-locale-icons-plugins-alpha-beta-gamma-delta-lib-share-doc-locale-icons-plugins-alpha-beta-gamma-delta510.png
+attr f12-1.12-1.x86_64@available solvable:filelist /f12/beta-gamma-delta-lib-share-doc-locale-icons-plugins-alpha-beta-gamma-delta-lib-share-doc-locale-icons-plugins-alpha-beta-gamma-delta-lib-share-doc-locale-icons-plugins491.mo
+attr f12-1.12-1.x86_64@available solvable:filelist /f12/beta-gamma-delta-lib-share-doc-locale-icons-plugins-alpha-beta-gamma-delta-lib-share-doc-locale-icons-plugins-alpha-beta-gamma-delta-lib-share-doc-locale501.txt
+attr f12-1.12-1.x86_64@available solvable:filelist /f12/beta-gamma-delta-lib-share-doc-locale-icons-plugins-alpha-beta-gamma-delta-lib-share-doc-locale-icons-plugins-alpha-beta-gamma-delta-lib-share481.txt
+attr f12-1.12-1.x86_64@available solvable:filelist /f12/beta-gamma-delta-lib-share-doc-locale-icons-plugins-alpha-beta-gamma-delta-lib-share-doc-locale-icons-plugins-alpha-beta-gamma-delta-lib-share511.mo
+attr f12-1.12-1.x86_64@available solvable:filelist /f12/delta-lib-share-doc-locale-icons-plugins-alpha-beta-gamma-delta-lib-share-doc-locale-icons-plugins-alpha-beta-gamma-delta-lib-share-doc-locale-icons-plugins-alpha-beta503.mo
+attr f12-1.12-1.x86_64@available solvable:filelist /f12/delta-lib-share-doc-locale-icons-plugins-alpha-beta-gamma-delta-lib-share-doc-locale-icons-plugins-alpha-beta-gamma-delta-lib-share-doc-locale-icons-plugins483.mo
+attr f12-1.12-1.x86_64@available solvable:filelist /f12/delta-lib-share-doc-locale-icons-plugins-alpha-beta-gamma-delta-lib-share-doc-locale-icons-plugins-alpha-beta-gamma-delta-lib-share-doc-locale-icons-plugins513.txt
+attr f12-1.12-1.x86_64@available solvable:filelist /f12/delta-lib-share-doc-locale-icons-plugins-alpha-beta-gamma-delta-lib-share-doc-locale-icons-plugins-alpha-beta-gamma-delta-lib-share-doc-locale493.txt
+attr f12-1.12-1.x86_64@available solvable:filelist /f12/doc-locale-icons-plugins-alpha-beta-gamma-delta-lib-share-doc-locale-icons-plugins-alpha-beta-gamma-delta-lib-share-doc-locale-icons-plugins-alpha-beta-gamma-delta496.so
+attr f12-1.12-1.x86_64@available solvable:filelist /f12/doc-locale-icons-plugins-alpha-beta-gamma-delta-lib-share-doc-locale-icons-plugins-alpha-beta-gamma-delta-lib-share-doc-locale-icons-plugins-alpha-beta506.png
+attr f12-1.12-1.x86_64@available solvable:filelist /f12/doc-locale-icons-plugins-alpha-beta-gamma-delta-lib-share-doc-locale-icons-plugins-alpha-beta-gamma-delta-lib-share-doc-locale-icons-plugins486.png
+attr f12-1.12-1.x86_64@available solvable:filelist /f12/doc-locale-icons-plugins-alpha-beta-gamma-delta-lib-share-doc-locale-icons-plugins-alpha-beta-gamma-delta-lib-share-doc-locale-icons-plugins516.so
+attr f12-1.12-1.x86_64@available solvable:filelist /f12/gamma-delta-lib-share-doc-locale-icons-plugins-alpha-beta-gamma-delta-lib-share-doc-locale-icons-plugins-alpha-beta-gamma-delta-lib-share-doc-locale-icons-plugins502.png
+attr f12-1.12-1.x86_64@available solvable:filelist /f12/gamma-delta-lib-share-doc-locale-icons-plugins-alpha-beta-gamma-delta-lib-share-doc-locale-icons-plugins-alpha-beta-gamma-delta-lib-share-doc-locale482.png
+attr f12-1.12-1.x86_64@available solvable:filelist /f12/gamma-delta-lib-share-doc-locale-icons-plugins-alpha-beta-gamma-delta-lib-share-doc-locale-icons-plugins-alpha-beta-gamma-delta-lib-share-doc-locale512.so
+attr f12-1.12-1.x86_64@available solvable:filelist /f12/gamma-delta-lib-share-doc-locale-icons-plugins-alpha-beta-gamma-delta-lib-share-doc-locale-icons-plugins-alpha-beta-gamma-delta-lib-share492.so
+attr f12-1.12-1.x86_64@available solvable:filelist /f12/icons-plugins-alpha-beta-gamma-delta-lib-share-doc-locale-icons-plugins-alpha-beta-gamma-delta-lib-share-doc-locale-icons-plugins-alpha-beta-gamma-delta-lib-share508.so
+attr f12-1.12-1.x86_64@available solvable:filelist /f12/icons-plugins-alpha-beta-gamma-delta-lib-share-doc-locale-icons-plugins-alpha-beta-gamma-delta-lib-share-doc-locale-icons-plugins-alpha-beta-gamma-delta488.so
+attr f12-1.12-1.x86_64@available solvable:filelist /f12/icons-plugins-alpha-beta-gamma-delta-lib-share-doc-locale-icons-plugins-alpha-beta-gamma-delta-lib-share-doc-locale-icons-plugins-alpha-beta-gamma-delta518.png
+attr f12-1.12-1.x86_64@available solvable:filelist /f12/icons-plugins-alpha-beta-gamma-delta-lib-share-doc-locale-icons-plugins-alpha-beta-gamma-delta-lib-share-doc-locale-icons-plugins-alpha-beta498.png
+attr f12-1.12-1.x86_64@available solvable:filelist /f12/lib-share-doc-locale-icons-plugins-alpha-beta-gamma-delta-lib-share-doc-locale-icons-plugins-alpha-beta-gamma-delta-lib-share-doc-locale-icons-plugins-alpha-beta484.so
+attr f12-1.12-1.x86_64@available solvable:filelist /f12/lib-share-doc-locale-icons-plugins-alpha-beta-gamma-delta-lib-share-doc-locale-icons-plugins-alpha-beta-gamma-delta-lib-share-doc-locale-icons-plugins-alpha-beta514.png
+attr f12-1.12-1.x86_64@available solvable:filelist /f12/lib-share-doc-locale-icons-plugins-alpha-beta-gamma-delta-lib-share-doc-locale-icons-plugins-alpha-beta-gamma-delta-lib-share-doc-locale-icons-plugins494.png
+attr f12-1.12-1.x86_64@available solvable:filelist /f12/lib-share-doc-locale-icons-plugins-alpha-beta-gamma-delta-lib-share-doc-locale-icons-plugins-alpha-beta-gamma-delta-lib-share-doc-locale504.so
+attr f12-1.12-1.x86_64@available solvable:filelist /f12/locale-icons-plugins-alpha-beta-gamma-delta-lib-share-doc-locale-icons-plugins-alpha-beta-gamma-delta-lib-share-doc-locale-icons-plugins-alpha-beta-gamma-delta-lib-share497.txt
+attr f12-1.12-1.x86_64@available solvable:filelist /f12/locale-icons-plugins-alpha-beta-gamma-delta-lib-share-doc-locale-icons-plugins-alpha-beta-gamma-delta-lib-share-doc-locale-icons-plugins-alpha-beta-gamma-delta507.mo
+attr f12-1.12-1.x86_64@available solvable:filelist /f12/locale-icons-plugins-alpha-beta-gamma-delta-lib-share-doc-locale-icons-plugins-alpha-beta-gamma-delta-lib-share-doc-locale-icons-plugins-alpha-beta487.mo
+attr f12-1.12-1.x86_64@available solvable:filelist /f12/locale-icons-plugins-alpha-beta-gamma-delta-lib-share-doc-locale-icons-plugins-alpha-beta-gamma-delta-lib-share-doc-locale-icons-plugins-alpha-beta517.txt
+attr f12-1.12-1.x86_64@available solvable:filelist /f12/plugins-alpha-beta-gamma-delta-lib-share-doc-locale-icons-plugins-alpha-beta-gamma-delta-lib-share-doc-locale-icons-plugins-alpha-beta-gamma-delta-lib-share-doc-locale509.txt
+attr f12-1.12-1.x86_64@available solvable:filelist /f12/plugins-alpha-beta-gamma-delta-lib-share-doc-locale-icons-plugins-alpha-beta-gamma-delta-lib-share-doc-locale-icons-plugins-alpha-beta-gamma-delta-lib-share489.txt
+attr f12-1.12-1.x86_64@available solvable:filelist /f12/plugins-alpha-beta-gamma-delta-lib-share-doc-locale-icons-plugins-alpha-beta-gamma-delta-lib-share-doc-locale-icons-plugins-alpha-beta-gamma-delta-lib-share519.mo
+attr f12-1.12-1.x86_64@available solvable:filelist /f12/plugins-alpha-beta-gamma-delta-lib-share-doc-locale-icons-plugins-alpha-beta-gamma-delta-lib-share-doc-locale-icons-plugins-alpha-beta-gamma-delta499.mo
+attr f12-1.12-1.x86_64@available solvable:filelist /f12/share-doc-locale-icons-plugins-alpha-beta-gamma-delta-lib-share-doc-locale-icons-plugins-alpha-beta-gamma-delta-lib-share-doc-locale-icons-plugins-alpha-beta-gamma-delta485.txt
+attr f12-1.12-1.x86_64@available solvable:filelist /f12/share-doc-locale-icons-plugins-alpha-beta-gamma-delta-lib-share-doc-locale-icons-plugins-alpha-beta-gamma-delta-lib-share-doc-locale-icons-plugins-alpha-beta-gamma-delta515.mo
+attr f12-1.12-1.x86_64@available solvable:filelist /f12/share-doc-locale-icons-plugins-alpha-beta-gamma-delta-lib-share-doc-locale-icons-plugins-alpha-beta-gamma-delta-lib-share-doc-locale-icons-plugins-alpha-beta495.mo
+attr f12-1.12-1.x86_64@available solvable:filelist /f12/share-doc-locale-icons-plugins-alpha-beta-gamma-delta-lib-share-doc-locale-icons-plugins-alpha-beta-gamma-delta-lib-share-doc-locale-icons-plugins505.txt
+attr f12-1.12-1.x86_64@available solvable:name f12
+attr f12-1.12-1.x86_64@available solvable:summary files package 12
+attr f13-1.13-1.x86_64@available solvable:arch x86_64
+attr f13-1.13-1.x86_64@available solvable:evr 1.13-1
+attr f13-1.13-1.x86_64@available solvable:filelist /f13/alpha-beta-gamma-delta-lib-share-doc-locale-icons-plugins-alpha-beta-gamma-delta-lib-share-doc-locale-icons-plugins-alpha-beta-gamma-delta-lib-share-doc-locale520.so
+attr f13-1.13-1.x86_64@available solvable:filelist /f13/alpha-beta-gamma-delta-lib-share-doc-locale-icons-plugins-alpha-beta-gamma-delta-lib-share-doc-locale-icons-plugins-alpha-beta-gamma-delta-lib-share-doc-locale550.png
+attr f13-1.13-1.x86_64@available solvable:filelist /f13/alpha-beta-gamma-delta-lib-share-doc-locale-icons-plugins-alpha-beta-gamma-delta-lib-share-doc-locale-icons-plugins-alpha-beta-gamma-delta-lib-share530.png
+attr f13-1.13-1.x86_64@available solvable:filelist /f13/alpha-beta-gamma-delta-lib-share-doc-locale-icons-plugins-alpha-beta-gamma-delta-lib-share-doc-locale-icons-plugins-alpha-beta-gamma-delta540.so
+attr f13-1.13-1.x86_64@available solvable:filelist /f13/beta-gamma-delta-lib-share-doc-locale-icons-plugins-alpha-beta-gamma-delta-lib-share-doc-locale-icons-plugins-alpha-beta-gamma-delta-lib-share-doc-locale-icons-plugins521.txt
+attr f13-1.13-1.x86_64@available solvable:filelist /f13/beta-gamma-delta-lib-share-doc-locale-icons-plugins-alpha-beta-gamma-delta-lib-share-doc-locale-icons-plugins-alpha-beta-gamma-delta-lib-share-doc-locale-icons-plugins551.mo
+attr f13-1.13-1.x86_64@available solvable:filelist /f13/beta-gamma-delta-lib-share-doc-locale-icons-plugins-alpha-beta-gamma-delta-lib-share-doc-locale-icons-plugins-alpha-beta-gamma-delta-lib-share-doc-locale531.mo
+attr f13-1.13-1.x86_64@available solvable:filelist /f13/beta-gamma-delta-lib-share-doc-locale-icons-plugins-alpha-beta-gamma-delta-lib-share-doc-locale-icons-plugins-alpha-beta-gamma-delta-lib-share541.txt
+attr f13-1.13-1.x86_64@available solvable:filelist /f13/delta-lib-share-doc-locale-icons-plugins-alpha-beta-gamma-delta-lib-share-doc-locale-icons-plugins-alpha-beta-gamma-delta-lib-share-doc-locale-icons-plugins-alpha-beta533.txt
+attr f13-1.13-1.x86_64@available solvable:filelist /f13/delta-lib-share-doc-locale-icons-plugins-alpha-beta-gamma-delta-lib-share-doc-locale-icons-plugins-alpha-beta-gamma-delta-lib-share-doc-locale-icons-plugins543.mo
+attr f13-1.13-1.x86_64@available solvable:filelist /f13/delta-lib-share-doc-locale-icons-plugins-alpha-beta-gamma-delta-lib-share-doc-locale-icons-plugins-alpha-beta-gamma-delta-lib-share-doc-locale523.mo
+attr f13-1.13-1.x86_64@available solvable:filelist /f13/delta-lib-share-doc-locale-icons-plugins-alpha-beta-gamma-delta-lib-share-doc-locale-icons-plugins-alpha-beta-gamma-delta-lib-share-doc-locale553.txt
+attr f13-1.13-1.x86_64@available solvable:filelist /f13/doc-locale-icons-plugins-alpha-beta-gamma-delta-lib-share-doc-locale-icons-plugins-alpha-beta-gamma-delta-lib-share-doc-locale-icons-plugins-alpha-beta-gamma-delta526.png
+attr f13-1.13-1.x86_64@available solvable:filelist /f13/doc-locale-icons-plugins-alpha-beta-gamma-delta-lib-share-doc-locale-icons-plugins-alpha-beta-gamma-delta-lib-share-doc-locale-icons-plugins-alpha-beta-gamma-delta556.so
+attr f13-1.13-1.x86_64@available solvable:filelist /f13/doc-locale-icons-plugins-alpha-beta-gamma-delta-lib-share-doc-locale-icons-plugins-alpha-beta-gamma-delta-lib-share-doc-locale-icons-plugins-alpha-beta536.so
+attr f13-1.13-1.x86_64@available solvable:filelist /f13/doc-locale-icons-plugins-alpha-beta-gamma-delta-lib-share-doc-locale-icons-plugins-alpha-beta-gamma-delta-lib-share-doc-locale-icons-plugins546.png
+attr f13-1.13-1.x86_64@available solvable:filelist /f13/gamma-delta-lib-share-doc-locale-icons-plugins-alpha-beta-gamma-delta-lib-share-doc-locale-icons-plugins-alpha-beta-gamma-delta-lib-share-doc-locale-icons-plugins532.so
+attr f13-1.13-1.x86_64@available solvable:filelist /f13/gamma-delta-lib-share-doc-locale-icons-plugins-alpha-beta-gamma-delta-lib-share-doc-locale-icons-plugins-alpha-beta-gamma-delta-lib-share-doc-locale542.png
+attr f13-1.13-1.x86_64@available solvable:filelist /f13/gamma-delta-lib-share-doc-locale-icons-plugins-alpha-beta-gamma-delta-lib-share-doc-locale-icons-plugins-alpha-beta-gamma-delta-lib-share522.png
+attr f13-1.13-1.x86_64@available solvable:filelist /f13/gamma-delta-lib-share-doc-locale-icons-plugins-alpha-beta-gamma-delta-lib-share-doc-locale-icons-plugins-alpha-beta-gamma-delta-lib-share552.so
+attr f13-1.13-1.x86_64@available solvable:filelist /f13/icons-plugins-alpha-beta-gamma-delta-lib-share-doc-locale-icons-plugins-alpha-beta-gamma-delta-lib-share-doc-locale-icons-plugins-alpha-beta-gamma-delta-lib-share538.png
+attr f13-1.13-1.x86_64@available solvable:filelist /f13/icons-plugins-alpha-beta-gamma-delta-lib-share-doc-locale-icons-plugins-alpha-beta-gamma-delta-lib-share-doc-locale-icons-plugins-alpha-beta-gamma-delta548.so
+attr f13-1.13-1.x86_64@available solvable:filelist /f13/icons-plugins-alpha-beta-gamma-delta-lib-share-doc-locale-icons-plugins-alpha-beta-gamma-delta-lib-share-doc-locale-icons-plugins-alpha-beta528.so
+attr f13-1.13-1.x86_64@available solvable:filelist /f13/icons-plugins-alpha-beta-gamma-delta-lib-share-doc-locale-icons-plugins-alpha-beta-gamma-delta-lib-share-doc-locale-icons-plugins-alpha-beta558.png
+attr f13-1.13-1.x86_64@available solvable:filelist /f13/lib-share-doc-locale-icons-plugins-alpha-beta-gamma-delta-lib-share-doc-locale-icons-plugins-alpha-beta-gamma-delta-lib-share-doc-locale-icons-plugins-alpha-beta544.so
+attr f13-1.13-1.x86_64@available solvable:filelist /f13/lib-share-doc-locale-icons-plugins-alpha-beta-gamma-delta-lib-share-doc-locale-icons-plugins-alpha-beta-gamma-delta-lib-share-doc-locale-icons-plugins524.so
+attr f13-1.13-1.x86_64@available solvable:filelist /f13/lib-share-doc-locale-icons-plugins-alpha-beta-gamma-delta-lib-share-doc-locale-icons-plugins-alpha-beta-gamma-delta-lib-share-doc-locale-icons-plugins554.png
+attr f13-1.13-1.x86_64@available solvable:filelist /f13/lib-share-doc-locale-icons-plugins-alpha-beta-gamma-delta-lib-share-doc-locale-icons-plugins-alpha-beta-gamma-delta-lib-share-doc-locale534.png
+attr f13-1.13-1.x86_64@available solvable:filelist /f13/locale-icons-plugins-alpha-beta-gamma-delta-lib-share-doc-locale-icons-plugins-alpha-beta-gamma-delta-lib-share-doc-locale-icons-plugins-alpha-beta-gamma-delta-lib-share527.mo
+attr f13-1.13-1.x86_64@available solvable:filelist /f13/locale-icons-plugins-alpha-beta-gamma-delta-lib-share-doc-locale-icons-plugins-alpha-beta-gamma-delta-lib-share-doc-locale-icons-plugins-alpha-beta-gamma-delta-lib-share557.txt
+attr f13-1.13-1.x86_64@available solvable:filelist /f13/locale-icons-plugins-alpha-beta-gamma-delta-lib-share-doc-locale-icons-plugins-alpha-beta-gamma-delta-lib-share-doc-locale-icons-plugins-alpha-beta-gamma-delta537.txt
+attr f13-1.13-1.x86_64@available solvable:filelist /f13/locale-icons-plugins-alpha-beta-gamma-delta-lib-share-doc-locale-icons-plugins-alpha-beta-gamma-delta-lib-share-doc-locale-icons-plugins-alpha-beta547.mo
+attr f13-1.13-1.x86_64@available solvable:filelist /f13/plugins-alpha-beta-gamma-delta-lib-share-doc-locale-icons-plugins-alpha-beta-gamma-delta-lib-share-doc-locale-icons-plugins-alpha-beta-gamma-delta-lib-share-doc-locale539.mo
+attr f13-1.13-1.x86_64@available solvable:filelist /f13/plugins-alpha-beta-gamma-delta-lib-share-doc-locale-icons-plugins-alpha-beta-gamma-delta-lib-share-doc-locale-icons-plugins-alpha-beta-gamma-delta-lib-share549.txt
+attr f13-1.13-1.x86_64@available solvable:filelist /f13/plugins-alpha-beta-gamma-delta-lib-share-doc-locale-icons-plugins-alpha-beta-gamma-delta-lib-share-doc-locale-icons-plugins-alpha-beta-gamma-delta529.txt
+attr f13-1.13-1.x86_64@available solvable:filelist /f13/plugins-alpha-beta-gamma-delta-lib-share-doc-locale-icons-plugins-alpha-beta-gamma-delta-lib-share-doc-locale-icons-plugins-alpha-beta-gamma-delta559.mo
+attr f13-1.13-1.x86_64@available solvable:filelist /f13/share-doc-locale-icons-plugins-alpha-beta-gamma-delta-lib-share-doc-locale-icons-plugins-alpha-beta-gamma-delta-lib-share-doc-locale-icons-plugins-alpha-beta-gamma-delta545.txt
+attr f13-1.13-1.x86_64@available solvable:filelist /f13/share-doc-locale-icons-plugins-alpha-beta-gamma-delta-lib-share-doc-locale-icons-plugins-alpha-beta-gamma-delta-lib-share-doc-locale-icons-plugins-alpha-beta525.txt
+attr f13-1.13-1.x86_64@available solvable:filelist /f13/share-doc-locale-icons-plugins-alpha-beta-gamma-delta-lib-share-doc-locale-icons-plugins-alpha-beta-gamma-delta-lib-share-doc-locale-icons-plugins-alpha-beta555.mo
+attr f13-1.13-1.x86_64@available solvable:filelist /f13/share-doc-locale-icons-plugins-alpha-beta-gamma-delta-lib-share-doc-locale-icons-plugins-alpha-beta-gamma-delta-lib-share-doc-locale-icons-plugins535.mo
+attr f13-1.13-1.x86_64@available solvable:name f13
+attr f13-1.13-1.x86_64@available solvable:summary files package 13
+attr f14-1.14-1.x86_64@available solvable:arch x86_64
+attr f14-1.14-1.x86_64@available solvable:evr 1.14-1
+attr f14-1.14-1.x86_64@available solvable:filelist /f14/alpha-beta-gamma-delta-lib-share-doc-locale-icons-plugins-alpha-beta-gamma-delta-lib-share-doc-locale-icons-plugins-alpha-beta-gamma-delta-lib-share-doc-locale580.so
+attr f14-1.14-1.x86_64@available solvable:filelist /f14/alpha-beta-gamma-delta-lib-share-doc-locale-icons-plugins-alpha-beta-gamma-delta-lib-share-doc-locale-icons-plugins-alpha-beta-gamma-delta-lib-share560.so
+attr f14-1.14-1.x86_64@available solvable:filelist /f14/alpha-beta-gamma-delta-lib-share-doc-locale-icons-plugins-alpha-beta-gamma-delta-lib-share-doc-locale-icons-plugins-alpha-beta-gamma-delta-lib-share590.png
+attr f14-1.14-1.x86_64@available solvable:filelist /f14/alpha-beta-gamma-delta-lib-share-doc-locale-icons-plugins-alpha-beta-gamma-delta-lib-share-doc-locale-icons-plugins-alpha-beta-gamma-delta570.png
+attr f14-1.14-1.x86_64@available solvable:filelist /f14/beta-gamma-delta-lib-share-doc-locale-icons-plugins-alpha-beta-gamma-delta-lib-share-doc-locale-icons-plugins-alpha-beta-gamma-delta-lib-share-doc-locale-icons-plugins581.txt
+attr f14-1.14-1.x86_64@available solvable:filelist /f14/beta-gamma-delta-lib-share-doc-locale-icons-plugins-alpha-beta-gamma-delta-lib-share-doc-locale-icons-plugins-alpha-beta-gamma-delta-lib-share-doc-locale561.txt
+attr f14-1.14-1.x86_64@available solvable:filelist /f14/beta-gamma-delta-lib-share-doc-locale-icons-plugins-alpha-beta-gamma-delta-lib-share-doc-locale-icons-plugins-alpha-beta-gamma-delta-lib-share-doc-locale591.mo
+attr f14-1.14-1.x86_64@available solvable:filelist /f14/beta-gamma-delta-lib-share-doc-locale-icons-plugins-alpha-beta-gamma-delta-lib-share-doc-locale-icons-plugins-alpha-beta-gamma-delta-lib-share571.mo
+attr f14-1.14-1.x86_64@available solvable:filelist /f14/delta-lib-share-doc-locale-icons-plugins-alpha-beta-gamma-delta-lib-share-doc-locale-icons-plugins-alpha-beta-gamma-delta-lib-share-doc-locale-icons-plugins-alpha-beta563.mo
+attr f14-1.14-1.x86_64@available solvable:filelist /f14/delta-lib-share-doc-locale-icons-plugins-alpha-beta-gamma-delta-lib-share-doc-locale-icons-plugins-alpha-beta-gamma-delta-lib-share-doc-locale-icons-plugins-alpha-beta593.txt
+attr f14-1.14-1.x86_64@available solvable:filelist /f14/delta-lib-share-doc-locale-icons-plugins-alpha-beta-gamma-delta-lib-share-doc-locale-icons-plugins-alpha-beta-gamma-delta-lib-share-doc-locale-icons-plugins573.txt
+attr f14-1.14-1.x86_64@available solvable:filelist /f14/delta-lib-share-doc-locale-icons-plugins-alpha-beta-gamma-delta-lib-share-doc-locale-icons-plugins-alpha-beta-gamma-delta-lib-share-doc-locale583.mo
+attr f14-1.14-1.x86_64@available solvable:filelist /f14/doc-locale-icons-plugins-alpha-beta-gamma-delta-lib-share-doc-locale-icons-plugins-alpha-beta-gamma-delta-lib-share-doc-locale-icons-plugins-alpha-beta-gamma-delta586.png
+attr f14-1.14-1.x86_64@available solvable:filelist /f14/doc-locale-icons-plugins-alpha-beta-gamma-delta-lib-share-doc-locale-icons-plugins-alpha-beta-gamma-delta-lib-share-doc-locale-icons-plugins-alpha-beta566.png
+attr f14-1.14-1.x86_64@available solvable:filelist /f14/doc-locale-icons-plugins-alpha-beta-gamma-delta-lib-share-doc-locale-icons-plugins-alpha-beta-gamma-delta-lib-share-doc-locale-icons-plugins-alpha-beta596.so
+attr f14-1.14-1.x86_64@available solvable:filelist /f14/doc-locale-icons-plugins-alpha-beta-gamma-delta-lib-share-doc-locale-icons-plugins-alpha-beta-gamma-delta-lib-share-doc-locale-icons-plugins576.so
+attr f14-1.14-1.x86_64@available solvable:filelist /f14/gamma-delta-lib-share-doc-locale-icons-plugins-alpha-beta-gamma-delta-lib-share-doc-locale-icons-plugins-alpha-beta-gamma-delta-lib-share-doc-locale-icons-plugins562.png
+attr f14-1.14-1.x86_64@available solvable:filelist /f14/gamma-delta-lib-share-doc-locale-icons-plugins-alpha-beta-gamma-delta-lib-share-doc-locale-icons-plugins-alpha-beta-gamma-delta-lib-share-doc-locale-icons-plugins592.so
+attr f14-1.14-1.x86_64@available solvable:filelist /f14/gamma-delta-lib-share-doc-locale-icons-plugins-alpha-beta-gamma-delta-lib-share-doc-locale-icons-plugins-alpha-beta-gamma-delta-lib-share-doc-locale572.so
+attr f14-1.14-1.x86_64@available solvable:filelist /f14/gamma-delta-lib-share-doc-locale-icons-plugins-alpha-beta-gamma-delta-lib-share-doc-locale-icons-plugins-alpha-beta-gamma-delta-lib-share582.png
+attr f14-1.14-1.x86_64@available solvable:filelist /f14/icons-plugins-alpha-beta-gamma-delta-lib-share-doc-locale-icons-plugins-alpha-beta-gamma-delta-lib-share-doc-locale-icons-plugins-alpha-beta-gamma-delta-lib-share568.so
+attr f14-1.14-1.x86_64@available solvable:filelist /f14/icons-plugins-alpha-beta-gamma-delta-lib-share-doc-locale-icons-plugins-alpha-beta-gamma-delta-lib-share-doc-locale-icons-plugins-alpha-beta-gamma-delta-lib-share598.png
+attr f14-1.14-1.x86_64@available solvable:filelist /f14/icons-plugins-alpha-beta-gamma-delta-lib-share-doc-locale-icons-plugins-alpha-beta-gamma-delta-lib-share-doc-locale-icons-plugins-alpha-beta-gamma-delta578.png
+attr f14-1.14-1.x86_64@available solvable:filelist /f14/icons-plugins-alpha-beta-gamma-delta-lib-share-doc-locale-icons-plugins-alpha-beta-gamma-delta-lib-share-doc-locale-icons-plugins-alpha-beta588.so
+attr f14-1.14-1.x86_64@available solvable:filelist /f14/lib-share-doc-locale-icons-plugins-alpha-beta-gamma-delta-lib-share-doc-locale-icons-plugins-alpha-beta-gamma-delta-lib-share-doc-locale-icons-plugins-alpha-beta574.png
+attr f14-1.14-1.x86_64@available solvable:filelist /f14/lib-share-doc-locale-icons-plugins-alpha-beta-gamma-delta-lib-share-doc-locale-icons-plugins-alpha-beta-gamma-delta-lib-share-doc-locale-icons-plugins584.so
+attr f14-1.14-1.x86_64@available solvable:filelist /f14/lib-share-doc-locale-icons-plugins-alpha-beta-gamma-delta-lib-share-doc-locale-icons-plugins-alpha-beta-gamma-delta-lib-share-doc-locale564.so
+attr f14-1.14-1.x86_64@available solvable:filelist /f14/lib-share-doc-locale-icons-plugins-alpha-beta-gamma-delta-lib-share-doc-locale-icons-plugins-alpha-beta-gamma-delta-lib-share-doc-locale594.png
+attr f14-1.14-1.x86_64@available solvable:filelist /f14/locale-icons-plugins-alpha-beta-gamma-delta-lib-share-doc-locale-icons-plugins-alpha-beta-gamma-delta-lib-share-doc-locale-icons-plugins-alpha-beta-gamma-delta-lib-share587.mo
+attr f14-1.14-1.x86_64@available solvable:filelist /f14/locale-icons-plugins-alpha-beta-gamma-delta-lib-share-doc-locale-icons-plugins-alpha-beta-gamma-delta-lib-share-doc-locale-icons-plugins-alpha-beta-gamma-delta567.mo
+attr f14-1.14-1.x86_64@available solvable:filelist /f14/locale-icons-plugins-alpha-beta-gamma-delta-lib-share-doc-locale-icons-plugins-alpha-beta-gamma-delta-lib-share-doc-locale-icons-plugins-alpha-beta-gamma-delta597.txt
+attr f14-1.14-1.x86_64@available solvable:filelist /f14/locale-icons-plugins-alpha-beta-gamma-delta-lib-share-doc-locale-icons-plugins-alpha-beta-gamma-delta-lib-share-doc-locale-icons-plugins-alpha-beta577.txt
+attr f14-1.14-1.x86_64@available solvable:filelist /f14/plugins-alpha-beta-gamma-delta-lib-share-doc-locale-icons-plugins-alpha-beta-gamma-delta-lib-share-doc-locale-icons-plugins-alpha-beta-gamma-delta-lib-share-doc-locale569.txt
+attr f14-1.14-1.x86_64@available solvable:filelist /f14/plugins-alpha-beta-gamma-delta-lib-share-doc-locale-icons-plugins-alpha-beta-gamma-delta-lib-share-doc-locale-icons-plugins-alpha-beta-gamma-delta-lib-share-doc-locale599.mo
+attr f14-1.14-1.x86_64@available solvable:filelist /f14/plugins-alpha-beta-gamma-delta-lib-share-doc-locale-icons-plugins-alpha-beta-gamma-delta-lib-share-doc-locale-icons-plugins-alpha-beta-gamma-delta-lib-share579.mo
+attr f14-1.14-1.x86_64@available solvable:filelist /f14/plugins-alpha-beta-gamma-delta-lib-share-doc-locale-icons-plugins-alpha-beta-gamma-delta-lib-share-doc-locale-icons-plugins-alpha-beta-gamma-delta589.txt
+attr f14-1.14-1.x86_64@available solvable:filelist /f14/share-doc-locale-icons-plugins-alpha-beta-gamma-delta-lib-share-doc-locale-icons-plugins-alpha-beta-gamma-delta-lib-share-doc-locale-icons-plugins-alpha-beta-gamma-delta575.mo
+attr f14-1.14-1.x86_64@available solvable:filelist /f14/share-doc-locale-icons-plugins-alpha-beta-gamma-delta-lib-share-doc-locale-icons-plugins-alpha-beta-gamma-delta-lib-share-doc-locale-icons-plugins-alpha-beta585.txt
+attr f14-1.14-1.x86_64@available solvable:filelist /f14/share-doc-locale-icons-plugins-alpha-beta-gamma-delta-lib-share-doc-locale-icons-plugins-alpha-beta-gamma-delta-lib-share-doc-locale-icons-plugins565.txt
+attr f14-1.14-1.x86_64@available solvable:filelist /f14/share-doc-locale-icons-plugins-alpha-beta-gamma-delta-lib-share-doc-locale-icons-plugins-alpha-beta-gamma-delta-lib-share-doc-locale-icons-plugins595.mo
+attr f14-1.14-1.x86_64@available solvable:name f14
+attr f14-1.14-1.x86_64@available solvable:summary files package 14
+attr f15-1.15-1.x86_64@available solvable:arch x86_64
+attr f15-1.15-1.x86_64@available solvable:evr 1.15-1
+attr f15-1.15-1.x86_64@available solvable:filelist /f15/alpha-beta-gamma-delta-lib-share-doc-locale-icons-plugins-alpha-beta-gamma-delta-lib-share-doc-locale-icons-plugins-alpha-beta-gamma-delta-lib-share-doc-locale610.png
+attr f15-1.15-1.x86_64@available solvable:filelist /f15/alpha-beta-gamma-delta-lib-share-doc-locale-icons-plugins-alpha-beta-gamma-delta-lib-share-doc-locale-icons-plugins-alpha-beta-gamma-delta-lib-share620.so
+attr f15-1.15-1.x86_64@available solvable:filelist /f15/alpha-beta-gamma-delta-lib-share-doc-locale-icons-plugins-alpha-beta-gamma-delta-lib-share-doc-locale-icons-plugins-alpha-beta-gamma-delta600.so
+attr f15-1.15-1.x86_64@available solvable:filelist /f15/alpha-beta-gamma-delta-lib-share-doc-locale-icons-plugins-alpha-beta-gamma-delta-lib-share-doc-locale-icons-plugins-alpha-beta-gamma-delta630.png
+attr f15-1.15-1.x86_64@available solvable:filelist /f15/beta-gamma-delta-lib-share-doc-locale-icons-plugins-alpha-beta-gamma-delta-lib-share-doc-locale-icons-plugins-alpha-beta-gamma-delta-lib-share-doc-locale-icons-plugins611.mo
+attr f15-1.15-1.x86_64@available solvable:filelist /f15/beta-gamma-delta-lib-share-doc-locale-icons-plugins-alpha-beta-gamma-delta-lib-share-doc-locale-icons-plugins-alpha-beta-gamma-delta-lib-share-doc-locale621.txt
+attr f15-1.15-1.x86_64@available solvable:filelist /f15/beta-gamma-delta-lib-share-doc-locale-icons-plugins-alpha-beta-gamma-delta-lib-share-doc-locale-icons-plugins-alpha-beta-gamma-delta-lib-share601.txt
+attr f15-1.15-1.x86_64@available solvable:filelist /f15/beta-gamma-delta-lib-share-doc-locale-icons-plugins-alpha-beta-gamma-delta-lib-share-doc-locale-icons-plugins-alpha-beta-gamma-delta-lib-share631.mo
+attr f15-1.15-1.x86_64@available solvable:filelist /f15/delta-lib-share-doc-locale-icons-plugins-alpha-beta-gamma-delta-lib-share-doc-locale-icons-plugins-alpha-beta-gamma-delta-lib-share-doc-locale-icons-plugins-alpha-beta623.mo
+attr f15-1.15-1.x86_64@available solvable:filelist /f15/delta-lib-share-doc-locale-icons-plugins-alpha-beta-gamma-delta-lib-share-doc-locale-icons-plugins-alpha-beta-gamma-delta-lib-share-doc-locale-icons-plugins603.mo
+attr f15-1.15-1.x86_64@available solvable:filelist /f15/delta-lib-share-doc-locale-icons-plugins-alpha-beta-gamma-delta-lib-share-doc-locale-icons-plugins-alpha-beta-gamma-delta-lib-share-doc-locale-icons-plugins633.txt
+attr f15-1.15-1.x86_64@available solvable:filelist /f15/delta-lib-share-doc-locale-icons-plugins-alpha-beta-gamma-delta-lib-share-doc-locale-icons-plugins-alpha-beta-gamma-delta-lib-share-doc-locale613.txt
+attr f15-1.15-1.x86_64@available solvable:filelist /f15/doc-locale-icons-plugins-alpha-beta-gamma-delta-lib-share-doc-locale-icons-plugins-alpha-beta-gamma-delta-lib-share-doc-locale-icons-plugins-alpha-beta-gamma-delta616.so
+attr f15-1.15-1.x86_64@available solvable:filelist /f15/doc-locale-icons-plugins-alpha-beta-gamma-delta-lib-share-doc-locale-icons-plugins-alpha-beta-gamma-delta-lib-share-doc-locale-icons-plugins-alpha-beta626.png
+attr f15-1.15-1.x86_64@available solvable:filelist /f15/doc-locale-icons-plugins-alpha-beta-gamma-delta-lib-share-doc-locale-icons-plugins-alpha-beta-gamma-delta-lib-share-doc-locale-icons-plugins606.png
+attr f15-1.15-1.x86_64@available solvable:filelist /f15/doc-locale-icons-plugins-alpha-beta-gamma-delta-lib-share-doc-locale-icons-plugins-alpha-beta-gamma-delta-lib-share-doc-locale-icons-plugins636.so
+attr f15-1.15-1.x86_64@available solvable:filelist /f15/gamma-delta-lib-share-doc-locale-icons-plugins-alpha-beta-gamma-delta-lib-share-doc-locale-icons-plugins-alpha-beta-gamma-delta-lib-share-doc-locale-icons-plugins622.png
+attr f15-1.15-1.x86_64@available solvable:filelist /f15/gamma-delta-lib-share-doc-locale-icons-plugins-alpha-beta-gamma-delta-lib-share-doc-locale-icons-plugins-alpha-beta-gamma-delta-lib-share-doc-locale602.png
+attr f15-1.15-1.x86_64@available solvable:filelist /f15/gamma-delta-lib-share-doc-locale-icons-plugins-alpha-beta-gamma-delta-lib-share-doc-locale-icons-plugins-alpha-beta-gamma-delta-lib-share-doc-locale632.so
+attr f15-1.15-1.x86_64@available solvable:filelist /f15/gamma-delta-lib-share-doc-locale-icons-plugins-alpha-beta-gamma-delta-lib-share-doc-locale-icons-plugins-alpha-beta-gamma-delta-lib-share612.so
+attr f15-1.15-1.x86_64@available solvable:filelist /f15/icons-plugins-alpha-beta-gamma-delta-lib-share-doc-locale-icons-plugins-alpha-beta-gamma-delta-lib-share-doc-locale-icons-plugins-alpha-beta-gamma-delta-lib-share628.so
+attr f15-1.15-1.x86_64@available solvable:filelist /f15/icons-plugins-alpha-beta-gamma-delta-lib-share-doc-locale-icons-plugins-alpha-beta-gamma-delta-lib-share-doc-locale-icons-plugins-alpha-beta-gamma-delta608.so
+attr f15-1.15-1.x86_64@available solvable:filelist /f15/icons-plugins-alpha-beta-gamma-delta-lib-share-doc-locale-icons-plugins-alpha-beta-gamma-delta-lib-share-doc-locale-icons-plugins-alpha-beta-gamma-delta638.png
+attr f15-1.15-1.x86_64@available solvable:filelist /f15/icons-plugins-alpha-beta-gamma-delta-lib-share-doc-locale-icons-plugins-alpha-beta-gamma-delta-lib-share-doc-locale-icons-plugins-alpha-beta618.png
+attr f15-1.15-1.x86_64@available solvable:filelist /f15/lib-share-doc-locale-icons-plugins-alpha-beta-gamma-delta-lib-share-doc-locale-icons-plugins-alpha-beta-gamma-delta-lib-share-doc-locale-icons-plugins-alpha-beta604.so
+attr f15-1.15-1.x86_64@available solvable:filelist /f15/lib-share-doc-locale-icons-plugins-alpha-beta-gamma-delta-lib-share-doc-locale-icons-plugins-alpha-beta-gamma-delta-lib-share-doc-locale-icons-plugins-alpha-beta634.png
+attr f15-1.15-1.x86_64@available solvable:filelist /f15/lib-share-doc-locale-icons-plugins-alpha-beta-gamma-delta-lib-share-doc-locale-icons-plugins-alpha-beta-gamma-delta-lib-share-doc-locale-icons-plugins614.png
+attr f15-1.15-1.x86_64@available solvable:filelist /f15/lib-share-doc-locale-icons-plugins-alpha-beta-gamma-delta-lib-share-doc-locale-icons-plugins-alpha-beta-gamma-delta-lib-share-doc-locale624.so
+attr f15-1.15-1.x86_64@available solvable:filelist /f15/locale-icons-plugins-alpha-beta-gamma-delta-lib-share-doc-locale-icons-plugins-alpha-beta-gamma-delta-lib-share-doc-locale-icons-plugins-alpha-beta-gamma-delta-lib-share617.txt
+attr f15-1.15-1.x86_64@available solvable:filelist /f15/locale-icons-plugins-alpha-beta-gamma-delta-lib-share-doc-locale-icons-plugins-alpha-beta-gamma-delta-lib-share-doc-locale-icons-plugins-alpha-beta-gamma-delta627.mo
+attr f15-1.15-1.x86_64@available solvable:filelist /f15/locale-icons-plugins-alpha-beta-gamma-delta-lib-share-doc-locale-icons-plugins-alpha-beta-gamma-delta-lib-share-doc-locale-icons-plugins-alpha-beta607.mo
+attr f15-1.15-1.x86_64@available solvable:filelist /f15/locale-icons-plugins-alpha-beta-gamma-delta-lib-share-doc-locale-icons-plugins-alpha-beta-gamma-delta-lib-share-doc-locale-icons-plugins-alpha-beta637.txt
+attr f15-1.15-1.x86_64@available solvable:filelist /f15/plugins-alpha-beta-gamma-delta-lib-share-doc-locale-icons-plugins-alpha-beta-gamma-delta-lib-share-doc-locale-icons-plugins-alpha-beta-gamma-delta-lib-share-doc-locale629.txt
+attr f15-1.15-1.x86_64@available solvable:filelist /f15/plugins-alpha-beta-gamma-delta-lib-share-doc-locale-icons-plugins-alpha-beta-gamma-delta-lib-share-doc-locale-icons-plugins-alpha-beta-gamma-delta-lib-share609.txt
+attr f15-1.15-1.x86_64@available solvable:filelist /f15/plugins-alpha-beta-gamma-delta-lib-share-doc-locale-icons-plugins-alpha-beta-gamma-delta-lib-share-doc-locale-icons-plugins-alpha-beta-gamma-delta-lib-share639.mo
+attr f15-1.15-1.x86_64@available solvable:filelist /f15/plugins-alpha-beta-gamma-delta-lib-share-doc-locale-icons-plugins-alpha-beta-gamma-delta-lib-share-doc-locale-icons-plugins-alpha-beta-gamma-delta619.mo
+attr f15-1.15-1.x86_64@available solvable:filelist /f15/share-doc-locale-icons-plugins-alpha-beta-gamma-delta-lib-share-doc-locale-icons-plugins-alpha-beta-gamma-delta-lib-share-doc-locale-icons-plugins-alpha-beta-gamma-delta605.txt
+attr f15-1.15-1.x86_64@available solvable:filelist /f15/share-doc-locale-icons-plugins-alpha-beta-gamma-delta-lib-share-doc-locale-icons-plugins-alpha-beta-gamma-delta-lib-share-doc-locale-icons-plugins-alpha-beta-gamma-delta635.mo
+attr f15-1.15-1.x86_64@available solvable:filelist /f15/share-doc-locale-icons-plugins-alpha-beta-gamma-delta-lib-share-doc-locale-icons-plugins-alpha-beta-gamma-delta-lib-share-doc-locale-icons-plugins-alpha-beta615.mo
+attr f15-1.15-1.x86_64@available solvable:filelist /f15/share-doc-locale-icons-plugins-alpha-beta-gamma-delta-lib-share-doc-locale-icons-plugins-alpha-beta-gamma-delta-lib-share-doc-locale-icons-plugins625.txt
+attr f15-1.15-1.x86_64@available solvable:name f15
+attr f15-1.15-1.x86_64@available solvable:summary files package 15
+attr f16-1.16-1.x86_64@available solvable:arch x86_64
+attr f16-1.16-1.x86_64@available solvable:evr 1.16-1
+attr f16-1.16-1.x86_64@available solvable:filelist /f16/alpha-beta-gamma-delta-lib-share-doc-locale-icons-plugins-alpha-beta-gamma-delta-lib-share-doc-locale-icons-plugins-alpha-beta-gamma-delta-lib-share-doc-locale640.so
+attr f16-1.16-1.x86_64@available solvable:filelist /f16/alpha-beta-gamma-delta-lib-share-doc-locale-icons-plugins-alpha-beta-gamma-delta-lib-share-doc-locale-icons-plugins-alpha-beta-gamma-delta-lib-share-doc-locale670.png
+attr f16-1.16-1.x86_64@available solvable:filelist /f16/alpha-beta-gamma-delta-lib-share-doc-locale-icons-plugins-alpha-beta-gamma-delta-lib-share-doc-locale-icons-plugins-alpha-beta-gamma-delta-lib-share650.png
+attr f16-1.16-1.x86_64@available solvable:filelist /f16/alpha-beta-gamma-delta-lib-share-doc-locale-icons-plugins-alpha-beta-gamma-delta-lib-share-doc-locale-icons-plugins-alpha-beta-gamma-delta660.so
+attr f16-1.16-1.x86_64@available solvable:filelist /f16/beta-gamma-delta-lib-share-doc-locale-icons-plugins-alpha-beta-gamma-delta-lib-share-doc-locale-icons-plugins-alpha-beta-gamma-delta-lib-share-doc-locale-icons-plugins641.txt
+attr f16-1.16-1.x86_64@available solvable:filelist /f16/beta-gamma-delta-lib-share-doc-locale-icons-plugins-alpha-beta-gamma-delta-lib-share-doc-locale-icons-plugins-alpha-beta-gamma-delta-lib-share-doc-locale-icons-plugins671.mo
+attr f16-1.16-1.x86_64@available solvable:filelist /f16/beta-gamma-delta-lib-share-doc-locale-icons-plugins-alpha-beta-gamma-delta-lib-share-doc-locale-icons-plugins-alpha-beta-gamma-delta-lib-share-doc-locale651.mo
+attr f16-1.16-1.x86_64@available solvable:filelist /f16/beta-gamma-delta-lib-share-doc-locale-icons-plugins-alpha-beta-gamma-delta-lib-share-doc-locale-icons-plugins-alpha-beta-gamma-delta-lib-share661.txt
+attr f16-1.16-1.x86_64@available solvable:filelist /f16/delta-lib-share-doc-locale-icons-plugins-alpha-beta-gamma-delta-lib-share-doc-locale-icons-plugins-alpha-beta-gamma-delta-lib-share-doc-locale-icons-plugins-alpha-beta653.txt
+attr f16-1.16-1.x86_64@available solvable:filelist /f16/delta-lib-share-doc-locale-icons-plugins-alpha-beta-gamma-delta-lib-share-doc-locale-icons-plugins-alpha-beta-gamma-delta-lib-share-doc-locale-icons-plugins663.mo
+attr f16-1.16-1.x86_64@available solvable:filelist /f16/delta-lib-share-doc-locale-icons-plugins-alpha-beta-gamma-delta-lib-share-doc-locale-icons-plugins-alpha-beta-gamma-delta-lib-share-doc-locale643.mo
+attr f16-1.16-1.x86_64@available solvable:filelist /f16/delta-lib-share-doc-locale-icons-plugins-alpha-beta-gamma-delta-lib-share-doc-locale-icons-plugins-alpha-beta-gamma-delta-lib-share-doc-locale673.txt
+attr f16-1.16-1.x86_64@available solvable:filelist /f16/doc-locale-icons-plugins-alpha-beta-gamma-delta-lib-share-doc-locale-icons-plugins-alpha-beta-gamma-delta-lib-share-doc-locale-icons-plugins-alpha-beta-gamma-delta646.png
+attr f16-1.16-1.x86_64@available solvable:filelist /f16/doc-locale-icons-plugins-alpha-beta-gamma-delta-lib-share-doc-locale-icons-plugins-alpha-beta-gamma-delta-lib-share-doc-locale-icons-plugins-alpha-beta-gamma-delta676.so
+attr f16-1.16-1.x86_64@available solvable:filelist /f16/doc-locale-icons-plugins-alpha-beta-gamma-delta-lib-share-doc-locale-icons-plugins-alpha-beta-gamma-delta-lib-share-doc-locale-icons-plugins-alpha-beta656.so
+attr f16-1.16-1.x86_64@available solvable:filelist /f16/doc-locale-icons-plugins-alpha-beta-gamma-delta-lib-share-doc-locale-icons-plugins-alpha-beta-gamma-delta-lib-share-doc-locale-icons-plugins666.png
+attr f16-1.16-1.x86_64@available solvable:filelist /f16/gamma-delta-lib-share-doc-locale-icons-plugins-alpha-beta-gamma-delta-lib-share-doc-locale-icons-plugins-alpha-beta-gamma-delta-lib-share-doc-locale-icons-plugins652.so
+attr f16-1.16-1.x86_64@available solvable:filelist /f16/gamma-delta-lib-share-doc-locale-icons-plugins-alpha-beta-gamma-delta-lib-share-doc-locale-icons-plugins-alpha-beta-gamma-delta-lib-share-doc-locale662.png
+attr f16-1.16-1.x86_64@available solvable:filelist /f16/gamma-delta-lib-share-doc-locale-icons-plugins-alpha-beta-gamma-delta-lib-share-doc-locale-icons-plugins-alpha-beta-gamma-delta-lib-share642.png
+attr f16-1.16-1.x86_64@available solvable:filelist /f16/gamma-delta-lib-share-doc-locale-icons-plugins-alpha-beta-gamma-delta-lib-share-doc-locale-icons-plugins-alpha-beta-gamma-delta-lib-share672.so
+attr f16-1.16-1.x86_64@available solvable:filelist /f16/icons-plugins-alpha-beta-gamma-delta-lib-share-doc-locale-icons-plugins-alpha-beta-gamma-delta-lib-share-doc-locale-icons-plugins-alpha-beta-gamma-delta-lib-share658.png
+attr f16-1.16-1.x86_64@available solvable:filelist /f16/icons-plugins-alpha-beta-gamma-delta-lib-share-doc-locale-icons-plugins-alpha-beta-gamma-delta-lib-share-doc-locale-icons-plugins-alpha-beta-gamma-delta668.so
+attr f16-1.16-1.x86_64@available solvable:filelist /f16/icons-plugins-alpha-beta-gamma-delta-lib-share-doc-locale-icons-plugins-alpha-beta-gamma-delta-lib-share-doc-locale-icons-plugins-alpha-beta648.so
+attr f16-1.16-1.x86_64@available solvable:filelist /f16/icons-plugins-alpha-beta-gamma-delta-lib-share-doc-locale-icons-plugins-alpha-beta-gamma-delta-lib-share-doc-locale-icons-plugins-alpha-beta678.png
+attr f16-1.16-1.x86_64@available solvable:filelist /f16/lib-share-doc-locale-icons-plugins-alpha-beta-gamma-delta-lib-share-doc-locale-icons-plugins-alpha-beta-gamma-delta-lib-share-doc-locale-icons-plugins-alpha-beta664.so
+attr f16-1.16-1.x86_64@available solvable:filelist /f16/lib-share-doc-locale-icons-plugins-alpha-beta-gamma-delta-lib-share-doc-locale-icons-plugins-alpha-beta-gamma-delta-lib-share-doc-locale-icons-plugins644.so
+attr f16-1.16-1.x86_64@available solvable:filelist /f16/lib-share-doc-locale-icons-plugins-alpha-beta-gamma-delta-lib-share-doc-locale-icons-plugins-alpha-beta-gamma-delta-lib-share-doc-locale-icons-plugins674.png
+attr f16-1.16-1.x86_64@available solvable:filelist /f16/lib-share-doc-locale-icons-plugins-alpha-beta-gamma-delta-lib-share-doc-locale-icons-plugins-alpha-beta-gamma-delta-lib-share-doc-locale654.png
+attr f16-1.16-1.x86_64@available solvable:filelist /f16/locale-icons-plugins-alpha-beta-gamma-delta-lib-share-doc-locale-icons-plugins-alpha-beta-gamma-delta-lib-share-doc-locale-icons-plugins-alpha-beta-gamma-delta-lib-share647.mo
+attr f16-1.16-1.x86_64@available solvable:filelist /f16/locale-icons-plugins-alpha-beta-gamma-delta-lib-share-doc-locale-icons-plugins-alpha-beta-gamma-delta-lib-share-doc-locale-icons-plugins-alpha-beta-gamma-delta-lib-share677.txt
+attr f16-1.16-1.x86_64@available solvable:filelist /f16/locale-icons-plugins-alpha-beta-gamma-delta-lib-share-doc-locale-icons-plugins-alpha-beta-gamma-delta-lib-share-doc-locale-icons-plugins-alpha-beta-gamma-delta657.txt
+attr f16-1.16-1.x86_64@available solvable:filelist /f16/locale-icons-plugins-alpha-beta-gamma-delta-lib-share-doc-locale-icons-plugins-alpha-beta-gamma-delta-lib-share-doc-locale-icons-plugins-alpha-beta667.mo
+attr f16-1.16-1.x86_64@available solvable:filelist /f16/plugins-alpha-beta-gamma-delta-lib-share-doc-locale-icons-plugins-alpha-beta-gamma-delta-lib-share-doc-locale-icons-plugins-alpha-beta-gamma-delta-lib-share-doc-locale659.mo
+attr f16-1.16-1.x86_64@available solvable:filelist /f16/plugins-alpha-beta-gamma-delta-lib-share-doc-locale-icons-plugins-alpha-beta-gamma-delta-lib-share-doc-locale-icons-plugins-alpha-beta-gamma-delta-lib-share669.txt
+attr f16-1.16-1.x86_64@available solvable:filelist /f16/plugins-alpha-beta-gamma-delta-lib-share-doc-locale-icons-plugins-alpha-beta-gamma-delta-lib-share-doc-locale-icons-plugins-alpha-beta-gamma-delta649.txt
+attr f16-1.16-1.x86_64@available solvable:filelist /f16/plugins-alpha-beta-gamma-delta-lib-share-doc-locale-icons-plugins-alpha-beta-gamma-delta-lib-share-doc-locale-icons-plugins-alpha-beta-gamma-delta679.mo
+attr f16-1.16-1.x86_64@available solvable:filelist /f16/share-doc-locale-icons-plugins-alpha-beta-gamma-delta-lib-share-doc-locale-icons-plugins-alpha-beta-gamma-delta-lib-share-doc-locale-icons-plugins-alpha-beta-gamma-delta665.txt
+attr f16-1.16-1.x86_64@available solvable:filelist /f16/share-doc-locale-icons-plugins-alpha-beta-gamma-delta-lib-share-doc-locale-icons-plugins-alpha-beta-gamma-delta-lib-share-doc-locale-icons-plugins-alpha-beta645.txt
+attr f16-1.16-1.x86_64@available solvable:filelist /f16/share-doc-locale-icons-plugins-alpha-beta-gamma-delta-lib-share-doc-locale-icons-plugins-alpha-beta-gamma-delta-lib-share-doc-locale-icons-plugins-alpha-beta675.mo
+attr f16-1.16-1.x86_64@available solvable:filelist /f16/share-doc-locale-icons-plugins-alpha-beta-gamma-delta-lib-share-doc-locale-icons-plugins-alpha-beta-gamma-delta-lib-share-doc-locale-icons-plugins655.mo
+attr f16-1.16-1.x86_64@available solvable:name f16
+attr f16-1.16-1.x86_64@available solvable:summary files package 16
+attr f17-1.17-1.x86_64@available solvable:arch x86_64
+attr f17-1.17-1.x86_64@available solvable:evr 1.17-1
+attr f17-1.17-1.x86_64@available solvable:filelist /f17/alpha-beta-gamma-delta-lib-share-doc-locale-icons-plugins-alpha-beta-gamma-delta-lib-share-doc-locale-icons-plugins-alpha-beta-gamma-delta-lib-share-doc-locale700.so
+attr f17-1.17-1.x86_64@available solvable:filelist /f17/alpha-beta-gamma-delta-lib-share-doc-locale-icons-plugins-alpha-beta-gamma-delta-lib-share-doc-locale-icons-plugins-alpha-beta-gamma-delta-lib-share680.so
+attr f17-1.17-1.x86_64@available solvable:filelist /f17/alpha-beta-gamma-delta-lib-share-doc-locale-icons-plugins-alpha-beta-gamma-delta-lib-share-doc-locale-icons-plugins-alpha-beta-gamma-delta-lib-share710.png
+attr f17-1.17-1.x86_64@available solvable:filelist /f17/alpha-beta-gamma-delta-lib-share-doc-locale-icons-plugins-alpha-beta-gamma-delta-lib-share-doc-locale-icons-plugins-alpha-beta-gamma-delta690.png
+attr f17-1.17-1.x86_64@available solvable:filelist /f17/beta-gamma-delta-lib-share-doc-locale-icons-plugins-alpha-beta-gamma-delta-lib-share-doc-locale-icons-plugins-alpha-beta-gamma-delta-lib-share-doc-locale-icons-plugins701.txt
+attr f17-1.17-1.x86_64@available solvable:filelist /f17/beta-gamma-delta-lib-share-doc-locale-icons-plugins-alpha-beta-gamma-delta-lib-share-doc-locale-icons-plugins-alpha-beta-gamma-delta-lib-share-doc-locale681.txt
+attr f17-1.17-1.x86_64@available solvable:filelist /f17/beta-gamma-delta-lib-share-doc-locale-icons-plugins-alpha-beta-gamma-delta-lib-share-doc-locale-icons-plugins-alpha-beta-gamma-delta-lib-share-doc-locale711.mo
+attr f17-1.17-1.x86_64@available solvable:filelist /f17/beta-gamma-delta-lib-share-doc-locale-icons-plugins-alpha-beta-gamma-delta-lib-share-doc-locale-icons-plugins-alpha-beta-gamma-delta-lib-share691.mo
+attr f17-1.17-1.x86_64@available solvable:filelist /f17/delta-lib-share-doc-locale-icons-plugins-alpha-beta-gamma-delta-lib-share-doc-locale-icons-plugins-alpha-beta-gamma-delta-lib-share-doc-locale-icons-plugins-alpha-beta683.mo
+attr f17-1.17-1.x86_64@available solvable:filelist /f17/delta-lib-share-doc-locale-icons-plugins-alpha-beta-gamma-delta-lib-share-doc-locale-icons-plugins-alpha-beta-gamma-delta-lib-share-doc-locale-icons-plugins-alpha-beta713.txt
+attr f17-1.17-1.x86_64@available solvable:filelist /f17/delta-lib-share-doc-locale-icons-plugins-alpha-beta-gamma-delta-lib-share-doc-locale-icons-plugins-alpha-beta-gamma-delta-lib-share-doc-locale-icons-plugins693.txt
+attr f17-1.17-1.x86_64@available solvable:filelist /f17/delta-lib-share-doc-locale-icons-plugins-alpha-beta-gamma-delta-lib-share-doc-locale-icons-plugins-alpha-beta-gamma-delta-lib-share-doc-locale703.mo
+attr f17-1.17-1.x86_64@available solvable:filelist /f17/doc-locale-icons-plugins-alpha-beta-gamma-delta-lib-share-doc-locale-icons-plugins-alpha-beta-gamma-delta-lib-share-doc-locale-icons-plugins-alpha-beta-gamma-delta706.png
+attr f17-1.17-1.x86_64@available solvable:filelist /f17/doc-locale-icons-plugins-alpha-beta-gamma-delta-lib-share-doc-locale-icons-plugins-alpha-beta-gamma-delta-lib-share-doc-locale-icons-plugins-alpha-beta686.png
+attr f17-1.17-1.x86_64@available solvable:filelist /f17/doc-locale-icons-plugins-alpha-beta-gamma-delta-lib-share-doc-locale-icons-plugins-alpha-beta-gamma-delta-lib-share-doc-locale-icons-plugins-alpha-beta716.so
+attr f17-1.17-1.x86_64@available solvable:filelist /f17/doc-locale-icons-plugins-alpha-beta-gamma-delta-lib-share-doc-locale-icons-plugins-alpha-beta-gamma-delta-lib-share-doc-locale-icons-plugins696.so
+attr f17-1.17-1.x86_64@available solvable:filelist /f17/gamma-delta-lib-share-doc-locale-icons-plugins-alpha-beta-gamma-delta-lib-share-doc-locale-icons-plugins-alpha-beta-gamma-delta-lib-share-doc-locale-icons-plugins682.png
+attr f17-1.17-1.x86_64@available solvable:filelist /f17/gamma-delta-lib-share-doc-locale-icons-plugins-alpha-beta-gamma-delta-lib-share-doc-locale-icons-plugins-alpha-beta-gamma-delta-lib-share-doc-locale-icons-plugins712.so
+attr f17-1.17-1.x86_64@available solvable:filelist /f17/gamma-delta-lib-share-doc-locale-icons-plugins-alpha-beta-gamma-delta-lib-share-doc-locale-icons-plugins-alpha-beta-gamma-delta-lib-share-doc-locale692.so
+attr f17-1.17-1.x86_64@available solvable:filelist /f17/gamma-delta-lib-share-doc-locale-icons-plugins-alpha-beta-gamma-delta-lib-share-doc-locale-icons-plugins-alpha-beta-gamma-delta-lib-share702.png
+attr f17-1.17-1.x86_64@available solvable:filelist /f17/icons-plugins-alpha-beta-gamma-delta-lib-share-doc-locale-icons-plugins-alpha-beta-gamma-delta-lib-share-doc-locale-icons-plugins-alpha-beta-gamma-delta-lib-share688.so
+attr f17-1.17-1.x86_64@available solvable:filelist /f17/icons-plugins-alpha-beta-gamma-delta-lib-share-doc-locale-icons-plugins-alpha-beta-gamma-delta-lib-share-doc-locale-icons-plugins-alpha-beta-gamma-delta-lib-share718.png
+attr f17-1.17-1.x86_64@available solvable:filelist /f17/icons-plugins-alpha-beta-gamma-delta-lib-share-doc-locale-icons-plugins-alpha-beta-gamma-delta-lib-share-doc-locale-icons-plugins-alpha-beta-gamma-delta698.png
+attr f17-1.17-1.x86_64@available solvable:filelist /f17/icons-plugins-alpha-beta-gamma-delta-lib-share-doc-locale-icons-plugins-alpha-beta-gamma-delta-lib-share-doc-locale-icons-plugins-alpha-beta708.so
+attr f17-1.17-1.x86_64@available solvable:filelist /f17/lib-share-doc-locale-icons-plugins-alpha-beta-gamma-delta-lib-share-doc-locale-icons-plugins-alpha-beta-gamma-delta-lib-share-doc-locale-icons-plugins-alpha-beta694.png
+attr f17-1.17-1.x86_64@available solvable:filelist /f17/lib-share-doc-locale-icons-plugins-alpha-beta-gamma-delta-lib-share-doc-locale-icons-plugins-alpha-beta-gamma-delta-lib-share-doc-locale-icons-plugins704.so
+attr f17-1.17-1.x86_64@available solvable:filelist /f17/lib-share-doc-locale-icons-plugins-alpha-beta-gamma-delta-lib-share-doc-locale-icons-plugins-alpha-beta-gamma-delta-lib-share-doc-locale684.so
+attr f17-1.17-1.x86_64@available solvable:filelist /f17/lib-share-doc-locale-icons-plugins-alpha-beta-gamma-delta-lib-share-doc-locale-icons-plugins-alpha-beta-gamma-delta-lib-share-doc-locale714.png
+attr f17-1.17-1.x86_64@available solvable:filelist /f17/locale-icons-plugins-alpha-beta-gamma-delta-lib-share-doc-locale-icons-plugins-alpha-beta-gamma-delta-lib-share-doc-locale-icons-plugins-alpha-beta-gamma-delta-lib-share707.mo
+attr f17-1.17-1.x86_64@available solvable:filelist /f17/locale-icons-plugins-alpha-beta-gamma-delta-lib-share-doc-locale-icons-plugins-alpha-beta-gamma-delta-lib-share-doc-locale-icons-plugins-alpha-beta-gamma-delta687.mo
+attr f17-1.17-1.x86_64@available solvable:filelist /f17/locale-icons-plugins-alpha-beta-gamma-delta-lib-share-doc-locale-icons-plugins-alpha-beta-gamma-delta-lib-share-doc-locale-icons-plugins-alpha-beta-gamma-delta717.txt
+attr f17-1.17-1.x86_64@available solvable:filelist /f17/locale-icons-plugins-alpha-beta-gamma-delta-lib-share-doc-locale-icons-plugins-alpha-beta-gamma-delta-lib-share-doc-locale-icons-plugins-alpha-beta697.txt
+attr f17-1.17-1.x86_64@available solvable:filelist /f17/plugins-alpha-beta-gamma-delta-lib-share-doc-locale-icons-plugins-alpha-beta-gamma-delta-lib-share-doc-locale-icons-plugins-alpha-beta-gamma-delta-lib-share-doc-locale689.txt
+attr f17-1.17-1.x86_64@available solvable:filelist /f17/plugins-alpha-beta-gamma-delta-lib-share-doc-locale-icons-plugins-alpha-beta-gamma-delta-lib-share-doc-locale-icons-plugins-alpha-beta-gamma-delta-lib-share-doc-locale719.mo
+attr f17-1.17-1.x86_64@available solvable:filelist /f17/plugins-alpha-beta-gamma-delta-lib-share-doc-locale-icons-plugins-alpha-beta-gamma-delta-lib-share-doc-locale-icons-plugins-alpha-beta-gamma-delta-lib-share699.mo
+attr f17-1.17-1.x86_64@available solvable:filelist /f17/plugins-alpha-beta-gamma-delta-lib-share-doc-locale-icons-plugins-alpha-beta-gamma-delta-lib-share-doc-locale-icons-plugins-alpha-beta-gamma-delta709.txt
+attr f17-1.17-1.x86_64@available solvable:filelist /f17/share-doc-locale-icons-plugins-alpha-beta-gamma-delta-lib-share-doc-locale-icons-plugins-alpha-beta-gamma-delta-lib-share-doc-locale-icons-plugins-alpha-beta-gamma-delta695.mo
+attr f17-1.17-1.x86_64@available solvable:filelist /f17/share-doc-locale-icons-plugins-alpha-beta-gamma-delta-lib-share-doc-locale-icons-plugins-alpha-beta-gamma-delta-lib-share-doc-locale-icons-plugins-alpha-beta705.txt
+attr f17-1.17-1.x86_64@available solvable:filelist /f17/share-doc-locale-icons-plugins-alpha-beta-gamma-delta-lib-share-doc-locale-icons-plugins-alpha-beta-gamma-delta-lib-share-doc-locale-icons-plugins685.txt
+attr f17-1.17-1.x86_64@available solvable:filelist /f17/share-doc-locale-icons-plugins-alpha-beta-gamma-delta-lib-share-doc-locale-icons-plugins-alpha-beta-gamma-delta-lib-share-doc-locale-icons-plugins715.mo
+attr f17-1.17-1.x86_64@available solvable:name f17
+attr f17-1.17-1.x86_64@available solvable:summary files package 17
+attr f18-1.18-1.x86_64@available solvable:arch x86_64
+attr f18-1.18-1.x86_64@available solvable:evr 1.18-1
+attr f18-1.18-1.x86_64@available solvable:filelist /f18/alpha-beta-gamma-delta-lib-share-doc-locale-icons-plugins-alpha-beta-gamma-delta-lib-share-doc-locale-icons-plugins-alpha-beta-gamma-delta-lib-share-doc-locale730.png
+attr f18-1.18-1.x86_64@available solvable:filelist /f18/alpha-beta-gamma-delta-lib-share-doc-locale-icons-plugins-alpha-beta-gamma-delta-lib-share-doc-locale-icons-plugins-alpha-beta-gamma-delta-lib-share740.so
+attr f18-1.18-1.x86_64@available solvable:filelist /f18/alpha-beta-gamma-delta-lib-share-doc-locale-icons-plugins-alpha-beta-gamma-delta-lib-share-doc-locale-icons-plugins-alpha-beta-gamma-delta720.so
+attr f18-1.18-1.x86_64@available solvable:filelist /f18/alpha-beta-gamma-delta-lib-share-doc-locale-icons-plugins-alpha-beta-gamma-delta-lib-share-doc-locale-icons-plugins-alpha-beta-gamma-delta750.png
+attr f18-1.18-1.x86_64@available solvable:filelist /f18/beta-gamma-delta-lib-share-doc-locale-icons-plugins-alpha-beta-gamma-delta-lib-share-doc-locale-icons-plugins-alpha-beta-gamma-delta-lib-share-doc-locale-icons-plugins731.mo
+attr f18-1.18-1.x86_64@available solvable:filelist /f18/beta-gamma-delta-lib-share-doc-locale-icons-plugins-alpha-beta-gamma-delta-lib-share-doc-locale-icons-plugins-alpha-beta-gamma-delta-lib-share-doc-locale741.txt
+attr f18-1.18-1.x86_64@available solvable:filelist /f18/beta-gamma-delta-lib-share-doc-locale-icons-plugins-alpha-beta-gamma-delta-lib-share-doc-locale-icons-plugins-alpha-beta-gamma-delta-lib-share721.txt
+attr f18-1.18-1.x86_64@available solvable:filelist /f18/beta-gamma-delta-lib-share-doc-locale-icons-plugins-alpha-beta-gamma-delta-lib-share-doc-locale-icons-plugins-alpha-beta-gamma-delta-lib-share751.mo
+attr f18-1.18-1.x86_64@available solvable:filelist /f18/delta-lib-share-doc-locale-icons-plugins-alpha-beta-gamma-delta-lib-share-doc-locale-icons-plugins-alpha-beta-gamma-delta-lib-share-doc-locale-icons-plugins-alpha-beta743.mo
+attr f18-1.18-1.x86_64@available solvable:filelist /f18/delta-lib-share-doc-locale-icons-plugins-alpha-beta-gamma-delta-lib-share-doc-locale-icons-plugins-alpha-beta-gamma-delta-lib-share-doc-locale-icons-plugins723.mo
+attr f18-1.18-1.x86_64@available solvable:filelist /f18/delta-lib-share-doc-locale-icons-plugins-alpha-beta-gamma-delta-lib-share-doc-locale-icons-plugins-alpha-beta-gamma-delta-lib-share-doc-locale-icons-plugins753.txt
+attr f18-1.18-1.x86_64@available solvable:filelist /f18/delta-lib-share-doc-locale-icons-plugins-alpha-beta-gamma-delta-lib-share-doc-locale-icons-plugins-alpha-beta-gamma-delta-lib-share-doc-locale733.txt
+attr f18-1.18-1.x86_64@available solvable:filelist /f18/doc-locale-icons-plugins-alpha-beta-gamma-delta-lib-share-doc-locale-icons-plugins-alpha-beta-gamma-delta-lib-share-doc-locale-icons-plugins-alpha-beta-gamma-delta736.so
+attr f18-1.18-1.x86_64@available solvable:filelist /f18/doc-locale-icons-plugins-alpha-beta-gamma-delta-lib-share-doc-locale-icons-plugins-alpha-beta-gamma-delta-lib-share-doc-locale-icons-plugins-alpha-beta746.png
+attr f18-1.18-1.x86_64@available solvable:filelist /f18/doc-locale-icons-plugins-alpha-beta-gamma-delta-lib-share-doc-locale-icons-plugins-alpha-beta-gamma-delta-lib-share-doc-locale-icons-plugins726.png
+attr f18-1.18-1.x86_64@available solvable:filelist /f18/doc-locale-icons-plugins-alpha-beta-gamma-delta-lib-share-doc-locale-icons-plugins-alpha-beta-gamma-delta-lib-share-doc-locale-icons-plugins756.so
+attr f18-1.18-1.x86_64@available solvable:filelist /f18/gamma-delta-lib-share-doc-locale-icons-plugins-alpha-beta-gamma-delta-lib-share-doc-locale-icons-plugins-alpha-beta-gamma-delta-lib-share-doc-locale-icons-plugins742.png
+attr f18-1.18-1.x86_64@available solvable:filelist /f18/gamma-delta-lib-share-doc-locale-icons-plugins-alpha-beta-gamma-delta-lib-share-doc-locale-icons-plugins-alpha-beta-gamma-delta-lib-share-doc-locale722.png
+attr f18-1.18-1.x86_64@available solvable:filelist /f18/gamma-delta-lib-share-doc-locale-icons-plugins-alpha-beta-gamma-delta-lib-share-doc-locale-icons-plugins-alpha-beta-gamma-delta-lib-share-doc-locale752.so
+attr f18-1.18-1.x86_64@available solvable:filelist /f18/gamma-delta-lib-share-doc-locale-icons-plugins-alpha-beta-gamma-delta-lib-share-doc-locale-icons-plugins-alpha-beta-gamma-delta-lib-share732.so
+attr f18-1.18-1.x86_64@available solvable:filelist /f18/icons-plugins-alpha-beta-gamma-delta-lib-share-doc-locale-icons-plugins-alpha-beta-gamma-delta-lib-share-doc-locale-icons-plugins-alpha-beta-gamma-delta-lib-share748.so
+attr f18-1.18-1.x86_64@available solvable:filelist /f18/icons-plugins-alpha-beta-gamma-delta-lib-share-doc-locale-icons-plugins-alpha-beta-gamma-delta-lib-share-doc-locale-icons-plugins-alpha-beta-gamma-delta728.so
+attr f18-1.18-1.x86_64@available solvable:filelist /f18/icons-plugins-alpha-beta-gamma-delta-lib-share-doc-locale-icons-plugins-alpha-beta-gamma-delta-lib-share-doc-locale-icons-plugins-alpha-beta-gamma-delta758.png
+attr f18-1.18-1.x86_64@available solvable:filelist /f18/icons-plugins-alpha-beta-gamma-delta-lib-share-doc-locale-icons-plugins-alpha-beta-gamma-delta-lib-share-doc-locale-icons-plugins-alpha-beta738.png
+attr f18-1.18-1.x86_64@available solvable:filelist /f18/lib-share-doc-locale-icons-plugins-alpha-beta-gamma-delta-lib-share-doc-locale-icons-plugins-alpha-beta-gamma-delta-lib-share-doc-locale-icons-plugins-alpha-beta724.so
+attr f18-1.18-1.x86_64@available solvable:filelist /f18/lib-share-doc-locale-icons-plugins-alpha-beta-gamma-delta-lib-share-doc-locale-icons-plugins-alpha-beta-gamma-delta-lib-share-doc-locale-icons-plugins-alpha-beta754.png
+attr f18-1.18-1.x86_64@available solvable:filelist /f18/lib-share-doc-locale-icons-plugins-alpha-beta-gamma-delta-lib-share-doc-locale-icons-plugins-alpha-beta-gamma-delta-lib-share-doc-locale-icons-plugins734.png
+attr f18-1.18-1.x86_64@available solvable:filelist /f18/lib-share-doc-locale-icons-plugins-alpha-beta-gamma-delta-lib-share-doc-locale-icons-plugins-alpha-beta-gamma-delta-lib-share-doc-locale744.so
+attr f18-1.18-1.x86_64@available solvable:filelist /f18/locale-icons-plugins-alpha-beta-gamma-delta-lib-share-doc-locale-icons-plugins-alpha-beta-gamma-delta-lib-share-doc-locale-icons-plugins-alpha-beta-gamma-delta-lib-share737.txt
+attr f18-1.18-1.x86_64@available solvable:filelist /f18/locale-icons-plugins-alpha-beta-gamma-delta-lib-share-doc-locale-icons-plugins-alpha-beta-gamma-delta-lib-share-doc-locale-icons-plugins-alpha-beta-gamma-delta747.mo
+attr f18-1.18-1.x86_64@available solvable:filelist /f18/locale-icons-plugins-alpha-beta-gamma-delta-lib-share-doc-locale-icons-plugins-alpha-beta-gamma-delta-lib-share-doc-locale-icons-plugins-alpha-beta727.mo
+attr f18-1.18-1.x86_64@available solvable:filelist /f18/locale-icons-plugins-alpha-beta-gamma-delta-lib-share-doc-locale-icons-plugins-alpha-beta-gamma-delta-lib-share-doc-locale-icons-plugins-alpha-beta757.txt
+attr f18-1.18-1.x86_64@available solvable:filelist /f18/plugins-alpha-beta-gamma-delta-lib-share-doc-locale-icons-plugins-alpha-beta-gamma-delta-lib-share-doc-locale-icons-plugins-alpha-beta-gamma-delta-lib-share-doc-locale749.txt
+attr f18-1.18-1.x86_64@available solvable:filelist /f18/plugins-alpha-beta-gamma-delta-lib-share-doc-locale-icons-plugins-alpha-beta-gamma-delta-lib-share-doc-locale-icons-plugins-alpha-beta-gamma-delta-lib-share729.txt
+attr f18-1.18-1.x86_64@available solvable:filelist /f18/plugins-alpha-beta-gamma-delta-lib-share-doc-locale-icons-plugins-alpha-beta-gamma-delta-lib-share-doc-locale-icons-plugins-alpha-beta-gamma-delta-lib-share759.mo
+attr f18-1.18-1.x86_64@available solvable:filelist /f18/plugins-alpha-beta-gamma-delta-lib-share-doc-locale-icons-plugins-alpha-beta-gamma-delta-lib-share-doc-locale-icons-plugins-alpha-beta-gamma-delta739.mo
+attr f18-1.18-1.x86_64@available solvable:filelist /f18/share-doc-locale-icons-plugins-alpha-beta-gamma-delta-lib-share-doc-locale-icons-plugins-alpha-beta-gamma-delta-lib-share-doc-locale-icons-plugins-alpha-beta-gamma-delta725.txt
+attr f18-1.18-1.x86_64@available solvable:filelist /f18/share-doc-locale-icons-plugins-alpha-beta-gamma-delta-lib-share-doc-locale-icons-plugins-alpha-beta-gamma-delta-lib-share-doc-locale-icons-plugins-alpha-beta-gamma-delta755.mo
+attr f18-1.18-1.x86_64@available solvable:filelist /f18/share-doc-locale-icons-plugins-alpha-beta-gamma-delta-lib-share-doc-locale-icons-plugins-alpha-beta-gamma-delta-lib-share-doc-locale-icons-plugins-alpha-beta735.mo
+attr f18-1.18-1.x86_64@available solvable:filelist /f18/share-doc-locale-icons-plugins-alpha-beta-gamma-delta-lib-share-doc-locale-icons-plugins-alpha-beta-gamma-delta-lib-share-doc-locale-icons-plugins745.txt
+attr f18-1.18-1.x86_64@available solvable:name f18
+attr f18-1.18-1.x86_64@available solvable:summary files package 18
+attr f19-1.19-1.x86_64@available solvable:arch x86_64
+attr f19-1.19-1.x86_64@available solvable:evr 1.19-1
+attr f19-1.19-1.x86_64@available solvable:filelist /f19/alpha-beta-gamma-delta-lib-share-doc-locale-icons-plugins-alpha-beta-gamma-delta-lib-share-doc-locale-icons-plugins-alpha-beta-gamma-delta-lib-share-doc-locale760.so
+attr f19-1.19-1.x86_64@available solvable:filelist /f19/alpha-beta-gamma-delta-lib-share-doc-locale-icons-plugins-alpha-beta-gamma-delta-lib-share-doc-locale-icons-plugins-alpha-beta-gamma-delta-lib-share-doc-locale790.png
+attr f19-1.19-1.x86_64@available solvable:filelist /f19/alpha-beta-gamma-delta-lib-share-doc-locale-icons-plugins-alpha-beta-gamma-delta-lib-share-doc-locale-icons-plugins-alpha-beta-gamma-delta-lib-share770.png
+attr f19-1.19-1.x86_64@available solvable:filelist /f19/alpha-beta-gamma-delta-lib-share-doc-locale-icons-plugins-alpha-beta-gamma-delta-lib-share-doc-locale-icons-plugins-alpha-beta-gamma-delta780.so
+attr f19-1.19-1.x86_64@available solvable:filelist /f19/beta-gamma-delta-lib-share-doc-locale-icons-plugins-alpha-beta-gamma-delta-lib-share-doc-locale-icons-plugins-alpha-beta-gamma-delta-lib-share-doc-locale-icons-plugins761.txt
+attr f19-1.19-1.x86_64@available solvable:filelist /f19/beta-gamma-delta-lib-share-doc-locale-icons-plugins-alpha-beta-gamma-delta-lib-share-doc-locale-icons-plugins-alpha-beta-gamma-delta-lib-share-doc-locale-icons-plugins791.mo
+attr f19-1.19-1.x86_64@available solvable:filelist /f19/beta-gamma-delta-lib-share-doc-locale-icons-plugins-alpha-beta-gamma-delta-lib-share-doc-locale-icons-plugins-alpha-beta-gamma-delta-lib-share-doc-locale771.mo
+attr f19-1.19-1.x86_64@available solvable:filelist /f19/beta-gamma-delta-lib-share-doc-locale-icons-plugins-alpha-beta-gamma-delta-lib-share-doc-locale-icons-plugins-alpha-beta-gamma-delta-lib-share781.txt
+attr f19-1.19-1.x86_64@available solvable:filelist /f19/delta-lib-share-doc-locale-icons-plugins-alpha-beta-gamma-delta-lib-share-doc-locale-icons-plugins-alpha-beta-gamma-delta-lib-share-doc-locale-icons-plugins-alpha-beta773.txt
+attr f19-1.19-1.x86_64@available solvable:filelist /f19/delta-lib-share-doc-locale-icons-plugins-alpha-beta-gamma-delta-lib-share-doc-locale-icons-plugins-alpha-beta-gamma-delta-lib-share-doc-locale-icons-plugins783.mo
+attr f19-1.19-1.x86_64@available solvable:filelist /f19/delta-lib-share-doc-locale-icons-plugins-alpha-beta-gamma-delta-lib-share-doc-locale-icons-plugins-alpha-beta-gamma-delta-lib-share-doc-locale763.mo
+attr f19-1.19-1.x86_64@available solvable:filelist /f19/delta-lib-share-doc-locale-icons-plugins-alpha-beta-gamma-delta-lib-share-doc-locale-icons-plugins-alpha-beta-gamma-delta-lib-share-doc-locale793.txt
+attr f19-1.19-1.x86_64@available solvable:filelist /f19/doc-locale-icons-plugins-alpha-beta-gamma-delta-lib-share-doc-locale-icons-plugins-alpha-beta-gamma-delta-lib-share-doc-locale-icons-plugins-alpha-beta-gamma-delta766.png
+attr f19-1.19-1.x86_64@available solvable:filelist /f19/doc-locale-icons-plugins-alpha-beta-gamma-delta-lib-share-doc-locale-icons-plugins-alpha-beta-gamma-delta-lib-share-doc-locale-icons-plugins-alpha-beta-gamma-delta796.so
+attr f19-1.19-1.x86_64@available solvable:filelist /f19/doc-locale-icons-plugins-alpha-beta-gamma-delta-lib-share-doc-locale-icons-plugins-alpha-beta-gamma-delta-lib-share-doc-locale-icons-plugins-alpha-beta776.so
+attr f19-1.19-1.x86_64@available solvable:filelist /f19/doc-locale-icons-plugins-alpha-beta-gamma-delta-lib-share-doc-locale-icons-plugins-alpha-beta-gamma-delta-lib-share-doc-locale-icons-plugins786.png
+attr f19-1.19-1.x86_64@available solvable:filelist /f19/gamma-delta-lib-share-doc-locale-icons-plugins-alpha-beta-gamma-delta-lib-share-doc-locale-icons-plugins-alpha-beta-gamma-delta-lib-share-doc-locale-icons-plugins772.so
+attr f19-1.19-1.x86_64@available solvable:filelist /f19/gamma-delta-lib-share-doc-locale-icons-plugins-alpha-beta-gamma-delta-lib-share-doc-locale-icons-plugins-alpha-beta-gamma-delta-lib-share-doc-locale782.png
+attr f19-1.19-1.x86_64@available solvable:filelist /f19/gamma-delta-lib-share-doc-locale-icons-plugins-alpha-beta-gamma-delta-lib-share-doc-locale-icons-plugins-alpha-beta-gamma-delta-lib-share762.png
+attr f19-1.19-1.x86_64@available solvable:filelist /f19/gamma-delta-lib-share-doc-locale-icons-plugins-alpha-beta-gamma-delta-lib-share-doc-locale-icons-plugins-alpha-beta-gamma-delta-lib-share792.so
+attr f19-1.19-1.x86_64@available solvable:filelist /f19/icons-plugins-alpha-beta-gamma-delta-lib-share-doc-locale-icons-plugins-alpha-beta-gamma-delta-lib-share-doc-locale-icons-plugins-alpha-beta-gamma-delta-lib-share778.png
+attr f19-1.19-1.x86_64@available solvable:filelist /f19/icons-plugins-alpha-beta-gamma-delta-lib-share-doc-locale-icons-plugins-alpha-beta-gamma-delta-lib-share-doc-locale-icons-plugins-alpha-beta-gamma-delta788.so
+attr f19-1.19-1.x86_64@available solvable:filelist /f19/icons-plugins-alpha-beta-gamma-delta-lib-share-doc-locale-icons-plugins-alpha-beta-gamma-delta-lib-share-doc-locale-icons-plugins-alpha-beta768.so
+attr f19-1.19-1.x86_64@available solvable:filelist /f19/icons-plugins-alpha-beta-gamma-delta-lib-share-doc-locale-icons-plugins-alpha-beta-gamma-delta-lib-share-doc-locale-icons-plugins-alpha-beta798.png
+attr f19-1.19-1.x86_64@available solvable:filelist /f19/lib-share-doc-locale-icons-plugins-alpha-beta-gamma-delta-lib-share-doc-locale-icons-plugins-alpha-beta-gamma-delta-lib-share-doc-locale-icons-plugins-alpha-beta784.so
+attr f19-1.19-1.x86_64@available solvable:filelist /f19/lib-share-doc-locale-icons-plugins-alpha-beta-gamma-delta-lib-share-doc-locale-icons-plugins-alpha-beta-gamma-delta-lib-share-doc-locale-icons-plugins764.so
+attr f19-1.19-1.x86_64@available solvable:filelist /f19/lib-share-doc-locale-icons-plugins-alpha-beta-gamma-delta-lib-share-doc-locale-icons-plugins-alpha-beta-gamma-delta-lib-share-doc-locale-icons-plugins794.png
+attr f19-1.19-1.x86_64@available solvable:filelist /f19/lib-share-doc-locale-icons-plugins-alpha-beta-gamma-delta-lib-share-doc-locale-icons-plugins-alpha-beta-gamma-delta-lib-share-doc-locale774.png
+attr f19-1.19-1.x86_64@available solvable:filelist /f19/locale-icons-plugins-alpha-beta-gamma-delta-lib-share-doc-locale-icons-plugins-alpha-beta-gamma-delta-lib-share-doc-locale-icons-plugins-alpha-beta-gamma-delta-lib-share767.mo
+attr f19-1.19-1.x86_64@available solvable:filelist /f19/locale-icons-plugins-alpha-beta-gamma-delta-lib-share-doc-locale-icons-plugins-alpha-beta-gamma-delta-lib-share-doc-locale-icons-plugins-alpha-beta-gamma-delta-lib-share797.txt
+attr f19-1.19-1.x86_64@available solvable:filelist /f19/locale-icons-plugins-alpha-beta-gamma-delta-lib-share-doc-locale-icons-plugins-alpha-beta-gamma-delta-lib-share-doc-locale-icons-plugins-alpha-beta-gamma-delta777.txt
+attr f19-1.19-1.x86_64@available solvable:filelist /f19/locale-icons-plugins-alpha-beta-gamma-delta-lib-share-doc-locale-icons-plugins-alpha-beta-gamma-delta-lib-share-doc-locale-icons-plugins-alpha-beta787.mo
+attr f19-1.19-1.x86_64@available solvable:filelist /f19/plugins-alpha-beta-gamma-delta-lib-share-doc-locale-icons-plugins-alpha-beta-gamma-delta-lib-share-doc-locale-icons-plugins-alpha-beta-gamma-delta-lib-share-doc-locale779.mo
+attr f19-1.19-1.x86_64@available solvable:filelist /f19/plugins-alpha-beta-gamma-delta-lib-share-doc-locale-icons-plugins-alpha-beta-gamma-delta-lib-share-doc-locale-icons-plugins-alpha-beta-gamma-delta-lib-share789.txt
+attr f19-1.19-1.x86_64@available solvable:filelist /f19/plugins-alpha-beta-gamma-delta-lib-share-doc-locale-icons-plugins-alpha-beta-gamma-delta-lib-share-doc-locale-icons-plugins-alpha-beta-gamma-delta769.txt
+attr f19-1.19-1.x86_64@available solvable:filelist /f19/plugins-alpha-beta-gamma-delta-lib-share-doc-locale-icons-plugins-alpha-beta-gamma-delta-lib-share-doc-locale-icons-plugins-alpha-beta-gamma-delta799.mo
+attr f19-1.19-1.x86_64@available solvable:filelist /f19/share-doc-locale-icons-plugins-alpha-beta-gamma-delta-lib-share-doc-locale-icons-plugins-alpha-beta-gamma-delta-lib-share-doc-locale-icons-plugins-alpha-beta-gamma-delta785.txt
+attr f19-1.19-1.x86_64@available solvable:filelist /f19/share-doc-locale-icons-plugins-alpha-beta-gamma-delta-lib-share-doc-locale-icons-plugins-alpha-beta-gamma-delta-lib-share-doc-locale-icons-plugins-alpha-beta765.txt
+attr f19-1.19-1.x86_64@available solvable:filelist /f19/share-doc-locale-icons-plugins-alpha-beta-gamma-delta-lib-share-doc-locale-icons-plugins-alpha-beta-gamma-delta-lib-share-doc-locale-icons-plugins-alpha-beta795.mo
+attr f19-1.19-1.x86_64@available solvable:filelist /f19/share-doc-locale-icons-plugins-alpha-beta-gamma-delta-lib-share-doc-locale-icons-plugins-alpha-beta-gamma-delta-lib-share-doc-locale-icons-plugins775.mo
+attr f19-1.19-1.x86_64@available solvable:name f19
+attr f19-1.19-1.x86_64@available solvable:summary files package 19
+attr f2-1.2-1.x86_64@available solvable:arch x86_64
+attr f2-1.2-1.x86_64@available solvable:evr 1.2-1
+attr f2-1.2-1.x86_64@available solvable:filelist /f2/alpha-beta-gamma-delta-lib-share-doc-locale-icons-plugins-alpha-beta-gamma-delta-lib-share-doc-locale-icons-plugins-alpha-beta-gamma-delta-lib-share-doc-locale100.so
+attr f2-1.2-1.x86_64@available solvable:filelist /f2/alpha-beta-gamma-delta-lib-share-doc-locale-icons-plugins-alpha-beta-gamma-delta-lib-share-doc-locale-icons-plugins-alpha-beta-gamma-delta-lib-share110.png
+attr f2-1.2-1.x86_64@available solvable:filelist /f2/alpha-beta-gamma-delta-lib-share-doc-locale-icons-plugins-alpha-beta-gamma-delta-lib-share-doc-locale-icons-plugins-alpha-beta-gamma-delta-lib-share80.so
+attr f2-1.2-1.x86_64@available solvable:filelist /f2/alpha-beta-gamma-delta-lib-share-doc-locale-icons-plugins-alpha-beta-gamma-delta-lib-share-doc-locale-icons-plugins-alpha-beta-gamma-delta90.png
+attr f2-1.2-1.x86_64@available solvable:filelist /f2/beta-gamma-delta-lib-share-doc-locale-icons-plugins-alpha-beta-gamma-delta-lib-share-doc-locale-icons-plugins-alpha-beta-gamma-delta-lib-share-doc-locale-icons-plugins101.txt
+attr f2-1.2-1.x86_64@available solvable:filelist /f2/beta-gamma-delta-lib-share-doc-locale-icons-plugins-alpha-beta-gamma-delta-lib-share-doc-locale-icons-plugins-alpha-beta-gamma-delta-lib-share-doc-locale111.mo
+attr f2-1.2-1.x86_64@available solvable:filelist /f2/beta-gamma-delta-lib-share-doc-locale-icons-plugins-alpha-beta-gamma-delta-lib-share-doc-locale-icons-plugins-alpha-beta-gamma-delta-lib-share-doc-locale81.txt
+attr f2-1.2-1.x86_64@available solvable:filelist /f2/beta-gamma-delta-lib-share-doc-locale-icons-plugins-alpha-beta-gamma-delta-lib-share-doc-locale-icons-plugins-alpha-beta-gamma-delta-lib-share91.mo
+attr f2-1.2-1.x86_64@available solvable:filelist /f2/delta-lib-share-doc-locale-icons-plugins-alpha-beta-gamma-delta-lib-share-doc-locale-icons-plugins-alpha-beta-gamma-delta-lib-share-doc-locale-icons-plugins-alpha-beta113.txt
+attr f2-1.2-1.x86_64@available solvable:filelist /f2/delta-lib-share-doc-locale-icons-plugins-alpha-beta-gamma-delta-lib-share-doc-locale-icons-plugins-alpha-beta-gamma-delta-lib-share-doc-locale-icons-plugins-alpha-beta83.mo
+attr f2-1.2-1.x86_64@available solvable:filelist /f2/delta-lib-share-doc-locale-icons-plugins-alpha-beta-gamma-delta-lib-share-doc-locale-icons-plugins-alpha-beta-gamma-delta-lib-share-doc-locale-icons-plugins93.txt
+attr f2-1.2-1.x86_64@available solvable:filelist /f2/delta-lib-share-doc-locale-icons-plugins-alpha-beta-gamma-delta-lib-share-doc-locale-icons-plugins-alpha-beta-gamma-delta-lib-share-doc-locale103.mo
+attr f2-1.2-1.x86_64@available solvable:filelist /f2/doc-locale-icons-plugins-alpha-beta-gamma-delta-lib-share-doc-locale-icons-plugins-alpha-beta-gamma-delta-lib-share-doc-locale-icons-plugins-alpha-beta-gamma-delta106.png
+attr f2-1.2-1.x86_64@available solvable:filelist /f2/doc-locale-icons-plugins-alpha-beta-gamma-delta-lib-share-doc-locale-icons-plugins-alpha-beta-gamma-delta-lib-share-doc-locale-icons-plugins-alpha-beta116.so
+attr f2-1.2-1.x86_64@available solvable:filelist /f2/doc-locale-icons-plugins-alpha-beta-gamma-delta-lib-share-doc-locale-icons-plugins-alpha-beta-gamma-delta-lib-share-doc-locale-icons-plugins-alpha-beta86.png
+attr f2-1.2-1.x86_64@available solvable:filelist /f2/doc-locale-icons-plugins-alpha-beta-gamma-delta-lib-share-doc-locale-icons-plugins-alpha-beta-gamma-delta-lib-share-doc-locale-icons-plugins96.so
+attr f2-1.2-1.x86_64@available solvable:filelist /f2/gamma-delta-lib-share-doc-locale-icons-plugins-alpha-beta-gamma-delta-lib-share-doc-locale-icons-plugins-alpha-beta-gamma-delta-lib-share-doc-locale-icons-plugins112.so
+attr f2-1.2-1.x86_64@available solvable:filelist /f2/gamma-delta-lib-share-doc-locale-icons-plugins-alpha-beta-gamma-delta-lib-share-doc-locale-icons-plugins-alpha-beta-gamma-delta-lib-share-doc-locale-icons-plugins82.png
+attr f2-1.2-1.x86_64@available solvable:filelist /f2/gamma-delta-lib-share-doc-locale-icons-plugins-alpha-beta-gamma-delta-lib-share-doc-locale-icons-plugins-alpha-beta-gamma-delta-lib-share-doc-locale92.so
+attr f2-1.2-1.x86_64@available solvable:filelist /f2/gamma-delta-lib-share-doc-locale-icons-plugins-alpha-beta-gamma-delta-lib-share-doc-locale-icons-plugins-alpha-beta-gamma-delta-lib-share102.png
+attr f2-1.2-1.x86_64@available solvable:filelist /f2/icons-plugins-alpha-beta-gamma-delta-lib-share-doc-locale-icons-plugins-alpha-beta-gamma-delta-lib-share-doc-locale-icons-plugins-alpha-beta-gamma-delta-lib-share118.png
+attr f2-1.2-1.x86_64@available solvable:filelist /f2/icons-plugins-alpha-beta-gamma-delta-lib-share-doc-locale-icons-plugins-alpha-beta-gamma-delta-lib-share-doc-locale-icons-plugins-alpha-beta-gamma-delta-lib-share88.so
+attr f2-1.2-1.x86_64@available solvable:filelist /f2/icons-plugins-alpha-beta-gamma-delta-lib-share-doc-locale-icons-plugins-alpha-beta-gamma-delta-lib-share-doc-locale-icons-plugins-alpha-beta-gamma-delta98.png
+attr f2-1.2-1.x86_64@available solvable:filelist /f2/icons-plugins-alpha-beta-gamma-delta-lib-share-doc-locale-icons-plugins-alpha-beta-gamma-delta-lib-share-doc-locale-icons-plugins-alpha-beta108.so
+attr f2-1.2-1.x86_64@available solvable:filelist /f2/lib-share-doc-locale-icons-plugins-alpha-beta-gamma-delta-lib-share-doc-locale-icons-plugins-alpha-beta-gamma-delta-lib-share-doc-locale-icons-plugins-alpha-beta94.png
+attr f2-1.2-1.x86_64@available solvable:filelist /f2/lib-share-doc-locale-icons-plugins-alpha-beta-gamma-delta-lib-share-doc-locale-icons-plugins-alpha-beta-gamma-delta-lib-share-doc-locale-icons-plugins104.so
+attr f2-1.2-1.x86_64@available solvable:filelist /f2/lib-share-doc-locale-icons-plugins-alpha-beta-gamma-delta-lib-share-doc-locale-icons-plugins-alpha-beta-gamma-delta-lib-share-doc-locale114.png
+attr f2-1.2-1.x86_64@available solvable:filelist /f2/lib-share-doc-locale-icons-plugins-alpha-beta-gamma-delta-lib-share-doc-locale-icons-plugins-alpha-beta-gamma-delta-lib-share-doc-locale84.so
+attr f2-1.2-1.x86_64@available solvable:filelist /f2/locale-icons-plugins-alpha-beta-gamma-delta-lib-share-doc-locale-icons-plugins-alpha-beta-gamma-delta-lib-share-doc-locale-icons-plugins-alpha-beta-gamma-delta-lib-share107.mo
+attr f2-1.2-1.x86_64@available solvable:filelist /f2/locale-icons-plugins-alpha-beta-gamma-delta-lib-share-doc-locale-icons-plugins-alpha-beta-gamma-delta-lib-share-doc-locale-icons-plugins-alpha-beta-gamma-delta117.txt
+attr f2-1.2-1.x86_64@available solvable:filelist /f2/locale-icons-plugins-alpha-beta-gamma-delta-lib-share-doc-locale-icons-plugins-alpha-beta-gamma-delta-lib-share-doc-locale-icons-plugins-alpha-beta-gamma-delta87.mo
+attr f2-1.2-1.x86_64@available solvable:filelist /f2/locale-icons-plugins-alpha-beta-gamma-delta-lib-share-doc-locale-icons-plugins-alpha-beta-gamma-delta-lib-share-doc-locale-icons-plugins-alpha-beta97.txt
+attr f2-1.2-1.x86_64@available solvable:filelist /f2/plugins-alpha-beta-gamma-delta-lib-share-doc-locale-icons-plugins-alpha-beta-gamma-delta-lib-share-doc-locale-icons-plugins-alpha-beta-gamma-delta-lib-share-doc-locale119.mo
+attr f2-1.2-1.x86_64@available solvable:filelist /f2/plugins-alpha-beta-gamma-delta-lib-share-doc-locale-icons-plugins-alpha-beta-gamma-delta-lib-share-doc-locale-icons-plugins-alpha-beta-gamma-delta-lib-share-doc-locale89.txt
+attr f2-1.2-1.x86_64@available solvable:filelist /f2/plugins-alpha-beta-gamma-delta-lib-share-doc-locale-icons-plugins-alpha-beta-gamma-delta-lib-share-doc-locale-icons-plugins-alpha-beta-gamma-delta-lib-share99.mo
+attr f2-1.2-1.x86_64@available solvable:filelist /f2/plugins-alpha-beta-gamma-delta-lib-share-doc-locale-icons-plugins-alpha-beta-gamma-delta-lib-share-doc-locale-icons-plugins-alpha-beta-gamma-delta109.txt
+attr f2-1.2-1.x86_64@available solvable:filelist /f2/share-doc-locale-icons-plugins-alpha-beta-gamma-delta-lib-share-doc-locale-icons-plugins-alpha-beta-gamma-delta-lib-share-doc-locale-icons-plugins-alpha-beta-gamma-delta95.mo
+attr f2-1.2-1.x86_64@available solvable:filelist /f2/share-doc-locale-icons-plugins-alpha-beta-gamma-delta-lib-share-doc-locale-icons-plugins-alpha-beta-gamma-delta-lib-share-doc-locale-icons-plugins-alpha-beta105.txt
+attr f2-1.2-1.x86_64@available solvable:filelist /f2/share-doc-locale-icons-plugins-alpha-beta-gamma-delta-lib-share-doc-locale-icons-plugins-alpha-beta-gamma-delta-lib-share-doc-locale-icons-plugins115.mo
+attr f2-1.2-1.x86_64@available solvable:filelist /f2/share-doc-locale-icons-plugins-alpha-beta-gamma-delta-lib-share-doc-locale-icons-plugins-alpha-beta-gamma-delta-lib-share-doc-locale-icons-plugins85.txt
+attr f2-1.2-1.x86_64@available solvable:name f2
+attr f2-1.2-1.x86_64@available solvable:summary files package 2
+attr f20-1.20-1.x86_64@available solvable:arch x86_64
+attr f20-1.20-1.x86_64@available solvable:evr 1.20-1
+attr f20-1.20-1.x86_64@available solvable:filelist /f20/alpha-beta-gamma-delta-lib-share-doc-locale-icons-plugins-alpha-beta-gamma-delta-lib-share-doc-locale-icons-plugins-alpha-beta-gamma-delta-lib-share-doc-locale820.so
+attr f20-1.20-1.x86_64@available solvable:filelist /f20/alpha-beta-gamma-delta-lib-share-doc-locale-icons-plugins-alpha-beta-gamma-delta-lib-share-doc-locale-icons-plugins-alpha-beta-gamma-delta-lib-share800.so
+attr f20-1.20-1.x86_64@available solvable:filelist /f20/alpha-beta-gamma-delta-lib-share-doc-locale-icons-plugins-alpha-beta-gamma-delta-lib-share-doc-locale-icons-plugins-alpha-beta-gamma-delta-lib-share830.png
+attr f20-1.20-1.x86_64@available solvable:filelist /f20/alpha-beta-gamma-delta-lib-share-doc-locale-icons-plugins-alpha-beta-gamma-delta-lib-share-doc-locale-icons-plugins-alpha-beta-gamma-delta810.png
+attr f20-1.20-1.x86_64@available solvable:filelist /f20/beta-gamma-delta-lib-share-doc-locale-icons-plugins-alpha-beta-gamma-delta-lib-share-doc-locale-icons-plugins-alpha-beta-gamma-delta-lib-share-doc-locale-icons-plugins821.txt
+attr f20-1.20-1.x86_64@available solvable:filelist /f20/beta-gamma-delta-lib-share-doc-locale-icons-plugins-alpha-beta-gamma-delta-lib-share-doc-locale-icons-plugins-alpha-beta-gamma-delta-lib-share-doc-locale801.txt
+attr f20-1.20-1.x86_64@available solvable:filelist /f20/beta-gamma-delta-lib-share-doc-locale-icons-plugins-alpha-beta-gamma-delta-lib-share-doc-locale-icons-plugins-alpha-beta-gamma-delta-lib-share-doc-locale831.mo
+attr f20-1.20-1.x86_64@available solvable:filelist /f20/beta-gamma-delta-lib-share-doc-locale-icons-plugins-alpha-beta-gamma-delta-lib-share-doc-locale-icons-plugins-alpha-beta-gamma-delta-lib-share811.mo
+attr f20-1.20-1.x86_64@available solvable:filelist /f20/delta-lib-share-doc-locale-icons-plugins-alpha-beta-gamma-delta-lib-share-doc-locale-icons-plugins-alpha-beta-gamma-delta-lib-share-doc-locale-icons-plugins-alpha-beta803.mo
+attr f20-1.20-1.x86_64@available solvable:filelist /f20/delta-lib-share-doc-locale-icons-plugins-alpha-beta-gamma-delta-lib-share-doc-locale-icons-plugins-alpha-beta-gamma-delta-lib-share-doc-locale-icons-plugins-alpha-beta833.txt
+attr f20-1.20-1.x86_64@available solvable:filelist /f20/delta-lib-share-doc-locale-icons-plugins-alpha-beta-gamma-delta-lib-share-doc-locale-icons-plugins-alpha-beta-gamma-delta-lib-share-doc-locale-icons-plugins813.txt
+attr f20-1.20-1.x86_64@available solvable:filelist /f20/delta-lib-share-doc-locale-icons-plugins-alpha-beta-gamma-delta-lib-share-doc-locale-icons-plugins-alpha-beta-gamma-delta-lib-share-doc-locale823.mo
+attr f20-1.20-1.x86_64@available solvable:filelist /f20/doc-locale-icons-plugins-alpha-beta-gamma-delta-lib-share-doc-locale-icons-plugins-alpha-beta-gamma-delta-lib-share-doc-locale-icons-plugins-alpha-beta-gamma-delta826.png
+attr f20-1.20-1.x86_64@available solvable:filelist /f20/doc-locale-icons-plugins-alpha-beta-gamma-delta-lib-share-doc-locale-icons-plugins-alpha-beta-gamma-delta-lib-share-doc-locale-icons-plugins-alpha-beta806.png
+attr f20-1.20-1.x86_64@available solvable:filelist /f20/doc-locale-icons-plugins-alpha-beta-gamma-delta-lib-share-doc-locale-icons-plugins-alpha-beta-gamma-delta-lib-share-doc-locale-icons-plugins-alpha-beta836.so
+attr f20-1.20-1.x86_64@available solvable:filelist /f20/doc-locale-icons-plugins-alpha-beta-gamma-delta-lib-share-doc-locale-icons-plugins-alpha-beta-gamma-delta-lib-share-doc-locale-icons-plugins816.so
+attr f20-1.20-1.x86_64@available solvable:filelist /f20/gamma-delta-lib-share-doc-locale-icons-plugins-alpha-beta-gamma-delta-lib-share-doc-locale-icons-plugins-alpha-beta-gamma-delta-lib-share-doc-locale-icons-plugins802.png
+attr f20-1.20-1.x86_64@available solvable:filelist /f20/gamma-delta-lib-share-doc-locale-icons-plugins-alpha-beta-gamma-delta-lib-share-doc-locale-icons-plugins-alpha-beta-gamma-delta-lib-share-doc-locale-icons-plugins832.so
+attr f20-1.20-1.x86_64@available solvable:filelist /f20/gamma-delta-lib-share-doc-locale-icons-plugins-alpha-beta-gamma-delta-lib-share-doc-locale-icons-plugins-alpha-beta-gamma-delta-lib-share-doc-locale812.so
+attr f20-1.20-1.x86_64@available solvable:filelist /f20/gamma-delta-lib-share-doc-locale-icons-plugins-alpha-beta-gamma-delta-lib-share-doc-locale-icons-plugins-alpha-beta-gamma-delta-lib-share822.png
+attr f20-1.20-1.x86_64@available solvable:filelist /f20/icons-plugins-alpha-beta-gamma-delta-lib-share-doc-locale-icons-plugins-alpha-beta-gamma-delta-lib-share-doc-locale-icons-plugins-alpha-beta-gamma-delta-lib-share808.so
+attr f20-1.20-1.x86_64@available solvable:filelist /f20/icons-plugins-alpha-beta-gamma-delta-lib-share-doc-locale-icons-plugins-alpha-beta-gamma-delta-lib-share-doc-locale-icons-plugins-alpha-beta-gamma-delta-lib-share838.png
+attr f20-1.20-1.x86_64@available solvable:filelist /f20/icons-plugins-alpha-beta-gamma-delta-lib-share-doc-locale-icons-plugins-alpha-beta-gamma-delta-lib-share-doc-locale-icons-plugins-alpha-beta-gamma-delta818.png
+attr f20-1.20-1.x86_64@available solvable:filelist /f20/icons-plugins-alpha-beta-gamma-delta-lib-share-doc-locale-icons-plugins-alpha-beta-gamma-delta-lib-share-doc-locale-icons-plugins-alpha-beta828.so
+attr f20-1.20-1.x86_64@available solvable:filelist /f20/lib-share-doc-locale-icons-plugins-alpha-beta-gamma-delta-lib-share-doc-locale-icons-plugins-alpha-beta-gamma-delta-lib-share-doc-locale-icons-plugins-alpha-beta814.png
+attr f20-1.20-1.x86_64@available solvable:filelist /f20/lib-share-doc-locale-icons-plugins-alpha-beta-gamma-delta-lib-share-doc-locale-icons-plugins-alpha-beta-gamma-delta-lib-share-doc-locale-icons-plugins824.so
+attr f20-1.20-1.x86_64@available solvable:filelist /f20/lib-share-doc-locale-icons-plugins-alpha-beta-gamma-delta-lib-share-doc-locale-icons-plugins-alpha-beta-gamma-delta-lib-share-doc-locale804.so
+attr f20-1.20-1.x86_64@available solvable:filelist /f20/lib-share-doc-locale-icons-plugins-alpha-beta-gamma-delta-lib-share-doc-locale-icons-plugins-alpha-beta-gamma-delta-lib-share-doc-locale834.png
+attr f20-1.20-1.x86_64@available solvable:filelist /f20/locale-icons-plugins-alpha-beta-gamma-delta-lib-share-doc-locale-icons-plugins-alpha-beta-gamma-delta-lib-share-doc-locale-icons-plugins-alpha-beta-gamma-delta-lib-share827.mo
+attr f20-1.20-1.x86_64@available solvable:filelist /f20/locale-icons-plugins-alpha-beta-gamma-delta-lib-share-doc-locale-icons-plugins-alpha-beta-gamma-delta-lib-share-doc-locale-icons-plugins-alpha-beta-gamma-delta807.mo
+attr f20-1.20-1.x86_64@available solvable:filelist /f20/locale-icons-plugins-alpha-beta-gamma-delta-lib-share-doc-locale-icons-plugins-alpha-beta-gamma-delta-lib-share-doc-locale-icons-plugins-alpha-beta-gamma-delta837.txt
+attr f20-1.20-1.x86_64@available solvable:filelist /f20/locale-icons-plugins-alpha-beta-gamma-delta-lib-share-doc-locale-icons-plugins-alpha-beta-gamma-delta-lib-share-doc-locale-icons-plugins-alpha-beta817.txt
+attr f20-1.20-1.x86_64@available solvable:filelist /f20/plugins-alpha-beta-gamma-delta-lib-share-doc-locale-icons-plugins-alpha-beta-gamma-delta-lib-share-doc-locale-icons-plugins-alpha-beta-gamma-delta-lib-share-doc-locale809.txt
+attr f20-1.20-1.x86_64@available solvable:filelist /f20/plugins-alpha-beta-gamma-delta-lib-share-doc-locale-icons-plugins-alpha-beta-gamma-delta-lib-share-doc-locale-icons-plugins-alpha-beta-gamma-delta-lib-share-doc-locale839.mo
+attr f20-1.20-1.x86_64@available solvable:filelist /f20/plugins-alpha-beta-gamma-delta-lib-share-doc-locale-icons-plugins-alpha-beta-gamma-delta-lib-share-doc-locale-icons-plugins-alpha-beta-gamma-delta-lib-share819.mo
+attr f20-1.20-1.x86_64@available solvable:filelist /f20/plugins-alpha-beta-gamma-delta-lib-share-doc-locale-icons-plugins-alpha-beta-gamma-delta-lib-share-doc-locale-icons-plugins-alpha-beta-gamma-delta829.txt
+attr f20-1.20-1.x86_64@available solvable:filelist /f20/share-doc-locale-icons-plugins-alpha-beta-gamma-delta-lib-share-doc-locale-icons-plugins-alpha-beta-gamma-delta-lib-share-doc-locale-icons-plugins-alpha-beta-gamma-delta815.mo
+attr f20-1.20-1.x86_64@available solvable:filelist /f20/share-doc-locale-icons-plugins-alpha-beta-gamma-delta-lib-share-doc-locale-icons-plugins-alpha-beta-gamma-delta-lib-share-doc-locale-icons-plugins-alpha-beta825.txt
+attr f20-1.20-1.x86_64@available solvable:filelist /f20/share-doc-locale-icons-plugins-alpha-beta-gamma-delta-lib-share-doc-locale-icons-plugins-alpha-beta-gamma-delta-lib-share-doc-locale-icons-plugins805.txt
+attr f20-1.20-1.x86_64@available solvable:filelist /f20/share-doc-locale-icons-plugins-alpha-beta-gamma-delta-lib-share-doc-locale-icons-plugins-alpha-beta-gamma-delta-lib-share-doc-locale-icons-plugins835.mo
+attr f20-1.20-1.x86_64@available solvable:name f20
+attr f20-1.20-1.x86_64@available solvable:summary files package 20
+attr f3-1.3-1.x86_64@available solvable:arch x86_64
+attr f3-1.3-1.x86_64@available solvable:evr 1.3-1
+attr f3-1.3-1.x86_64@available solvable:filelist /f3/alpha-beta-gamma-delta-lib-share-doc-locale-icons-plugins-alpha-beta-gamma-delta-lib-share-doc-locale-icons-plugins-alpha-beta-gamma-delta-lib-share-doc-locale130.png
+attr f3-1.3-1.x86_64@available solvable:filelist /f3/alpha-beta-gamma-delta-lib-share-doc-locale-icons-plugins-alpha-beta-gamma-delta-lib-share-doc-locale-icons-plugins-alpha-beta-gamma-delta-lib-share140.so
+attr f3-1.3-1.x86_64@available solvable:filelist /f3/alpha-beta-gamma-delta-lib-share-doc-locale-icons-plugins-alpha-beta-gamma-delta-lib-share-doc-locale-icons-plugins-alpha-beta-gamma-delta120.so
+attr f3-1.3-1.x86_64@available solvable:filelist /f3/alpha-beta-gamma-delta-lib-share-doc-locale-icons-plugins-alpha-beta-gamma-delta-lib-share-doc-locale-icons-plugins-alpha-beta-gamma-delta150.png
+attr f3-1.3-1.x86_64@available solvable:filelist /f3/beta-gamma-delta-lib-share-doc-locale-icons-plugins-alpha-beta-gamma-delta-lib-share-doc-locale-icons-plugins-alpha-beta-gamma-delta-lib-share-doc-locale-icons-plugins131.mo
+attr f3-1.3-1.x86_64@available solvable:filelist /f3/beta-gamma-delta-lib-share-doc-locale-icons-plugins-alpha-beta-gamma-delta-lib-share-doc-locale-icons-plugins-alpha-beta-gamma-delta-lib-share-doc-locale141.txt
+attr f3-1.3-1.x86_64@available solvable:filelist /f3/beta-gamma-delta-lib-share-doc-locale-icons-plugins-alpha-beta-gamma-delta-lib-share-doc-locale-icons-plugins-alpha-beta-gamma-delta-lib-share121.txt
+attr f3-1.3-1.x86_64@available solvable:filelist /f3/beta-gamma-delta-lib-share-doc-locale-icons-plugins-alpha-beta-gamma-delta-lib-share-doc-locale-icons-plugins-alpha-beta-gamma-delta-lib-share151.mo
+attr f3-1.3-1.x86_64@available solvable:filelist /f3/delta-lib-share-doc-locale-icons-plugins-alpha-beta-gamma-delta-lib-share-doc-locale-icons-plugins-alpha-beta-gamma-delta-lib-share-doc-locale-icons-plugins-alpha-beta143.mo
+attr f3-1.3-1.x86_64@available solvable:filelist /f3/delta-lib-share-doc-locale-icons-plugins-alpha-beta-gamma-delta-lib-share-doc-locale-icons-plugins-alpha-beta-gamma-delta-lib-share-doc-locale-icons-plugins123.mo
+attr f3-1.3-1.x86_64@available solvable:filelist /f3/delta-lib-share-doc-locale-icons-plugins-alpha-beta-gamma-delta-lib-share-doc-locale-icons-plugins-alpha-beta-gamma-delta-lib-share-doc-locale-icons-plugins153.txt
+attr f3-1.3-1.x86_64@available solvable:filelist /f3/delta-lib-share-doc-locale-icons-plugins-alpha-beta-gamma-delta-lib-share-doc-locale-icons-plugins-alpha-beta-gamma-delta-lib-share-doc-locale133.txt
+attr f3-1.3-1.x86_64@available solvable:filelist /f3/doc-locale-icons-plugins-alpha-beta-gamma-delta-lib-share-doc-locale-icons-plugins-alpha-beta-gamma-delta-lib-share-doc-locale-icons-plugins-alpha-beta-gamma-delta136.so
+attr f3-1.3-1.x86_64@available solvable:filelist /f3/doc-locale-icons-plugins-alpha-beta-gamma-delta-lib-share-doc-locale-icons-plugins-alpha-beta-gamma-delta-lib-share-doc-locale-icons-plugins-alpha-beta146.png
+attr f3-1.3-1.x86_64@available solvable:filelist /f3/doc-locale-icons-plugins-alpha-beta-gamma-delta-lib-share-doc-locale-icons-plugins-alpha-beta-gamma-delta-lib-share-doc-locale-icons-plugins126.png
+attr f3-1.3-1.x86_64@available solvable:filelist /f3/doc-locale-icons-plugins-alpha-beta-gamma-delta-lib-share-doc-locale-icons-plugins-alpha-beta-gamma-delta-lib-share-doc-locale-icons-plugins156.so
+attr f3-1.3-1.x86_64@available solvable:filelist /f3/gamma-delta-lib-share-doc-locale-icons-plugins-alpha-beta-gamma-delta-lib-share-doc-locale-icons-plugins-alpha-beta-gamma-delta-lib-share-doc-locale-icons-plugins142.png
+attr f3-1.3-1.x86_64@available solvable:filelist /f3/gamma-delta-lib-share-doc-locale-icons-plugins-alpha-beta-gamma-delta-lib-share-doc-locale-icons-plugins-alpha-beta-gamma-delta-lib-share-doc-locale122.png
+attr f3-1.3-1.x86_64@available solvable:filelist /f3/gamma-delta-lib-share-doc-locale-icons-plugins-alpha-beta-gamma-delta-lib-share-doc-locale-icons-plugins-alpha-beta-gamma-delta-lib-share-doc-locale152.so
+attr f3-1.3-1.x86_64@available solvable:filelist /f3/gamma-delta-lib-share-doc-locale-icons-plugins-alpha-beta-gamma-delta-lib-share-doc-locale-icons-plugins-alpha-beta-gamma-delta-lib-share132.so
+attr f3-1.3-1.x86_64@available solvable:filelist /f3/icons-plugins-alpha-beta-gamma-delta-lib-share-doc-locale-icons-plugins-alpha-beta-gamma-delta-lib-share-doc-locale-icons-plugins-alpha-beta-gamma-delta-lib-share148.so
+attr f3-1.3-1.x86_64@available solvable:filelist /f3/icons-plugins-alpha-beta-gamma-delta-lib-share-doc-locale-icons-plugins-alpha-beta-gamma-delta-lib-share-doc-locale-icons-plugins-alpha-beta-gamma-delta128.so
+attr f3-1.3-1.x86_64@available solvable:filelist /f3/icons-plugins-alpha-beta-gamma-delta-lib-share-doc-locale-icons-plugins-alpha-beta-gamma-delta-lib-share-doc-locale-icons-plugins-alpha-beta-gamma-delta158.png
+attr f3-1.3-1.x86_64@available solvable:filelist /f3/icons-plugins-alpha-beta-gamma-delta-lib-share-doc-locale-icons-plugins-alpha-beta-gamma-delta-lib-share-doc-locale-icons-plugins-alpha-beta138.png
+attr f3-1.3-1.x86_64@available solvable:filelist /f3/lib-share-doc-locale-icons-plugins-alpha-beta-gamma-delta-lib-share-doc-locale-icons-plugins-alpha-beta-gamma-delta-lib-share-doc-locale-icons-plugins-alpha-beta124.so
+attr f3-1.3-1.x86_64@available solvable:filelist /f3/lib-share-doc-locale-icons-plugins-alpha-beta-gamma-delta-lib-share-doc-locale-icons-plugins-alpha-beta-gamma-delta-lib-share-doc-locale-icons-plugins-alpha-beta154.png
+attr f3-1.3-1.x86_64@available solvable:filelist /f3/lib-share-doc-locale-icons-plugins-alpha-beta-gamma-delta-lib-share-doc-locale-icons-plugins-alpha-beta-gamma-delta-lib-share-doc-locale-icons-plugins134.png
+attr f3-1.3-1.x86_64@available solvable:filelist /f3/lib-share-doc-locale-icons-plugins-alpha-beta-gamma-delta-lib-share-doc-locale-icons-plugins-alpha-beta-gamma-delta-lib-share-doc-locale144.so
+attr f3-1.3-1.x86_64@available solvable:filelist /f3/locale-icons-plugins-alpha-beta-gamma-delta-lib-share-doc-locale-icons-plugins-alpha-beta-gamma-delta-lib-share-doc-locale-icons-plugins-alpha-beta-gamma-delta-lib-share137.txt
+attr f3-1.3-1.x86_64@available solvable:filelist /f3/locale-icons-plugins-alpha-beta-gamma-delta-lib-share-doc-locale-icons-plugins-alpha-beta-gamma-delta-lib-share-doc-locale-icons-plugins-alpha-beta-gamma-delta147.mo
+attr f3-1.3-1.x86_64@available solvable:filelist /f3/locale-icons-plugins-alpha-beta-gamma-delta-lib-share-doc-locale-icons-plugins-alpha-beta-gamma-delta-lib-share-doc-locale-icons-plugins-alpha-beta127.mo
+attr f3-1.3-1.x86_64@available solvable:filelist /f3/locale-icons-plugins-alpha-beta-gamma-delta-lib-share-doc-locale-icons-plugins-alpha-beta-gamma-delta-lib-share-doc-locale-icons-plugins-alpha-beta157.txt
+attr f3-1.3-1.x86_64@available solvable:filelist /f3/plugins-alpha-beta-gamma-delta-lib-share-doc-locale-icons-plugins-alpha-beta-gamma-delta-lib-share-doc-locale-icons-plugins-alpha-beta-gamma-delta-lib-share-doc-locale149.txt
+attr f3-1.3-1.x86_64@available solvable:filelist /f3/plugins-alpha-beta-gamma-delta-lib-share-doc-locale-icons-plugins-alpha-beta-gamma-delta-lib-share-doc-locale-icons-plugins-alpha-beta-gamma-delta-lib-share129.txt
+attr f3-1.3-1.x86_64@available solvable:filelist /f3/plugins-alpha-beta-gamma-delta-lib-share-doc-locale-icons-plugins-alpha-beta-gamma-delta-lib-share-doc-locale-icons-plugins-alpha-beta-gamma-delta-lib-share159.mo
+attr f3-1.3-1.x86_64@available solvable:filelist /f3/plugins-alpha-beta-gamma-delta-lib-share-doc-locale-icons-plugins-alpha-beta-gamma-delta-lib-share-doc-locale-icons-plugins-alpha-beta-gamma-delta139.mo
+attr f3-1.3-1.x86_64@available solvable:filelist /f3/share-doc-locale-icons-plugins-alpha-beta-gamma-delta-lib-share-doc-locale-icons-plugins-alpha-beta-gamma-delta-lib-share-doc-locale-icons-plugins-alpha-beta-gamma-delta125.txt
+attr f3-1.3-1.x86_64@available solvable:filelist /f3/share-doc-locale-icons-plugins-alpha-beta-gamma-delta-lib-share-doc-locale-icons-plugins-alpha-beta-gamma-delta-lib-share-doc-locale-icons-plugins-alpha-beta-gamma-delta155.mo
+attr f3-1.3-1.x86_64@available solvable:filelist /f3/share-doc-locale-icons-plugins-alpha-beta-gamma-delta-lib-share-doc-locale-icons-plugins-alpha-beta-gamma-delta-lib-share-doc-locale-icons-plugins-alpha-beta135.mo
+attr f3-1.3-1.x86_64@available solvable:filelist /f3/share-doc-locale-icons-plugins-alpha-beta-gamma-delta-lib-share-doc-locale-icons-plugins-alpha-beta-gamma-delta-lib-share-doc-locale-icons-plugins145.txt
+attr f3-1.3-1.x86_64@available solvable:name f3
+attr f3-1.3-1.x86_64@available solvable:summary files package 3
+attr f4-1.4-1.x86_64@available solvable:arch x86_64
+attr f4-1.4-1.x86_64@available solvable:evr 1.4-1
+attr f4-1.4-1.x86_64@available solvable:filelist /f4/alpha-beta-gamma-delta-lib-share-doc-locale-icons-plugins-alpha-beta-gamma-delta-lib-share-doc-locale-icons-plugins-alpha-beta-gamma-delta-lib-share-doc-locale160.so
+attr f4-1.4-1.x86_64@available solvable:filelist /f4/alpha-beta-gamma-delta-lib-share-doc-locale-icons-plugins-alpha-beta-gamma-delta-lib-share-doc-locale-icons-plugins-alpha-beta-gamma-delta-lib-share-doc-locale190.png
+attr f4-1.4-1.x86_64@available solvable:filelist /f4/alpha-beta-gamma-delta-lib-share-doc-locale-icons-plugins-alpha-beta-gamma-delta-lib-share-doc-locale-icons-plugins-alpha-beta-gamma-delta-lib-share170.png
+attr f4-1.4-1.x86_64@available solvable:filelist /f4/alpha-beta-gamma-delta-lib-share-doc-locale-icons-plugins-alpha-beta-gamma-delta-lib-share-doc-locale-icons-plugins-alpha-beta-gamma-delta180.so
+attr f4-1.4-1.x86_64@available solvable:filelist /f4/beta-gamma-delta-lib-share-doc-locale-icons-plugins-alpha-beta-gamma-delta-lib-share-doc-locale-icons-plugins-alpha-beta-gamma-delta-lib-share-doc-locale-icons-plugins161.txt
+attr f4-1.4-1.x86_64@available solvable:filelist /f4/beta-gamma-delta-lib-share-doc-locale-icons-plugins-alpha-beta-gamma-delta-lib-share-doc-locale-icons-plugins-alpha-beta-gamma-delta-lib-share-doc-locale-icons-plugins191.mo
+attr f4-1.4-1.x86_64@available solvable:filelist /f4/beta-gamma-delta-lib-share-doc-locale-icons-plugins-alpha-beta-gamma-delta-lib-share-doc-locale-icons-plugins-alpha-beta-gamma-delta-lib-share-doc-locale171.mo
+attr f4-1.4-1.x86_64@available solvable:filelist /f4/beta-gamma-delta-lib-share-doc-locale-icons-plugins-alpha-beta-gamma-delta-lib-share-doc-locale-icons-plugins-alpha-beta-gamma-delta-lib-share181.txt
+attr f4-1.4-1.x86_64@available solvable:filelist /f4/delta-lib-share-doc-locale-icons-plugins-alpha-beta-gamma-delta-lib-share-doc-locale-icons-plugins-alpha-beta-gamma-delta-lib-share-doc-locale-icons-plugins-alpha-beta173.txt
+attr f4-1.4-1.x86_64@available solvable:filelist /f4/delta-lib-share-doc-locale-icons-plugins-alpha-beta-gamma-delta-lib-share-doc-locale-icons-plugins-alpha-beta-gamma-delta-lib-share-doc-locale-icons-plugins183.mo
+attr f4-1.4-1.x86_64@available solvable:filelist /f4/delta-lib-share-doc-locale-icons-plugins-alpha-beta-gamma-delta-lib-share-doc-locale-icons-plugins-alpha-beta-gamma-delta-lib-share-doc-locale163.mo
+attr f4-1.4-1.x86_64@available solvable:filelist /f4/delta-lib-share-doc-locale-icons-plugins-alpha-beta-gamma-delta-lib-share-doc-locale-icons-plugins-alpha-beta-gamma-delta-lib-share-doc-locale193.txt
+attr f4-1.4-1.x86_64@available solvable:filelist /f4/doc-locale-icons-plugins-alpha-beta-gamma-delta-lib-share-doc-locale-icons-plugins-alpha-beta-gamma-delta-lib-share-doc-locale-icons-plugins-alpha-beta-gamma-delta166.png
+attr f4-1.4-1.x86_64@available solvable:filelist /f4/doc-locale-icons-plugins-alpha-beta-gamma-delta-lib-share-doc-locale-icons-plugins-alpha-beta-gamma-delta-lib-share-doc-locale-icons-plugins-alpha-beta-gamma-delta196.so
+attr f4-1.4-1.x86_64@available solvable:filelist /f4/doc-locale-icons-plugins-alpha-beta-gamma-delta-lib-share-doc-locale-icons-plugins-alpha-beta-gamma-delta-lib-share-doc-locale-icons-plugins-alpha-beta176.so
+attr f4-1.4-1.x86_64@available solvable:filelist /f4/doc-locale-icons-plugins-alpha-beta-gamma-delta-lib-share-doc-locale-icons-plugins-alpha-beta-gamma-delta-lib-share-doc-locale-icons-plugins186.png
+attr f4-1.4-1.x86_64@available solvable:filelist /f4/gamma-delta-lib-share-doc-locale-icons-plugins-alpha-beta-gamma-delta-lib-share-doc-locale-icons-plugins-alpha-beta-gamma-delta-lib-share-doc-locale-icons-plugins172.so
+attr f4-1.4-1.x86_64@available solvable:filelist /f4/gamma-delta-lib-share-doc-locale-icons-plugins-alpha-beta-gamma-delta-lib-share-doc-locale-icons-plugins-alpha-beta-gamma-delta-lib-share-doc-locale182.png
+attr f4-1.4-1.x86_64@available solvable:filelist /f4/gamma-delta-lib-share-doc-locale-icons-plugins-alpha-beta-gamma-delta-lib-share-doc-locale-icons-plugins-alpha-beta-gamma-delta-lib-share162.png
+attr f4-1.4-1.x86_64@available solvable:filelist /f4/gamma-delta-lib-share-doc-locale-icons-plugins-alpha-beta-gamma-delta-lib-share-doc-locale-icons-plugins-alpha-beta-gamma-delta-lib-share192.so
+attr f4-1.4-1.x86_64@available solvable:filelist /f4/icons-plugins-alpha-beta-gamma-delta-lib-share-doc-locale-icons-plugins-alpha-beta-gamma-delta-lib-share-doc-locale-icons-plugins-alpha-beta-gamma-delta-lib-share178.png
+attr f4-1.4-1.x86_64@available solvable:filelist /f4/icons-plugins-alpha-beta-gamma-delta-lib-share-doc-locale-icons-plugins-alpha-beta-gamma-delta-lib-share-doc-locale-icons-plugins-alpha-beta-gamma-delta188.so
+attr f4-1.4-1.x86_64@available solvable:filelist /f4/icons-plugins-alpha-beta-gamma-delta-lib-share-doc-locale-icons-plugins-alpha-beta-gamma-delta-lib-share-doc-locale-icons-plugins-alpha-beta168.so
+attr f4-1.4-1.x86_64@available solvable:filelist /f4/icons-plugins-alpha-beta-gamma-delta-lib-share-doc-locale-icons-plugins-alpha-beta-gamma-delta-lib-share-doc-locale-icons-plugins-alpha-beta198.png
+attr f4-1.4-1.x86_64@available solvable:filelist /f4/lib-share-doc-locale-icons-plugins-alpha-beta-gamma-delta-lib-share-doc-locale-icons-plugins-alpha-beta-gamma-delta-lib-share-doc-locale-icons-plugins-alpha-beta184.so
+attr f4-1.4-1.x86_64@available solvable:filelist /f4/lib-share-doc-locale-icons-plugins-alpha-beta-gamma-delta-lib-share-doc-locale-icons-plugins-alpha-beta-gamma-delta-lib-share-doc-locale-icons-plugins164.so
+attr f4-1.4-1.x86_64@available solvable:filelist /f4/lib-share-doc-locale-icons-plugins-alpha-beta-gamma-delta-lib-share-doc-locale-icons-plugins-alpha-beta-gamma-delta-lib-share-doc-locale-icons-plugins194.png
+attr f4-1.4-1.x86_64@available solvable:filelist /f4/lib-share-doc-locale-icons-plugins-alpha-beta-gamma-delta-lib-share-doc-locale-icons-plugins-alpha-beta-gamma-delta-lib-share-doc-locale174.png
+attr f4-1.4-1.x86_64@available solvable:filelist /f4/locale-icons-plugins-alpha-beta-gamma-delta-lib-share-doc-locale-icons-plugins-alpha-beta-gamma-delta-lib-share-doc-locale-icons-plugins-alpha-beta-gamma-delta-lib-share167.mo
+attr f4-1.4-1.x86_64@available solvable:filelist /f4/locale-icons-plugins-alpha-beta-gamma-delta-lib-share-doc-locale-icons-plugins-alpha-beta-gamma-delta-lib-share-doc-locale-icons-plugins-alpha-beta-gamma-delta-lib-share197.txt
+attr f4-1.4-1.x86_64@available solvable:filelist /f4/locale-icons-plugins-alpha-beta-gamma-delta-lib-share-doc-locale-icons-plugins-alpha-beta-gamma-delta-lib-share-doc-locale-icons-plugins-alpha-beta-gamma-delta177.txt
+attr f4-1.4-1.x86_64@available solvable:filelist /f4/locale-icons-plugins-alpha-beta-gamma-delta-lib-share-doc-locale-icons-plugins-alpha-beta-gamma-delta-lib-share-doc-locale-icons-plugins-alpha-beta187.mo
+attr f4-1.4-1.x86_64@available solvable:filelist /f4/plugins-alpha-beta-gamma-delta-lib-share-doc-locale-icons-plugins-alpha-beta-gamma-delta-lib-share-doc-locale-icons-plugins-alpha-beta-gamma-delta-lib-share-doc-locale179.mo
+attr f4-1.4-1.x86_64@available solvable:filelist /f4/plugins-alpha-beta-gamma-delta-lib-share-doc-locale-icons-plugins-alpha-beta-gamma-delta-lib-share-doc-locale-icons-plugins-alpha-beta-gamma-delta-lib-share189.txt
+attr f4-1.4-1.x86_64@available solvable:filelist /f4/plugins-alpha-beta-gamma-delta-lib-share-doc-locale-icons-plugins-alpha-beta-gamma-delta-lib-share-doc-locale-icons-plugins-alpha-beta-gamma-delta169.txt
+attr f4-1.4-1.x86_64@available solvable:filelist /f4/plugins-alpha-beta-gamma-delta-lib-share-doc-locale-icons-plugins-alpha-beta-gamma-delta-lib-share-doc-locale-icons-plugins-alpha-beta-gamma-delta199.mo
+attr f4-1.4-1.x86_64@available solvable:filelist /f4/share-doc-locale-icons-plugins-alpha-beta-gamma-delta-lib-share-doc-locale-icons-plugins-alpha-beta-gamma-delta-lib-share-doc-locale-icons-plugins-alpha-beta-gamma-delta185.txt
+attr f4-1.4-1.x86_64@available solvable:filelist /f4/share-doc-locale-icons-plugins-alpha-beta-gamma-delta-lib-share-doc-locale-icons-plugins-alpha-beta-gamma-delta-lib-share-doc-locale-icons-plugins-alpha-beta165.txt
+attr f4-1.4-1.x86_64@available solvable:filelist /f4/share-doc-locale-icons-plugins-alpha-beta-gamma-delta-lib-share-doc-locale-icons-plugins-alpha-beta-gamma-delta-lib-share-doc-locale-icons-plugins-alpha-beta195.mo
+attr f4-1.4-1.x86_64@available solvable:filelist /f4/share-doc-locale-icons-plugins-alpha-beta-gamma-delta-lib-share-doc-locale-icons-plugins-alpha-beta-gamma-delta-lib-share-doc-locale-icons-plugins175.mo
+attr f4-1.4-1.x86_64@available solvable:name f4
+attr f4-1.4-1.x86_64@available solvable:summary files package 4
+attr f5-1.5-1.x86_64@available solvable:arch x86_64
+attr f5-1.5-1.x86_64@available solvable:evr 1.5-1
+attr f5-1.5-1.x86_64@available solvable:filelist /f5/alpha-beta-gamma-delta-lib-share-doc-locale-icons-plugins-alpha-beta-gamma-delta-lib-share-doc-locale-icons-plugins-alpha-beta-gamma-delta-lib-share-doc-locale220.so
+attr f5-1.5-1.x86_64@available solvable:filelist /f5/alpha-beta-gamma-delta-lib-share-doc-locale-icons-plugins-alpha-beta-gamma-delta-lib-share-doc-locale-icons-plugins-alpha-beta-gamma-delta-lib-share200.so
+attr f5-1.5-1.x86_64@available solvable:filelist /f5/alpha-beta-gamma-delta-lib-share-doc-locale-icons-plugins-alpha-beta-gamma-delta-lib-share-doc-locale-icons-plugins-alpha-beta-gamma-delta-lib-share230.png
+attr f5-1.5-1.x86_64@available solvable:filelist /f5/alpha-beta-gamma-delta-lib-share-doc-locale-icons-plugins-alpha-beta-gamma-delta-lib-share-doc-locale-icons-plugins-alpha-beta-gamma-delta210.png
+attr f5-1.5-1.x86_64@available solvable:filelist /f5/beta-gamma-delta-lib-share-doc-locale-icons-plugins-alpha-beta-gamma-delta-lib-share-doc-locale-icons-plugins-alpha-beta-gamma-delta-lib-share-doc-locale-icons-plugins221.txt
+attr f5-1.5-1.x86_64@available solvable:filelist /f5/beta-gamma-delta-lib-share-doc-locale-icons-plugins-alpha-beta-gamma-delta-lib-share-doc-locale-icons-plugins-alpha-beta-gamma-delta-lib-share-doc-locale201.txt
+attr f5-1.5-1.x86_64@available solvable:filelist /f5/beta-gamma-delta-lib-share-doc-locale-icons-plugins-alpha-beta-gamma-delta-lib-share-doc-locale-icons-plugins-alpha-beta-gamma-delta-lib-share-doc-locale231.mo
+attr f5-1.5-1.x86_64@available solvable:filelist /f5/beta-gamma-delta-lib-share-doc-locale-icons-plugins-alpha-beta-gamma-delta-lib-share-doc-locale-icons-plugins-alpha-beta-gamma-delta-lib-share211.mo
+attr f5-1.5-1.x86_64@available solvable:filelist /f5/delta-lib-share-doc-locale-icons-plugins-alpha-beta-gamma-delta-lib-share-doc-locale-icons-plugins-alpha-beta-gamma-delta-lib-share-doc-locale-icons-plugins-alpha-beta203.mo
+attr f5-1.5-1.x86_64@available solvable:filelist /f5/delta-lib-share-doc-locale-icons-plugins-alpha-beta-gamma-delta-lib-share-doc-locale-icons-plugins-alpha-beta-gamma-delta-lib-share-doc-locale-icons-plugins-alpha-beta233.txt
+attr f5-1.5-1.x86_64@available solvable:filelist /f5/delta-lib-share-doc-locale-icons-plugins-alpha-beta-gamma-delta-lib-share-doc-locale-icons-plugins-alpha-beta-gamma-delta-lib-share-doc-locale-icons-plugins213.txt
+attr f5-1.5-1.x86_64@available solvable:filelist /f5/delta-lib-share-doc-locale-icons-plugins-alpha-beta-gamma-delta-lib-share-doc-locale-icons-plugins-alpha-beta-gamma-delta-lib-share-doc-locale223.mo
+attr f5-1.5-1.x86_64@available solvable:filelist /f5/doc-locale-icons-plugins-alpha-beta-gamma-delta-lib-share-doc-locale-icons-plugins-alpha-beta-gamma-delta-lib-share-doc-locale-icons-plugins-alpha-beta-gamma-delta226.png
+attr f5-1.5-1.x86_64@available solvable:filelist /f5/doc-locale-icons-plugins-alpha-beta-gamma-delta-lib-share-doc-locale-icons-plugins-alpha-beta-gamma-delta-lib-share-doc-locale-icons-plugins-alpha-beta206.png
+attr f5-1.5-1.x86_64@available solvable:filelist /f5/doc-locale-icons-plugins-alpha-beta-gamma-delta-lib-share-doc-locale-icons-plugins-alpha-beta-gamma-delta-lib-share-doc-locale-icons-plugins-alpha-beta236.so
+attr f5-1.5-1.x86_64@available solvable:filelist /f5/doc-locale-icons-plugins-alpha-beta-gamma-delta-lib-share-doc-locale-icons-plugins-alpha-beta-gamma-delta-lib-share-doc-locale-icons-plugins216.so
+attr f5-1.5-1.x86_64@available solvable:filelist /f5/gamma-delta-lib-share-doc-locale-icons-plugins-alpha-beta-gamma-delta-lib-share-doc-locale-icons-plugins-alpha-beta-gamma-delta-lib-share-doc-locale-icons-plugins202.png
+attr f5-1.5-1.x86_64@available solvable:filelist /f5/gamma-delta-lib-share-doc-locale-icons-plugins-alpha-beta-gamma-delta-lib-share-doc-locale-icons-plugins-alpha-beta-gamma-delta-lib-share-doc-locale-icons-plugins232.so
+attr f5-1.5-1.x86_64@available solvable:filelist /f5/gamma-delta-lib-share-doc-locale-icons-plugins-alpha-beta-gamma-delta-lib-share-doc-locale-icons-plugins-alpha-beta-gamma-delta-lib-share-doc-locale212.so
+attr f5-1.5-1.x86_64@available solvable:filelist /f5/gamma-delta-lib-share-doc-locale-icons-plugins-alpha-beta-gamma-delta-lib-share-doc-locale-icons-plugins-alpha-beta-gamma-delta-lib-share222.png
+attr f5-1.5-1.x86_64@available solvable:filelist /f5/icons-plugins-alpha-beta-gamma-delta-lib-share-doc-locale-icons-plugins-alpha-beta-gamma-delta-lib-share-doc-locale-icons-plugins-alpha-beta-gamma-delta-lib-share208.so
+attr f5-1.5-1.x86_64@available solvable:filelist /f5/icons-plugins-alpha-beta-gamma-delta-lib-share-doc-locale-icons-plugins-alpha-beta-gamma-delta-lib-share-doc-locale-icons-plugins-alpha-beta-gamma-delta-lib-share238.png
+attr f5-1.5-1.x86_64@available solvable:filelist /f5/icons-plugins-alpha-beta-gamma-delta-lib-share-doc-locale-icons-plugins-alpha-beta-gamma-delta-lib-share-doc-locale-icons-plugins-alpha-beta-gamma-delta218.png
+attr f5-1.5-1.x86_64@available solvable:filelist /f5/icons-plugins-alpha-beta-gamma-delta-lib-share-doc-locale-icons-plugins-alpha-beta-gamma-delta-lib-share-doc-locale-icons-plugins-alpha-beta228.so
+attr f5-1.5-1.x86_64@available solvable:filelist /f5/lib-share-doc-locale-icons-plugins-alpha-beta-gamma-delta-lib-share-doc-locale-icons-plugins-alpha-beta-gamma-delta-lib-share-doc-locale-icons-plugins-alpha-beta214.png
+attr f5-1.5-1.x86_64@available solvable:filelist /f5/lib-share-doc-locale-icons-plugins-alpha-beta-gamma-delta-lib-share-doc-locale-icons-plugins-alpha-beta-gamma-delta-lib-share-doc-locale-icons-plugins224.so
+attr f5-1.5-1.x86_64@available solvable:filelist /f5/lib-share-doc-locale-icons-plugins-alpha-beta-gamma-delta-lib-share-doc-locale-icons-plugins-alpha-beta-gamma-delta-lib-share-doc-locale204.so
+attr f5-1.5-1.x86_64@available solvable:filelist /f5/lib-share-doc-locale-icons-plugins-alpha-beta-gamma-delta-lib-share-doc-locale-icons-plugins-alpha-beta-gamma-delta-lib-share-doc-locale234.png
+attr f5-1.5-1.x86_64@available solvable:filelist /f5/locale-icons-plugins-alpha-beta-gamma-delta-lib-share-doc-locale-icons-plugins-alpha-beta-gamma-delta-lib-share-doc-locale-icons-plugins-alpha-beta-gamma-delta-lib-share227.mo
+attr f5-1.5-1.x86_64@available solvable:filelist /f5/locale-icons-plugins-alpha-beta-gamma-delta-lib-share-doc-locale-icons-plugins-alpha-beta-gamma-delta-lib-share-doc-locale-icons-plugins-alpha-beta-gamma-delta207.mo
+attr f5-1.5-1.x86_64@available solvable:filelist /f5/locale-icons-plugins-alpha-beta-gamma-delta-lib-share-doc-locale-icons-plugins-alpha-beta-gamma-delta-lib-share-doc-locale-icons-plugins-alpha-beta-gamma-delta237.txt
+attr f5-1.5-1.x86_64@available solvable:filelist /f5/locale-icons-plugins-alpha-beta-gamma-delta-lib-share-doc-locale-icons-plugins-alpha-beta-gamma-delta-lib-share-doc-locale-icons-plugins-alpha-beta217.txt
+attr f5-1.5-1.x86_64@available solvable:filelist /f5/plugins-alpha-beta-gamma-delta-lib-share-doc-locale-icons-plugins-alpha-beta-gamma-delta-lib-share-doc-locale-icons-plugins-alpha-beta-gamma-delta-lib-share-doc-locale209.txt
+attr f5-1.5-1.x86_64@available solvable:filelist /f5/plugins-alpha-beta-gamma-delta-lib-share-doc-locale-icons-plugins-alpha-beta-gamma-delta-lib-share-doc-locale-icons-plugins-alpha-beta-gamma-delta-lib-share-doc-locale239.mo
+attr f5-1.5-1.x86_64@available solvable:filelist /f5/plugins-alpha-beta-gamma-delta-lib-share-doc-locale-icons-plugins-alpha-beta-gamma-delta-lib-share-doc-locale-icons-plugins-alpha-beta-gamma-delta-lib-share219.mo
+attr f5-1.5-1.x86_64@available solvable:filelist /f5/plugins-alpha-beta-gamma-delta-lib-share-doc-locale-icons-plugins-alpha-beta-gamma-delta-lib-share-doc-locale-icons-plugins-alpha-beta-gamma-delta229.txt
+attr f5-1.5-1.x86_64@available solvable:filelist /f5/share-doc-locale-icons-plugins-alpha-beta-gamma-delta-lib-share-doc-locale-icons-plugins-alpha-beta-gamma-delta-lib-share-doc-locale-icons-plugins-alpha-beta-gamma-delta215.mo
+attr f5-1.5-1.x86_64@available solvable:filelist /f5/share-doc-locale-icons-plugins-alpha-beta-gamma-delta-lib-share-doc-locale-icons-plugins-alpha-beta-gamma-delta-lib-share-doc-locale-icons-plugins-alpha-beta225.txt
+attr f5-1.5-1.x86_64@available solvable:filelist /f5/share-doc-locale-icons-plugins-alpha-beta-gamma-delta-lib-share-doc-locale-icons-plugins-alpha-beta-gamma-delta-lib-share-doc-locale-icons-plugins205.txt
+attr f5-1.5-1.x86_64@available solvable:filelist /f5/share-doc-locale-icons-plugins-alpha-beta-gamma-delta-lib-share-doc-locale-icons-plugins-alpha-beta-gamma-delta-lib-share-doc-locale-icons-plugins235.mo
+attr f5-1.5-1.x86_64@available solvable:name f5
+attr f5-1.5-1.x86_64@available solvable:summary files package 5
+attr f6-1.6-1.x86_64@available solvable:arch x86_64
+attr f6-1.6-1.x86_64@available solvable:evr 1.6-1
+attr f6-1.6-1.x86_64@available solvable:filelist /f6/alpha-beta-gamma-delta-lib-share-doc-locale-icons-plugins-alpha-beta-gamma-delta-lib-share-doc-locale-icons-plugins-alpha-beta-gamma-delta-lib-share-doc-locale250.png
+attr f6-1.6-1.x86_64@available solvable:filelist /f6/alpha-beta-gamma-delta-lib-share-doc-locale-icons-plugins-alpha-beta-gamma-delta-lib-share-doc-locale-icons-plugins-alpha-beta-gamma-delta-lib-share260.so
+attr f6-1.6-1.x86_64@available solvable:filelist /f6/alpha-beta-gamma-delta-lib-share-doc-locale-icons-plugins-alpha-beta-gamma-delta-lib-share-doc-locale-icons-plugins-alpha-beta-gamma-delta240.so
+attr f6-1.6-1.x86_64@available solvable:filelist /f6/alpha-beta-gamma-delta-lib-share-doc-locale-icons-plugins-alpha-beta-gamma-delta-lib-share-doc-locale-icons-plugins-alpha-beta-gamma-delta270.png
+attr f6-1.6-1.x86_64@available solvable:filelist /f6/beta-gamma-delta-lib-share-doc-locale-icons-plugins-alpha-beta-gamma-delta-lib-share-doc-locale-icons-plugins-alpha-beta-gamma-delta-lib-share-doc-locale-icons-plugins251.mo
+attr f6-1.6-1.x86_64@available solvable:filelist /f6/beta-gamma-delta-lib-share-doc-locale-icons-plugins-alpha-beta-gamma-delta-lib-share-doc-locale-icons-plugins-alpha-beta-gamma-delta-lib-share-doc-locale261.txt
+attr f6-1.6-1.x86_64@available solvable:filelist /f6/beta-gamma-delta-lib-share-doc-locale-icons-plugins-alpha-beta-gamma-delta-lib-share-doc-locale-icons-plugins-alpha-beta-gamma-delta-lib-share241.txt
+attr f6-1.6-1.x86_64@available solvable:filelist /f6/beta-gamma-delta-lib-share-doc-locale-icons-plugins-alpha-beta-gamma-delta-lib-share-doc-locale-icons-plugins-alpha-beta-gamma-delta-lib-share271.mo
+attr f6-1.6-1.x86_64@available solvable:filelist /f6/delta-lib-share-doc-locale-icons-plugins-alpha-beta-gamma-delta-lib-share-doc-locale-icons-plugins-alpha-beta-gamma-delta-lib-share-doc-locale-icons-plugins-alpha-beta263.mo
+attr f6-1.6-1.x86_64@available solvable:filelist /f6/delta-lib-share-doc-locale-icons-plugins-alpha-beta-gamma-delta-lib-share-doc-locale-icons-plugins-alpha-beta-gamma-delta-lib-share-doc-locale-icons-plugins243.mo
+attr f6-1.6-1.x86_64@available solvable:filelist /f6/delta-lib-share-doc-locale-icons-plugins-alpha-beta-gamma-delta-lib-share-doc-locale-icons-plugins-alpha-beta-gamma-delta-lib-share-doc-locale-icons-plugins273.txt
+attr f6-1.6-1.x86_64@available solvable:filelist /f6/delta-lib-share-doc-locale-icons-plugins-alpha-beta-gamma-delta-lib-share-doc-locale-icons-plugins-alpha-beta-gamma-delta-lib-share-doc-locale253.txt
+attr f6-1.6-1.x86_64@available solvable:filelist /f6/doc-locale-icons-plugins-alpha-beta-gamma-delta-lib-share-doc-locale-icons-plugins-alpha-beta-gamma-delta-lib-share-doc-locale-icons-plugins-alpha-beta-gamma-delta256.so
+attr f6-1.6-1.x86_64@available solvable:filelist /f6/doc-locale-icons-plugins-alpha-beta-gamma-delta-lib-share-doc-locale-icons-plugins-alpha-beta-gamma-delta-lib-share-doc-locale-icons-plugins-alpha-beta266.png
+attr f6-1.6-1.x86_64@available solvable:filelist /f6/doc-locale-icons-plugins-alpha-beta-gamma-delta-lib-share-doc-locale-icons-plugins-alpha-beta-gamma-delta-lib-share-doc-locale-icons-plugins246.png
+attr f6-1.6-1.x86_64@available solvable:filelist /f6/doc-locale-icons-plugins-alpha-beta-gamma-delta-lib-share-doc-locale-icons-plugins-alpha-beta-gamma-delta-lib-share-doc-locale-icons-plugins276.so
+attr f6-1.6-1.x86_64@available solvable:filelist /f6/gamma-delta-lib-share-doc-locale-icons-plugins-alpha-beta-gamma-delta-lib-share-doc-locale-icons-plugins-alpha-beta-gamma-delta-lib-share-doc-locale-icons-plugins262.png
+attr f6-1.6-1.x86_64@available solvable:filelist /f6/gamma-delta-lib-share-doc-locale-icons-plugins-alpha-beta-gamma-delta-lib-share-doc-locale-icons-plugins-alpha-beta-gamma-delta-lib-share-doc-locale242.png
+attr f6-1.6-1.x86_64@available solvable:filelist /f6/gamma-delta-lib-share-doc-locale-icons-plugins-alpha-beta-gamma-delta-lib-share-doc-locale-icons-plugins-alpha-beta-gamma-delta-lib-share-doc-locale272.so
+attr f6-1.6-1.x86_64@available solvable:filelist /f6/gamma-delta-lib-share-doc-locale-icons-plugins-alpha-beta-gamma-delta-lib-share-doc-locale-icons-plugins-alpha-beta-gamma-delta-lib-share252.so
+attr f6-1.6-1.x86_64@available solvable:filelist /f6/icons-plugins-alpha-beta-gamma-delta-lib-share-doc-locale-icons-plugins-alpha-beta-gamma-delta-lib-share-doc-locale-icons-plugins-alpha-beta-gamma-delta-lib-share268.so
+attr f6-1.6-1.x86_64@available solvable:filelist /f6/icons-plugins-alpha-beta-gamma-delta-lib-share-doc-locale-icons-plugins-alpha-beta-gamma-delta-lib-share-doc-locale-icons-plugins-alpha-beta-gamma-delta248.so
+attr f6-1.6-1.x86_64@available solvable:filelist /f6/icons-plugins-alpha-beta-gamma-delta-lib-share-doc-locale-icons-plugins-alpha-beta-gamma-delta-lib-share-doc-locale-icons-plugins-alpha-beta-gamma-delta278.png
+attr f6-1.6-1.x86_64@available solvable:filelist /f6/icons-plugins-alpha-beta-gamma-delta-lib-share-doc-locale-icons-plugins-alpha-beta-gamma-delta-lib-share-doc-locale-icons-plugins-alpha-beta258.png
+attr f6-1.6-1.x86_64@available solvable:filelist /f6/lib-share-doc-locale-icons-plugins-alpha-beta-gamma-delta-lib-share-doc-locale-icons-plugins-alpha-beta-gamma-delta-lib-share-doc-locale-icons-plugins-alpha-beta244.so
+attr f6-1.6-1.x86_64@available solvable:filelist /f6/lib-share-doc-locale-icons-plugins-alpha-beta-gamma-delta-lib-share-doc-locale-icons-plugins-alpha-beta-gamma-delta-lib-share-doc-locale-icons-plugins-alpha-beta274.png
+attr f6-1.6-1.x86_64@available solvable:filelist /f6/lib-share-doc-locale-icons-plugins-alpha-beta-gamma-delta-lib-share-doc-locale-icons-plugins-alpha-beta-gamma-delta-lib-share-doc-locale-icons-plugins254.png
+attr f6-1.6-1.x86_64@available solvable:filelist /f6/lib-share-doc-locale-icons-plugins-alpha-beta-gamma-delta-lib-share-doc-locale-icons-plugins-alpha-beta-gamma-delta-lib-share-doc-locale264.so
+attr f6-1.6-1.x86_64@available solvable:filelist /f6/locale-icons-plugins-alpha-beta-gamma-delta-lib-share-doc-locale-icons-plugins-alpha-beta-gamma-delta-lib-share-doc-locale-icons-plugins-alpha-beta-gamma-delta-lib-share257.txt
+attr f6-1.6-1.x86_64@available solvable:filelist /f6/locale-icons-plugins-alpha-beta-gamma-delta-lib-share-doc-locale-icons-plugins-alpha-beta-gamma-delta-lib-share-doc-locale-icons-plugins-alpha-beta-gamma-delta267.mo
+attr f6-1.6-1.x86_64@available solvable:filelist /f6/locale-icons-plugins-alpha-beta-gamma-delta-lib-share-doc-locale-icons-plugins-alpha-beta-gamma-delta-lib-share-doc-locale-icons-plugins-alpha-beta247.mo
+attr f6-1.6-1.x86_64@available solvable:filelist /f6/locale-icons-plugins-alpha-beta-gamma-delta-lib-share-doc-locale-icons-plugins-alpha-beta-gamma-delta-lib-share-doc-locale-icons-plugins-alpha-beta277.txt
+attr f6-1.6-1.x86_64@available solvable:filelist /f6/plugins-alpha-beta-gamma-delta-lib-share-doc-locale-icons-plugins-alpha-beta-gamma-delta-lib-share-doc-locale-icons-plugins-alpha-beta-gamma-delta-lib-share-doc-locale269.txt
+attr f6-1.6-1.x86_64@available solvable:filelist /f6/plugins-alpha-beta-gamma-delta-lib-share-doc-locale-icons-plugins-alpha-beta-gamma-delta-lib-share-doc-locale-icons-plugins-alpha-beta-gamma-delta-lib-share249.txt
+attr f6-1.6-1.x86_64@available solvable:filelist /f6/plugins-alpha-beta-gamma-delta-lib-share-doc-locale-icons-plugins-alpha-beta-gamma-delta-lib-share-doc-locale-icons-plugins-alpha-beta-gamma-delta-lib-share279.mo
+attr f6-1.6-1.x86_64@available solvable:filelist /f6/plugins-alpha-beta-gamma-delta-lib-share-doc-locale-icons-plugins-alpha-beta-gamma-delta-lib-share-doc-locale-icons-plugins-alpha-beta-gamma-delta259.mo
+attr f6-1.6-1.x86_64@available solvable:filelist /f6/share-doc-locale-icons-plugins-alpha-beta-gamma-delta-lib-share-doc-locale-icons-plugins-alpha-beta-gamma-delta-lib-share-doc-locale-icons-plugins-alpha-beta-gamma-delta245.txt
+attr f6-1.6-1.x86_64@available solvable:filelist /f6/share-doc-locale-icons-plugins-alpha-beta-gamma-delta-lib-share-doc-locale-icons-plugins-alpha-beta-gamma-delta-lib-share-doc-locale-icons-plugins-alpha-beta-gamma-delta275.mo
+attr f6-1.6-1.x86_64@available solvable:filelist /f6/share-doc-locale-icons-plugins-alpha-beta-gamma-delta-lib-share-doc-locale-icons-plugins-alpha-beta-gamma-delta-lib-share-doc-locale-icons-plugins-alpha-beta255.mo
+attr f6-1.6-1.x86_64@available solvable:filelist /f6/share-doc-locale-icons-plugins-alpha-beta-gamma-delta-lib-share-doc-locale-icons-plugins-alpha-beta-gamma-delta-lib-share-doc-locale-icons-plugins265.txt
+attr f6-1.6-1.x86_64@available solvable:name f6
+attr f6-1.6-1.x86_64@available solvable:summary files package 6
+attr f7-1.7-1.x86_64@available solvable:arch x86_64
+attr f7-1.7-1.x86_64@available solvable:evr 1.7-1
+attr f7-1.7-1.x86_64@available solvable:filelist /f7/alpha-beta-gamma-delta-lib-share-doc-locale-icons-plugins-alpha-beta-gamma-delta-lib-share-doc-locale-icons-plugins-alpha-beta-gamma-delta-lib-share-doc-locale280.so
+attr f7-1.7-1.x86_64@available solvable:filelist /f7/alpha-beta-gamma-delta-lib-share-doc-locale-icons-plugins-alpha-beta-gamma-delta-lib-share-doc-locale-icons-plugins-alpha-beta-gamma-delta-lib-share-doc-locale310.png
+attr f7-1.7-1.x86_64@available solvable:filelist /f7/alpha-beta-gamma-delta-lib-share-doc-locale-icons-plugins-alpha-beta-gamma-delta-lib-share-doc-locale-icons-plugins-alpha-beta-gamma-delta-lib-share290.png
+attr f7-1.7-1.x86_64@available solvable:filelist /f7/alpha-beta-gamma-delta-lib-share-doc-locale-icons-plugins-alpha-beta-gamma-delta-lib-share-doc-locale-icons-plugins-alpha-beta-gamma-delta300.so
+attr f7-1.7-1.x86_64@available solvable:filelist /f7/beta-gamma-delta-lib-share-doc-locale-icons-plugins-alpha-beta-gamma-delta-lib-share-doc-locale-icons-plugins-alpha-beta-gamma-delta-lib-share-doc-locale-icons-plugins281.txt
+attr f7-1.7-1.x86_64@available solvable:filelist /f7/beta-gamma-delta-lib-share-doc-locale-icons-plugins-alpha-beta-gamma-delta-lib-share-doc-locale-icons-plugins-alpha-beta-gamma-delta-lib-share-doc-locale-icons-plugins311.mo
+attr f7-1.7-1.x86_64@available solvable:filelist /f7/beta-gamma-delta-lib-share-doc-locale-icons-plugins-alpha-beta-gamma-delta-lib-share-doc-locale-icons-plugins-alpha-beta-gamma-delta-lib-share-doc-locale291.mo
+attr f7-1.7-1.x86_64@available solvable:filelist /f7/beta-gamma-delta-lib-share-doc-locale-icons-plugins-alpha-beta-gamma-delta-lib-share-doc-locale-icons-plugins-alpha-beta-gamma-delta-lib-share301.txt
+attr f7-1.7-1.x86_64@available solvable:filelist /f7/delta-lib-share-doc-locale-icons-plugins-alpha-beta-gamma-delta-lib-share-doc-locale-icons-plugins-alpha-beta-gamma-delta-lib-share-doc-locale-icons-plugins-alpha-beta293.txt
+attr f7-1.7-1.x86_64@available solvable:filelist /f7/delta-lib-share-doc-locale-icons-plugins-alpha-beta-gamma-delta-lib-share-doc-locale-icons-plugins-alpha-beta-gamma-delta-lib-share-doc-locale-icons-plugins303.mo
+attr f7-1.7-1.x86_64@available solvable:filelist /f7/delta-lib-share-doc-locale-icons-plugins-alpha-beta-gamma-delta-lib-share-doc-locale-icons-plugins-alpha-beta-gamma-delta-lib-share-doc-locale283.mo
+attr f7-1.7-1.x86_64@available solvable:filelist /f7/delta-lib-share-doc-locale-icons-plugins-alpha-beta-gamma-delta-lib-share-doc-locale-icons-plugins-alpha-beta-gamma-delta-lib-share-doc-locale313.txt
+attr f7-1.7-1.x86_64@available solvable:filelist /f7/doc-locale-icons-plugins-alpha-beta-gamma-delta-lib-share-doc-locale-icons-plugins-alpha-beta-gamma-delta-lib-share-doc-locale-icons-plugins-alpha-beta-gamma-delta286.png
+attr f7-1.7-1.x86_64@available solvable:filelist /f7/doc-locale-icons-plugins-alpha-beta-gamma-delta-lib-share-doc-locale-icons-plugins-alpha-beta-gamma-delta-lib-share-doc-locale-icons-plugins-alpha-beta-gamma-delta316.so
+attr f7-1.7-1.x86_64@available solvable:filelist /f7/doc-locale-icons-plugins-alpha-beta-gamma-delta-lib-share-doc-locale-icons-plugins-alpha-beta-gamma-delta-lib-share-doc-locale-icons-plugins-alpha-beta296.so
+attr f7-1.7-1.x86_64@available solvable:filelist /f7/doc-locale-icons-plugins-alpha-beta-gamma-delta-lib-share-doc-locale-icons-plugins-alpha-beta-gamma-delta-lib-share-doc-locale-icons-plugins306.png
+attr f7-1.7-1.x86_64@available solvable:filelist /f7/gamma-delta-lib-share-doc-locale-icons-plugins-alpha-beta-gamma-delta-lib-share-doc-locale-icons-plugins-alpha-beta-gamma-delta-lib-share-doc-locale-icons-plugins292.so
+attr f7-1.7-1.x86_64@available solvable:filelist /f7/gamma-delta-lib-share-doc-locale-icons-plugins-alpha-beta-gamma-delta-lib-share-doc-locale-icons-plugins-alpha-beta-gamma-delta-lib-share-doc-locale302.png
+attr f7-1.7-1.x86_64@available solvable:filelist /f7/gamma-delta-lib-share-doc-locale-icons-plugins-alpha-beta-gamma-delta-lib-share-doc-locale-icons-plugins-alpha-beta-gamma-delta-lib-share282.png
+attr f7-1.7-1.x86_64@available solvable:filelist /f7/gamma-delta-lib-share-doc-locale-icons-plugins-alpha-beta-gamma-delta-lib-share-doc-locale-icons-plugins-alpha-beta-gamma-delta-lib-share312.so
+attr f7-1.7-1.x86_64@available solvable:filelist /f7/icons-plugins-alpha-beta-gamma-delta-lib-share-doc-locale-icons-plugins-alpha-beta-gamma-delta-lib-share-doc-locale-icons-plugins-alpha-beta-gamma-delta-lib-share298.png
+attr f7-1.7-1.x86_64@available solvable:filelist /f7/icons-plugins-alpha-beta-gamma-delta-lib-share-doc-locale-icons-plugins-alpha-beta-gamma-delta-lib-share-doc-locale-icons-plugins-alpha-beta-gamma-delta308.so
+attr f7-1.7-1.x86_64@available solvable:filelist /f7/icons-plugins-alpha-beta-gamma-delta-lib-share-doc-locale-icons-plugins-alpha-beta-gamma-delta-lib-share-doc-locale-icons-plugins-alpha-beta288.so
+attr f7-1.7-1.x86_64@available solvable:filelist /f7/icons-plugins-alpha-beta-gamma-delta-lib-share-doc-locale-icons-plugins-alpha-beta-gamma-delta-lib-share-doc-locale-icons-plugins-alpha-beta318.png
+attr f7-1.7-1.x86_64@available solvable:filelist /f7/lib-share-doc-locale-icons-plugins-alpha-beta-gamma-delta-lib-share-doc-locale-icons-plugins-alpha-beta-gamma-delta-lib-share-doc-locale-icons-plugins-alpha-beta304.so
+attr f7-1.7-1.x86_64@available solvable:filelist /f7/lib-share-doc-locale-icons-plugins-alpha-beta-gamma-delta-lib-share-doc-locale-icons-plugins-alpha-beta-gamma-delta-lib-share-doc-locale-icons-plugins284.so
+attr f7-1.7-1.x86_64@available solvable:filelist /f7/lib-share-doc-locale-icons-plugins-alpha-beta-gamma-delta-lib-share-doc-locale-icons-plugins-alpha-beta-gamma-delta-lib-share-doc-locale-icons-plugins314.png
+attr f7-1.7-1.x86_64@available solvable:filelist /f7/lib-share-doc-locale-icons-plugins-alpha-beta-gamma-delta-lib-share-doc-locale-icons-plugins-alpha-beta-gamma-delta-lib-share-doc-locale294.png
+attr f7-1.7-1.x86_64@available solvable:filelist /f7/locale-icons-plugins-alpha-beta-gamma-delta-lib-share-doc-locale-icons-plugins-alpha-beta-gamma-delta-lib-share-doc-locale-icons-plugins-alpha-beta-gamma-delta-lib-share287.mo
+attr f7-1.7-1.x86_64@available solvable:filelist /f7/locale-icons-plugins-alpha-beta-gamma-delta-lib-share-doc-locale-icons-plugins-alpha-beta-gamma-delta-lib-share-doc-locale-icons-plugins-alpha-beta-gamma-delta-lib-share317.txt
+attr f7-1.7-1.x86_64@available solvable:filelist /f7/locale-icons-plugins-alpha-beta-gamma-delta-lib-share-doc-locale-icons-plugins-alpha-beta-gamma-delta-lib-share-doc-locale-icons-plugins-alpha-beta-gamma-delta297.txt
+attr f7-1.7-1.x86_64@available solvable:filelist /f7/locale-icons-plugins-alpha-beta-gamma-delta-lib-share-doc-locale-icons-plugins-alpha-beta-gamma-delta-lib-share-doc-locale-icons-plugins-alpha-beta307.mo
+attr f7-1.7-1.x86_64@available solvable:filelist /f7/plugins-alpha-beta-gamma-delta-lib-share-doc-locale-icons-plugins-alpha-beta-gamma-delta-lib-share-doc-locale-icons-plugins-alpha-beta-gamma-delta-lib-share-doc-locale299.mo
+attr f7-1.7-1.x86_64@available solvable:filelist /f7/plugins-alpha-beta-gamma-delta-lib-share-doc-locale-icons-plugins-alpha-beta-gamma-delta-lib-share-doc-locale-icons-plugins-alpha-beta-gamma-delta-lib-share309.txt
+attr f7-1.7-1.x86_64@available solvable:filelist /f7/plugins-alpha-beta-gamma-delta-lib-share-doc-locale-icons-plugins-alpha-beta-gamma-delta-lib-share-doc-locale-icons-plugins-alpha-beta-gamma-delta289.txt
+attr f7-1.7-1.x86_64@available solvable:filelist /f7/plugins-alpha-beta-gamma-delta-lib-share-doc-locale-icons-plugins-alpha-beta-gamma-delta-lib-share-doc-locale-icons-plugins-alpha-beta-gamma-delta319.mo
+attr f7-1.7-1.x86_64@available solvable:filelist /f7/share-doc-locale-icons-plugins-alpha-beta-gamma-delta-lib-share-doc-locale-icons-plugins-alpha-beta-gamma-delta-lib-share-doc-locale-icons-plugins-alpha-beta-gamma-delta305.txt
+attr f7-1.7-1.x86_64@available solvable:filelist /f7/share-doc-locale-icons-plugins-alpha-beta-gamma-delta-lib-share-doc-locale-icons-plugins-alpha-beta-gamma-delta-lib-share-doc-locale-icons-plugins-alpha-beta285.txt
+attr f7-1.7-1.x86_64@available solvable:filelist /f7/share-doc-locale-icons-plugins-alpha-beta-gamma-delta-lib-share-doc-locale-icons-plugins-alpha-beta-gamma-delta-lib-share-doc-locale-icons-plugins-alpha-beta315.mo
+attr f7-1.7-1.x86_64@available solvable:filelist /f7/share-doc-locale-icons-plugins-alpha-beta-gamma-delta-lib-share-doc-locale-icons-plugins-alpha-beta-gamma-delta-lib-share-doc-locale-icons-plugins295.mo
+attr f7-1.7-1.x86_64@available solvable:name f7
+attr f7-1.7-1.x86_64@available solvable:summary files package 7
+attr f8-1.8-1.x86_64@available solvable:arch x86_64
+attr f8-1.8-1.x86_64@available solvable:evr 1.8-1
+attr f8-1.8-1.x86_64@available solvable:filelist /f8/alpha-beta-gamma-delta-lib-share-doc-locale-icons-plugins-alpha-beta-gamma-delta-lib-share-doc-locale-icons-plugins-alpha-beta-gamma-delta-lib-share-doc-locale340.so
+attr f8-1.8-1.x86_64@available solvable:filelist /f8/alpha-beta-gamma-delta-lib-share-doc-locale-icons-plugins-alpha-beta-gamma-delta-lib-share-doc-locale-icons-plugins-alpha-beta-gamma-delta-lib-share320.so
+attr f8-1.8-1.x86_64@available solvable:filelist /f8/alpha-beta-gamma-delta-lib-share-doc-locale-icons-plugins-alpha-beta-gamma-delta-lib-share-doc-locale-icons-plugins-alpha-beta-gamma-delta-lib-share350.png
+attr f8-1.8-1.x86_64@available solvable:filelist /f8/alpha-beta-gamma-delta-lib-share-doc-locale-icons-plugins-alpha-beta-gamma-delta-lib-share-doc-locale-icons-plugins-alpha-beta-gamma-delta330.png
+attr f8-1.8-1.x86_64@available solvable:filelist /f8/beta-gamma-delta-lib-share-doc-locale-icons-plugins-alpha-beta-gamma-delta-lib-share-doc-locale-icons-plugins-alpha-beta-gamma-delta-lib-share-doc-locale-icons-plugins341.txt
+attr f8-1.8-1.x86_64@available solvable:filelist /f8/beta-gamma-delta-lib-share-doc-locale-icons-plugins-alpha-beta-gamma-delta-lib-share-doc-locale-icons-plugins-alpha-beta-gamma-delta-lib-share-doc-locale321.txt
+attr f8-1.8-1.x86_64@available solvable:filelist /f8/beta-gamma-delta-lib-share-doc-locale-icons-plugins-alpha-beta-gamma-delta-lib-share-doc-locale-icons-plugins-alpha-beta-gamma-delta-lib-share-doc-locale351.mo
+attr f8-1.8-1.x86_64@available solvable:filelist /f8/beta-gamma-delta-lib-share-doc-locale-icons-plugins-alpha-beta-gamma-delta-lib-share-doc-locale-icons-plugins-alpha-beta-gamma-delta-lib-share331.mo
+attr f8-1.8-1.x86_64@available solvable:filelist /f8/delta-lib-share-doc-locale-icons-plugins-alpha-beta-gamma-delta-lib-share-doc-locale-icons-plugins-alpha-beta-gamma-delta-lib-share-doc-locale-icons-plugins-alpha-beta323.mo
+attr f8-1.8-1.x86_64@available solvable:filelist /f8/delta-lib-share-doc-locale-icons-plugins-alpha-beta-gamma-delta-lib-share-doc-locale-icons-plugins-alpha-beta-gamma-delta-lib-share-doc-locale-icons-plugins-alpha-beta353.txt
+attr f8-1.8-1.x86_64@available solvable:filelist /f8/delta-lib-share-doc-locale-icons-plugins-alpha-beta-gamma-delta-lib-share-doc-locale-icons-plugins-alpha-beta-gamma-delta-lib-share-doc-locale-icons-plugins333.txt
+attr f8-1.8-1.x86_64@available solvable:filelist /f8/delta-lib-share-doc-locale-icons-plugins-alpha-beta-gamma-delta-lib-share-doc-locale-icons-plugins-alpha-beta-gamma-delta-lib-share-doc-locale343.mo
+attr f8-1.8-1.x86_64@available solvable:filelist /f8/doc-locale-icons-plugins-alpha-beta-gamma-delta-lib-share-doc-locale-icons-plugins-alpha-beta-gamma-delta-lib-share-doc-locale-icons-plugins-alpha-beta-gamma-delta346.png
+attr f8-1.8-1.x86_64@available solvable:filelist /f8/doc-locale-icons-plugins-alpha-beta-gamma-delta-lib-share-doc-locale-icons-plugins-alpha-beta-gamma-delta-lib-share-doc-locale-icons-plugins-alpha-beta326.png
+attr f8-1.8-1.x86_64@available solvable:filelist /f8/doc-locale-icons-plugins-alpha-beta-gamma-delta-lib-share-doc-locale-icons-plugins-alpha-beta-gamma-delta-lib-share-doc-locale-icons-plugins-alpha-beta356.so
+attr f8-1.8-1.x86_64@available solvable:filelist /f8/doc-locale-icons-plugins-alpha-beta-gamma-delta-lib-share-doc-locale-icons-plugins-alpha-beta-gamma-delta-lib-share-doc-locale-icons-plugins336.so
+attr f8-1.8-1.x86_64@available solvable:filelist /f8/gamma-delta-lib-share-doc-locale-icons-plugins-alpha-beta-gamma-delta-lib-share-doc-locale-icons-plugins-alpha-beta-gamma-delta-lib-share-doc-locale-icons-plugins322.png
+attr f8-1.8-1.x86_64@available solvable:filelist /f8/gamma-delta-lib-share-doc-locale-icons-plugins-alpha-beta-gamma-delta-lib-share-doc-locale-icons-plugins-alpha-beta-gamma-delta-lib-share-doc-locale-icons-plugins352.so
+attr f8-1.8-1.x86_64@available solvable:filelist /f8/gamma-delta-lib-share-doc-locale-icons-plugins-alpha-beta-gamma-delta-lib-share-doc-locale-icons-plugins-alpha-beta-gamma-delta-lib-share-doc-locale332.so
+attr f8-1.8-1.x86_64@available solvable:filelist /f8/gamma-delta-lib-share-doc-locale-icons-plugins-alpha-beta-gamma-delta-lib-share-doc-locale-icons-plugins-alpha-beta-gamma-delta-lib-share342.png
+attr f8-1.8-1.x86_64@available solvable:filelist /f8/icons-plugins-alpha-beta-gamma-delta-lib-share-doc-locale-icons-plugins-alpha-beta-gamma-delta-lib-share-doc-locale-icons-plugins-alpha-beta-gamma-delta-lib-share328.so
+attr f8-1.8-1.x86_64@available solvable:filelist /f8/icons-plugins-alpha-beta-gamma-delta-lib-share-doc-locale-icons-plugins-alpha-beta-gamma-delta-lib-share-doc-locale-icons-plugins-alpha-beta-gamma-delta-lib-share358.png
+attr f8-1.8-1.x86_64@available solvable:filelist /f8/icons-plugins-alpha-beta-gamma-delta-lib-share-doc-locale-icons-plugins-alpha-beta-gamma-delta-lib-share-doc-locale-icons-plugins-alpha-beta-gamma-delta338.png
+attr f8-1.8-1.x86_64@available solvable:filelist /f8/icons-plugins-alpha-beta-gamma-delta-lib-share-doc-locale-icons-plugins-alpha-beta-gamma-delta-lib-share-doc-locale-icons-plugins-alpha-beta348.so
+attr f8-1.8-1.x86_64@available solvable:filelist /f8/lib-share-doc-locale-icons-plugins-alpha-beta-gamma-delta-lib-share-doc-locale-icons-plugins-alpha-beta-gamma-delta-lib-share-doc-locale-icons-plugins-alpha-beta334.png
+attr f8-1.8-1.x86_64@available solvable:filelist /f8/lib-share-doc-locale-icons-plugins-alpha-beta-gamma-delta-lib-share-doc-locale-icons-plugins-alpha-beta-gamma-delta-lib-share-doc-locale-icons-plugins344.so
+attr f8-1.8-1.x86_64@available solvable:filelist /f8/lib-share-doc-locale-icons-plugins-alpha-beta-gamma-delta-lib-share-doc-locale-icons-plugins-alpha-beta-gamma-delta-lib-share-doc-locale324.so
+attr f8-1.8-1.x86_64@available solvable:filelist /f8/lib-share-doc-locale-icons-plugins-alpha-beta-gamma-delta-lib-share-doc-locale-icons-plugins-alpha-beta-gamma-delta-lib-share-doc-locale354.png
+attr f8-1.8-1.x86_64@available solvable:filelist /f8/locale-icons-plugins-alpha-beta-gamma-delta-lib-share-doc-locale-icons-plugins-alpha-beta-gamma-delta-lib-share-doc-locale-icons-plugins-alpha-beta-gamma-delta-lib-share347.mo
+attr f8-1.8-1.x86_64@available solvable:filelist /f8/locale-icons-plugins-alpha-beta-gamma-delta-lib-share-doc-locale-icons-plugins-alpha-beta-gamma-delta-lib-share-doc-locale-icons-plugins-alpha-beta-gamma-delta327.mo
+attr f8-1.8-1.x86_64@available solvable:filelist /f8/locale-icons-plugins-alpha-beta-gamma-delta-lib-share-doc-locale-icons-plugins-alpha-beta-gamma-delta-lib-share-doc-locale-icons-plugins-alpha-beta-gamma-delta357.txt
+attr f8-1.8-1.x86_64@available solvable:filelist /f8/locale-icons-plugins-alpha-beta-gamma-delta-lib-share-doc-locale-icons-plugins-alpha-beta-gamma-delta-lib-share-doc-locale-icons-plugins-alpha-beta337.txt
+attr f8-1.8-1.x86_64@available solvable:filelist /f8/plugins-alpha-beta-gamma-delta-lib-share-doc-locale-icons-plugins-alpha-beta-gamma-delta-lib-share-doc-locale-icons-plugins-alpha-beta-gamma-delta-lib-share-doc-locale329.txt
+attr f8-1.8-1.x86_64@available solvable:filelist /f8/plugins-alpha-beta-gamma-delta-lib-share-doc-locale-icons-plugins-alpha-beta-gamma-delta-lib-share-doc-locale-icons-plugins-alpha-beta-gamma-delta-lib-share-doc-locale359.mo
+attr f8-1.8-1.x86_64@available solvable:filelist /f8/plugins-alpha-beta-gamma-delta-lib-share-doc-locale-icons-plugins-alpha-beta-gamma-delta-lib-share-doc-locale-icons-plugins-alpha-beta-gamma-delta-lib-share339.mo
+attr f8-1.8-1.x86_64@available solvable:filelist /f8/plugins-alpha-beta-gamma-delta-lib-share-doc-locale-icons-plugins-alpha-beta-gamma-delta-lib-share-doc-locale-icons-plugins-alpha-beta-gamma-delta349.txt
+attr f8-1.8-1.x86_64@available solvable:filelist /f8/share-doc-locale-icons-plugins-alpha-beta-gamma-delta-lib-share-doc-locale-icons-plugins-alpha-beta-gamma-delta-lib-share-doc-locale-icons-plugins-alpha-beta-gamma-delta335.mo
+attr f8-1.8-1.x86_64@available solvable:filelist /f8/share-doc-locale-icons-plugins-alpha-beta-gamma-delta-lib-share-doc-locale-icons-plugins-alpha-beta-gamma-delta-lib-share-doc-locale-icons-plugins-alpha-beta345.txt
+attr f8-1.8-1.x86_64@available solvable:filelist /f8/share-doc-locale-icons-plugins-alpha-beta-gamma-delta-lib-share-doc-locale-icons-plugins-alpha-beta-gamma-delta-lib-share-doc-locale-icons-plugins325.txt
+attr f8-1.8-1.x86_64@available solvable:filelist /f8/share-doc-locale-icons-plugins-alpha-beta-gamma-delta-lib-share-doc-locale-icons-plugins-alpha-beta-gamma-delta-lib-share-doc-locale-icons-plugins355.mo
+attr f8-1.8-1.x86_64@available solvable:name f8
+attr f8-1.8-1.x86_64@available solvable:summary files package 8
+attr f9-1.9-1.x86_64@available solvable:arch x86_64
+attr f9-1.9-1.x86_64@available solvable:evr 1.9-1
+attr f9-1.9-1.x86_64@available solvable:filelist /f9/alpha-beta-gamma-delta-lib-share-doc-locale-icons-plugins-alpha-beta-gamma-delta-lib-share-doc-locale-icons-plugins-alpha-beta-gamma-delta-lib-share-doc-locale370.png
+attr f9-1.9-1.x86_64@available solvable:filelist /f9/alpha-beta-gamma-delta-lib-share-doc-locale-icons-plugins-alpha-beta-gamma-delta-lib-share-doc-locale-icons-plugins-alpha-beta-gamma-delta-lib-share380.so
+attr f9-1.9-1.x86_64@available solvable:filelist /f9/alpha-beta-gamma-delta-lib-share-doc-locale-icons-plugins-alpha-beta-gamma-delta-lib-share-doc-locale-icons-plugins-alpha-beta-gamma-delta360.so
+attr f9-1.9-1.x86_64@available solvable:filelist /f9/alpha-beta-gamma-delta-lib-share-doc-locale-icons-plugins-alpha-beta-gamma-delta-lib-share-doc-locale-icons-plugins-alpha-beta-gamma-delta390.png
+attr f9-1.9-1.x86_64@available solvable:filelist /f9/beta-gamma-delta-lib-share-doc-locale-icons-plugins-alpha-beta-gamma-delta-lib-share-doc-locale-icons-plugins-alpha-beta-gamma-delta-lib-share-doc-locale-icons-plugins371.mo
+attr f9-1.9-1.x86_64@available solvable:filelist /f9/beta-gamma-delta-lib-share-doc-locale-icons-plugins-alpha-beta-gamma-delta-lib-share-doc-locale-icons-plugins-alpha-beta-gamma-delta-lib-share-doc-locale381.txt
+attr f9-1.9-1.x86_64@available solvable:filelist /f9/beta-gamma-delta-lib-share-doc-locale-icons-plugins-alpha-beta-gamma-delta-lib-share-doc-locale-icons-plugins-alpha-beta-gamma-delta-lib-share361.txt
+attr f9-1.9-1.x86_64@available solvable:filelist /f9/beta-gamma-delta-lib-share-doc-locale-icons-plugins-alpha-beta-gamma-delta-lib-share-doc-locale-icons-plugins-alpha-beta-gamma-delta-lib-share391.mo
+attr f9-1.9-1.x86_64@available solvable:filelist /f9/delta-lib-share-doc-locale-icons-plugins-alpha-beta-gamma-delta-lib-share-doc-locale-icons-plugins-alpha-beta-gamma-delta-lib-share-doc-locale-icons-plugins-alpha-beta383.mo
+attr f9-1.9-1.x86_64@available solvable:filelist /f9/delta-lib-share-doc-locale-icons-plugins-alpha-beta-gamma-delta-lib-share-doc-locale-icons-plugins-alpha-beta-gamma-delta-lib-share-doc-locale-icons-plugins363.mo
+attr f9-1.9-1.x86_64@available solvable:filelist /f9/delta-lib-share-doc-locale-icons-plugins-alpha-beta-gamma-delta-lib-share-doc-locale-icons-plugins-alpha-beta-gamma-delta-lib-share-doc-locale-icons-plugins393.txt
+attr f9-1.9-1.x86_64@available solvable:filelist /f9/delta-lib-share-doc-locale-icons-plugins-alpha-beta-gamma-delta-lib-share-doc-locale-icons-plugins-alpha-beta-gamma-delta-lib-share-doc-locale373.txt
+attr f9-1.9-1.x86_64@available solvable:filelist /f9/doc-locale-icons-plugins-alpha-beta-gamma-delta-lib-share-doc-locale-icons-plugins-alpha-beta-gamma-delta-lib-share-doc-locale-icons-plugins-alpha-beta-gamma-delta376.so
+attr f9-1.9-1.x86_64@available solvable:filelist /f9/doc-locale-icons-plugins-alpha-beta-gamma-delta-lib-share-doc-locale-icons-plugins-alpha-beta-gamma-delta-lib-share-doc-locale-icons-plugins-alpha-beta386.png
+attr f9-1.9-1.x86_64@available solvable:filelist /f9/doc-locale-icons-plugins-alpha-beta-gamma-delta-lib-share-doc-locale-icons-plugins-alpha-beta-gamma-delta-lib-share-doc-locale-icons-plugins366.png
+attr f9-1.9-1.x86_64@available solvable:filelist /f9/doc-locale-icons-plugins-alpha-beta-gamma-delta-lib-share-doc-locale-icons-plugins-alpha-beta-gamma-delta-lib-share-doc-locale-icons-plugins396.so
+attr f9-1.9-1.x86_64@available solvable:filelist /f9/gamma-delta-lib-share-doc-locale-icons-plugins-alpha-beta-gamma-delta-lib-share-doc-locale-icons-plugins-alpha-beta-gamma-delta-lib-share-doc-locale-icons-plugins382.png
+attr f9-1.9-1.x86_64@available solvable:filelist /f9/gamma-delta-lib-share-doc-locale-icons-plugins-alpha-beta-gamma-delta-lib-share-doc-locale-icons-plugins-alpha-beta-gamma-delta-lib-share-doc-locale362.png
+attr f9-1.9-1.x86_64@available solvable:filelist /f9/gamma-delta-lib-share-doc-locale-icons-plugins-alpha-beta-gamma-delta-lib-share-doc-locale-icons-plugins-alpha-beta-gamma-delta-lib-share-doc-locale392.so
+attr f9-1.9-1.x86_64@available solvable:filelist /f9/gamma-delta-lib-share-doc-locale-icons-plugins-alpha-beta-gamma-delta-lib-share-doc-locale-icons-plugins-alpha-beta-gamma-delta-lib-share372.so
+attr f9-1.9-1.x86_64@available solvable:filelist /f9/icons-plugins-alpha-beta-gamma-delta-lib-share-doc-locale-icons-plugins-alpha-beta-gamma-delta-lib-share-doc-locale-icons-plugins-alpha-beta-gamma-delta-lib-share388.so
+attr f9-1.9-1.x86_64@available solvable:filelist /f9/icons-plugins-alpha-beta-gamma-delta-lib-share-doc-locale-icons-plugins-alpha-beta-gamma-delta-lib-share-doc-locale-icons-plugins-alpha-beta-gamma-delta368.so
+attr f9-1.9-1.x86_64@available solvable:filelist /f9/icons-plugins-alpha-beta-gamma-delta-lib-share-doc-locale-icons-plugins-alpha-beta-gamma-delta-lib-share-doc-locale-icons-plugins-alpha-beta-gamma-delta398.png
+attr f9-1.9-1.x86_64@available solvable:filelist /f9/icons-plugins-alpha-beta-gamma-delta-lib-share-doc-locale-icons-plugins-alpha-beta-gamma-delta-lib-share-doc-locale-icons-plugins-alpha-beta378.png
+attr f9-1.9-1.x86_64@available solvable:filelist /f9/lib-share-doc-locale-icons-plugins-alpha-beta-gamma-delta-lib-share-doc-locale-icons-plugins-alpha-beta-gamma-delta-lib-share-doc-locale-icons-plugins-alpha-beta364.so
+attr f9-1.9-1.x86_64@available solvable:filelist /f9/lib-share-doc-locale-icons-plugins-alpha-beta-gamma-delta-lib-share-doc-locale-icons-plugins-alpha-beta-gamma-delta-lib-share-doc-locale-icons-plugins-alpha-beta394.png
+attr f9-1.9-1.x86_64@available solvable:filelist /f9/lib-share-doc-locale-icons-plugins-alpha-beta-gamma-delta-lib-share-doc-locale-icons-plugins-alpha-beta-gamma-delta-lib-share-doc-locale-icons-plugins374.png
+attr f9-1.9-1.x86_64@available solvable:filelist /f9/lib-share-doc-locale-icons-plugins-alpha-beta-gamma-delta-lib-share-doc-locale-icons-plugins-alpha-beta-gamma-delta-lib-share-doc-locale384.so
+attr f9-1.9-1.x86_64@available solvable:filelist /f9/locale-icons-plugins-alpha-beta-gamma-delta-lib-share-doc-locale-icons-plugins-alpha-beta-gamma-delta-lib-share-doc-locale-icons-plugins-alpha-beta-gamma-delta-lib-share377.txt
+attr f9-1.9-1.x86_64@available solvable:filelist /f9/locale-icons-plugins-alpha-beta-gamma-delta-lib-share-doc-locale-icons-plugins-alpha-beta-gamma-delta-lib-share-doc-locale-icons-plugins-alpha-beta-gamma-delta387.mo
+attr f9-1.9-1.x86_64@available solvable:filelist /f9/locale-icons-plugins-alpha-beta-gamma-delta-lib-share-doc-locale-icons-plugins-alpha-beta-gamma-delta-lib-share-doc-locale-icons-plugins-alpha-beta367.mo
+attr f9-1.9-1.x86_64@available solvable:filelist /f9/locale-icons-plugins-alpha-beta-gamma-delta-lib-share-doc-locale-icons-plugins-alpha-beta-gamma-delta-lib-share-doc-locale-icons-plugins-alpha-beta397.txt
+attr f9-1.9-1.x86_64@available solvable:filelist /f9/plugins-alpha-beta-gamma-delta-lib-share-doc-locale-icons-plugins-alpha-beta-gamma-delta-lib-share-doc-locale-icons-plugins-alpha-beta-gamma-delta-lib-share-doc-locale389.txt
+attr f9-1.9-1.x86_64@available solvable:filelist /f9/plugins-alpha-beta-gamma-delta-lib-share-doc-locale-icons-plugins-alpha-beta-gamma-delta-lib-share-doc-locale-icons-plugins-alpha-beta-gamma-delta-lib-share369.txt
+attr f9-1.9-1.x86_64@available solvable:filelist /f9/plugins-alpha-beta-gamma-delta-lib-share-doc-locale-icons-plugins-alpha-beta-gamma-delta-lib-share-doc-locale-icons-plugins-alpha-beta-gamma-delta-lib-share399.mo
+attr f9-1.9-1.x86_64@available solvable:filelist /f9/plugins-alpha-beta-gamma-delta-lib-share-doc-locale-icons-plugins-alpha-beta-gamma-delta-lib-share-doc-locale-icons-plugins-alpha-beta-gamma-delta379.mo
+attr f9-1.9-1.x86_64@available solvable:filelist /f9/share-doc-locale-icons-plugins-alpha-beta-gamma-delta-lib-share-doc-locale-icons-plugins-alpha-beta-gamma-delta-lib-share-doc-locale-icons-plugins-alpha-beta-gamma-delta365.txt
+attr f9-1.9-1.x86_64@available solvable:filelist /f9/share-doc-locale-icons-plugins-alpha-beta-gamma-delta-lib-share-doc-locale-icons-plugins-alpha-beta-gamma-delta-lib-share-doc-locale-icons-plugins-alpha-beta-gamma-delta395.mo
+attr f9-1.9-1.x86_64@available solvable:filelist /f9/share-doc-locale-icons-plugins-alpha-beta-gamma-delta-lib-share-doc-locale-icons-plugins-alpha-beta-gamma-delta-lib-share-doc-locale-icons-plugins-alpha-beta375.mo
+attr f9-1.9-1.x86_64@available solvable:filelist /f9/share-doc-locale-icons-plugins-alpha-beta-gamma-delta-lib-share-doc-locale-icons-plugins-alpha-beta-gamma-delta-lib-share-doc-locale-icons-plugins385.txt
+attr f9-1.9-1.x86_64@available solvable:name f9
+attr f9-1.9-1.x86_64@available solvable:summary files package 9
@@ -0,0 +1,480 @@
+attr p00-1-1.noarch@available solvable:arch noarch
+attr p00-1-1.noarch@available solvable:buildtime 1000000
+attr p00-1-1.noarch@available solvable:evr 1-1
+attr p00-1-1.noarch@available solvable:name p00
+attr p00-1-1.noarch@available solvable:provides p00 = 1-1
+attr p00-1-1.noarch@available solvable:summary summary of package p00
+attr p01-1-1.noarch@available solvable:arch noarch
+attr p01-1-1.noarch@available solvable:buildtime 1000001
+attr p01-1-1.noarch@available solvable:evr 1-1
+attr p01-1-1.noarch@available solvable:name p01
+attr p01-1-1.noarch@available solvable:provides p01 = 1-1
+attr p01-1-1.noarch@available solvable:summary summary of package p01
+attr p02-1-1.noarch@available solvable:arch noarch
+attr p02-1-1.noarch@available solvable:buildtime 1000002
+attr p02-1-1.noarch@available solvable:evr 1-1
+attr p02-1-1.noarch@available solvable:name p02
+attr p02-1-1.noarch@available solvable:provides p02 = 1-1
+attr p02-1-1.noarch@available solvable:summary summary of package p02
+attr p03-1-1.noarch@available solvable:arch noarch
+attr p03-1-1.noarch@available solvable:buildtime 1000003
+attr p03-1-1.noarch@available solvable:evr 1-1
+attr p03-1-1.noarch@available solvable:name p03
+attr p03-1-1.noarch@available solvable:provides p03 = 1-1
+attr p03-1-1.noarch@available solvable:summary summary of package p03
+attr p04-1-1.noarch@available solvable:arch noarch
+attr p04-1-1.noarch@available solvable:buildtime 1000004
+attr p04-1-1.noarch@available solvable:evr 1-1
+attr p04-1-1.noarch@available solvable:name p04
+attr p04-1-1.noarch@available solvable:provides p04 = 1-1
+attr p04-1-1.noarch@available solvable:summary summary of package p04
+attr p05-1-1.noarch@available solvable:arch noarch
+attr p05-1-1.noarch@available solvable:buildtime 1000005
+attr p05-1-1.noarch@available solvable:evr 1-1
+attr p05-1-1.noarch@available solvable:name p05
+attr p05-1-1.noarch@available solvable:provides p05 = 1-1
+attr p05-1-1.noarch@available solvable:summary summary of package p05
+attr p06-1-1.noarch@available solvable:arch noarch
+attr p06-1-1.noarch@available solvable:buildtime 1000006
+attr p06-1-1.noarch@available solvable:evr 1-1
+attr p06-1-1.noarch@available solvable:name p06
+attr p06-1-1.noarch@available solvable:provides p06 = 1-1
+attr p06-1-1.noarch@available solvable:summary summary of package p06
+attr p07-1-1.noarch@available solvable:arch noarch
+attr p07-1-1.noarch@available solvable:buildtime 1000007
+attr p07-1-1.noarch@available solvable:evr 1-1
+attr p07-1-1.noarch@available solvable:name p07
+attr p07-1-1.noarch@available solvable:provides p07 = 1-1
+attr p07-1-1.noarch@available solvable:summary summary of package p07
+attr p08-1-1.noarch@available solvable:arch noarch
+attr p08-1-1.noarch@available solvable:buildtime 1000008
+attr p08-1-1.noarch@available solvable:evr 1-1
+attr p08-1-1.noarch@available solvable:name p08
+attr p08-1-1.noarch@available solvable:provides p08 = 1-1
+attr p08-1-1.noarch@available solvable:summary summary of package p08
+attr p09-1-1.noarch@available solvable:arch noarch
+attr p09-1-1.noarch@available solvable:buildtime 1000009
+attr p09-1-1.noarch@available solvable:evr 1-1
+attr p09-1-1.noarch@available solvable:name p09
+attr p09-1-1.noarch@available solvable:provides p09 = 1-1
+attr p09-1-1.noarch@available solvable:summary summary of package p09
+attr p10-1-1.noarch@available solvable:arch noarch
+attr p10-1-1.noarch@available solvable:buildtime 1000010
+attr p10-1-1.noarch@available solvable:evr 1-1
+attr p10-1-1.noarch@available solvable:name p10
+attr p10-1-1.noarch@available solvable:provides p10 = 1-1
+attr p10-1-1.noarch@available solvable:summary summary of package p10
+attr p11-1-1.noarch@available solvable:arch noarch
+attr p11-1-1.noarch@available solvable:buildtime 1000011
+attr p11-1-1.noarch@available solvable:evr 1-1
+attr p11-1-1.noarch@available solvable:name p11
+attr p11-1-1.noarch@available solvable:provides p11 = 1-1
+attr p11-1-1.noarch@available solvable:summary summary of package p11
+attr p12-1-1.noarch@available solvable:arch noarch
+attr p12-1-1.noarch@available solvable:buildtime 1000012
+attr p12-1-1.noarch@available solvable:evr 1-1
+attr p12-1-1.noarch@available solvable:name p12
+attr p12-1-1.noarch@available solvable:provides p12 = 1-1
+attr p12-1-1.noarch@available solvable:summary summary of package p12
+attr p13-1-1.noarch@available solvable:arch noarch
+attr p13-1-1.noarch@available solvable:buildtime 1000013
+attr p13-1-1.noarch@available solvable:evr 1-1
+attr p13-1-1.noarch@available solvable:name p13
+attr p13-1-1.noarch@available solvable:provides p13 = 1-1
+attr p13-1-1.noarch@available solvable:summary summary of package p13
+attr p14-1-1.noarch@available solvable:arch noarch
+attr p14-1-1.noarch@available solvable:buildtime 1000014
+attr p14-1-1.noarch@available solvable:evr 1-1
+attr p14-1-1.noarch@available solvable:name p14
+attr p14-1-1.noarch@available solvable:provides p14 = 1-1
+attr p14-1-1.noarch@available solvable:summary summary of package p14
+attr p15-1-1.noarch@available solvable:arch noarch
+attr p15-1-1.noarch@available solvable:buildtime 1000015
+attr p15-1-1.noarch@available solvable:evr 1-1
+attr p15-1-1.noarch@available solvable:name p15
+attr p15-1-1.noarch@available solvable:provides p15 = 1-1
+attr p15-1-1.noarch@available solvable:summary summary of package p15
+attr p16-1-1.noarch@available solvable:arch noarch
+attr p16-1-1.noarch@available solvable:buildtime 1000016
+attr p16-1-1.noarch@available solvable:evr 1-1
+attr p16-1-1.noarch@available solvable:name p16
+attr p16-1-1.noarch@available solvable:provides p16 = 1-1
+attr p16-1-1.noarch@available solvable:summary summary of package p16
+attr p17-1-1.noarch@available solvable:arch noarch
+attr p17-1-1.noarch@available solvable:buildtime 1000017
+attr p17-1-1.noarch@available solvable:evr 1-1
+attr p17-1-1.noarch@available solvable:name p17
+attr p17-1-1.noarch@available solvable:provides p17 = 1-1
+attr p17-1-1.noarch@available solvable:summary summary of package p17
+attr p18-1-1.noarch@available solvable:arch noarch
+attr p18-1-1.noarch@available solvable:buildtime 1000018
+attr p18-1-1.noarch@available solvable:evr 1-1
+attr p18-1-1.noarch@available solvable:name p18
+attr p18-1-1.noarch@available solvable:provides p18 = 1-1
+attr p18-1-1.noarch@available solvable:summary summary of package p18
+attr p19-1-1.noarch@available solvable:arch noarch
+attr p19-1-1.noarch@available solvable:buildtime 1000019
+attr p19-1-1.noarch@available solvable:evr 1-1
+attr p19-1-1.noarch@available solvable:name p19
+attr p19-1-1.noarch@available solvable:provides p19 = 1-1
+attr p19-1-1.noarch@available solvable:summary summary of package p19
+attr p20-1-1.noarch@available solvable:arch noarch
+attr p20-1-1.noarch@available solvable:buildtime 1000020
+attr p20-1-1.noarch@available solvable:evr 1-1
+attr p20-1-1.noarch@available solvable:name p20
+attr p20-1-1.noarch@available solvable:provides p20 = 1-1
+attr p20-1-1.noarch@available solvable:summary summary of package p20
+attr p21-1-1.noarch@available solvable:arch noarch
+attr p21-1-1.noarch@available solvable:buildtime 1000021
+attr p21-1-1.noarch@available solvable:evr 1-1
+attr p21-1-1.noarch@available solvable:name p21
+attr p21-1-1.noarch@available solvable:provides p21 = 1-1
+attr p21-1-1.noarch@available solvable:summary summary of package p21
+attr p22-1-1.noarch@available solvable:arch noarch
+attr p22-1-1.noarch@available solvable:buildtime 1000022
+attr p22-1-1.noarch@available solvable:evr 1-1
+attr p22-1-1.noarch@available solvable:name p22
+attr p22-1-1.noarch@available solvable:provides p22 = 1-1
+attr p22-1-1.noarch@available solvable:summary summary of package p22
+attr p23-1-1.noarch@available solvable:arch noarch
+attr p23-1-1.noarch@available solvable:buildtime 1000023
+attr p23-1-1.noarch@available solvable:evr 1-1
+attr p23-1-1.noarch@available solvable:name p23
+attr p23-1-1.noarch@available solvable:provides p23 = 1-1
+attr p23-1-1.noarch@available solvable:summary summary of package p23
+attr p24-1-1.noarch@available solvable:arch noarch
+attr p24-1-1.noarch@available solvable:buildtime 1000024
+attr p24-1-1.noarch@available solvable:evr 1-1
+attr p24-1-1.noarch@available solvable:name p24
+attr p24-1-1.noarch@available solvable:provides p24 = 1-1
+attr p24-1-1.noarch@available solvable:summary summary of package p24
+attr p25-1-1.noarch@available solvable:arch noarch
+attr p25-1-1.noarch@available solvable:buildtime 1000025
+attr p25-1-1.noarch@available solvable:evr 1-1
+attr p25-1-1.noarch@available solvable:name p25
+attr p25-1-1.noarch@available solvable:provides p25 = 1-1
+attr p25-1-1.noarch@available solvable:summary summary of package p25
+attr p26-1-1.noarch@available solvable:arch noarch
+attr p26-1-1.noarch@available solvable:buildtime 1000026
+attr p26-1-1.noarch@available solvable:evr 1-1
+attr p26-1-1.noarch@available solvable:name p26
+attr p26-1-1.noarch@available solvable:provides p26 = 1-1
+attr p26-1-1.noarch@available solvable:summary summary of package p26
+attr p27-1-1.noarch@available solvable:arch noarch
+attr p27-1-1.noarch@available solvable:buildtime 1000027
+attr p27-1-1.noarch@available solvable:evr 1-1
+attr p27-1-1.noarch@available solvable:name p27
+attr p27-1-1.noarch@available solvable:provides p27 = 1-1
+attr p27-1-1.noarch@available solvable:summary summary of package p27
+attr p28-1-1.noarch@available solvable:arch noarch
+attr p28-1-1.noarch@available solvable:buildtime 1000028
+attr p28-1-1.noarch@available solvable:evr 1-1
+attr p28-1-1.noarch@available solvable:name p28
+attr p28-1-1.noarch@available solvable:provides p28 = 1-1
+attr p28-1-1.noarch@available solvable:summary summary of package p28
+attr p29-1-1.noarch@available solvable:arch noarch
+attr p29-1-1.noarch@available solvable:buildtime 1000029
+attr p29-1-1.noarch@available solvable:evr 1-1
+attr p29-1-1.noarch@available solvable:name p29
+attr p29-1-1.noarch@available solvable:provides p29 = 1-1
+attr p29-1-1.noarch@available solvable:summary summary of package p29
+attr p30-1-1.noarch@available solvable:arch noarch
+attr p30-1-1.noarch@available solvable:buildtime 1000030
+attr p30-1-1.noarch@available solvable:evr 1-1
+attr p30-1-1.noarch@available solvable:name p30
+attr p30-1-1.noarch@available solvable:provides p30 = 1-1
+attr p30-1-1.noarch@available solvable:summary summary of package p30
+attr p31-1-1.noarch@available solvable:arch noarch
+attr p31-1-1.noarch@available solvable:buildtime 1000031
+attr p31-1-1.noarch@available solvable:evr 1-1
+attr p31-1-1.noarch@available solvable:name p31
+attr p31-1-1.noarch@available solvable:provides p31 = 1-1
+attr p31-1-1.noarch@available solvable:summary summary of package p31
+attr p32-1-1.noarch@available solvable:arch noarch
+attr p32-1-1.noarch@available solvable:buildtime 1000032
+attr p32-1-1.noarch@available solvable:evr 1-1
+attr p32-1-1.noarch@available solvable:name p32
+attr p32-1-1.noarch@available solvable:provides p32 = 1-1
+attr p32-1-1.noarch@available solvable:summary summary of package p32
+attr p33-1-1.noarch@available solvable:arch noarch
+attr p33-1-1.noarch@available solvable:buildtime 1000033
+attr p33-1-1.noarch@available solvable:evr 1-1
+attr p33-1-1.noarch@available solvable:name p33
+attr p33-1-1.noarch@available solvable:provides p33 = 1-1
+attr p33-1-1.noarch@available solvable:summary summary of package p33
+attr p34-1-1.noarch@available solvable:arch noarch
+attr p34-1-1.noarch@available solvable:buildtime 1000034
+attr p34-1-1.noarch@available solvable:evr 1-1
+attr p34-1-1.noarch@available solvable:name p34
+attr p34-1-1.noarch@available solvable:provides p34 = 1-1
+attr p34-1-1.noarch@available solvable:summary summary of package p34
+attr p35-1-1.noarch@available solvable:arch noarch
+attr p35-1-1.noarch@available solvable:buildtime 1000035
+attr p35-1-1.noarch@available solvable:evr 1-1
+attr p35-1-1.noarch@available solvable:name p35
+attr p35-1-1.noarch@available solvable:provides p35 = 1-1
+attr p35-1-1.noarch@available solvable:summary summary of package p35
+attr p36-1-1.noarch@available solvable:arch noarch
+attr p36-1-1.noarch@available solvable:buildtime 1000036
+attr p36-1-1.noarch@available solvable:evr 1-1
+attr p36-1-1.noarch@available solvable:name p36
+attr p36-1-1.noarch@available solvable:provides p36 = 1-1
+attr p36-1-1.noarch@available solvable:summary summary of package p36
+attr p37-1-1.noarch@available solvable:arch noarch
+attr p37-1-1.noarch@available solvable:buildtime 1000037
+attr p37-1-1.noarch@available solvable:evr 1-1
+attr p37-1-1.noarch@available solvable:name p37
+attr p37-1-1.noarch@available solvable:provides p37 = 1-1
+attr p37-1-1.noarch@available solvable:summary summary of package p37
+attr p38-1-1.noarch@available solvable:arch noarch
+attr p38-1-1.noarch@available solvable:buildtime 1000038
+attr p38-1-1.noarch@available solvable:evr 1-1
+attr p38-1-1.noarch@available solvable:name p38
+attr p38-1-1.noarch@available solvable:provides p38 = 1-1
+attr p38-1-1.noarch@available solvable:summary summary of package p38
+attr p39-1-1.noarch@available solvable:arch noarch
+attr p39-1-1.noarch@available solvable:buildtime 1000039
+attr p39-1-1.noarch@available solvable:evr 1-1
+attr p39-1-1.noarch@available solvable:name p39
+attr p39-1-1.noarch@available solvable:provides p39 = 1-1
+attr p39-1-1.noarch@available solvable:summary summary of package p39
+attr p40-1-1.noarch@available solvable:arch noarch
+attr p40-1-1.noarch@available solvable:buildtime 1000040
+attr p40-1-1.noarch@available solvable:evr 1-1
+attr p40-1-1.noarch@available solvable:name p40
+attr p40-1-1.noarch@available solvable:provides p40 = 1-1
+attr p40-1-1.noarch@available solvable:summary summary of package p40
+attr p41-1-1.noarch@available solvable:arch noarch
+attr p41-1-1.noarch@available solvable:buildtime 1000041
+attr p41-1-1.noarch@available solvable:evr 1-1
+attr p41-1-1.noarch@available solvable:name p41
+attr p41-1-1.noarch@available solvable:provides p41 = 1-1
+attr p41-1-1.noarch@available solvable:summary summary of package p41
+attr p42-1-1.noarch@available solvable:arch noarch
+attr p42-1-1.noarch@available solvable:buildtime 1000042
+attr p42-1-1.noarch@available solvable:evr 1-1
+attr p42-1-1.noarch@available solvable:name p42
+attr p42-1-1.noarch@available solvable:provides p42 = 1-1
+attr p42-1-1.noarch@available solvable:summary summary of package p42
+attr p43-1-1.noarch@available solvable:arch noarch
+attr p43-1-1.noarch@available solvable:buildtime 1000043
+attr p43-1-1.noarch@available solvable:evr 1-1
+attr p43-1-1.noarch@available solvable:name p43
+attr p43-1-1.noarch@available solvable:provides p43 = 1-1
+attr p43-1-1.noarch@available solvable:summary summary of package p43
+attr p44-1-1.noarch@available solvable:arch noarch
+attr p44-1-1.noarch@available solvable:buildtime 1000044
+attr p44-1-1.noarch@available solvable:evr 1-1
+attr p44-1-1.noarch@available solvable:name p44
+attr p44-1-1.noarch@available solvable:provides p44 = 1-1
+attr p44-1-1.noarch@available solvable:summary summary of package p44
+attr p45-1-1.noarch@available solvable:arch noarch
+attr p45-1-1.noarch@available solvable:buildtime 1000045
+attr p45-1-1.noarch@available solvable:evr 1-1
+attr p45-1-1.noarch@available solvable:name p45
+attr p45-1-1.noarch@available solvable:provides p45 = 1-1
+attr p45-1-1.noarch@available solvable:summary summary of package p45
+attr p46-1-1.noarch@available solvable:arch noarch
+attr p46-1-1.noarch@available solvable:buildtime 1000046
+attr p46-1-1.noarch@available solvable:evr 1-1
+attr p46-1-1.noarch@available solvable:name p46
+attr p46-1-1.noarch@available solvable:provides p46 = 1-1
+attr p46-1-1.noarch@available solvable:summary summary of package p46
+attr p47-1-1.noarch@available solvable:arch noarch
+attr p47-1-1.noarch@available solvable:buildtime 1000047
+attr p47-1-1.noarch@available solvable:evr 1-1
+attr p47-1-1.noarch@available solvable:name p47
+attr p47-1-1.noarch@available solvable:provides p47 = 1-1
+attr p47-1-1.noarch@available solvable:summary summary of package p47
+attr p48-1-1.noarch@available solvable:arch noarch
+attr p48-1-1.noarch@available solvable:buildtime 1000048
+attr p48-1-1.noarch@available solvable:evr 1-1
+attr p48-1-1.noarch@available solvable:name p48
+attr p48-1-1.noarch@available solvable:provides p48 = 1-1
+attr p48-1-1.noarch@available solvable:summary summary of package p48
+attr p49-1-1.noarch@available solvable:arch noarch
+attr p49-1-1.noarch@available solvable:buildtime 1000049
+attr p49-1-1.noarch@available solvable:evr 1-1
+attr p49-1-1.noarch@available solvable:name p49
+attr p49-1-1.noarch@available solvable:provides p49 = 1-1
+attr p49-1-1.noarch@available solvable:summary summary of package p49
+attr p50-1-1.noarch@available solvable:arch noarch
+attr p50-1-1.noarch@available solvable:buildtime 1000050
+attr p50-1-1.noarch@available solvable:evr 1-1
+attr p50-1-1.noarch@available solvable:name p50
+attr p50-1-1.noarch@available solvable:provides p50 = 1-1
+attr p50-1-1.noarch@available solvable:summary summary of package p50
+attr p51-1-1.noarch@available solvable:arch noarch
+attr p51-1-1.noarch@available solvable:buildtime 1000051
+attr p51-1-1.noarch@available solvable:evr 1-1
+attr p51-1-1.noarch@available solvable:name p51
+attr p51-1-1.noarch@available solvable:provides p51 = 1-1
+attr p51-1-1.noarch@available solvable:summary summary of package p51
+attr p52-1-1.noarch@available solvable:arch noarch
+attr p52-1-1.noarch@available solvable:buildtime 1000052
+attr p52-1-1.noarch@available solvable:evr 1-1
+attr p52-1-1.noarch@available solvable:name p52
+attr p52-1-1.noarch@available solvable:provides p52 = 1-1
+attr p52-1-1.noarch@available solvable:summary summary of package p52
+attr p53-1-1.noarch@available solvable:arch noarch
+attr p53-1-1.noarch@available solvable:buildtime 1000053
+attr p53-1-1.noarch@available solvable:evr 1-1
+attr p53-1-1.noarch@available solvable:name p53
+attr p53-1-1.noarch@available solvable:provides p53 = 1-1
+attr p53-1-1.noarch@available solvable:summary summary of package p53
+attr p54-1-1.noarch@available solvable:arch noarch
+attr p54-1-1.noarch@available solvable:buildtime 1000054
+attr p54-1-1.noarch@available solvable:evr 1-1
+attr p54-1-1.noarch@available solvable:name p54
+attr p54-1-1.noarch@available solvable:provides p54 = 1-1
+attr p54-1-1.noarch@available solvable:summary summary of package p54
+attr p55-1-1.noarch@available solvable:arch noarch
+attr p55-1-1.noarch@available solvable:buildtime 1000055
+attr p55-1-1.noarch@available solvable:evr 1-1
+attr p55-1-1.noarch@available solvable:name p55
+attr p55-1-1.noarch@available solvable:provides p55 = 1-1
+attr p55-1-1.noarch@available solvable:summary summary of package p55
+attr p56-1-1.noarch@available solvable:arch noarch
+attr p56-1-1.noarch@available solvable:buildtime 1000056
+attr p56-1-1.noarch@available solvable:evr 1-1
+attr p56-1-1.noarch@available solvable:name p56
+attr p56-1-1.noarch@available solvable:provides p56 = 1-1
+attr p56-1-1.noarch@available solvable:summary summary of package p56
+attr p57-1-1.noarch@available solvable:arch noarch
+attr p57-1-1.noarch@available solvable:buildtime 1000057
+attr p57-1-1.noarch@available solvable:evr 1-1
+attr p57-1-1.noarch@available solvable:name p57
+attr p57-1-1.noarch@available solvable:provides p57 = 1-1
+attr p57-1-1.noarch@available solvable:summary summary of package p57
+attr p58-1-1.noarch@available solvable:arch noarch
+attr p58-1-1.noarch@available solvable:buildtime 1000058
+attr p58-1-1.noarch@available solvable:evr 1-1
+attr p58-1-1.noarch@available solvable:name p58
+attr p58-1-1.noarch@available solvable:provides p58 = 1-1
+attr p58-1-1.noarch@available solvable:summary summary of package p58
+attr p59-1-1.noarch@available solvable:arch noarch
+attr p59-1-1.noarch@available solvable:buildtime 1000059
+attr p59-1-1.noarch@available solvable:evr 1-1
+attr p59-1-1.noarch@available solvable:name p59
+attr p59-1-1.noarch@available solvable:provides p59 = 1-1
+attr p59-1-1.noarch@available solvable:summary summary of package p59
+attr p60-1-1.noarch@available solvable:arch noarch
+attr p60-1-1.noarch@available solvable:buildtime 1000060
+attr p60-1-1.noarch@available solvable:evr 1-1
+attr p60-1-1.noarch@available solvable:name p60
+attr p60-1-1.noarch@available solvable:provides p60 = 1-1
+attr p60-1-1.noarch@available solvable:summary summary of package p60
+attr p61-1-1.noarch@available solvable:arch noarch
+attr p61-1-1.noarch@available solvable:buildtime 1000061
+attr p61-1-1.noarch@available solvable:evr 1-1
+attr p61-1-1.noarch@available solvable:name p61
+attr p61-1-1.noarch@available solvable:provides p61 = 1-1
+attr p61-1-1.noarch@available solvable:summary summary of package p61
+attr p62-1-1.noarch@available solvable:arch noarch
+attr p62-1-1.noarch@available solvable:buildtime 1000062
+attr p62-1-1.noarch@available solvable:evr 1-1
+attr p62-1-1.noarch@available solvable:name p62
+attr p62-1-1.noarch@available solvable:provides p62 = 1-1
+attr p62-1-1.noarch@available solvable:summary summary of package p62
+attr p63-1-1.noarch@available solvable:arch noarch
+attr p63-1-1.noarch@available solvable:buildtime 1000063
+attr p63-1-1.noarch@available solvable:evr 1-1
+attr p63-1-1.noarch@available solvable:name p63
+attr p63-1-1.noarch@available solvable:provides p63 = 1-1
+attr p63-1-1.noarch@available solvable:summary summary of package p63
+attr p64-1-1.noarch@available solvable:arch noarch
+attr p64-1-1.noarch@available solvable:buildtime 1000064
+attr p64-1-1.noarch@available solvable:evr 1-1
+attr p64-1-1.noarch@available solvable:name p64
+attr p64-1-1.noarch@available solvable:provides p64 = 1-1
+attr p64-1-1.noarch@available solvable:summary summary of package p64
+attr p65-1-1.noarch@available solvable:arch noarch
+attr p65-1-1.noarch@available solvable:buildtime 1000065
+attr p65-1-1.noarch@available solvable:evr 1-1
+attr p65-1-1.noarch@available solvable:name p65
+attr p65-1-1.noarch@available solvable:provides p65 = 1-1
+attr p65-1-1.noarch@available solvable:summary summary of package p65
+attr p66-1-1.noarch@available solvable:arch noarch
+attr p66-1-1.noarch@available solvable:buildtime 1000066
+attr p66-1-1.noarch@available solvable:evr 1-1
+attr p66-1-1.noarch@available solvable:name p66
+attr p66-1-1.noarch@available solvable:provides p66 = 1-1
+attr p66-1-1.noarch@available solvable:summary summary of package p66
+attr p67-1-1.noarch@available solvable:arch noarch
+attr p67-1-1.noarch@available solvable:buildtime 1000067
+attr p67-1-1.noarch@available solvable:evr 1-1
+attr p67-1-1.noarch@available solvable:name p67
+attr p67-1-1.noarch@available solvable:provides p67 = 1-1
+attr p67-1-1.noarch@available solvable:summary summary of package p67
+attr p68-1-1.noarch@available solvable:arch noarch
+attr p68-1-1.noarch@available solvable:buildtime 1000068
+attr p68-1-1.noarch@available solvable:evr 1-1
+attr p68-1-1.noarch@available solvable:name p68
+attr p68-1-1.noarch@available solvable:provides p68 = 1-1
+attr p68-1-1.noarch@available solvable:summary summary of package p68
+attr p69-1-1.noarch@available solvable:arch noarch
+attr p69-1-1.noarch@available solvable:buildtime 1000069
+attr p69-1-1.noarch@available solvable:evr 1-1
+attr p69-1-1.noarch@available solvable:name p69
+attr p69-1-1.noarch@available solvable:provides p69 = 1-1
+attr p69-1-1.noarch@available solvable:summary summary of package p69
+attr p70-1-1.noarch@available solvable:arch noarch
+attr p70-1-1.noarch@available solvable:buildtime 1000070
+attr p70-1-1.noarch@available solvable:evr 1-1
+attr p70-1-1.noarch@available solvable:name p70
+attr p70-1-1.noarch@available solvable:provides p70 = 1-1
+attr p70-1-1.noarch@available solvable:summary summary of package p70
+attr p71-1-1.noarch@available solvable:arch noarch
+attr p71-1-1.noarch@available solvable:buildtime 1000071
+attr p71-1-1.noarch@available solvable:evr 1-1
+attr p71-1-1.noarch@available solvable:name p71
+attr p71-1-1.noarch@available solvable:provides p71 = 1-1
+attr p71-1-1.noarch@available solvable:summary summary of package p71
+attr p72-1-1.noarch@available solvable:arch noarch
+attr p72-1-1.noarch@available solvable:buildtime 1000072
+attr p72-1-1.noarch@available solvable:evr 1-1
+attr p72-1-1.noarch@available solvable:name p72
+attr p72-1-1.noarch@available solvable:provides p72 = 1-1
+attr p72-1-1.noarch@available solvable:summary summary of package p72
+attr p73-1-1.noarch@available solvable:arch noarch
+attr p73-1-1.noarch@available solvable:buildtime 1000073
+attr p73-1-1.noarch@available solvable:evr 1-1
+attr p73-1-1.noarch@available solvable:name p73
+attr p73-1-1.noarch@available solvable:provides p73 = 1-1
+attr p73-1-1.noarch@available solvable:summary summary of package p73
+attr p74-1-1.noarch@available solvable:arch noarch
+attr p74-1-1.noarch@available solvable:buildtime 1000074
+attr p74-1-1.noarch@available solvable:evr 1-1
+attr p74-1-1.noarch@available solvable:name p74
+attr p74-1-1.noarch@available solvable:provides p74 = 1-1
+attr p74-1-1.noarch@available solvable:summary summary of package p74
+attr p75-1-1.noarch@available solvable:arch noarch
+attr p75-1-1.noarch@available solvable:buildtime 1000075
+attr p75-1-1.noarch@available solvable:evr 1-1
+attr p75-1-1.noarch@available solvable:name p75
+attr p75-1-1.noarch@available solvable:provides p75 = 1-1
+attr p75-1-1.noarch@available solvable:summary summary of package p75
+attr p76-1-1.noarch@available solvable:arch noarch
+attr p76-1-1.noarch@available solvable:buildtime 1000076
+attr p76-1-1.noarch@available solvable:evr 1-1
+attr p76-1-1.noarch@available solvable:name p76
+attr p76-1-1.noarch@available solvable:provides p76 = 1-1
+attr p76-1-1.noarch@available solvable:summary summary of package p76
+attr p77-1-1.noarch@available solvable:arch noarch
+attr p77-1-1.noarch@available solvable:buildtime 1000077
+attr p77-1-1.noarch@available solvable:evr 1-1
+attr p77-1-1.noarch@available solvable:name p77
+attr p77-1-1.noarch@available solvable:provides p77 = 1-1
+attr p77-1-1.noarch@available solvable:summary summary of package p77
+attr p78-1-1.noarch@available solvable:arch noarch
+attr p78-1-1.noarch@available solvable:buildtime 1000078
+attr p78-1-1.noarch@available solvable:evr 1-1
+attr p78-1-1.noarch@available solvable:name p78
+attr p78-1-1.noarch@available solvable:provides p78 = 1-1
+attr p78-1-1.noarch@available solvable:summary summary of package p78
+attr p79-1-1.noarch@available solvable:arch noarch
+attr p79-1-1.noarch@available solvable:buildtime 1000079
+attr p79-1-1.noarch@available solvable:evr 1-1
+attr p79-1-1.noarch@available solvable:name p79
+attr p79-1-1.noarch@available solvable:provides p79 = 1-1
+attr p79-1-1.noarch@available solvable:summary summary of package p79
@@ -0,0 +1,10 @@
+# look up the summary and buildtime of enough packages that key indexes
+# get built. The attributes dump checks that the lookups find the same
+# values as the dataiterator, before and after a reload.
+repo system 0 empty
+repo available 0 testtags keyindex.repo
+system i686 rpm system
+result attributes keyindex.res
+nextjob
+reload available
+result attributes keyindex.res
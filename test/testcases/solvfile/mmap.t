@@ -0,0 +1,15 @@
+# reload repos with uncompressed vertical data pages, the data
+# must not change if the solv file is mapped into memory
+repo system 0 empty
+repo available 0 testtags pages.repo
+repo single 0 testtags single.repo
+system i686 rpm system
+result attributes pages.res
+nextjob
+reload available
+reload single
+result attributes pages.res
+nextjob
+reload available mmap
+reload single mmap
+result attributes pages.res
@@ -0,0 +1,29 @@
+# walk twice over paged data with different page cache growth
+# allowances. files.repo has five pages, one more than the fixed
+# pages of a repository. The fixed pages are kept even if the
+# allowance is smaller, with enough allowance all pages stay loaded.
+repo system 0 empty
+repo available 0 testtags files.repo
+system i686 rpm system
+reload available pagecodec=lz
+result pagecache <inline>
+#>pagecache evictions 6
+#>pagecache hits 41
+#>pagecache misses 9
+#>pagecache used 131072
+nextjob
+pagecache 32768
+reload available pagecodec=lz
+result pagecache <inline>
+#>pagecache evictions 6
+#>pagecache hits 41
+#>pagecache misses 9
+#>pagecache used 131072
+nextjob
+pagecache 1048576
+reload available pagecodec=lz
+result pagecache <inline>
+#>pagecache evictions 0
+#>pagecache hits 45
+#>pagecache misses 5
+#>pagecache used 163840
@@ -0,0 +1,1092 @@
+attr pkg0-1-1.noarch@available solvable:arch noarch
+attr pkg0-1-1.noarch@available solvable:buildtime 1600000000
+attr pkg0-1-1.noarch@available solvable:evr 1-1
+attr pkg0-1-1.noarch@available solvable:filelist /usr/share/pkg0/d0/.=>+eaeoO4C^5kYW&4hc2-PlD:FxF*&s
+attr pkg0-1-1.noarch@available solvable:filelist /usr/share/pkg0/d0/Czu>T)fD'+TJ^%lv~b=BdU͵'KWZZE_
+attr pkg0-1-1.noarch@available solvable:filelist /usr/share/pkg0/d0/v6*k,k~s&ES(h`G.@>6UVeP$+P]i|K]
+attr pkg0-1-1.noarch@available solvable:filelist /usr/share/pkg0/d0/}!9(̢$?HbLMvWnj2r@qJP2&+t>URZ`]
+attr pkg0-1-1.noarch@available solvable:filelist /usr/share/pkg0/d0/սSRɿR;qG:,ޫK%32+Sa)wU_o"8k8e
+attr pkg0-1-1.noarch@available solvable:filelist /usr/share/pkg0/d0/U,2$if(+=[k59L`~Xz{E6AYfIJwnR;v7
+attr pkg0-1-1.noarch@available solvable:filelist /usr/share/pkg0/d0/R5{q<$._ipzZQ6YA'@>`e.U$<fdj{Ȱ<
+attr pkg0-1-1.noarch@available solvable:filelist /usr/share/pkg0/d1/*'64suE56Ѥ-D{~86)%裏%57:@exڻ8)s9'
+attr pkg0-1-1.noarch@available solvable:filelist /usr/share/pkg0/d1/9DU"{wW<BYb9svg&}8+{ұj)Z3*OyFI
+attr pkg0-1-1.noarch@available solvable:filelist /usr/share/pkg0/d1/RkOsf­{:[.ZEj1`$cKKvHfDh0IP!WIC8~
+attr pkg0-1-1.noarch@available solvable:filelist /usr/share/pkg0/d1/t^m)4>>n4&!YX05Uiz9sy%AEc<$2PSSD@Y
+attr pkg0-1-1.noarch@available solvable:filelist /usr/share/pkg0/d1/6-KN1ıl̬smilo(%b,K0t.u5]db
+attr pkg0-1-1.noarch@available solvable:filelist /usr/share/pkg0/d1/8p$6sY7qwlG[wAvkru[c8(۩T֤
+attr pkg0-1-1.noarch@available solvable:filelist /usr/share/pkg0/d1/|QttTZT;EaD9f;CV&;V@{S5>(+HSR@WOKl
+attr pkg0-1-1.noarch@available solvable:filelist /usr/share/pkg0/d2/!iq'XR<,HYf$xo56:Xb%ߤCEQJs^cSKU7
+attr pkg0-1-1.noarch@available solvable:filelist /usr/share/pkg0/d2/-<Gb@.尺AW0JBFgFnCa@sjiSkaSc
+attr pkg0-1-1.noarch@available solvable:filelist /usr/share/pkg0/d2/;2E6;w~Xߥ%,VQTM;%v8S{fk@KExQW
+attr pkg0-1-1.noarch@available solvable:filelist /usr/share/pkg0/d2/^?e$qGVN{awdUVY[uXEE},3jN?jYt
+attr pkg0-1-1.noarch@available solvable:filelist /usr/share/pkg0/d2/JPP9l'[1Ko'3r8y7j=t8(G;b[z}zyE5-
+attr pkg0-1-1.noarch@available solvable:filelist /usr/share/pkg0/d2/9[nMesXqGiV@")-ʬB:M3ϻhc
+attr pkg0-1-1.noarch@available solvable:name pkg0
+attr pkg0-1-1.noarch@available solvable:provides cap0 = 0
+attr pkg0-1-1.noarch@available solvable:summary package number 0
+attr pkg1-2-1.noarch@available solvable:arch noarch
+attr pkg1-2-1.noarch@available solvable:buildtime 1600003601
+attr pkg1-2-1.noarch@available solvable:evr 2-1
+attr pkg1-2-1.noarch@available solvable:filelist /usr/share/pkg1/d0/6i(s3ɽ$X3$gbĬr<d($G^vj~sk4v;gyYQY.D
+attr pkg1-2-1.noarch@available solvable:filelist /usr/share/pkg1/d0/9NecK޺2tZ,CEH,!aG:p6*^odAa9^sz
+attr pkg1-2-1.noarch@available solvable:filelist /usr/share/pkg1/d0/Ebٰyx:hBEa3gNyHB!maآMR6*QFr&KV*G
+attr pkg1-2-1.noarch@available solvable:filelist /usr/share/pkg1/d0/i;8q&ST:X+ѯKsts6r46F>B%`o@
+attr pkg1-2-1.noarch@available solvable:filelist /usr/share/pkg1/d0/]=n|ZF,($p4Z~B`f:A2èxlk[KVM}a:{Ie
+attr pkg1-2-1.noarch@available solvable:filelist /usr/share/pkg1/d0/wPC34=s?,L0|dddwQyWDױChLCVn_R%
+attr pkg1-2-1.noarch@available solvable:filelist /usr/share/pkg1/d0/WVo2Ut~&OV`T.>rtjEy7N]rAUhQ`oi@^qQ
+attr pkg1-2-1.noarch@available solvable:filelist /usr/share/pkg1/d1/$WInpz9eSV?xsj־x:=G;DPQT+:<^*KB5{F
+attr pkg1-2-1.noarch@available solvable:filelist /usr/share/pkg1/d1/Z,L1{PY.Z|cRLWY޽rQWШ5.jj&QgɪZ
+attr pkg1-2-1.noarch@available solvable:filelist /usr/share/pkg1/d1/]jD:65-"ld9MlSbPk)RI*ۨ!2Q3v*nOM?
+attr pkg1-2-1.noarch@available solvable:filelist /usr/share/pkg1/d1/A׭OzDgby0+H=|֮l¼A@x˴(v0o㴦vr4bB
+attr pkg1-2-1.noarch@available solvable:filelist /usr/share/pkg1/d1/qWP|>JG}Q'$0;vW'Ov4>v[ŮPi4vQ$H1Y|
+attr pkg1-2-1.noarch@available solvable:filelist /usr/share/pkg1/d1/EhidF.KA,TmAx(N4sl]G٩ZlHO>d´AIv
+attr pkg1-2-1.noarch@available solvable:filelist /usr/share/pkg1/d1/r'A3i0pwd5(+|vpgR꾨{)Z6.Я3j4+E
+attr pkg1-2-1.noarch@available solvable:filelist /usr/share/pkg1/d2/&iGjjv^7Vf0I3"s7"QzFV*}ի1ZdjSnc.P(NA
+attr pkg1-2-1.noarch@available solvable:filelist /usr/share/pkg1/d2/bƫ0=ar`4ѱM[B5<DBٺ!obp(wO3ͫG_-r)trwG
+attr pkg1-2-1.noarch@available solvable:filelist /usr/share/pkg1/d2/h=1JFaA'v8we1qa,SIC*XsEftHWkE
+attr pkg1-2-1.noarch@available solvable:filelist /usr/share/pkg1/d2/isĢ'ITi^f[`!Ѫ!a7yg|=&tXKTLKyom`c
+attr pkg1-2-1.noarch@available solvable:filelist /usr/share/pkg1/d2/`e`f[f+V0ظQwI&ŵƷg)5@P`H0s,tg
+attr pkg1-2-1.noarch@available solvable:filelist /usr/share/pkg1/d2/WHx%ub&fxS{r>ԦWyo=Kdp_~GUU(U8
+attr pkg1-2-1.noarch@available solvable:name pkg1
+attr pkg1-2-1.noarch@available solvable:provides cap1 = 1
+attr pkg1-2-1.noarch@available solvable:requires cap0
+attr pkg1-2-1.noarch@available solvable:summary package number 1
+attr pkg10-2-1.noarch@available solvable:arch noarch
+attr pkg10-2-1.noarch@available solvable:buildtime 1600036010
+attr pkg10-2-1.noarch@available solvable:evr 2-1
+attr pkg10-2-1.noarch@available solvable:filelist /usr/share/pkg10/d0/MO"nWk%iJ=X]A]S`.$XD~o<H.sܫrx
+attr pkg10-2-1.noarch@available solvable:filelist /usr/share/pkg10/d0/d>zbj7qFwF|ӹ:.`6hBY+-1RfѱCAY(gXڨfIe3Wo
+attr pkg10-2-1.noarch@available solvable:filelist /usr/share/pkg10/d0/g7(׿U`D{Hλ|vAyi^9~FUy-Xo{0;
+attr pkg10-2-1.noarch@available solvable:filelist /usr/share/pkg10/d0/p2sNA<Z+<P8?c*-ZXMRB~G8r(qIz]P5,,WH.|Z+^>
+attr pkg10-2-1.noarch@available solvable:filelist /usr/share/pkg10/d0/:'*afVEe4Z:Z"n9k%hh-~WD!
+attr pkg10-2-1.noarch@available solvable:filelist /usr/share/pkg10/d0/[[k8_E]ǻdci4a3pJ=lv{<2mUPd(cԱYV{Alt
+attr pkg10-2-1.noarch@available solvable:filelist /usr/share/pkg10/d0/p+e'ݻJfwGl+s0&=!Id%sx6jMZ,ޥly{9
+attr pkg10-2-1.noarch@available solvable:filelist /usr/share/pkg10/d1/BOnydmF@7+ƹS_.Y붽)iY<|Y%oBH1=Y
+attr pkg10-2-1.noarch@available solvable:filelist /usr/share/pkg10/d1/HUg.o}bzĺN_Mps5p7󱪥l.y8Ze.=4Ubѹ
+attr pkg10-2-1.noarch@available solvable:filelist /usr/share/pkg10/d1/eMdt`&m!9E'[&_|tt0-Y%F$928s"Q1|{d4W3RT1aEw
+attr pkg10-2-1.noarch@available solvable:filelist /usr/share/pkg10/d1/$7;UiW0M*bSgi@ouDiZQخ)kA3
+attr pkg10-2-1.noarch@available solvable:filelist /usr/share/pkg10/d1/<$,_^V$>WPr=*6{Q̥꿾EƼK>uz(7
+attr pkg10-2-1.noarch@available solvable:filelist /usr/share/pkg10/d1/>X(h-E09z7ؼT5uA7os$bYSI)ʦh~Ϥ?(
+attr pkg10-2-1.noarch@available solvable:filelist /usr/share/pkg10/d1/Ph(!6_g?;T0a%WźLqM4!$Qg8&<xCެyޥ
+attr pkg10-2-1.noarch@available solvable:filelist /usr/share/pkg10/d2/=ilU6~7KV4"{RzLPc.Ryb_fͮR6'L
+attr pkg10-2-1.noarch@available solvable:filelist /usr/share/pkg10/d2/D5ܤvM8?CncMVSTd]"ǯM5:6>N-?YujŢc
+attr pkg10-2-1.noarch@available solvable:filelist /usr/share/pkg10/d2/YWZ޳D>ob饵^<oƾ"M~R1~B5_7$غzr,4v*l4x"lx<
+attr pkg10-2-1.noarch@available solvable:filelist /usr/share/pkg10/d2/d2]ĥKS?P(5Jb)]pIz.vE2qcv&CYZ.Ϣp.1
+attr pkg10-2-1.noarch@available solvable:filelist /usr/share/pkg10/d2/5u?a0*rreG":E4lLȨ1°"x*;`θ*)uhaL
+attr pkg10-2-1.noarch@available solvable:filelist /usr/share/pkg10/d2/Q`aR{R!lò=?%rF!tIv"Pkz_3bz@m[wyO43.
+attr pkg10-2-1.noarch@available solvable:name pkg10
+attr pkg10-2-1.noarch@available solvable:provides cap10 = 10
+attr pkg10-2-1.noarch@available solvable:requires cap9
+attr pkg10-2-1.noarch@available solvable:summary package number 10
+attr pkg11-3-1.noarch@available solvable:arch noarch
+attr pkg11-3-1.noarch@available solvable:buildtime 1600039611
+attr pkg11-3-1.noarch@available solvable:evr 3-1
+attr pkg11-3-1.noarch@available solvable:filelist /usr/share/pkg11/d0/+qUrt-9"LN1Sx:Q%P,cOذV|9ItP{]dkRf
+attr pkg11-3-1.noarch@available solvable:filelist /usr/share/pkg11/d0/@]T:"M<T|~G26GUwHHIkZXG..rY&*556?w?rc
+attr pkg11-3-1.noarch@available solvable:filelist /usr/share/pkg11/d0/Prr;z5ܯq=C-IwǦtY@)6bQ>W&*
+attr pkg11-3-1.noarch@available solvable:filelist /usr/share/pkg11/d0/eeժxH`%=A1ڣj!dQ{"b)vA.Fs(ݼY~a]U6s
+attr pkg11-3-1.noarch@available solvable:filelist /usr/share/pkg11/d0/9`^Of]-G&1YZ($xnA-=yf}v2bA[F.Iscd
+attr pkg11-3-1.noarch@available solvable:filelist /usr/share/pkg11/d0/ɺx<c!=@V:+9E=gI2E4@&bt|7lED`ҧJ^?Ylm
+attr pkg11-3-1.noarch@available solvable:filelist /usr/share/pkg11/d0/FbCUGc9XU5h"EqWh~Zhh]D6~rb*h9B_PyDys$
+attr pkg11-3-1.noarch@available solvable:filelist /usr/share/pkg11/d1/@95J49uNr`mHYib0b=KUYwQ]-w,OPxL{hpzM4&^f
+attr pkg11-3-1.noarch@available solvable:filelist /usr/share/pkg11/d1/jQsR&TH'%W.kY':qRMz]U|]lv7sO`,>.f6
+attr pkg11-3-1.noarch@available solvable:filelist /usr/share/pkg11/d1/m0CNp?kO.}qR8**)T[Jil%&qz'>ὦ-;(=h@~
+attr pkg11-3-1.noarch@available solvable:filelist /usr/share/pkg11/d1/nF)0=UZj;r@>VKDڦG_Flqd:7f!Z1=^VyMsgz
+attr pkg11-3-1.noarch@available solvable:filelist /usr/share/pkg11/d1/g[9U7^{Z[wK?E>KE.GY'"s!V5!"]W
+attr pkg11-3-1.noarch@available solvable:filelist /usr/share/pkg11/d1/ߩRGǯQ>y_Jy`J5й+yD']0t1>,ɤh<$VId8~~tH
+attr pkg11-3-1.noarch@available solvable:filelist /usr/share/pkg11/d1/WrDDnx<bxbC?ŧLȾQDpgjmQyLCfOBGr8U
+attr pkg11-3-1.noarch@available solvable:filelist /usr/share/pkg11/d2/(gQb,YԱ(G-:2(?oPaP*rĻYnսajrUn!(ñ
+attr pkg11-3-1.noarch@available solvable:filelist /usr/share/pkg11/d2/L:ٽ).si1r,89R-?=W2>G84CM.Lhq(|fA4s
+attr pkg11-3-1.noarch@available solvable:filelist /usr/share/pkg11/d2/7;<BN+w*AAo9sy';W+iIrx5sZ-+<vrP^}
+attr pkg11-3-1.noarch@available solvable:filelist /usr/share/pkg11/d2/SCj`Z?oT.DظPjfYz$x"㲣'8Uj6;ȳ0̺@Jr
+attr pkg11-3-1.noarch@available solvable:filelist /usr/share/pkg11/d2/;!̢4pڥEvAmN{sx5|'$=p7c`{CmiqJ6]|(=O
+attr pkg11-3-1.noarch@available solvable:filelist /usr/share/pkg11/d2/%y[i|[tUf0M.$ȪD!GfO]MG.'qCCnNO*
+attr pkg11-3-1.noarch@available solvable:name pkg11
+attr pkg11-3-1.noarch@available solvable:provides cap11 = 11
+attr pkg11-3-1.noarch@available solvable:requires cap10
+attr pkg11-3-1.noarch@available solvable:summary package number 11
+attr pkg12-1-1.noarch@available solvable:arch noarch
+attr pkg12-1-1.noarch@available solvable:buildtime 1600043212
+attr pkg12-1-1.noarch@available solvable:evr 1-1
+attr pkg12-1-1.noarch@available solvable:filelist /usr/share/pkg12/d0/91*KAn5`FP~WMC0-aܥ-[=<Zƣ($zosZ殫'~wk
+attr pkg12-1-1.noarch@available solvable:filelist /usr/share/pkg12/d0/NC2*h$:!~Ӵ8(r]O~8l6_B0GOy|m-g<!
+attr pkg12-1-1.noarch@available solvable:filelist /usr/share/pkg12/d0/SWBP2QDz)ɡ?%%Z+>V2O!eAWqz"&G`_۫Lj
+attr pkg12-1-1.noarch@available solvable:filelist /usr/share/pkg12/d0/:̷G(NwncR-l@I<EOFgmD!پjTpv1|")^A
+attr pkg12-1-1.noarch@available solvable:filelist /usr/share/pkg12/d0/±HS5|r}_o,U`T1Z+<`J&z=u+G.&pnU4IF?
+attr pkg12-1-1.noarch@available solvable:filelist /usr/share/pkg12/d0/QYGn*q>T"a6bC_KfCU~xBtSn|ewܷe~r4
+attr pkg12-1-1.noarch@available solvable:filelist /usr/share/pkg12/d0/&G>oDI$>^(_VI;p9l'@h-@[}[EOYd
+attr pkg12-1-1.noarch@available solvable:filelist /usr/share/pkg12/d1/&$70h~~9{"£|,[Gi?9Hah1{̪2wOس?X_¦9uI
+attr pkg12-1-1.noarch@available solvable:filelist /usr/share/pkg12/d1/FXcLH[1y_Fj-b0C:wLѷ[οuhh4=yFZ$+
+attr pkg12-1-1.noarch@available solvable:filelist /usr/share/pkg12/d1/Wa"Xpt)<k(&Y=BJdAa=TeGZFL[~*_Ŵ35˰
+attr pkg12-1-1.noarch@available solvable:filelist /usr/share/pkg12/d1/g_,5,2Gb{ha(.->`}ϼ6O@'GBICXUCnFl^wGO
+attr pkg12-1-1.noarch@available solvable:filelist /usr/share/pkg12/d1/u|+zp|K?"pk>!^>vTl-uzyjFB+jTn
+attr pkg12-1-1.noarch@available solvable:filelist /usr/share/pkg12/d1/ڥHh@6%;OܹtAfg}T*x1@*zVcczQ5F]~m]U
+attr pkg12-1-1.noarch@available solvable:filelist /usr/share/pkg12/d1/Fx$16+_!slfn5)s,:GL>s3*l[
+attr pkg12-1-1.noarch@available solvable:filelist /usr/share/pkg12/d2/A.@d.ws+Q%2yb찣B.9DU*K>үFӹ2C)>mbѦ{9[
+attr pkg12-1-1.noarch@available solvable:filelist /usr/share/pkg12/d2/bQj{UiqhCNi8%z>cSeSӸ'rJ?S+&nm
+attr pkg12-1-1.noarch@available solvable:filelist /usr/share/pkg12/d2/x֢`z4-OtlaOOb.aOG=(iG.W"1B$KyZin
+attr pkg12-1-1.noarch@available solvable:filelist /usr/share/pkg12/d2/Upemlɫ@Oؽܲ.13٨MEMgHFFZ?4۲]
+attr pkg12-1-1.noarch@available solvable:filelist /usr/share/pkg12/d2/('(}VIRo}YuL@ecG+:A6$`NMOE.g
+attr pkg12-1-1.noarch@available solvable:filelist /usr/share/pkg12/d2/8rGeG'uj;ګ|JM(Ź}ުoo|{Q~t4n'V(=Qb`@G
+attr pkg12-1-1.noarch@available solvable:name pkg12
+attr pkg12-1-1.noarch@available solvable:provides cap12 = 12
+attr pkg12-1-1.noarch@available solvable:requires cap11
+attr pkg12-1-1.noarch@available solvable:summary package number 12
+attr pkg13-2-1.noarch@available solvable:arch noarch
+attr pkg13-2-1.noarch@available solvable:buildtime 1600046813
+attr pkg13-2-1.noarch@available solvable:evr 2-1
+attr pkg13-2-1.noarch@available solvable:filelist /usr/share/pkg13/d0/7f@'c}+@(zXc!rvh7G7-CfmAr*jV>O0%
+attr pkg13-2-1.noarch@available solvable:filelist /usr/share/pkg13/d0/ARLMnsEndت(Yz*W0Fmu|^ͭD
+attr pkg13-2-1.noarch@available solvable:filelist /usr/share/pkg13/d0/H>¾lHEy-Ca]E+eVD;z';vV;W@s~a]?tliD
+attr pkg13-2-1.noarch@available solvable:filelist /usr/share/pkg13/d0/{K14i&F>Jϯ¦9~'7<yk]=5Am
+attr pkg13-2-1.noarch@available solvable:filelist /usr/share/pkg13/d0/ϧb誣hThs9co^*,3B.Ij=w?Sy4!Q^'oF&
+attr pkg13-2-1.noarch@available solvable:filelist /usr/share/pkg13/d0/;Jۡ1p:YԼ"oܦBF7+R9.INج}L}V|r;1
+attr pkg13-2-1.noarch@available solvable:filelist /usr/share/pkg13/d0/m׺&Cp>p1zN=W>f"]};3wXTw.lLn$
+attr pkg13-2-1.noarch@available solvable:filelist /usr/share/pkg13/d1/3@-qA)>f]3[mV7&dK:k2uS2yH_wu?0]xqP
+attr pkg13-2-1.noarch@available solvable:filelist /usr/share/pkg13/d1/e<Vfvb5:]Yp|T0U9Ҹ+h0hS{^'U|[`mD
+attr pkg13-2-1.noarch@available solvable:filelist /usr/share/pkg13/d1/}|!O3Abp^9Havhu;2zlh?|vI<)I-+tsm5
+attr pkg13-2-1.noarch@available solvable:filelist /usr/share/pkg13/d1/˭Fg8Xo.uD0U[_]J`n]r+*DXe
+attr pkg13-2-1.noarch@available solvable:filelist /usr/share/pkg13/d1/$GG{Iu'}wBIL`-mJ`??<E}{G;K_8vdZw
+attr pkg13-2-1.noarch@available solvable:filelist /usr/share/pkg13/d1/ڿ&:U2U%Gq*?q&yNnդ?ѪU=g+(!jg
+attr pkg13-2-1.noarch@available solvable:filelist /usr/share/pkg13/d1/$1pdu,OR>FL)|l6n<T"1LO-~5|`v
+attr pkg13-2-1.noarch@available solvable:filelist /usr/share/pkg13/d2/VZֶsnBŷFGTHk1RcZs+`H1j?Qp:WwYc_
+attr pkg13-2-1.noarch@available solvable:filelist /usr/share/pkg13/d2/cO{}᭥TNޫVe$z`'*fR.]Ol**J7Y!
+attr pkg13-2-1.noarch@available solvable:filelist /usr/share/pkg13/d2/naHNIܱj2$Yr[kFuVOeZbmTw^HrNϾ|yzVR6N
+attr pkg13-2-1.noarch@available solvable:filelist /usr/share/pkg13/d2/[h@7b!Xi>e[lNyӢl-s>JʻڥvĵBpB®cy
+attr pkg13-2-1.noarch@available solvable:filelist /usr/share/pkg13/d2/2t48!+5:`H&cαLɭd9Axe{IPcXrA+g;2G&
+attr pkg13-2-1.noarch@available solvable:filelist /usr/share/pkg13/d2/N)ݡqRQwCw?MZ*yܬ^;Kw5onK@U9_-;A2
+attr pkg13-2-1.noarch@available solvable:name pkg13
+attr pkg13-2-1.noarch@available solvable:provides cap13 = 13
+attr pkg13-2-1.noarch@available solvable:requires cap12
+attr pkg13-2-1.noarch@available solvable:summary package number 13
+attr pkg14-3-1.noarch@available solvable:arch noarch
+attr pkg14-3-1.noarch@available solvable:buildtime 1600050414
+attr pkg14-3-1.noarch@available solvable:evr 3-1
+attr pkg14-3-1.noarch@available solvable:filelist /usr/share/pkg14/d0/@.3a}lPxnFպ&qod*G.Eab*<>Ejq@,M
+attr pkg14-3-1.noarch@available solvable:filelist /usr/share/pkg14/d0/A<&wEF60,@b^WgC9YٹEQo&HݤH9
+attr pkg14-3-1.noarch@available solvable:filelist /usr/share/pkg14/d0/_C붦C7k4VGS_OaCia`mt;2(3AX!X
+attr pkg14-3-1.noarch@available solvable:filelist /usr/share/pkg14/d0/`M3VcԹ֯[<*|f:+'9SE9;:Ju&vPXmۦD~3
+attr pkg14-3-1.noarch@available solvable:filelist /usr/share/pkg14/d0/wF${,ֶ6`bX*2jm??JWY]WSK*I9GnPT
+attr pkg14-3-1.noarch@available solvable:filelist /usr/share/pkg14/d0/7O"csm]XQ"182ZCEF]DH3I;=ͻˬ-:U(
+attr pkg14-3-1.noarch@available solvable:filelist /usr/share/pkg14/d0/X=PQ6Zٻ`]%2@zt[0Hk:4l-VlF*ygoowf
+attr pkg14-3-1.noarch@available solvable:filelist /usr/share/pkg14/d1/NhV<f?ٱ=5"Ss@|~DR]<HF&`LK`WutJLUTJK;
+attr pkg14-3-1.noarch@available solvable:filelist /usr/share/pkg14/d1/Pw4ypV88;3v{JZ%7i[jQ^O`{gѩxlm$A몫'D
+attr pkg14-3-1.noarch@available solvable:filelist /usr/share/pkg14/d1/aT(?%&M_tp̤['_?wOjS(M۴!K,CN}bλas٨'lH
+attr pkg14-3-1.noarch@available solvable:filelist /usr/share/pkg14/d1/kP{m{q,u6?.|Z8$U*0oWENL~>E-qAcX_8e
+attr pkg14-3-1.noarch@available solvable:filelist /usr/share/pkg14/d1/vy02K$}LOX͹_Y|BH˳j%4&6c-=F?
+attr pkg14-3-1.noarch@available solvable:filelist /usr/share/pkg14/d1/;vn.PiQlg`ck2d}0dt߶.uq]Vo-i>c$
+attr pkg14-3-1.noarch@available solvable:filelist /usr/share/pkg14/d1/`J~iwYԦlKqLIAf8}8o}68q$,WWpX+ʸNvg
+attr pkg14-3-1.noarch@available solvable:filelist /usr/share/pkg14/d2/H&Z};!1ZvoPIs;|׸~,pUKz=Ȳbafxp_
+attr pkg14-3-1.noarch@available solvable:filelist /usr/share/pkg14/d2/[V̤aCrgnʤ{|uj;9R.R'FŵҫccS?ƥ`mt
+attr pkg14-3-1.noarch@available solvable:filelist /usr/share/pkg14/d2/jNwB@t9dwHd-&z^}d-عN[u;WNv
+attr pkg14-3-1.noarch@available solvable:filelist /usr/share/pkg14/d2/|${楣ôH<YMK{Zѡ+A%I-8RT:}ޣ{s{tU6t
+attr pkg14-3-1.noarch@available solvable:filelist /usr/share/pkg14/d2/"ӭrѿ](!>fy=AC:e5HY>ZKA{_T<AVvmMB
+attr pkg14-3-1.noarch@available solvable:filelist /usr/share/pkg14/d2/B%0O0T)7t;tn07,=s-M?qiIv0ALz%AdJW@.
+attr pkg14-3-1.noarch@available solvable:name pkg14
+attr pkg14-3-1.noarch@available solvable:provides cap14 = 14
+attr pkg14-3-1.noarch@available solvable:requires cap13
+attr pkg14-3-1.noarch@available solvable:summary package number 14
+attr pkg15-1-1.noarch@available solvable:arch noarch
+attr pkg15-1-1.noarch@available solvable:buildtime 1600054015
+attr pkg15-1-1.noarch@available solvable:evr 1-1
+attr pkg15-1-1.noarch@available solvable:filelist /usr/share/pkg15/d0/(10mE~$j¬a"ZkoyHK)ȳeS(TBI
+attr pkg15-1-1.noarch@available solvable:filelist /usr/share/pkg15/d0/NBU3VfF&NiڽffExN}kp@x:5U[s:&`1O[+N{
+attr pkg15-1-1.noarch@available solvable:filelist /usr/share/pkg15/d0/ec1׼QqWiޫ8Hs;3.G^hV='Jk;)gR[gs(
+attr pkg15-1-1.noarch@available solvable:filelist /usr/share/pkg15/d0/^Tx_4Ϳ4xݨ)UQWdl%uLKN1`Y"fzxh&F'u86Md
+attr pkg15-1-1.noarch@available solvable:filelist /usr/share/pkg15/d0/BEiOI)bByeK+0)N{IY,5Q3}NaM5VUd쬱P^Q
+attr pkg15-1-1.noarch@available solvable:filelist /usr/share/pkg15/d0/O?m27l0)]!v=YoFb?(Q?e-_WXV4B-K5v:2
+attr pkg15-1-1.noarch@available solvable:filelist /usr/share/pkg15/d0/iY6ukM$Э!MIR$xY7,ȺAtӦ|xMr^tYi!:>3
+attr pkg15-1-1.noarch@available solvable:filelist /usr/share/pkg15/d1/*0eOoVS>fhxuCW2cJhJ.,P-noᤸ]n8:r7
+attr pkg15-1-1.noarch@available solvable:filelist /usr/share/pkg15/d1/3H{(4&mgT´-8q?}o3eaӮgx`xU-Ta{%C
+attr pkg15-1-1.noarch@available solvable:filelist /usr/share/pkg15/d1/T=0;--eBWbuʹT?";IoJ,Ccf-Q3P&8dj5
+attr pkg15-1-1.noarch@available solvable:filelist /usr/share/pkg15/d1/hf!dZ-E(hnţSz|8~9;bz8Kq{*dnVi-
+attr pkg15-1-1.noarch@available solvable:filelist /usr/share/pkg15/d1/z:;Y4s<r|D2Nr3odC..dUKDe'ئ^AzѻQ=C*"u
+attr pkg15-1-1.noarch@available solvable:filelist /usr/share/pkg15/d1/UlPjh!AiDW1WQaX1{oۧ,aA98pw!|!?f-^T̨
+attr pkg15-1-1.noarch@available solvable:filelist /usr/share/pkg15/d1/:=l7Kũ["Z4:,={rQ?{үس=d+-.eb9CN
+attr pkg15-1-1.noarch@available solvable:filelist /usr/share/pkg15/d2/%xBi7UR,VoneѴ|wZY(W^1r(-{AgMK
+attr pkg15-1-1.noarch@available solvable:filelist /usr/share/pkg15/d2/.ͤNPqhr[UP"M$U-{%:T&ug&s^kR!֪u>!I+BO.+
+attr pkg15-1-1.noarch@available solvable:filelist /usr/share/pkg15/d2/[+w,LüZ{^zU]yON?V&Qsk[&ua*)3aֽzt`7Cju&
+attr pkg15-1-1.noarch@available solvable:filelist /usr/share/pkg15/d2/wX%ny0-1W7CRE@p,mTLQu+)J1;<+J:{.[Xoe<bw
+attr pkg15-1-1.noarch@available solvable:filelist /usr/share/pkg15/d2/ֿMYzc@sO?-_67Wa[X=')R3n8IXa'H8X=^]v
+attr pkg15-1-1.noarch@available solvable:filelist /usr/share/pkg15/d2/cB)QH.hM,7>,b;Py"Vk-VOa_?Ƭ|)
+attr pkg15-1-1.noarch@available solvable:name pkg15
+attr pkg15-1-1.noarch@available solvable:provides cap15 = 15
+attr pkg15-1-1.noarch@available solvable:requires cap14
+attr pkg15-1-1.noarch@available solvable:summary package number 15
+attr pkg16-2-1.noarch@available solvable:arch noarch
+attr pkg16-2-1.noarch@available solvable:buildtime 1600057616
+attr pkg16-2-1.noarch@available solvable:evr 2-1
+attr pkg16-2-1.noarch@available solvable:filelist /usr/share/pkg16/d0/<[Q3krda}dqTK7~,$>vU*I4Kc4w3-',ء3
+attr pkg16-2-1.noarch@available solvable:filelist /usr/share/pkg16/d0/N]Y].r8*6*lbWCoCPq䯶F~s:ADHD"
+attr pkg16-2-1.noarch@available solvable:filelist /usr/share/pkg16/d0/kfpI+R8zu<c^x!_@Q.`H5qrVBlE2k]W
+attr pkg16-2-1.noarch@available solvable:filelist /usr/share/pkg16/d0/QI<lM2|!yĮoCʦVF!sVmK_V0i[%p9>EU?NWR
+attr pkg16-2-1.noarch@available solvable:filelist /usr/share/pkg16/d0/r;$֢4l9,7&ImM彦2T`䴧0$lYOG+ǯⱰ]H;R
+attr pkg16-2-1.noarch@available solvable:filelist /usr/share/pkg16/d0/ݻT+N4juR,~'6>ޭ*N6,ڹdCsrcjj~g
+attr pkg16-2-1.noarch@available solvable:filelist /usr/share/pkg16/d0/..]_mb4丰uU}(nV]dXk<qnHGzPu_7|d
+attr pkg16-2-1.noarch@available solvable:filelist /usr/share/pkg16/d1/?|d7pbw`_S.qLo&(omRj&}+-zQzO
+attr pkg16-2-1.noarch@available solvable:filelist /usr/share/pkg16/d1/Y{cLxҴ9()hHAJKsiШM?Pí.;tu{ANiU
+attr pkg16-2-1.noarch@available solvable:filelist /usr/share/pkg16/d1/pMs߫kji1?w|0VM[T@NXr>ܣGD3tVK)w[NNs3
+attr pkg16-2-1.noarch@available solvable:filelist /usr/share/pkg16/d1/|E,9CY1)ds7Q!-YN=?"_(U]ԡ&m,)%%7i
+attr pkg16-2-1.noarch@available solvable:filelist /usr/share/pkg16/d1/$q3VQWl,jV3EUW]y~}qf-<xaT@ytfB
+attr pkg16-2-1.noarch@available solvable:filelist /usr/share/pkg16/d1/%<Mi0"8Mf;"i4PR^ˤLE*9GsxFy1yN
+attr pkg16-2-1.noarch@available solvable:filelist /usr/share/pkg16/d1/M<c<¥+AP]Jt}V¬Mc9,?!+VgZao
+attr pkg16-2-1.noarch@available solvable:filelist /usr/share/pkg16/d2/A`G`IPE^(>T?;Ot~GϨ3,~{wih}@weC[
+attr pkg16-2-1.noarch@available solvable:filelist /usr/share/pkg16/d2/A&W=$l8i:TWǣHt-]3kro״6.CF"bpIFd
+attr pkg16-2-1.noarch@available solvable:filelist /usr/share/pkg16/d2/U~x-]?@a?ʿ̽y`ɮ29u02ҵ'0i27强&˲
+attr pkg16-2-1.noarch@available solvable:filelist /usr/share/pkg16/d2/<+'e|GOZ1)QF^zvB2$l@5V<hwHM
+attr pkg16-2-1.noarch@available solvable:filelist /usr/share/pkg16/d2/־B,6)7W7~J󬣫n̩[@31nU:<ū9]W'=}16
+attr pkg16-2-1.noarch@available solvable:filelist /usr/share/pkg16/d2/A&9E(dY&_KK,dxUl)ɱe}~nٯ4Ө~V1!
+attr pkg16-2-1.noarch@available solvable:name pkg16
+attr pkg16-2-1.noarch@available solvable:provides cap16 = 16
+attr pkg16-2-1.noarch@available solvable:requires cap15
+attr pkg16-2-1.noarch@available solvable:summary package number 16
+attr pkg17-3-1.noarch@available solvable:arch noarch
+attr pkg17-3-1.noarch@available solvable:buildtime 1600061217
+attr pkg17-3-1.noarch@available solvable:evr 3-1
+attr pkg17-3-1.noarch@available solvable:filelist /usr/share/pkg17/d0/1dPEHۥ[ALCDjU]`ʺMYR=yfD7渮K.G5?.mhak4
+attr pkg17-3-1.noarch@available solvable:filelist /usr/share/pkg17/d0/SK_;];mWVzRp>YsVf):'ûUhѩ`mEYV!e;fgW
+attr pkg17-3-1.noarch@available solvable:filelist /usr/share/pkg17/d0/W&Q'~q>P~{9BK-4k_HA]CS]iRK^oO$;İ
+attr pkg17-3-1.noarch@available solvable:filelist /usr/share/pkg17/d0/b`t7e,!|@J̾myVDQ^K>3=nG0Cwʻ+?-a
+attr pkg17-3-1.noarch@available solvable:filelist /usr/share/pkg17/d0/;[3|p2uEJO~!־(qDS8RSoeܸVT+RsM
+attr pkg17-3-1.noarch@available solvable:filelist /usr/share/pkg17/d0/-b0@8A-ޫ8W~X)3hht6c?gmu5he
+attr pkg17-3-1.noarch@available solvable:filelist /usr/share/pkg17/d0/s}%_@5CP=cUﲨ)LZ=K@q.}HdZ,NH]ִBR0wĤ1
+attr pkg17-3-1.noarch@available solvable:filelist /usr/share/pkg17/d1/-oc͡&p(80xtk_%2fELvpIr=yhpTmSy󹪤<
+attr pkg17-3-1.noarch@available solvable:filelist /usr/share/pkg17/d1/ORPd95qWηXe)v;F-{,CZ5`,L-NNy7TxE0
+attr pkg17-3-1.noarch@available solvable:filelist /usr/share/pkg17/d1/Z4_wF4FzѨ,!GG9{f:|-*NA'Lq4Ucrcһ$l8$
+attr pkg17-3-1.noarch@available solvable:filelist /usr/share/pkg17/d1/n{lj"Q`20n}BT$@?YzF<Zg)zixdéȩg$
+attr pkg17-3-1.noarch@available solvable:filelist /usr/share/pkg17/d1/p<n8+LKJy1ho)4j'禬ٵ^6Ҳhn;n%lm}'A;xlK
+attr pkg17-3-1.noarch@available solvable:filelist /usr/share/pkg17/d1/&?vu1ӣG:g7r;w)Mo8:HLI$ݢ;
+attr pkg17-3-1.noarch@available solvable:filelist /usr/share/pkg17/d1/Ү*ۡoObmx$jO&4iD?5鼸OIwU2>w;]O
+attr pkg17-3-1.noarch@available solvable:filelist /usr/share/pkg17/d2/V~FPuPOqv0TKs3JкheW7N62{|dCYVk[PMgL{:
+attr pkg17-3-1.noarch@available solvable:filelist /usr/share/pkg17/d2/Se4S]r|B]E3PY>$osp-zSx4A2t1C
+attr pkg17-3-1.noarch@available solvable:filelist /usr/share/pkg17/d2/w'tInơGo7rHG5󧻺krE7}Ac(T)Q'8
+attr pkg17-3-1.noarch@available solvable:filelist /usr/share/pkg17/d2/xx!1FN9YR-.W9ikܣ)jWNOQ|I<U'aDnoU
+attr pkg17-3-1.noarch@available solvable:filelist /usr/share/pkg17/d2/G`=[R18?Y;&~Ml}88&i'MWb_RjxM^&hs*7<_8
+attr pkg17-3-1.noarch@available solvable:filelist /usr/share/pkg17/d2/rg}F.@&+FbH2oJ<I[e^i]Q4K8FPs^]ݪCd`z6br
+attr pkg17-3-1.noarch@available solvable:name pkg17
+attr pkg17-3-1.noarch@available solvable:provides cap17 = 17
+attr pkg17-3-1.noarch@available solvable:requires cap16
+attr pkg17-3-1.noarch@available solvable:summary package number 17
+attr pkg18-1-1.noarch@available solvable:arch noarch
+attr pkg18-1-1.noarch@available solvable:buildtime 1600064818
+attr pkg18-1-1.noarch@available solvable:evr 1-1
+attr pkg18-1-1.noarch@available solvable:filelist /usr/share/pkg18/d0/>?nObB]@鱶dAoq"J6iEqZfĢ)DyJAK`bN]$*
+attr pkg18-1-1.noarch@available solvable:filelist /usr/share/pkg18/d0/JfGh'71qj3et񾷰M4}۴(HgϤ<0=mDwhW_
+attr pkg18-1-1.noarch@available solvable:filelist /usr/share/pkg18/d0/an9eAg5*'s?|~^Pf~=ּV`GTl(TyZ<L
+attr pkg18-1-1.noarch@available solvable:filelist /usr/share/pkg18/d0/w6o"b4NB$Dht*?PCKR4x~3gw3D)Lt6|0X
+attr pkg18-1-1.noarch@available solvable:filelist /usr/share/pkg18/d0/ګ;'pnssDUB*(=:tEνoIyv|J_JlCH:FL.
+attr pkg18-1-1.noarch@available solvable:filelist /usr/share/pkg18/d0/ڢ{İG]%F'p|Tުo]Eٷa[^A.Sg7>Ly7$ߺQ="
+attr pkg18-1-1.noarch@available solvable:filelist /usr/share/pkg18/d0/!&ɡK>tjٴ6GYxQ:,ޥWzb}>m|hOlC³w-Q`6>Qi
+attr pkg18-1-1.noarch@available solvable:filelist /usr/share/pkg18/d1/!Y[R=+׼}<NbOkKkҼ$=oefrbBFQ̭)fe+2>uu
+attr pkg18-1-1.noarch@available solvable:filelist /usr/share/pkg18/d1/+b0ZNI,Ye83úrt_Sa)3]VImYJ*h5N)d
+attr pkg18-1-1.noarch@available solvable:filelist /usr/share/pkg18/d1/rKJF!i*i8*tGzbB׬_ku]Q8eP>_lVd@S=ίJ
+attr pkg18-1-1.noarch@available solvable:filelist /usr/share/pkg18/d1/%(P<ϡ'Ӣ.*qY!jEqoT}{_m4u|vrn".D
+attr pkg18-1-1.noarch@available solvable:filelist /usr/share/pkg18/d1/Q;~7Gb@R1)>372zz(A@e<Ko5lD8'lfy!
+attr pkg18-1-1.noarch@available solvable:filelist /usr/share/pkg18/d1/(qӲj8ew-OLkG6pa'Bбf@U<7̽(mOD0(
+attr pkg18-1-1.noarch@available solvable:filelist /usr/share/pkg18/d1/䮽JVS¨)2E4-_{LN3]OLI3'M2'P2CIǯbb%FE
+attr pkg18-1-1.noarch@available solvable:filelist /usr/share/pkg18/d2/!JkPLu`@ulUptpWe=}D(->TJԶ!gsH|e3
+attr pkg18-1-1.noarch@available solvable:filelist /usr/share/pkg18/d2/.v~C=!^%I3];kE8q0D}K'_ֽoNw.(z<vOL>]]J
+attr pkg18-1-1.noarch@available solvable:filelist /usr/share/pkg18/d2/5dRS,INvTLMxgkJXs-*W*ѾGl-VFO]RNI94ѿm¥
+attr pkg18-1-1.noarch@available solvable:filelist /usr/share/pkg18/d2/PRDϸjx`1cdʵ5_pntF%KvL<8q2T=y̭?VBlU!
+attr pkg18-1-1.noarch@available solvable:filelist /usr/share/pkg18/d2/JM<KDjJ&`^'VEWxPhl!9?wpBgPulmeH~8
+attr pkg18-1-1.noarch@available solvable:filelist /usr/share/pkg18/d2/eD;x|LU=C@Q|G;MmH_$Z%",LdGps0$
+attr pkg18-1-1.noarch@available solvable:name pkg18
+attr pkg18-1-1.noarch@available solvable:provides cap18 = 18
+attr pkg18-1-1.noarch@available solvable:requires cap17
+attr pkg18-1-1.noarch@available solvable:summary package number 18
+attr pkg19-2-1.noarch@available solvable:arch noarch
+attr pkg19-2-1.noarch@available solvable:buildtime 1600068419
+attr pkg19-2-1.noarch@available solvable:evr 2-1
+attr pkg19-2-1.noarch@available solvable:filelist /usr/share/pkg19/d0/=784MT?SE{Y.ǦKhük%-UJDN_:~_fب
+attr pkg19-2-1.noarch@available solvable:filelist /usr/share/pkg19/d0/~s+xvxweXMR&~vTauLдoL,_U>wJ0I'zn7G{Rt{{-
+attr pkg19-2-1.noarch@available solvable:filelist /usr/share/pkg19/d0/s:Wk=`˱t5sB)8p<mXQ5)i:,:_F5Y۫!b@$
+attr pkg19-2-1.noarch@available solvable:filelist /usr/share/pkg19/d0/MbvydF2xu<+mMm83J,تámqsX
+attr pkg19-2-1.noarch@available solvable:filelist /usr/share/pkg19/d0/ųAq+CiAtf2up"J81?jWkX˼H4=U+TըSXL0k
+attr pkg19-2-1.noarch@available solvable:filelist /usr/share/pkg19/d0/U-N|]{kC"f^xEɵN"X>dUUaubiġtH*Ya~d
+attr pkg19-2-1.noarch@available solvable:filelist /usr/share/pkg19/d0/TɿqTR<˶ޡSY^lwFQ֤ⷱInMaGJD&mQu9j_T]$
+attr pkg19-2-1.noarch@available solvable:filelist /usr/share/pkg19/d1/*ŪyV=Ophx'snNx{~}^SSmqsy^)<Ǧz@B8bpJF
+attr pkg19-2-1.noarch@available solvable:filelist /usr/share/pkg19/d1/@d{AnZQ9G+sI@6n:jnd3gPWecѳy5zt`
+attr pkg19-2-1.noarch@available solvable:filelist /usr/share/pkg19/d1/[>,孺ֱ,($ijff*ަ_3+žؾG`>q-6Y|gXn5k^<
+attr pkg19-2-1.noarch@available solvable:filelist /usr/share/pkg19/d1/b1i{z_s*JA}߹4MXYTWa3u^,qSXо:%pq7]9xS
+attr pkg19-2-1.noarch@available solvable:filelist /usr/share/pkg19/d1/g09~;:1S8iLF!1Jo]_y-I;!2vȢf9I
+attr pkg19-2-1.noarch@available solvable:filelist /usr/share/pkg19/d1/ʫlg4|M].x"0:~]P3<x]?ݾXZjPqlSJI80m
+attr pkg19-2-1.noarch@available solvable:filelist /usr/share/pkg19/d1/^;@M6TU?jH::>w(.F@`ηR$RRFv
+attr pkg19-2-1.noarch@available solvable:filelist /usr/share/pkg19/d2/ENNVڳyzj11T̲J׹е_a3GFZ--QO
+attr pkg19-2-1.noarch@available solvable:filelist /usr/share/pkg19/d2/LgG3LmznBeLxF!Cԩw8YT'9ooH
+attr pkg19-2-1.noarch@available solvable:filelist /usr/share/pkg19/d2/gJBw)pdZA{]`(,U6ItlȽ]tu(]ܧ~wQbS=%%
+attr pkg19-2-1.noarch@available solvable:filelist /usr/share/pkg19/d2/)E9=ud_;*GcILu(xH?%FRg.wTKaF
+attr pkg19-2-1.noarch@available solvable:filelist /usr/share/pkg19/d2/{kx7VJvjLKB=wbRE1N]XfW9o-Zm*ĬB-Ǽ09
+attr pkg19-2-1.noarch@available solvable:filelist /usr/share/pkg19/d2/ѰDFfU:^4l_vX}ϬbqgkCdXJVFZ`NF*ORKy
+attr pkg19-2-1.noarch@available solvable:name pkg19
+attr pkg19-2-1.noarch@available solvable:provides cap19 = 19
+attr pkg19-2-1.noarch@available solvable:requires cap18
+attr pkg19-2-1.noarch@available solvable:summary package number 19
+attr pkg2-3-1.noarch@available solvable:arch noarch
+attr pkg2-3-1.noarch@available solvable:buildtime 1600007202
+attr pkg2-3-1.noarch@available solvable:evr 3-1
+attr pkg2-3-1.noarch@available solvable:filelist /usr/share/pkg2/d0/.`۬,eT=~15Int{UZpCcjpPAqb-'{3K?fm
+attr pkg2-3-1.noarch@available solvable:filelist /usr/share/pkg2/d0/FEGu,T`E`񺤥AiH5R|.BrvQBj׷g:7]&6sRLx=o߻}
+attr pkg2-3-1.noarch@available solvable:filelist /usr/share/pkg2/d0/G)G6R9~U=FT7)9Epey[iIJ'tN9K*>?
+attr pkg2-3-1.noarch@available solvable:filelist /usr/share/pkg2/d0/p7Yf?xWF;phf[8y@.s2Lͧv]<*t^
+attr pkg2-3-1.noarch@available solvable:filelist /usr/share/pkg2/d0/@B𽱨^,*湸l-0wIϽxetSӬ0C?_RG@=df3R+{
+attr pkg2-3-1.noarch@available solvable:filelist /usr/share/pkg2/d0/]U[3yl۶hn%b%Ddk{==<X9&)|'J5
+attr pkg2-3-1.noarch@available solvable:filelist /usr/share/pkg2/d0/ĵ=MvV%|L}ܼHw:_f}-e3ebY3Qͺ
+attr pkg2-3-1.noarch@available solvable:filelist /usr/share/pkg2/d1/$="ݡcqX1tRA|0:Ydi륬9m;8]dx*uIJml1.8F
+attr pkg2-3-1.noarch@available solvable:filelist /usr/share/pkg2/d1/d}X%Uka5>Զa513IP<y+|[mAQ)59WtU%zt
+attr pkg2-3-1.noarch@available solvable:filelist /usr/share/pkg2/d1/pq(*IR8!4Z_}y[|%ag.ۤy~`OVIYd[yR`fe
+attr pkg2-3-1.noarch@available solvable:filelist /usr/share/pkg2/d1/Nt2['^?14ZXŤGɫ;8!MdAJ&(>}?;
+attr pkg2-3-1.noarch@available solvable:filelist /usr/share/pkg2/d1/seRfC1!g]~,'L^_AJʴtiR(h=xx0(nq1
+attr pkg2-3-1.noarch@available solvable:filelist /usr/share/pkg2/d1/A_R=rI*~KyIq<cJZV|ALSNw>ng?c'OdomdDg
+attr pkg2-3-1.noarch@available solvable:filelist /usr/share/pkg2/d1/ý+SH(۬0lL-OY'([3(Q{%Mq,zfդduMGⰳܻey
+attr pkg2-3-1.noarch@available solvable:filelist /usr/share/pkg2/d2/6i)lkIKD9Lfr0_|Zi}_6?5q!=ATs~G24
+attr pkg2-3-1.noarch@available solvable:filelist /usr/share/pkg2/d2/_LmNt`ۭKzl;!|?!Ŭh׼1:u2G(kϷ.8k
+attr pkg2-3-1.noarch@available solvable:filelist /usr/share/pkg2/d2/kXXQCNڽ,Dk@f|rU$4WsVH5hkEB;|`AlBm7
+attr pkg2-3-1.noarch@available solvable:filelist /usr/share/pkg2/d2/qB4`D9ro~bcݯ0ZܹN=F=JGOA$^J?Ko)?p-
+attr pkg2-3-1.noarch@available solvable:filelist /usr/share/pkg2/d2/{'Y"y6O8FAu5@?As@Y;vFBJj*V
+attr pkg2-3-1.noarch@available solvable:filelist /usr/share/pkg2/d2/'Rs_3qxW*c:7bZ-F45E_zWm4%0*3KG4WK]u{
+attr pkg2-3-1.noarch@available solvable:name pkg2
+attr pkg2-3-1.noarch@available solvable:provides cap2 = 2
+attr pkg2-3-1.noarch@available solvable:requires cap1
+attr pkg2-3-1.noarch@available solvable:summary package number 2
+attr pkg20-3-1.noarch@available solvable:arch noarch
+attr pkg20-3-1.noarch@available solvable:buildtime 1600072020
+attr pkg20-3-1.noarch@available solvable:evr 3-1
+attr pkg20-3-1.noarch@available solvable:filelist /usr/share/pkg20/d0/&]:سPi>+XGUcXsdy92H^Gj4ZAsH=&VM
+attr pkg20-3-1.noarch@available solvable:filelist /usr/share/pkg20/d0/=lVn8pg([&9涰}Ͱ9$bMA
+attr pkg20-3-1.noarch@available solvable:filelist /usr/share/pkg20/d0/[8KC6aPwgoGOu0ĥRAo{tC_ܾ>hZkRkq2EE
+attr pkg20-3-1.noarch@available solvable:filelist /usr/share/pkg20/d0/o$߫bVMRGtE5ͷdKԳԮ({Q4f&U>Ѽ,...WkFoma
+attr pkg20-3-1.noarch@available solvable:filelist /usr/share/pkg20/d0/q'V&ݭAx"X.vnYݤ"9G;*:-H:PJ;ENCV8bIR'
+attr pkg20-3-1.noarch@available solvable:filelist /usr/share/pkg20/d0/8;C;:Vs|~(^8j9REdd1&)8,[rRiL)ejo`
+attr pkg20-3-1.noarch@available solvable:filelist /usr/share/pkg20/d0/h裧:DXå{SAJsj-Q=bqNY1n;Mjl!@f@n
+attr pkg20-3-1.noarch@available solvable:filelist /usr/share/pkg20/d1/>RezAo<"8IjBy!+.!ͩi_ܷOmkkp}nl.pX_uMu
+attr pkg20-3-1.noarch@available solvable:filelist /usr/share/pkg20/d1/~,ùr%1fVae4q.i15R)_w@ar2QW87
+attr pkg20-3-1.noarch@available solvable:filelist /usr/share/pkg20/d1/T23UZG+}A%Te|89k0)äe>zP%γqNvRj
+attr pkg20-3-1.noarch@available solvable:filelist /usr/share/pkg20/d1/dJ7PVC['{[TFL7Azegu!cAҺR=nc--(M
+attr pkg20-3-1.noarch@available solvable:filelist /usr/share/pkg20/d1/q2oHujQca)u*kE[z2_Ḭ,'_^cd
+attr pkg20-3-1.noarch@available solvable:filelist /usr/share/pkg20/d1/-s^cMY{8qwQ8^X@Ogx]M$?~Bm
+attr pkg20-3-1.noarch@available solvable:filelist /usr/share/pkg20/d1/K!D*<*:hFo<{pZR-D%Cl,k@pF.(9d>?Ĳ
+attr pkg20-3-1.noarch@available solvable:filelist /usr/share/pkg20/d2/>po|1t^{EUSxgK%Q&(=K:1xlFJ!2-7BkU&
+attr pkg20-3-1.noarch@available solvable:filelist /usr/share/pkg20/d2/:̼0s4Gn{á&[dp.+bcQ{wcۯ<hulAgr
+attr pkg20-3-1.noarch@available solvable:filelist /usr/share/pkg20/d2/9QKrF{'i`"f2ɭԤIr0vvyR-JriH8Z"R
+attr pkg20-3-1.noarch@available solvable:filelist /usr/share/pkg20/d2/+FP`pk^D]SMV2-E?7p7mx+>
+attr pkg20-3-1.noarch@available solvable:filelist /usr/share/pkg20/d2/h%EV%>)R-c`}1-s%C]g8>T_ZVXmUL.ҥ)bZN9&
+attr pkg20-3-1.noarch@available solvable:filelist /usr/share/pkg20/d2/K8cPwORg?RXv8;HCW]2cvŶh3'M)fV
+attr pkg20-3-1.noarch@available solvable:name pkg20
+attr pkg20-3-1.noarch@available solvable:provides cap20 = 20
+attr pkg20-3-1.noarch@available solvable:requires cap19
+attr pkg20-3-1.noarch@available solvable:summary package number 20
+attr pkg21-1-1.noarch@available solvable:arch noarch
+attr pkg21-1-1.noarch@available solvable:buildtime 1600075621
+attr pkg21-1-1.noarch@available solvable:evr 1-1
+attr pkg21-1-1.noarch@available solvable:filelist /usr/share/pkg21/d0/2LWG̶gW]M'M>R3J;}BJg}U]hGtro>k([B0i
+attr pkg21-1-1.noarch@available solvable:filelist /usr/share/pkg21/d0/F-]]iCfd3+-KGgbpz~QAKR!@F&9mOY+D~
+attr pkg21-1-1.noarch@available solvable:filelist /usr/share/pkg21/d0/oB%uTM;Gq9(Z,[%t*Z*[$"Ws88@TN~kct2`F
+attr pkg21-1-1.noarch@available solvable:filelist /usr/share/pkg21/d0/veKݢKb?wUi4ZyQRfnQp3>a쮻ԳK7lߵjE4p-
+attr pkg21-1-1.noarch@available solvable:filelist /usr/share/pkg21/d0/{]@>)Oo8BY$Po?8<0$(Y>sF[{6hF%>zY,|dL
+attr pkg21-1-1.noarch@available solvable:filelist /usr/share/pkg21/d0/"Zhe%c*zI)4ldnm35NP}w?h4[VoTSҢl
+attr pkg21-1-1.noarch@available solvable:filelist /usr/share/pkg21/d0/C㦧)RȡEny1r3s~?Oy2CO:xr٣s{xwCXjM
+attr pkg21-1-1.noarch@available solvable:filelist /usr/share/pkg21/d1/,M''I}wlڦ^.hgC8+FSR0z^B[-'[o6+-Q
+attr pkg21-1-1.noarch@available solvable:filelist /usr/share/pkg21/d1/Rn,Z*-4Tx]6CҮWo1)zrjdU1n*5yԼ
+attr pkg21-1-1.noarch@available solvable:filelist /usr/share/pkg21/d1/m<ȷY"9rJAR]j*:FEjaFK&1TF7=gwh&
+attr pkg21-1-1.noarch@available solvable:filelist /usr/share/pkg21/d1/pVCZ5^b!1J~t2cK&Yw{Uڨ1kE-(oܱhM{v;:
+attr pkg21-1-1.noarch@available solvable:filelist /usr/share/pkg21/d1/sXa?Z'uXP*0^_Jt[sws@g<DѼ"0B1Q<'Et
+attr pkg21-1-1.noarch@available solvable:filelist /usr/share/pkg21/d1/s|V-oSr+u"_SVAty?96%RCVHQ
+attr pkg21-1-1.noarch@available solvable:filelist /usr/share/pkg21/d1/&%[Ko9:B3ocj*:|y?IZ@}&ZùQ!b
+attr pkg21-1-1.noarch@available solvable:filelist /usr/share/pkg21/d2/ygEjLIuos|y~<rknӭ3aUD>77{7@wMlnj;{Bzp^n_
+attr pkg21-1-1.noarch@available solvable:filelist /usr/share/pkg21/d2/%"l{5٬?HtϤ'>jun-)zAYDjyns940i:"q
+attr pkg21-1-1.noarch@available solvable:filelist /usr/share/pkg21/d2/ǩ$.lGg?.M|c4ẵW<g[D('Ei2>!,1
+attr pkg21-1-1.noarch@available solvable:filelist /usr/share/pkg21/d2/1TM1ǧC7YF4w,y>Z@hI,H*(fWREK=J^r}
+attr pkg21-1-1.noarch@available solvable:filelist /usr/share/pkg21/d2/.u?><`Zh+9R}_H4Ieձ^>n9OA50Xa+vZjhVlɢ
+attr pkg21-1-1.noarch@available solvable:filelist /usr/share/pkg21/d2/NY2;l[LǺ.dGJU:UK©TX]n%&KN'
+attr pkg21-1-1.noarch@available solvable:name pkg21
+attr pkg21-1-1.noarch@available solvable:provides cap21 = 21
+attr pkg21-1-1.noarch@available solvable:requires cap20
+attr pkg21-1-1.noarch@available solvable:summary package number 21
+attr pkg22-2-1.noarch@available solvable:arch noarch
+attr pkg22-2-1.noarch@available solvable:buildtime 1600079222
+attr pkg22-2-1.noarch@available solvable:evr 2-1
+attr pkg22-2-1.noarch@available solvable:filelist /usr/share/pkg22/d0/2TcjvqĴL0HR_&vR8^hS_LO'ww6LӴSeYEyq>V
+attr pkg22-2-1.noarch@available solvable:filelist /usr/share/pkg22/d0/bKz&48%Q2iaAXb*.~eUxwmVyxa|i=+9mmo.k-%OlD~+
+attr pkg22-2-1.noarch@available solvable:filelist /usr/share/pkg22/d0/o6>"SNzRإܦAY'J3׫I>اZxtZ6$FZu
+attr pkg22-2-1.noarch@available solvable:filelist /usr/share/pkg22/d0/agFĤ;}G|2PIeg6f6UxfG?^"[DYRfA
+attr pkg22-2-1.noarch@available solvable:filelist /usr/share/pkg22/d0/Ƭ:=!wWɼ&V3լSV)x߹˧C|N{"hErVݳVJ<"A
+attr pkg22-2-1.noarch@available solvable:filelist /usr/share/pkg22/d0/lPpsD^=8iˤgϥupKVsP8LSTFy@qRS
+attr pkg22-2-1.noarch@available solvable:filelist /usr/share/pkg22/d0/|PUb$],A2i,+ȺR77z$}Ģʩ=uhϯpGl
+attr pkg22-2-1.noarch@available solvable:filelist /usr/share/pkg22/d1/9LJLc7fϿ!"PshԱC..'CӴLEgп[J>ݢMbs
+attr pkg22-2-1.noarch@available solvable:filelist /usr/share/pkg22/d1/K4(E2u}㩤vXRA%yDH]6oSb'o]dKɽ6dYMR?([QP)
+attr pkg22-2-1.noarch@available solvable:filelist /usr/share/pkg22/d1/QPq``rxu4h?WaR$<<UvXXխ<*Q4A
+attr pkg22-2-1.noarch@available solvable:filelist /usr/share/pkg22/d1/pEXsYnyY&,mZٺtDM9'ousJRŨ
+attr pkg22-2-1.noarch@available solvable:filelist /usr/share/pkg22/d1/OŽpeڭ7fZʮ2uhom[lbnhA;(l7Cدy
+attr pkg22-2-1.noarch@available solvable:filelist /usr/share/pkg22/d1/X,Hee5lGEr%D3vjo2CӲZWmҲǥJ56x}}:
+attr pkg22-2-1.noarch@available solvable:filelist /usr/share/pkg22/d1/^()zU3Ht<*n7(-p]2h`[k;Bu:S
+attr pkg22-2-1.noarch@available solvable:filelist /usr/share/pkg22/d2/Ng(;9u["7V44;kATDng$ckr5xqy{sH
+attr pkg22-2-1.noarch@available solvable:filelist /usr/share/pkg22/d2/{TS|Go@Yz!%mv[JǩsQyNrH5-ٶ+-E.aMBS5
+attr pkg22-2-1.noarch@available solvable:filelist /usr/share/pkg22/d2/|8zZG|ޫYwaѭ=g&ݰ;@AϤCd|u*
+attr pkg22-2-1.noarch@available solvable:filelist /usr/share/pkg22/d2/]hvx-zЮ1)O3b,{»Lp[+hH9[DK)k~v
+attr pkg22-2-1.noarch@available solvable:filelist /usr/share/pkg22/d2/i,S~);`Tztk[NCc8'p".q(PuaRw-pl
+attr pkg22-2-1.noarch@available solvable:filelist /usr/share/pkg22/d2/|)Xv]ur$ɫc?Nqyds9LX*m<M3>E}id.?fb]lh%}
+attr pkg22-2-1.noarch@available solvable:name pkg22
+attr pkg22-2-1.noarch@available solvable:provides cap22 = 22
+attr pkg22-2-1.noarch@available solvable:requires cap21
+attr pkg22-2-1.noarch@available solvable:summary package number 22
+attr pkg23-3-1.noarch@available solvable:arch noarch
+attr pkg23-3-1.noarch@available solvable:buildtime 1600082823
+attr pkg23-3-1.noarch@available solvable:evr 3-1
+attr pkg23-3-1.noarch@available solvable:filelist /usr/share/pkg23/d0/4bCSbHd$G}ni4qC]'[U<$1E.;Uv
+attr pkg23-3-1.noarch@available solvable:filelist /usr/share/pkg23/d0/iS-m?ii10I.O}I*I(={GSڳv}}'$_g<bǶeHQ
+attr pkg23-3-1.noarch@available solvable:filelist /usr/share/pkg23/d0/.O8k"x8$װX8l.~nNvT+H`SWLpRUp`8,Dc$p
+attr pkg23-3-1.noarch@available solvable:filelist /usr/share/pkg23/d0/VoɥMR]:>OG@YN48νRu)nEbre5<eSG,91,>
+attr pkg23-3-1.noarch@available solvable:filelist /usr/share/pkg23/d0/.=e&KTFo$WX<Kz9|iky*ư2L6k
+attr pkg23-3-1.noarch@available solvable:filelist /usr/share/pkg23/d0/5nTPP}>aԥlEZ&X5(b}Kfl}US9[!m
+attr pkg23-3-1.noarch@available solvable:filelist /usr/share/pkg23/d0/gxVFs1߶mϾvZn=~x|EszzKCWB-dNR:d
+attr pkg23-3-1.noarch@available solvable:filelist /usr/share/pkg23/d1/+GJ|?[$ųJAx(TˮlwZJfpjF{DY3RlEѫq
+attr pkg23-3-1.noarch@available solvable:filelist /usr/share/pkg23/d1/4U6BMyUCPEͳ6պ9pY+j~SyĲFaa5dw.xi
+attr pkg23-3-1.noarch@available solvable:filelist /usr/share/pkg23/d1/Fa+`Ef;q94<DmHwUdNz~"N'h2b$:
+attr pkg23-3-1.noarch@available solvable:filelist /usr/share/pkg23/d1/ss|CpW2ۢد0Wn<IJCCmӪOxIi[wCXb3WK3c4CQP
+attr pkg23-3-1.noarch@available solvable:filelist /usr/share/pkg23/d1/{^)vA>C1c.hOHv,f3ΦQ":ji3A:3Wws
+attr pkg23-3-1.noarch@available solvable:filelist /usr/share/pkg23/d1/oҢ*6cṈL@;ApT6B!BPMj4)Kzu٨O&%Fn
+attr pkg23-3-1.noarch@available solvable:filelist /usr/share/pkg23/d1/MA4|^h1'qL:oL4BuRvs}W?HZ_4hȷZu̳f
+attr pkg23-3-1.noarch@available solvable:filelist /usr/share/pkg23/d2/*:hKn6!OCcuzlDd?_3w3NRE`Zg|c)cҼFRNhbA'Crs
+attr pkg23-3-1.noarch@available solvable:filelist /usr/share/pkg23/d2/;zHXQj5ͦPs:)vh$OVкg$19W~E2bꯥ
+attr pkg23-3-1.noarch@available solvable:filelist /usr/share/pkg23/d2/^|k&~`ξqpFd_otLkSPKP~5qT(6div]
+attr pkg23-3-1.noarch@available solvable:filelist /usr/share/pkg23/d2/w.+1:!b-۶::9oPb[OKP~~,K˫&__thF~|"@ǲ}
+attr pkg23-3-1.noarch@available solvable:filelist /usr/share/pkg23/d2/:7)%+ûknKwTqcf4H9M[7;ANMXnɤ6n
+attr pkg23-3-1.noarch@available solvable:filelist /usr/share/pkg23/d2/RBܮlM8?زid.D.@D!`^^-oPXOj+kJͬNRj
+attr pkg23-3-1.noarch@available solvable:name pkg23
+attr pkg23-3-1.noarch@available solvable:provides cap23 = 23
+attr pkg23-3-1.noarch@available solvable:requires cap22
+attr pkg23-3-1.noarch@available solvable:summary package number 23
+attr pkg24-1-1.noarch@available solvable:arch noarch
+attr pkg24-1-1.noarch@available solvable:buildtime 1600086424
+attr pkg24-1-1.noarch@available solvable:evr 1-1
+attr pkg24-1-1.noarch@available solvable:filelist /usr/share/pkg24/d0/&cѾ>c26^֢]7KGa<̧(QI,~{ӻ<E2
+attr pkg24-1-1.noarch@available solvable:filelist /usr/share/pkg24/d0/5XVU$3~,e>]eKm"Y(O&к_ƮetJx6TynG
+attr pkg24-1-1.noarch@available solvable:filelist /usr/share/pkg24/d0/K-IE&D9^㿧&oT2};`%eMiF4~u
+attr pkg24-1-1.noarch@available solvable:filelist /usr/share/pkg24/d0/`+uIEa&]>Oտe'>kb[6CA!uY"έ:`Ay
+attr pkg24-1-1.noarch@available solvable:filelist /usr/share/pkg24/d0/ˡi;r3g?@ٺbY{hۨKLp!ź*T;uot4=l
+attr pkg24-1-1.noarch@available solvable:filelist /usr/share/pkg24/d0/W~t}ĭH'IjkᰦsFrWf>jE>6.sK,i^4
+attr pkg24-1-1.noarch@available solvable:filelist /usr/share/pkg24/d0/XMFl8{W<ayNm?e%yFy9ШV$+^d3l:s,)e]
+attr pkg24-1-1.noarch@available solvable:filelist /usr/share/pkg24/d1/&Qu*k;T*Xe,d:]r%:gtѨKE<?oCTR37|FOf
+attr pkg24-1-1.noarch@available solvable:filelist /usr/share/pkg24/d1/.uPM{slGYv2VƦ{ʶXLYx(q}<ǶBYOl%x
+attr pkg24-1-1.noarch@available solvable:filelist /usr/share/pkg24/d1/SnKgvKA()t8ê90;ҤwKtźIZ$u4R,!>ϡ
+attr pkg24-1-1.noarch@available solvable:filelist /usr/share/pkg24/d1/kKQJY?%,zSh7~yHVC֡$p?dORL7J{@}*F
+attr pkg24-1-1.noarch@available solvable:filelist /usr/share/pkg24/d1/|Jxm}["Y۾N-80}<:CMa~ϦBY7h9+UAWҪ*
+attr pkg24-1-1.noarch@available solvable:filelist /usr/share/pkg24/d1/=]ǩ^0L;2v]4Y@´@g|;lXE^+[w>.RO{M
+attr pkg24-1-1.noarch@available solvable:filelist /usr/share/pkg24/d1/cW&&5VZS=>.5FN%X4bA^7!K9KYG@ƣrL]{l*
+attr pkg24-1-1.noarch@available solvable:filelist /usr/share/pkg24/d2/2!M4H_QKizeYZIZ"j3P")B7>+V=ͦIg
+attr pkg24-1-1.noarch@available solvable:filelist /usr/share/pkg24/d2/HA"*@U[e<49y6]xQҭNDx|ɴ¤[=1n4"1&[%oG@i
+attr pkg24-1-1.noarch@available solvable:filelist /usr/share/pkg24/d2/uN"@~|Ro9XMGBVcOK|s5ta_B,Inqx8'*i*bPzR]-
+attr pkg24-1-1.noarch@available solvable:filelist /usr/share/pkg24/d2/gqCXOKp)߫WGc$ʯ;i41jùاCF-"9
+attr pkg24-1-1.noarch@available solvable:filelist /usr/share/pkg24/d2/%],e$w*]uL;Dd+"8F[֤!jkqMIy(Zy}48koP
+attr pkg24-1-1.noarch@available solvable:filelist /usr/share/pkg24/d2/HC|5seܩ~AlQ[~n]L)Q^:!r8qq6u6xuX01O
+attr pkg24-1-1.noarch@available solvable:name pkg24
+attr pkg24-1-1.noarch@available solvable:provides cap24 = 24
+attr pkg24-1-1.noarch@available solvable:requires cap23
+attr pkg24-1-1.noarch@available solvable:summary package number 24
+attr pkg25-2-1.noarch@available solvable:arch noarch
+attr pkg25-2-1.noarch@available solvable:buildtime 1600090025
+attr pkg25-2-1.noarch@available solvable:evr 2-1
+attr pkg25-2-1.noarch@available solvable:filelist /usr/share/pkg25/d0/;OY]RH@AwpCDKP'5`Cltfsoux3<K4W2kڴ
+attr pkg25-2-1.noarch@available solvable:filelist /usr/share/pkg25/d0/NauϪ7CvQSY0;н'_Os^~tɹ˫6z)
+attr pkg25-2-1.noarch@available solvable:filelist /usr/share/pkg25/d0/&i1$=CDHqmsU'@4p'BT]*~֮.{|RtjQN!ƽIL
+attr pkg25-2-1.noarch@available solvable:filelist /usr/share/pkg25/d0/jt[GB6Opz34t7TBNӦ{%2F)|L"s9HبD2UOZ
+attr pkg25-2-1.noarch@available solvable:filelist /usr/share/pkg25/d0/B{[AzkuJr@e4EƵAj`OmqUF:@ez娭Tغ|ɷZ
+attr pkg25-2-1.noarch@available solvable:filelist /usr/share/pkg25/d0/RkgM[ҡ9Wm|vR;Qi!?5359&LN6{g1%2!
+attr pkg25-2-1.noarch@available solvable:filelist /usr/share/pkg25/d0/yuZjI5,-%z+d*UXibaY|-]z0`˷|
+attr pkg25-2-1.noarch@available solvable:filelist /usr/share/pkg25/d1/9oo%@)bP>p~sCxd6ShR`QeaB`i'y-s!^B
+attr pkg25-2-1.noarch@available solvable:filelist /usr/share/pkg25/d1/R;6-So*1ڭ_jǲ(:8:A:FckG5q)n~+Nz
+attr pkg25-2-1.noarch@available solvable:filelist /usr/share/pkg25/d1/V<v+du8NamȽ)AMת8hnbE~t%NsAG^D
+attr pkg25-2-1.noarch@available solvable:filelist /usr/share/pkg25/d1/~Mर3CJQ8-L=Iv}7mgaP%t?|8F@F$|-I
+attr pkg25-2-1.noarch@available solvable:filelist /usr/share/pkg25/d1/Jhwrl^xNrǦp}˦|sQE]DNSǽFg,϶
+attr pkg25-2-1.noarch@available solvable:filelist /usr/share/pkg25/d1/'өubX6aXMC>da2ĮCEH[nԦ޽Kd70J`OP|
+attr pkg25-2-1.noarch@available solvable:filelist /usr/share/pkg25/d1/?Uq:E'3Vh)WT}c9S*>_do`N?!HI;3j:
+attr pkg25-2-1.noarch@available solvable:filelist /usr/share/pkg25/d2/Nȥ<ǫFbM`J]L56e_SxBXzmAy!VAai8UKz
+attr pkg25-2-1.noarch@available solvable:filelist /usr/share/pkg25/d2/zKh:%mcNݰP֣J`^6|_BE;iڻj?}s.rRo
+attr pkg25-2-1.noarch@available solvable:filelist /usr/share/pkg25/d2/h9SUT~Pl@n7)$s1xK1O72|qL?:@0c<)*@wJlnp
+attr pkg25-2-1.noarch@available solvable:filelist /usr/share/pkg25/d2/K48VF9Ojis{~[9༣:P(ab6bBrTz-.
+attr pkg25-2-1.noarch@available solvable:filelist /usr/share/pkg25/d2/NlA]doQkj2%)3]<vQY"smP3:Jw?do9o
+attr pkg25-2-1.noarch@available solvable:filelist /usr/share/pkg25/d2/c][VDӫYX謁9ڧ&ٴOFyibI>צ.O̻qe:sg
+attr pkg25-2-1.noarch@available solvable:name pkg25
+attr pkg25-2-1.noarch@available solvable:provides cap25 = 25
+attr pkg25-2-1.noarch@available solvable:requires cap24
+attr pkg25-2-1.noarch@available solvable:summary package number 25
+attr pkg26-3-1.noarch@available solvable:arch noarch
+attr pkg26-3-1.noarch@available solvable:buildtime 1600093626
+attr pkg26-3-1.noarch@available solvable:evr 3-1
+attr pkg26-3-1.noarch@available solvable:filelist /usr/share/pkg26/d0/!8S$6^un,Ds(DU;RGUrtuj61ŸE
+attr pkg26-3-1.noarch@available solvable:filelist /usr/share/pkg26/d0/NVx&>er&A~0G(7%)Hj&{[0[]TK2>
+attr pkg26-3-1.noarch@available solvable:filelist /usr/share/pkg26/d0/QqY,7-)AOknr6R!Y(Q%b`YEXW}lq|ARu%|*
+attr pkg26-3-1.noarch@available solvable:filelist /usr/share/pkg26/d0/hgKQ`PtTC3~髾CxRuJmIlZ.KQT6@||?q
+attr pkg26-3-1.noarch@available solvable:filelist /usr/share/pkg26/d0/ZRO$p>th,&(p-y_C()$q5nF_AeSx!
+attr pkg26-3-1.noarch@available solvable:filelist /usr/share/pkg26/d0/P<^^i):%vwkl=G.(Zu}:otS,t0
+attr pkg26-3-1.noarch@available solvable:filelist /usr/share/pkg26/d0/);pNuظAIR|EnȢyfYkj'URmI^s?|+o.%UA
+attr pkg26-3-1.noarch@available solvable:filelist /usr/share/pkg26/d1/--pWV?hysEl)@YO,ثS[LǽBTbTOk":
+attr pkg26-3-1.noarch@available solvable:filelist /usr/share/pkg26/d1/A"I*A7WJUg!dvy4Ty]`PM;}w!ױQng82qb<8
+attr pkg26-3-1.noarch@available solvable:filelist /usr/share/pkg26/d1/]|>^߮*]ҹ<:X<ܥGM(5`@bMBﲬX_!^v<=0'Kr
+attr pkg26-3-1.noarch@available solvable:filelist /usr/share/pkg26/d1/goX-3IThϸL;ܩANhZrhdpUYw"Ffl|xH*<fj_z
+attr pkg26-3-1.noarch@available solvable:filelist /usr/share/pkg26/d1/mSİQ5ᬯ]Xt3꧰T*C^|kUho`x`$fpa
+attr pkg26-3-1.noarch@available solvable:filelist /usr/share/pkg26/d1/3-j۸0[د}q6K^1)5{K57:|R`j0o;q|$7s
+attr pkg26-3-1.noarch@available solvable:filelist /usr/share/pkg26/d1/YTZZ۬EBoB?.ivrȯP"h%>I&;aq"Zth$
+attr pkg26-3-1.noarch@available solvable:filelist /usr/share/pkg26/d2/=MfjVQm~PFx7=9H;`w,88f*)iVas"K
+attr pkg26-3-1.noarch@available solvable:filelist /usr/share/pkg26/d2/To-)sع<Ax'&fi,ffg<XS])yE$ҼHQtd
+attr pkg26-3-1.noarch@available solvable:filelist /usr/share/pkg26/d2/,}>I~wڬg?XE70VQiowlt_k9b"67H<0*$Pjp
+attr pkg26-3-1.noarch@available solvable:filelist /usr/share/pkg26/d2/I~&}Ŷˮ.btb}et6]ge-֡T$&)K=פYa
+attr pkg26-3-1.noarch@available solvable:filelist /usr/share/pkg26/d2/IidQh0kddV7<R!vh)osZ>e9)m觹;|nF&
+attr pkg26-3-1.noarch@available solvable:filelist /usr/share/pkg26/d2/cAlZItC71~RQ-<4G^j[N_JMrέ9-rX"_l
+attr pkg26-3-1.noarch@available solvable:name pkg26
+attr pkg26-3-1.noarch@available solvable:provides cap26 = 26
+attr pkg26-3-1.noarch@available solvable:requires cap25
+attr pkg26-3-1.noarch@available solvable:summary package number 26
+attr pkg27-1-1.noarch@available solvable:arch noarch
+attr pkg27-1-1.noarch@available solvable:buildtime 1600097227
+attr pkg27-1-1.noarch@available solvable:evr 1-1
+attr pkg27-1-1.noarch@available solvable:filelist /usr/share/pkg27/d0/YG͵f.',aoWY_FmP({w@ZSA}4GE~L@-l$y
+attr pkg27-1-1.noarch@available solvable:filelist /usr/share/pkg27/d0/wFϨY-K}k`?pq7h;[+LRk@Czg)9-e
+attr pkg27-1-1.noarch@available solvable:filelist /usr/share/pkg27/d0/{.VDR(.Vl&o7HBT97|D;O?-fRJhNrxp_
+attr pkg27-1-1.noarch@available solvable:filelist /usr/share/pkg27/d0/}JnA>t)WaEW(ncbiA]kԦ@cev].[R@V14e`Miѱ
+attr pkg27-1-1.noarch@available solvable:filelist /usr/share/pkg27/d0/Vh&nILǲWXPj,-Ƕ|0sY`I%AҴ}N+wt>9
+attr pkg27-1-1.noarch@available solvable:filelist /usr/share/pkg27/d0/0SA7NFwy0MqC{?Qh87W4˱ZmN5wƣ&zHpM!JF
+attr pkg27-1-1.noarch@available solvable:filelist /usr/share/pkg27/d0/KTynDhı[tM`jKF7(y"9OoA7u;Ŀܶ9x
+attr pkg27-1-1.noarch@available solvable:filelist /usr/share/pkg27/d1/%tʪ!=ĵauM{u6ǥ*V]xoFU0RNaq;O
+attr pkg27-1-1.noarch@available solvable:filelist /usr/share/pkg27/d1/Hڴ~iHTFiTo`'9rFյEeuҪ>嵿ҵ1g5uLN
+attr pkg27-1-1.noarch@available solvable:filelist /usr/share/pkg27/d1/x.F3$81hq{9c6ߢf~ƶ}Om@>i"K5b!V<Bw
+attr pkg27-1-1.noarch@available solvable:filelist /usr/share/pkg27/d1/?R@d=wx!VG5Trܽ26bKz%G1HrO['{&tf9WilxV
+attr pkg27-1-1.noarch@available solvable:filelist /usr/share/pkg27/d1/;%d2Hm-OL.,kB>&+t9"S4ܶ_+^|:tP~<so
+attr pkg27-1-1.noarch@available solvable:filelist /usr/share/pkg27/d1/-X?W[,IsؾӶh9,aB(gCLkKTWI6[xf׭Mw+b
+attr pkg27-1-1.noarch@available solvable:filelist /usr/share/pkg27/d1/M7{@l2lkva+GxN$*|r|Q=vF<SCRQ
+attr pkg27-1-1.noarch@available solvable:filelist /usr/share/pkg27/d2/P^s"R4V>HFu_y)5QP%KuRPGi$56NEp42
+attr pkg27-1-1.noarch@available solvable:filelist /usr/share/pkg27/d2/?~Tn7hhv0JPmtb0V16tWǳQw;~_aEv&!cso6-0
+attr pkg27-1-1.noarch@available solvable:filelist /usr/share/pkg27/d2/taI)຤%s*"ȸPccZ1d^s9]':W63y
+attr pkg27-1-1.noarch@available solvable:filelist /usr/share/pkg27/d2/5߽kHxpt۹9;W2dM.ټ<,i4*-H<IT70E8A
+attr pkg27-1-1.noarch@available solvable:filelist /usr/share/pkg27/d2/P?e4W0vf7*i}P(beWouY7!dVRWn><ME
+attr pkg27-1-1.noarch@available solvable:filelist /usr/share/pkg27/d2/bLn-zVQ*<kjpGB_&Ϣ,vpGbV%$1W~4Q4PKO
+attr pkg27-1-1.noarch@available solvable:name pkg27
+attr pkg27-1-1.noarch@available solvable:provides cap27 = 27
+attr pkg27-1-1.noarch@available solvable:requires cap26
+attr pkg27-1-1.noarch@available solvable:summary package number 27
+attr pkg28-2-1.noarch@available solvable:arch noarch
+attr pkg28-2-1.noarch@available solvable:buildtime 1600100828
+attr pkg28-2-1.noarch@available solvable:evr 2-1
+attr pkg28-2-1.noarch@available solvable:filelist /usr/share/pkg28/d0/!Mk,'jB2}$zqPk$yO@4;%ETUƪGruHJ^-~zz]7
+attr pkg28-2-1.noarch@available solvable:filelist /usr/share/pkg28/d0/gwhhp1;Ӭ[=lqZ_o44Dkd6D1;:Em!>GŸYwu
+attr pkg28-2-1.noarch@available solvable:filelist /usr/share/pkg28/d0/p3m.8aqqRti*PPOkv<YIű;ae-]"%${zHhzP
+attr pkg28-2-1.noarch@available solvable:filelist /usr/share/pkg28/d0/wD-.IMiH@iM,ắV5&fQ9,4jr3Umt
+attr pkg28-2-1.noarch@available solvable:filelist /usr/share/pkg28/d0/x<e'azfNiT>Vo~dw-8:z$!.?d7W)7:2W
+attr pkg28-2-1.noarch@available solvable:filelist /usr/share/pkg28/d0/.4`HD*qq@uZn[.4dָA'A,LG3qH=
+attr pkg28-2-1.noarch@available solvable:filelist /usr/share/pkg28/d0/&سh9@y4_z9:`u"fR<ywX]$|1:m̫L;u>_
+attr pkg28-2-1.noarch@available solvable:filelist /usr/share/pkg28/d1/%6^1쩤4*Bұi5Ttosc'ʼQYvѥ)3WIV=]
+attr pkg28-2-1.noarch@available solvable:filelist /usr/share/pkg28/d1/Iʾ챷TbiN;{fm?2E$K"_=e!|=Nl!GDG)x;U9
+attr pkg28-2-1.noarch@available solvable:filelist /usr/share/pkg28/d1/bFѫ7u%4>MC2pR(ah]pIɯg9m).UJck
+attr pkg28-2-1.noarch@available solvable:filelist /usr/share/pkg28/d1/BL9O!06xVNvC1$TsK$z@k묳J^UwTD
+attr pkg28-2-1.noarch@available solvable:filelist /usr/share/pkg28/d1/Ȥ?9L!6iBw=%"IC9X2ep"cZuӷ,7O6cuDs4wR
+attr pkg28-2-1.noarch@available solvable:filelist /usr/share/pkg28/d1/:gehwxNdJ(YUa_63׫0S,5ILl?E!7
+attr pkg28-2-1.noarch@available solvable:filelist /usr/share/pkg28/d1/޸Vf<,g"g-6|0P}PQм&g0ʧKնh?p?ɲ
+attr pkg28-2-1.noarch@available solvable:filelist /usr/share/pkg28/d2/;KOw`")z52nu_]":DLL7UE3!H10m3,I9A+C
+attr pkg28-2-1.noarch@available solvable:filelist /usr/share/pkg28/d2/v4%hu,}??h-BkXkB%!o$L}ǹ_׹kM)F
+attr pkg28-2-1.noarch@available solvable:filelist /usr/share/pkg28/d2/x]mV:C*+5Qm趣B=zOTM9=>C`,R'vWK
+attr pkg28-2-1.noarch@available solvable:filelist /usr/share/pkg28/d2/_8p̾SlOf7Xbf4mVR:RZ9!~W((8
+attr pkg28-2-1.noarch@available solvable:filelist /usr/share/pkg28/d2/Ϲh|&ABbZ54m騢i"_}fV7[pR_}s-f7ZNY
+attr pkg28-2-1.noarch@available solvable:filelist /usr/share/pkg28/d2/-Y˾pccoǿ+Ⱥ:%yȦH]1=vtOG!pٴ
+attr pkg28-2-1.noarch@available solvable:name pkg28
+attr pkg28-2-1.noarch@available solvable:provides cap28 = 28
+attr pkg28-2-1.noarch@available solvable:requires cap27
+attr pkg28-2-1.noarch@available solvable:summary package number 28
+attr pkg29-3-1.noarch@available solvable:arch noarch
+attr pkg29-3-1.noarch@available solvable:buildtime 1600104429
+attr pkg29-3-1.noarch@available solvable:evr 3-1
+attr pkg29-3-1.noarch@available solvable:filelist /usr/share/pkg29/d0/&sg`c>auLS.y3+(2}ViZb|"hT+sޱ},NW(~qkP.R[
+attr pkg29-3-1.noarch@available solvable:filelist /usr/share/pkg29/d0/0O1X?8)Yp85tOZ|Nb?'(7L5SaglG,O[[9
+attr pkg29-3-1.noarch@available solvable:filelist /usr/share/pkg29/d0/^aIc~Rrb.@C[b`266xH%_ϱǰj&hQ
+attr pkg29-3-1.noarch@available solvable:filelist /usr/share/pkg29/d0/s?>(4oHuẼunmKѨ(zUZ:ZN"?MzP1}
+attr pkg29-3-1.noarch@available solvable:filelist /usr/share/pkg29/d0/Tz`Уx%[Po!S5ldήHh~VyΩ]ݯZ,0δ
+attr pkg29-3-1.noarch@available solvable:filelist /usr/share/pkg29/d0/D4uGrd'qh5<FS`%gE{6TJ1U'5n[{v
+attr pkg29-3-1.noarch@available solvable:filelist /usr/share/pkg29/d0/{V6>8uNC7cXA@9o])!QK;YGU'WCL;02Uu
+attr pkg29-3-1.noarch@available solvable:filelist /usr/share/pkg29/d1/%yE3z}oױreǢLzgq0Px=|{3L!VUUR'IIv8ԫp>E
+attr pkg29-3-1.noarch@available solvable:filelist /usr/share/pkg29/d1/|sy3XZ&w9.>,ckB.M<lY"@D$~yl"i'mkuw֥
+attr pkg29-3-1.noarch@available solvable:filelist /usr/share/pkg29/d1/O}O[wx$.$=:1rc!"$TJ6AOMK6vܺm^
+attr pkg29-3-1.noarch@available solvable:filelist /usr/share/pkg29/d1/<;JQc"9Y+ce_vj4ceY}5<ApQ*`Jq
+attr pkg29-3-1.noarch@available solvable:filelist /usr/share/pkg29/d1/̡tChXW2W?u^iDo0~K'SĨ&2ydkY;ͿSF
+attr pkg29-3-1.noarch@available solvable:filelist /usr/share/pkg29/d1/{ik}!Ho?0=ePSJc4IMK6vNn
+attr pkg29-3-1.noarch@available solvable:filelist /usr/share/pkg29/d1/OEs"-)cpAqiNRa$d~v'VApk;F+!Zlp<j
+attr pkg29-3-1.noarch@available solvable:filelist /usr/share/pkg29/d2/BmnbNgygiʨ&0D[qUZE7LAcsMd$-gX
+attr pkg29-3-1.noarch@available solvable:filelist /usr/share/pkg29/d2/g:J}OH:o_;4TZ~X?c誤y2jio+,8vLm[
+attr pkg29-3-1.noarch@available solvable:filelist /usr/share/pkg29/d2/H3>KϤl@7ۣ+jpPLLd_oZZl%*͡rCbWi
+attr pkg29-3-1.noarch@available solvable:filelist /usr/share/pkg29/d2/9)wʰgb;pNsQEHϢp,5qs=i7o[y*E89zuns*
+attr pkg29-3-1.noarch@available solvable:filelist /usr/share/pkg29/d2/޷NZ:;xfpW7[)P>rUVqGVoK;,v*8Х},
+attr pkg29-3-1.noarch@available solvable:filelist /usr/share/pkg29/d2/4d*Ya;[.0R@5*je&+za:@wmѴ_MVi04"Z
+attr pkg29-3-1.noarch@available solvable:name pkg29
+attr pkg29-3-1.noarch@available solvable:provides cap29 = 29
+attr pkg29-3-1.noarch@available solvable:requires cap28
+attr pkg29-3-1.noarch@available solvable:summary package number 29
+attr pkg3-1-1.noarch@available solvable:arch noarch
+attr pkg3-1-1.noarch@available solvable:buildtime 1600010803
+attr pkg3-1-1.noarch@available solvable:evr 1-1
+attr pkg3-1-1.noarch@available solvable:filelist /usr/share/pkg3/d0/v-~Ψ3='Pi-Jv0m['c!cnpf%&sOhO?L;Ss
+attr pkg3-1-1.noarch@available solvable:filelist /usr/share/pkg3/d0/y>kZ3+;.cmVڣaw4z0~oΰZ`7Bdб%9SQ1IR
+attr pkg3-1-1.noarch@available solvable:filelist /usr/share/pkg3/d0/;n5Ǳk7A-7IIײ<^HosY$!NGDLE@3JYyQ0
+attr pkg3-1-1.noarch@available solvable:filelist /usr/share/pkg3/d0/{&|f:[pU20Z4zdeծK(Ew'j{wMn
+attr pkg3-1-1.noarch@available solvable:filelist /usr/share/pkg3/d0/{d?Ak_iGf:D2kXvTh)gRSgUz!@!
+attr pkg3-1-1.noarch@available solvable:filelist /usr/share/pkg3/d0/vfRu@"-qdR+akiV83dR`nAu"2ܨBd.
+attr pkg3-1-1.noarch@available solvable:filelist /usr/share/pkg3/d0/G8e];4~Vnkr)XwT%A68%auu*ʱ~fEBC{:P
+attr pkg3-1-1.noarch@available solvable:filelist /usr/share/pkg3/d1/@)xHQW$aS,6*DS]L0}4HjL+)aH9-F{
+attr pkg3-1-1.noarch@available solvable:filelist /usr/share/pkg3/d1/l.yG6>+yW-PqrX5KQv2,aFlcNuNgbz]3A
+attr pkg3-1-1.noarch@available solvable:filelist /usr/share/pkg3/d1/H<.Զ'n~06$pNZjH(ХIscWP(A8(Sg'1)
+attr pkg3-1-1.noarch@available solvable:filelist /usr/share/pkg3/d1/bg]l'oq*,mS:^T6?cyѳs+nʡ6?%H
+attr pkg3-1-1.noarch@available solvable:filelist /usr/share/pkg3/d1/iuh,12>Td15!hCba-9Cb1ؿ&5>Xbt
+attr pkg3-1-1.noarch@available solvable:filelist /usr/share/pkg3/d1/;:PKpuoo7+DtAKͯ׷:H.Ls@FNkx=y!Ҧ:Y4}
+attr pkg3-1-1.noarch@available solvable:filelist /usr/share/pkg3/d1/!xj(3_PhuիatIVCL+QT1<+Fe
+attr pkg3-1-1.noarch@available solvable:filelist /usr/share/pkg3/d2/+?^mQS?V5N5NϦI;"r,)Ty$ܪnmDL>,glpnb<R
+attr pkg3-1-1.noarch@available solvable:filelist /usr/share/pkg3/d2/Ayq'[ٯTe*:hXWtY'q9ҺǬ6^o^Yp]8
+attr pkg3-1-1.noarch@available solvable:filelist /usr/share/pkg3/d2/eҺ?1(^<)L3L}C:|A쥳a0wmm貽Y$gKh2D
+attr pkg3-1-1.noarch@available solvable:filelist /usr/share/pkg3/d2/?յ1O4bZz&%[Y5bsyP<RgS]M1|*FV)L
+attr pkg3-1-1.noarch@available solvable:filelist /usr/share/pkg3/d2/;_Nb£U6P]cC:ᴮ`륯Bd~~hJm-dt<Oqݦ@
+attr pkg3-1-1.noarch@available solvable:filelist /usr/share/pkg3/d2/nxYvzZt)lǡ]]uI{OQN~}Zu]2^.3(;
+attr pkg3-1-1.noarch@available solvable:name pkg3
+attr pkg3-1-1.noarch@available solvable:provides cap3 = 3
+attr pkg3-1-1.noarch@available solvable:requires cap2
+attr pkg3-1-1.noarch@available solvable:summary package number 3
+attr pkg30-1-1.noarch@available solvable:arch noarch
+attr pkg30-1-1.noarch@available solvable:buildtime 1600108030
+attr pkg30-1-1.noarch@available solvable:evr 1-1
+attr pkg30-1-1.noarch@available solvable:filelist /usr/share/pkg30/d0/2_a&,""q)*6=ϵxft}L$B6$R@go;`aJ
+attr pkg30-1-1.noarch@available solvable:filelist /usr/share/pkg30/d0/?])<34R=aZ0Bm^lP6;p,mf'}CqxUi_
+attr pkg30-1-1.noarch@available solvable:filelist /usr/share/pkg30/d0/w9mX!Ҹp8'F2Q{"5vhr?}cs?)AOɱLSe
+attr pkg30-1-1.noarch@available solvable:filelist /usr/share/pkg30/d0/`)~`]OSI4vҥ&$6u+ƽ5d]Ds}uYO`[eE@'z
+attr pkg30-1-1.noarch@available solvable:filelist /usr/share/pkg30/d0/2~RӭyXDlx4_9(Yiy>TPY.`qx;,eT1cvi2Z~bjppI
+attr pkg30-1-1.noarch@available solvable:filelist /usr/share/pkg30/d0/kxh'vt!81E.?P7:&>}qkvpV.^@P7nNCӪ3~`
+attr pkg30-1-1.noarch@available solvable:filelist /usr/share/pkg30/d0/@^MXE8{aJA(3q&75XE6ծr>DA(v4ll
+attr pkg30-1-1.noarch@available solvable:filelist /usr/share/pkg30/d1/1ڨ!rQ%H~z]"+<YphblJa)|LZQݰUgR@z|
+attr pkg30-1-1.noarch@available solvable:filelist /usr/share/pkg30/d1/Zu<R7U2s,1-Pr1+sIظzca)J:]5h*V
+attr pkg30-1-1.noarch@available solvable:filelist /usr/share/pkg30/d1/Zj.wevok9hk~deJ5Z9eXR4-zb>aX3Vxl~mGw[
+attr pkg30-1-1.noarch@available solvable:filelist /usr/share/pkg30/d1/czӺR.11>H0|Y8A':2FJO,Mkh1$CwFa5,^c*Z1zO
+attr pkg30-1-1.noarch@available solvable:filelist /usr/share/pkg30/d1/DP7.dHyl+qgJ~ޯ*egy&dt6:SY1tt
+attr pkg30-1-1.noarch@available solvable:filelist /usr/share/pkg30/d1/.f4HBa)L:`VD׺P'3LoBtJ.g(&`Yw_Ϭ
+attr pkg30-1-1.noarch@available solvable:filelist /usr/share/pkg30/d1/=So+j[wHKYznFQkRVJ(|𰭪[x7._@1@Sxb
+attr pkg30-1-1.noarch@available solvable:filelist /usr/share/pkg30/d2/7_w_`-%ԫl-B+F,V:|D|-Ji>MuJګjX
+attr pkg30-1-1.noarch@available solvable:filelist /usr/share/pkg30/d2/eGV@(<]Yg$;c:2&S[I,c&6`%CG]FJd
+attr pkg30-1-1.noarch@available solvable:filelist /usr/share/pkg30/d2/e9rmyA&r5m&b,%jkrУS!Fsk:&_h
+attr pkg30-1-1.noarch@available solvable:filelist /usr/share/pkg30/d2/znDf)1qulpeC7e}󭩳eƪ1(iidcLYn@
+attr pkg30-1-1.noarch@available solvable:filelist /usr/share/pkg30/d2/Bb_T6OظtWgvQEuPEY>ٿ~Zoܫy]GbpSK^La
+attr pkg30-1-1.noarch@available solvable:filelist /usr/share/pkg30/d2/~ݰqJO1R{f;Wo|rгT컸nXjGmXd(9C4.
+attr pkg30-1-1.noarch@available solvable:name pkg30
+attr pkg30-1-1.noarch@available solvable:provides cap30 = 30
+attr pkg30-1-1.noarch@available solvable:requires cap29
+attr pkg30-1-1.noarch@available solvable:summary package number 30
+attr pkg31-2-1.noarch@available solvable:arch noarch
+attr pkg31-2-1.noarch@available solvable:buildtime 1600111631
+attr pkg31-2-1.noarch@available solvable:evr 2-1
+attr pkg31-2-1.noarch@available solvable:filelist /usr/share/pkg31/d0/bβ԰ŵh^d_!U9,39ڥWUymw4ѣKaF7zF9=i
+attr pkg31-2-1.noarch@available solvable:filelist /usr/share/pkg31/d0/oycg~AMOeFN:O*DM]NTFvm33::{sFWy
+attr pkg31-2-1.noarch@available solvable:filelist /usr/share/pkg31/d0/xeKhf)Y-)Ǥloj+IN]3]Ivg:dP'n]@o-vN?
+attr pkg31-2-1.noarch@available solvable:filelist /usr/share/pkg31/d0/UGIǺT"2n:tp7lKeTq^QO]WC2X3p@FUz
+attr pkg31-2-1.noarch@available solvable:filelist /usr/share/pkg31/d0/aw}e-ֽD7E~clw%ƭ"Nm~9@©??lc[
+attr pkg31-2-1.noarch@available solvable:filelist /usr/share/pkg31/d0/m+~uQd)b_ZKE%{kR0ڲ6Rz0D@bKV2Mա?Zj
+attr pkg31-2-1.noarch@available solvable:filelist /usr/share/pkg31/d0/϶L]D_!^ͫsRq=յ9'V968_tcK}ܪ(
+attr pkg31-2-1.noarch@available solvable:filelist /usr/share/pkg31/d1/"bO`x22>sEe[J(?ٱa7aVAl}!
+attr pkg31-2-1.noarch@available solvable:filelist /usr/share/pkg31/d1/5cxlR,Ivbd-e)|v2yY~ls6wzvcpOo%
+attr pkg31-2-1.noarch@available solvable:filelist /usr/share/pkg31/d1/DUc)bNml>D]HD@1JFN~Sf?R1a"dy<2Wmi
+attr pkg31-2-1.noarch@available solvable:filelist /usr/share/pkg31/d1/,ROMI;Y,$D}XhsS!LM֮arҿ<pN~6b=*5y
+attr pkg31-2-1.noarch@available solvable:filelist /usr/share/pkg31/d1/GU<KKl~R2_rErʥ%d'pEZAua=p;6v0xW(-
+attr pkg31-2-1.noarch@available solvable:filelist /usr/share/pkg31/d1/",%iAt(UgU9Ge8Ajy%L9?%dFdVz_I*0-
+attr pkg31-2-1.noarch@available solvable:filelist /usr/share/pkg31/d1/bPeBbGBLMk޻E[>T]lUnbCc>HID.L$
+attr pkg31-2-1.noarch@available solvable:filelist /usr/share/pkg31/d2/2uפ<6P_6<>^O"6Vm&׼`-lDlSP>ZT&cl:ĤM
+attr pkg31-2-1.noarch@available solvable:filelist /usr/share/pkg31/d2/?hhCpj?&$-nd!S-{"EI&t<KMNp
+attr pkg31-2-1.noarch@available solvable:filelist /usr/share/pkg31/d2/L%j51I("[YKR=IbX@iM'6xw*nVW>~=ж$8U"
+attr pkg31-2-1.noarch@available solvable:filelist /usr/share/pkg31/d2/)70jkRfMe)GxLu.NȨaآq0.n
+attr pkg31-2-1.noarch@available solvable:filelist /usr/share/pkg31/d2/h,rBSd4A^AbOw^L^neA3uAZY'
+attr pkg31-2-1.noarch@available solvable:filelist /usr/share/pkg31/d2/c;WoPqr%7}fyF%wNQquv],lRX8!ItG)"l-_^H
+attr pkg31-2-1.noarch@available solvable:name pkg31
+attr pkg31-2-1.noarch@available solvable:provides cap31 = 31
+attr pkg31-2-1.noarch@available solvable:requires cap30
+attr pkg31-2-1.noarch@available solvable:summary package number 31
+attr pkg32-3-1.noarch@available solvable:arch noarch
+attr pkg32-3-1.noarch@available solvable:buildtime 1600115232
+attr pkg32-3-1.noarch@available solvable:evr 3-1
+attr pkg32-3-1.noarch@available solvable:filelist /usr/share/pkg32/d0/-=|C^+"%w@^')tM<!p[Eqg+U[Cton<$MJ{
+attr pkg32-3-1.noarch@available solvable:filelist /usr/share/pkg32/d0/PQslok8ïx~$(wWۿytDpiEt%足,g{$sK
+attr pkg32-3-1.noarch@available solvable:filelist /usr/share/pkg32/d0/g+;6Elp]X[â'[]u]}N)?^5G;|AT7v4@PxP+
+attr pkg32-3-1.noarch@available solvable:filelist /usr/share/pkg32/d0/i=,1:ͮs3n!DSi(<rl!kf~FDKON~P!+}J
+attr pkg32-3-1.noarch@available solvable:filelist /usr/share/pkg32/d0/xt9Y!}(zCǻ"la@tV[tqLRZqѡV5bHB`Ik@j~L-
+attr pkg32-3-1.noarch@available solvable:filelist /usr/share/pkg32/d0/O?I:<JUaduG"A|0*{3o<>jirurJTLc&op
+attr pkg32-3-1.noarch@available solvable:filelist /usr/share/pkg32/d0/vݣR^KAAXxOvM$)Q4Wt.pMdle$C
+attr pkg32-3-1.noarch@available solvable:filelist /usr/share/pkg32/d1/=&H|D]T;`qX'n'!}*fS8Peh5<_*%C
+attr pkg32-3-1.noarch@available solvable:filelist /usr/share/pkg32/d1/Hm~Uumc=76s@O!T;I{9qahT=E^NsPDt
+attr pkg32-3-1.noarch@available solvable:filelist /usr/share/pkg32/d1/b-W)(!|l~ͻN5^GEHWKhWCk%h-a-*eS
+attr pkg32-3-1.noarch@available solvable:filelist /usr/share/pkg32/d1/urUtk,=;D$L2;CF8Z(*ܲbo^?rls6M5m
+attr pkg32-3-1.noarch@available solvable:filelist /usr/share/pkg32/d1/ΡOwtPE}O!1F}i4jjXBĶߪ-@0'TyM2&=5xl}4m
+attr pkg32-3-1.noarch@available solvable:filelist /usr/share/pkg32/d1/U&פ>wd@0WpI]'vfmI,5CXUD(^;v[]
+attr pkg32-3-1.noarch@available solvable:filelist /usr/share/pkg32/d1/wll1x%yzǨ{2ܶp~Qzc[E{wtVno7"Cٳ;ew
+attr pkg32-3-1.noarch@available solvable:filelist /usr/share/pkg32/d2/).5G',P;%fM(9wABLHXR*}O,+aZ60|_'F}N
+attr pkg32-3-1.noarch@available solvable:filelist /usr/share/pkg32/d2/4z%4i[yRH+sv!J(>w7?g>k}`g3
+attr pkg32-3-1.noarch@available solvable:filelist /usr/share/pkg32/d2/<JUy~A!W|iE4txx1[G9o!IFJo<05s
+attr pkg32-3-1.noarch@available solvable:filelist /usr/share/pkg32/d2/H>!^424n|һSI+(b.l=p<tW<cL"(h}
+attr pkg32-3-1.noarch@available solvable:filelist /usr/share/pkg32/d2/_,|Y|;s|%7]a!&9"=0I'vGhK2HJ<Ǣkrҽ
+attr pkg32-3-1.noarch@available solvable:filelist /usr/share/pkg32/d2/sYD&0?7PuIFaxs;zdkjNzGI0Ro6e`
+attr pkg32-3-1.noarch@available solvable:name pkg32
+attr pkg32-3-1.noarch@available solvable:provides cap32 = 32
+attr pkg32-3-1.noarch@available solvable:requires cap31
+attr pkg32-3-1.noarch@available solvable:summary package number 32
+attr pkg33-1-1.noarch@available solvable:arch noarch
+attr pkg33-1-1.noarch@available solvable:buildtime 1600118833
+attr pkg33-1-1.noarch@available solvable:evr 1-1
+attr pkg33-1-1.noarch@available solvable:filelist /usr/share/pkg33/d0/p>6]Gk|'yekV|lJ.MQ9ANnY;;ӳB7q_8*;_}u9+
+attr pkg33-1-1.noarch@available solvable:filelist /usr/share/pkg33/d0/N&5Xf|lnͫ6kddS:,Syo^'u^r$xh
+attr pkg33-1-1.noarch@available solvable:filelist /usr/share/pkg33/d0/Nзg֬[{&[P;"Lr<2PXkN0emmN{BX`7
+attr pkg33-1-1.noarch@available solvable:filelist /usr/share/pkg33/d0/,4PfW?Htf;骰Uf8w^j=Jra2_9@(YeyU
+attr pkg33-1-1.noarch@available solvable:filelist /usr/share/pkg33/d0/5kP&'zua"HeUF-WWV2Lnn!âfæ^5ԣ8?>
+attr pkg33-1-1.noarch@available solvable:filelist /usr/share/pkg33/d0/W*u0[D>acO$+hzT@l9B$w9@S:'.-n
+attr pkg33-1-1.noarch@available solvable:filelist /usr/share/pkg33/d0/䷷>:.ZȽtL'-MvIE'Z_~opt0LC(JE&wk
+attr pkg33-1-1.noarch@available solvable:filelist /usr/share/pkg33/d1/&+tOťֳ$Q0TH=O3[RJ.ƺɮL̽CzeJ:VV^Q-
+attr pkg33-1-1.noarch@available solvable:filelist /usr/share/pkg33/d1/JeDD1NDoi9Hͣ;6Tz=Ψj(.h.ͣi{]Ө
+attr pkg33-1-1.noarch@available solvable:filelist /usr/share/pkg33/d1/Wkѥ0.L;OIY(c*j(HL"%*b*wkY]v¾Mze;Tw.
+attr pkg33-1-1.noarch@available solvable:filelist /usr/share/pkg33/d1/kcgS'߽6HK+1?HZccP7{I"z_9RBys)5J>]
+attr pkg33-1-1.noarch@available solvable:filelist /usr/share/pkg33/d1/o3(+|tS`~rb~&U~?n,5-Hv^o?ಯx5e04Y
+attr pkg33-1-1.noarch@available solvable:filelist /usr/share/pkg33/d1/{|<?`%jV[A4Xwk%-[)}"qcv!";q:u'YR`,&
+attr pkg33-1-1.noarch@available solvable:filelist /usr/share/pkg33/d1/<跽U<cjs3.8KCټx=n٥hhuuSh+32cU%
+attr pkg33-1-1.noarch@available solvable:filelist /usr/share/pkg33/d2/S8z2G^c,t~)7SMZ%x@O!_)c3xQ1bϷ"h
+attr pkg33-1-1.noarch@available solvable:filelist /usr/share/pkg33/d2/<BX(_Ȼ7P%I&.T[XYB)fBLoI
+attr pkg33-1-1.noarch@available solvable:filelist /usr/share/pkg33/d2/MKw)̬Bu~28n+r+Q.5V0~x2E<%wUK
+attr pkg33-1-1.noarch@available solvable:filelist /usr/share/pkg33/d2/>m]ǬN5@0Uw,g$&(բv@l*}l+3W"O
+attr pkg33-1-1.noarch@available solvable:filelist /usr/share/pkg33/d2/-n:|qN_B^.~{H,,u0Jy$}uXk)mxU@$
+attr pkg33-1-1.noarch@available solvable:filelist /usr/share/pkg33/d2/9QOcrb"v0gCIR$e{LlxH-ga1l(GbܫY
+attr pkg33-1-1.noarch@available solvable:name pkg33
+attr pkg33-1-1.noarch@available solvable:provides cap33 = 33
+attr pkg33-1-1.noarch@available solvable:requires cap32
+attr pkg33-1-1.noarch@available solvable:summary package number 33
+attr pkg34-2-1.noarch@available solvable:arch noarch
+attr pkg34-2-1.noarch@available solvable:buildtime 1600122434
+attr pkg34-2-1.noarch@available solvable:evr 2-1
+attr pkg34-2-1.noarch@available solvable:filelist /usr/share/pkg34/d0/Ow`gjĮ4׬1.'S3P+>cl+D(J<[x&*O$H8
+attr pkg34-2-1.noarch@available solvable:filelist /usr/share/pkg34/d0/lV&e65taӨN^YS-0]?(ԵdxlVڼ{bG%[yVTJ
+attr pkg34-2-1.noarch@available solvable:filelist /usr/share/pkg34/d0/T=YwG諽d{4SҧMpF'{I<5jnD;fT
+attr pkg34-2-1.noarch@available solvable:filelist /usr/share/pkg34/d0/ugU8wV_j:"v=('Tym'$;n01BYy&ylF
+attr pkg34-2-1.noarch@available solvable:filelist /usr/share/pkg34/d0/CXZd|Nҵ@AISW})i.{^gd9<[kF븳gh<z
+attr pkg34-2-1.noarch@available solvable:filelist /usr/share/pkg34/d0/c|o!?pW|*{Hd%Fس~mdT5?Ir(_|ANfX31
+attr pkg34-2-1.noarch@available solvable:filelist /usr/share/pkg34/d0/VnuW[m[msڽ2$ްTx,Bkج!XY1
+attr pkg34-2-1.noarch@available solvable:filelist /usr/share/pkg34/d1/;"_$ܲ]$1]yDcTRiڲ{(W)gTU^Z_PmH`K0˩
+attr pkg34-2-1.noarch@available solvable:filelist /usr/share/pkg34/d1/?;oGvj"CrfT,ouO&ο9m_p%39Zu^6FҬ
+attr pkg34-2-1.noarch@available solvable:filelist /usr/share/pkg34/d1/FM9ت'ָ]<y[oe;Z3E]lW0lͰ$Rm1V
+attr pkg34-2-1.noarch@available solvable:filelist /usr/share/pkg34/d1/Y=h9Sgιo9ң:k]3{5uT_<c'vh{:DH5
+attr pkg34-2-1.noarch@available solvable:filelist /usr/share/pkg34/d1/YU-U̷Ytg[4UVh!κui??tqCEd1MlP}e
+attr pkg34-2-1.noarch@available solvable:filelist /usr/share/pkg34/d1/^2Ľ3:?Y3"_"!U9q+o"C8JêJc>,1djW-F$WK
+attr pkg34-2-1.noarch@available solvable:filelist /usr/share/pkg34/d1/>H?,lVXf0o*`W,-9h%OF|q45V<PS,&ְ,
+attr pkg34-2-1.noarch@available solvable:filelist /usr/share/pkg34/d2/'E1C+1ڼ)ܲo^5@h_Ф^G]9M{F:lnڦxb9mV
+attr pkg34-2-1.noarch@available solvable:filelist /usr/share/pkg34/d2/}IwR*I"Ug;!{e$iz>5DlmxmpC'&Fj.vbq80$Y
+attr pkg34-2-1.noarch@available solvable:filelist /usr/share/pkg34/d2/gzkd]6yB*]<p`?sU,GU$S>v:iX`ii=dkh
+attr pkg34-2-1.noarch@available solvable:filelist /usr/share/pkg34/d2/5Is@0l2%hO9.ҥ60r33KCr$ȬEzˢ~Loo|QE!
+attr pkg34-2-1.noarch@available solvable:filelist /usr/share/pkg34/d2/2CcOXt]g$"Ur[WJYl'3R8Km|2YB
+attr pkg34-2-1.noarch@available solvable:filelist /usr/share/pkg34/d2/-'!l-&L=|M<E޹jbP<5B14~+ҰQZq)s%
+attr pkg34-2-1.noarch@available solvable:name pkg34
+attr pkg34-2-1.noarch@available solvable:provides cap34 = 34
+attr pkg34-2-1.noarch@available solvable:requires cap33
+attr pkg34-2-1.noarch@available solvable:summary package number 34
+attr pkg35-3-1.noarch@available solvable:arch noarch
+attr pkg35-3-1.noarch@available solvable:buildtime 1600126035
+attr pkg35-3-1.noarch@available solvable:evr 3-1
+attr pkg35-3-1.noarch@available solvable:filelist /usr/share/pkg35/d0/&ZG3;q857>B"UjY'Z[P[]aFH(`,wkJd68d
+attr pkg35-3-1.noarch@available solvable:filelist /usr/share/pkg35/d0/4:ɯz779G%v(kv`+2L{DPwL0j9eTu|<2
+attr pkg35-3-1.noarch@available solvable:filelist /usr/share/pkg35/d0/F",BDp+5Fu7Ԥj*erwf1SũϺ`[Jo98;u(
+attr pkg35-3-1.noarch@available solvable:filelist /usr/share/pkg35/d0/UF1bm1h[pStУhVS,g[)?ºNmke?o'd}@nF
+attr pkg35-3-1.noarch@available solvable:filelist /usr/share/pkg35/d0/y0ELQ?cIFA&7IUUfO;@fsŢTS^+GSI$
+attr pkg35-3-1.noarch@available solvable:filelist /usr/share/pkg35/d0/۶@?Z,ctVS~ZZ]f>skpJP+64WȮ{
+attr pkg35-3-1.noarch@available solvable:filelist /usr/share/pkg35/d0/':J{A*NVB2bػ&g$zO,E]@Xb?(o2&
+attr pkg35-3-1.noarch@available solvable:filelist /usr/share/pkg35/d1/8Ar{W-S__}83S.85۸R;8ZmOa!?j&k?y{Ppe4
+attr pkg35-3-1.noarch@available solvable:filelist /usr/share/pkg35/d1/AS`^4):Ef-롭hY޷{.Gg½4}@3yZYcotI
+attr pkg35-3-1.noarch@available solvable:filelist /usr/share/pkg35/d1/hH,xʼԼ:OU=?hc״@`=$-p>kXX-c:i)Q7}
+attr pkg35-3-1.noarch@available solvable:filelist /usr/share/pkg35/d1/pd([ouo`I[zoǧ4vjbKlVDB'1'P[{qSU+4
+attr pkg35-3-1.noarch@available solvable:filelist /usr/share/pkg35/d1/-ֳjNf,zlg1^.i4+-xgU(h3@}6ީXB.e*
+attr pkg35-3-1.noarch@available solvable:filelist /usr/share/pkg35/d1/8">{(AjWfbcMLQ|1Ub0*wBO9qxayk
+attr pkg35-3-1.noarch@available solvable:filelist /usr/share/pkg35/d1/4N_<r+R*MI&pgˡ1+!OH=X8daIqQk(Ek
+attr pkg35-3-1.noarch@available solvable:filelist /usr/share/pkg35/d2/5WLۦءctEchU>$ԤH*!g+RT`g5T$]5H
+attr pkg35-3-1.noarch@available solvable:filelist /usr/share/pkg35/d2/6greLzo=;9guQ9Ivs:p-Mi:{Ac
+attr pkg35-3-1.noarch@available solvable:filelist /usr/share/pkg35/d2/,51}>J]&CiB}f$7moI]TpҰbd]$c}}Z?_QwMB
+attr pkg35-3-1.noarch@available solvable:filelist /usr/share/pkg35/d2/!R~_xO8ۡ[45ҿDTu2as`v!,-jz9C0F(
+attr pkg35-3-1.noarch@available solvable:filelist /usr/share/pkg35/d2/`_0G?Jet0QqcZKv!q5?^L+7_PnMCxJ8jD8mi
+attr pkg35-3-1.noarch@available solvable:filelist /usr/share/pkg35/d2/&IEGXT7{Cã^~IuC{mi,Zj)SK6hksIRe&G
+attr pkg35-3-1.noarch@available solvable:name pkg35
+attr pkg35-3-1.noarch@available solvable:provides cap35 = 35
+attr pkg35-3-1.noarch@available solvable:requires cap34
+attr pkg35-3-1.noarch@available solvable:summary package number 35
+attr pkg36-1-1.noarch@available solvable:arch noarch
+attr pkg36-1-1.noarch@available solvable:buildtime 1600129636
+attr pkg36-1-1.noarch@available solvable:evr 1-1
+attr pkg36-1-1.noarch@available solvable:filelist /usr/share/pkg36/d0/-Yҫ)qLZ>wֿicˬ9Tδ-WWW(B-ON48iB`gL
+attr pkg36-1-1.noarch@available solvable:filelist /usr/share/pkg36/d0/Fs''ޡc2C`)oD5Y6rSc|<2k9OzEHiJM0a
+attr pkg36-1-1.noarch@available solvable:filelist /usr/share/pkg36/d0/HPjD]9d%`12!Gsa8&?z36"m'e(lTl
+attr pkg36-1-1.noarch@available solvable:filelist /usr/share/pkg36/d0/m5<qvhgoDrZq01bVl1nxLveϧ((X̣"S>v
+attr pkg36-1-1.noarch@available solvable:filelist /usr/share/pkg36/d0/SN]1m۩~hOoXv(:$yW2D'$o_dC_C?QlL
+attr pkg36-1-1.noarch@available solvable:filelist /usr/share/pkg36/d0/q{f-uC`xmZr{J3&cx]1oE2umMqotw
+attr pkg36-1-1.noarch@available solvable:filelist /usr/share/pkg36/d0/~dxtyLNPh"vF9Ы,y.tXa&~||FKf$}|nl
+attr pkg36-1-1.noarch@available solvable:filelist /usr/share/pkg36/d1/;BdӭY^NYK&鿼~jE;yvG*۰US<ݼwLQ
+attr pkg36-1-1.noarch@available solvable:filelist /usr/share/pkg36/d1/HalfP.:?LP)E=_;>}QwXe[sgGUu$F&1CmߡK
+attr pkg36-1-1.noarch@available solvable:filelist /usr/share/pkg36/d1/ZȲNa3NJiSG;wJ}+ٶH,ɰͬ&5w)no}9!
+attr pkg36-1-1.noarch@available solvable:filelist /usr/share/pkg36/d1/b>B6ga,u7En8B)kFrFlKTJvaB>QDhW
+attr pkg36-1-1.noarch@available solvable:filelist /usr/share/pkg36/d1/ifJrUa:YzqХ(O6|loZTyR78jII!).-
+attr pkg36-1-1.noarch@available solvable:filelist /usr/share/pkg36/d1/k])S|Xwaz;ek`Bn[d=n14Ydhb*(F
+attr pkg36-1-1.noarch@available solvable:filelist /usr/share/pkg36/d1/qys?6ܻ(yKT&gUrYC,B6yQ.wX.>:Rӻ-3c5
+attr pkg36-1-1.noarch@available solvable:filelist /usr/share/pkg36/d2/4+UX~VkengҤU6hsuݶ~X{nw+-i$UUˡ
+attr pkg36-1-1.noarch@available solvable:filelist /usr/share/pkg36/d2/iiP(G|KlN4wTtrGj~2G5llg|~[pm6cnCF=q?j)x;
+attr pkg36-1-1.noarch@available solvable:filelist /usr/share/pkg36/d2/a<a!~<z_<qt%dte*j}1Qih:ge_4lIy~
+attr pkg36-1-1.noarch@available solvable:filelist /usr/share/pkg36/d2/]&U`3+-][W;:cMvS٢rcY3_A-&_-i
+attr pkg36-1-1.noarch@available solvable:filelist /usr/share/pkg36/d2/gOH+*`^bVrvfgQxr<_B)(<`g%*kU?Jz82"|
+attr pkg36-1-1.noarch@available solvable:filelist /usr/share/pkg36/d2/ktϧE,,]0gk1{T&za~ObJMDpCH"t
+attr pkg36-1-1.noarch@available solvable:name pkg36
+attr pkg36-1-1.noarch@available solvable:provides cap36 = 36
+attr pkg36-1-1.noarch@available solvable:requires cap35
+attr pkg36-1-1.noarch@available solvable:summary package number 36
+attr pkg37-2-1.noarch@available solvable:arch noarch
+attr pkg37-2-1.noarch@available solvable:buildtime 1600133237
+attr pkg37-2-1.noarch@available solvable:evr 2-1
+attr pkg37-2-1.noarch@available solvable:filelist /usr/share/pkg37/d0/OiA['_%o!c"1p2ui~er[ZASCX$uTP)ROM
+attr pkg37-2-1.noarch@available solvable:filelist /usr/share/pkg37/d0/YilD)A&Xxp*&u&{D%)A"p%k[]n~[PfPL
+attr pkg37-2-1.noarch@available solvable:filelist /usr/share/pkg37/d0/lqHDfI>F3_@'J7NO5F'Fiб:)̫c@|M&5F
+attr pkg37-2-1.noarch@available solvable:filelist /usr/share/pkg37/d0/{.s%$K4x=qO2Za$ҷ$裦K+rD+˨)Fs_8
+attr pkg37-2-1.noarch@available solvable:filelist /usr/share/pkg37/d0/+K>r:ill`)h%ʹַ$u5NPGC={R;|2om8l
+attr pkg37-2-1.noarch@available solvable:filelist /usr/share/pkg37/d0/m9V~_^@!4SDaʫJv,ʩȲKF?WȼZe;z
+attr pkg37-2-1.noarch@available solvable:filelist /usr/share/pkg37/d0/WG+Nz%2I:bU%2.ޣTau^Yy$9(RN9nd[Sg
+attr pkg37-2-1.noarch@available solvable:filelist /usr/share/pkg37/d1/.!I}CϥSxH+_w}٭CƼ*f{I+LKkaC
+attr pkg37-2-1.noarch@available solvable:filelist /usr/share/pkg37/d1/Ifa>?oDg'QC@sGHz1^Xp8nC7QDpnl
+attr pkg37-2-1.noarch@available solvable:filelist /usr/share/pkg37/d1/N[긬u|iZHF}0iC[S9yR[_+vSۥ9z4ǹ"y]x
+attr pkg37-2-1.noarch@available solvable:filelist /usr/share/pkg37/d1/iϹ%4hM%d>Hh3hC0v>¢6Uny&,GA+j1%6
+attr pkg37-2-1.noarch@available solvable:filelist /usr/share/pkg37/d1/mfCr;&1<KwzpE*879~a$df;9|,!=6M
+attr pkg37-2-1.noarch@available solvable:filelist /usr/share/pkg37/d1/h_zaZwlGH)w^ak0s<-dW+^YD@c][*SM
+attr pkg37-2-1.noarch@available solvable:filelist /usr/share/pkg37/d1/]~4ihG04^?q?Oishaӻʨ)`AEAgrrfj+e
+attr pkg37-2-1.noarch@available solvable:filelist /usr/share/pkg37/d2/J8Y{4;|mebG.ԼX;Z:o50y7m)41=,J
+attr pkg37-2-1.noarch@available solvable:filelist /usr/share/pkg37/d2/aDYhLK}4<Lud]3ũDY;17P.4YBV4Ϋ{)ɮTWK
+attr pkg37-2-1.noarch@available solvable:filelist /usr/share/pkg37/d2/$|NmRLuk+1w~]B-po"!OJL7e}}}*POvE
+attr pkg37-2-1.noarch@available solvable:filelist /usr/share/pkg37/d2/LuLg=TҨH0yx{שPAgJ]zx^tD>3
+attr pkg37-2-1.noarch@available solvable:filelist /usr/share/pkg37/d2/P'+kU&y%JLa(f[l.W-of3>XDF9X{(
+attr pkg37-2-1.noarch@available solvable:filelist /usr/share/pkg37/d2/kfNTeq$i2,wOP:A2dZi̯XA70
+attr pkg37-2-1.noarch@available solvable:name pkg37
+attr pkg37-2-1.noarch@available solvable:provides cap37 = 37
+attr pkg37-2-1.noarch@available solvable:requires cap36
+attr pkg37-2-1.noarch@available solvable:summary package number 37
+attr pkg38-3-1.noarch@available solvable:arch noarch
+attr pkg38-3-1.noarch@available solvable:buildtime 1600136838
+attr pkg38-3-1.noarch@available solvable:evr 3-1
+attr pkg38-3-1.noarch@available solvable:filelist /usr/share/pkg38/d0/<ڪj]-"qn13mI7pL7k=;'^TDD[p<+eSO7U%
+attr pkg38-3-1.noarch@available solvable:filelist /usr/share/pkg38/d0/P3rF9pĴSD-jըN1Y]49Yh0ʡF4tFes=Re
+attr pkg38-3-1.noarch@available solvable:filelist /usr/share/pkg38/d0/T-rW*d,t{;T)qEͤ3tO9?h'c9;_{%{,
+attr pkg38-3-1.noarch@available solvable:filelist /usr/share/pkg38/d0/x~RAi<qثB68757"utIPV,Q|.QYBwIY
+attr pkg38-3-1.noarch@available solvable:filelist /usr/share/pkg38/d0/6B7ReB׺}GCh|`B;C$]soqp8Kpc>VV{D
+attr pkg38-3-1.noarch@available solvable:filelist /usr/share/pkg38/d0/R}zĸ_.~i=8H=+:@Ȧ|w7t9`g(?rIBr6@.
+attr pkg38-3-1.noarch@available solvable:filelist /usr/share/pkg38/d0/`]jc_?xB}SJeSq1te@G_R&3'<cn2A|}8Y})
+attr pkg38-3-1.noarch@available solvable:filelist /usr/share/pkg38/d1/!YPRqD{G譬xWqOP[p{j;fnR`H6+C0vy
+attr pkg38-3-1.noarch@available solvable:filelist /usr/share/pkg38/d1/C2b~0vAS@T8wb<OL4cͦC͸_GJzt4ahu
+attr pkg38-3-1.noarch@available solvable:filelist /usr/share/pkg38/d1/C+~5zhd~e1U8a-M:reVX-F3୦Mtw%pPZk
+attr pkg38-3-1.noarch@available solvable:filelist /usr/share/pkg38/d1/ASS(z>`a?x)e0eç*ItCJP"BxT캺]8VsUt3
+attr pkg38-3-1.noarch@available solvable:filelist /usr/share/pkg38/d1/CH>,ȭGp4*p3FJ=t9p}O.L;ZSFj^۷4Ou
+attr pkg38-3-1.noarch@available solvable:filelist /usr/share/pkg38/d1/%;dM֤g<4a7C8x@2׷rF}|LNYS^YҼ
+attr pkg38-3-1.noarch@available solvable:filelist /usr/share/pkg38/d1/-oûHT:îhzkgr5yWcX2:Xfp{xHsSn1wZ&8oEA
+attr pkg38-3-1.noarch@available solvable:filelist /usr/share/pkg38/d2/*pi0}DW=o$@&$s©P:asʿe::VCk}.D._ݷ2{
+attr pkg38-3-1.noarch@available solvable:filelist /usr/share/pkg38/d2/D3V:)S2%we<35?3-9s;`ci"z=XU0g
+attr pkg38-3-1.noarch@available solvable:filelist /usr/share/pkg38/d2/Ex>*O8bS8rsoGv3x.3:6Y7M8ٱ&-PS|1
+attr pkg38-3-1.noarch@available solvable:filelist /usr/share/pkg38/d2/<*Ȳ<qe~_}KER=|tjDsr00(h|Ds=no]H{
+attr pkg38-3-1.noarch@available solvable:filelist /usr/share/pkg38/d2/׻-AiYZ9kXȨ'FK?aW^%7Y4>w7I.̥o
+attr pkg38-3-1.noarch@available solvable:filelist /usr/share/pkg38/d2/2J4nΩ7(MbSm`j)>KOL&l2X(!J9{jvFƸ
+attr pkg38-3-1.noarch@available solvable:name pkg38
+attr pkg38-3-1.noarch@available solvable:provides cap38 = 38
+attr pkg38-3-1.noarch@available solvable:requires cap37
+attr pkg38-3-1.noarch@available solvable:summary package number 38
+attr pkg39-1-1.noarch@available solvable:arch noarch
+attr pkg39-1-1.noarch@available solvable:buildtime 1600140439
+attr pkg39-1-1.noarch@available solvable:evr 1-1
+attr pkg39-1-1.noarch@available solvable:filelist /usr/share/pkg39/d0/El,ٹn*8zNr,3ͫAG2Y1s֤O-99'BQ!RgG{:F2
+attr pkg39-1-1.noarch@available solvable:filelist /usr/share/pkg39/d0/KG3_WT1P~;)h9yDs-@Fo;)"_XKϿ)aS,
+attr pkg39-1-1.noarch@available solvable:filelist /usr/share/pkg39/d0/oWeUdcJ594)Gi9cS)+{ϯHkP@C]yPu
+attr pkg39-1-1.noarch@available solvable:filelist /usr/share/pkg39/d0/?Q`3)v{Lgd@)3(׺;?i|ILaFxg6eE.;~X
+attr pkg39-1-1.noarch@available solvable:filelist /usr/share/pkg39/d0/+=~^ji@=L[÷F`{tLgc<pp^?qqGI".pHrlx
+attr pkg39-1-1.noarch@available solvable:filelist /usr/share/pkg39/d0/`U3J3<iF|LgM*}ĸwtEdSjN].B=~
+attr pkg39-1-1.noarch@available solvable:filelist /usr/share/pkg39/d0/VR,ZC]w1ywģ+Lh?Sq-!]*aDwQ0
+attr pkg39-1-1.noarch@available solvable:filelist /usr/share/pkg39/d1/8"Աd2rҼUs[jI_ITH[<3C7Ϣ9|PJqYRXo
+attr pkg39-1-1.noarch@available solvable:filelist /usr/share/pkg39/d1/?o:{jԭ1q]lJw]ªy)%Z)B[2{'_,-飷
+attr pkg39-1-1.noarch@available solvable:filelist /usr/share/pkg39/d1/@!:8e`FLWn)'_n%5Jlĥ,M|mpN;'주mHLezS̤01Y
+attr pkg39-1-1.noarch@available solvable:filelist /usr/share/pkg39/d1/I(9,r'mwz-md3%cQ{:KC'fn+M^S
+attr pkg39-1-1.noarch@available solvable:filelist /usr/share/pkg39/d1/W>$]lW~F~x>na޹)`ٷgS=2E=wF+4F
+attr pkg39-1-1.noarch@available solvable:filelist /usr/share/pkg39/d1/C)nSr_0P[L8Hmʥw0C}38uNsO1Z꣨w
+attr pkg39-1-1.noarch@available solvable:filelist /usr/share/pkg39/d1/5$;GP[*~,jmiӫV0`kp̯ؼ'δ}K
+attr pkg39-1-1.noarch@available solvable:filelist /usr/share/pkg39/d2/]z<Oj"s;90ce[t2X,5k:f|oIp׳v<zs*
+attr pkg39-1-1.noarch@available solvable:filelist /usr/share/pkg39/d2/_EzP9`(NTU.U_-Y)WM-bF-Z5snubya(^4P061Qk
+attr pkg39-1-1.noarch@available solvable:filelist /usr/share/pkg39/d2/vrz)ʸsNB5F-(T@X1릴S)7|wBa7ճp%
+attr pkg39-1-1.noarch@available solvable:filelist /usr/share/pkg39/d2/xE-4gT5YZU>^H>ҭ,cTMV083X(Pծ<0Icc
+attr pkg39-1-1.noarch@available solvable:filelist /usr/share/pkg39/d2/y߬XM'APPiy;uݫ{5)0{zjGz;j{h
+attr pkg39-1-1.noarch@available solvable:filelist /usr/share/pkg39/d2/|(*cO:1rXV+h;48)HMϽ@)rP|wIdТ@
+attr pkg39-1-1.noarch@available solvable:name pkg39
+attr pkg39-1-1.noarch@available solvable:provides cap39 = 39
+attr pkg39-1-1.noarch@available solvable:requires cap38
+attr pkg39-1-1.noarch@available solvable:summary package number 39
+attr pkg4-2-1.noarch@available solvable:arch noarch
+attr pkg4-2-1.noarch@available solvable:buildtime 1600014404
+attr pkg4-2-1.noarch@available solvable:evr 2-1
+attr pkg4-2-1.noarch@available solvable:filelist /usr/share/pkg4/d0/<SGiS!Ob_v<lcM])bAEo+N`nBٶs>o'٫
+attr pkg4-2-1.noarch@available solvable:filelist /usr/share/pkg4/d0/hQxW,e2>FU!YKPXAM_:"C~:al}
+attr pkg4-2-1.noarch@available solvable:filelist /usr/share/pkg4/d0/`N3X"bC8|῰@%FlE(eFqG)KRZu|V1EnjnTi
+attr pkg4-2-1.noarch@available solvable:filelist /usr/share/pkg4/d0/.Vu24WI>K!b^F[E'OrO~8z5}00
+attr pkg4-2-1.noarch@available solvable:filelist /usr/share/pkg4/d0/Xd96<C]!D2Ÿ)h,"@xPxCjmo}8WS!<
+attr pkg4-2-1.noarch@available solvable:filelist /usr/share/pkg4/d0/о!߲vSi{-`|mK_X_}iP`yeeg
+attr pkg4-2-1.noarch@available solvable:filelist /usr/share/pkg4/d0/-yæ:i0"opK@`)')"L(<;|iƩGp0.߿D
+attr pkg4-2-1.noarch@available solvable:filelist /usr/share/pkg4/d1/"MiG?r"x]j726*czN=ڧBCi?Qyɿ̵Es&^b
+attr pkg4-2-1.noarch@available solvable:filelist /usr/share/pkg4/d1/:2L.yoi_8[&H)KڱtrSδ=).bC_vVboJ>Z0Z4
+attr pkg4-2-1.noarch@available solvable:filelist /usr/share/pkg4/d1/q3H37X8Ƕ1BH3FA7>F>65Kj.'V
+attr pkg4-2-1.noarch@available solvable:filelist /usr/share/pkg4/d1/Gҵ_IT:B%0j)P='Mw%0ta>*a?]VKi_1
+attr pkg4-2-1.noarch@available solvable:filelist /usr/share/pkg4/d1/(wHJ-̩֡*7]})7u]@sF2zPR={%_R8VSt:q-
+attr pkg4-2-1.noarch@available solvable:filelist /usr/share/pkg4/d1/5%N⣣2"vU*X$w}2׫tj3;rB:Ȳ-zUq
+attr pkg4-2-1.noarch@available solvable:filelist /usr/share/pkg4/d1/ʺP8^kV"T7POGoǼZj<phXmrRHzK
+attr pkg4-2-1.noarch@available solvable:filelist /usr/share/pkg4/d2/No,!~8-Wa];p1C<gBb٪g!ӦaG]UBl]9|.A0
+attr pkg4-2-1.noarch@available solvable:filelist /usr/share/pkg4/d2/U}os&D:X,`<bA7g=kھC}iwEHeYO]@+y62-2
+attr pkg4-2-1.noarch@available solvable:filelist /usr/share/pkg4/d2/]w%qnzhΡ3}lEs1|Dc;K>Eth24'f;ZNqu
+attr pkg4-2-1.noarch@available solvable:filelist /usr/share/pkg4/d2/|;E4fK-Z|WWY&):J%}{cRVkngUfY|N(e+s@,ca4
+attr pkg4-2-1.noarch@available solvable:filelist /usr/share/pkg4/d2/~9<g3p{;NxV]Bq6uW9*.omn6ް5b{^30rinn&
+attr pkg4-2-1.noarch@available solvable:filelist /usr/share/pkg4/d2/9A&u^Ңh:.MpM(JPQN[n9"V6Lm@
+attr pkg4-2-1.noarch@available solvable:name pkg4
+attr pkg4-2-1.noarch@available solvable:provides cap4 = 4
+attr pkg4-2-1.noarch@available solvable:requires cap3
+attr pkg4-2-1.noarch@available solvable:summary package number 4
+attr pkg5-3-1.noarch@available solvable:arch noarch
+attr pkg5-3-1.noarch@available solvable:buildtime 1600018005
+attr pkg5-3-1.noarch@available solvable:evr 3-1
+attr pkg5-3-1.noarch@available solvable:filelist /usr/share/pkg5/d0/(NiI87-m.PtU+Q>QOXMhRMu,2YdGA
+attr pkg5-3-1.noarch@available solvable:filelist /usr/share/pkg5/d0/:a1Rxǫ=^$g*yaUPd8=*?8-)UgܸwH_Uc&=C8]R
+attr pkg5-3-1.noarch@available solvable:filelist /usr/share/pkg5/d0/;rjkp<OmfvI29YB*i89({H28IS+ao0V7v
+attr pkg5-3-1.noarch@available solvable:filelist /usr/share/pkg5/d0/iNݻ4)w"6$07Hu`Jٸbisy}vb27x:.P
+attr pkg5-3-1.noarch@available solvable:filelist /usr/share/pkg5/d0/5ն9qC]JgjTfWǦpu"h~FCP;{v0b?vp$
+attr pkg5-3-1.noarch@available solvable:filelist /usr/share/pkg5/d0/=4mcIҵ~aOq"FutǸ4'ۮltXh_˳k$kF66k
+attr pkg5-3-1.noarch@available solvable:filelist /usr/share/pkg5/d0/RPeG[!Ta)DqYsh_a8e1lڽ9HkH"Qs4b
+attr pkg5-3-1.noarch@available solvable:filelist /usr/share/pkg5/d1/&J4p|P;]ynGe2ܱ4Qn3ߤ-{^WEheھ
+attr pkg5-3-1.noarch@available solvable:filelist /usr/share/pkg5/d1/q_Qm@(K;7FKpsl)*T>J6gEhH=N꺷
+attr pkg5-3-1.noarch@available solvable:filelist /usr/share/pkg5/d1/rY7p1l(z;779N͡:nB5ZNG7m.@A5=[`Z
+attr pkg5-3-1.noarch@available solvable:filelist /usr/share/pkg5/d1/r4l81@QpO*Q6?+B^f7W$Ou+L]hK67eB8ָ
+attr pkg5-3-1.noarch@available solvable:filelist /usr/share/pkg5/d1/&"u_Vź~{@~GC}O@n)d,A$ҺΣp`S2s[!
+attr pkg5-3-1.noarch@available solvable:filelist /usr/share/pkg5/d1/dl"f$ĬgBwu4̡[~"pHd&cu˴вˤ=dp7
+attr pkg5-3-1.noarch@available solvable:filelist /usr/share/pkg5/d1/::2tQyN5$4CSJF^Y8]%"C@h^˿1?AC6:
+attr pkg5-3-1.noarch@available solvable:filelist /usr/share/pkg5/d2/,"o?vmatnz!2+q.=ٵ;{Xó_1bMxȩ
+attr pkg5-3-1.noarch@available solvable:filelist /usr/share/pkg5/d2/a-~ڱIdSA(̺Fwm}bUP9?JqbyqbLK:n~gPW=
+attr pkg5-3-1.noarch@available solvable:filelist /usr/share/pkg5/d2/uXP|?x:Lgf5Y+_]L[:41nD(orrJO
+attr pkg5-3-1.noarch@available solvable:filelist /usr/share/pkg5/d2/~JA[C(Eq%N-ҽ4_'_&RR]4SmĻΣV8c
+attr pkg5-3-1.noarch@available solvable:filelist /usr/share/pkg5/d2/H}F%68~1UG%ɡ4tFYs0޸GOn+;[5Q
+attr pkg5-3-1.noarch@available solvable:filelist /usr/share/pkg5/d2/"PyܶFi|)p߼[NZjm8v1F3k(pW%.Y)
+attr pkg5-3-1.noarch@available solvable:name pkg5
+attr pkg5-3-1.noarch@available solvable:provides cap5 = 5
+attr pkg5-3-1.noarch@available solvable:requires cap4
+attr pkg5-3-1.noarch@available solvable:summary package number 5
+attr pkg6-1-1.noarch@available solvable:arch noarch
+attr pkg6-1-1.noarch@available solvable:buildtime 1600021606
+attr pkg6-1-1.noarch@available solvable:evr 1-1
+attr pkg6-1-1.noarch@available solvable:filelist /usr/share/pkg6/d0/1lѸy}Xa,Y)T}[Zed8Xd>n)z)U|٨,Z`gQJ$E+S"
+attr pkg6-1-1.noarch@available solvable:filelist /usr/share/pkg6/d0/dre4;;k<MpdHk֥+O9W$,3]D|nP
+attr pkg6-1-1.noarch@available solvable:filelist /usr/share/pkg6/d0/hܹp4ɩV*jIC?%`a+hqǨ=XkxU`whAfvo"
+attr pkg6-1-1.noarch@available solvable:filelist /usr/share/pkg6/d0/uinm*q,_1R`gAjw[5e8]5̮<5g'$Q
+attr pkg6-1-1.noarch@available solvable:filelist /usr/share/pkg6/d0/A[a١4;fԼu˿2TF%iVKPXW)
+attr pkg6-1-1.noarch@available solvable:filelist /usr/share/pkg6/d0/B奩djn^x9@UW,&*@A,|6Z6)B"]EV!b%Iu7
+attr pkg6-1-1.noarch@available solvable:filelist /usr/share/pkg6/d0/٩t]4FsZJ'9pgyض:Au:TF0nYv:2=G;b7-
+attr pkg6-1-1.noarch@available solvable:filelist /usr/share/pkg6/d1/7gPƾqi?7508`nýWJ}dӢK{Di-bq>31b
+attr pkg6-1-1.noarch@available solvable:filelist /usr/share/pkg6/d1/efo`MnC8ì)z:MzPʮĮd!.WdC}E?ݻU
+attr pkg6-1-1.noarch@available solvable:filelist /usr/share/pkg6/d1/tȧP6&1(zQw"v}C%Xu2Oy?pt[c;Cu~4^.?kPa,%:+X
+attr pkg6-1-1.noarch@available solvable:filelist /usr/share/pkg6/d1/x**ض+(]o]"8:<%?uqWZC,@mұ6Ϳ4{K)b
+attr pkg6-1-1.noarch@available solvable:filelist /usr/share/pkg6/d1/Wz6CK.7yPcg1_tx8o;k0{b~=_uMէ+iX
+attr pkg6-1-1.noarch@available solvable:filelist /usr/share/pkg6/d1/+޺EFs~&>1a4~}L9^psYk%xjreRE$3F&Z
+attr pkg6-1-1.noarch@available solvable:filelist /usr/share/pkg6/d1/>vI>HX)YSw%$2;!gUAD@bBzJ}UuP+B
+attr pkg6-1-1.noarch@available solvable:filelist /usr/share/pkg6/d2/SR~MJKZ'Aҳ:_>u*1&n2v3{+L4^)L'|'@
+attr pkg6-1-1.noarch@available solvable:filelist /usr/share/pkg6/d2/w_)`©[+~fPͧWr%.Q}AGB>YAqOXq2D4WD@)
+attr pkg6-1-1.noarch@available solvable:filelist /usr/share/pkg6/d2/"g!'lvDݼ&h]{6(nM6wtStذ|PŢ
+attr pkg6-1-1.noarch@available solvable:filelist /usr/share/pkg6/d2/ldzq<p5K˳"ߵlA{Yfz.Σ»&ig6g(;p
+attr pkg6-1-1.noarch@available solvable:filelist /usr/share/pkg6/d2/_=<6oh8|{:x3_f!7W<MKQ~Ho`&)*˦k
+attr pkg6-1-1.noarch@available solvable:filelist /usr/share/pkg6/d2/p'pt9!cO}v.!D2go;CƦze7gOUDŸ
+attr pkg6-1-1.noarch@available solvable:name pkg6
+attr pkg6-1-1.noarch@available solvable:provides cap6 = 6
+attr pkg6-1-1.noarch@available solvable:requires cap5
+attr pkg6-1-1.noarch@available solvable:summary package number 6
+attr pkg7-2-1.noarch@available solvable:arch noarch
+attr pkg7-2-1.noarch@available solvable:buildtime 1600025207
+attr pkg7-2-1.noarch@available solvable:evr 2-1
+attr pkg7-2-1.noarch@available solvable:filelist /usr/share/pkg7/d0/3-xYaX&L3e}7hUHL?(9t-v[6B&a~I{EW3|WMi
+attr pkg7-2-1.noarch@available solvable:filelist /usr/share/pkg7/d0/@M+eAfQ0.ls'j2MbYvW"YEtn@LdSKly
+attr pkg7-2-1.noarch@available solvable:filelist /usr/share/pkg7/d0/M@{2dEDtMǿZVIE٬qʴnh8+Y&1,;1zbJ⣡&
+attr pkg7-2-1.noarch@available solvable:filelist /usr/share/pkg7/d0/b!_Y*Ck?L(AeDwJ!_~x6Nұ<6wV}Ukvr.P
+attr pkg7-2-1.noarch@available solvable:filelist /usr/share/pkg7/d0/U>C21~Unlógr-aF4bgD~$r(4@??poAD
+attr pkg7-2-1.noarch@available solvable:filelist /usr/share/pkg7/d0/UUTMU|9'sE[iS5hyzաXVMIbJ@OU
+attr pkg7-2-1.noarch@available solvable:filelist /usr/share/pkg7/d0/*cD-rQ!hM~LfõE>O)YP6&9ik6WPj_1bhe
+attr pkg7-2-1.noarch@available solvable:filelist /usr/share/pkg7/d1/0C?(XW?iW:{Mc-4u_v;pfxGpLt~^+_pih6c4"
+attr pkg7-2-1.noarch@available solvable:filelist /usr/share/pkg7/d1/D<d{kdVgl}]M:r-DX*vwA$ˮM=%
+attr pkg7-2-1.noarch@available solvable:filelist /usr/share/pkg7/d1/QT.P^8h[Ĥ_h,Yv_Ry"dmҧP6Qx_-'L<QX
+attr pkg7-2-1.noarch@available solvable:filelist /usr/share/pkg7/d1/R2>:R|O8>CߤKϳN7u`@˿"{]0UaStZui}rs
+attr pkg7-2-1.noarch@available solvable:filelist /usr/share/pkg7/d1/r''[S}xEʩ3udZ(rW59m,ݩ&L-ilV!z
+attr pkg7-2-1.noarch@available solvable:filelist /usr/share/pkg7/d1/*g>J(P+GpntjDJkeO<4U&|=Z)P",SD>4)
+attr pkg7-2-1.noarch@available solvable:filelist /usr/share/pkg7/d1/@֩u~QSϭ@78yvpx9+hޯy4ID,ӥ_z0P^bM.
+attr pkg7-2-1.noarch@available solvable:filelist /usr/share/pkg7/d2/&RmvP`YQh'n'Y&@m)t1IvD$N%?
+attr pkg7-2-1.noarch@available solvable:filelist /usr/share/pkg7/d2/-)pmq%13$765PtCи[H}`qۯi^Ep`upV2:D-
+attr pkg7-2-1.noarch@available solvable:filelist /usr/share/pkg7/d2/X$($ߺKEgDIaRk,fh?L49G@D%s-km{Ap4oOj
+attr pkg7-2-1.noarch@available solvable:filelist /usr/share/pkg7/d2/v}mJ)@ILPHJ'˭]3Abh2(mS-P^x&`
+attr pkg7-2-1.noarch@available solvable:filelist /usr/share/pkg7/d2/'23diV>8%woXXT--Xu~;;9ODLf"iĻ
+attr pkg7-2-1.noarch@available solvable:filelist /usr/share/pkg7/d2/"6'L,H.ʨPpD_Ye[2+48GC=PqoISe5JQ,רqe
+attr pkg7-2-1.noarch@available solvable:name pkg7
+attr pkg7-2-1.noarch@available solvable:provides cap7 = 7
+attr pkg7-2-1.noarch@available solvable:requires cap6
+attr pkg7-2-1.noarch@available solvable:summary package number 7
+attr pkg8-3-1.noarch@available solvable:arch noarch
+attr pkg8-3-1.noarch@available solvable:buildtime 1600028808
+attr pkg8-3-1.noarch@available solvable:evr 3-1
+attr pkg8-3-1.noarch@available solvable:filelist /usr/share/pkg8/d0/25lnIN[O)$;mڦf԰iWU6,1+ƾ޷F`*AYl
+attr pkg8-3-1.noarch@available solvable:filelist /usr/share/pkg8/d0/<[eS]xi.ewS0niuOGT)2SпsJ1k"V^
+attr pkg8-3-1.noarch@available solvable:filelist /usr/share/pkg8/d0/`,~yex^;t,>{¾~QTH@Jgal7ţM_I%@$sjyI
+attr pkg8-3-1.noarch@available solvable:filelist /usr/share/pkg8/d0/o'zЭVeB$iAa25E.v{+$3}KCZ츲aM2rԸߦg`Feu
+attr pkg8-3-1.noarch@available solvable:filelist /usr/share/pkg8/d0/ӳ9jq;dWTStgvKuXzY֢|GYCVtWaWTl7
+attr pkg8-3-1.noarch@available solvable:filelist /usr/share/pkg8/d0/592]p޷>.UB?FU$RzkOzɣײ?})?h
+attr pkg8-3-1.noarch@available solvable:filelist /usr/share/pkg8/d0/bJ*g49yI&zTUs|&b!.A8Nh6`C
+attr pkg8-3-1.noarch@available solvable:filelist /usr/share/pkg8/d1/0+NpnUg۽u`Czzs^1Yl=hR%2(Xط:2Pi&]
+attr pkg8-3-1.noarch@available solvable:filelist /usr/share/pkg8/d1/7}PнJeЬva37s'mI2R-S}(,WҼ|s*
+attr pkg8-3-1.noarch@available solvable:filelist /usr/share/pkg8/d1/MC}7QWwZTn+Ih칯h4dKAYqyqH~D2ƻbc!j2G
+attr pkg8-3-1.noarch@available solvable:filelist /usr/share/pkg8/d1/_-}rJzqKyoM=xǥH$Hk;|7)pkPq!@'XITsu
+attr pkg8-3-1.noarch@available solvable:filelist /usr/share/pkg8/d1/e'([Wirl>)p}M~4Ki).VL4:NO}45|aR`
+attr pkg8-3-1.noarch@available solvable:filelist /usr/share/pkg8/d1/gDBHqn@pZda%cM!;_2q|8xO>D0BJ1`
+attr pkg8-3-1.noarch@available solvable:filelist /usr/share/pkg8/d1/AEL)yi!9&-;cYZ[]еAndi=ݯY!qPE$q9
+attr pkg8-3-1.noarch@available solvable:filelist /usr/share/pkg8/d2/&ӱvCziPVN!G-9J&2nS+lU{H&DZTDD$AxrQSK1JShpD+~~
+attr pkg8-3-1.noarch@available solvable:filelist /usr/share/pkg8/d2/(IunQ,kXhV:6ЧdKjDe~Jh_ix}An*e!K֡
+attr pkg8-3-1.noarch@available solvable:filelist /usr/share/pkg8/d2/8'T8wD!{q7!2Fk[YH:_nl9߼8,a6
+attr pkg8-3-1.noarch@available solvable:filelist /usr/share/pkg8/d2/D[r%Li:50.wkd;W^@pR$JNE)
+attr pkg8-3-1.noarch@available solvable:filelist /usr/share/pkg8/d2/GW|kHXc~"vq@h;g7bfS3SA6sAڭ59c4KmdEe&]@6
+attr pkg8-3-1.noarch@available solvable:filelist /usr/share/pkg8/d2/XNyt0O˭ebfkBBS{(,U`(i6inZ=%Z*dֺ{bZTo4h
+attr pkg8-3-1.noarch@available solvable:name pkg8
+attr pkg8-3-1.noarch@available solvable:provides cap8 = 8
+attr pkg8-3-1.noarch@available solvable:requires cap7
+attr pkg8-3-1.noarch@available solvable:summary package number 8
+attr pkg9-1-1.noarch@available solvable:arch noarch
+attr pkg9-1-1.noarch@available solvable:buildtime 1600032409
+attr pkg9-1-1.noarch@available solvable:evr 1-1
+attr pkg9-1-1.noarch@available solvable:filelist /usr/share/pkg9/d0/:?6+!vA6?~UO7f}FܪsCh]Q:uM!zzA}[b9o
+attr pkg9-1-1.noarch@available solvable:filelist /usr/share/pkg9/d0/?cJR{c8*jgYulB@'4mbS15,H>L<5h4q>Y
+attr pkg9-1-1.noarch@available solvable:filelist /usr/share/pkg9/d0/Hz6|;4&hyIX05NHo|FʢIuQyYBDWPD%
+attr pkg9-1-1.noarch@available solvable:filelist /usr/share/pkg9/d0/LPqGG"W>;vG׫ٱR3k[(p^կϨ(d267{XL
+attr pkg9-1-1.noarch@available solvable:filelist /usr/share/pkg9/d0/}js>]:=t<51Ωj*3Gb`{Df}g>綻>ݢu
+attr pkg9-1-1.noarch@available solvable:filelist /usr/share/pkg9/d0/-}Ȩ0TX@@n3]SELYDuB5wta11PC+ֶ_|鸮
+attr pkg9-1-1.noarch@available solvable:filelist /usr/share/pkg9/d0/e^xiPQ+LWLnv?N60AXSkcy:E(0l
+attr pkg9-1-1.noarch@available solvable:filelist /usr/share/pkg9/d1/1WHSHܷ|p!SRZ(NADb3>XTID7^aE
+attr pkg9-1-1.noarch@available solvable:filelist /usr/share/pkg9/d1/<c<I=ghW9^=|5UYS'4p`XuGwApYYwɻfXXZ
+attr pkg9-1-1.noarch@available solvable:filelist /usr/share/pkg9/d1/X2aS9`=F2$](sAAJE!jXh2KG"n%j>
+attr pkg9-1-1.noarch@available solvable:filelist /usr/share/pkg9/d1/gHlס%oαdK0s?tBbs`yvkDkK[@86gUjc
+attr pkg9-1-1.noarch@available solvable:filelist /usr/share/pkg9/d1/|&9)={m;`D]HIdwd|N]fGtSo=V%NAY?C˼S_L
+attr pkg9-1-1.noarch@available solvable:filelist /usr/share/pkg9/d1/>orFl*+'JbYXSKL8Q}W}_0*8gTWlb
+attr pkg9-1-1.noarch@available solvable:filelist /usr/share/pkg9/d1/rbtFFϩIj*SUv)%qH}yWNNgOKWY=Oz|FP1
+attr pkg9-1-1.noarch@available solvable:filelist /usr/share/pkg9/d2/A@N.0&rJV}.{HsZȺ糬^J{]`fbAk4~[Ukcȱ
+attr pkg9-1-1.noarch@available solvable:filelist /usr/share/pkg9/d2/W40»DPL}D$C+9wWvhjQ={gU?8F'
+attr pkg9-1-1.noarch@available solvable:filelist /usr/share/pkg9/d2/W5o-BžDE8TM&8W~i_ȵ.{=9Ekt5^2
+attr pkg9-1-1.noarch@available solvable:filelist /usr/share/pkg9/d2/5AZz!3q^}0&|Wȱh=H`H>ҢơB
+attr pkg9-1-1.noarch@available solvable:filelist /usr/share/pkg9/d2/ҭdu_~1]O5N^qڦ%oZMͼ]H,0k)EpqӧL
+attr pkg9-1-1.noarch@available solvable:filelist /usr/share/pkg9/d2/clfpi@&F0oMl.uEԺ:B")iaV}zTcC@O]
+attr pkg9-1-1.noarch@available solvable:name pkg9
+attr pkg9-1-1.noarch@available solvable:provides cap9 = 9
+attr pkg9-1-1.noarch@available solvable:requires cap8
+attr pkg9-1-1.noarch@available solvable:summary package number 9
+attr single-1-1.noarch@single solvable:arch noarch
+attr single-1-1.noarch@single solvable:evr 1-1
+attr single-1-1.noarch@single solvable:filelist /usr/share/single/4aL?J=u<Z*Yn5$j-xPZ3סc8j$X۱0<k
+attr single-1-1.noarch@single solvable:filelist /usr/share/single/7pm~$BC|'hW?[<4u{+A}DT,.:<~[F,C4ǩa
+attr single-1-1.noarch@single solvable:filelist /usr/share/single/=ν]17q1;pT<vdO~@HBlfvLq*eBbo;uI2Ƹ
+attr single-1-1.noarch@single solvable:filelist /usr/share/single/sA<gڽ%6*~M2d`6By""1k4)Z>;.}II@
+attr single-1-1.noarch@single solvable:filelist /usr/share/single/,O>ɩMN.35<s*PC%)vm2pK৥I}>"rt
+attr single-1-1.noarch@single solvable:filelist /usr/share/single/WB64C@&X7NtVz3o_XV<Ce8_pEֵC3S1nܳ
+attr single-1-1.noarch@single solvable:filelist /usr/share/single/ZR=shХ,N=u.x;(np}_گNt,e$ǵi5Dyhv
+attr single-1-1.noarch@single solvable:filelist /usr/share/single/4fGy?=8<`ʲP:"áRw3=TgX4bdQd_kH
+attr single-1-1.noarch@single solvable:filelist /usr/share/single/*7ggcNME;IwWs.mv>f+=uncm}O%(P'01˿lT
+attr single-1-1.noarch@single solvable:filelist /usr/share/single/z:hKYJ¡9},-LSgm}nwPnak٨Kra8!}y:[
+attr single-1-1.noarch@single solvable:name single
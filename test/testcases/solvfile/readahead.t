@@ -0,0 +1,26 @@
+# read paged data with the read-ahead threads turned on. The data and
+# the page cache counters must not depend on the read-ahead.
+repo system 0 empty
+repo available 0 testtags files.repo
+system i686 rpm system
+pagecache 0 4
+reload available pagecodec=lz
+result attributes files.res
+nextjob
+reload available pagecodec=lz mmap
+result attributes files.res
+nextjob
+reload available pagecodec=lz
+result pagecache <inline>
+#>pagecache evictions 6
+#>pagecache hits 41
+#>pagecache misses 9
+#>pagecache used 131072
+nextjob
+pagecache 1048576 2
+reload available pagecodec=lz mmap
+result pagecache <inline>
+#>pagecache evictions 0
+#>pagecache hits 45
+#>pagecache misses 5
+#>pagecache used 163840
@@ -0,0 +1,32 @@
+# compact the pool after reloading a repo, the filelist is now in
+# vertical storage. It contains no pool ids, so compacting must work
+poolflags addfileprovidesfiltered
+repo system 0 empty
+repo junk 0 testtags <inline>
+#>=Pkg: junk0 1 1 noarch
+#>=Prv: junkcap0
+#>=Prv: junkcap1
+#>=Prv: junkcap2
+#>=Prv: junkcap3
+#>=Req: /opt/junk/file
+#>=Pkg: junk1 1 1 noarch
+#>=Prv: junkcap4
+#>=Prv: junkcap5
+#>=Prv: junkcap6
+#>=Prv: junkcap7
+#>=Req: /opt/junk/otherfile
+repo available 0 testtags <inline>
+#>=Pkg: A 1 1 noarch
+#>=Fls: /opt/weird/file
+#>=Pkg: B 1 1 noarch
+#>=Req: /opt/weird/file
+system i686 rpm system
+reload available
+compact junk
+job install name B
+result transaction,problems,memstats <inline>
+#>install A-1-1.noarch@available
+#>install B-1-1.noarch@available
+#>memstats rels 36
+#>memstats stringspace 37500
+#>memstats whatprovides 3660
@@ -0,0 +1,29 @@
+# compact the pool after freeing a repo. The ids of the non-standard
+# file dependencies must be renumbered, /opt/weird/file is only found
+# by the lazy file provides lookup
+poolflags addfileprovidesfiltered
+repo system 0 empty
+repo junk 0 testtags <inline>
+#>=Pkg: junk0 1 1 noarch
+#>=Prv: junkcap0
+#>=Prv: junkcap1
+#>=Prv: junkcap2
+#>=Prv: junkcap3
+#>=Req: /opt/junk/file
+#>=Pkg: junk1 1 1 noarch
+#>=Prv: junkcap4
+#>=Prv: junkcap5
+#>=Prv: junkcap6
+#>=Prv: junkcap7
+#>=Req: /opt/junk/otherfile
+repo available 0 testtags <inline>
+#>=Pkg: A 1 1 noarch
+#>=Fls: /opt/weird/file
+#>=Pkg: B 1 1 noarch
+#>=Req: /opt/weird/file
+system i686 rpm system
+compact junk
+job install name B
+result transaction,problems <inline>
+#>install A-1-1.noarch@available
+#>install B-1-1.noarch@available
@@ -0,0 +1,18 @@
+# string lookups with stored string hashes
+repo system 0 empty
+repo available 0 testtags <inline>
+#>=Pkg: bash 1 1 noarch
+#>=Fls: /usr/bin/bash
+#>=Fls: /usr/bin/bashbug
+#>=Pkg: coreutils 1 1 noarch
+#>=Fls: /usr/bin/basename
+#>=Pkg: A 1 1 noarch
+#>=Req: /usr/bin/bashbug
+#>=Req: /usr/bin/basename
+system i686 rpm system
+poolflags stringhashes
+job install name A
+result transaction,problems <inline>
+#>install A-1-1.noarch@available
+#>install bash-1-1.noarch@available
+#>install coreutils-1-1.noarch@available
@@ -35,6 +35,16 @@ keyfilter_solv(Repo *repo, Repokey *key, void *kfdata)
  */
 void
 tool_write(Repo *repo, FILE *fp)
+{
+  tool_write_flags(repo, fp, 0, REPOWRITER_PAGECODEC_DEFAULT, 0, 0, 0);
+}
+
+/*
+ * Write <repo> to fp, using the specified repowriter flags, page codec
+ * and number of compression threads. The cookie is stored as userdata.
+ */
+void
+tool_write_flags(Repo *repo, FILE *fp, int writerflags, int pagecodec, int nthreads, const unsigned char *cookie, int cookielen)
 {
   Repodata *info;
   Queue addedfileprovides;
@@ -57,6 +67,15 @@ tool_write(Repo *repo, FILE *fp)
   repodata_internalize(info);
   writer = repowriter_create(repo);
   repowriter_set_keyfilter(writer, keyfilter_solv, 0);
+  repowriter_set_flags(writer, writerflags);
+  if (!repowriter_set_pagecodec(writer, pagecodec))
+    {
+      fprintf(stderr, "page codec %d is not supported\n", pagecodec);
+      exit(1);
+    }
+  repowriter_set_nthreads(writer, nthreads);
+  if (cookielen)
+    repowriter_set_userdata(writer, cookie, cookielen);
   if (repowriter_write(writer, fp) != 0)
     {
       fprintf(stderr, "repo write failed: %s\n", pool_errstr(repo->pool));
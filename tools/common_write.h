@@ -11,5 +11,6 @@
 #include "repo.h"
 
 void tool_write(Repo *repo, FILE *fp);
+void tool_write_flags(Repo *repo, FILE *fp, int writerflags, int pagecodec, int nthreads, const unsigned char *cookie, int cookielen);
 
 #endif
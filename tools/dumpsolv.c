@@ -14,6 +14,8 @@
 static int with_attr;
 static int dump_json;
 static int dump_userdata;
+static int dump_memstats;
+static int add_flags;
 
 #include "pool.h"
 #include "chksum.h"
@@ -319,6 +321,46 @@ dump_repodata(Repo *repo)
   printf("\n");
 }
 
+static void
+print_memstats(const char *indent, Pool_memstats *stats)
+{
+  printf("%sstringspace: %zu\n", indent, stats->stringspace);
+  printf("%srels: %zu\n", indent, stats->rels);
+  printf("%swhatprovides: %zu\n", indent, stats->whatprovides);
+  printf("%ssolvables: %zu\n", indent, stats->solvables);
+  printf("%sincore: %zu\n", indent, stats->incore);
+  printf("%sattr: %zu\n", indent, stats->attr);
+  printf("%spages: %zu\n", indent, stats->pages);
+  printf("%sschemata: %zu\n", indent, stats->schemata);
+  printf("%stotal: %zu\n", indent, stats->total);
+}
+
+static void
+dump_memstats_repo(Repo *repo)
+{
+  Pool_memstats stats;
+  Repodata *data;
+  size_t *keysizes;
+  int i, j;
+
+  memset(&stats, 0, sizeof(stats));
+  repo_memstats(repo, &stats);
+  printf("repo %d (%s) contains %d solvables\n", repo->repoid, repo->name, repo->nsolvables);
+  print_memstats("  ", &stats);
+  FOR_REPODATAS(repo, i, data)
+    {
+      memset(&stats, 0, sizeof(stats));
+      repodata_memstats(data, &stats);
+      printf("  repodata %d: %zu\n", i, stats.total);
+      keysizes = solv_calloc(data->nkeys, sizeof(size_t));
+      repodata_memused_keys(data, keysizes);
+      for (j = 1; j < data->nkeys; j++)
+	if (keysizes[j])
+	  printf("    %s (type %s): %zu\n", pool_id2str(repo->pool, data->keys[j].name), pool_id2str(repo->pool, data->keys[j].type), keysizes[j]);
+      solv_free(keysizes);
+    }
+}
+
 static void
 dump_repodata_json(Repo *repo, struct cbdata *cbdata)
 {
@@ -371,7 +413,7 @@ loadcallback(Pool *pool, Repodata *data, void *vdata)
       perror(location);
       return 0;
     }
-  r = repo_add_solv(data->repo, fp, REPO_USE_LOADING|REPO_LOCALPOOL);
+  r = repo_add_solv(data->repo, fp, REPO_USE_LOADING|REPO_LOCALPOOL|add_flags);
   fclose(fp);
   return !r ? 1 : 0;
 }
@@ -381,9 +423,11 @@ static void
 usage(int status)
 {
   fprintf( stderr, "\nUsage:\n"
-	   "dumpsolv [-a] [-j] [<solvfile>]\n"
+	   "dumpsolv [-a] [-j] [-m] [-M] [<solvfile>]\n"
 	   "  -a  read attributes.\n"
 	   "  -j  dump json format.\n"
+	   "  -m  map the solv file into memory.\n"
+	   "  -M  show the memory used by the repositories.\n"
 	   );
   exit(status);
 }
@@ -395,7 +439,7 @@ int main(int argc, char **argv)
   int c, i, j, n;
   Solvable *s;
   
-  while ((c = getopt(argc, argv, "uhaj")) >= 0)
+  while ((c = getopt(argc, argv, "uhajmM")) >= 0)
     {
       switch(c)
 	{
@@ -408,6 +452,12 @@ int main(int argc, char **argv)
 	case 'j':
 	  dump_json = 1;
 	  break;
+	case 'm':
+	  add_flags |= SOLV_ADD_MMAP;
+	  break;
+	case 'M':
+	  dump_memstats = 1;
+	  break;
 	case 'u':
 	  dump_userdata++;
 	  break;
@@ -469,7 +519,7 @@ int main(int argc, char **argv)
 	  exit(1);
 	}
       repo = repo_create(pool, argv[optind]);
-      if (repo_add_solv(repo, stdin, 0))
+      if (repo_add_solv(repo, stdin, add_flags | SOLV_ADD_DELTAS))
 	{
 	  fprintf(stderr, "could not read repository: %s\n", pool_errstr(pool));
 	  exit(1);
@@ -478,14 +528,23 @@ int main(int argc, char **argv)
   if (!pool->urepos)
     {
       repo = repo_create(pool, argc != 1 ? argv[1] : "<stdin>");
-      if (repo_add_solv(repo, stdin, 0))
+      if (repo_add_solv(repo, stdin, add_flags | SOLV_ADD_DELTAS))
 	{
 	  fprintf(stderr, "could not read repository: %s\n", pool_errstr(pool));
 	  exit(1);
 	}
     }
 
-  if (dump_json)
+  if (dump_memstats)
+    {
+      Pool_memstats stats;
+      FOR_REPOS(j, repo)
+	dump_memstats_repo(repo);
+      pool_memstats(pool, &stats);
+      printf("pool contains %d strings, %d rels\n", pool->ss.nstrings, pool->nrels);
+      print_memstats("  ", &stats);
+    }
+  else if (dump_json)
     {
       int openrepo = 0;
       struct cbdata cbdata;
@@ -0,0 +1,193 @@
+/*
+ * Copyright (c) 2025, SUSE LLC
+ *
+ * This program is licensed under the BSD license, read LICENSE.BSD
+ * for further information
+ */
+
+/*
+ * mapbench
+ *
+ * micro benchmark for the bitmap operations
+ */
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <getopt.h>
+
+#include "pool.h"
+#include "bitmap.h"
+#include "util.h"
+
+static void
+usage(int status)
+{
+  fprintf(stderr, "\nUsage:\n"
+	  "mapbench [-c] [-n bits] [-r rounds]\n"
+	  "  runs the bitmap operations on maps with the given number of bits\n"
+	  "  -c: check the results against a bit by bit implementation\n"
+	  );
+  exit(status);
+}
+
+static void
+fillmap(Map *m, int n, int every)
+{
+  int i;
+  map_init(m, n);
+  for (i = 0; i < n; i += 1 + rand() % every)
+    MAPSET(m, i);
+}
+
+/* compare map_popcount, map_next and map_and_not_into with the
+ * obvious MAPTST loops. Returns the number of errors. */
+static int
+checkmaps(int n, int every)
+{
+  Map a, b, t;
+  int i, j, cnt, errors = 0;
+
+  fillmap(&a, n, every);
+  fillmap(&b, n, every);
+  for (i = cnt = 0; i < n; i++)
+    if (MAPTST(&a, i))
+      cnt++;
+  if (map_popcount(&a) != cnt)
+    {
+      fprintf(stderr, "map_popcount(%d bits): %d != %d\n", n, map_popcount(&a), cnt);
+      errors++;
+    }
+  for (i = 0; i <= n; i++)
+    {
+      for (j = i; j < n; j++)
+	if (MAPTST(&a, j))
+	  break;
+      if (j == n)
+	j = -1;
+      if (map_next(&a, i) != j)
+	{
+	  fprintf(stderr, "map_next(%d bits, %d): %d != %d\n", n, i, map_next(&a, i), j);
+	  errors++;
+	  break;
+	}
+    }
+  map_init(&t, 0);
+  map_and_not_into(&t, &a, &b);
+  for (i = 0; i < n; i++)
+    if ((MAPTST(&t, i) != 0) != (MAPTST(&a, i) && !MAPTST(&b, i)))
+      {
+	fprintf(stderr, "map_and_not_into(%d bits): bit %d differs\n", n, i);
+	errors++;
+	break;
+      }
+  /* in place */
+  map_and_not_into(&a, &a, &b);
+  if (a.size != t.size || memcmp(a.map, t.map, a.size) != 0)
+    {
+      fprintf(stderr, "map_and_not_into(%d bits): in place result differs\n", n);
+      errors++;
+    }
+  map_free(&a);
+  map_free(&b);
+  map_free(&t);
+  return errors;
+}
+
+int
+main(int argc, char **argv)
+{
+  int n = 1000000, rounds = 1000;
+  int c, i, r, cnt, check = 0;
+  unsigned int now;
+  Map a, b, t;
+
+  while ((c = getopt(argc, argv, "chn:r:")) >= 0)
+    {
+      switch (c)
+	{
+	case 'h':
+	  usage(0);
+	  break;
+	case 'c':
+	  check = 1;
+	  break;
+	case 'n':
+	  n = atoi(optarg);
+	  break;
+	case 'r':
+	  rounds = atoi(optarg);
+	  break;
+	default:
+	  usage(1);
+	  break;
+	}
+    }
+  if (optind != argc || n <= 0 || rounds <= 0)
+    usage(1);
+  srand(42);
+  if (check)
+    {
+      int errors = 0;
+      /* odd sizes to hit the byte tails after the word loops */
+      for (i = 0; i < 200; i++)
+	errors += checkmaps(i, 1 + i % 7);
+      errors += checkmaps(n, 4);
+      errors += checkmaps(n, 1000);
+      if (errors)
+	{
+	  fprintf(stderr, "%d errors\n", errors);
+	  exit(1);
+	}
+      return 0;
+    }
+  fillmap(&a, n, 4);
+  fillmap(&b, n, 4);
+  map_init(&t, n);
+
+  now = solv_timems(0);
+  for (r = 0; r < rounds; r++)
+    map_and(&t, &a);
+  printf("map_and:          %6u ms\n", solv_timems(now));
+  now = solv_timems(0);
+  for (r = 0; r < rounds; r++)
+    map_or(&t, &a);
+  printf("map_or:           %6u ms\n", solv_timems(now));
+  now = solv_timems(0);
+  for (r = 0; r < rounds; r++)
+    map_subtract(&t, &b);
+  printf("map_subtract:     %6u ms\n", solv_timems(now));
+  now = solv_timems(0);
+  for (r = 0; r < rounds; r++)
+    map_invertall(&t);
+  printf("map_invertall:    %6u ms\n", solv_timems(now));
+  now = solv_timems(0);
+  for (r = 0; r < rounds; r++)
+    map_and_not_into(&t, &a, &b);
+  printf("map_and_not_into: %6u ms\n", solv_timems(now));
+  now = solv_timems(0);
+  for (r = cnt = 0; r < rounds; r++)
+    cnt += map_popcount(&a);
+  printf("map_popcount:     %6u ms (%d bits set)\n", solv_timems(now), cnt / rounds);
+
+  /* iterate over a sparse map */
+  map_empty(&t);
+  for (i = 0; i < n; i += 1000)
+    MAPSET(&t, i);
+  now = solv_timems(0);
+  for (r = cnt = 0; r < rounds; r++)
+    for (i = map_next(&t, 0); i >= 0; i = map_next(&t, i + 1))
+      cnt++;
+  printf("map_next:         %6u ms (%d bits set)\n", solv_timems(now), cnt / rounds);
+  now = solv_timems(0);
+  for (r = cnt = 0; r < rounds; r++)
+    for (i = 0; i < n; i++)
+      if (MAPTST(&t, i))
+	cnt++;
+  printf("MAPTST loop:      %6u ms (%d bits set)\n", solv_timems(now), cnt / rounds);
+
+  map_free(&a);
+  map_free(&b);
+  map_free(&t);
+  return 0;
+}
@@ -20,6 +20,7 @@
 
 #include "pool.h"
 #include "repo_solv.h"
+#include "repo_write.h"
 #ifdef SUSE
 #include "repo_autopattern.h"
 #endif
@@ -29,8 +30,12 @@ static void
 usage()
 {
   fprintf(stderr, "\nUsage:\n"
-	  "mergesolv [file] [file] [...]\n"
+	  "mergesolv [-Z] [-D] [-C] [-T threads] [file] [file] [...]\n"
 	  "  merges multiple solv files into one and writes it to stdout\n"
+	  "  -C  compact a solv file and its deltas, keeps the cookie\n"
+	  "  -Z  compress the data pages with zstd\n"
+	  "  -D  train a compression dictionary for the data pages\n"
+	  "  -T  compress the data pages with multiple threads, 1: one per cpu\n"
 	  );
   exit(0);
 }
@@ -62,6 +67,12 @@ main(int argc, char **argv)
   Pool *pool;
   Repo *repo;
   int with_attr = 0;
+  int writerflags = 0;
+  int pagecodec = REPOWRITER_PAGECODEC_DEFAULT;
+  int nthreads = 0;
+  int compact = 0;
+  const unsigned char *cookie = 0;
+  int cookielen = 0;
 #ifdef SUSE
   int add_auto = 0;
 #endif
@@ -70,7 +81,7 @@ main(int argc, char **argv)
   pool = pool_create();
   repo = repo_create(pool, "<mergesolv>");
   
-  while ((c = getopt(argc, argv, "ahX")) >= 0)
+  while ((c = getopt(argc, argv, "ahZDCT:X")) >= 0)
     {
       switch (c)
       {
@@ -80,6 +91,18 @@ main(int argc, char **argv)
 	case 'a':
 	  with_attr = 1;
 	  break;
+	case 'Z':
+	  pagecodec = REPOWRITER_PAGECODEC_ZSTD;
+	  break;
+	case 'D':
+	  writerflags |= REPOWRITER_PAGECODEC_DICT;
+	  break;
+	case 'C':
+	  compact = 1;
+	  break;
+	case 'T':
+	  nthreads = atoi(optarg);
+	  break;
 	case 'X':
 #ifdef SUSE
 	  add_auto = 1;
@@ -101,7 +124,7 @@ main(int argc, char **argv)
 	  perror(argv[optind]);
 	  exit(1);
 	}
-      if (repo_add_solv(repo, fp, 0))
+      if (repo_add_solv(repo, fp, SOLV_ADD_DELTAS))
 	{
 	  fprintf(stderr, "repo %s: %s\n", argv[optind], pool_errstr(pool));
 	  exit(1);
@@ -112,7 +135,9 @@ main(int argc, char **argv)
   if (add_auto)
     repo_add_autopattern(repo, 0);
 #endif
-  tool_write(repo, stdout);
+  if (compact)
+    cookie = repo_solv_cookie(repo, &cookielen);
+  tool_write_flags(repo, stdout, writerflags, pagecodec, nthreads, cookie, cookielen);
   pool_free(pool);
   return 0;
 }
@@ -1,7 +1,11 @@
 #include <stdio.h>
 #include <stdlib.h>
+#include <string.h>
 #include <unistd.h>
 #include <getopt.h>
+#ifdef ENABLE_PTHREADS
+#include <pthread.h>
+#endif
 
 #include "pool.h"
 #include "repo.h"
@@ -30,13 +34,17 @@ static struct resultflags2str {
   { TESTCASE_RESULT_ORDER,              "order" },
   { TESTCASE_RESULT_ORDEREDGES,         "orderedges" },
   { TESTCASE_RESULT_PROOF,              "proof" },
+  { TESTCASE_RESULT_WHATPROVIDES,       "whatprovides" },
+  { TESTCASE_RESULT_ATTRIBUTES,         "attributes" },
+  { TESTCASE_RESULT_PAGECACHE,          "pagecache" },
+  { TESTCASE_RESULT_MEMSTATS,           "memstats" },
   { 0, 0 }
 };
 
 static void
 usage(int ex)
 {
-  fprintf(ex ? stderr : stdout, "Usage: testsolv <testcase>\n");
+  fprintf(ex ? stderr : stdout, "Usage: testsolv [-w] [-F <threads>] [-C <threads>] [-B <count>] <testcase>\n");
   exit(ex);
 }
 
@@ -149,6 +157,301 @@ showwhy(Solver *solv, const char *showwhypkgstr)
   queue_free(&dq);
 }
 
+static void
+benchmark_propagation(Solver *solv, Queue *job, int count)
+{
+  static const char *layouts[] = { "watch lists", "watch vectors" };
+  int oldflag = solver_get_flag(solv, SOLVER_FLAG_WATCH_VECTORS);
+  int layout, i;
+
+  for (layout = 0; layout < 2; layout++)
+    {
+      unsigned int now, ms;
+      long long props = 0, visits = 0;
+
+      solver_set_flag(solv, SOLVER_FLAG_WATCH_VECTORS, layout);
+      now = solv_timems(0);
+      for (i = 0; i < count; i++)
+	{
+	  solver_solve(solv, job);
+	  props += solver_get_stat(solv, SOLVER_STAT_PROPAGATIONS);
+	  visits += solver_get_stat(solv, SOLVER_STAT_WATCHVISITS);
+	}
+      ms = solv_timems(now);
+      printf("%-13s: %d solves, %lld propagations, %lld watch visits, %u ms", layouts[layout], count, props, visits, ms);
+      if (ms)
+	printf(", %.0f propagations/s", (double)props * 1000. / ms);
+      printf("\n");
+    }
+  solver_set_flag(solv, SOLVER_FLAG_WATCH_VECTORS, oldflag);
+}
+
+#ifdef ENABLE_PTHREADS
+
+struct frozencheck {
+  Pool *pool;
+  Pool *datapool;
+  Queue *job;
+  Solver *solv;
+  int resultflags;
+  const char *result;
+  int failed;
+};
+
+/* solve the job again and do lookups with the thread's data position */
+static void *
+frozencheck_thread(void *vp)
+{
+  struct frozencheck *fc = vp;
+  Pool *pool = fc->pool;
+  Solver *solv;
+  Queue job;
+  Dataiterator di;
+  const char *str;
+  char *result;
+  int flag, v;
+
+  solv = solver_create(pool);
+  for (flag = 1; flag < 64; flag++)
+    if ((v = solver_get_flag(fc->solv, flag)) != -1)
+      solver_set_flag(solv, flag, v);
+  queue_init_clone(&job, fc->job);
+  solver_solve(solv, &job);
+  result = testcase_solverresult(solv, fc->resultflags);
+  if (strcmp(result, fc->result) != 0)
+    fc->failed = 1;
+  solv_free(result);
+  queue_free(&job);
+  solver_free(solv);
+
+  pool = fc->datapool;
+  dataiterator_init(&di, pool, 0, SOLVID_META, REPOSITORY_REPOMD_TYPE, 0, SEARCH_SUB);
+  while (dataiterator_step(&di))
+    {
+      dataiterator_setpos_parent(&di);
+      str = pool_lookup_str(pool, SOLVID_POS, REPOSITORY_REPOMD_TYPE);
+      if (!str || strcmp(str, di.kv.str) != 0)
+	fc->failed = 1;
+    }
+  dataiterator_free(&di);
+  return 0;
+}
+
+/* run the job in multiple threads on the frozen pool, every thread
+ * must get the same result. The pool must not be modified before
+ * freezing, as that would invalidate the whatprovides offsets in
+ * the job. The SOLVID_POS lookups are done on a separate pool with
+ * some struct data. */
+static int
+frozencheck(Solver *solv, Queue *job, int resultflags, const char *result, int nthreads)
+{
+  Pool *pool = solv->pool;
+  Pool *datapool;
+  struct frozencheck *fcs;
+  pthread_t *threads;
+  Repo *repo;
+  Repodata *data;
+  Id h;
+  char *myresult = 0;
+  int i, failed = 0;
+
+  /* the whatprovides cache is filled differently in frozen pools and
+   * page cache lookups are not counted */
+  if ((resultflags & (TESTCASE_RESULT_WHATPROVIDES | TESTCASE_RESULT_PAGECACHE | TESTCASE_RESULT_MEMSTATS)) != 0)
+    {
+      resultflags &= ~(TESTCASE_RESULT_WHATPROVIDES | TESTCASE_RESULT_PAGECACHE | TESTCASE_RESULT_MEMSTATS);
+      result = myresult = testcase_solverresult(solv, resultflags);
+    }
+  datapool = pool_create();
+  repo = repo_create(datapool, "frozencheck");
+  data = repo_add_repodata(repo, 0);
+  for (i = 0; i < 16; i++)
+    {
+      char type[16];
+      sprintf(type, "type%d", i);
+      h = repodata_new_handle(data);
+      repodata_set_str(data, h, REPOSITORY_REPOMD_TYPE, type);
+      repodata_add_flexarray(data, SOLVID_META, REPOSITORY_REPOMD, h);
+    }
+  repo_internalize(repo);
+
+  fcs = solv_calloc(nthreads, sizeof(*fcs));
+  threads = solv_calloc(nthreads, sizeof(*threads));
+  pool_freeze(pool);
+  pool_freeze(datapool);
+  for (i = 0; i < nthreads; i++)
+    {
+      fcs[i].pool = pool;
+      fcs[i].datapool = datapool;
+      fcs[i].job = job;
+      fcs[i].solv = solv;
+      fcs[i].resultflags = resultflags;
+      fcs[i].result = result;
+      pthread_create(threads + i, 0, frozencheck_thread, fcs + i);
+    }
+  for (i = 0; i < nthreads; i++)
+    {
+      pthread_join(threads[i], 0);
+      failed |= fcs[i].failed;
+    }
+  pool_unfreeze(datapool);
+  pool_unfreeze(pool);
+  solv_free(threads);
+  solv_free(fcs);
+  pool_free(datapool);
+  solv_free(myresult);
+  return failed;
+}
+
+#define CONCURRENT_EXTRA 4096
+
+struct concurrentcheck {
+  Pool *pool;
+  Pool *cpool;
+  int start;
+  Id *strids;
+  Id *relids;
+  Id *extraids;
+};
+
+static Id
+concurrentcheck_mapid(struct concurrentcheck *cc, Id id)
+{
+  if (ISRELDEP(id))
+    {
+      Reldep *rd = GETRELDEP(cc->pool, id);
+      return pool_rel2id(cc->cpool, concurrentcheck_mapid(cc, rd->name), concurrentcheck_mapid(cc, rd->evr), rd->flags, 1);
+    }
+  return id ? pool_str2id(cc->cpool, pool_id2str(cc->pool, id), 1) : 0;
+}
+
+/* intern all strings and rels of the testcase pool, every thread
+ * starts at a different position */
+static void *
+concurrentcheck_thread(void *vp)
+{
+  struct concurrentcheck *cc = vp;
+  Pool *pool = cc->pool;
+  int nstrings = pool->ss.nstrings, nrels = pool->nrels;
+  char buf[64];
+  int i, k;
+
+  for (k = 0; k < nstrings; k++)
+    {
+      i = (k + cc->start) % nstrings;
+      cc->strids[i] = concurrentcheck_mapid(cc, i);
+    }
+  for (k = 1; k < nrels; k++)
+    {
+      i = 1 + (k - 1 + cc->start) % (nrels - 1);
+      cc->relids[i] = concurrentcheck_mapid(cc, MAKERELDEP(i));
+    }
+  for (k = 0; k < CONCURRENT_EXTRA; k++)
+    {
+      i = (k + cc->start) % CONCURRENT_EXTRA;
+      sprintf(buf, "concurrent%d", i);
+      cc->extraids[i] = pool_str2id(cc->cpool, buf, 1);
+      pool_rel2id(cc->cpool, cc->extraids[i], ID_EMPTY + 1 + i % 64, REL_EQ, 1);
+    }
+  return 0;
+}
+
+/* check that the ids of the threads agree and that the pool has
+ * no duplicate strings or rels */
+static int
+concurrentcheck_verify(Pool *pool, Pool *cpool, struct concurrentcheck *ccs, int nthreads)
+{
+  char buf[64];
+  Reldep *rd;
+  int i, t;
+
+  for (t = 1; t < nthreads; t++)
+    if (memcmp(ccs[t].strids, ccs[0].strids, pool->ss.nstrings * sizeof(Id)) != 0 ||
+        memcmp(ccs[t].relids, ccs[0].relids, pool->nrels * sizeof(Id)) != 0 ||
+        memcmp(ccs[t].extraids, ccs[0].extraids, CONCURRENT_EXTRA * sizeof(Id)) != 0)
+      return 1;
+  for (i = 1; i < pool->ss.nstrings; i++)
+    if (strcmp(pool_id2str(cpool, ccs[0].strids[i]), pool_id2str(pool, i)) != 0)
+      return 1;
+  for (i = 1; i < pool->nrels; i++)
+    {
+      Reldep *crd = GETRELDEP(cpool, ccs[0].relids[i]);
+      rd = GETRELDEP(pool, MAKERELDEP(i));
+      if (crd->flags != rd->flags)
+	return 1;
+      if (crd->name != (ISRELDEP(rd->name) ? ccs[0].relids[GETRELID(rd->name)] : ccs[0].strids[rd->name]))
+	return 1;
+      if (crd->evr != (ISRELDEP(rd->evr) ? ccs[0].relids[GETRELID(rd->evr)] : ccs[0].strids[rd->evr]))
+	return 1;
+    }
+  for (i = 0; i < CONCURRENT_EXTRA; i++)
+    {
+      sprintf(buf, "concurrent%d", i);
+      if (strcmp(pool_id2str(cpool, ccs[0].extraids[i]), buf) != 0)
+	return 1;
+    }
+  for (i = 2; i < cpool->ss.nstrings; i++)
+    if (pool_str2id(cpool, pool_id2str(cpool, i), 0) != i)
+      return 1;
+  for (i = 1; i < cpool->nrels; i++)
+    {
+      rd = cpool->rels + i;
+      if (pool_rel2id(cpool, rd->name, rd->evr, rd->flags, 0) != MAKERELDEP(i))
+	return 1;
+    }
+  return 0;
+}
+
+/* intern the strings and rels of the pool in multiple threads into
+ * a new concurrent pool, with and without stored string hashes. Half
+ * of the strings are created beforehand so that both the pool hash and
+ * the concurrent shards are used. */
+static int
+concurrentcheck(Pool *pool, int nthreads)
+{
+  struct concurrentcheck *ccs;
+  pthread_t *threads;
+  Pool *cpool;
+  int i, t, hashes, failed = 0;
+
+  ccs = solv_calloc(nthreads, sizeof(*ccs));
+  threads = solv_calloc(nthreads, sizeof(*threads));
+  for (hashes = 0; hashes < 2 && !failed; hashes++)
+    {
+      cpool = pool_create();
+      pool_set_flag(cpool, POOL_FLAG_STRINGHASHES, hashes);
+      for (i = 2; i < pool->ss.nstrings; i += 2)
+	pool_str2id(cpool, pool_id2str(pool, i), 1);
+      pool_begin_concurrent(cpool);
+      for (t = 0; t < nthreads; t++)
+	{
+	  ccs[t].pool = pool;
+	  ccs[t].cpool = cpool;
+	  ccs[t].start = t * 7919;
+	  ccs[t].strids = solv_calloc(pool->ss.nstrings, sizeof(Id));
+	  ccs[t].relids = solv_calloc(pool->nrels, sizeof(Id));
+	  ccs[t].extraids = solv_calloc(CONCURRENT_EXTRA, sizeof(Id));
+	  pthread_create(threads + t, 0, concurrentcheck_thread, ccs + t);
+	}
+      for (t = 0; t < nthreads; t++)
+	pthread_join(threads[t], 0);
+      pool_end_concurrent(cpool);
+      failed = concurrentcheck_verify(pool, cpool, ccs, nthreads);
+      for (t = 0; t < nthreads; t++)
+	{
+	  solv_free(ccs[t].strids);
+	  solv_free(ccs[t].relids);
+	  solv_free(ccs[t].extraids);
+	}
+      pool_free(cpool);
+    }
+  solv_free(threads);
+  solv_free(ccs);
+  return failed;
+}
+
+#endif
+
 void
 doshowproof(Solver *solv, Id id, int flags, Queue *lq)
 {
@@ -212,6 +515,13 @@ main(int argc, char **argv)
   int multijob = 0;
   int rescallback = 0;
   int showproof = 0;
+  int benchmark = 0;
+  int watchvectors = 0;
+#ifdef ENABLE_PTHREADS
+  int frozenthreads = 0;
+  int reused = 0;
+  int concurrentthreads = 0;
+#endif
   int c;
   int ex = 0;
   const char *list = 0;
@@ -220,7 +530,7 @@ main(int argc, char **argv)
   const char *p;
 
   queue_init(&solq);
-  while ((c = getopt(argc, argv, "vmrhL:l:s:T:W:P")) >= 0)
+  while ((c = getopt(argc, argv, "vmrhwL:l:s:T:W:PB:F:C:")) >= 0)
     {
       switch (c)
       {
@@ -259,6 +569,20 @@ main(int argc, char **argv)
         case 'P':
 	  showproof = 1;
           break;
+        case 'B':
+	  benchmark = atoi(optarg);
+          break;
+        case 'w':
+	  watchvectors = 1;
+          break;
+#ifdef ENABLE_PTHREADS
+        case 'F':
+	  frozenthreads = atoi(optarg);
+          break;
+        case 'C':
+	  concurrentthreads = atoi(optarg);
+          break;
+#endif
         default:
 	  usage(1);
           break;
@@ -284,6 +608,8 @@ main(int argc, char **argv)
 	  queue_init(&job);
 	  result = 0;
 	  resultflags = 0;
+	  if (reusesolv && solver_get_flag(reusesolv, SOLVER_FLAG_INCREMENTAL))
+	    resultflags = TESTCASE_RESULT_REUSE_SOLVER;
 	  solv = testcase_read(pool, fp, argv[optind], &job, &result, &resultflags);
 	  if (!solv)
 	    {
@@ -292,12 +618,17 @@ main(int argc, char **argv)
 	      queue_free(&job);
 	      exit(resultflags == 77 ? 77 : 1);
 	    }
+#ifdef ENABLE_PTHREADS
+	  reused = reusesolv ? 1 : 0;
+#endif
 	  if (reusesolv)
 	    {
 	      solver_free(solv);
 	      solv = reusesolv;
 	      reusesolv = 0;
 	    }
+	  if (watchvectors)
+	    solver_set_flag(solv, SOLVER_FLAG_WATCH_VECTORS, 1);
 	  if (!multijob && !feof(fp))
 	    multijob = 1;
 
@@ -356,6 +687,8 @@ main(int argc, char **argv)
 		  queue_free(&q);
 		}
 	    }
+	  else if (benchmark > 0)
+	    benchmark_propagation(solv, &job, benchmark);
 	  else if (showwhypkgstr)
 	    {
 	      solver_solve(solv, &job);
@@ -448,6 +781,13 @@ main(int argc, char **argv)
 		      ex = 1;
 		      solv_free(resultdiff);
 		    }
+#ifdef ENABLE_PTHREADS
+		  else if (frozenthreads > 0 && !rescallback && !reused && frozencheck(solv, &job, resultflags, myresult, frozenthreads))
+		    {
+		      printf("Results differ in frozen pool\n");
+		      ex = 1;
+		    }
+#endif
 		}
 	      solv_free(result);
 	      solv_free(myresult);
@@ -525,6 +865,13 @@ main(int argc, char **argv)
 	}
       if (reusesolv)
 	solver_free(reusesolv);
+#ifdef ENABLE_PTHREADS
+      if (concurrentthreads > 0 && concurrentcheck(pool, concurrentthreads))
+	{
+	  printf("Ids differ in concurrent pool\n");
+	  ex = 1;
+	}
+#endif
       free_considered(pool);
       pool_free(pool);
       fclose(fp);